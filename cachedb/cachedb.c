@@ -47,22 +47,42 @@
 #include "util/net_help.h"
 #include "util/config_file.h"
 #include "util/data/msgreply.h"
-#include "util/data/msgencode.h"
 #include "services/cache/dns.h"
 #include "validator/val_neg.h"
 #include "validator/val_secalgo.h"
 #include "iterator/iter_utils.h"
+#include "util/data/dname.h"
+#include "util/storage/siphash.h"
 #include "sldns/parseutil.h"
 #include "sldns/wire2str.h"
 #include "sldns/sbuffer.h"
+#ifdef HAVE_LZ4
+#include <lz4.h>
+#endif
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
 
-#define CACHEDB_HASHSIZE 256 /* bit hash */
+/** largest value body that is decoded */
+#define CACHEDB_BODY_MAX 131072
+/** rrset flag: the owner is the query name */
+#define CACHEDB_RR_OWNER_QNAME 0x01
+/** rrset flag: the owner is that of the previous rrset */
+#define CACHEDB_RR_OWNER_PREV 0x02
+/** rrset flag: the class differs from the query class, and follows */
+#define CACHEDB_RR_CLASS 0x04
+/** rrset flag: the rrset key flags are not zero, and follow */
+#define CACHEDB_RR_FLAGS 0x08
+/** rrset flag: the RRs have TTLs that differ from the rrset TTL */
+#define CACHEDB_RR_TTLS 0x10
 
 /** the unit test testframe for cachedb, its module state contains
  * a cache for a couple queries (in memory). */
 struct testframe_moddata {
 	/** key for single stored data element, NULL if none */
-	char* stored_key;
+	uint8_t* stored_key;
+	/** length of the stored key */
+	size_t stored_keylen;
 	/** data for single stored data element, NULL if none */
 	uint8_t* stored_data;
 	/** length of stored data */
@@ -99,13 +119,14 @@ testframe_deinit(struct module_env* env, struct cachedb_env* cachedb_env)
 
 static int
 testframe_lookup(struct module_env* env, struct cachedb_env* cachedb_env,
-	char* key, struct sldns_buffer* result_buffer)
+	uint8_t* key, size_t key_len, struct sldns_buffer* result_buffer)
 {
 	struct testframe_moddata* d = (struct testframe_moddata*)
 		cachedb_env->backend_data;
 	(void)env;
-	verbose(VERB_ALGO, "testframe_lookup of %s", key);
-	if(d->stored_key && strcmp(d->stored_key, key) == 0) {
+	verbose(VERB_ALGO, "testframe_lookup");
+	if(d->stored_key && d->stored_keylen == key_len &&
+		memcmp(d->stored_key, key, key_len) == 0) {
 		if(d->stored_datalen > sldns_buffer_capacity(result_buffer))
 			return 0; /* too large */
 		verbose(VERB_ALGO, "testframe_lookup found %d bytes",
@@ -121,16 +142,17 @@ testframe_lookup(struct module_env* env, struct cachedb_env* cachedb_env,
 
 static void
 testframe_store(struct module_env* env, struct cachedb_env* cachedb_env,
-	char* key, uint8_t* data, size_t data_len)
+	uint8_t* key, size_t key_len, uint8_t* data, size_t data_len)
 {
 	struct testframe_moddata* d = (struct testframe_moddata*)
 		cachedb_env->backend_data;
 	(void)env;
-	verbose(VERB_ALGO, "testframe_store %s (%d bytes)", key, (int)data_len);
+	verbose(VERB_ALGO, "testframe_store (%d bytes)", (int)data_len);
 
 	/* free old data element (if any) */
 	free(d->stored_key);
 	d->stored_key = NULL;
+	d->stored_keylen = 0;
 	free(d->stored_data);
 	d->stored_data = NULL;
 	d->stored_datalen = 0;
@@ -141,13 +163,14 @@ testframe_store(struct module_env* env, struct cachedb_env* cachedb_env,
 		return;
 	}
 	d->stored_datalen = data_len;
-	d->stored_key = strdup(key);
+	d->stored_key = memdup(key, key_len);
 	if(!d->stored_key) {
 		free(d->stored_data);
 		d->stored_data = NULL;
 		d->stored_datalen = 0;
 		return;
 	}
+	d->stored_keylen = key_len;
 	/* (key,data) successfully stored */
 }
 
@@ -176,10 +199,28 @@ cachedb_apply_cfg(struct cachedb_env* cachedb_env, struct config_file* cfg)
 		if(!cachedb_env->backend) {
 			log_err("cachedb: cannot find backend name '%s",
 				backend_str);
-			return NULL;
+			return 0;
 		}
 	}
-	/* TODO see if more configuration needs to be applied or not */
+	cachedb_set_secret(cachedb_env, cfg->cachedb_secret);
+	if(strcmp(cfg->cachedb_compress, "lz4") == 0) {
+#ifdef HAVE_LZ4
+		cachedb_env->compress = CACHEDB_COMPRESS_LZ4;
+#else
+		log_err("cachedb: lz4 compression is not compiled in, "
+			"use --with-liblz4");
+		return 0;
+#endif
+	} else if(strcmp(cfg->cachedb_compress, "zstd") == 0) {
+#ifdef HAVE_ZSTD
+		cachedb_env->compress = CACHEDB_COMPRESS_ZSTD;
+#else
+		log_err("cachedb: zstd compression is not compiled in, "
+			"use --with-libzstd");
+		return 0;
+#endif
+	} else	cachedb_env->compress = CACHEDB_COMPRESS_NONE;
+	cachedb_env->compress_min = cfg->cachedb_compress_min;
 	return 1;
 }
 
@@ -262,182 +303,483 @@ error_response(struct module_qstate* qstate, int id, int rcode)
 	return 0;
 }
 
-/**
- * Hash the query name, type, class and dbacess-secret into lookup buffer.
- * @param qstate: query state with query info
- * 	and env->cfg with secret.
- * @param buf: returned buffer with hash to lookup
- * @param len: length of the buffer.
- */
-static void
-calc_hash(struct module_qstate* qstate, char* buf, size_t len)
+void
+cachedb_set_secret(struct cachedb_env* cachedb_env, const char* secret)
 {
-	uint8_t clear[1024];
-	size_t clen = 0;
-	uint8_t hash[CACHEDB_HASHSIZE/8];
-	const char* hex = "0123456789ABCDEF";
-	const char* secret = "default"; /* TODO: from qstate->env->cfg */
-	size_t i;
-	
-	/* copy the hash info into the clear buffer */
-	if(clen + qstate->qinfo.qname_len < sizeof(clear)) {
-		memmove(clear+clen, qstate->qinfo.qname,
-			qstate->qinfo.qname_len);
-		clen += qstate->qinfo.qname_len;
-	}
-	if(clen + 4 < sizeof(clear)) {
-		uint16_t t = htons(qstate->qinfo.qtype);
-		uint16_t c = htons(qstate->qinfo.qclass);
-		memmove(clear+clen, &t, 2);
-		memmove(clear+clen+2, &c, 2);
-		clen += 4;
-	}
-	if(secret && secret[0] && clen + strlen(secret) < sizeof(clear)) {
-		memmove(clear+clen, secret, strlen(secret));
-		clen += strlen(secret);
-	}
-	
-	/* hash the buffer */
-	secalgo_hash_sha256(clear, clen, hash);
-	memset(clear, 0, clen);
+	unsigned char hash[32];
+	if(!secret)
+		secret = "";
+	/* the hash key is the same on every server with the same secret,
+	 * so that they share the entries in the database */
+	secalgo_hash_sha256((unsigned char*)secret, strlen(secret), hash);
+	memcpy(cachedb_env->secret, hash, CACHEDB_SECRET_SIZE);
+}
 
-	/* hex encode output for portability (some online dbs need
-	 * no nulls, no control characters, and so on) */
-	log_assert(len >= sizeof(hash)*2 + 1);
-	(void)len;
-	for(i=0; i<sizeof(hash); i++) {
-		buf[i*2] = hex[(hash[i]&0xf0)>>4];
-		buf[i*2+1] = hex[hash[i]&0x0f];
+void
+cachedb_calc_key(struct cachedb_env* cachedb_env, struct query_info* qinfo,
+	uint8_t* key)
+{
+	uint8_t clear[LDNS_MAX_DOMAINLEN+4];
+	size_t clen = qinfo->qname_len;
+	uint64_t h;
+	if(clen > LDNS_MAX_DOMAINLEN)
+		clen = LDNS_MAX_DOMAINLEN;
+	memmove(clear, qinfo->qname, clen);
+	query_dname_tolower(clear);
+	sldns_write_uint16(clear+clen, qinfo->qtype);
+	sldns_write_uint16(clear+clen+2, qinfo->qclass);
+	clen += 4;
+	h = siphash24(cachedb_env->secret, clear, clen);
+	key[0] = CACHEDB_FORMAT_VERSION;
+	sldns_write_uint32(key+1, (uint32_t)(h>>32));
+	sldns_write_uint32(key+5, (uint32_t)h);
+}
+
+/** write an unsigned varint, 7 bits per byte, returns false if no space */
+static int
+write_varint(sldns_buffer* buf, uint64_t v)
+{
+	while(v >= 0x80) {
+		if(!sldns_buffer_available(buf, 1))
+			return 0;
+		sldns_buffer_write_u8(buf, (uint8_t)(v | 0x80));
+		v >>= 7;
 	}
-	buf[sizeof(hash)*2] = 0;
+	if(!sldns_buffer_available(buf, 1))
+		return 0;
+	sldns_buffer_write_u8(buf, (uint8_t)v);
+	return 1;
+}
+
+/** read an unsigned varint, returns false if malformed */
+static int
+read_varint(sldns_buffer* buf, uint64_t* v)
+{
+	int shift = 0;
+	uint8_t b;
+	*v = 0;
+	do {
+		if(sldns_buffer_remaining(buf) < 1 || shift > 63)
+			return 0;
+		b = sldns_buffer_read_u8(buf);
+		*v |= ((uint64_t)(b&0x7f)) << shift;
+		shift += 7;
+	} while(b & 0x80);
+	return 1;
 }
 
-/** convert data from return_msg into the data buffer */
+/** write a signed TTL offset, zigzag encoded as a varint */
 static int
-prep_data(struct module_qstate* qstate, struct sldns_buffer* buf)
-{
-	uint64_t timestamp, expiry;
-	size_t oldlim;
-	struct edns_data edns;
-	memset(&edns, 0, sizeof(edns));
-	edns.edns_present = 1;
-	edns.bits = EDNS_DO;
-	edns.ext_rcode = 0;
-	edns.edns_version = EDNS_ADVERTISED_VERSION;
-	edns.udp_size = EDNS_ADVERTISED_SIZE;
+write_ttl_offset(sldns_buffer* buf, time_t off)
+{
+	int64_t o = (int64_t)off;
+	return write_varint(buf, ((uint64_t)o << 1) ^ (uint64_t)(o >> 63));
+}
 
-	if(!qstate->return_msg || !qstate->return_msg->rep)
+/** read a signed TTL offset */
+static int
+read_ttl_offset(sldns_buffer* buf, time_t* off)
+{
+	uint64_t v;
+	if(!read_varint(buf, &v))
 		return 0;
-	if(verbosity >= VERB_ALGO)
-		log_dns_msg("cachedb encoding", &qstate->return_msg->qinfo,
-	                qstate->return_msg->rep);
-	if(!reply_info_answer_encode(&qstate->return_msg->qinfo,
-		qstate->return_msg->rep, 0, qstate->query_flags,
-		buf, 0, 1, qstate->env->scratch, 65535, &edns, 1, 0))
+	*off = (time_t)((int64_t)(v >> 1) ^ -(int64_t)(v & 1));
+	return 1;
+}
+
+/** write a name with a length byte, returns false if no space */
+static int
+write_dname(sldns_buffer* buf, uint8_t* nm, size_t len)
+{
+	if(len > 255 || !sldns_buffer_available(buf, 1+len))
 		return 0;
+	sldns_buffer_write_u8(buf, (uint8_t)len);
+	sldns_buffer_write(buf, nm, len);
+	return 1;
+}
 
-	/* TTLs in the return_msg are relative to time(0) so we have to
-	 * store that, we also store the smallest ttl in the packet+time(0)
-	 * as the packet expiry time */
-	/* qstate->return_msg->rep->ttl contains that relative shortest ttl */
-	timestamp = (uint64_t)*qstate->env->now;
-	expiry = timestamp + (uint64_t)qstate->return_msg->rep->ttl;
-	timestamp = htobe64(timestamp);
-	expiry = htobe64(expiry);
-	oldlim = sldns_buffer_limit(buf);
-	if(oldlim + sizeof(timestamp)+sizeof(expiry) >=
-		sldns_buffer_capacity(buf))
-		return 0; /* doesn't fit. */
-	sldns_buffer_set_limit(buf, oldlim + sizeof(timestamp)+sizeof(expiry));
-	sldns_buffer_write_at(buf, oldlim, &timestamp, sizeof(timestamp));
-	sldns_buffer_write_at(buf, oldlim+sizeof(timestamp), &expiry,
-		sizeof(expiry));
+/** read a name with a length byte, returns NULL if malformed */
+static uint8_t*
+read_dname(sldns_buffer* buf, struct regional* region, size_t* len)
+{
+	uint8_t* nm;
+	if(sldns_buffer_remaining(buf) < 1)
+		return NULL;
+	*len = (size_t)sldns_buffer_read_u8(buf);
+	if(*len == 0 || sldns_buffer_remaining(buf) < *len)
+		return NULL;
+	nm = sldns_buffer_current(buf);
+	if(dname_valid(nm, *len) != *len)
+		return NULL;
+	sldns_buffer_skip(buf, (ssize_t)*len);
+	return regional_alloc_init(region, nm, *len);
+}
 
+/** encode an rrset in the value body, returns false if it does not fit */
+static int
+encode_rrset(sldns_buffer* buf, struct query_info* qinfo,
+	struct ub_packed_rrset_key* k, struct ub_packed_rrset_key* prev,
+	time_t ttl)
+{
+	struct packed_rrset_data* d = (struct packed_rrset_data*)
+		k->entry.data;
+	size_t i, total = d->count + d->rrsig_count;
+	uint8_t fl = 0;
+	if(k->rk.dname_len == qinfo->qname_len &&
+		memcmp(k->rk.dname, qinfo->qname, qinfo->qname_len) == 0)
+		fl |= CACHEDB_RR_OWNER_QNAME;
+	else if(prev && k->rk.dname_len == prev->rk.dname_len &&
+		memcmp(k->rk.dname, prev->rk.dname, k->rk.dname_len) == 0)
+		fl |= CACHEDB_RR_OWNER_PREV;
+	if(ntohs(k->rk.rrset_class) != qinfo->qclass)
+		fl |= CACHEDB_RR_CLASS;
+	if(k->rk.flags != 0)
+		fl |= CACHEDB_RR_FLAGS;
+	for(i=0; i<total; i++) {
+		if(d->rr_ttl[i] != d->ttl) {
+			fl |= CACHEDB_RR_TTLS;
+			break;
+		}
+	}
+	if(!sldns_buffer_available(buf, 1))
+		return 0;
+	sldns_buffer_write_u8(buf, fl);
+	if(!(fl&(CACHEDB_RR_OWNER_QNAME|CACHEDB_RR_OWNER_PREV)) &&
+		!write_dname(buf, k->rk.dname, k->rk.dname_len))
+		return 0;
+	if(!sldns_buffer_available(buf, 2+2+4+1))
+		return 0;
+	sldns_buffer_write_u16(buf, ntohs(k->rk.type));
+	if((fl&CACHEDB_RR_CLASS))
+		sldns_buffer_write_u16(buf, ntohs(k->rk.rrset_class));
+	if((fl&CACHEDB_RR_FLAGS))
+		sldns_buffer_write_u32(buf, k->rk.flags);
+	sldns_buffer_write_u8(buf, (uint8_t)((d->trust<<4) | d->security));
+	if(!write_ttl_offset(buf, d->ttl - ttl) ||
+		!write_varint(buf, (uint64_t)d->count) ||
+		!write_varint(buf, (uint64_t)d->rrsig_count))
+		return 0;
+	if((fl&CACHEDB_RR_TTLS)) {
+		for(i=0; i<total; i++)
+			if(!write_ttl_offset(buf, d->rr_ttl[i] - d->ttl))
+				return 0;
+	}
+	/* the rdata has the rdlength in front, that gives the length */
+	for(i=0; i<total; i++) {
+		if(d->rr_len[i] < 2 || sldns_read_uint16(d->rr_data[i]) !=
+			d->rr_len[i]-2 ||
+			!sldns_buffer_available(buf, d->rr_len[i]))
+			return 0;
+		sldns_buffer_write(buf, d->rr_data[i], d->rr_len[i]);
+	}
 	return 1;
 }
 
-/** check expiry, return true if matches OK */
+/** encode the value body, returns false if it does not fit */
 static int
-good_expiry_and_qinfo(struct module_qstate* qstate, struct sldns_buffer* buf)
+encode_body(sldns_buffer* buf, struct query_info* qinfo,
+	struct reply_info* rep)
 {
-	uint64_t expiry;
-	/* the expiry time is the last bytes of the buffer */
-	if(sldns_buffer_limit(buf) < sizeof(expiry))
+	size_t i;
+	if(!write_dname(buf, qinfo->qname, qinfo->qname_len) ||
+		!sldns_buffer_available(buf, 2+2+2+1))
 		return 0;
-	sldns_buffer_read_at(buf, sldns_buffer_limit(buf)-sizeof(expiry),
-		&expiry, sizeof(expiry));
-	expiry = be64toh(expiry);
-
-	if((time_t)expiry < *qstate->env->now)
+	sldns_buffer_write_u16(buf, qinfo->qtype);
+	sldns_buffer_write_u16(buf, qinfo->qclass);
+	sldns_buffer_write_u16(buf, rep->flags);
+	sldns_buffer_write_u8(buf, (uint8_t)rep->security);
+	if(!write_varint(buf, (uint64_t)rep->an_numrrsets) ||
+		!write_varint(buf, (uint64_t)rep->ns_numrrsets) ||
+		!write_varint(buf, (uint64_t)rep->ar_numrrsets))
 		return 0;
-
+	for(i=0; i<rep->rrset_count; i++) {
+		if(!encode_rrset(buf, qinfo, rep->rrsets[i],
+			(i>0?rep->rrsets[i-1]:NULL), rep->ttl))
+			return 0;
+	}
 	return 1;
 }
 
-/** convert dns message in buffer to return_msg */
+/** compress the body at the end of the buffer, if that makes it smaller.
+ * returns false on failure, it is then left uncompressed. */
 static int
-parse_data(struct module_qstate* qstate, struct sldns_buffer* buf)
-{
-	struct msg_parse* prs;
-	struct edns_data edns;
-	uint64_t timestamp, expiry;
-	time_t adjust;
-	size_t lim = sldns_buffer_limit(buf);
-	if(lim < LDNS_HEADER_SIZE+sizeof(timestamp)+sizeof(expiry))
-		return 0; /* too short */
-
-	/* remove timestamp and expiry from end */
-	sldns_buffer_read_at(buf, lim-sizeof(expiry), &expiry, sizeof(expiry));
-	sldns_buffer_read_at(buf, lim-sizeof(expiry)-sizeof(timestamp),
-		&timestamp, sizeof(timestamp));
-	expiry = be64toh(expiry);
-	timestamp = be64toh(timestamp);
-
-	/* parse DNS packet */
-	regional_free_all(qstate->env->scratch);
-	prs = (struct msg_parse*)regional_alloc(qstate->env->scratch,
-		sizeof(struct msg_parse));
-	if(!prs)
-		return 0; /* out of memory */
-	memset(prs, 0, sizeof(*prs));
-	memset(&edns, 0, sizeof(edns));
-	sldns_buffer_set_limit(buf, lim - sizeof(expiry)-sizeof(timestamp));
-	if(parse_packet(buf, prs, qstate->env->scratch) != LDNS_RCODE_NOERROR) {
-		sldns_buffer_set_limit(buf, lim);
-		return 0;
+compress_body(struct cachedb_env* cachedb_env, sldns_buffer* buf,
+	size_t bodylen, struct regional* scratch)
+{
+	uint8_t* body = sldns_buffer_at(buf, CACHEDB_HDR_SIZE);
+	uint8_t* out = NULL;
+	size_t outlen = 0;
+	(void)scratch;
+#ifdef HAVE_LZ4
+	if(cachedb_env->compress == CACHEDB_COMPRESS_LZ4) {
+		int bound = LZ4_compressBound((int)bodylen), r;
+		if(bound <= 0 || !(out = regional_alloc(scratch,
+			(size_t)bound)))
+			return 0;
+		r = LZ4_compress_default((char*)body, (char*)out,
+			(int)bodylen, bound);
+		if(r <= 0)
+			return 0;
+		outlen = (size_t)r;
 	}
-	if(parse_extract_edns(prs, &edns, qstate->env->scratch) !=
-		LDNS_RCODE_NOERROR) {
-		sldns_buffer_set_limit(buf, lim);
-		return 0;
+#endif
+#ifdef HAVE_ZSTD
+	if(cachedb_env->compress == CACHEDB_COMPRESS_ZSTD) {
+		size_t bound = ZSTD_compressBound(bodylen), r;
+		if(!(out = regional_alloc(scratch, bound)))
+			return 0;
+		r = ZSTD_compress(out, bound, body, bodylen, 1);
+		if(ZSTD_isError(r))
+			return 0;
+		outlen = r;
 	}
+#endif
+	if(!out || outlen >= bodylen)
+		return 0;
+	memmove(body, out, outlen);
+	sldns_buffer_set_position(buf, CACHEDB_HDR_SIZE+outlen);
+	sldns_buffer_write_u8_at(buf, 1, (uint8_t)cachedb_env->compress);
+	return 1;
+}
 
-	qstate->return_msg = dns_alloc_msg(buf, prs, qstate->region);
-	sldns_buffer_set_limit(buf, lim);
-	if(!qstate->return_msg)
+int
+cachedb_msg_encode(struct cachedb_env* cachedb_env, sldns_buffer* buf,
+	struct query_info* qinfo, struct reply_info* rep, time_t now,
+	struct regional* scratch)
+{
+	size_t bodylen;
+	uint64_t expiry = (uint64_t)now + (uint64_t)(rep->ttl<0?0:rep->ttl);
+	sldns_buffer_clear(buf);
+	if(!sldns_buffer_available(buf, CACHEDB_HDR_SIZE))
 		return 0;
-	
-	qstate->return_rcode = LDNS_RCODE_NOERROR;
+	sldns_buffer_write_u8(buf, CACHEDB_FORMAT_VERSION);
+	sldns_buffer_write_u8(buf, CACHEDB_COMPRESS_NONE);
+	sldns_buffer_write_u32(buf, (uint32_t)(expiry>>32));
+	sldns_buffer_write_u32(buf, (uint32_t)expiry);
+	sldns_buffer_write_u32(buf, 0);
+	if(!encode_body(buf, qinfo, rep))
+		return 0;
+	bodylen = sldns_buffer_position(buf) - CACHEDB_HDR_SIZE;
+	sldns_buffer_write_u32_at(buf, 10, (uint32_t)bodylen);
+	if(cachedb_env->compress != CACHEDB_COMPRESS_NONE &&
+		bodylen >= cachedb_env->compress_min)
+		(void)compress_body(cachedb_env, buf, bodylen, scratch);
+	sldns_buffer_flip(buf);
+	return 1;
+}
 
-	/* see how much of the TTL expired, and remove it */
-	adjust = *qstate->env->now - (time_t)timestamp;
-	verbose(VERB_ALGO, "cachedb msg adjusted down by %d", (int)adjust);
-	/*adjust_msg(qstate->return_msg, adjust);*/
-	/* TODO:
-		msg->rep->ttl = r->ttl - adjust;
-		msg->rep->prefetch_ttl = PREFETCH_TTL_CALC(msg->rep->ttl);
-		for(i=0; i<d->count + d->rrsig_count; i++) {
-			if(d->rr_ttl[i] < adjust)
+/** decode an rrset from the value body, returns NULL if malformed */
+static struct packed_rrset_data*
+decode_rrset(sldns_buffer* buf, struct regional* region,
+	struct query_info* qinfo, struct ub_packed_rrset_key* k,
+	struct ub_packed_rrset_key* prev, time_t ttl)
+{
+	struct packed_rrset_data* d;
+	size_t i, total, pos, len, need, datalen = 0;
+	uint64_t count, sigcount;
+	uint8_t fl, ts;
+	time_t off;
+	if(sldns_buffer_remaining(buf) < 1)
+		return NULL;
+	fl = sldns_buffer_read_u8(buf);
+	if((fl&CACHEDB_RR_OWNER_QNAME)) {
+		k->rk.dname = qinfo->qname;
+		k->rk.dname_len = qinfo->qname_len;
+	} else if((fl&CACHEDB_RR_OWNER_PREV)) {
+		if(!prev)
+			return NULL;
+		k->rk.dname = prev->rk.dname;
+		k->rk.dname_len = prev->rk.dname_len;
+	} else if(!(k->rk.dname = read_dname(buf, region, &k->rk.dname_len)))
+		return NULL;
+	/* the type, the class and flags if present, the trust and security */
+	need = 2 + 1;
+	if((fl&CACHEDB_RR_CLASS))
+		need += 2;
+	if((fl&CACHEDB_RR_FLAGS))
+		need += 4;
+	if(sldns_buffer_remaining(buf) < need)
+		return NULL;
+	k->rk.type = htons(sldns_buffer_read_u16(buf));
+	if((fl&CACHEDB_RR_CLASS))
+		k->rk.rrset_class = htons(sldns_buffer_read_u16(buf));
+	else	k->rk.rrset_class = htons(qinfo->qclass);
+	if((fl&CACHEDB_RR_FLAGS))
+		k->rk.flags = sldns_buffer_read_u32(buf);
+	ts = sldns_buffer_read_u8(buf);
+	if((ts>>4) > rrset_trust_ultimate || (ts&0x0f) > sec_status_secure)
+		return NULL;
+	if(!read_ttl_offset(buf, &off) || !read_varint(buf, &count) ||
+		!read_varint(buf, &sigcount) || count >= RR_COUNT_MAX ||
+		sigcount >= RR_COUNT_MAX)
+		return NULL;
+	total = (size_t)count + (size_t)sigcount;
+	if(total == 0 || total >= RR_COUNT_MAX)
+		return NULL;
+	ttl += off;
+	if(ttl < 0)
+		ttl = 0;
+	/* scan the rdata lengths, to allocate the packed rrset */
+	pos = sldns_buffer_position(buf);
+	if((fl&CACHEDB_RR_TTLS)) {
+		for(i=0; i<total; i++)
+			if(!read_ttl_offset(buf, &off))
+				return NULL;
+	}
+	for(i=0; i<total; i++) {
+		if(sldns_buffer_remaining(buf) < 2)
+			return NULL;
+		len = (size_t)sldns_buffer_read_u16(buf);
+		if(sldns_buffer_remaining(buf) < len)
+			return NULL;
+		sldns_buffer_skip(buf, (ssize_t)len);
+		datalen += len + 2;
+	}
+	d = (struct packed_rrset_data*)regional_alloc_zero(region,
+		sizeof(*d) + total*(sizeof(size_t)+sizeof(uint8_t*)+
+		sizeof(time_t)) + datalen);
+	if(!d)
+		return NULL;
+	d->ttl = ttl;
+	d->count = (size_t)count;
+	d->rrsig_count = (size_t)sigcount;
+	/* the backend is not trusted to say that the data is validated,
+	 * the validator checks it again, like an answer from the network */
+	d->trust = (enum rrset_trust)(ts>>4);
+	if(d->trust > rrset_trust_ans_AA)
+		d->trust = rrset_trust_ans_AA;
+	d->security = sec_status_unchecked;
+	/* the lengths are needed for the pointer fixup */
+	sldns_buffer_set_position(buf, pos);
+	if((fl&CACHEDB_RR_TTLS)) {
+		for(i=0; i<total; i++)
+			(void)read_ttl_offset(buf, &off);
+	}
+	d->rr_len = (size_t*)((uint8_t*)d + sizeof(*d));
+	for(i=0; i<total; i++) {
+		d->rr_len[i] = (size_t)sldns_buffer_read_u16(buf) + 2;
+		sldns_buffer_skip(buf, (ssize_t)d->rr_len[i]-2);
+	}
+	packed_rrset_ptr_fixup(d);
+	sldns_buffer_set_position(buf, pos);
+	for(i=0; i<total; i++) {
+		d->rr_ttl[i] = ttl;
+		if((fl&CACHEDB_RR_TTLS)) {
+			(void)read_ttl_offset(buf, &off);
+			d->rr_ttl[i] = ttl + off;
+			if(d->rr_ttl[i] < 0)
 				d->rr_ttl[i] = 0;
-			else    d->rr_ttl[i] -= adjust;
 		}
-		if(d->ttl < adjust)
-			d->ttl = 0;
-		else    d->ttl -= adjust;
-		*/
-	/* TODO */
+	}
+	for(i=0; i<total; i++)
+		sldns_buffer_read(buf, d->rr_data[i], d->rr_len[i]);
+	return d;
+}
 
-	return 0;
+/** decode the value body, returns NULL if malformed */
+static struct dns_msg*
+decode_body(sldns_buffer* buf, time_t ttl, struct regional* region)
+{
+	struct dns_msg* msg;
+	uint64_t an, ns, ar;
+	uint16_t flags;
+	uint8_t sec;
+	size_t i;
+	msg = (struct dns_msg*)regional_alloc_zero(region, sizeof(*msg));
+	if(!msg || !(msg->qinfo.qname = read_dname(buf, region,
+		&msg->qinfo.qname_len)) || sldns_buffer_remaining(buf) < 7)
+		return NULL;
+	msg->qinfo.qtype = sldns_buffer_read_u16(buf);
+	msg->qinfo.qclass = sldns_buffer_read_u16(buf);
+	flags = sldns_buffer_read_u16(buf);
+	sec = sldns_buffer_read_u8(buf);
+	if(sec > sec_status_secure || !read_varint(buf, &an) ||
+		!read_varint(buf, &ns) || !read_varint(buf, &ar))
+		return NULL;
+	/* every rrset takes more than one byte */
+	if(an + ns + ar > (uint64_t)sldns_buffer_remaining(buf))
+		return NULL;
+	if(!(msg->rep = construct_reply_info_base(region, flags, 1, ttl,
+		PREFETCH_TTL_CALC(ttl), (size_t)an, (size_t)ns, (size_t)ar,
+		(size_t)(an+ns+ar), sec_status_unchecked)) ||
+		!reply_info_alloc_rrset_keys(msg->rep, NULL, region))
+		return NULL;
+	for(i=0; i<msg->rep->rrset_count; i++) {
+		struct ub_packed_rrset_key* k = msg->rep->rrsets[i];
+		if(!(k->entry.data = decode_rrset(buf, region, &msg->qinfo,
+			k, (i>0?msg->rep->rrsets[i-1]:NULL), ttl)))
+			return NULL;
+		k->entry.hash = rrset_key_hash(&k->rk);
+	}
+	if(sldns_buffer_remaining(buf) != 0)
+		return NULL;
+	return msg;
+}
+
+/** decompress the body into the scratch region, false on failure */
+static int
+decompress_body(sldns_buffer* buf, uint8_t comp, size_t bodylen,
+	sldns_buffer* out, struct regional* scratch)
+{
+	uint8_t* data = regional_alloc(scratch, bodylen);
+	if(!data)
+		return 0;
+	switch(comp) {
+#ifdef HAVE_LZ4
+	case CACHEDB_COMPRESS_LZ4: {
+		int r = LZ4_decompress_safe((char*)sldns_buffer_current(buf),
+			(char*)data, (int)sldns_buffer_remaining(buf),
+			(int)bodylen);
+		if(r < 0 || (size_t)r != bodylen)
+			return 0;
+		break;
+	}
+#endif
+#ifdef HAVE_ZSTD
+	case CACHEDB_COMPRESS_ZSTD: {
+		size_t r = ZSTD_decompress(data, bodylen,
+			sldns_buffer_current(buf), sldns_buffer_remaining(buf));
+		if(ZSTD_isError(r) || r != bodylen)
+			return 0;
+		break;
+	}
+#endif
+	default:
+		(void)buf;
+		verbose(VERB_ALGO, "cachedb: value compression %d is not "
+			"compiled in", (int)comp);
+		return 0;
+	}
+	sldns_buffer_init_frm_data(out, data, bodylen);
+	return 1;
+}
+
+struct dns_msg*
+cachedb_msg_decode(sldns_buffer* buf, time_t now, struct regional* region,
+	struct regional* scratch)
+{
+	sldns_buffer body;
+	uint64_t expiry;
+	size_t bodylen;
+	uint8_t comp;
+	if(sldns_buffer_remaining(buf) < CACHEDB_HDR_SIZE ||
+		sldns_buffer_read_u8(buf) != CACHEDB_FORMAT_VERSION)
+		return NULL;
+	comp = sldns_buffer_read_u8(buf);
+	expiry = ((uint64_t)sldns_buffer_read_u32(buf))<<32;
+	expiry |= (uint64_t)sldns_buffer_read_u32(buf);
+	bodylen = (size_t)sldns_buffer_read_u32(buf);
+	if(expiry <= (uint64_t)now || bodylen > CACHEDB_BODY_MAX)
+		return NULL;
+	if(comp == CACHEDB_COMPRESS_NONE) {
+		if(sldns_buffer_remaining(buf) != bodylen)
+			return NULL;
+		return decode_body(buf, (time_t)(expiry - (uint64_t)now),
+			region);
+	}
+	if(!decompress_body(buf, comp, bodylen, &body, scratch))
+		return NULL;
+	return decode_body(&body, (time_t)(expiry - (uint64_t)now), region);
 }
 
 /**
@@ -447,24 +789,30 @@ parse_data(struct module_qstate* qstate, struct sldns_buffer* buf)
 static int
 cachedb_extcache_lookup(struct module_qstate* qstate, struct cachedb_env* ie)
 {
-	char key[(CACHEDB_HASHSIZE/8)*2+1];
-	calc_hash(qstate, key, sizeof(key));
+	uint8_t key[CACHEDB_KEY_SIZE];
+	struct dns_msg* msg;
+	cachedb_calc_key(ie, &qstate->qinfo, key);
 
 	/* call backend to fetch data for key into scratch buffer */
-	if( !(*ie->backend->lookup)(qstate->env, ie, key,
+	if( !(*ie->backend->lookup)(qstate->env, ie, key, sizeof(key),
 		qstate->env->scratch_buffer)) {
 		return 0;
 	}
 
-	/* check expiry date and check if query-data matches */
-	if( !good_expiry_and_qinfo(qstate, qstate->env->scratch_buffer) ) {
+	/* decode the value, this checks the expiry date */
+	msg = cachedb_msg_decode(qstate->env->scratch_buffer,
+		*qstate->env->now, qstate->region, qstate->env->scratch);
+	if(!msg)
 		return 0;
-	}
 
-	/* parse dns message into return_msg */
-	if( !parse_data(qstate, qstate->env->scratch_buffer) ) {
+	/* check if query-data matches, the key hash may collide */
+	if(msg->qinfo.qtype != qstate->qinfo.qtype ||
+		msg->qinfo.qclass != qstate->qinfo.qclass ||
+		query_dname_compare(msg->qinfo.qname, qstate->qinfo.qname)
+		!= 0)
 		return 0;
-	}
+	qstate->return_rcode = LDNS_RCODE_NOERROR;
+	qstate->return_msg = msg;
 	return 1;
 }
 
@@ -474,15 +822,22 @@ cachedb_extcache_lookup(struct module_qstate* qstate, struct cachedb_env* ie)
 static void
 cachedb_extcache_store(struct module_qstate* qstate, struct cachedb_env* ie)
 {
-	char key[(CACHEDB_HASHSIZE/8)*2+1];
-	calc_hash(qstate, key, sizeof(key));
+	uint8_t key[CACHEDB_KEY_SIZE];
+	if(!qstate->return_msg || !qstate->return_msg->rep)
+		return;
+	if(verbosity >= VERB_ALGO)
+		log_dns_msg("cachedb encoding", &qstate->return_msg->qinfo,
+	                qstate->return_msg->rep);
+	cachedb_calc_key(ie, &qstate->qinfo, key);
 
 	/* prepare data in scratch buffer */
-	if(!prep_data(qstate, qstate->env->scratch_buffer))
+	if(!cachedb_msg_encode(ie, qstate->env->scratch_buffer,
+		&qstate->return_msg->qinfo, qstate->return_msg->rep,
+		*qstate->env->now, qstate->env->scratch))
 		return;
 	
 	/* call backend */
-	(*ie->backend->store)(qstate->env, ie, key,
+	(*ie->backend->store)(qstate->env, ie, key, sizeof(key),
 		sldns_buffer_begin(qstate->env->scratch_buffer),
 		sldns_buffer_limit(qstate->env->scratch_buffer));
 }
@@ -41,6 +41,22 @@
  */
 #include "util/module.h"
 struct cachedb_backend;
+struct dns_msg;
+
+/** version of the key and value format in the external cache */
+#define CACHEDB_FORMAT_VERSION 1
+/** size of a lookup key, the version and a 64 bit keyed hash */
+#define CACHEDB_KEY_SIZE 9
+/** size of the key for the keyed hash, derived from the secret */
+#define CACHEDB_SECRET_SIZE 16
+/** size of the value header, version, compression, expiry, body length */
+#define CACHEDB_HDR_SIZE 14
+/** the value body is stored uncompressed */
+#define CACHEDB_COMPRESS_NONE 0
+/** the value body is compressed with lz4 */
+#define CACHEDB_COMPRESS_LZ4 1
+/** the value body is compressed with zstd */
+#define CACHEDB_COMPRESS_ZSTD 2
 
 /**
  * The global variable environment contents for the cachedb
@@ -56,6 +72,13 @@ struct cachedb_env {
 
 	/** backend specific data here */
 	void* backend_data;
+
+	/** key for the keyed hash of the lookup keys, from the secret */
+	uint8_t secret[CACHEDB_SECRET_SIZE];
+	/** compression of the stored values, CACHEDB_COMPRESS_* */
+	int compress;
+	/** values with a body smaller than this are not compressed */
+	size_t compress_min;
 };
 
 /**
@@ -78,13 +101,14 @@ struct cachedb_backend {
 	/** Deinit - close db for program exit */
 	void (*deinit)(struct module_env*, struct cachedb_env*);
 
-	/** Lookup (env, cachedb_env, key, result_buffer): true if found */
-	int (*lookup)(struct module_env*, struct cachedb_env*, char*,
-		struct sldns_buffer*);
+	/** Lookup (env, cachedb_env, key, key_len, result_buffer): true if
+	 * found.  The key is binary, a backend that needs text encodes it. */
+	int (*lookup)(struct module_env*, struct cachedb_env*, uint8_t*,
+		size_t, struct sldns_buffer*);
 	
-	/** Store (env, cachedb_env, key, data, data_len) */
-	void (*store)(struct module_env*, struct cachedb_env*, char*,
-		uint8_t*, size_t);
+	/** Store (env, cachedb_env, key, key_len, data, data_len) */
+	void (*store)(struct module_env*, struct cachedb_env*, uint8_t*,
+		size_t, uint8_t*, size_t);
 };
 
 /** Init the cachedb module */
@@ -102,6 +126,53 @@ void cachedb_clear(struct module_qstate* qstate, int id);
 /** return memory estimate for cachedb module */
 size_t cachedb_get_mem(struct module_env* env, int id);
 
+/**
+ * Set the key of the keyed hash for the lookup keys from the secret.
+ * @param cachedb_env: the cachedb environment.
+ * @param secret: the secret string from the config.
+ */
+void cachedb_set_secret(struct cachedb_env* cachedb_env, const char* secret);
+
+/**
+ * Calculate the lookup key for a query: the format version and a SipHash
+ * of the lowercased query name, type and class.  A collision is harmless,
+ * the value contains the query and it is checked on lookup.
+ * @param cachedb_env: the cachedb environment with the secret.
+ * @param qinfo: the query.
+ * @param key: CACHEDB_KEY_SIZE bytes for the result.
+ */
+void cachedb_calc_key(struct cachedb_env* cachedb_env,
+	struct query_info* qinfo, uint8_t* key);
+
+/**
+ * Encode a message in the compact value format.  The header has the
+ * absolute expiry time, the TTLs in the body are offsets from it, so
+ * that the value can be used on another server at a later time.  The
+ * body is compressed if that is configured and the body is large enough.
+ * @param cachedb_env: the cachedb environment with the compression.
+ * @param buf: the value is written here, cleared and flipped.
+ * @param qinfo: the query.
+ * @param rep: the reply with relative TTLs.
+ * @param now: the current time.
+ * @param scratch: scratch region for compression.
+ * @return false if it does not fit, or on alloc failure.
+ */
+int cachedb_msg_encode(struct cachedb_env* cachedb_env,
+	struct sldns_buffer* buf, struct query_info* qinfo,
+	struct reply_info* rep, time_t now, struct regional* scratch);
+
+/**
+ * Decode a message from the compact value format.
+ * @param buf: the value, from position to limit.
+ * @param now: the current time, the TTLs are made relative to it.
+ * @param region: where the message is allocated.
+ * @param scratch: scratch region for decompression.
+ * @return the message, or NULL if it is malformed, expired, or
+ *	compressed with a method that is not compiled in.
+ */
+struct dns_msg* cachedb_msg_decode(struct sldns_buffer* buf, time_t now,
+	struct regional* region, struct regional* scratch);
+
 /**
  * Get the function block with pointers to the cachedb functions
  * @return the function block for "cachedb".
@@ -260,12 +260,24 @@
 /* Define if we have LibreSSL */
 /* #undef HAVE_LIBRESSL */
 
+/* Define to 1 if you have the <linux/bpf.h> header file. */
+#define HAVE_LINUX_BPF_H 1
+
+/* Define to 1 if you have the <linux/if_xdp.h> header file. */
+#define HAVE_LINUX_IF_XDP_H 1
+
+/* Define to 1 if you have the <linux/perf_event.h> header file. */
+#define HAVE_LINUX_PERF_EVENT_H 1
+
 /* Define to 1 if you have the `localtime_r' function. */
 /* #undef HAVE_LOCALTIME_R */
 
 /* Define to 1 if you have the <login_cap.h> header file. */
 /* #undef HAVE_LOGIN_CAP_H */
 
+/* Define to 1 to compress cachedb values with lz4 */
+/* #undef HAVE_LZ4 */
+
 /* If have GNU libc compatible malloc */
 #define HAVE_MALLOC 1
 
@@ -539,6 +551,9 @@
 /* Define to 1 if you have the <ws2tcpip.h> header file. */
 /* #undef HAVE_WS2TCPIP_H */
 
+/* Define to 1 to compress cachedb values with zstd */
+/* #undef HAVE_ZSTD */
+
 /* Define to 1 if you have the `_beginthreadex' function. */
 /* #undef HAVE__BEGINTHREADEX */
 
@@ -942,6 +957,11 @@
 #define AF_LOCAL AF_UNIX
 #endif
 
+#if defined(HAVE_LINUX_IF_XDP_H) && defined(HAVE_LINUX_BPF_H)
+/** AF_XDP sockets can be used for the UDP fast path */
+#  define USE_XDP 1
+#endif
+
 
  
 #ifdef HAVE_ATTR_FORMAT
@@ -1193,5 +1213,7 @@ void *unbound_stat_realloc_log(void *ptr, size_t size, const char* file,
 #define UNBOUND_CONTROL_PORT 8953
 /** the version of unbound-control that this software implements */
 #define UNBOUND_CONTROL_VERSION 1
+/** default port for the cache inserts of the cache peers */
+#define UNBOUND_CACHE_PEER_PORT 8954
 
 
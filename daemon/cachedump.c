@@ -96,14 +96,35 @@ dump_rrset(SSL* ssl, struct ub_packed_rrset_key* k,
 	return 1;
 }
 
+/** number of entry lists in the lruhash, the pinned entries, the lru
+ * list and the lru lists of the quotas */
+static size_t
+lruhash_num_lists(struct lruhash* h)
+{
+	return 2 + (h->quota_num?h->quota_num-1:0);
+}
+
+/** start of an entry list in the lruhash, numbered from 0 */
+static struct lruhash_entry*
+lruhash_list_start(struct lruhash* h, size_t i)
+{
+	if(i == 0)
+		return h->pin_start;
+	if(i == 1)
+		return h->lru_start;
+	return h->quota[i-1].lru_start;
+}
+
 /** dump lruhash rrset cache */
 static int
 dump_rrset_lruhash(SSL* ssl, struct lruhash* h, time_t now)
 {
 	struct lruhash_entry* e;
+	size_t i;
 	/* lruhash already locked by caller */
-	/* walk in order of lru; best first */
-	for(e=h->lru_start; e; e = e->lru_next) {
+	/* walk in order of lru; best first, after the pinned entries */
+	for(i=0; i<lruhash_num_lists(h); i++)
+	for(e=lruhash_list_start(h, i); e; e = e->lru_next) {
 		lock_rw_rdlock(&e->lock);
 		if(!dump_rrset(ssl, (struct ub_packed_rrset_key*)e->key,
 			(struct packed_rrset_data*)e->data, now)) {
@@ -250,10 +271,12 @@ dump_msg_lruhash(SSL* ssl, struct worker* worker, struct lruhash* h)
 	struct lruhash_entry* e;
 	struct query_info* k;
 	struct reply_info* d;
+	size_t i;
 
 	/* lruhash already locked by caller */
-	/* walk in order of lru; best first */
-	for(e=h->lru_start; e; e = e->lru_next) {
+	/* walk in order of lru; best first, after the pinned entries */
+	for(i=0; i<lruhash_num_lists(h); i++)
+	for(e=lruhash_list_start(h, i); e; e = e->lru_next) {
 		regional_free_all(worker->scratchpad);
 		lock_rw_rdlock(&e->lock);
 		/* make copy of rrset in worker buffer */
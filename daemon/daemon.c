@@ -74,11 +74,14 @@
 #include "util/config_file.h"
 #include "util/data/msgreply.h"
 #include "util/shm_side/shm_main.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/siphash.h"
 #include "util/storage/slabhash.h"
 #include "services/listen_dnsport.h"
 #include "services/cache/rrset.h"
 #include "services/cache/infra.h"
+#include "services/cache/pin.h"
+#include "services/cache/peer.h"
+#include "util/xdp.h"
 #include "services/localzone.h"
 #include "services/view.h"
 #include "services/modstack.h"
@@ -87,7 +90,10 @@
 #include "util/tube.h"
 #include "util/net_help.h"
 #include "sldns/keyraw.h"
+#include "sldns/parseutil.h"
 #include "respip/respip.h"
+#include "validator/val_anchor.h"
+#include "validator/autotrust.h"
 #include <signal.h>
 
 #ifdef HAVE_SYSTEMD
@@ -351,6 +357,27 @@ daemon_open_shared_ports(struct daemon* daemon)
 			return 0;
 		daemon->rc_port = daemon->cfg->control_port;
 	}
+	if(!daemon->cfg->cache_peer_ifs && daemon->peer_port) {
+		listening_ports_free(daemon->peer_ports);
+		daemon->peer_ports = NULL;
+		daemon->peer_port = 0;
+	}
+	if(daemon->cfg->cache_peer_ifs &&
+		daemon->cfg->cache_peer_port != daemon->peer_port) {
+		listening_ports_free(daemon->peer_ports);
+		if(!(daemon->peer_ports=cache_peers_open_ports(daemon->cfg)))
+			return 0;
+		daemon->peer_port = daemon->cfg->cache_peer_port;
+	}
+	/* the XDP programs are attached once, they need privileges */
+	if(!daemon->cfg->xdp_ifs && daemon->xdp) {
+		xdp_sock_delete_all(daemon->xdp);
+		daemon->xdp = NULL;
+	}
+	if(daemon->cfg->xdp_ifs && !daemon->xdp) {
+		if(!(daemon->xdp=xdp_sock_open_all(daemon->cfg)))
+			return 0;
+	}
 	return 1;
 }
 
@@ -402,6 +429,36 @@ static int daemon_get_shufport(struct daemon* daemon, int* shufport)
 	return avail;
 }
 
+/**
+ * Set the secret for the DNS cookies, from the config, or random.
+ * A random secret is kept over reloads, so that the cookies of the
+ * clients stay valid.
+ * @param daemon: the daemon with (new) config settings.
+ */
+static void
+daemon_cookie_secret(struct daemon* daemon)
+{
+	const char* hex = daemon->cfg->cookie_secret;
+	size_t i;
+	if(hex && strlen(hex) == EDNS_COOKIE_SECRET_SIZE*2 &&
+		strspn(hex, "0123456789abcdefABCDEF") == strlen(hex)) {
+		for(i=0; i<EDNS_COOKIE_SECRET_SIZE; i++)
+			daemon->cookie_secret[i] = (uint8_t)(
+				sldns_hexdigit_to_int(hex[i*2])*16 +
+				sldns_hexdigit_to_int(hex[i*2+1]));
+		daemon->cookie_secret_random = 0;
+		return;
+	}
+	if(hex)
+		log_err("cookie-secret: expected %d hex digits, using a "
+			"random secret", EDNS_COOKIE_SECRET_SIZE*2);
+	if(daemon->cookie_secret_random)
+		return;
+	for(i=0; i<EDNS_COOKIE_SECRET_SIZE; i++)
+		daemon->cookie_secret[i] = (uint8_t)ub_random(daemon->rand);
+	daemon->cookie_secret_random = 1;
+}
+
 /**
  * Allocate empty worker structures. With backptr and thread-number,
  * from 0..numthread initialised. Used as user arguments to new threads.
@@ -414,6 +471,7 @@ daemon_create_workers(struct daemon* daemon)
 {
 	int i, numport;
 	int* shufport;
+	uint8_t hashseed[SIPHASH_SEEDSIZE];
 	log_assert(daemon && daemon->cfg);
 	if(!daemon->rand) {
 		unsigned int seed = (unsigned int)time(NULL) ^ 
@@ -422,7 +480,10 @@ daemon_create_workers(struct daemon* daemon)
 		if(!daemon->rand)
 			fatal_exit("could not init random generator");
 	}
-	hash_set_raninit((uint32_t)ub_random(daemon->rand));
+	for(i=0; i<SIPHASH_SEEDSIZE; i++)
+		hashseed[i] = (uint8_t)ub_random(daemon->rand);
+	siphash_set_seed(hashseed);
+	daemon_cookie_secret(daemon);
 	shufport = (int*)calloc(65536, sizeof(int));
 	if(!shufport)
 		fatal_exit("out of memory during daemon init");
@@ -591,6 +652,18 @@ daemon_fork(struct daemon* daemon)
 	if(!local_zones_apply_cfg(daemon->local_zones, daemon->cfg))
 		fatal_exit("Could not set up local zones");
 
+	/* names that are pinned in the cache */
+	if(!(daemon->cache_pins = cache_pins_create()))
+		fatal_exit("Could not create cache pins: out of memory");
+	if(!cache_pins_apply_cfg(daemon->cache_pins, daemon->cfg))
+		fatal_exit("Could not set up cache pins");
+	cache_pins_setup(daemon->cache_pins, daemon->env->msg_cache,
+		&daemon->env->rrset_cache->table);
+	/* cache memory quotas of the views */
+	if(!views_cache_setup(daemon->views, daemon->env->msg_cache,
+		&daemon->env->rrset_cache->table))
+		fatal_exit("Could not set up view cache quotas: out of memory");
+
 	/* process raw response-ip configuration data */
 	if(!(daemon->respip_set = respip_set_create()))
 		fatal_exit("Could not create response IP set");
@@ -604,6 +677,11 @@ daemon_fork(struct daemon* daemon)
 
 	/* setup modules */
 	daemon_setup_modules(daemon);
+	/* the autotrust state files are written by a background thread */
+	if(daemon->autr_async_write && daemon->env->anchors &&
+		autr_get_num_anchors(daemon->env->anchors) > 0)
+		(void)autr_writer_start(daemon->env->anchors,
+			daemon->cfg->num_threads?daemon->cfg->num_threads:1);
 
 	/* response-ip-xxx options don't work as expected without the respip
 	 * module.  To avoid run-time operational surprise we reject such
@@ -675,6 +753,12 @@ daemon_cleanup(struct daemon* daemon)
 	 * b) validation config can change, thus rrset, msg, keycache clear */
 	slabhash_clear(&daemon->env->rrset_cache->table);
 	slabhash_clear(daemon->env->msg_cache);
+	cache_pins_setup(NULL, daemon->env->msg_cache,
+		&daemon->env->rrset_cache->table);
+	(void)views_cache_setup(NULL, daemon->env->msg_cache,
+		&daemon->env->rrset_cache->table);
+	cache_pins_delete(daemon->cache_pins);
+	daemon->cache_pins = NULL;
 	local_zones_delete(daemon->local_zones);
 	daemon->local_zones = NULL;
 	respip_set_delete(daemon->respip_set);
@@ -706,6 +790,8 @@ daemon_delete(struct daemon* daemon)
 		listening_ports_free(daemon->ports[i]);
 	free(daemon->ports);
 	listening_ports_free(daemon->rc_ports);
+	listening_ports_free(daemon->peer_ports);
+	xdp_sock_delete_all(daemon->xdp);
 	if(daemon->env) {
 		slabhash_delete(daemon->env->msg_cache);
 		rrset_cache_delete(daemon->env->rrset_cache);
@@ -45,18 +45,21 @@
 #include "util/locks.h"
 #include "util/alloc.h"
 #include "services/modstack.h"
+#include "util/edns.h"
 struct config_file;
 struct worker;
 struct listen_port;
 struct slabhash;
 struct module_env;
 struct rrset_cache;
+struct xdp_sock;
 struct acl_list;
 struct local_zones;
 struct views;
 struct ub_randstate;
 struct daemon_remote;
 struct respip_set;
+struct cache_pins;
 struct shm_main_info;
 
 #include "dnstap/dnstap_config.h"
@@ -93,6 +96,12 @@ struct daemon {
 	int rc_port;
 	/** listening ports for remote control */
 	struct listen_port* rc_ports;
+	/** port number for the cache peers that has ports opened. */
+	int peer_port;
+	/** listening ports for the cache inserts of the cache peers */
+	struct listen_port* peer_ports;
+	/** AF_XDP sockets for the UDP fast path, divided over the threads */
+	struct xdp_sock* xdp;
 	/** remote control connections management (for first worker) */
 	struct daemon_remote* rc;
 	/** ssl context for listening to dnstcp over ssl, and connecting ssl */
@@ -128,8 +137,17 @@ struct daemon {
 	struct shm_main_info* shm_info;
 	/** response-ip set with associated actions and tags. */
 	struct respip_set* respip_set;
+	/** the names that are pinned in the cache */
+	struct cache_pins* cache_pins;
 	/** some response-ip tags or actions are configured if true */
 	int use_response_ip;
+	/** autotrust files are written by a background thread if true,
+	 * testbound writes them from the worker to check the contents */
+	int autr_async_write;
+	/** the secret for the DNS cookies, of the server and upstream */
+	uint8_t cookie_secret[EDNS_COOKIE_SECRET_SIZE];
+	/** the cookie secret is random, it stays the same over reloads */
+	int cookie_secret_random;
 #ifdef USE_DNSCRYPT
 	/** the dnscrypt environment */
 	struct dnsc_env* dnscenv;
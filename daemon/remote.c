@@ -65,9 +65,12 @@
 #include "util/module.h"
 #include "services/listen_dnsport.h"
 #include "services/cache/rrset.h"
+#include "services/cache/intern.h"
 #include "services/cache/infra.h"
+#include "services/cache/pin.h"
 #include "services/mesh.h"
 #include "services/localzone.h"
+#include "services/view.h"
 #include "util/storage/slabhash.h"
 #include "util/fptr_wlist.h"
 #include "util/data/dname.h"
@@ -447,7 +450,8 @@ add_open(const char* ip, int nr, struct listen_port** list, int noproto_is_err,
 
 		/* open fd */
 		fd = create_tcp_accept_sock(res, 1, &noproto, 0,
-			cfg->ip_transparent, 0, cfg->ip_freebind, cfg->use_systemd);
+			cfg->ip_transparent, 0, 0, cfg->ip_freebind,
+			cfg->use_systemd);
 		freeaddrinfo(res);
 	}
 
@@ -787,6 +791,12 @@ print_stats(SSL* ssl, const char* nm, struct stats_info* s)
 		(unsigned long)s->svr.num_queries)) return 0;
 	if(!ssl_printf(ssl, "%s.num.queries_ip_ratelimited"SQ"%lu\n", nm,
 		(unsigned long)s->svr.num_queries_ip_ratelimited)) return 0;
+	if(!ssl_printf(ssl, "%s.num.queries_cookie_valid"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_queries_cookie_valid)) return 0;
+	if(!ssl_printf(ssl, "%s.num.queries_cookie_client"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_queries_cookie_client)) return 0;
+	if(!ssl_printf(ssl, "%s.num.queries_cookie_invalid"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_queries_cookie_invalid)) return 0;
 	if(!ssl_printf(ssl, "%s.num.cachehits"SQ"%lu\n", nm, 
 		(unsigned long)(s->svr.num_queries 
 			- s->svr.num_queries_missed_cache))) return 0;
@@ -820,6 +830,12 @@ print_stats(SSL* ssl, const char* nm, struct stats_info* s)
 		s->mesh_time_median)) return 0;
 	if(!ssl_printf(ssl, "%s.tcpusage"SQ"%lu\n", nm,
 		(unsigned long)s->svr.tcp_accept_usage)) return 0;
+	if(!ssl_printf(ssl, "%s.udp.drops"SQ"%lu\n", nm,
+		(unsigned long)s->svr.udp_drops)) return 0;
+	if(!ssl_printf(ssl, "%s.udp.rxq.max"SQ"%lu\n", nm,
+		(unsigned long)s->svr.udp_rxq_max)) return 0;
+	if(!ssl_printf(ssl, "%s.udp.rxq.util"SQ"%lu\n", nm,
+		(unsigned long)s->svr.udp_rxq_util)) return 0;
 	return 1;
 }
 
@@ -853,9 +869,15 @@ static int
 print_mem(SSL* ssl, struct worker* worker, struct daemon* daemon)
 {
 	int m;
-	size_t msg, rrset, val, iter, respip;
+	size_t msg, rrset, val, iter, respip, msg_pin, rrset_pin;
+	size_t names, names_count, names_refs, names_saved;
 	msg = slabhash_get_mem(daemon->env->msg_cache);
 	rrset = slabhash_get_mem(&daemon->env->rrset_cache->table);
+	names = name_intern_get_mem(daemon->env->rrset_cache->names);
+	name_intern_get_stats(daemon->env->rrset_cache->names, &names_count,
+		&names_refs, &names_saved);
+	msg_pin = slabhash_get_pinned_mem(daemon->env->msg_cache);
+	rrset_pin = slabhash_get_pinned_mem(&daemon->env->rrset_cache->table);
 	val=0;
 	iter=0;
 	respip=0;
@@ -885,6 +907,20 @@ print_mem(SSL* ssl, struct worker* worker, struct daemon* daemon)
 		return 0;
 	if(!print_longnum(ssl, "mem.cache.message"SQ, msg))
 		return 0;
+	if(!print_longnum(ssl, "mem.cache.rrset.pinned"SQ, rrset_pin))
+		return 0;
+	if(!print_longnum(ssl, "mem.cache.message.pinned"SQ, msg_pin))
+		return 0;
+	if(!print_longnum(ssl, "mem.cache.rrset.names"SQ, names))
+		return 0;
+	if(!print_longnum(ssl, "mem.cache.rrset.names.saved"SQ, names_saved))
+		return 0;
+	if(!ssl_printf(ssl, "cache.rrset.names"SQ"%lu\n",
+		(unsigned long)names_count))
+		return 0;
+	if(!ssl_printf(ssl, "cache.rrset.names.refs"SQ"%lu\n",
+		(unsigned long)names_refs))
+		return 0;
 	if(!print_longnum(ssl, "mem.mod.iterator"SQ, iter))
 		return 0;
 	if(!print_longnum(ssl, "mem.mod.validator"SQ, val))
@@ -1011,6 +1047,16 @@ print_ext(SSL* ssl, struct stats_info* s)
 		(unsigned long)s->svr.qtcp)) return 0;
 	if(!ssl_printf(ssl, "num.query.tcpout"SQ"%lu\n", 
 		(unsigned long)s->svr.qtcp_outgoing)) return 0;
+	if(!ssl_printf(ssl, "num.tcp.fastopen"SQ"%lu\n", 
+		(unsigned long)s->svr.tcp_fastopen)) return 0;
+	if(!ssl_printf(ssl, "num.tcpout.fastopen"SQ"%lu\n", 
+		(unsigned long)s->svr.tcp_fastopen_outgoing)) return 0;
+	if(!ssl_printf(ssl, "num.cachepeer.sent"SQ"%lu\n", 
+		(unsigned long)s->svr.cachepeer_sent)) return 0;
+	if(!ssl_printf(ssl, "num.cachepeer.dropped"SQ"%lu\n", 
+		(unsigned long)s->svr.cachepeer_dropped)) return 0;
+	if(!ssl_printf(ssl, "num.cachepeer.received"SQ"%lu\n", 
+		(unsigned long)s->svr.cachepeer_received)) return 0;
 	if(!ssl_printf(ssl, "num.query.ipv6"SQ"%lu\n", 
 		(unsigned long)s->svr.qipv6)) return 0;
 	/* flags */
@@ -1074,6 +1120,96 @@ print_ext(SSL* ssl, struct stats_info* s)
 		(unsigned)s->svr.infra_cache_count)) return 0;
 	if(!ssl_printf(ssl, "key.cache.count"SQ"%u\n",
 		(unsigned)s->svr.key_cache_count)) return 0;
+	if(!ssl_printf(ssl, "neg.cache.contended"SQ"%lu\n",
+		(unsigned long)s->svr.neg_cache_contended)) return 0;
+	return 1;
+}
+
+/** print the statistics of the views */
+static int
+print_views(SSL* ssl, struct daemon* daemon, int reset)
+{
+	struct view* v;
+	size_t q, miss;
+	int r = 1;
+	if(!daemon->views)
+		return 1;
+	lock_rw_rdlock(&daemon->views->lock);
+	RBTREE_FOR(v, struct view*, &daemon->views->vtree) {
+		lock_basic_lock(&v->stats_lock);
+		q = v->num_queries;
+		miss = v->num_queries_missed_cache;
+		if(reset) {
+			v->num_queries = 0;
+			v->num_queries_missed_cache = 0;
+		}
+		lock_basic_unlock(&v->stats_lock);
+		if(miss > q)
+			miss = q;
+		if(!ssl_printf(ssl, "view.%s.num.queries"SQ"%lu\n", v->name,
+			(unsigned long)q) ||
+		   !ssl_printf(ssl, "view.%s.num.cachehits"SQ"%lu\n", v->name,
+			(unsigned long)(q - miss)) ||
+		   !ssl_printf(ssl, "view.%s.num.cachemiss"SQ"%lu\n", v->name,
+			(unsigned long)miss)) {
+			r = 0;
+			break;
+		}
+		if(v->cache_id == 0)
+			continue;
+		if(!ssl_printf(ssl, "view.%s.mem.cache.rrset"SQ"%lu\n",
+			v->name, (unsigned long)slabhash_get_quota_mem(
+			&daemon->env->rrset_cache->table, v->cache_id)) ||
+		   !ssl_printf(ssl, "view.%s.mem.cache.message"SQ"%lu\n",
+			v->name, (unsigned long)slabhash_get_quota_mem(
+			daemon->env->msg_cache, v->cache_id))) {
+			r = 0;
+			break;
+		}
+	}
+	lock_rw_unlock(&daemon->views->lock);
+	return r;
+}
+
+/** print the kernel receive queue of the listening UDP sockets, per
+ * interface, and per thread if the threads have their own sockets */
+static int
+print_interfaces(SSL* ssl, struct daemon* daemon)
+{
+	struct listen_port* p;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	size_t i, rxq, rcvbuf, drops;
+	int port;
+	char nm[32], ip[64];
+	for(i=0; i<daemon->num_ports; i++) {
+		if(daemon->num_ports > 1)
+			snprintf(nm, sizeof(nm), "thread%d.", (int)i);
+		else	nm[0] = 0;
+		for(p = daemon->ports[i]; p; p = p->next) {
+			if(p->ftype != listen_type_udp &&
+				p->ftype != listen_type_udpancil &&
+				p->ftype != listen_type_udp_dnscrypt &&
+				p->ftype != listen_type_udpancil_dnscrypt)
+				continue;
+			addrlen = (socklen_t)sizeof(addr);
+			if(getsockname(p->fd, (struct sockaddr*)&addr,
+				&addrlen) < 0)
+				continue;
+			if(!udp_sock_rxq(p->fd, &rxq, &rcvbuf, &drops))
+				continue;
+			addr_to_str(&addr, addrlen, ip, sizeof(ip));
+			/* sin_port and sin6_port are at the same offset */
+			port = (int)ntohs(((struct sockaddr_in*)&addr)->sin_port);
+			if(!ssl_printf(ssl, "%sinterface.%s@%d.udp.drops"SQ
+				"%lu\n", nm, ip, port, (unsigned long)drops) ||
+			   !ssl_printf(ssl, "%sinterface.%s@%d.udp.rxq"SQ
+				"%lu\n", nm, ip, port, (unsigned long)rxq) ||
+			   !ssl_printf(ssl, "%sinterface.%s@%d.udp.rcvbuf"SQ
+				"%lu\n", nm, ip, port, (unsigned long)rcvbuf))
+				return 0;
+		}
+	}
 	return 1;
 }
 
@@ -1108,6 +1244,10 @@ do_stats(SSL* ssl, struct daemon_remote* rc, int reset)
 			return;
 		if(!print_ext(ssl, &total))
 			return;
+		if(!print_views(ssl, daemon, reset))
+			return;
+		if(!print_interfaces(ssl, daemon))
+			return;
 	}
 }
 
@@ -1206,7 +1346,9 @@ perform_zone_add(SSL* ssl, struct local_zones* zones, char* arg)
 static void
 do_zone_add(SSL* ssl, struct local_zones* zones, char* arg)
 {
-	if(!perform_zone_add(ssl, zones, arg))
+	int r = perform_zone_add(ssl, zones, arg);
+	local_zones_make_index(zones);
+	if(!r)
 		return;
 	send_ok(ssl);
 }
@@ -1227,6 +1369,7 @@ do_zones_add(SSL* ssl, struct local_zones* zones)
 		else
 			num++;
 	}
+	local_zones_make_index(zones);
 	(void)ssl_printf(ssl, "added %d zones\n", num);
 }
 
@@ -1255,7 +1398,9 @@ perform_zone_remove(SSL* ssl, struct local_zones* zones, char* arg)
 static void
 do_zone_remove(SSL* ssl, struct local_zones* zones, char* arg)
 {
-	if(!perform_zone_remove(ssl, zones, arg))
+	int r = perform_zone_remove(ssl, zones, arg);
+	local_zones_make_index(zones);
+	if(!r)
 		return;
 	send_ok(ssl);
 }
@@ -1276,6 +1421,7 @@ do_zones_remove(SSL* ssl, struct local_zones* zones)
 		else
 			num++;
 	}
+	local_zones_make_index(zones);
 	(void)ssl_printf(ssl, "removed %d zones\n", num);
 }
 
@@ -1294,7 +1440,9 @@ perform_data_add(SSL* ssl, struct local_zones* zones, char* arg)
 static void
 do_data_add(SSL* ssl, struct local_zones* zones, char* arg)
 {
-	if(!perform_data_add(ssl, zones, arg))
+	int r = perform_data_add(ssl, zones, arg);
+	local_zones_make_index(zones);
+	if(!r)
 		return;
 	send_ok(ssl);
 }
@@ -1315,6 +1463,7 @@ do_datas_add(SSL* ssl, struct local_zones* zones)
 		else
 			num++;
 	}
+	local_zones_make_index(zones);
 	(void)ssl_printf(ssl, "added %d datas\n", num);
 }
 
@@ -1876,6 +2025,43 @@ ssl_print_name_dp(SSL* ssl, const char* str, uint8_t* nm, uint16_t dclass,
 }
 
 
+/** print the health of the forwarders of the zone, one line per address */
+static int
+ssl_print_fwd_health(SSL* ssl, struct worker* worker,
+	struct iter_forward_zone* z)
+{
+	char buf[257];
+	struct delegpt_addr* a;
+	int srtt, err, ejected, port;
+	for(a = z->dp->target_list; a; a = a->next_target) {
+		addr_to_str(&a->addr, a->addrlen, buf, sizeof(buf));
+		if(addr_is_ip6(&a->addr, a->addrlen))
+			port = (int)ntohs(((struct sockaddr_in6*)&a->addr)->
+				sin6_port);
+		else	port = (int)ntohs(((struct sockaddr_in*)&a->addr)->
+				sin_port);
+		if(port != UNBOUND_DNS_PORT)
+			snprintf(buf+strlen(buf), sizeof(buf)-strlen(buf),
+				"@%d", port);
+		if(!infra_get_health(worker->env.infra_cache, &a->addr,
+			a->addrlen, z->name, z->namelen, *worker->env.now,
+			&srtt, &err, &ejected)) {
+			if(!ssl_printf(ssl, "\t%s unknown\n", buf))
+				return 0;
+			continue;
+		}
+		if(ejected) {
+			if(!ssl_printf(ssl, "\t%s rtt %d msec error %d.%d%% "
+				"ejected %d sec\n", buf, srtt, err/10, err%10,
+				ejected))
+				return 0;
+		} else if(!ssl_printf(ssl, "\t%s rtt %d msec error %d.%d%% "
+			"up\n", buf, srtt, err/10, err%10))
+			return 0;
+	}
+	return 1;
+}
+
 /** print root forwards */
 static int
 print_root_fwds(SSL* ssl, struct iter_forwards* fwds, uint8_t* root)
@@ -2182,6 +2368,81 @@ do_insecure_list(SSL* ssl, struct worker* worker)
 	}
 }
 
+/** do the cache_pin and cache_pin_suffix commands */
+static void
+do_cache_pin(SSL* ssl, struct worker* worker, char* arg, int suffix)
+{
+	size_t nmlen;
+	int nmlabs;
+	uint8_t* nm = NULL;
+	char* arg2 = NULL;
+	uint16_t t = LDNS_RR_TYPE_ANY;
+	if(!suffix && !find_arg2(ssl, arg, &arg2))
+		return;
+	if(!parse_arg_name(ssl, arg, &nm, &nmlen, &nmlabs))
+		return;
+	if(arg2 && strcasecmp(arg2, "ANY") != 0 &&
+		(t = sldns_get_rr_type_by_name(arg2)) == 0) {
+		(void)ssl_printf(ssl, "error unknown type %s\n", arg2);
+		free(nm);
+		return;
+	}
+	if(!cache_pins_add(worker->daemon->cache_pins, nm, nmlen, t,
+		suffix)) {
+		(void)ssl_printf(ssl, "error out of memory\n");
+		free(nm);
+		return;
+	}
+	free(nm);
+	/* pin the entries that are in the cache already */
+	cache_pins_setup(worker->daemon->cache_pins, worker->env.msg_cache,
+		&worker->env.rrset_cache->table);
+	worker_cache_pin_start(worker);
+	send_ok(ssl);
+}
+
+/** do the cache_unpin command */
+static void
+do_cache_unpin(SSL* ssl, struct worker* worker, char* arg)
+{
+	size_t nmlen;
+	int nmlabs;
+	uint8_t* nm = NULL;
+	if(!parse_arg_name(ssl, arg, &nm, &nmlen, &nmlabs))
+		return;
+	if(cache_pins_remove(worker->daemon->cache_pins, nm, nmlen))
+		cache_pins_setup(worker->daemon->cache_pins,
+			worker->env.msg_cache,
+			&worker->env.rrset_cache->table);
+	free(nm);
+	send_ok(ssl);
+}
+
+/** do the list_cache_pins command */
+static void
+do_list_cache_pins(SSL* ssl, struct worker* worker)
+{
+	struct cache_pins* pins = worker->daemon->cache_pins;
+	struct cache_pin* p;
+	char nm[257], tp[32];
+	size_t i;
+	lock_rw_rdlock(&pins->lock);
+	RBTREE_FOR(p, struct cache_pin*, &pins->tree) {
+		dname_str(p->node.name, nm);
+		if(p->suffix && !ssl_printf(ssl, "%s suffix\n", nm))
+			break;
+		if(p->anytype && !ssl_printf(ssl, "%s ANY\n", nm))
+			break;
+		for(i=0; i<p->numtypes; i++) {
+			sldns_wire2str_type_buf(p->types[i], tp, sizeof(tp));
+			if(!ssl_printf(ssl, "%s %s%s\n", nm, tp,
+				p->target?" target":""))
+				break;
+		}
+	}
+	lock_rw_unlock(&pins->lock);
+}
+
 /** do the status command */
 static void
 do_status(SSL* ssl, struct worker* worker)
@@ -2363,13 +2624,14 @@ dump_infra_host(struct lruhash_entry* e, void* arg)
 	if(!ssl_printf(a->ssl, "%s %s ttl %lu ping %d var %d rtt %d rto %d "
 		"tA %d tAAAA %d tother %d "
 		"ednsknown %d edns %d delay %d lame dnssec %d rec %d A %d "
-		"other %d\n", ip_str, name, (unsigned long)(d->ttl - a->now),
+		"other %d udpsize %d\n", ip_str, name,
+		(unsigned long)(d->ttl - a->now),
 		d->rtt.srtt, d->rtt.rttvar, rtt_notimeout(&d->rtt), d->rtt.rto,
 		d->timeout_A, d->timeout_AAAA, d->timeout_other,
 		(int)d->edns_lame_known, (int)d->edns_version,
 		(int)(a->now<d->probedelay?(d->probedelay - a->now):0),
 		(int)d->isdnsseclame, (int)d->rec_lame, (int)d->lame_type_A,
-		(int)d->lame_other)) {
+		(int)d->lame_other, (int)d->udp_size)) {
 		a->ssl_failed = 1;
 		return;
 	}
@@ -2462,6 +2724,9 @@ do_list_forwards(SSL* ssl, struct worker* worker)
 		if(!ssl_print_name_dp(ssl, (insecure?"forward +i":"forward"),
 			z->name, z->dclass, z->dp))
 			return;
+		if(worker->env.cfg->fwd_health_check &&
+			!ssl_print_fwd_health(ssl, worker, z))
+			return;
 	}
 }
 
@@ -2731,6 +2996,9 @@ execute_cmd(struct daemon_remote* rc, SSL* ssl, char* cmd,
 	} else if(cmdcmp(p, "list_insecure", 13)) {
 		do_insecure_list(ssl, worker);
 		return;
+	} else if(cmdcmp(p, "list_cache_pins", 15)) {
+		do_list_cache_pins(ssl, worker);
+		return;
 	} else if(cmdcmp(p, "list_local_zones", 16)) {
 		do_list_local_zones(ssl, worker->daemon->local_zones);
 		return;
@@ -2833,6 +3101,12 @@ execute_cmd(struct daemon_remote* rc, SSL* ssl, char* cmd,
 		do_view_data_remove(ssl, worker, skipwhite(p+22));
 	} else if(cmdcmp(p, "view_local_data", 15)) {
 		do_view_data_add(ssl, worker, skipwhite(p+15));
+	} else if(cmdcmp(p, "cache_pin_suffix", 16)) {
+		do_cache_pin(ssl, worker, skipwhite(p+16), 1);
+	} else if(cmdcmp(p, "cache_pin", 9)) {
+		do_cache_pin(ssl, worker, skipwhite(p+9), 0);
+	} else if(cmdcmp(p, "cache_unpin", 11)) {
+		do_cache_unpin(ssl, worker, skipwhite(p+11));
 	} else if(cmdcmp(p, "flush_zone", 10)) {
 		do_flush_zone(ssl, worker, skipwhite(p+10));
 	} else if(cmdcmp(p, "flush_type", 10)) {
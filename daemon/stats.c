@@ -59,7 +59,9 @@
 #include "sldns/sbuffer.h"
 #include "services/cache/rrset.h"
 #include "services/cache/infra.h"
+#include "services/cache/peer.h"
 #include "validator/val_kcache.h"
+#include "validator/val_neg.h"
 
 /** add timers and the values do not overflow or become negative */
 static void
@@ -142,7 +144,7 @@ get_rrset_bogus(struct worker* worker)
 void
 server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 {
-	int i;
+	int i, count_drops;
 	struct listen_list* lp;
 
 	s->svr = worker->stats;
@@ -166,6 +168,14 @@ server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 	/* values from outside network */
 	s->svr.unwanted_replies = worker->back->unwanted_replies;
 	s->svr.qtcp_outgoing = worker->back->num_tcp_outgoing;
+	s->svr.tcp_fastopen_outgoing = worker->back->num_tcp_fastopen;
+	/* values from the cache peers */
+	if(worker->env.cache_peers) {
+		s->svr.cachepeer_sent = worker->env.cache_peers->num_sent;
+		s->svr.cachepeer_dropped = worker->env.cache_peers->num_dropped;
+		s->svr.cachepeer_received =
+			worker->env.cache_peers->num_received;
+	}
 
 	/* get and reset validator rrset bogus number */
 	s->svr.rrset_bogus = get_rrset_bogus(worker);
@@ -177,12 +187,33 @@ server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 	if(worker->env.key_cache)
 		s->svr.key_cache_count = count_slabhash_entries(worker->env.key_cache->slab);
 	else	s->svr.key_cache_count = 0;
+	if(worker->env.neg_cache)
+		s->svr.neg_cache_contended = val_neg_get_contended(
+			worker->env.neg_cache);
+	else	s->svr.neg_cache_contended = 0;
 
-	/* get tcp accept usage */
+	/* get tcp accept usage, and the udp socket drops and queues */
 	s->svr.tcp_accept_usage = 0;
+	s->svr.tcp_fastopen = 0;
+	s->svr.udp_drops = 0;
+	s->svr.udp_rxq_max = 0;
+	s->svr.udp_rxq_util = 0;
+	/* without so-reuseport the threads share the udp sockets, the
+	 * drops of a socket are counted by the first thread that uses it */
+	count_drops = (worker->thread_num < (int)worker->daemon->num_ports);
 	for(lp = worker->front->cps; lp; lp = lp->next) {
-		if(lp->com->type == comm_tcp_accept)
+		if(lp->com->type == comm_tcp_accept) {
 			s->svr.tcp_accept_usage += lp->com->cur_tcp_count;
+			s->svr.tcp_fastopen += lp->com->tcp_fastopen_count;
+		} else if(lp->com->type == comm_udp && lp->com->udp_stats) {
+			comm_point_udp_stats_sample(lp->com);
+			if(count_drops)
+				s->svr.udp_drops += lp->com->udp_drops;
+			if(lp->com->udp_rxq_max > s->svr.udp_rxq_max)
+				s->svr.udp_rxq_max = lp->com->udp_rxq_max;
+			if(lp->com->udp_rxq_util > s->svr.udp_rxq_util)
+				s->svr.udp_rxq_util = lp->com->udp_rxq_util;
+		}
 	}
 
 	if(reset && !worker->env.cfg->stat_cumulative) {
@@ -229,12 +260,22 @@ void server_stats_add(struct stats_info* total, struct stats_info* a)
 {
 	total->svr.num_queries += a->svr.num_queries;
 	total->svr.num_queries_ip_ratelimited += a->svr.num_queries_ip_ratelimited;
+	total->svr.num_queries_cookie_valid += a->svr.num_queries_cookie_valid;
+	total->svr.num_queries_cookie_client +=
+		a->svr.num_queries_cookie_client;
+	total->svr.num_queries_cookie_invalid +=
+		a->svr.num_queries_cookie_invalid;
 	total->svr.num_queries_missed_cache += a->svr.num_queries_missed_cache;
 	total->svr.num_queries_prefetch += a->svr.num_queries_prefetch;
 	total->svr.sum_query_list_size += a->svr.sum_query_list_size;
 	/* the max size reached is upped to higher of both */
 	if(a->svr.max_query_list_size > total->svr.max_query_list_size)
 		total->svr.max_query_list_size = a->svr.max_query_list_size;
+	total->svr.udp_drops += a->svr.udp_drops;
+	if(a->svr.udp_rxq_max > total->svr.udp_rxq_max)
+		total->svr.udp_rxq_max = a->svr.udp_rxq_max;
+	if(a->svr.udp_rxq_util > total->svr.udp_rxq_util)
+		total->svr.udp_rxq_util = a->svr.udp_rxq_util;
 
 	if(a->svr.extended) {
 		int i;
@@ -242,6 +283,12 @@ void server_stats_add(struct stats_info* total, struct stats_info* a)
 		total->svr.qclass_big += a->svr.qclass_big;
 		total->svr.qtcp += a->svr.qtcp;
 		total->svr.qtcp_outgoing += a->svr.qtcp_outgoing;
+		total->svr.tcp_fastopen += a->svr.tcp_fastopen;
+		total->svr.tcp_fastopen_outgoing +=
+			a->svr.tcp_fastopen_outgoing;
+		total->svr.cachepeer_sent += a->svr.cachepeer_sent;
+		total->svr.cachepeer_dropped += a->svr.cachepeer_dropped;
+		total->svr.cachepeer_received += a->svr.cachepeer_received;
 		total->svr.qipv6 += a->svr.qipv6;
 		total->svr.qbit_QR += a->svr.qbit_QR;
 		total->svr.qbit_AA += a->svr.qbit_AA;
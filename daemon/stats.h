@@ -65,6 +65,12 @@ struct server_stats {
 	size_t num_queries;
 	/** number of queries that have been dropped/ratelimited by ip. */
 	size_t num_queries_ip_ratelimited;
+	/** number of queries with a valid server cookie */
+	size_t num_queries_cookie_valid;
+	/** number of queries with only a client cookie */
+	size_t num_queries_cookie_client;
+	/** number of queries with a server cookie that failed the check */
+	size_t num_queries_cookie_invalid;
 	/** number of queries that had a cache-miss. */
 	size_t num_queries_missed_cache;
 	/** number of prefetch queries - cachehits with prefetch */
@@ -95,6 +101,16 @@ struct server_stats {
 	size_t qtcp;
 	/** number of outgoing queries over TCP */
 	size_t qtcp_outgoing;
+	/** number of incoming TCP connections with data in the SYN (TFO) */
+	size_t tcp_fastopen;
+	/** number of outgoing TCP connections with the query in the SYN */
+	size_t tcp_fastopen_outgoing;
+	/** number of cache inserts sent to the cache peers, per peer */
+	size_t cachepeer_sent;
+	/** number of cache inserts not sent to the cache peers, per peer */
+	size_t cachepeer_dropped;
+	/** number of cache inserts received from the cache peers */
+	size_t cachepeer_received;
 	/** number of queries over IPv6 */
 	size_t qipv6;
 	/** number of queries with QR bit */
@@ -133,6 +149,13 @@ struct server_stats {
 	size_t unwanted_queries;
 	/** usage of tcp accept list */
 	size_t tcp_accept_usage;
+	/** datagrams dropped by the kernel on the listening UDP sockets */
+	size_t udp_drops;
+	/** largest sampled receive queue of a UDP socket, in bytes */
+	size_t udp_rxq_max;
+	/** largest sampled receive queue of a UDP socket, in percent of
+	 * the receive buffer */
+	size_t udp_rxq_util;
 	/** answers served from expired cache */
 	size_t zero_ttl_responses;
 	/** histogram data exported to array 
@@ -149,6 +172,8 @@ struct server_stats {
 	size_t infra_cache_count;
 	/** number of key cache entries */
 	size_t key_cache_count;
+	/** number of times a lock of the negative cache was busy */
+	size_t neg_cache_contended;
 };
 
 /** 
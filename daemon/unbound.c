@@ -610,6 +610,11 @@ run_daemon(const char* cfgfile, int cmdline_verbose, int debug_mode, const char*
 
 	if(!(daemon = daemon_init()))
 		fatal_exit("alloc failure");
+#ifdef unbound_testbound
+	daemon->autr_async_write = testbound_autr_async;
+#else
+	daemon->autr_async_write = 1;
+#endif
 	while(!daemon->need_to_exit) {
 		if(done_setup)
 			verbose(VERB_OPS, "Restart of %s.", PACKAGE_STRING);
@@ -51,6 +51,7 @@
 #include "util/config_file.h"
 #include "util/module.h"
 #include "util/regional.h"
+#include "util/edns.h"
 #include "util/storage/slabhash.h"
 #include "services/listen_dnsport.h"
 #include "services/outside_network.h"
@@ -58,8 +59,13 @@
 #include "services/cache/rrset.h"
 #include "services/cache/infra.h"
 #include "services/cache/dns.h"
+#include "services/cache/pin.h"
+#include "services/cache/peer.h"
+#include "services/fwd_health.h"
+#include "util/xdp.h"
 #include "services/mesh.h"
 #include "services/localzone.h"
+#include "services/view.h"
 #include "util/data/msgparse.h"
 #include "util/data/msgencode.h"
 #include "util/data/dname.h"
@@ -105,6 +111,12 @@
  */
 #define PREFETCH_EXPIRY_ADD 60
 
+/** seconds between the checks for pinned cache entries to refresh */
+#define CACHE_PIN_INTERVAL 10
+/** seconds after which a CNAME target that is no longer seen in the answer
+ * of a pinned name is no longer pinned */
+#define CACHE_PIN_TARGET_EXPIRY (3*CACHE_PIN_INTERVAL)
+
 /** Report on memory usage by this thread and global */
 static void
 worker_mem_report(struct worker* ATTR_UNUSED(worker), 
@@ -946,6 +958,110 @@ deny_refuse_non_local(struct comm_point* c, enum acl_access acl,
 	return deny_refuse(c, acl, acl_deny_non_local, acl_refuse_non_local, worker, repinfo);
 }
 
+/**
+ * Check the DNS cookie of a query (RFC 7873), and put the client and
+ * server cookie for the reply in the option, so that the reply carries
+ * it.  A recent valid server cookie is sent back as it is.  The option
+ * is removed if cookies are not answered, or if it is malformed.
+ * @param worker: the worker.
+ * @param repinfo: the reply address of the query.
+ * @param edns: the edns data of the query.
+ * @return the state of the cookie.
+ */
+static enum edns_cookie_state
+worker_cookie(struct worker* worker, struct comm_reply* repinfo,
+	struct edns_data* edns)
+{
+	struct edns_option* opt;
+	enum edns_cookie_state state;
+	uint8_t* data;
+	int reuse;
+	if(!edns->edns_present || !(opt = edns_opt_list_find(edns->opt_list,
+		LDNS_EDNS_COOKIE)))
+		return cookie_none;
+	if(!worker->daemon->cfg->do_answer_cookie) {
+		(void)edns_opt_list_remove(&edns->opt_list, LDNS_EDNS_COOKIE);
+		return cookie_none;
+	}
+	state = edns_cookie_server_check(opt, worker->daemon->cookie_secret,
+		&repinfo->addr, repinfo->addrlen, (uint32_t)*worker->env.now,
+		&reuse);
+	if(state == cookie_valid)
+		worker->stats.num_queries_cookie_valid++;
+	else if(state == cookie_client)
+		worker->stats.num_queries_cookie_client++;
+	else if(state == cookie_invalid)
+		worker->stats.num_queries_cookie_invalid++;
+	if(state == cookie_malformed || (!reuse && !(data = regional_alloc(
+		worker->scratchpad, EDNS_COOKIE_SIZE)))) {
+		(void)edns_opt_list_remove(&edns->opt_list, LDNS_EDNS_COOKIE);
+		return state;
+	}
+	if(!reuse) {
+		edns_cookie_server_write(data, opt->opt_data,
+			worker->daemon->cookie_secret, &repinfo->addr,
+			repinfo->addrlen, (uint32_t)*worker->env.now);
+		opt->opt_data = data;
+		opt->opt_len = EDNS_COOKIE_SIZE;
+	}
+	return state;
+}
+
+/**
+ * Check the edns-tcp-keepalive option of a query (RFC 7828). With
+ * edns-tcp-keepalive enabled, the option must not have data and must
+ * not be sent over UDP.
+ * @param worker: the worker.
+ * @param c: the commpoint of the query.
+ * @param edns: the edns data of the query.
+ * @return false if the query gets FORMERR.
+ */
+static int
+worker_tcp_keepalive_check(struct worker* worker, struct comm_point* c,
+	struct edns_data* edns)
+{
+	struct edns_option* opt = edns_opt_list_find(edns->opt_list,
+		LDNS_EDNS_KEEPALIVE);
+	if(!opt || !worker->daemon->cfg->do_tcp_keepalive)
+		return 1;
+	return c->type != comm_udp && opt->opt_len == 0;
+}
+
+/**
+ * Handle the edns-tcp-keepalive option of a query (RFC 7828). On TCP,
+ * the idle timeout of the connection is set and the option data is
+ * filled with that timeout, in units of 100 msec, so that the reply
+ * carries it. Otherwise the option is removed from the list.
+ * The option is checked with worker_tcp_keepalive_check before.
+ * @param worker: the worker.
+ * @param c: the commpoint of the query.
+ * @param edns: the edns data of the query.
+ */
+static void
+worker_tcp_keepalive(struct worker* worker, struct comm_point* c,
+	struct edns_data* edns)
+{
+	struct edns_option* opt = edns_opt_list_find(edns->opt_list,
+		LDNS_EDNS_KEEPALIVE);
+	int msec;
+	uint8_t* data;
+	if(!opt)
+		return;
+	if(c->type != comm_tcp || !worker->daemon->cfg->do_tcp_keepalive ||
+		opt->opt_len != 0 || !(data = regional_alloc(
+		worker->scratchpad, sizeof(uint16_t)))) {
+		(void)edns_opt_list_remove(&edns->opt_list,
+			LDNS_EDNS_KEEPALIVE);
+		return;
+	}
+	msec = comm_point_tcp_set_idle(c,
+		worker->daemon->cfg->tcp_keepalive_timeout);
+	sldns_write_uint16(data, (uint16_t)(msec/100 > 65535 ? 65535 :
+		msec/100));
+	opt->opt_len = sizeof(uint16_t);
+	opt->opt_data = data;
+}
+
 int 
 worker_handle_request(struct comm_point* c, void* arg, int error,
 	struct comm_reply* repinfo)
@@ -956,6 +1072,10 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 	struct lruhash_entry* e;
 	struct query_info qinfo;
 	struct edns_data edns;
+	struct edns_opt_store edns_store;
+	int edns_rcode = 0;
+	hashvalue_type qname_hash = 0;
+	uint8_t* hashed_qname;
 	enum acl_access acl;
 	struct acl_addr* acladdr;
 	int rc = 0;
@@ -968,6 +1088,8 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 	struct query_info* lookup_qinfo = &qinfo;
 	struct query_info qinfo_tmp; /* placeholdoer for lookup_qinfo */
 	struct respip_client_info* cinfo = NULL, cinfo_tmp;
+	enum edns_cookie_state cookie = cookie_none;
+	int parsed;
 
 	if(error != NETEVENT_NOERROR) {
 		/* some bad tcp query DNS formats give these error calls */
@@ -1036,9 +1158,16 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 
 	worker->stats.num_queries++;
 
-	/* check if this query should be dropped based on source ip rate limiting */
-	if(!infra_ip_ratelimit_inc(worker->env.infra_cache, repinfo,
-			*worker->env.now)) {
+	/* parse the query, and check its cookie */
+	parsed = query_info_parse_edns(&qinfo, c->buffer, &edns, &edns_rcode,
+		&edns_store, worker->scratchpad, &qname_hash);
+	if(parsed && edns_rcode == 0)
+		cookie = worker_cookie(worker, repinfo, &edns);
+
+	/* check if this query should be dropped based on source ip rate
+	 * limiting, a valid cookie shows that the source is not spoofed */
+	if(cookie != cookie_valid && !infra_ip_ratelimit_inc(
+		worker->env.infra_cache, repinfo, *worker->env.now)) {
 		/* See if we are passed through with slip factor */
 		if(worker->env.cfg->ip_ratelimit_factor != 0 &&
 			ub_random_max(worker->env.rnd,
@@ -1051,13 +1180,13 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 				  addrbuf);
 		} else {
 			worker->stats.num_queries_ip_ratelimited++;
+			regional_free_all(worker->scratchpad);
 			comm_point_drop_reply(repinfo);
 			return 0;
 		}
 	}
 
-	/* see if query is in the cache */
-	if(!query_info_parse(&qinfo, c->buffer)) {
+	if(!parsed || cookie == cookie_malformed) {
 		verbose(VERB_ALGO, "worker parse request: formerror.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
 		if(worker_err_ratelimit(worker, LDNS_RCODE_FORMERR) == -1) {
@@ -1071,6 +1200,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		server_stats_insrcode(&worker->stats, c->buffer);
 		goto send_reply;
 	}
+	hashed_qname = qinfo.qname;
 	if(worker->env.cfg->log_queries) {
 		char ip[128];
 		addr_to_str(&repinfo->addr, repinfo->addrlen, ip, sizeof(ip));
@@ -1080,6 +1210,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		qinfo.qtype == LDNS_RR_TYPE_IXFR) {
 		verbose(VERB_ALGO, "worker request: refused zone transfer.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
+		regional_free_all(worker->scratchpad);
 		sldns_buffer_rewind(c->buffer);
 		LDNS_QR_SET(sldns_buffer_begin(c->buffer));
 		LDNS_RCODE_SET(sldns_buffer_begin(c->buffer), 
@@ -1098,6 +1229,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		(qinfo.qtype >= 128 && qinfo.qtype <= 248)) {
 		verbose(VERB_ALGO, "worker request: formerror for meta-type.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
+		regional_free_all(worker->scratchpad);
 		if(worker_err_ratelimit(worker, LDNS_RCODE_FORMERR) == -1) {
 			comm_point_drop_reply(repinfo);
 			return 0;
@@ -1112,7 +1244,9 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		}
 		goto send_reply;
 	}
-	if((ret=parse_edns_from_pkt(c->buffer, &edns, worker->scratchpad)) != 0) {
+	if(edns_rcode == 0 && !worker_tcp_keepalive_check(worker, c, &edns))
+		edns_rcode = LDNS_RCODE_FORMERR;
+	if((ret=edns_rcode) != 0) {
 		struct edns_data reply_edns;
 		verbose(VERB_ALGO, "worker parse edns: formerror.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
@@ -1176,6 +1310,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 			qinfo.qclass, &edns, repinfo);
 	if(c->type != comm_udp)
 		edns.udp_size = 65535; /* max size for TCP replies */
+	worker_tcp_keepalive(worker, c, &edns);
 	if(qinfo.qclass == LDNS_RR_CLASS_CH && answer_chaos(worker, &qinfo,
 		&edns, c->buffer)) {
 		server_stats_insrcode(&worker->stats, c->buffer);
@@ -1260,7 +1395,14 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		cinfo_tmp.view = acladdr->view;
 		cinfo_tmp.respip_set = worker->daemon->respip_set;
 		cinfo = &cinfo_tmp;
+	} else if(acladdr->view && acladdr->view->cache_id) {
+		/* the view is charged for the cache entries of the query */
+		memset(&cinfo_tmp, 0, sizeof(cinfo_tmp));
+		cinfo_tmp.view = acladdr->view;
+		cinfo = &cinfo_tmp;
 	}
+	if(acladdr->view)
+		view_count_query(acladdr->view);
 
 lookup_cache:
 	/* Lookup the cache.  In case we chase an intermediate CNAME chain
@@ -1268,8 +1410,14 @@ lookup_cache:
 	 * each pass.  We should still pass the original qinfo to
 	 * answer_from_cache(), however, since it's used to build the reply. */
 	if(!edns_bypass_cache_stage(edns.opt_list, &worker->env)) {
-		h = query_info_hash(lookup_qinfo, sldns_buffer_read_u16_at(c->buffer, 2));
-		if((e=slabhash_lookup(worker->env.msg_cache, h, lookup_qinfo, 0))) {
+		/* the qname hash from the parse, unless it was replaced */
+		if(lookup_qinfo->qname == hashed_qname)
+			h = query_info_hash_qname(lookup_qinfo,
+				sldns_buffer_read_u16_at(c->buffer, 2),
+				qname_hash);
+		else	h = query_info_hash(lookup_qinfo,
+				sldns_buffer_read_u16_at(c->buffer, 2));
+		if((e=msgreply_lookup(worker->env.msg_cache, h, lookup_qinfo, 0))) {
 			/* answer from cache - we have acquired a readlock on it */
 			if(answer_from_cache(worker, &qinfo, 
 				cinfo, &need_drop, &alias_rrset, &partial_rep,
@@ -1340,6 +1488,8 @@ lookup_cache:
 	}
 	sldns_buffer_rewind(c->buffer);
 	server_stats_querymiss(&worker->stats, worker);
+	if(acladdr->view)
+		view_count_cachemiss(acladdr->view);
 
 	if(verbosity >= VERB_CLIENT) {
 		if(c->type == comm_udp)
@@ -1458,6 +1608,91 @@ void worker_probe_timer_cb(void* arg)
 		comm_timer_set(worker->env.probe_timer, &tv);
 }
 
+void worker_cache_pin_start(struct worker* worker)
+{
+	struct timeval tv;
+	if(!worker->pin_timer ||
+		cache_pins_count(worker->daemon->cache_pins) == 0)
+		return;
+#ifndef S_SPLINT_S
+	tv.tv_sec = CACHE_PIN_INTERVAL;
+	tv.tv_usec = 0;
+#endif
+	comm_timer_set(worker->pin_timer, &tv);
+}
+
+/** pin the rrsets of the CNAME chain in the answer to a pinned query,
+ * at the names after the query name, caller holds the lock on the reply */
+static void
+worker_pin_cname_targets(struct worker* worker, struct query_info* qinfo,
+	struct reply_info* rep)
+{
+	struct ub_packed_rrset_key* k;
+	size_t i;
+	for(i=0; i<rep->an_numrrsets; i++) {
+		k = rep->ref[i].key;
+		lock_rw_rdlock(&k->entry.lock);
+		if(k->id == rep->ref[i].id && query_dname_compare(
+			k->rk.dname, qinfo->qname) != 0 &&
+			!cache_pins_add_target(worker->daemon->cache_pins,
+			k->rk.dname, k->rk.dname_len, ntohs(k->rk.type),
+			*worker->env.now))
+			log_err("cache pin refresh: out of memory");
+		lock_rw_unlock(&k->entry.lock);
+	}
+}
+
+void worker_cache_pin_timer_cb(void* arg)
+{
+	struct worker* worker = (struct worker*)arg;
+	struct regional* region = regional_create();
+	struct query_info* list;
+	struct lruhash_entry* e;
+	struct reply_info* rep;
+	size_t num = 0, i;
+	time_t leeway;
+	if(!region) {
+		log_err("cache pin refresh: out of memory");
+		worker_cache_pin_start(worker);
+		return;
+	}
+	/* copy the list, the mesh can run the pinned queries, and those
+	 * look up the pins when stored in the cache */
+	list = cache_pins_refresh_list(worker->daemon->cache_pins, region,
+		&num);
+	for(i=0; i<num; i++) {
+		leeway = 0;
+		e = msgreply_lookup(worker->env.msg_cache,
+			query_info_hash(&list[i], BIT_RD), &list[i], 0);
+		if(e) {
+			rep = (struct reply_info*)e->data;
+			worker_pin_cname_targets(worker, &list[i], rep);
+			/* refresh if it would be in the prefetch window
+			 * before the next check */
+			if(*worker->env.now + CACHE_PIN_INTERVAL <
+				rep->prefetch_ttl) {
+				lock_rw_unlock(&e->lock);
+				continue;
+			}
+			if(rep->ttl > *worker->env.now)
+				leeway = rep->ttl - *worker->env.now;
+			lock_rw_unlock(&e->lock);
+		}
+		if(verbosity >= VERB_ALGO)
+			log_query_info(VERB_ALGO, "cache pin refresh", &list[i]);
+		mesh_new_prefetch(worker->env.mesh, &list[i], BIT_RD,
+			leeway + PREFETCH_EXPIRY_ADD);
+	}
+	regional_destroy(region);
+	/* the targets that are no longer in the CNAME chain of an answer */
+	if(cache_pins_expire_targets(worker->daemon->cache_pins,
+		*worker->env.now - CACHE_PIN_TARGET_EXPIRY) != 0)
+		cache_pins_setup(worker->daemon->cache_pins,
+			worker->env.msg_cache,
+			&worker->env.rrset_cache->table);
+	worker_cache_pin_start(worker);
+}
+
 struct worker* 
 worker_create(struct daemon* daemon, int id, int* ports, int n)
 {
@@ -1512,6 +1747,8 @@ worker_init(struct worker* worker, struct config_file *cfg,
 #else
 	void* dtenv = NULL;
 #endif
+	struct xdp_sock* xsk;
+	int i;
 	worker->need_to_exit = 0;
 	worker->base = comm_base_create(do_sigs);
 	if(!worker->base) {
@@ -1559,14 +1796,25 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker->comsig = NULL;
 	}
 	worker->front = listen_create(worker->base, ports,
-		cfg->msg_buffer_size, (int)cfg->incoming_num_tcp, 
-		worker->daemon->listen_sslctx, dtenv, worker_handle_request,
-		worker);
+		cfg->msg_buffer_size, (int)cfg->incoming_num_tcp,
+		cfg->tcp_idle_timeout, worker->daemon->listen_sslctx, dtenv,
+		worker_handle_request, worker);
 	if(!worker->front) {
 		log_err("could not create listening sockets");
 		worker_delete(worker);
 		return 0;
 	}
+	/* every AF_XDP socket is served by one thread, its rings have a
+	 * single reader and writer */
+	for(xsk = worker->daemon->xdp, i = 0; xsk; xsk = xsk->next, i++) {
+		if(i % worker->daemon->num != worker->thread_num)
+			continue;
+		if(!listen_add_xdp(worker->front, worker->base, xsk, dtenv,
+			worker_handle_request, worker)) {
+			worker_delete(worker);
+			return 0;
+		}
+	}
 	worker->back = outside_network_create(worker->base,
 		cfg->msg_buffer_size, (size_t)cfg->outgoing_num_ports, 
 		cfg->out_ifs, cfg->num_out_ifs, cfg->do_ip4, cfg->do_ip6, 
@@ -1574,8 +1822,9 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker->daemon->env->infra_cache, worker->rndstate,
 		cfg->use_caps_bits_for_id, worker->ports, worker->numports,
 		cfg->unwanted_threshold, cfg->outgoing_tcp_mss,
-		&worker_alloc_cleanup, worker,
-		cfg->do_udp, worker->daemon->connect_sslctx, cfg->delay_close,
+		cfg->tcp_upstream_fastopen,
+		cfg->upstream_cookie?worker->daemon->cookie_secret:NULL,
+		&worker_alloc_cleanup, worker, cfg->do_udp, worker->daemon->connect_sslctx, cfg->delay_close,
 		dtenv);
 	if(!worker->back) {
 		log_err("could not create outgoing sockets");
@@ -1617,6 +1866,7 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	worker->env.alloc = &worker->alloc;
 	worker->env.rnd = worker->rndstate;
 	worker->env.scratch = worker->scratchpad;
+	worker->env.infra_local = worker->back->infra_local;
 	worker->env.mesh = mesh_create(&worker->daemon->mods, &worker->env);
 	worker->env.detach_subs = &mesh_detach_subs;
 	worker->env.attach_sub = &mesh_attach_sub;
@@ -1657,6 +1907,51 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+	/* one timer per process refreshes the pinned cache entries */
+	if(worker->daemon->cache_pins
+#ifndef THREADS_DISABLED
+		&& worker->thread_num == 0
+#endif
+		) {
+		worker->pin_timer = comm_timer_create(worker->base,
+			worker_cache_pin_timer_cb, worker);
+		if(!worker->pin_timer)
+			log_err("could not create cache pin timer");
+		else	worker_cache_pin_start(worker);
+	}
+	/* the infra cache with the health of the forwarders is shared,
+	 * one thread sends the probes */
+	if(cfg->fwd_health_check
+#ifndef THREADS_DISABLED
+		&& worker->thread_num == 0
+#endif
+		) {
+		worker->fwd_health = fwd_health_create(&worker->env,
+			worker->back, worker->base, cfg->fwd_probe_interval);
+		if(!worker->fwd_health)
+			log_err("could not create forwarder health probes");
+	}
+	/* every thread sends its cache inserts to the cache peers, one
+	 * thread per process receives the inserts of the peers */
+	if(cfg->cache_peers || worker->daemon->peer_ports) {
+		worker->env.cache_peers = cache_peers_create(&worker->env,
+			worker->base, cfg, worker->daemon->num);
+		if(!worker->env.cache_peers) {
+			log_err("could not create the cache peers");
+			worker_delete(worker);
+			return 0;
+		}
+		if(
+#ifndef THREADS_DISABLED
+			worker->thread_num == 0 &&
+#endif
+			!cache_peers_open_accept(worker->env.cache_peers,
+			worker->daemon->peer_ports)) {
+			log_err("could not listen for the cache peers");
+			worker_delete(worker);
+			return 0;
+		}
+	}
 	worker_mem_report(worker, NULL);
 	/* if statistics enabled start timer */
 	if(worker->env.cfg->stat_interval > 0) {
@@ -1685,6 +1980,7 @@ worker_delete(struct worker* worker)
 	}
 	outside_network_quit_prepare(worker->back);
 	mesh_delete(worker->env.mesh);
+	fwd_health_delete(worker->fwd_health);
 	sldns_buffer_free(worker->env.scratch_buffer);
 	forwards_delete(worker->env.fwds);
 	hints_delete(worker->env.hints);
@@ -1694,6 +1990,8 @@ worker_delete(struct worker* worker)
 	tube_delete(worker->cmd);
 	comm_timer_delete(worker->stat_timer);
 	comm_timer_delete(worker->env.probe_timer);
+	comm_timer_delete(worker->pin_timer);
+	cache_peers_delete(worker->env.cache_peers);
 	free(worker->ports);
 	if(worker->thread_num == 0) {
 		log_set_time(NULL);
@@ -1744,6 +2042,14 @@ void worker_stats_clear(struct worker* worker)
 	mesh_stats_clear(worker->env.mesh);
 	worker->back->unwanted_replies = 0;
 	worker->back->num_tcp_outgoing = 0;
+	worker->back->num_tcp_fastopen = 0;
+	listen_clear_tcp_fastopen(worker->front);
+	listen_clear_udp_stats(worker->front);
+	if(worker->env.cache_peers) {
+		worker->env.cache_peers->num_sent = 0;
+		worker->env.cache_peers->num_dropped = 0;
+		worker->env.cache_peers->num_received = 0;
+	}
 }
 
 void worker_start_accept(void* arg)
@@ -61,6 +61,7 @@ struct ub_randstate;
 struct regional;
 struct tube;
 struct daemon_remote;
+struct fwd_health;
 struct query_info;
 
 /** worker commands */
@@ -104,6 +105,10 @@ struct worker {
 	struct comm_point* cmd_com;
 	/** timer for statistics */
 	struct comm_timer* stat_timer;
+	/** timer to refresh the pinned cache entries, on thread 0 */
+	struct comm_timer* pin_timer;
+	/** health probes to the forwarders, on thread 0 */
+	struct fwd_health* fwd_health;
 	/** ratelimit for errors, time value */
 	time_t err_limit_time;
 	/** ratelimit for errors, packet count */
@@ -175,4 +180,11 @@ void worker_send_cmd(struct worker* worker, enum worker_commands cmd);
  */
 void worker_stats_clear(struct worker* worker);
 
+/**
+ * Start the timer that refreshes the pinned cache entries, if there
+ * are pins.  It is run by the first thread.
+ * @param worker: the worker.
+ */
+void worker_cache_pin_start(struct worker* worker);
+
 #endif /* DAEMON_WORKER_H */
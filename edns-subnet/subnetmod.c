@@ -311,7 +311,7 @@ update_cache(struct module_qstate *qstate, int id)
 		((struct subnet_qstate*)qstate->minfo[id])->qinfo_hash : 
 		query_info_hash(&qstate->qinfo, qstate->query_flags);
 	/** Step 1, general qinfo lookup */
-	struct lruhash_entry *lru_entry = slabhash_lookup(subnet_msg_cache, h,
+	struct lruhash_entry *lru_entry = msgreply_lookup(subnet_msg_cache, h,
 		&qstate->qinfo, 1);
 	int acquired_lock = (lru_entry != NULL);
 	if (!lru_entry) {
@@ -386,7 +386,7 @@ lookup_and_reply(struct module_qstate *qstate, int id, struct subnet_qstate *sq)
 	memset(&sq->ecs_client_out, 0, sizeof(sq->ecs_client_out));
 
 	if (sq) sq->qinfo_hash = h; /** Might be useful on cache miss */
-	e = slabhash_lookup(sne->subnet_msg_cache, h, &qstate->qinfo, 1);
+	e = msgreply_lookup(sne->subnet_msg_cache, h, &qstate->qinfo, 1);
 	if (!e) return 0; /** qinfo not in cache */
 	data = e->data;
 	tree = (ecs->subnet_addr_fam == EDNSSUBNET_ADDRFAM_IP4)?
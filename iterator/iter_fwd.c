@@ -46,6 +46,7 @@
 #include "util/config_file.h"
 #include "util/net_help.h"
 #include "util/data/dname.h"
+#include "util/storage/dnstree.h"
 #include "sldns/rrdef.h"
 #include "sldns/str2wire.h"
 
@@ -88,8 +89,16 @@ static void delfwdnode(rbnode_type* n, void* ATTR_UNUSED(arg))
 	fwd_zone_free(node);
 }
 
+/** delete the index of the tree */
+static void fwd_drop_index(struct iter_forwards* fwd)
+{
+	name_index_delete(fwd->index);
+	fwd->index = NULL;
+}
+
 static void fwd_del_tree(struct iter_forwards* fwd)
 {
+	fwd_drop_index(fwd);
 	if(fwd->tree)
 		traverse_postorder(fwd->tree, &delfwdnode, NULL);
 	free(fwd->tree);
@@ -145,11 +154,14 @@ forwards_insert(struct iter_forwards* fwd, uint16_t c, struct delegpt* dp)
 		dp->namelabs, dp);
 }
 
-/** initialise parent pointers in the tree */
+/** initialise parent pointers in the tree, and make the index.  The new
+ * index is made before it replaces the old one, so nodes that are removed
+ * from the tree are freed after this. */
 static void
 fwd_init_parents(struct iter_forwards* fwd)
 {
 	struct iter_forward_zone* node, *prev = NULL, *p;
+	struct name_index* idx;
 	int m;
 	RBTREE_FOR(node, struct iter_forward_zone*, fwd->tree) {
 		node->parent = NULL;
@@ -172,6 +184,19 @@ fwd_init_parents(struct iter_forwards* fwd)
 			}
 		prev = node;
 	}
+	/* if it fails, the lookups use the tree */
+	if((idx = name_index_create()) != NULL) {
+		RBTREE_FOR(node, struct iter_forward_zone*, fwd->tree) {
+			if(!name_index_add(idx, node, node->name,
+				node->dclass)) {
+				name_index_delete(idx);
+				idx = NULL;
+				break;
+			}
+		}
+	}
+	fwd_drop_index(fwd);
+	fwd->index = idx;
 }
 
 /** set zone name */
@@ -350,6 +375,21 @@ forwards_lookup(struct iter_forwards* fwd, uint8_t* qname, uint16_t qclass)
 	rbnode_type* res = NULL;
 	struct iter_forward_zone *result;
 	struct iter_forward_zone key;
+	if(fwd->index) {
+		int m;
+		result = (struct iter_forward_zone*)name_index_lookup(
+			fwd->index, qname, qclass, &m);
+		if(!result || result->dclass != qclass)
+			return NULL;
+		while(result) { /* go up until qname is subdomain of stub */
+			if(result->namelabs <= m)
+				break;
+			result = result->parent;
+		}
+		if(result)
+			return result->dp;
+		return NULL;
+	}
 	key.node.key = &key;
 	key.dclass = qclass;
 	key.name = qname;
@@ -441,7 +481,8 @@ forwards_get_mem(struct iter_forwards* fwd)
 	size_t s;
 	if(!fwd)
 		return 0;
-	s = sizeof(*fwd) + sizeof(*fwd->tree);
+	s = sizeof(*fwd) + sizeof(*fwd->tree) +
+		name_index_get_mem(fwd->index);
 	RBTREE_FOR(p, struct iter_forward_zone*, fwd->tree) {
 		s += sizeof(*p) + p->namelen + delegpt_get_mem(p->dp);
 	}
@@ -463,14 +504,15 @@ int
 forwards_add_zone(struct iter_forwards* fwd, uint16_t c, struct delegpt* dp)
 {
 	struct iter_forward_zone *z;
-	if((z=fwd_zone_find(fwd, c, dp->name)) != NULL) {
+	int r;
+	if((z=fwd_zone_find(fwd, c, dp->name)) != NULL)
 		(void)rbtree_delete(fwd->tree, &z->node);
-		fwd_zone_free(z);
-	}
-	if(!forwards_insert(fwd, c, dp))
-		return 0;
+	r = forwards_insert(fwd, c, dp);
 	fwd_init_parents(fwd);
-	return 1;
+	/* the old index is gone, the old zone can be freed */
+	if(z)
+		fwd_zone_free(z);
+	return r;
 }
 
 void 
@@ -480,8 +522,8 @@ forwards_delete_zone(struct iter_forwards* fwd, uint16_t c, uint8_t* nm)
 	if(!(z=fwd_zone_find(fwd, c, nm)))
 		return; /* nothing to do */
 	(void)rbtree_delete(fwd->tree, &z->node);
-	fwd_zone_free(z);
 	fwd_init_parents(fwd);
+	fwd_zone_free(z);
 }
 
 int
@@ -503,7 +545,7 @@ forwards_delete_stub_hole(struct iter_forwards* fwd, uint16_t c, uint8_t* nm)
 	if(z->dp != NULL)
 		return; /* not a stub hole */
 	(void)rbtree_delete(fwd->tree, &z->node);
-	fwd_zone_free(z);
 	fwd_init_parents(fwd);
+	fwd_zone_free(z);
 }
 
@@ -45,6 +45,7 @@
 #include "util/rbtree.h"
 struct config_file;
 struct delegpt;
+struct name_index;
 
 /**
  * Iterator forward zones structure
@@ -58,6 +59,12 @@ struct iter_forwards {
 	 * contents of type iter_forward_zone.
 	 */
 	rbtree_type* tree;
+	/**
+	 * Sorted array index of the tree, for the lookups, made after the
+	 * tree is set up.  NULL if the tree is changed, then the tree
+	 * itself is used.
+	 */
+	struct name_index* index;
 };
 
 /**
@@ -75,9 +75,24 @@ static void delhintnode(rbnode_type* n, void* ATTR_UNUSED(arg))
 
 static void hints_del_tree(struct iter_hints* hints)
 {
+	name_index_delete(hints->index);
+	hints->index = NULL;
 	traverse_postorder(&hints->tree, &delhintnode, NULL);
 }
 
+/** set up the parent pointers and the index, after the tree is changed.
+ * The new index is made before it replaces the old one, so stubs that are
+ * removed from the tree are freed after this. */
+static void hints_init_parents(struct iter_hints* hints)
+{
+	struct name_index* idx;
+	name_tree_init_parents(&hints->tree);
+	/* if it fails, the lookups use the tree */
+	idx = name_tree_index_create(&hints->tree);
+	name_index_delete(hints->index);
+	hints->index = idx;
+}
+
 void 
 hints_delete(struct iter_hints* hints)
 {
@@ -443,7 +458,7 @@ hints_apply_cfg(struct iter_hints* hints, struct config_file* cfg)
 			return 0;
 	}
 
-	name_tree_init_parents(&hints->tree);
+	hints_init_parents(hints);
 	return 1;
 }
 
@@ -468,9 +483,14 @@ hints_lookup_stub(struct iter_hints* hints, uint8_t* qname,
 	struct iter_hints_stub *r;
 
 	/* first lookup the stub */
-	labs = dname_count_size_labels(qname, &len);
-	r = (struct iter_hints_stub*)name_tree_lookup(&hints->tree, qname,
-		len, labs, qclass);
+	if(hints->index) {
+		r = (struct iter_hints_stub*)name_tree_lookup_index(
+			hints->index, qname, qclass);
+	} else {
+		labs = dname_count_size_labels(qname, &len);
+		r = (struct iter_hints_stub*)name_tree_lookup(&hints->tree,
+			qname, len, labs, qclass);
+	}
 	if(!r) return NULL;
 
 	/* If there is no cache (root prime situation) */
@@ -507,7 +527,7 @@ hints_get_mem(struct iter_hints* hints)
 	size_t s;
 	struct iter_hints_stub* p;
 	if(!hints) return 0;
-	s = sizeof(*hints);
+	s = sizeof(*hints) + name_index_get_mem(hints->index);
 	RBTREE_FOR(p, struct iter_hints_stub*, &hints->tree) {
 		s += sizeof(*p) + delegpt_get_mem(p->dp);
 	}
@@ -519,15 +539,16 @@ hints_add_stub(struct iter_hints* hints, uint16_t c, struct delegpt* dp,
 	int noprime)
 {
 	struct iter_hints_stub *z;
+	int r;
 	if((z=(struct iter_hints_stub*)name_tree_find(&hints->tree,
-		dp->name, dp->namelen, dp->namelabs, c)) != NULL) {
+		dp->name, dp->namelen, dp->namelabs, c)) != NULL)
 		(void)rbtree_delete(&hints->tree, &z->node);
+	r = hints_insert(hints, c, dp, noprime);
+	hints_init_parents(hints);
+	/* the old index is gone, the old stub can be freed */
+	if(z)
 		hints_stub_free(z);
-	}
-	if(!hints_insert(hints, c, dp, noprime))
-		return 0;
-	name_tree_init_parents(&hints->tree);
-	return 1;
+	return r;
 }
 
 void 
@@ -540,7 +561,7 @@ hints_delete_stub(struct iter_hints* hints, uint16_t c, uint8_t* nm)
 		nm, len, labs, c)))
 		return; /* nothing to do */
 	(void)rbtree_delete(&hints->tree, &z->node);
+	hints_init_parents(hints);
 	hints_stub_free(z);
-	name_tree_init_parents(&hints->tree);
 }
 
@@ -60,6 +60,12 @@ struct iter_hints {
 	 * uses name_tree_node from dnstree.h.
 	 */
 	rbtree_type tree;
+	/**
+	 * Sorted array index of the tree, for the lookups, made after the
+	 * tree is set up.  NULL if the tree is changed, then the tree
+	 * itself is used.
+	 */
+	struct name_index* index;
 };
 
 /**
@@ -143,6 +143,7 @@ caps_white_apply_cfg(rbtree_type* ntree, struct config_file* cfg)
 int 
 iter_apply_cfg(struct iter_env* iter_env, struct config_file* cfg)
 {
+	struct name_index* idx;
 	int i;
 	/* target fetch policy */
 	if(!read_fetch_policy(iter_env, cfg->target_fetch_policy))
@@ -171,30 +172,31 @@ iter_apply_cfg(struct iter_env* iter_env, struct config_file* cfg)
 			log_err("Could not set capsforid whitelist");
 			return 0;
 		}
+		if(!(idx = name_tree_index_create(iter_env->caps_white))) {
+			log_err("Could not set capsforid whitelist index");
+			return 0;
+		}
+		name_index_delete(iter_env->caps_white_index);
+		iter_env->caps_white_index = idx;
 
 	}
 	iter_env->supports_ipv6 = cfg->do_ip6;
 	iter_env->supports_ipv4 = cfg->do_ip4;
+	iter_env->fwd_health = cfg->fwd_health_check;
 	return 1;
 }
 
-/** filter out unsuitable targets
- * @param iter_env: iterator environment with ipv6-support flag.
- * @param env: module environment with infra cache.
- * @param name: zone name
- * @param namelen: length of name
- * @param qtype: query type (host order).
- * @param now: current time
+/** filter out unsuitable targets, the address is usable by
+ * iter_addr_usable, this looks at the infra cache information.
  * @param a: address in delegation point we are examining.
+ * @param info: the infra cache information for the address, from
+ *	infra_get_lame_rtt_batch.
  * @return an integer that signals the target suitability.
  *	as follows:
  *	-1: The address should be omitted from the list.
  *	    Because:
- *		o The address is bogus (DNSSEC validation failure).
- *		o Listed as donotquery
- *		o is ipv6 but no ipv6 support (in operating system).
- *		o is ipv4 but no ipv4 support (in operating system).
  *		o is lame
+ *		o is unresponsive
  *	Otherwise, an rtt in milliseconds.
  *	0 .. USEFUL_SERVER_TOP_TIMEOUT-1
  *		The roundtrip time timeout estimate. less than 2 minutes.
@@ -223,35 +225,18 @@ iter_apply_cfg(struct iter_env* iter_env, struct config_file* cfg)
  * checking turned off. 
  */
 static int
-iter_filter_unsuitable(struct iter_env* iter_env, struct module_env* env,
-	uint8_t* name, size_t namelen, uint16_t qtype, time_t now, 
-	struct delegpt_addr* a)
+iter_filter_unsuitable(struct delegpt_addr* a, struct infra_lame_rtt* info)
 {
-	int rtt, lame, reclame, dnsseclame;
-	if(a->bogus)
-		return -1; /* address of server is bogus */
-	if(donotq_lookup(iter_env->donotq, &a->addr, a->addrlen)) {
-		log_addr(VERB_ALGO, "skip addr on the donotquery list",
-			&a->addr, a->addrlen);
-		return -1; /* server is on the donotquery list */
-	}
-	if(!iter_env->supports_ipv6 && addr_is_ip6(&a->addr, a->addrlen)) {
-		return -1; /* there is no ip6 available */
-	}
-	if(!iter_env->supports_ipv4 && !addr_is_ip6(&a->addr, a->addrlen)) {
-		return -1; /* there is no ip4 available */
-	}
+	int rtt = info->rtt;
 	/* check lameness - need zone , class info */
-	if(infra_get_lame_rtt(env->infra_cache, &a->addr, a->addrlen, 
-		name, namelen, qtype, &lame, &dnsseclame, &reclame, 
-		&rtt, now)) {
+	if(info->found) {
 		log_addr(VERB_ALGO, "servselect", &a->addr, a->addrlen);
 		verbose(VERB_ALGO, "   rtt=%d%s%s%s%s", rtt,
-			lame?" LAME":"",
-			dnsseclame?" DNSSEC_LAME":"",
-			reclame?" REC_LAME":"",
+			info->lame?" LAME":"",
+			info->dnsseclame?" DNSSEC_LAME":"",
+			info->reclame?" REC_LAME":"",
 			a->lame?" ADDR_LAME":"");
-		if(lame)
+		if(info->lame)
 			return -1; /* server is lame */
 		else if(rtt >= USEFUL_SERVER_TOP_TIMEOUT)
 			/* server is unresponsive,
@@ -262,9 +247,9 @@ iter_filter_unsuitable(struct iter_env* iter_env, struct module_env* env,
 			 * tried */
 			return -1;
 		/* select remainder from worst to best */
-		else if(reclame)
+		else if(info->reclame)
 			return rtt+USEFUL_SERVER_TOP_TIMEOUT*3; /* nonpref */
-		else if(dnsseclame || a->dnsseclame)
+		else if(info->dnsseclame || a->dnsseclame)
 			return rtt+USEFUL_SERVER_TOP_TIMEOUT*2; /* nonpref */
 		else if(a->lame)
 			return rtt+USEFUL_SERVER_TOP_TIMEOUT+1; /* nonpref */
@@ -278,6 +263,32 @@ iter_filter_unsuitable(struct iter_env* iter_env, struct module_env* env,
 	return UNKNOWN_SERVER_NICENESS;
 }
 
+/** see if the address can be used, or if it is filtered out without
+ * looking at the infra cache, returns false if unsuitable:
+ *	o the address is bogus
+ *	o Listed as donotquery
+ *	o is ipv6 but no ipv6 support (in operating system).
+ *	o is ipv4 but no ipv4 support (in operating system).
+ */
+static int
+iter_addr_usable(struct iter_env* iter_env, struct delegpt_addr* a)
+{
+	if(a->bogus)
+		return 0; /* address of server is bogus */
+	if(donotq_lookup(iter_env->donotq, &a->addr, a->addrlen)) {
+		log_addr(VERB_ALGO, "skip addr on the donotquery list",
+			&a->addr, a->addrlen);
+		return 0; /* server is on the donotquery list */
+	}
+	if(!iter_env->supports_ipv6 && addr_is_ip6(&a->addr, a->addrlen)) {
+		return 0; /* there is no ip6 available */
+	}
+	if(!iter_env->supports_ipv4 && !addr_is_ip6(&a->addr, a->addrlen)) {
+		return 0; /* there is no ip4 available */
+	}
+	return 1;
+}
+
 /** lookup RTT information, and also store fastest rtt (if any) */
 static int
 iter_fill_rtt(struct iter_env* iter_env, struct module_env* env,
@@ -285,21 +296,42 @@ iter_fill_rtt(struct iter_env* iter_env, struct module_env* env,
 	struct delegpt* dp, int* best_rtt, struct sock_list* blacklist)
 {
 	int got_it = 0;
-	struct delegpt_addr* a;
+	struct delegpt_addr* a, *batch[INFRA_BATCH_MAX];
+	struct infra_lame_rtt info[INFRA_BATCH_MAX];
+	size_t num, i;
 	if(dp->bogus)
 		return 0; /* NS bogus, all bogus, nothing found */
-	for(a=dp->result_list; a; a = a->next_result) {
-		a->sel_rtt = iter_filter_unsuitable(iter_env, env, 
-			name, namelen, qtype, now, a);
-		if(a->sel_rtt != -1) {
-			if(sock_list_find(blacklist, &a->addr, a->addrlen))
-				a->sel_rtt += BLACKLIST_PENALTY;
+	a = dp->result_list;
+	while(a) {
+		/* the infra data of the usable addresses, in one go */
+		num = 0;
+		for(; a && num < INFRA_BATCH_MAX; a = a->next_result) {
+			if(!iter_addr_usable(iter_env, a)) {
+				a->sel_rtt = -1;
+				continue;
+			}
+			info[num].addr = &a->addr;
+			info[num].addrlen = a->addrlen;
+			batch[num++] = a;
+		}
+		if(num == 0)
+			continue;
+		infra_get_lame_rtt_batch(env->infra_cache, env->infra_local,
+			info, num, name, namelen, qtype, now);
+		for(i=0; i<num; i++) {
+			batch[i]->sel_rtt = iter_filter_unsuitable(batch[i],
+				&info[i]);
+			if(batch[i]->sel_rtt == -1)
+				continue;
+			if(sock_list_find(blacklist, &batch[i]->addr,
+				batch[i]->addrlen))
+				batch[i]->sel_rtt += BLACKLIST_PENALTY;
 
 			if(!got_it) {
-				*best_rtt = a->sel_rtt;
+				*best_rtt = batch[i]->sel_rtt;
 				got_it = 1;
-			} else if(a->sel_rtt < *best_rtt) {
-				*best_rtt = a->sel_rtt;
+			} else if(batch[i]->sel_rtt < *best_rtt) {
+				*best_rtt = batch[i]->sel_rtt;
 			}
 		}
 	}
@@ -468,6 +500,109 @@ iter_server_selection(struct iter_env* iter_env,
 	return a;
 }
 
+/** weight of a forwarder for the selection, the inverse of the square of
+ * its latency. The latency is made larger by the error score, and the
+ * penalties of the selection rtt make lame forwarders a last resort. */
+static uint64_t
+iter_fwd_weight(struct infra_lame_rtt* info, int sel_rtt, int blacklisted)
+{
+	uint64_t lat = (uint64_t)sel_rtt;
+	if(lat < FWD_LATENCY_MIN)
+		lat = FWD_LATENCY_MIN;
+	if(info->found)
+		lat = lat * (INFRA_ERR_SCALE + 3*info->err) / INFRA_ERR_SCALE;
+	if(blacklisted)
+		lat += BLACKLIST_PENALTY;
+	return (((uint64_t)1)<<40) / (lat*lat) + 1;
+}
+
+struct delegpt_addr*
+iter_fwd_server_selection(struct iter_env* iter_env,
+	struct module_env* env, struct delegpt* dp,
+	uint8_t* name, size_t namelen, uint16_t qtype, int* dnssec_lame,
+	int* chase_to_rd, int open_target, struct sock_list* blacklist)
+{
+	struct delegpt_addr* a, *prev, *batch[INFRA_BATCH_MAX];
+	struct infra_lame_rtt info[INFRA_BATCH_MAX];
+	uint64_t w[INFRA_BATCH_MAX], total = 0, sel;
+	size_t num = 0, i;
+	if(dp->bogus)
+		return NULL;
+	/* forward zones have few addresses, the first batch is enough */
+	for(a = dp->result_list; a && num < INFRA_BATCH_MAX;
+		a = a->next_result) {
+		if(!iter_addr_usable(iter_env, a))
+			continue;
+		info[num].addr = &a->addr;
+		info[num].addrlen = a->addrlen;
+		batch[num++] = a;
+	}
+	if(num == 0)
+		return NULL;
+	infra_get_lame_rtt_batch(env->infra_cache, env->infra_local, info,
+		num, name, namelen, qtype, *env->now);
+	for(i=0; i<num; i++) {
+		w[i] = 0;
+		batch[i]->sel_rtt = iter_filter_unsuitable(batch[i], &info[i]);
+		if(batch[i]->sel_rtt == -1)
+			continue;
+		if(info[i].found && info[i].ejected) {
+			log_addr(VERB_ALGO, "skip ejected forwarder",
+				&batch[i]->addr, batch[i]->addrlen);
+			continue;
+		}
+		w[i] = iter_fwd_weight(&info[i], batch[i]->sel_rtt,
+			sock_list_find(blacklist, &batch[i]->addr,
+			batch[i]->addrlen));
+		total += w[i];
+	}
+	if(total == 0) {
+		/* all forwarders are ejected, or unsuitable, use the
+		 * normal selection, a bad forwarder is better than none */
+		verbose(VERB_ALGO, "no healthy forwarder, select on rtt");
+		return iter_server_selection(iter_env, env, dp, name, namelen,
+			qtype, dnssec_lame, chase_to_rd, open_target,
+			blacklist);
+	}
+	/* scale down to the range of the random number */
+	while(total > 0x3fffffff) {
+		total = 0;
+		for(i=0; i<num; i++) {
+			if(w[i] == 0)
+				continue;
+			w[i] = (w[i] > 1)?w[i]/2:1;
+			total += w[i];
+		}
+	}
+	sel = (uint64_t)ub_random_max(env->rnd, (long int)total);
+	for(i=0; i<num; i++) {
+		if(sel < w[i])
+			break;
+		sel -= w[i];
+	}
+	if(i == num) /* robustness */
+		return NULL;
+	a = batch[i];
+	verbose(VERB_ALGO, "forwarder selrtt %d weight %u of %u", a->sel_rtt,
+		(unsigned)w[i], (unsigned)total);
+	if(a->sel_rtt > USEFUL_SERVER_TOP_TIMEOUT*2) {
+		verbose(VERB_ALGO, "chase to dnssec lame forwarder");
+		*dnssec_lame = 1;
+	}
+	if(++a->attempts < OUTBOUND_MSG_RETRY)
+		return a;
+	/* remove it from the delegation point result list */
+	prev = NULL;
+	for(a = dp->result_list; a && a != batch[i]; a = a->next_result)
+		prev = a;
+	if(!a) /* robustness */
+		return NULL;
+	if(prev)
+		prev->next_result = a->next_result;
+	else	dp->result_list = a->next_result;
+	return a;
+}
+
 struct dns_msg* 
 dns_alloc_msg(sldns_buffer* pkt, struct msg_parse* msg, 
 	struct regional* region)
@@ -95,6 +95,19 @@ struct delegpt_addr* iter_server_selection(struct iter_env* iter_env,
 	size_t namelen, uint16_t qtype, int* dnssec_lame,
 	int* chase_to_rd, int open_target, struct sock_list* blacklist);
 
+/**
+ * Select a forwarder to send the query to, for forward zones when the
+ * forwarders are health checked. Ejected forwarders are skipped, and a
+ * weighted random pick, on the inverse square of the latency and error
+ * score, sends most of the traffic to the fastest healthy forwarder.
+ * If no forwarder is healthy, iter_server_selection is used.
+ * Arguments and return value are like iter_server_selection.
+ */
+struct delegpt_addr* iter_fwd_server_selection(struct iter_env* iter_env,
+	struct module_env* env, struct delegpt* dp, uint8_t* name,
+	size_t namelen, uint16_t qtype, int* dnssec_lame,
+	int* chase_to_rd, int open_target, struct sock_list* blacklist);
+
 /**
  * Allocate dns_msg from parsed msg, in regional.
  * @param pkt: packet.
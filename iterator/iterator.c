@@ -106,6 +106,7 @@ iter_deinit(struct module_env* env, int id)
 	free(iter_env->target_fetch_policy);
 	priv_delete(iter_env->priv);
 	donotq_delete(iter_env->donotq);
+	name_index_delete(iter_env->caps_white_index);
 	if(iter_env->caps_white) {
 		traverse_postorder(iter_env->caps_white, caps_free, NULL);
 		free(iter_env->caps_white);
@@ -514,8 +515,11 @@ static int
 is_caps_whitelisted(struct iter_env* ie, struct iter_qstate* iq)
 {
 	if(!ie->caps_white) return 0; /* no whitelist, or no capsforid */
-	return name_tree_lookup(ie->caps_white, iq->qchase.qname,
-		iq->qchase.qname_len, dname_count_labels(iq->qchase.qname),
+	if(!ie->caps_white_index)
+		return name_tree_lookup(ie->caps_white, iq->qchase.qname,
+			iq->qchase.qname_len, dname_count_labels(
+			iq->qchase.qname), iq->qchase.qclass) != NULL;
+	return name_tree_lookup_index(ie->caps_white_index, iq->qchase.qname,
 		iq->qchase.qclass) != NULL;
 }
 
@@ -1926,7 +1930,12 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	delegpt_add_unused_targets(iq->dp);
 
 	/* Select the next usable target, filtering out unsuitable targets. */
-	target = iter_server_selection(ie, qstate->env, iq->dp, 
+	if(ie->fwd_health && (iq->chase_flags & BIT_RD))
+		target = iter_fwd_server_selection(ie, qstate->env, iq->dp,
+			iq->dp->name, iq->dp->namelen, iq->qchase.qtype,
+			&iq->dnssec_lame_query, &iq->chase_to_rd,
+			iq->num_target_queries, qstate->blacklist);
+	else	target = iter_server_selection(ie, qstate->env, iq->dp, 
 		iq->dp->name, iq->dp->namelen, iq->qchase.qtype,
 		&iq->dnssec_lame_query, &iq->chase_to_rd, 
 		iq->num_target_queries, qstate->blacklist);
@@ -2544,6 +2553,9 @@ processQueryResponse(struct module_qstate* qstate, struct iter_qstate* iq,
 				*qstate->env->now, dnsseclame, 0,
 				iq->qchase.qtype))
 				log_err("mark host lame: out of memory");
+			infra_local_invalidate(qstate->env->infra_local,
+				&qstate->reply->addr, qstate->reply->addrlen,
+				iq->dp->name, iq->dp->namelen);
 		}
 	} else if(type == RESPONSE_TYPE_REC_LAME) {
 		/* Cache the LAMEness. */
@@ -2561,6 +2573,9 @@ processQueryResponse(struct module_qstate* qstate, struct iter_qstate* iq,
 				iq->dp->name, iq->dp->namelen, 
 				*qstate->env->now, 0, 1, iq->qchase.qtype))
 				log_err("mark host lame: out of memory");
+			infra_local_invalidate(qstate->env->infra_local,
+				&qstate->reply->addr, qstate->reply->addrlen,
+				iq->dp->name, iq->dp->namelen);
 		} 
 	} else if(type == RESPONSE_TYPE_THROWAWAY) {
 		/* LAME and THROWAWAY responses are handled the same way. 
@@ -2568,6 +2583,22 @@ processQueryResponse(struct module_qstate* qstate, struct iter_qstate* iq,
 		 * the QUERYTARGETS_STATE without resetting anything, 
 		 * because, clearly, the next target must be tried. */
 		verbose(VERB_DETAIL, "query response was THROWAWAY");
+		if(qstate->env->cfg->fwd_health_check && qstate->reply &&
+			(iq->chase_flags&BIT_RD) &&
+			(FLAGS_GET_RCODE(iq->response->rep->flags) ==
+			LDNS_RCODE_SERVFAIL ||
+			FLAGS_GET_RCODE(iq->response->rep->flags) ==
+			LDNS_RCODE_REFUSED)) {
+			/* the forwarder failed, count it for its health */
+			if(!infra_server_error(qstate->env->infra_cache,
+				&qstate->reply->addr, qstate->reply->addrlen,
+				iq->dp->name, iq->dp->namelen,
+				*qstate->env->now))
+				log_err("mark forwarder error: out of memory");
+			infra_local_invalidate(qstate->env->infra_local,
+				&qstate->reply->addr, qstate->reply->addrlen,
+				iq->dp->name, iq->dp->namelen);
+		}
 	} else {
 		log_warn("A query response came back with an unknown type: %d",
 			(int)type);
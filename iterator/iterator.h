@@ -52,6 +52,7 @@ struct iter_donotq;
 struct iter_prep_list;
 struct iter_priv;
 struct rbtree_type;
+struct name_index;
 
 /** max number of targets spawned for a query and its subqueries */
 #define MAX_TARGET_COUNT	64
@@ -98,6 +99,10 @@ struct rbtree_type;
 /** Start value for blacklisting a host, 2*USEFUL_SERVER_TOP_TIMEOUT in sec */
 #define INFRA_BACKOFF_INITIAL 240
 
+/** smallest latency, in msec, for the weights of the forwarders, so that
+ * fast forwarders are not weighted far apart on noise */
+#define FWD_LATENCY_MIN 5
+
 /**
  * Global state for the iterator. 
  */
@@ -108,6 +113,9 @@ struct iter_env {
 	/** A flag to indicate whether or not we have an IPv4 route */
 	int supports_ipv4;
 
+	/** if the forwarders are selected on latency and health */
+	int fwd_health;
+
 	/** A set of inetaddrs that should never be queried. */
 	struct iter_donotq* donotq;
 
@@ -116,6 +124,8 @@ struct iter_env {
 
 	/** whitelist for capsforid names */
 	struct rbtree_type* caps_white;
+	/** sorted array index of the capsforid whitelist, for lookups */
+	struct name_index* caps_white_index;
 
 	/** The maximum dependency depth that this resolver will pursue. */
 	int max_dependency_depth;
@@ -1294,6 +1294,7 @@ int ub_ctx_zone_add(struct ub_ctx* ctx, const char *zone_name,
 		return UB_NOMEM;
 	}
 	lock_rw_unlock(&ctx->local_zones->lock);
+	local_zones_make_index(ctx->local_zones);
 	return UB_NOERROR;
 }
 
@@ -1319,6 +1320,7 @@ int ub_ctx_zone_remove(struct ub_ctx* ctx, const char *zone_name)
 		local_zones_del_zone(ctx->local_zones, z);
 	}
 	lock_rw_unlock(&ctx->local_zones->lock);
+	local_zones_make_index(ctx->local_zones);
 	free(nm);
 	return UB_NOERROR;
 }
@@ -1330,6 +1332,7 @@ int ub_ctx_data_add(struct ub_ctx* ctx, const char *data)
 	if (res) return res;
 
 	res = local_zones_add_RR(ctx->local_zones, data);
+	local_zones_make_index(ctx->local_zones);
 	return (!res) ? UB_NOMEM : UB_NOERROR;
 }
 
@@ -61,7 +61,7 @@
 #include "util/random.h"
 #include "util/config_file.h"
 #include "util/netevent.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/siphash.h"
 #include "util/storage/slabhash.h"
 #include "util/net_help.h"
 #include "util/data/dname.h"
@@ -201,8 +201,12 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct ub_event_base* eb)
 		 * in different threads that this may clash */
 		static int done_raninit = 0;
 		if(!done_raninit) {
+			uint8_t hashseed[SIPHASH_SEEDSIZE];
+			size_t i;
 			done_raninit = 1;
-			hash_set_raninit((uint32_t)ub_random(w->env->rnd));
+			for(i=0; i<SIPHASH_SEEDSIZE; i++)
+				hashseed[i] = (uint8_t)ub_random(w->env->rnd);
+			siphash_set_seed(hashseed);
 		}
 	}
 	seed = 0;
@@ -232,7 +236,7 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct ub_event_base* eb)
 		cfg->do_tcp?cfg->outgoing_num_tcp:0,
 		w->env->infra_cache, w->env->rnd, cfg->use_caps_bits_for_id,
 		ports, numports, cfg->unwanted_threshold,
-		cfg->outgoing_tcp_mss,
+		cfg->outgoing_tcp_mss, cfg->tcp_upstream_fastopen, NULL,
 		&libworker_alloc_cleanup, w, cfg->do_udp, w->sslctx,
 		cfg->delay_close, NULL);
 	if(!w->is_bg || w->is_bg_thread) {
@@ -243,6 +247,7 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct ub_event_base* eb)
 		libworker_delete(w);
 		return NULL;
 	}
+	w->env->infra_local = w->back->infra_local;
 	w->env->mesh = mesh_create(&ctx->mods, w->env);
 	if(!w->env->mesh) {
 		libworker_delete(w);
@@ -982,6 +987,11 @@ void worker_probe_timer_cb(void* ATTR_UNUSED(arg))
 	log_assert(0);
 }
 
+void worker_cache_pin_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void worker_start_accept(void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
@@ -157,6 +157,9 @@ void worker_stat_timer_cb(void* arg);
 /** probe timer callback handler */
 void worker_probe_timer_cb(void* arg);
 
+/** cache pin refresh timer callback handler */
+void worker_cache_pin_timer_cb(void* arg);
+
 /** start accept callback handler */
 void worker_start_accept(void* arg);
 
@@ -43,6 +43,7 @@
 #include "validator/val_nsec.h"
 #include "services/cache/dns.h"
 #include "services/cache/rrset.h"
+#include "services/cache/peer.h"
 #include "util/data/msgreply.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
@@ -65,8 +66,10 @@
  * 	in a prefetch situation to be updated (without becoming sticky).
  * @param qrep: update rrsets here if cache is better
  * @param region: for qrep allocs.
+ * @return false on malloc failure, the rrsets that are not stored in the
+ * 	cache are then deleted, and rep must not be used.
  */
-static void
+static int
 store_rrsets(struct module_env* env, struct reply_info* rep, time_t now,
 	time_t leeway, int pside, struct reply_info* qrep,
 	struct regional* region)
@@ -77,9 +80,15 @@ store_rrsets(struct module_env* env, struct reply_info* rep, time_t now,
                 rep->ref[i].key = rep->rrsets[i];
                 rep->ref[i].id = rep->rrsets[i]->id;
 		/* update ref if it was in the cache */ 
-		switch(rrset_cache_update(env->rrset_cache, &rep->ref[i],
+		switch(rrset_cache_update_quota(env->rrset_cache, &rep->ref[i],
                         env->alloc, now + ((ntohs(rep->ref[i].key->rk.type)==
-			LDNS_RR_TYPE_NS && !pside)?0:leeway))) {
+			LDNS_RR_TYPE_NS && !pside)?0:leeway),
+			env->cache_quota_id)) {
+		case -1: /* malloc failure, not stored */
+			for(; i<rep->rrset_count; i++)
+				ub_packed_rrset_parsedelete(rep->rrsets[i],
+					env->alloc);
+			return 0;
 		case 0: /* ref unchanged, item inserted */
 			break;
 		case 2: /* ref updated, cache is superior */
@@ -102,6 +111,7 @@ store_rrsets(struct module_env* env, struct reply_info* rep, time_t now,
                         rep->rrsets[i] = rep->ref[i].key;
 		}
         }
+	return 1;
 }
 
 void 
@@ -122,7 +132,10 @@ dns_cache_store_msg(struct module_env* env, struct query_info* qinfo,
 	/* there was a reply_info_sortref(rep) here but it seems to be
 	 * unnecessary, because the cache gets locked per rrset. */
 	reply_info_set_ttls(rep, *env->now);
-	store_rrsets(env, rep, *env->now, leeway, pside, qrep, region);
+	if(!store_rrsets(env, rep, *env->now, leeway, pside, qrep, region)) {
+		free(rep);
+		return;
+	}
 	if(ttl == 0) {
 		/* we do not store the message, but we did store the RRs,
 		 * which could be useful for delegation information */
@@ -137,7 +150,8 @@ dns_cache_store_msg(struct module_env* env, struct query_info* qinfo,
 		log_err("store_msg: malloc failed");
 		return;
 	}
-	slabhash_insert(env->msg_cache, hash, &e->entry, rep, env->alloc);
+	slabhash_insert_quota(env->msg_cache, hash, &e->entry, rep, env->alloc,
+		env->cache_quota_id);
 }
 
 /** find closest NS or DNAME and returns the rrset (locked) */
@@ -196,7 +210,7 @@ msg_cache_lookup(struct module_env* env, uint8_t* qname, size_t qnamelen,
 	k.qclass = qclass;
 	k.local_alias = NULL;
 	h = query_info_hash(&k, flags);
-	e = slabhash_lookup(env->msg_cache, h, &k, wr);
+	e = msgreply_lookup(env->msg_cache, h, &k, wr);
 
 	if(!e) return NULL;
 	if( now > ((struct reply_info*)e->data)->ttl ) {
@@ -719,7 +733,7 @@ dns_cache_lookup(struct module_env* env,
 	k.qclass = qclass;
 	k.local_alias = NULL;
 	h = query_info_hash(&k, flags);
-	e = slabhash_lookup(env->msg_cache, h, &k, 0);
+	e = msgreply_lookup(env->msg_cache, h, &k, 0);
 	if(e) {
 		struct msgreply_entry* key = (struct msgreply_entry*)e->key;
 		struct reply_info* data = (struct reply_info*)e->data;
@@ -796,12 +810,12 @@ dns_cache_lookup(struct module_env* env,
 	    while(!dname_is_root(k.qname)) {
 		dname_remove_label(&k.qname, &k.qname_len);
 		h = query_info_hash(&k, flags);
-		e = slabhash_lookup(env->msg_cache, h, &k, 0);
+		e = msgreply_lookup(env->msg_cache, h, &k, 0);
 		if(!e && k.qtype != LDNS_RR_TYPE_A &&
 			env->cfg->qname_minimisation) {
 			k.qtype = LDNS_RR_TYPE_A;
 			h = query_info_hash(&k, flags);
-			e = slabhash_lookup(env->msg_cache, h, &k, 0);
+			e = msgreply_lookup(env->msg_cache, h, &k, 0);
 		}
 		if(e) {
 			struct reply_info* data = (struct reply_info*)e->data;
@@ -866,6 +880,10 @@ dns_cache_store(struct module_env* env, struct query_info* msgqinf,
 		struct query_info qinf;
 		hashvalue_type h;
 
+		/* send it to the cluster peers, with the relative TTLs */
+		if(env->cache_peers)
+			cache_peers_export(env->cache_peers, msgqinf, msgrep,
+				flags);
 		qinf = *msgqinf;
 		qinf.qname = memdup(msgqinf->qname, msgqinf->qname_len);
 		if(!qinf.qname) {
@@ -43,7 +43,7 @@
 #include "sldns/str2wire.h"
 #include "services/cache/infra.h"
 #include "util/storage/slabhash.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/siphash.h"
 #include "util/data/dname.h"
 #include "util/log.h"
 #include "util/net_help.h"
@@ -73,8 +73,9 @@ infra_sizefunc(void* k, void* ATTR_UNUSED(d))
 		+ lock_get_mem(&key->entry.lock);
 }
 
-int 
-infra_compfunc(void* key1, void* key2)
+/** compare infra keys, inlined in the infra host lookup */
+static inline int
+infra_key_cmp(void* key1, void* key2)
 {
 	struct infra_key* k1 = (struct infra_key*)key1;
 	struct infra_key* k2 = (struct infra_key*)key2;
@@ -89,6 +90,14 @@ infra_compfunc(void* key1, void* key2)
 	return query_dname_compare(k1->zonename, k2->zonename);
 }
 
+int 
+infra_compfunc(void* key1, void* key2)
+{
+	return infra_key_cmp(key1, key2);
+}
+
+SLABHASH_LOOKUP_FUNC(infra_hash_lookup, infra_compfunc, infra_key_cmp)
+
 void 
 infra_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
 {
@@ -304,24 +313,26 @@ static hashvalue_type
 hash_addr(struct sockaddr_storage* addr, socklen_t addrlen,
   int use_port)
 {
-	hashvalue_type h = 0xab;
+	struct siphash_state s;
 	/* select the pieces to hash, some OS have changing data inside */
+	siphash_init(&s, 0xab);
 	if(addr_is_ip6(addr, addrlen)) {
 		struct sockaddr_in6* in6 = (struct sockaddr_in6*)addr;
-		h = hashlittle(&in6->sin6_family, sizeof(in6->sin6_family), h);
+		siphash_update(&s, &in6->sin6_family, sizeof(in6->sin6_family));
 		if(use_port){
-			h = hashlittle(&in6->sin6_port, sizeof(in6->sin6_port), h);
+			siphash_update(&s, &in6->sin6_port,
+				sizeof(in6->sin6_port));
 		}
-		h = hashlittle(&in6->sin6_addr, INET6_SIZE, h);
+		siphash_update(&s, &in6->sin6_addr, INET6_SIZE);
 	} else {
 		struct sockaddr_in* in = (struct sockaddr_in*)addr;
-		h = hashlittle(&in->sin_family, sizeof(in->sin_family), h);
+		siphash_update(&s, &in->sin_family, sizeof(in->sin_family));
 		if(use_port){
-			h = hashlittle(&in->sin_port, sizeof(in->sin_port), h);
+			siphash_update(&s, &in->sin_port, sizeof(in->sin_port));
 		}
-		h = hashlittle(&in->sin_addr, INET_SIZE, h);
+		siphash_update(&s, &in->sin_addr, INET_SIZE);
 	}
-	return h;
+	return siphash_final(&s);
 }
 
 /** calculate infra hash for a key */
@@ -344,7 +355,7 @@ infra_lookup_nottl(struct infra_cache* infra, struct sockaddr_storage* addr,
 	k.entry.hash = hash_infra(addr, addrlen, name);
 	k.entry.key = (void*)&k;
 	k.entry.data = NULL;
-	return slabhash_lookup(infra->hosts, k.entry.hash, &k, wr);
+	return infra_hash_lookup(infra->hosts, k.entry.hash, &k, wr);
 }
 
 /** init the data elements */
@@ -365,6 +376,25 @@ data_entry_init(struct infra_cache* infra, struct lruhash_entry* e,
 	data->timeout_A = 0;
 	data->timeout_AAAA = 0;
 	data->timeout_other = 0;
+	data->udp_size = 0;
+	data->udp_size_tc = 0;
+	data->cookie_len = 0;
+	data->err_score = 0;
+	data->eject_until = 0;
+}
+
+/** update the error score of the host with a failure or a success,
+ * a moving average with weight 1/4 for the new sample */
+static void
+infra_health_sample(struct infra_data* data, int fail, time_t timenow)
+{
+	if(!fail) {
+		data->err_score -= data->err_score/4;
+		return;
+	}
+	data->err_score += (INFRA_ERR_SCALE - data->err_score + 3)/4;
+	if(data->err_score > INFRA_EJECT_SCORE && data->eject_until <= timenow)
+		data->eject_until = timenow + INFRA_EJECT_TIME;
 }
 
 /** 
@@ -532,6 +562,69 @@ infra_update_tcp_works(struct infra_cache* infra,
 	lock_rw_unlock(&e->lock);
 }
 
+int
+infra_server_error(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* nm,
+	size_t nmlen, time_t timenow)
+{
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
+		nm, nmlen, 1);
+	int needtoinsert = 0;
+	if(!e) {
+		if(!(e = new_entry(infra, addr, addrlen, nm, nmlen, timenow)))
+			return 0;
+		needtoinsert = 1;
+	} else if(((struct infra_data*)e->data)->ttl < timenow) {
+		data_entry_init(infra, e, timenow);
+	}
+	infra_health_sample((struct infra_data*)e->data, 1, timenow);
+	if(needtoinsert)
+		slabhash_insert(infra->hosts, e->hash, e, e->data, NULL);
+	else 	{ lock_rw_unlock(&e->lock); }
+	return 1;
+}
+
+int
+infra_readmit(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* nm,
+	size_t nmlen, time_t timenow)
+{
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
+		nm, nmlen, 1);
+	struct infra_data* data;
+	int readmit = 0;
+	if(!e)
+		return 0;
+	data = (struct infra_data*)e->data;
+	if(data->eject_until > timenow) {
+		data->eject_until = 0;
+		if(data->err_score > INFRA_READMIT_SCORE)
+			data->err_score = INFRA_READMIT_SCORE;
+		readmit = 1;
+	}
+	lock_rw_unlock(&e->lock);
+	return readmit;
+}
+
+int
+infra_get_health(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* nm,
+	size_t nmlen, time_t timenow, int* srtt, int* err, int* ejected)
+{
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
+		nm, nmlen, 0);
+	struct infra_data* data;
+	if(!e)
+		return 0;
+	data = (struct infra_data*)e->data;
+	*srtt = data->rtt.srtt;
+	*err = (int)data->err_score;
+	*ejected = (data->eject_until > timenow)?
+		(int)(data->eject_until - timenow):0;
+	lock_rw_unlock(&e->lock);
+	return 1;
+}
+
 int 
 infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	socklen_t addrlen, uint8_t* nm, size_t nmlen, int qtype,
@@ -563,6 +656,7 @@ infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 			if(data->timeout_other < TIMEOUT_COUNT_MAX)
 				data->timeout_other++;
 		}
+		infra_health_sample(data, 1, timenow);
 	} else {
 		/* if we got a reply, but the old timeout was above server
 		 * selection height, delete the timeout so the server is
@@ -576,6 +670,7 @@ infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 		else if(qtype == LDNS_RR_TYPE_AAAA)
 			data->timeout_AAAA = 0;
 		else	data->timeout_other = 0;
+		infra_health_sample(data, 0, timenow);
 	}
 	if(data->rtt.rto > 0)
 		rto = data->rtt.rto;
@@ -642,18 +737,121 @@ infra_edns_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	return 1;
 }
 
+uint16_t
+infra_udp_size(struct infra_cache* infra, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint8_t* nm, size_t nmlen, time_t timenow)
+{
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
+		nm, nmlen, 0);
+	uint16_t udp_size = 0;
+	if(!e)
+		return 0;
+	if(((struct infra_data*)e->data)->ttl >= timenow)
+		udp_size = ((struct infra_data*)e->data)->udp_size;
+	lock_rw_unlock(&e->lock);
+	return udp_size;
+}
+
 int
-infra_get_lame_rtt(struct infra_cache* infra,
-        struct sockaddr_storage* addr, socklen_t addrlen,
-        uint8_t* name, size_t namelen, uint16_t qtype, 
-	int* lame, int* dnsseclame, int* reclame, int* rtt, time_t timenow)
+infra_udp_size_update(struct infra_cache* infra,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* nm,
+	size_t nmlen, uint16_t udp_size, time_t timenow)
 {
-	struct infra_data* host;
 	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
-		name, namelen, 0);
-	if(!e) 
+		nm, nmlen, 1);
+	struct infra_data* data;
+	int needtoinsert = 0;
+	if(!e) {
+		if(!(e = new_entry(infra, addr, addrlen, nm, nmlen, timenow)))
+			return 0;
+		needtoinsert = 1;
+	} else if(((struct infra_data*)e->data)->ttl < timenow) {
+		data_entry_init(infra, e, timenow);
+	}
+	data = (struct infra_data*)e->data;
+	data->udp_size = udp_size;
+	data->udp_size_tc = 0;
+
+	if(needtoinsert)
+		slabhash_insert(infra->hosts, e->hash, e, e->data, NULL);
+	else 	{ lock_rw_unlock(&e->lock); }
+	return 1;
+}
+
+void
+infra_udp_size_tc(struct infra_cache* infra, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint8_t* nm, size_t nmlen, time_t timenow)
+{
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
+		nm, nmlen, 1);
+	struct infra_data* data;
+	if(!e)
+		return;
+	data = (struct infra_data*)e->data;
+	if(data->ttl >= timenow && data->udp_size != 0) {
+		if(++data->udp_size_tc >= INFRA_UDP_SIZE_TC_MAX) {
+			/* probe the full size again */
+			data->udp_size = 0;
+			data->udp_size_tc = 0;
+		}
+	}
+	lock_rw_unlock(&e->lock);
+}
+
+size_t
+infra_cookie(struct infra_cache* infra, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint8_t* nm, size_t nmlen, time_t timenow,
+	uint8_t* cookie)
+{
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
+		nm, nmlen, 0);
+	struct infra_data* data;
+	size_t len = 0;
+	if(!e)
+		return 0;
+	data = (struct infra_data*)e->data;
+	if(data->ttl >= timenow) {
+		len = (size_t)data->cookie_len;
+		memmove(cookie, data->cookie, len);
+	}
+	lock_rw_unlock(&e->lock);
+	return len;
+}
+
+int
+infra_cookie_update(struct infra_cache* infra,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* nm,
+	size_t nmlen, uint8_t* cookie, size_t len, time_t timenow)
+{
+	struct lruhash_entry* e;
+	struct infra_data* data;
+	int needtoinsert = 0;
+	if(len > EDNS_COOKIE_SERVER_MAX)
 		return 0;
-	host = (struct infra_data*)e->data;
+	e = infra_lookup_nottl(infra, addr, addrlen, nm, nmlen, 1);
+	if(!e) {
+		if(!(e = new_entry(infra, addr, addrlen, nm, nmlen, timenow)))
+			return 0;
+		needtoinsert = 1;
+	} else if(((struct infra_data*)e->data)->ttl < timenow) {
+		data_entry_init(infra, e, timenow);
+	}
+	data = (struct infra_data*)e->data;
+	memmove(data->cookie, cookie, len);
+	data->cookie_len = (uint8_t)len;
+
+	if(needtoinsert)
+		slabhash_insert(infra->hosts, e->hash, e, e->data, NULL);
+	else 	{ lock_rw_unlock(&e->lock); }
+	return 1;
+}
+
+/** lameness and rtt from the host data, like infra_get_lame_rtt.
+ * returns 0 if the data is expired and of no use. */
+static int
+infra_lame_rtt_data(struct infra_data* host, uint16_t qtype,
+	int* lame, int* dnsseclame, int* reclame, int* rtt, time_t timenow)
+{
 	*rtt = rtt_unclamped(&host->rtt);
 	if(host->rtt.rto >= PROBE_MAXRTO && timenow < host->probedelay
 		&& rtt_notimeout(&host->rtt)*4 <= host->rtt.rto) {
@@ -679,50 +877,198 @@ infra_get_lame_rtt(struct infra_cache* infra,
 		/* minus 1000 because that is outside of the RTTBAND, so
 		 * blacklisted servers stay blacklisted if this is chosen */
 		if(host->rtt.rto >= USEFUL_SERVER_TOP_TIMEOUT) {
-			lock_rw_unlock(&e->lock);
 			*rtt = USEFUL_SERVER_TOP_TIMEOUT-1000;
 			*lame = 0;
 			*dnsseclame = 0;
 			*reclame = 0;
 			return 1;
 		}
-		lock_rw_unlock(&e->lock);
 		return 0;
 	}
 	/* check lameness first */
 	if(host->lame_type_A && qtype == LDNS_RR_TYPE_A) {
-		lock_rw_unlock(&e->lock);
 		*lame = 1;
 		*dnsseclame = 0;
 		*reclame = 0;
 		return 1;
 	} else if(host->lame_other && qtype != LDNS_RR_TYPE_A) {
-		lock_rw_unlock(&e->lock);
 		*lame = 1;
 		*dnsseclame = 0;
 		*reclame = 0;
 		return 1;
 	} else if(host->isdnsseclame) {
-		lock_rw_unlock(&e->lock);
 		*lame = 0;
 		*dnsseclame = 1;
 		*reclame = 0;
 		return 1;
 	} else if(host->rec_lame) {
-		lock_rw_unlock(&e->lock);
 		*lame = 0;
 		*dnsseclame = 0;
 		*reclame = 1;
 		return 1;
 	}
 	/* no lameness for this type of query */
-	lock_rw_unlock(&e->lock);
 	*lame = 0;
 	*dnsseclame = 0;
 	*reclame = 0;
 	return 1;
 }
 
+int
+infra_get_lame_rtt(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+        uint8_t* name, size_t namelen, uint16_t qtype, 
+	int* lame, int* dnsseclame, int* reclame, int* rtt, time_t timenow)
+{
+	int r;
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
+		name, namelen, 0);
+	if(!e) 
+		return 0;
+	r = infra_lame_rtt_data((struct infra_data*)e->data, qtype, lame,
+		dnsseclame, reclame, rtt, timenow);
+	lock_rw_unlock(&e->lock);
+	return r;
+}
+
+struct infra_local*
+infra_local_create(void)
+{
+	return (struct infra_local*)calloc(1, sizeof(struct infra_local));
+}
+
+void
+infra_local_delete(struct infra_local* local)
+{
+	free(local);
+}
+
+/** health of the host for the server selection */
+static void
+infra_health_data(struct infra_data* host, struct infra_lame_rtt* r,
+	time_t timenow)
+{
+	r->err = (int)host->err_score;
+	r->ejected = (host->eject_until > timenow);
+}
+
+/** see if the snapshot is for the host */
+static int
+infra_local_match(struct infra_local_entry* l, hashvalue_type h,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
+	size_t namelen)
+{
+	return l->hash == h && l->addrlen == addrlen &&
+		l->namelen == namelen &&
+		sockaddr_cmp(&l->addr, l->addrlen, addr, addrlen) == 0 &&
+		query_dname_compare(l->zonename, name) == 0;
+}
+
+void
+infra_local_invalidate(struct infra_local* local,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
+	size_t namelen)
+{
+	hashvalue_type h;
+	struct infra_local_entry* l;
+	if(!local)
+		return;
+	h = hash_infra(addr, addrlen, name);
+	l = &local->entries[h % INFRA_LOCAL_SIZE];
+	if(infra_local_match(l, h, addr, addrlen, name, namelen))
+		l->hash = 0;
+}
+
+/** store a snapshot of the host, data is NULL if not found */
+static void
+infra_local_store(struct infra_local* local, hashvalue_type h,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
+	size_t namelen, struct infra_data* data, time_t timenow)
+{
+	struct infra_local_entry* l = &local->entries[h % INFRA_LOCAL_SIZE];
+	if(h == 0 || namelen > sizeof(l->zonename))
+		return;
+	l->hash = h;
+	l->stamp = timenow;
+	memmove(&l->addr, addr, addrlen);
+	l->addrlen = addrlen;
+	memmove(l->zonename, name, namelen);
+	l->namelen = namelen;
+	l->found = (data != NULL);
+	if(data)
+		l->data = *data;
+}
+
+void
+infra_get_lame_rtt_batch(struct infra_cache* infra,
+	struct infra_local* local, struct infra_lame_rtt* list, size_t num,
+	uint8_t* name, size_t namelen, uint16_t qtype, time_t timenow)
+{
+	struct infra_key keys[INFRA_BATCH_MAX];
+	hashvalue_type hashes[INFRA_BATCH_MAX];
+	void* keyp[INFRA_BATCH_MAX];
+	struct lruhash_entry* found[INFRA_BATCH_MAX];
+	size_t idx[INFRA_BATCH_MAX], miss = 0, i;
+	struct infra_local_entry* l;
+	struct infra_data* d;
+	hashvalue_type h;
+	log_assert(num <= INFRA_BATCH_MAX);
+	for(i=0; i<num; i++) {
+		struct infra_lame_rtt* r = &list[i];
+		h = hash_infra(r->addr, r->addrlen, name);
+		if(local) {
+			l = &local->entries[h % INFRA_LOCAL_SIZE];
+			if(timenow >= l->stamp && timenow < l->stamp +
+				INFRA_LOCAL_TTL && infra_local_match(l, h,
+				r->addr, r->addrlen, name, namelen)) {
+				local->hits++;
+				r->found = l->found && infra_lame_rtt_data(
+					&l->data, qtype, &r->lame,
+					&r->dnsseclame, &r->reclame, &r->rtt,
+					timenow);
+				if(r->found)
+					infra_health_data(&l->data, r,
+						timenow);
+				continue;
+			}
+			local->misses++;
+		}
+		keys[miss].addrlen = r->addrlen;
+		memcpy(&keys[miss].addr, r->addr, r->addrlen);
+		keys[miss].namelen = namelen;
+		keys[miss].zonename = name;
+		keys[miss].entry.hash = h;
+		keys[miss].entry.key = (void*)&keys[miss];
+		keys[miss].entry.data = NULL;
+		hashes[miss] = h;
+		keyp[miss] = &keys[miss];
+		idx[miss++] = i;
+	}
+	if(miss == 0)
+		return;
+	slabhash_lookup_batch(infra->hosts, hashes, keyp, miss, 0, found);
+	for(i=0; i<miss; i++) {
+		struct infra_lame_rtt* r = &list[idx[i]];
+		if(!found[i]) {
+			r->found = 0;
+			if(local)
+				infra_local_store(local, hashes[i], r->addr,
+					r->addrlen, name, namelen, NULL,
+					timenow);
+			continue;
+		}
+		d = (struct infra_data*)found[i]->data;
+		r->found = infra_lame_rtt_data(d, qtype, &r->lame,
+			&r->dnsseclame, &r->reclame, &r->rtt, timenow);
+		if(r->found)
+			infra_health_data(d, r, timenow);
+		if(local)
+			infra_local_store(local, hashes[i], r->addr,
+				r->addrlen, name, namelen, d, timenow);
+		lock_rw_unlock(&found[i]->lock);
+	}
+}
+
 int infra_find_ratelimit(struct infra_cache* infra, uint8_t* name,
 	size_t namelen)
 {
@@ -45,10 +45,13 @@
 #ifndef SERVICES_CACHE_INFRA_H
 #define SERVICES_CACHE_INFRA_H
 #include "util/storage/lruhash.h"
+#include "util/storage/slabhash.h"
+#include "sldns/rrdef.h"
 #include "util/storage/dnstree.h"
 #include "util/rtt.h"
 #include "util/netevent.h"
 #include "util/data/msgreply.h"
+#include "util/edns.h"
 struct slabhash;
 struct config_file;
 
@@ -104,6 +107,23 @@ struct infra_data {
 	uint8_t timeout_AAAA;
 	/** timeouts counter for others */
 	uint8_t timeout_other;
+
+	/** EDNS UDP payload size that works for the host, learned when
+	 * large responses time out and the fragmentation size works.
+	 * 0 if not known, the advertised size is used. */
+	uint16_t udp_size;
+	/** number of truncated replies with the reduced udp_size */
+	uint8_t udp_size_tc;
+	/** length of the DNS server cookie of the host, 0 if none */
+	uint8_t cookie_len;
+	/** the server cookie that the host gave to us */
+	uint8_t cookie[EDNS_COOKIE_SERVER_MAX];
+	/** error score, moving average of timeouts and server failures,
+	 * in 1/INFRA_ERR_SCALE */
+	uint16_t err_score;
+	/** time in seconds (absolute) until which the host is ejected
+	 * from the forwarder selection, 0 if not ejected */
+	time_t eject_until;
 };
 
 /**
@@ -122,6 +142,90 @@ struct infra_cache {
 	struct slabhash* client_ip_rates;
 };
 
+/** number of truncated replies with the reduced EDNS size, after which
+ * the full advertised size is probed again */
+#define INFRA_UDP_SIZE_TC_MAX 8
+
+/** scale of the error score of a host */
+#define INFRA_ERR_SCALE 1000
+/** a host with an error score above this is ejected */
+#define INFRA_EJECT_SCORE 500
+/** error score that a readmitted host starts with */
+#define INFRA_READMIT_SCORE 250
+/** seconds that an ejected host stays out, unless it is readmitted */
+#define INFRA_EJECT_TIME 60
+
+/** number of entries in the per thread infra snapshot cache */
+#define INFRA_LOCAL_SIZE 64
+/** seconds that a snapshot in the per thread cache is used */
+#define INFRA_LOCAL_TTL 1
+/** max number of hosts for infra_get_lame_rtt_batch */
+#define INFRA_BATCH_MAX SLABHASH_BATCH_MAX
+
+/**
+ * Snapshot of the host information, in the per thread cache.
+ */
+struct infra_local_entry {
+	/** hash of the key, 0 if the entry is not in use */
+	hashvalue_type hash;
+	/** when the snapshot was taken */
+	time_t stamp;
+	/** the host address */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** length of zonename */
+	size_t namelen;
+	/** zone name in wireformat */
+	uint8_t zonename[LDNS_MAX_DOMAINLEN+1];
+	/** if the host was in the infra cache, and data is valid */
+	int found;
+	/** copy of the host information */
+	struct infra_data data;
+};
+
+/**
+ * Per thread cache of recent infra host lookups for server selection.
+ * The snapshots are used for INFRA_LOCAL_TTL, and the thread removes
+ * the snapshot of a host when it updates that host in the infra cache,
+ * when it sends a query to the host and in the reply callbacks that update
+ * the rtt and EDNS status.  Updates by other threads are seen when the
+ * snapshot times out, so a snapshot can be up to INFRA_LOCAL_TTL (one
+ * second) stale for those.
+ */
+struct infra_local {
+	/** direct mapped on the hash */
+	struct infra_local_entry entries[INFRA_LOCAL_SIZE];
+	/** number of lookups answered from the snapshots */
+	size_t hits;
+	/** number of lookups in the infra cache */
+	size_t misses;
+};
+
+/**
+ * Host to look up with infra_get_lame_rtt_batch, and the result.
+ */
+struct infra_lame_rtt {
+	/** the host address */
+	struct sockaddr_storage* addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** result: if found in cache, and the TTL is fine */
+	int found;
+	/** result: if found, lameness of the zone */
+	int lame;
+	/** result: if found, if the zone is dnssec-lame */
+	int dnsseclame;
+	/** result: if found, if it is recursion lame */
+	int reclame;
+	/** result: if found, average rtt of the server, unclamped */
+	int rtt;
+	/** result: if found, error score of the server */
+	int err;
+	/** result: if found, if the server is ejected */
+	int ejected;
+};
+
 /** ratelimit, unless overridden by domain_limits, 0 is off */
 extern int infra_dp_ratelimit;
 
@@ -300,6 +404,54 @@ void infra_update_tcp_works(struct infra_cache* infra,
         struct sockaddr_storage* addr, socklen_t addrlen,
 	uint8_t* name, size_t namelen);
 
+/**
+ * Note a server failure of the host, a SERVFAIL or REFUSED answer from
+ * a forwarder. It raises the error score like a timeout does, and a
+ * host with a high error score is ejected from the forwarder selection.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: zone name.
+ * @param namelen: zone name length.
+ * @param timenow: what time it is now.
+ * @return: 0 on error.
+ */
+int infra_server_error(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	uint8_t* name, size_t namelen, time_t timenow);
+
+/**
+ * Readmit the host, after a health probe got a good answer from it.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: zone name.
+ * @param namelen: zone name length.
+ * @param timenow: what time it is now.
+ * @return: true if the host was ejected and is readmitted.
+ */
+int infra_readmit(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	uint8_t* name, size_t namelen, time_t timenow);
+
+/**
+ * Get the health of the host, for printout.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: zone name.
+ * @param namelen: zone name length.
+ * @param timenow: what time it is now.
+ * @param srtt: returns the smoothed rtt in msec.
+ * @param err: returns the error score, in 1/INFRA_ERR_SCALE.
+ * @param ejected: returns seconds that the host stays ejected, 0 if not.
+ * @return: 0 if the host is not in the cache.
+ */
+int infra_get_health(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	uint8_t* name, size_t namelen, time_t timenow, int* srtt, int* err,
+	int* ejected);
+
 /**
  * Update edns information for the host.
  * @param infra: infrastructure cache.
@@ -316,6 +468,83 @@ int infra_edns_update(struct infra_cache* infra,
         struct sockaddr_storage* addr, socklen_t addrlen,
 	uint8_t* name, size_t namelen, int edns_version, time_t timenow);
 
+/**
+ * Get the EDNS UDP payload size that works for the host.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: zone name.
+ * @param namelen: zone name length.
+ * @param timenow: what time it is now.
+ * @return the size, or 0 if not known (use the advertised size).
+ */
+uint16_t infra_udp_size(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	uint8_t* name, size_t namelen, time_t timenow);
+
+/**
+ * Update the EDNS UDP payload size for the host, after a query with
+ * that size got an answer when the larger size timed out.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: zone name.
+ * @param namelen: zone name length.
+ * @param udp_size: the size that works.
+ * @param timenow: what time it is now.
+ * @return: 0 on error.
+ */
+int infra_udp_size_update(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	uint8_t* name, size_t namelen, uint16_t udp_size, time_t timenow);
+
+/**
+ * Note a truncated reply to a query with the reduced EDNS UDP size.
+ * After INFRA_UDP_SIZE_TC_MAX of them the size is forgotten, and the
+ * full size is tried again, because the TCP fallbacks cost more.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: zone name.
+ * @param namelen: zone name length.
+ * @param timenow: what time it is now.
+ */
+void infra_udp_size_tc(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	uint8_t* name, size_t namelen, time_t timenow);
+
+/**
+ * Get the DNS server cookie that the host gave to us.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: zone name.
+ * @param namelen: zone name length.
+ * @param timenow: what time it is now.
+ * @param cookie: EDNS_COOKIE_SERVER_MAX bytes for the cookie.
+ * @return the length of the cookie, 0 if not known.
+ */
+size_t infra_cookie(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	uint8_t* name, size_t namelen, time_t timenow, uint8_t* cookie);
+
+/**
+ * Store the DNS server cookie of the host, from a reply.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: zone name.
+ * @param namelen: zone name length.
+ * @param cookie: the server cookie.
+ * @param len: length of the cookie, at most EDNS_COOKIE_SERVER_MAX.
+ * @param timenow: what time it is now.
+ * @return: 0 on error.
+ */
+int infra_cookie_update(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	uint8_t* name, size_t namelen, uint8_t* cookie, size_t len,
+	time_t timenow);
+
 /**
  * Get Lameness information and average RTT if host is in the cache.
  * This information is to be used for server selection.
@@ -339,6 +568,49 @@ int infra_get_lame_rtt(struct infra_cache* infra,
 	uint8_t* name, size_t namelen, uint16_t qtype, 
 	int* lame, int* dnsseclame, int* reclame, int* rtt, time_t timenow);
 
+/**
+ * Get Lameness information and average RTT for the hosts of a delegation,
+ * like infra_get_lame_rtt for each of them.  The snapshots in the per
+ * thread cache are used if fresh, the others are looked up in one go,
+ * that takes the lock of a slab of the infra cache once.
+ * @param infra: infrastructure cache.
+ * @param local: per thread cache, or NULL.
+ * @param list: hosts to look up, the results are filled in.
+ * @param num: number of hosts, at most INFRA_BATCH_MAX.
+ * @param name: zone name.
+ * @param namelen: zone name length.
+ * @param qtype: the query to be made.
+ * @param timenow: what time it is now.
+ */
+void infra_get_lame_rtt_batch(struct infra_cache* infra,
+	struct infra_local* local, struct infra_lame_rtt* list, size_t num,
+	uint8_t* name, size_t namelen, uint16_t qtype, time_t timenow);
+
+/**
+ * Create the per thread cache of host snapshots.
+ * @return new cache or NULL on malloc failure.
+ */
+struct infra_local* infra_local_create(void);
+
+/**
+ * Delete the per thread cache of host snapshots.
+ * @param local: to delete.
+ */
+void infra_local_delete(struct infra_local* local);
+
+/**
+ * Remove the snapshot of a host, call it when the host is updated
+ * in the infra cache.
+ * @param local: per thread cache, or NULL.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: zone name.
+ * @param namelen: zone name length.
+ */
+void infra_local_invalidate(struct infra_local* local,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
+	size_t namelen);
+
 /**
  * Get additional (debug) info on timing.
  * @param infra: infra cache.
@@ -429,6 +701,18 @@ size_t infra_sizefunc(void* k, void* d);
 /** compare two addresses, returns -1, 0, or +1 */
 int infra_compfunc(void* key1, void* key2);
 
+/**
+ * Lookup an entry in the infra host cache, like slabhash_lookup, with the
+ * compare function inlined.
+ * @param table: the infra hosts hashtable.
+ * @param hash: hash of key.
+ * @param key: what to look for.
+ * @param wr: set to true if you desire a writelock on the entry.
+ * @return: pointer to the entry or NULL. The entry is locked.
+ */
+struct lruhash_entry* infra_hash_lookup(struct slabhash* table, hashvalue_type hash,
+	void* key, int wr);
+
 /** delete key, and destroy the lock */
 void infra_delkeyfunc(void* k, void* arg);
 
@@ -0,0 +1,236 @@
+/*
+ * services/cache/intern.c - interned owner names for the rrset cache.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the table of interned owner names.
+ */
+#include "config.h"
+#include "services/cache/intern.h"
+#include "util/storage/siphash.h"
+#include "util/log.h"
+
+/** the name bytes of a node */
+#define NODE_NAME(n) ((uint8_t*)((n)+1))
+
+struct name_intern*
+name_intern_create(size_t num)
+{
+	size_t i;
+	struct name_intern* t = (struct name_intern*)calloc(1, sizeof(*t));
+	if(!t)
+		return NULL;
+	log_assert(num > 0 && (num & (num-1)) == 0);
+	t->num = num;
+	t->stripes = (struct name_intern_stripe*)calloc(num,
+		sizeof(struct name_intern_stripe));
+	if(!t->stripes) {
+		free(t);
+		return NULL;
+	}
+	t->mask = (uint32_t)(num - 1);
+	t->shift = 0;
+	if(t->mask != 0) {
+		while(!(t->mask & 0x80000000)) {
+			t->mask <<= 1;
+			t->shift ++;
+		}
+	}
+	for(i=0; i<num; i++) {
+		struct name_intern_stripe* s = &t->stripes[i];
+		lock_basic_init(&s->lock);
+		s->size = NAME_INTERN_STARTSIZE;
+		s->buckets = (struct name_intern_node**)calloc(s->size,
+			sizeof(struct name_intern_node*));
+		if(!s->buckets) {
+			t->num = i+1;
+			name_intern_delete(t);
+			return NULL;
+		}
+		lock_protect(&s->lock, s, sizeof(*s));
+	}
+	return t;
+}
+
+void
+name_intern_delete(struct name_intern* t)
+{
+	size_t i, j;
+	if(!t)
+		return;
+	for(i=0; i<t->num; i++) {
+		struct name_intern_stripe* s = &t->stripes[i];
+		lock_basic_destroy(&s->lock);
+		if(!s->buckets)
+			continue;
+		for(j=0; j<s->size; j++) {
+			struct name_intern_node* n = s->buckets[j], *nx;
+			while(n) {
+				nx = n->next;
+				free(n);
+				n = nx;
+			}
+		}
+		free(s->buckets);
+	}
+	free(t->stripes);
+	free(t);
+}
+
+/** double the bucket array of a stripe, the stripe is locked */
+static void
+stripe_grow(struct name_intern_stripe* s)
+{
+	size_t i, newsize = s->size*2;
+	struct name_intern_node** nb = (struct name_intern_node**)calloc(
+		newsize, sizeof(struct name_intern_node*));
+	if(!nb)
+		return; /* keep the longer bucket lists */
+	for(i=0; i<s->size; i++) {
+		struct name_intern_node* n = s->buckets[i], *nx;
+		while(n) {
+			nx = n->next;
+			n->next = nb[n->hash & (newsize-1)];
+			nb[n->hash & (newsize-1)] = n;
+			n = nx;
+		}
+	}
+	free(s->buckets);
+	s->buckets = nb;
+	s->size = newsize;
+}
+
+uint8_t*
+name_intern_get(struct name_intern* t, uint8_t* name, size_t len)
+{
+	uint32_t h = siphash_hash(name, len, 0xab);
+	struct name_intern_stripe* s = &t->stripes[(h & t->mask) >> t->shift];
+	struct name_intern_node* n;
+	lock_basic_lock(&s->lock);
+	for(n = s->buckets[h & (s->size-1)]; n; n = n->next) {
+		if(n->hash == h && n->len == len &&
+			memcmp(NODE_NAME(n), name, len) == 0) {
+			n->refs++;
+			s->refs++;
+			s->saved += len;
+			lock_basic_unlock(&s->lock);
+			return NODE_NAME(n);
+		}
+	}
+	n = (struct name_intern_node*)malloc(sizeof(*n) + len);
+	if(!n) {
+		lock_basic_unlock(&s->lock);
+		return NULL;
+	}
+	n->stripe = s;
+	n->hash = h;
+	n->len = len;
+	n->refs = 1;
+	memmove(NODE_NAME(n), name, len);
+	if(s->count >= s->size)
+		stripe_grow(s);
+	n->next = s->buckets[h & (s->size-1)];
+	s->buckets[h & (s->size-1)] = n;
+	s->count++;
+	s->refs++;
+	s->mem += sizeof(*n) + len;
+	lock_basic_unlock(&s->lock);
+	return NODE_NAME(n);
+}
+
+void
+name_intern_release(uint8_t* name)
+{
+	struct name_intern_node* n, **p;
+	struct name_intern_stripe* s;
+	if(!name)
+		return;
+	n = ((struct name_intern_node*)name) - 1;
+	s = n->stripe;
+	lock_basic_lock(&s->lock);
+	s->refs--;
+	if(--n->refs > 0) {
+		s->saved -= n->len;
+		lock_basic_unlock(&s->lock);
+		return;
+	}
+	for(p = &s->buckets[n->hash & (s->size-1)]; *p; p = &(*p)->next) {
+		if(*p == n) {
+			*p = n->next;
+			break;
+		}
+	}
+	s->count--;
+	s->mem -= sizeof(*n) + n->len;
+	lock_basic_unlock(&s->lock);
+	free(n);
+}
+
+size_t
+name_intern_get_mem(struct name_intern* t)
+{
+	size_t i, m;
+	if(!t)
+		return 0;
+	m = sizeof(*t) + sizeof(struct name_intern_stripe)*t->num;
+	for(i=0; i<t->num; i++) {
+		struct name_intern_stripe* s = &t->stripes[i];
+		lock_basic_lock(&s->lock);
+		m += s->mem + sizeof(struct name_intern_node*)*s->size;
+		lock_basic_unlock(&s->lock);
+	}
+	return m;
+}
+
+void
+name_intern_get_stats(struct name_intern* t, size_t* count, size_t* refs,
+	size_t* saved)
+{
+	size_t i;
+	*count = 0;
+	*refs = 0;
+	*saved = 0;
+	if(!t)
+		return;
+	for(i=0; i<t->num; i++) {
+		struct name_intern_stripe* s = &t->stripes[i];
+		lock_basic_lock(&s->lock);
+		*count += s->count;
+		*refs += s->refs;
+		*saved += s->saved;
+		lock_basic_unlock(&s->lock);
+	}
+}
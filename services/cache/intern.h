@@ -0,0 +1,154 @@
+/*
+ * services/cache/intern.h - interned owner names for the rrset cache.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the table of interned owner names.  The rrset cache
+ * stores one copy of every owner name, that is shared by the rrsets with
+ * that owner name.  Identical names have the same pointer, so comparing the
+ * owner names of cached rrsets is a pointer compare.
+ */
+
+#ifndef SERVICES_CACHE_INTERN_H
+#define SERVICES_CACHE_INTERN_H
+#include "util/locks.h"
+
+/** start size of the hash bucket array of a stripe, power of 2 */
+#define NAME_INTERN_STARTSIZE 64
+
+/**
+ * An interned name.  The name bytes follow the struct in the same
+ * allocation, so the node can be found from the name pointer.
+ */
+struct name_intern_node {
+	/** the stripe that the name is stored in */
+	struct name_intern_stripe* stripe;
+	/** next in the hash bucket */
+	struct name_intern_node* next;
+	/** hash value of the name */
+	uint32_t hash;
+	/** length of the name */
+	size_t len;
+	/** number of references to the name */
+	size_t refs;
+};
+
+/**
+ * A stripe of the intern table, with its own lock.
+ */
+struct name_intern_stripe {
+	/** lock on the stripe, a leaf lock, no other locks are taken while
+	 * it is held */
+	lock_basic_type lock;
+	/** hash bucket array, size is a power of 2 */
+	struct name_intern_node** buckets;
+	/** size of the bucket array */
+	size_t size;
+	/** number of names in the stripe */
+	size_t count;
+	/** number of references to the names in the stripe */
+	size_t refs;
+	/** bytes allocated for the nodes of the stripe */
+	size_t mem;
+	/** bytes of name storage that are shared, the length of every
+	 * name times its references beyond the first */
+	size_t saved;
+};
+
+/**
+ * The interned names, lock striped like the slabhash it serves.
+ */
+struct name_intern {
+	/** number of stripes, power of 2 */
+	size_t num;
+	/** mask of high hash bits that select the stripe */
+	uint32_t mask;
+	/** shift right this many bits to get the stripe index */
+	unsigned int shift;
+	/** the stripes */
+	struct name_intern_stripe* stripes;
+};
+
+/**
+ * Create the intern table.
+ * @param num: number of stripes, power of 2.
+ * @return new table or NULL on malloc failure.
+ */
+struct name_intern* name_intern_create(size_t num);
+
+/**
+ * Delete the intern table.  The names that are still referenced are
+ * freed too, the caller has to make sure that they are no longer used.
+ * @param t: table to delete.
+ */
+void name_intern_delete(struct name_intern* t);
+
+/**
+ * Get the interned copy of a name, with a new reference.  The names are
+ * compared byte for byte, so names that differ in case are stored apart.
+ * @param t: the table.
+ * @param name: the name, it is copied if it is not in the table yet.
+ * @param len: length of the name.
+ * @return the shared copy of the name, release it with
+ *	name_intern_release.  NULL on malloc failure.
+ */
+uint8_t* name_intern_get(struct name_intern* t, uint8_t* name, size_t len);
+
+/**
+ * Release a reference to an interned name.  The name is freed when the
+ * last reference is released.
+ * @param name: the name returned by name_intern_get, or NULL.
+ */
+void name_intern_release(uint8_t* name);
+
+/**
+ * Get the memory use of the table.
+ * @param t: the table.
+ * @return bytes in use.
+ */
+size_t name_intern_get_mem(struct name_intern* t);
+
+/**
+ * Get the statistics of the table.
+ * @param t: the table.
+ * @param count: number of distinct names is returned.
+ * @param refs: number of references to the names is returned.
+ * @param saved: bytes of name storage saved by the sharing is returned.
+ */
+void name_intern_get_stats(struct name_intern* t, size_t* count,
+	size_t* refs, size_t* saved);
+
+#endif /* SERVICES_CACHE_INTERN_H */
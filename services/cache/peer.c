@@ -0,0 +1,804 @@
+/*
+ * services/cache/peer.c - replication of cache inserts to cluster peers.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the replication of cache inserts to cluster peers.
+ * The records are batched per peer, and a batch is sent when it is full,
+ * or after a short wait, over a TCP connection that is kept open.
+ */
+
+#include "config.h"
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#include "services/cache/peer.h"
+#include "services/cache/dns.h"
+#include "services/listen_dnsport.h"
+#include "util/config_file.h"
+#include "util/data/dname.h"
+#include "util/data/msgparse.h"
+#include "util/data/msgreply.h"
+#include "util/data/packed_rrset.h"
+#include "util/module.h"
+#include "util/regional.h"
+#include "util/net_help.h"
+#include "util/log.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+
+/** the magic at the start of a frame */
+static const uint8_t cache_peer_magic[4] = { 'U', 'B', 'C', 'P' };
+
+/** open a listening port for a cache-peer-interface */
+static int
+cache_peer_open_if(const char* ip, int nr, struct listen_port** list,
+	struct config_file* cfg)
+{
+	struct addrinfo hints;
+	struct addrinfo* res;
+	struct listen_port* n;
+	int noproto = 0;
+	int fd, r;
+	char port[15];
+	snprintf(port, sizeof(port), "%d", nr);
+	port[sizeof(port)-1]=0;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_flags = AI_PASSIVE | AI_NUMERICHOST;
+	if((r = getaddrinfo(ip, port, &hints, &res)) != 0 || !res) {
+		log_err("cache-peer-interface %s:%s getaddrinfo: %s %s",
+			ip, port, gai_strerror(r),
+#ifdef EAI_SYSTEM
+			r==EAI_SYSTEM?(char*)strerror(errno):""
+#else
+			""
+#endif
+		);
+		return 0;
+	}
+	fd = create_tcp_accept_sock(res, 1, &noproto, 0, cfg->ip_transparent,
+		0, 0, cfg->ip_freebind, cfg->use_systemd);
+	freeaddrinfo(res);
+	if(fd == -1) {
+		log_err("cannot open cache-peer-interface %s %d%s", ip, nr,
+			noproto?" : protocol not supported":"");
+		return 0;
+	}
+	n = (struct listen_port*)calloc(1, sizeof(*n));
+	if(!n) {
+#ifndef USE_WINSOCK
+		close(fd);
+#else
+		closesocket(fd);
+#endif
+		log_err("out of memory");
+		return 0;
+	}
+	n->next = *list;
+	*list = n;
+	n->fd = fd;
+	n->ftype = listen_type_tcp;
+	return 1;
+}
+
+struct listen_port*
+cache_peers_open_ports(struct config_file* cfg)
+{
+	struct listen_port* l = NULL;
+	struct config_strlist* p;
+	for(p = cfg->cache_peer_ifs; p; p = p->next) {
+		if(!cache_peer_open_if(p->str, cfg->cache_peer_port, &l, cfg)) {
+			listening_ports_free(l);
+			return NULL;
+		}
+	}
+	return l;
+}
+
+/** delete a peer */
+static void
+cache_peer_delete(struct cache_peer* p)
+{
+	if(!p)
+		return;
+	comm_point_delete(p->c);
+	sldns_buffer_free(p->batch);
+	free(p);
+}
+
+/** parse the ip[@port] of a peer */
+static int
+cache_peer_parse(const char* str, int port, struct sockaddr_storage* addr,
+	socklen_t* addrlen)
+{
+	char buf[128];
+	char* s;
+	(void)strlcpy(buf, str, sizeof(buf));
+	if((s = strchr(buf, '@')) != NULL) {
+		*s++ = 0;
+		port = atoi(s);
+		if(port <= 0 || port > 65535)
+			return 0;
+	}
+	return ipstrtoaddr(buf, port, addr, addrlen);
+}
+
+/** create a peer */
+static struct cache_peer*
+cache_peer_create(struct cache_peers* peers, const char* str, int port)
+{
+	struct cache_peer* p = (struct cache_peer*)calloc(1, sizeof(*p));
+	if(!p)
+		return NULL;
+	p->peers = peers;
+	if(!cache_peer_parse(str, port, &p->addr, &p->addrlen)) {
+		log_err("cannot parse cache-peer %s", str);
+		free(p);
+		return NULL;
+	}
+	p->batch = sldns_buffer_new(65535 - CACHE_PEER_HDR_SIZE);
+	p->c = comm_point_create_tcp_out(peers->base, 65535,
+		&cache_peer_send_cb, p);
+	if(!p->batch || !p->c) {
+		log_err("out of memory");
+		cache_peer_delete(p);
+		return NULL;
+	}
+	return p;
+}
+
+struct cache_peers*
+cache_peers_create(struct module_env* env, struct comm_base* base,
+	struct config_file* cfg, int numthreads)
+{
+	struct config_strlist* s;
+	struct cache_peer* p;
+	struct cache_peers* peers = (struct cache_peers*)calloc(1,
+		sizeof(*peers));
+	if(!peers)
+		return NULL;
+	peers->env = env;
+	peers->base = base;
+	if(cfg->cache_peer_rate) {
+		peers->rate = cfg->cache_peer_rate / (numthreads>0?numthreads:1);
+		if(peers->rate == 0)
+			peers->rate = 1;
+	}
+	peers->rec = sldns_buffer_new(65535 - CACHE_PEER_HDR_SIZE - 2);
+	peers->region = regional_create();
+	peers->timer = comm_timer_create(base, &cache_peers_timer_cb, peers);
+	if(!peers->rec || !peers->region || !peers->timer) {
+		log_err("out of memory");
+		cache_peers_delete(peers);
+		return NULL;
+	}
+	for(s = cfg->cache_peers; s; s = s->next) {
+		if(!(p = cache_peer_create(peers, s->str,
+			cfg->cache_peer_port))) {
+			cache_peers_delete(peers);
+			return NULL;
+		}
+		p->next = peers->list;
+		peers->list = p;
+	}
+	return peers;
+}
+
+void
+cache_peers_delete(struct cache_peers* peers)
+{
+	struct cache_peer* p, *np;
+	size_t i;
+	if(!peers)
+		return;
+	p = peers->list;
+	while(p) {
+		np = p->next;
+		cache_peer_delete(p);
+		p = np;
+	}
+	for(i=0; i<peers->num_accept; i++)
+		comm_point_delete(peers->accept[i]);
+	free(peers->accept);
+	comm_timer_delete(peers->timer);
+	sldns_buffer_free(peers->rec);
+	regional_destroy(peers->region);
+	free(peers);
+}
+
+int
+cache_peers_open_accept(struct cache_peers* peers, struct listen_port* ports)
+{
+	struct listen_port* p;
+	size_t n = 0;
+	for(p = ports; p; p = p->next)
+		n++;
+	if(n == 0)
+		return 1;
+	peers->accept = (struct comm_point**)calloc(n, sizeof(*peers->accept));
+	if(!peers->accept) {
+		log_err("out of memory");
+		return 0;
+	}
+	for(p = ports; p; p = p->next) {
+		struct comm_point* c = comm_point_create_tcp(peers->base,
+			p->fd, 64, 65535, &cache_peer_recv_cb, peers);
+		if(!c) {
+			log_err("could not create cache peer accept comm point");
+			return 0;
+		}
+		/* the fd is kept in the portlist */
+		c->do_not_close = 1;
+		c->tcp_timeout_msec = CACHE_PEER_IDLE_MSEC;
+		peers->accept[peers->num_accept++] = c;
+	}
+	return 1;
+}
+
+/** write a frame header */
+static void
+cache_peer_write_hdr(sldns_buffer* buf, size_t count)
+{
+	sldns_buffer_write(buf, cache_peer_magic, sizeof(cache_peer_magic));
+	sldns_buffer_write_u8(buf, CACHE_PEER_VERSION);
+	sldns_buffer_write_u8(buf, 0);
+	sldns_buffer_write_u16(buf, (uint16_t)count);
+	sldns_buffer_write_u32(buf, 0);
+}
+
+/** read a frame header, returns false if malformed */
+static int
+cache_peer_read_hdr(sldns_buffer* buf, size_t* count)
+{
+	if(sldns_buffer_remaining(buf) < CACHE_PEER_HDR_SIZE ||
+		memcmp(sldns_buffer_current(buf), cache_peer_magic,
+		sizeof(cache_peer_magic)) != 0)
+		return 0;
+	sldns_buffer_skip(buf, (ssize_t)sizeof(cache_peer_magic));
+	if(sldns_buffer_read_u8(buf) != CACHE_PEER_VERSION)
+		return 0;
+	sldns_buffer_skip(buf, 1);
+	*count = (size_t)sldns_buffer_read_u16(buf);
+	sldns_buffer_skip(buf, 4);
+	return 1;
+}
+
+/** write a relative TTL */
+static void
+write_ttl(sldns_buffer* buf, time_t ttl)
+{
+	if(ttl < 0)
+		ttl = 0;
+	if(ttl > (time_t)0xffffffff)
+		ttl = (time_t)0xffffffff;
+	sldns_buffer_write_u32(buf, (uint32_t)ttl);
+}
+
+/** encode an rrset, returns false if it does not fit */
+static int
+encode_rrset(sldns_buffer* buf, struct ub_packed_rrset_key* k)
+{
+	struct packed_rrset_data* d = (struct packed_rrset_data*)
+		k->entry.data;
+	size_t i, total = d->count + d->rrsig_count;
+	if(k->rk.dname_len > 255 || d->count > 0xffff ||
+		d->rrsig_count > 0xffff ||
+		sldns_buffer_remaining(buf) < 1 + k->rk.dname_len + 22)
+		return 0;
+	sldns_buffer_write_u8(buf, (uint8_t)k->rk.dname_len);
+	sldns_buffer_write(buf, k->rk.dname, k->rk.dname_len);
+	sldns_buffer_write_u16(buf, ntohs(k->rk.type));
+	sldns_buffer_write_u16(buf, ntohs(k->rk.rrset_class));
+	sldns_buffer_write_u32(buf, k->rk.flags);
+	sldns_buffer_write_u8(buf, (uint8_t)d->trust);
+	sldns_buffer_write_u8(buf, (uint8_t)d->security);
+	write_ttl(buf, d->ttl);
+	sldns_buffer_write_u16(buf, (uint16_t)d->count);
+	sldns_buffer_write_u16(buf, (uint16_t)d->rrsig_count);
+	for(i=0; i<total; i++) {
+		if(d->rr_len[i] > 0xffff ||
+			sldns_buffer_remaining(buf) < 6 + d->rr_len[i])
+			return 0;
+		write_ttl(buf, d->rr_ttl[i]);
+		sldns_buffer_write_u16(buf, (uint16_t)d->rr_len[i]);
+		sldns_buffer_write(buf, d->rr_data[i], d->rr_len[i]);
+	}
+	return 1;
+}
+
+int
+cache_peer_encode(sldns_buffer* buf, struct query_info* qinfo,
+	struct reply_info* rep, uint16_t flags)
+{
+	size_t i;
+	if(qinfo->qname_len > 255 || rep->an_numrrsets > 0xffff ||
+		rep->ns_numrrsets > 0xffff || rep->ar_numrrsets > 0xffff ||
+		sldns_buffer_remaining(buf) < 7 + qinfo->qname_len + 17)
+		return 0;
+	sldns_buffer_write_u16(buf, flags);
+	sldns_buffer_write_u16(buf, qinfo->qtype);
+	sldns_buffer_write_u16(buf, qinfo->qclass);
+	sldns_buffer_write_u8(buf, (uint8_t)qinfo->qname_len);
+	sldns_buffer_write(buf, qinfo->qname, qinfo->qname_len);
+	sldns_buffer_write_u16(buf, rep->flags);
+	sldns_buffer_write_u8(buf, (uint8_t)rep->security);
+	write_ttl(buf, rep->ttl);
+	write_ttl(buf, rep->prefetch_ttl);
+	sldns_buffer_write_u16(buf, (uint16_t)rep->an_numrrsets);
+	sldns_buffer_write_u16(buf, (uint16_t)rep->ns_numrrsets);
+	sldns_buffer_write_u16(buf, (uint16_t)rep->ar_numrrsets);
+	for(i=0; i<rep->rrset_count; i++) {
+		if(!encode_rrset(buf, rep->rrsets[i]))
+			return 0;
+	}
+	return 1;
+}
+
+/** read a wireformat name with a length byte, returns false if malformed */
+static uint8_t*
+decode_dname(sldns_buffer* buf, struct regional* region, size_t* len)
+{
+	uint8_t* nm;
+	if(sldns_buffer_remaining(buf) < 1)
+		return NULL;
+	*len = (size_t)sldns_buffer_read_u8(buf);
+	if(*len == 0 || sldns_buffer_remaining(buf) < *len)
+		return NULL;
+	nm = sldns_buffer_current(buf);
+	if(dname_valid(nm, *len) != *len)
+		return NULL;
+	sldns_buffer_skip(buf, (ssize_t)*len);
+	return regional_alloc_init(region, nm, *len);
+}
+
+/** read a relative TTL, at most MAX_TTL, that is cache-max-ttl */
+static time_t
+read_ttl(sldns_buffer* buf)
+{
+	uint32_t ttl = sldns_buffer_read_u32(buf);
+	if(ttl > (uint32_t)MAX_TTL)
+		return MAX_TTL;
+	return (time_t)ttl;
+}
+
+/** decode an rrset, returns NULL if malformed */
+static struct packed_rrset_data*
+decode_rrset(sldns_buffer* buf, struct regional* region,
+	struct ub_packed_rrset_key* k)
+{
+	struct packed_rrset_data* d;
+	size_t i, total, count, sigcount, pos, len, datalen = 0;
+	uint8_t trust, sec;
+	time_t ttl;
+	if(!(k->rk.dname = decode_dname(buf, region, &k->rk.dname_len)) ||
+		sldns_buffer_remaining(buf) < 18)
+		return NULL;
+	k->rk.type = htons(sldns_buffer_read_u16(buf));
+	k->rk.rrset_class = htons(sldns_buffer_read_u16(buf));
+	k->rk.flags = sldns_buffer_read_u32(buf);
+	trust = sldns_buffer_read_u8(buf);
+	sec = sldns_buffer_read_u8(buf);
+	ttl = read_ttl(buf);
+	count = (size_t)sldns_buffer_read_u16(buf);
+	sigcount = (size_t)sldns_buffer_read_u16(buf);
+	total = count + sigcount;
+	if(trust > rrset_trust_ultimate || sec > sec_status_secure ||
+		total == 0 || total >= RR_COUNT_MAX)
+		return NULL;
+	/* scan the rdata lengths, to allocate the packed rrset */
+	pos = sldns_buffer_position(buf);
+	for(i=0; i<total; i++) {
+		if(sldns_buffer_remaining(buf) < 6)
+			return NULL;
+		sldns_buffer_skip(buf, 4);
+		len = (size_t)sldns_buffer_read_u16(buf);
+		if(len < 2 || sldns_buffer_remaining(buf) < len ||
+			sldns_read_uint16(sldns_buffer_current(buf)) != len-2)
+			return NULL;
+		sldns_buffer_skip(buf, (ssize_t)len);
+		datalen += len;
+	}
+	sldns_buffer_set_position(buf, pos);
+	d = (struct packed_rrset_data*)regional_alloc_zero(region,
+		sizeof(*d) + total*(sizeof(size_t)+sizeof(uint8_t*)+
+		sizeof(time_t)) + datalen);
+	if(!d)
+		return NULL;
+	d->ttl = ttl;
+	d->count = count;
+	d->rrsig_count = sigcount;
+	/* the peer is only known by its address, it is not trusted to
+	 * say that the data is validated, or better than an answer */
+	d->trust = (enum rrset_trust)trust;
+	if(d->trust > rrset_trust_ans_AA)
+		d->trust = rrset_trust_ans_AA;
+	d->security = sec_status_unchecked;
+	/* the lengths are needed for the pointer fixup */
+	d->rr_len = (size_t*)((uint8_t*)d + sizeof(*d));
+	for(i=0; i<total; i++) {
+		sldns_buffer_skip(buf, 4);
+		d->rr_len[i] = (size_t)sldns_buffer_read_u16(buf);
+		sldns_buffer_skip(buf, (ssize_t)d->rr_len[i]);
+	}
+	packed_rrset_ptr_fixup(d);
+	sldns_buffer_set_position(buf, pos);
+	for(i=0; i<total; i++) {
+		d->rr_ttl[i] = read_ttl(buf);
+		sldns_buffer_skip(buf, 2);
+		sldns_buffer_read(buf, d->rr_data[i], d->rr_len[i]);
+	}
+	return d;
+}
+
+int
+cache_peer_decode(sldns_buffer* buf, struct regional* region,
+	struct query_info* qinfo, struct reply_info** rep, uint16_t* flags)
+{
+	size_t i, an, ns, ar;
+	uint16_t repflags;
+	uint8_t sec;
+	time_t ttl, prettl;
+	memset(qinfo, 0, sizeof(*qinfo));
+	if(sldns_buffer_remaining(buf) < 6)
+		return 0;
+	*flags = sldns_buffer_read_u16(buf);
+	qinfo->qtype = sldns_buffer_read_u16(buf);
+	qinfo->qclass = sldns_buffer_read_u16(buf);
+	if(!(qinfo->qname = decode_dname(buf, region, &qinfo->qname_len)) ||
+		sldns_buffer_remaining(buf) < 17)
+		return 0;
+	repflags = sldns_buffer_read_u16(buf);
+	sec = sldns_buffer_read_u8(buf);
+	ttl = read_ttl(buf);
+	prettl = read_ttl(buf);
+	if(prettl > ttl)
+		prettl = ttl;
+	an = (size_t)sldns_buffer_read_u16(buf);
+	ns = (size_t)sldns_buffer_read_u16(buf);
+	ar = (size_t)sldns_buffer_read_u16(buf);
+	if(sec > sec_status_secure)
+		return 0;
+	/* every rrset takes more than one byte */
+	if(an + ns + ar > sldns_buffer_remaining(buf))
+		return 0;
+	if(!(*rep = construct_reply_info_base(region, repflags, 1, ttl, prettl,
+		an, ns, ar, an+ns+ar, sec_status_unchecked)) ||
+		!reply_info_alloc_rrset_keys(*rep, NULL, region))
+		return 0;
+	for(i=0; i<(*rep)->rrset_count; i++) {
+		struct ub_packed_rrset_key* k = (*rep)->rrsets[i];
+		if(!(k->entry.data = decode_rrset(buf, region, k)))
+			return 0;
+		k->entry.hash = rrset_key_hash(&k->rk);
+	}
+	return 1;
+}
+
+/** set the timer that sends the batches that are not full */
+static void
+cache_peers_timer_set(struct cache_peers* peers)
+{
+	struct timeval tv;
+	if(peers->timer_set)
+		return;
+	tv.tv_sec = 0;
+	tv.tv_usec = CACHE_PEER_FLUSH_MSEC*1000;
+	comm_timer_set(peers->timer, &tv);
+	peers->timer_set = 1;
+}
+
+/** connect to the peer, returns the fd or -1 */
+static int
+cache_peer_connect(struct cache_peer* p)
+{
+	int s;
+#ifdef INET6
+	if(addr_is_ip6(&p->addr, p->addrlen))
+		s = socket(PF_INET6, SOCK_STREAM, IPPROTO_TCP);
+	else
+#endif
+		s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if(s == -1) {
+#ifndef USE_WINSOCK
+		log_err_addr("cache peer: socket", strerror(errno),
+			&p->addr, p->addrlen);
+#else
+		log_err_addr("cache peer: socket",
+			wsa_strerror(WSAGetLastError()), &p->addr, p->addrlen);
+#endif
+		return -1;
+	}
+	fd_set_nonblock(s);
+	if(connect(s, (struct sockaddr*)&p->addr, p->addrlen) == -1) {
+#ifndef USE_WINSOCK
+#ifdef EINPROGRESS
+		if(errno != EINPROGRESS) {
+#else
+		if(1) {
+#endif
+			log_err_addr("cache peer: connect", strerror(errno),
+				&p->addr, p->addrlen);
+			close(s);
+#else /* USE_WINSOCK */
+		if(WSAGetLastError() != WSAEINPROGRESS &&
+			WSAGetLastError() != WSAEWOULDBLOCK) {
+			closesocket(s);
+#endif
+			return -1;
+		}
+	}
+#ifdef USE_MSG_FASTOPEN
+	p->c->tcp_do_fastopen = 0;
+#endif
+	p->c->repinfo.addrlen = p->addrlen;
+	memcpy(&p->c->repinfo.addr, &p->addr, p->addrlen);
+	return s;
+}
+
+/** see if the connection that was kept open is closed by the peer */
+static int
+cache_peer_conn_closed(int fd)
+{
+	uint8_t b;
+	ssize_t r = recv(fd, (void*)&b, 1, MSG_PEEK);
+	if(r == -1) {
+#ifndef USE_WINSOCK
+		return errno != EAGAIN && errno != EINTR;
+#else
+		return WSAGetLastError() != WSAEWOULDBLOCK;
+#endif
+	}
+	/* end of file, or unexpected data */
+	return 1;
+}
+
+/** send the batch of a peer, if it is not busy */
+static void
+cache_peer_send(struct cache_peer* p)
+{
+	time_t now = *p->peers->env->now;
+	sldns_buffer* buf = p->c->buffer;
+	int s = -1;
+	if(p->busy || p->count == 0)
+		return;
+	if(p->c->fd != -1 && (now > p->last_used + CACHE_PEER_KEEP_SEC ||
+		cache_peer_conn_closed(p->c->fd)))
+		comm_point_close(p->c);
+	p->reused = (p->c->fd != -1);
+	if(!p->reused) {
+		if(now < p->retry)
+			return;
+		if((s = cache_peer_connect(p)) == -1) {
+			p->retry = now + CACHE_PEER_RETRY_SEC;
+			return;
+		}
+	}
+	sldns_buffer_clear(buf);
+	cache_peer_write_hdr(buf, p->count);
+	sldns_buffer_write(buf, sldns_buffer_begin(p->batch),
+		sldns_buffer_position(p->batch));
+	sldns_buffer_flip(buf);
+	sldns_buffer_clear(p->batch);
+	p->inflight = p->count;
+	p->count = 0;
+	p->busy = 1;
+	p->c->tcp_is_reading = 0;
+	p->c->tcp_byte_count = 0;
+	comm_point_start_listening(p->c, s, CACHE_PEER_ACK_MSEC);
+}
+
+/** see if the message is sent to the peers */
+static int
+cache_peers_want(struct cache_peers* peers, struct reply_info* rep)
+{
+	int rcode = FLAGS_GET_RCODE(rep->flags);
+	if(rcode != LDNS_RCODE_NOERROR && rcode != LDNS_RCODE_NXDOMAIN)
+		return 0;
+	if(rep->ttl <= 0)
+		return 0;
+	/* the validator has looked at it, indeterminate is without a
+	 * trust anchor for the name */
+	if(rep->security == sec_status_secure ||
+		rep->security == sec_status_insecure ||
+		rep->security == sec_status_indeterminate)
+		return 1;
+	/* without a validator the messages are not checked */
+	return rep->security == sec_status_unchecked &&
+		!peers->env->need_to_validate;
+}
+
+void
+cache_peers_export(struct cache_peers* peers, struct query_info* qinfo,
+	struct reply_info* rep, uint16_t flags)
+{
+	struct cache_peer* p;
+	size_t len;
+	if(peers->importing || !peers->list || !cache_peers_want(peers, rep))
+		return;
+	if(peers->rate) {
+		if(peers->rate_sec != *peers->env->now) {
+			peers->rate_sec = *peers->env->now;
+			peers->rate_count = 0;
+		}
+		if(peers->rate_count >= peers->rate) {
+			for(p = peers->list; p; p = p->next)
+				peers->num_dropped++;
+			return;
+		}
+		peers->rate_count++;
+	}
+	sldns_buffer_clear(peers->rec);
+	if(!cache_peer_encode(peers->rec, qinfo, rep, flags)) {
+		verbose(VERB_ALGO, "cache peer: message too large to send");
+		return;
+	}
+	sldns_buffer_flip(peers->rec);
+	len = sldns_buffer_limit(peers->rec);
+	for(p = peers->list; p; p = p->next) {
+		if(sldns_buffer_remaining(p->batch) < 2 + len) {
+			peers->num_dropped++;
+			cache_peer_send(p);
+			continue;
+		}
+		sldns_buffer_write_u16(p->batch, (uint16_t)len);
+		sldns_buffer_write(p->batch, sldns_buffer_begin(peers->rec),
+			len);
+		p->count++;
+		if(p->count >= CACHE_PEER_BATCH)
+			cache_peer_send(p);
+	}
+	cache_peers_timer_set(peers);
+}
+
+void
+cache_peers_timer_cb(void* arg)
+{
+	struct cache_peers* peers = (struct cache_peers*)arg;
+	struct cache_peer* p;
+	int more = 0;
+	peers->timer_set = 0;
+	for(p = peers->list; p; p = p->next) {
+		cache_peer_send(p);
+		if(p->count != 0)
+			more = 1;
+	}
+	/* the peers that are busy or down are tried again */
+	if(more)
+		cache_peers_timer_set(peers);
+}
+
+int
+cache_peer_send_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	struct cache_peer* p = (struct cache_peer*)arg;
+	struct cache_peers* peers = p->peers;
+	size_t count = 0;
+	p->busy = 0;
+	if(error == NETEVENT_NOERROR && cache_peer_read_hdr(c->buffer, &count)
+		&& count == p->inflight) {
+		peers->num_sent += p->inflight;
+		p->last_used = *peers->env->now;
+	} else {
+		log_addr(VERB_QUERY, "cache peer: batch failed for",
+			&p->addr, p->addrlen);
+		peers->num_dropped += p->inflight;
+		comm_point_close(c);
+		/* a connection that was kept open may have been closed by
+		 * the peer, that is tried again right away */
+		if(!p->reused)
+			p->retry = *peers->env->now + CACHE_PEER_RETRY_SEC;
+	}
+	p->inflight = 0;
+	if(p->count >= CACHE_PEER_BATCH)
+		cache_peer_send(p);
+	if(p->count != 0)
+		cache_peers_timer_set(peers);
+	return 0;
+}
+
+/** see if the address is one of the peers, the port is not checked */
+static int
+cache_peer_allowed(struct cache_peers* peers, struct sockaddr_storage* addr,
+	socklen_t addrlen)
+{
+	struct cache_peer* p;
+	for(p = peers->list; p; p = p->next) {
+		if(sockaddr_cmp_addr(addr, addrlen, &p->addr, p->addrlen) == 0)
+			return 1;
+	}
+	return 0;
+}
+
+int
+cache_peer_recv_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* repinfo)
+{
+	struct cache_peers* peers = (struct cache_peers*)arg;
+	sldns_buffer* buf = c->buffer;
+	struct query_info qinfo;
+	struct reply_info* rep;
+	uint16_t flags;
+	size_t count, i, len, start, limit;
+	if(error != NETEVENT_NOERROR)
+		return 0;
+	if(!cache_peer_allowed(peers, &repinfo->addr, repinfo->addrlen)) {
+		log_addr(VERB_QUERY, "cache peer: refused records from",
+			&repinfo->addr, repinfo->addrlen);
+		comm_point_drop_reply(repinfo);
+		return 0;
+	}
+	if(!cache_peer_read_hdr(buf, &count)) {
+		log_addr(VERB_QUERY, "cache peer: malformed frame from",
+			&repinfo->addr, repinfo->addrlen);
+		comm_point_drop_reply(repinfo);
+		return 0;
+	}
+	limit = sldns_buffer_limit(buf);
+	peers->importing = 1;
+	for(i=0; i<count; i++) {
+		if(sldns_buffer_remaining(buf) < 2)
+			break;
+		len = (size_t)sldns_buffer_read_u16(buf);
+		if(sldns_buffer_remaining(buf) < len)
+			break;
+		start = sldns_buffer_position(buf);
+		sldns_buffer_set_limit(buf, start+len);
+		if(cache_peer_decode(buf, peers->region, &qinfo, &rep, &flags)){
+			if(dns_cache_store(peers->env, &qinfo, rep, 0, 0, 0,
+				NULL, flags))
+				peers->num_received++;
+		} else {
+			log_addr(VERB_QUERY, "cache peer: malformed record from",
+				&repinfo->addr, repinfo->addrlen);
+		}
+		regional_free_all(peers->region);
+		sldns_buffer_set_limit(buf, limit);
+		sldns_buffer_set_position(buf, start+len);
+	}
+	peers->importing = 0;
+	if(i != count) {
+		log_addr(VERB_QUERY, "cache peer: truncated frame from",
+			&repinfo->addr, repinfo->addrlen);
+		comm_point_drop_reply(repinfo);
+		return 0;
+	}
+	sldns_buffer_clear(buf);
+	cache_peer_write_hdr(buf, count);
+	sldns_buffer_flip(buf);
+	return 1;
+}
@@ -0,0 +1,237 @@
+/*
+ * services/cache/peer.h - replication of cache inserts to cluster peers.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the replication of cache inserts between the servers
+ * of a cluster, like an anycast cluster.  The validated messages that are
+ * stored in the cache are sent to the configured peers, in batches over
+ * TCP, and the messages that are received from the peers are stored in
+ * the cache as unchecked, with at most the trust of an authoritative
+ * answer, so that they are validated again.
+ *
+ * The frames on the TCP stream have the usual two byte length prefix.
+ * A frame starts with a header of CACHE_PEER_HDR_SIZE bytes, the magic
+ * "UBCP", the version, a reserved byte, the number of records in network
+ * order and four reserved bytes.  The records follow, every record has
+ * a two byte length prefix.  The receiver answers with a header that
+ * echoes the number of records.
+ */
+
+#ifndef SERVICES_CACHE_PEER_H
+#define SERVICES_CACHE_PEER_H
+#include "util/netevent.h"
+struct config_file;
+struct module_env;
+struct query_info;
+struct reply_info;
+struct regional;
+struct listen_port;
+struct sldns_buffer;
+
+/** size of the frame header */
+#define CACHE_PEER_HDR_SIZE 12
+/** version of the frame format */
+#define CACHE_PEER_VERSION 1
+/** number of records in a batch that makes it send right away */
+#define CACHE_PEER_BATCH 64
+/** msec the records wait for more to fill the batch */
+#define CACHE_PEER_FLUSH_MSEC 100
+/** msec to wait for the acknowledgement of a batch */
+#define CACHE_PEER_ACK_MSEC 10000
+/** msec an incoming connection can be idle */
+#define CACHE_PEER_IDLE_MSEC 60000
+/** seconds an outgoing connection is kept idle, less than the idle time
+ * of the receiver, so that it does not close it first */
+#define CACHE_PEER_KEEP_SEC 30
+/** seconds to wait before a connect is tried again after a failure */
+#define CACHE_PEER_RETRY_SEC 5
+
+/**
+ * A peer that the cache inserts are sent to.
+ */
+struct cache_peer {
+	/** next in list */
+	struct cache_peer* next;
+	/** the peers structure this is part of */
+	struct cache_peers* peers;
+	/** address of the peer */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** the outgoing connection, fd is -1 when not connected */
+	struct comm_point* c;
+	/** if a batch is sent and the acknowledgement is awaited */
+	int busy;
+	/** if the connection was in use before this batch was sent */
+	int reused;
+	/** number of records in the batch that is sent */
+	size_t inflight;
+	/** no connect is tried before this time, after a failure */
+	time_t retry;
+	/** time the connection was last used */
+	time_t last_used;
+	/** the records of the next batch, without the frame header */
+	struct sldns_buffer* batch;
+	/** number of records in the batch */
+	size_t count;
+};
+
+/**
+ * The cache peers of a worker thread.  Every thread sends its own cache
+ * inserts, the first thread also receives the inserts of the peers.
+ */
+struct cache_peers {
+	/** module env of the thread, with the caches */
+	struct module_env* env;
+	/** event base of the thread */
+	struct comm_base* base;
+	/** the peers, from the cache-peer config */
+	struct cache_peer* list;
+	/** timer that sends the batches that are not full */
+	struct comm_timer* timer;
+	/** if the timer is set */
+	int timer_set;
+	/** max number of records per second this thread sends, 0 for
+	 * no limit */
+	size_t rate;
+	/** number of records in the current second */
+	size_t rate_count;
+	/** the current second of the rate count */
+	time_t rate_sec;
+	/** if set, the received records are stored, and these cache inserts
+	 * are not sent to the peers */
+	int importing;
+	/** buffer for the encoding of one record */
+	struct sldns_buffer* rec;
+	/** region for the decoded records */
+	struct regional* region;
+	/** the accept comm points for the incoming connections */
+	struct comm_point** accept;
+	/** number of accept comm points */
+	size_t num_accept;
+	/** number of records sent and acknowledged */
+	size_t num_sent;
+	/** number of records dropped, by the rate limit, full batches or
+	 * failed connections */
+	size_t num_dropped;
+	/** number of records received and stored */
+	size_t num_received;
+};
+
+/**
+ * Open the ports that the records from the peers are received on.
+ * @param cfg: config with cache-peer-interface and cache-peer-port.
+ * @return list of ports, or NULL on failure or if none are configured.
+ */
+struct listen_port* cache_peers_open_ports(struct config_file* cfg);
+
+/**
+ * Create the cache peers for a thread.
+ * @param env: module env of the thread.
+ * @param base: event base of the thread.
+ * @param cfg: the config with the cache-peer options.
+ * @param numthreads: the number of threads, that share the rate limit.
+ * @return new structure or NULL on failure.
+ */
+struct cache_peers* cache_peers_create(struct module_env* env,
+	struct comm_base* base, struct config_file* cfg, int numthreads);
+
+/**
+ * Delete the cache peers, closes the connections.
+ * @param peers: to delete.
+ */
+void cache_peers_delete(struct cache_peers* peers);
+
+/**
+ * Listen for records from the peers.
+ * @param peers: the cache peers of the thread.
+ * @param ports: from cache_peers_open_ports, the fds are kept open by it.
+ * @return false on failure.
+ */
+int cache_peers_open_accept(struct cache_peers* peers,
+	struct listen_port* ports);
+
+/**
+ * Send a message that is stored in the cache to the peers, it is added
+ * to the batches.  Only messages that are secure, insecure or
+ * indeterminate, or that are unchecked when there is no validation,
+ * are sent.
+ * @param peers: the cache peers of the thread.
+ * @param qinfo: the query.
+ * @param rep: the reply, with TTLs relative to now.
+ * @param flags: the flags of the cache entry, BIT_CD.
+ */
+void cache_peers_export(struct cache_peers* peers, struct query_info* qinfo,
+	struct reply_info* rep, uint16_t flags);
+
+/**
+ * Encode a record.
+ * @param buf: appended to, at the position.
+ * @param qinfo: the query.
+ * @param rep: the reply, with TTLs relative to now.
+ * @param flags: the flags of the cache entry.
+ * @return false if it does not fit.
+ */
+int cache_peer_encode(struct sldns_buffer* buf, struct query_info* qinfo,
+	struct reply_info* rep, uint16_t flags);
+
+/**
+ * Decode a record.
+ * @param buf: the record, from position to limit.
+ * @param region: the query and reply are allocated in here.
+ * @param qinfo: returns the query.
+ * @param rep: returns the reply, with TTLs relative to now.  The reply
+ *	and its rrsets are unchecked, and the trust is at most
+ *	rrset_trust_ans_AA.
+ * @param flags: returns the flags of the cache entry.
+ * @return false if malformed or on alloc failure.
+ */
+int cache_peer_decode(struct sldns_buffer* buf, struct regional* region,
+	struct query_info* qinfo, struct reply_info** rep, uint16_t* flags);
+
+/** callback for the outgoing connections, the acknowledgement */
+int cache_peer_send_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* repinfo);
+
+/** callback for the incoming connections, the records of a peer */
+int cache_peer_recv_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* repinfo);
+
+/** callback for the timer that sends the batches */
+void cache_peers_timer_cb(void* arg);
+
+#endif /* SERVICES_CACHE_PEER_H */
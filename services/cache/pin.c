@@ -0,0 +1,380 @@
+/*
+ * services/cache/pin.c - names that are pinned in the cache.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the set of names that are pinned in the cache.
+ * The lruhash pin functions look up the key of a cache entry in it.
+ */
+
+#include "config.h"
+#include "services/cache/pin.h"
+#include "util/config_file.h"
+#include "util/data/dname.h"
+#include "util/data/msgreply.h"
+#include "util/data/packed_rrset.h"
+#include "util/storage/slabhash.h"
+#include "util/regional.h"
+#include "util/net_help.h"
+#include "util/log.h"
+#include "sldns/rrdef.h"
+#include "sldns/str2wire.h"
+
+struct cache_pins*
+cache_pins_create(void)
+{
+	struct cache_pins* pins = (struct cache_pins*)calloc(1,
+		sizeof(*pins));
+	if(!pins)
+		return NULL;
+	lock_rw_init(&pins->lock);
+	name_tree_init(&pins->tree);
+	lock_protect(&pins->lock, &pins->tree, sizeof(pins->tree));
+	lock_protect(&pins->lock, &pins->count, sizeof(pins->count));
+	return pins;
+}
+
+/** delete a pin */
+static void
+cache_pin_free(struct cache_pin* p)
+{
+	if(!p)
+		return;
+	free(p->node.name);
+	free(p->types);
+	free(p);
+}
+
+/** delete a pin in the tree traverse */
+static void
+cache_pin_del(rbnode_type* n, void* ATTR_UNUSED(arg))
+{
+	cache_pin_free((struct cache_pin*)n);
+}
+
+void
+cache_pins_delete(struct cache_pins* pins)
+{
+	if(!pins)
+		return;
+	lock_rw_destroy(&pins->lock);
+	traverse_postorder(&pins->tree, &cache_pin_del, NULL);
+	free(pins);
+}
+
+/** add the pin, caller holds the writelock, returns NULL on malloc
+ * failure. A new pin is a target if target is true, a pin that is added
+ * as not a target is no longer a target. */
+static struct cache_pin*
+pin_add(struct cache_pins* pins, uint8_t* nm, size_t nmlen, uint16_t type,
+	int suffix, int target)
+{
+	int labs = dname_count_labels(nm);
+	struct cache_pin* p = (struct cache_pin*)name_tree_find(&pins->tree,
+		nm, nmlen, labs, LDNS_RR_CLASS_IN);
+	uint16_t* types;
+	size_t i;
+	if(!p) {
+		p = (struct cache_pin*)calloc(1, sizeof(*p));
+		if(!p)
+			return NULL;
+		p->node.name = memdup(nm, nmlen);
+		if(!p->node.name) {
+			free(p);
+			return NULL;
+		}
+		p->target = target;
+		(void)name_tree_insert(&pins->tree, &p->node, p->node.name,
+			nmlen, labs, LDNS_RR_CLASS_IN);
+		name_tree_init_parents(&pins->tree);
+		pins->count++;
+	}
+	if(!target)
+		p->target = 0;
+	if(suffix) {
+		p->suffix = 1;
+		return p;
+	}
+	if(type == LDNS_RR_TYPE_ANY) {
+		p->anytype = 1;
+		return p;
+	}
+	for(i=0; i<p->numtypes; i++)
+		if(p->types[i] == type)
+			return p;
+	types = (uint16_t*)realloc(p->types,
+		(p->numtypes+1)*sizeof(uint16_t));
+	if(!types)
+		return NULL;
+	p->types = types;
+	p->types[p->numtypes++] = type;
+	return p;
+}
+
+int
+cache_pins_add(struct cache_pins* pins, uint8_t* nm, size_t nmlen,
+	uint16_t type, int suffix)
+{
+	int r;
+	lock_rw_wrlock(&pins->lock);
+	r = (pin_add(pins, nm, nmlen, type, suffix, 0) != NULL);
+	lock_rw_unlock(&pins->lock);
+	return r;
+}
+
+int
+cache_pins_add_target(struct cache_pins* pins, uint8_t* nm, size_t nmlen,
+	uint16_t type, time_t now)
+{
+	struct cache_pin* p;
+	lock_rw_wrlock(&pins->lock);
+	p = (struct cache_pin*)name_tree_find(&pins->tree, nm, nmlen,
+		dname_count_labels(nm), LDNS_RR_CLASS_IN);
+	if(p && !p->target) {
+		/* the configured pin of the name is kept as it is */
+		lock_rw_unlock(&pins->lock);
+		return 1;
+	}
+	p = pin_add(pins, nm, nmlen, type, 0, 1);
+	if(p)
+		p->seen = now;
+	lock_rw_unlock(&pins->lock);
+	return p != NULL;
+}
+
+size_t
+cache_pins_expire_targets(struct cache_pins* pins, time_t old)
+{
+	struct cache_pin* p, *np;
+	size_t num = 0;
+	lock_rw_wrlock(&pins->lock);
+	p = (struct cache_pin*)rbtree_first(&pins->tree);
+	while((rbnode_type*)p != RBTREE_NULL) {
+		np = (struct cache_pin*)rbtree_next(&p->node.node);
+		if(p->target && p->seen < old) {
+			(void)rbtree_delete(&pins->tree, &p->node);
+			pins->count--;
+			cache_pin_free(p);
+			num++;
+		}
+		p = np;
+	}
+	if(num != 0)
+		name_tree_init_parents(&pins->tree);
+	lock_rw_unlock(&pins->lock);
+	return num;
+}
+
+size_t
+cache_pins_count(struct cache_pins* pins)
+{
+	size_t count;
+	lock_rw_rdlock(&pins->lock);
+	count = pins->count;
+	lock_rw_unlock(&pins->lock);
+	return count;
+}
+
+/** add a pin from a string */
+static int
+pin_add_str(struct cache_pins* pins, const char* name, const char* type,
+	int suffix)
+{
+	uint8_t* nm;
+	size_t nmlen;
+	uint16_t t = LDNS_RR_TYPE_ANY;
+	int r;
+	if(!(nm = sldns_str2wire_dname(name, &nmlen))) {
+		log_err("cannot parse cache-pin name %s", name);
+		return 0;
+	}
+	if(type && strcasecmp(type, "ANY") != 0 &&
+		(t = sldns_get_rr_type_by_name(type)) == 0) {
+		log_err("cannot parse cache-pin type %s", type);
+		free(nm);
+		return 0;
+	}
+	r = cache_pins_add(pins, nm, nmlen, t, suffix);
+	free(nm);
+	if(!r)
+		log_err("out of memory adding cache-pin");
+	return r;
+}
+
+int
+cache_pins_apply_cfg(struct cache_pins* pins, struct config_file* cfg)
+{
+	struct config_str2list* p;
+	struct config_strlist* s;
+	pins->max_space = cfg->cache_pin_max_size;
+	for(p = cfg->cache_pins; p; p = p->next) {
+		if(!pin_add_str(pins, p->str, p->str2, 0))
+			return 0;
+	}
+	for(s = cfg->cache_pin_suffixes; s; s = s->next) {
+		if(!pin_add_str(pins, s->str, NULL, 1))
+			return 0;
+	}
+	return 1;
+}
+
+int
+cache_pins_remove(struct cache_pins* pins, uint8_t* nm, size_t nmlen)
+{
+	struct cache_pin* p;
+	lock_rw_wrlock(&pins->lock);
+	p = (struct cache_pin*)name_tree_find(&pins->tree, nm, nmlen,
+		dname_count_labels(nm), LDNS_RR_CLASS_IN);
+	if(!p) {
+		lock_rw_unlock(&pins->lock);
+		return 0;
+	}
+	(void)rbtree_delete(&pins->tree, &p->node);
+	name_tree_init_parents(&pins->tree);
+	pins->count--;
+	lock_rw_unlock(&pins->lock);
+	cache_pin_free(p);
+	return 1;
+}
+
+/** see if the type is pinned at the exact name */
+static int
+pin_has_type(struct cache_pin* p, uint16_t type)
+{
+	size_t i;
+	if(p->anytype)
+		return 1;
+	for(i=0; i<p->numtypes; i++)
+		if(p->types[i] == type)
+			return 1;
+	/* the CNAME at a pinned name is pinned, for the answer to it */
+	return type == LDNS_RR_TYPE_CNAME && p->numtypes != 0;
+}
+
+int
+cache_pins_match(struct cache_pins* pins, uint8_t* nm, size_t nmlen,
+	uint16_t type, uint16_t dclass)
+{
+	struct name_tree_node* n;
+	int labs;
+	if(dclass != LDNS_RR_CLASS_IN)
+		return 0;
+	labs = dname_count_labels(nm);
+	lock_rw_rdlock(&pins->lock);
+	if(pins->count == 0) {
+		lock_rw_unlock(&pins->lock);
+		return 0;
+	}
+	n = name_tree_lookup(&pins->tree, nm, nmlen, labs, dclass);
+	if(n && n->labs == labs && pin_has_type((struct cache_pin*)n, type)) {
+		lock_rw_unlock(&pins->lock);
+		return 1;
+	}
+	for(; n; n = n->parent) {
+		if(((struct cache_pin*)n)->suffix) {
+			lock_rw_unlock(&pins->lock);
+			return 1;
+		}
+	}
+	lock_rw_unlock(&pins->lock);
+	return 0;
+}
+
+struct query_info*
+cache_pins_refresh_list(struct cache_pins* pins, struct regional* region,
+	size_t* num)
+{
+	struct cache_pin* p;
+	struct query_info* list;
+	size_t n = 0, i;
+	*num = 0;
+	lock_rw_rdlock(&pins->lock);
+	RBTREE_FOR(p, struct cache_pin*, &pins->tree) {
+		if(!p->target)
+			n += p->numtypes;
+	}
+	if(n == 0 || !(list = (struct query_info*)regional_alloc_zero(region,
+		n*sizeof(*list)))) {
+		lock_rw_unlock(&pins->lock);
+		return NULL;
+	}
+	RBTREE_FOR(p, struct cache_pin*, &pins->tree) {
+		if(p->target)
+			continue;
+		for(i=0; i<p->numtypes; i++) {
+			list[*num].qname = regional_alloc_init(region,
+				p->node.name, p->node.len);
+			if(!list[*num].qname) {
+				lock_rw_unlock(&pins->lock);
+				return list;
+			}
+			list[*num].qname_len = p->node.len;
+			list[*num].qtype = p->types[i];
+			list[*num].qclass = LDNS_RR_CLASS_IN;
+			(*num)++;
+		}
+	}
+	lock_rw_unlock(&pins->lock);
+	return list;
+}
+
+void
+cache_pins_setup(struct cache_pins* pins, struct slabhash* msg_cache,
+	struct slabhash* rrset_cache)
+{
+	slabhash_setpinfunc(msg_cache, pins?&cache_pins_msg_pinfunc:NULL,
+		pins, pins?pins->max_space:0);
+	slabhash_setpinfunc(rrset_cache, pins?&cache_pins_rrset_pinfunc:NULL,
+		pins, pins?pins->max_space:0);
+	slabhash_repin(msg_cache);
+	slabhash_repin(rrset_cache);
+}
+
+int
+cache_pins_rrset_pinfunc(void* key, void* arg)
+{
+	struct ub_packed_rrset_key* k = (struct ub_packed_rrset_key*)key;
+	return cache_pins_match((struct cache_pins*)arg, k->rk.dname,
+		k->rk.dname_len, ntohs(k->rk.type), ntohs(k->rk.rrset_class));
+}
+
+int
+cache_pins_msg_pinfunc(void* key, void* arg)
+{
+	struct query_info* k = (struct query_info*)key;
+	return cache_pins_match((struct cache_pins*)arg, k->qname,
+		k->qname_len, k->qtype, k->qclass);
+}
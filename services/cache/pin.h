@@ -0,0 +1,208 @@
+/*
+ * services/cache/pin.h - names that are pinned in the cache.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the set of names that are pinned in the message and
+ * rrset caches.  Pinned entries are not removed to make space for other
+ * entries, and are refreshed before they expire.
+ */
+
+#ifndef SERVICES_CACHE_PIN_H
+#define SERVICES_CACHE_PIN_H
+#include "util/locks.h"
+#include "util/rbtree.h"
+#include "util/storage/dnstree.h"
+struct config_file;
+struct query_info;
+struct regional;
+struct slabhash;
+
+/**
+ * The names that are pinned in the cache.
+ */
+struct cache_pins {
+	/** lock on the tree, the worker threads read it, remote control
+	 * changes it */
+	lock_rw_type lock;
+	/** tree of struct cache_pin, in name_tree order */
+	rbtree_type tree;
+	/** number of pinned names, if zero, the tree is not looked at */
+	size_t count;
+	/** the memory the pinned entries may use in the message cache
+	 * and in the rrset cache, each. 0 for no limit. */
+	size_t max_space;
+};
+
+/**
+ * A pinned name.
+ */
+struct cache_pin {
+	/** name tree node, key is the name, class is IN */
+	struct name_tree_node node;
+	/** if the names below this name are pinned too, with any type */
+	int suffix;
+	/** if all types of this name are pinned */
+	int anytype;
+	/** the types that are pinned at this name, malloced */
+	uint16_t* types;
+	/** number of types */
+	size_t numtypes;
+	/** if the name is only pinned as the target of a CNAME chain of a
+	 * pinned name, and not pinned by the configuration */
+	int target;
+	/** for a target, the last time it was seen in a pinned answer */
+	time_t seen;
+};
+
+/**
+ * Create the cache pins structure.
+ * @return new structure or NULL on malloc failure.
+ */
+struct cache_pins* cache_pins_create(void);
+
+/**
+ * Delete the cache pins structure.
+ * @param pins: to delete.
+ */
+void cache_pins_delete(struct cache_pins* pins);
+
+/**
+ * Add the pins from the config file.
+ * @param pins: the pins structure.
+ * @param cfg: config with the cache-pin and cache-pin-suffix options.
+ * @return false on error.
+ */
+int cache_pins_apply_cfg(struct cache_pins* pins, struct config_file* cfg);
+
+/**
+ * Add a pin.  Takes the lock.
+ * @param pins: the pins structure.
+ * @param nm: the name, wireformat, it is copied.
+ * @param nmlen: length of the name.
+ * @param type: the type, or LDNS_RR_TYPE_ANY for all types of the name.
+ * @param suffix: if true, the type is ignored and the name with all
+ *	names below it are pinned.
+ * @return false on malloc failure.
+ */
+int cache_pins_add(struct cache_pins* pins, uint8_t* nm, size_t nmlen,
+	uint16_t type, int suffix);
+
+/**
+ * Remove the pins for a name, the types and suffix of it.  Takes the lock.
+ * @param pins: the pins structure.
+ * @param nm: the name, wireformat.
+ * @param nmlen: length of the name.
+ * @return false if the name was not pinned.
+ */
+int cache_pins_remove(struct cache_pins* pins, uint8_t* nm, size_t nmlen);
+
+/**
+ * Pin the type at a name that is a target of the CNAME chain of a pinned
+ * answer.  If it is not seen again, cache_pins_expire_targets removes it.
+ * Takes the lock.
+ * @param pins: the pins structure.
+ * @param nm: the name, wireformat, it is copied.
+ * @param nmlen: length of the name.
+ * @param type: the type, host order.
+ * @param now: the time now.
+ * @return false on malloc failure.
+ */
+int cache_pins_add_target(struct cache_pins* pins, uint8_t* nm, size_t nmlen,
+	uint16_t type, time_t now);
+
+/**
+ * Remove the target pins that have not been seen in a pinned answer
+ * since a time.  Takes the lock.
+ * @param pins: the pins structure.
+ * @param old: the targets that were last seen before this are removed.
+ * @return the number of targets that were removed.
+ */
+size_t cache_pins_expire_targets(struct cache_pins* pins, time_t old);
+
+/**
+ * Get the number of pinned names.  Takes the lock.
+ * @param pins: the pins structure.
+ * @return the number of names, including the targets.
+ */
+size_t cache_pins_count(struct cache_pins* pins);
+
+/**
+ * See if a name and type is pinned.  Takes the lock.
+ * The CNAME at a pinned name is also pinned.
+ * @param pins: the pins structure.
+ * @param nm: the name, wireformat.
+ * @param nmlen: length of the name.
+ * @param type: the type, host order.
+ * @param dclass: the class, host order.
+ * @return true if pinned.
+ */
+int cache_pins_match(struct cache_pins* pins, uint8_t* nm, size_t nmlen,
+	uint16_t type, uint16_t dclass);
+
+/**
+ * Get the pinned name and type pairs, to refresh them.  Takes the lock.
+ * Suffixes are not listed, they are refreshed by the usual prefetch.
+ * Targets are not listed, they are refreshed with the answer that has
+ * the CNAME to them.
+ * @param pins: the pins structure.
+ * @param region: the result is allocated in here.
+ * @param num: returns the number of elements.
+ * @return array of query_info, or NULL if none or on alloc failure.
+ */
+struct query_info* cache_pins_refresh_list(struct cache_pins* pins,
+	struct regional* region, size_t* num);
+
+/**
+ * Set the pin functions on the message and rrset cache, and pin or
+ * unpin the entries that are in them according to the pins.
+ * The pinned entries may use max_space of the pins in each cache.
+ * @param pins: the pins structure, or NULL to unpin everything.
+ * @param msg_cache: the message cache.
+ * @param rrset_cache: the rrset cache table.
+ */
+void cache_pins_setup(struct cache_pins* pins, struct slabhash* msg_cache,
+	struct slabhash* rrset_cache);
+
+/** lruhash pin function for the rrset cache, key is an rrset key,
+ * arg is the struct cache_pins */
+int cache_pins_rrset_pinfunc(void* key, void* arg);
+
+/** lruhash pin function for the message cache, key is a query_info,
+ * arg is the struct cache_pins */
+int cache_pins_msg_pinfunc(void* key, void* arg);
+
+#endif /* SERVICES_CACHE_PIN_H */
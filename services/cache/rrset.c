@@ -40,6 +40,7 @@
  */
 #include "config.h"
 #include "services/cache/rrset.h"
+#include "services/cache/intern.h"
 #include "sldns/rrdef.h"
 #include "util/storage/slabhash.h"
 #include "util/config_file.h"
@@ -55,6 +56,17 @@ rrset_markdel(void* key)
 	r->id = 0;
 }
 
+void
+rrset_cache_key_delete(void* key, void* userdata)
+{
+	struct ub_packed_rrset_key* k = (struct ub_packed_rrset_key*)key;
+	struct alloc_cache* a = (struct alloc_cache*)userdata;
+	k->id = 0;
+	name_intern_release(k->rk.dname);
+	k->rk.dname = NULL;
+	alloc_special_release(a, k);
+}
+
 struct rrset_cache* rrset_cache_create(struct config_file* cfg, 
 	struct alloc_cache* alloc)
 {
@@ -62,19 +74,39 @@ struct rrset_cache* rrset_cache_create(struct config_file* cfg,
 	size_t startarray = HASH_DEFAULT_STARTARRAY;
 	size_t maxmem = (cfg?cfg->rrset_cache_size:HASH_DEFAULT_MAXMEM);
 
-	struct rrset_cache *r = (struct rrset_cache*)slabhash_create(slabs,
-		startarray, maxmem, ub_rrset_sizefunc, ub_rrset_compare,
-		ub_rrset_key_delete, rrset_data_delete, alloc);
+	struct slabhash* sl;
+	struct rrset_cache *r = (struct rrset_cache*)calloc(1, sizeof(*r));
+	if(!r)
+		return NULL;
+	sl = slabhash_create(slabs, startarray, maxmem, ub_rrset_sizefunc,
+		ub_rrset_compare, rrset_cache_key_delete, rrset_data_delete,
+		alloc);
+	if(!sl) {
+		free(r);
+		return NULL;
+	}
+	/* the slabhash struct only holds the array of tables, take it over
+	 * so that the table is in the rrset cache struct */
+	r->table = *sl;
+	free(sl);
 	slabhash_setmarkdel(&r->table, &rrset_markdel);
+	if(!(r->names = name_intern_create(slabs))) {
+		rrset_cache_delete(r);
+		return NULL;
+	}
 	return r;
 }
 
 void rrset_cache_delete(struct rrset_cache* r)
 {
+	struct name_intern* names;
 	if(!r) 
 		return;
+	names = r->names;
 	slabhash_delete(&r->table);
 	/* slabhash delete also does free(r), since table is first in struct*/
+	/* the keys have released their names, delete the names after them */
+	name_intern_delete(names);
 }
 
 struct rrset_cache* rrset_cache_adjust(struct rrset_cache *r, 
@@ -183,16 +215,35 @@ rrset_update_id(struct rrset_ref* ref, struct alloc_cache* alloc)
 int 
 rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 	struct alloc_cache* alloc, time_t timenow)
+{
+	int ret = rrset_cache_update_quota(r, ref, alloc, timenow, 0);
+	if(ret == -1)
+		ub_packed_rrset_parsedelete(ref->key, alloc);
+	return ret;
+}
+
+int 
+rrset_cache_update_quota(struct rrset_cache* r, struct rrset_ref* ref,
+	struct alloc_cache* alloc, time_t timenow, uint16_t quota_id)
 {
 	struct lruhash_entry* e;
 	struct ub_packed_rrset_key* k = ref->key;
 	hashvalue_type h = k->entry.hash;
 	uint16_t rrset_type = ntohs(k->rk.type);
 	int equal = 0;
+	uint8_t* nm;
 	log_assert(ref->id != 0 && k->id != 0);
 	log_assert(k->rk.dname != NULL);
+	/* share the owner name with the cached rrsets, a cached rrset with
+	 * the same name then has the same name pointer */
+	if(!(nm = name_intern_get(r->names, k->rk.dname, k->rk.dname_len))) {
+		log_err("malloc failure in rrset cache name");
+		return -1;
+	}
+	free(k->rk.dname);
+	k->rk.dname = nm;
 	/* looks up item with a readlock - no editing! */
-	if((e=slabhash_lookup(&r->table, h, k, 0)) != 0) {
+	if((e=ub_rrset_lookup(&r->table, h, k, 0)) != 0) {
 		/* return id and key as they will be used in the cache
 		 * since the lruhash_insert, if item already exists, deallocs
 		 * the passed key in favor of the already stored key.
@@ -208,6 +259,8 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 			equal, (rrset_type==LDNS_RR_TYPE_NS))) {
 			/* cache is superior, return that value */
 			lock_rw_unlock(&e->lock);
+			name_intern_release(k->rk.dname);
+			k->rk.dname = NULL;
 			ub_packed_rrset_parsedelete(k, alloc);
 			if(equal) return 2;
 			return 1;
@@ -222,7 +275,8 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 		 * cache size values nicely. */
 	}
 	log_assert(ref->key->id != 0);
-	slabhash_insert(&r->table, h, &k->entry, k->entry.data, alloc);
+	slabhash_insert_quota(&r->table, h, &k->entry, k->entry.data, alloc,
+		quota_id);
 	if(e) {
 		/* For NSEC, NSEC3, DNAME, when rdata is updated, update 
 		 * the ID number so that proofs in message cache are 
@@ -255,7 +309,7 @@ rrset_cache_lookup(struct rrset_cache* r, uint8_t* qname, size_t qnamelen,
 
 	key.entry.hash = rrset_key_hash(&key.rk);
 
-	if((e = slabhash_lookup(&r->table, key.entry.hash, &key, wr))) {
+	if((e = ub_rrset_lookup(&r->table, key.entry.hash, &key, wr))) {
 		/* check TTL */
 		struct packed_rrset_data* data = 
 			(struct packed_rrset_data*)e->data;
@@ -340,7 +394,7 @@ rrset_update_sec_status(struct rrset_cache* r,
 	/* hash it again to make sure it has a hash */
 	rrset->entry.hash = rrset_key_hash(&rrset->rk);
 
-	e = slabhash_lookup(&r->table, rrset->entry.hash, rrset, 1);
+	e = ub_rrset_lookup(&r->table, rrset->entry.hash, rrset, 1);
 	if(!e)
 		return; /* not in the cache anymore */
 	cachedata = (struct packed_rrset_data*)e->data;
@@ -379,7 +433,7 @@ rrset_check_sec_status(struct rrset_cache* r,
 	/* hash it again to make sure it has a hash */
 	rrset->entry.hash = rrset_key_hash(&rrset->rk);
 
-	e = slabhash_lookup(&r->table, rrset->entry.hash, rrset, 0);
+	e = ub_rrset_lookup(&r->table, rrset->entry.hash, rrset, 0);
 	if(!e)
 		return; /* not in the cache anymore */
 	cachedata = (struct packed_rrset_data*)e->data;
@@ -48,14 +48,18 @@ struct config_file;
 struct alloc_cache;
 struct rrset_ref;
 struct regional;
+struct name_intern;
 
 /**
  * The rrset cache
- * Thin wrapper around hashtable, like a typedef.
+ * Thin wrapper around hashtable, with the owner names that the cached
+ * rrsets share.
  */
 struct rrset_cache {
-	/** uses partitioned hash table */
+	/** uses partitioned hash table, must be first in the struct */
 	struct slabhash table;
+	/** the interned owner names of the rrsets in the table */
+	struct name_intern* names;
 };
 
 /**
@@ -114,6 +118,8 @@ void rrset_cache_touch(struct rrset_cache* r, struct ub_packed_rrset_key* key,
  *	o rrset with better trust value.
  *	o same trust value, different rdata, newly passed rrset is inserted.
  * If rdata is the same, TTL in the cache is updated.
+ * The owner name of the passed rrset is replaced by the interned copy that
+ * is shared with the other cached rrsets of that name.
  *
  * @param r: the rrset cache.
  * @param ref: reference (ptr and id) to the rrset. Pass reference setup for
@@ -129,10 +135,27 @@ void rrset_cache_touch(struct rrset_cache* r, struct ub_packed_rrset_key* key,
  * 	1: reference updated, item is inserted in cache.
  * 	2: reference updated, item in cache is considered superior.
  *	   also the rdata is equal (but other parameters in cache are superior).
+ * 	-1: malloc failure for the owner name, the item is not stored and it
+ * 	   is deallocated with rrset_parsedelete. The reference is not
+ * 	   usable after this.
  */
 int rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref, 
 	struct alloc_cache* alloc, time_t timenow);
 
+/**
+ * Update an rrset in the rrset cache, like rrset_cache_update, and charge
+ * the inserted rrset to a cache quota.
+ * @param r: the rrset cache.
+ * @param ref: reference (ptr and id) to the rrset.
+ * @param alloc: how to allocate (and deallocate) the special rrset key.
+ * @param timenow: current time (to see if ttl in cache is expired).
+ * @param quota_id: the cache quota to charge, 0 for none.
+ * @return: like rrset_cache_update, but on -1 the item is not deallocated,
+ *	the caller still owns it and the reference is unchanged.
+ */
+int rrset_cache_update_quota(struct rrset_cache* r, struct rrset_ref* ref, 
+	struct alloc_cache* alloc, time_t timenow, uint16_t quota_id);
+
 /**
  * Lookup rrset. You obtain read/write lock. You must unlock before lookup
  * anything of else.
@@ -228,4 +251,11 @@ void rrset_cache_remove(struct rrset_cache* r, uint8_t* nm, size_t nmlen,
 /** mark rrset to be deleted, set id=0 */
 void rrset_markdel(void* key);
 
+/**
+ * Delete a key of the rrset cache, releases the interned owner name.
+ * @param key: the ub_packed_rrset_key.
+ * @param userdata: the alloc cache.
+ */
+void rrset_cache_key_delete(void* key, void* userdata);
+
 #endif /* SERVICES_CACHE_RRSET_H */
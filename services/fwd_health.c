@@ -0,0 +1,232 @@
+/*
+ * services/fwd_health.c - health probes to the forwarders.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the health probes to the forwarders.  The probes
+ * go through the serviced queries of the outside network, so the
+ * rtt and the timeouts of the probes are stored in the infra cache like
+ * those of the normal queries, for the forward zone name.  This file
+ * adds the readmission on a good answer, and counts a SERVFAIL or
+ * REFUSED answer as an error of the forwarder.
+ */
+
+#include "config.h"
+#include "services/fwd_health.h"
+#include "services/outside_network.h"
+#include "services/cache/infra.h"
+#include "iterator/iter_fwd.h"
+#include "iterator/iter_delegpt.h"
+#include "util/config_file.h"
+#include "util/data/dname.h"
+#include "util/data/msgreply.h"
+#include "util/module.h"
+#include "util/net_help.h"
+#include "util/log.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
+
+/** set the timer for the next round of probes */
+static void
+fwd_health_timer_set(struct fwd_health* fh)
+{
+	struct timeval tv;
+	tv.tv_sec = fh->interval;
+	tv.tv_usec = 0;
+	comm_timer_set(fh->timer, &tv);
+}
+
+struct fwd_health*
+fwd_health_create(struct module_env* env, struct outside_network* outnet,
+	struct comm_base* base, int interval)
+{
+	struct fwd_health* fh = (struct fwd_health*)calloc(1, sizeof(*fh));
+	if(!fh)
+		return NULL;
+	fh->env = env;
+	fh->outnet = outnet;
+	fh->interval = interval;
+	fh->timer = comm_timer_create(base, &fwd_health_timer_cb, fh);
+	if(!fh->timer) {
+		free(fh);
+		return NULL;
+	}
+	fwd_health_timer_set(fh);
+	return fh;
+}
+
+void
+fwd_health_delete(struct fwd_health* fh)
+{
+	struct fwd_probe* p, *np;
+	if(!fh)
+		return;
+	p = fh->probes;
+	while(p) {
+		np = p->next;
+		outnet_serviced_query_stop(p->sq, p);
+		free(p);
+		p = np;
+	}
+	comm_timer_delete(fh->timer);
+	free(fh);
+}
+
+/** see if a probe to the forwarder is already in flight */
+static int
+fwd_probe_outstanding(struct fwd_health* fh, struct delegpt_addr* a,
+	struct iter_forward_zone* z)
+{
+	struct fwd_probe* p;
+	for(p = fh->probes; p; p = p->next) {
+		if(p->zonelen == z->namelen &&
+			sockaddr_cmp(&p->addr, p->addrlen, &a->addr,
+			a->addrlen) == 0 &&
+			query_dname_compare(p->zone, z->name) == 0)
+			return 1;
+	}
+	return 0;
+}
+
+/** send a probe to the forwarder, an NS query for the forward zone */
+static void
+fwd_probe_send(struct fwd_health* fh, struct delegpt_addr* a,
+	struct iter_forward_zone* z)
+{
+	struct config_file* cfg = fh->env->cfg;
+	struct query_info qinfo;
+	struct fwd_probe* p;
+	if(z->namelen > sizeof(p->zone) || fwd_probe_outstanding(fh, a, z))
+		return;
+	if(!cfg->do_ip6 && addr_is_ip6(&a->addr, a->addrlen))
+		return;
+	if(!cfg->do_ip4 && !addr_is_ip6(&a->addr, a->addrlen))
+		return;
+	p = (struct fwd_probe*)calloc(1, sizeof(*p));
+	if(!p) {
+		log_err("fwd_health: out of memory");
+		return;
+	}
+	p->fh = fh;
+	memmove(&p->addr, &a->addr, a->addrlen);
+	p->addrlen = a->addrlen;
+	memmove(p->zone, z->name, z->namelen);
+	p->zonelen = z->namelen;
+	memset(&qinfo, 0, sizeof(qinfo));
+	qinfo.qname = p->zone;
+	qinfo.qname_len = p->zonelen;
+	qinfo.qtype = LDNS_RR_TYPE_NS;
+	qinfo.qclass = z->dclass;
+	p->sq = outnet_serviced_query(fh->outnet, &qinfo, BIT_RD, 0, 0, 1,
+		cfg->tcp_upstream, cfg->ssl_upstream || z->dp->ssl_upstream,
+		&p->addr, p->addrlen, p->zone, p->zonelen, NULL,
+		&fwd_health_probe_cb, p, fh->outnet->udp_buff, fh->env);
+	if(!p->sq) {
+		log_addr(VERB_ALGO, "fwd_health: could not send probe to",
+			&p->addr, p->addrlen);
+		free(p);
+		return;
+	}
+	p->next = fh->probes;
+	fh->probes = p;
+	fh->num_sent++;
+}
+
+void
+fwd_health_timer_cb(void* arg)
+{
+	struct fwd_health* fh = (struct fwd_health*)arg;
+	struct iter_forward_zone* z;
+	struct delegpt_addr* a;
+	if(fh->env->fwds) {
+		RBTREE_FOR(z, struct iter_forward_zone*,
+			fh->env->fwds->tree) {
+			if(!z->dp)
+				continue; /* stub zone marker */
+			for(a = z->dp->target_list; a; a = a->next_target)
+				fwd_probe_send(fh, a, z);
+		}
+	}
+	fwd_health_timer_set(fh);
+}
+
+/** remove the probe from the list of outstanding probes */
+static void
+fwd_probe_remove(struct fwd_health* fh, struct fwd_probe* probe)
+{
+	struct fwd_probe** pp;
+	for(pp = &fh->probes; *pp; pp = &(*pp)->next) {
+		if(*pp == probe) {
+			*pp = probe->next;
+			return;
+		}
+	}
+}
+
+int
+fwd_health_probe_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* ATTR_UNUSED(reply_info))
+{
+	struct fwd_probe* p = (struct fwd_probe*)arg;
+	struct fwd_health* fh = p->fh;
+	time_t now = *fh->env->now;
+	int rcode;
+	fwd_probe_remove(fh, p);
+	/* timeouts are in the infra cache already, by the serviced query */
+	if(error == NETEVENT_NOERROR && c &&
+		sldns_buffer_limit(c->buffer) >= LDNS_HEADER_SIZE &&
+		LDNS_QR_WIRE(sldns_buffer_begin(c->buffer))) {
+		rcode = LDNS_RCODE_WIRE(sldns_buffer_begin(c->buffer));
+		if(rcode == LDNS_RCODE_NOERROR ||
+			rcode == LDNS_RCODE_NXDOMAIN) {
+			if(infra_readmit(fh->env->infra_cache, &p->addr,
+				p->addrlen, p->zone, p->zonelen, now)) {
+				fh->num_readmit++;
+				log_addr(VERB_OPS, "forwarder readmitted",
+					&p->addr, p->addrlen);
+			}
+		} else if(!infra_server_error(fh->env->infra_cache, &p->addr,
+			p->addrlen, p->zone, p->zonelen, now)) {
+			log_err("fwd_health: out of memory");
+		}
+		infra_local_invalidate(fh->env->infra_local, &p->addr,
+			p->addrlen, p->zone, p->zonelen);
+	}
+	outnet_serviced_query_stop(p->sq, p);
+	free(p);
+	return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * services/fwd_health.h - health probes to the forwarders.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the health probes to the forwarders.  One thread
+ * sends a small NS query for the forward zone to every forwarder address,
+ * every probe interval.  The answers and timeouts go into the infra cache,
+ * where the error score and the ejection of the forwarder are kept, and
+ * a good answer readmits an ejected forwarder.  The forwarder selection
+ * in the iterator uses that health information.
+ */
+
+#ifndef SERVICES_FWD_HEALTH_H
+#define SERVICES_FWD_HEALTH_H
+#include "util/netevent.h"
+#include "sldns/rrdef.h"
+struct module_env;
+struct outside_network;
+struct serviced_query;
+struct fwd_health;
+
+/**
+ * A health probe that is in flight.
+ */
+struct fwd_probe {
+	/** next in list of outstanding probes */
+	struct fwd_probe* next;
+	/** the health checker */
+	struct fwd_health* fh;
+	/** the serviced query, for stopping it */
+	struct serviced_query* sq;
+	/** the forwarder address */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** the forward zone name, wireformat */
+	uint8_t zone[LDNS_MAX_DOMAINLEN+1];
+	/** length of zone */
+	size_t zonelen;
+};
+
+/**
+ * The health checker of the forwarders, for one thread.
+ */
+struct fwd_health {
+	/** module env of the thread, with the forwards and infra cache */
+	struct module_env* env;
+	/** outside network to send the probes with */
+	struct outside_network* outnet;
+	/** timer for the next round of probes */
+	struct comm_timer* timer;
+	/** seconds between the rounds of probes */
+	int interval;
+	/** the outstanding probes */
+	struct fwd_probe* probes;
+	/** number of probes sent */
+	size_t num_sent;
+	/** number of forwarders readmitted by a probe */
+	size_t num_readmit;
+};
+
+/**
+ * Create the health checker, and start the timer for the probes.
+ * @param env: module env of the thread.
+ * @param outnet: outside network of the thread.
+ * @param base: event base of the thread.
+ * @param interval: seconds between the rounds of probes.
+ * @return new structure or NULL on malloc failure.
+ */
+struct fwd_health* fwd_health_create(struct module_env* env,
+	struct outside_network* outnet, struct comm_base* base, int interval);
+
+/**
+ * Delete the health checker, and stop the outstanding probes.
+ * @param fh: to delete.
+ */
+void fwd_health_delete(struct fwd_health* fh);
+
+/** timer callback, send a round of probes */
+void fwd_health_timer_cb(void* arg);
+
+/** callback for the answer to a probe, or a timeout */
+int fwd_health_probe_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* reply_info);
+
+#endif /* SERVICES_FWD_HEALTH_H */
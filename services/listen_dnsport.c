@@ -589,7 +589,8 @@ create_udp_sock(int family, int socktype, struct sockaddr* addr,
 
 int
 create_tcp_accept_sock(struct addrinfo *addr, int v6only, int* noproto,
-	int* reuseport, int transparent, int mss, int freebind, int use_systemd)
+	int* reuseport, int transparent, int mss, int tfo_queue, int freebind,
+	int use_systemd)
 {
 	int s;
 #if defined(SO_REUSEADDR) || defined(SO_REUSEPORT) || defined(IPV6_V6ONLY) || defined(IP_TRANSPARENT) || defined(IP_BINDANY) || defined(IP_FREEBIND)
@@ -600,6 +601,8 @@ create_tcp_accept_sock(struct addrinfo *addr, int v6only, int* noproto,
 #endif
 #ifdef USE_TCP_FASTOPEN
 	int qlen;
+#else
+	(void)tfo_queue;
 #endif
 #if !defined(IP_TRANSPARENT) && !defined(IP_BINDANY)
 	(void)transparent;
@@ -787,11 +790,12 @@ create_tcp_accept_sock(struct addrinfo *addr, int v6only, int* noproto,
 	   value is configured by the net.inet.tcp.fastopen_backlog kernel parm. */
 	qlen = 1;
 #else
-	/* 5 is recommended on linux */
-	qlen = 5;
+	/* 5 is recommended on linux, and the default of tcp-fastopen-queue */
+	qlen = tfo_queue;
 #endif
-	if ((setsockopt(s, IPPROTO_TCP, TCP_FASTOPEN, &qlen, 
+	if (tfo_queue > 0 && (setsockopt(s, IPPROTO_TCP, TCP_FASTOPEN, &qlen, 
 		  sizeof(qlen))) == -1 ) {
+		/* the socket works without it, connections do a handshake */
 		log_err("Setting TCP Fast Open as server failed: %s", strerror(errno));
 	}
 #endif
@@ -884,7 +888,8 @@ err:
 static int
 make_sock(int stype, const char* ifname, const char* port, 
 	struct addrinfo *hints, int v6only, int* noip6, size_t rcv, size_t snd,
-	int* reuseport, int transparent, int tcp_mss, int freebind, int use_systemd)
+	int* reuseport, int transparent, int tcp_mss, int tfo_queue, int freebind,
+	int use_systemd)
 {
 	struct addrinfo *res = NULL;
 	int r, s, inuse, noproto;
@@ -920,7 +925,7 @@ make_sock(int stype, const char* ifname, const char* port,
 		}
 	} else	{
 		s = create_tcp_accept_sock(res, v6only, &noproto, reuseport,
-			transparent, tcp_mss, freebind, use_systemd);
+			transparent, tcp_mss, tfo_queue, freebind, use_systemd);
 		if(s == -1 && noproto && hints->ai_family == AF_INET6){
 			*noip6 = 1;
 		}
@@ -933,7 +938,8 @@ make_sock(int stype, const char* ifname, const char* port,
 static int
 make_sock_port(int stype, const char* ifname, const char* port, 
 	struct addrinfo *hints, int v6only, int* noip6, size_t rcv, size_t snd,
-	int* reuseport, int transparent, int tcp_mss, int freebind, int use_systemd)
+	int* reuseport, int transparent, int tcp_mss, int tfo_queue, int freebind,
+	int use_systemd)
 {
 	char* s = strchr(ifname, '@');
 	if(s) {
@@ -955,10 +961,12 @@ make_sock_port(int stype, const char* ifname, const char* port,
 		(void)strlcpy(p, s+1, sizeof(p));
 		p[strlen(s+1)]=0;
 		return make_sock(stype, newif, p, hints, v6only, noip6,
-			rcv, snd, reuseport, transparent, tcp_mss, freebind, use_systemd);
+			rcv, snd, reuseport, transparent, tcp_mss, tfo_queue,
+			freebind, use_systemd);
 	}
 	return make_sock(stype, ifname, port, hints, v6only, noip6, rcv, snd,
-		reuseport, transparent, tcp_mss, freebind, use_systemd);
+		reuseport, transparent, tcp_mss, tfo_queue, freebind,
+		use_systemd);
 }
 
 /**
@@ -1054,6 +1062,7 @@ set_recvpktinfo(int s, int family)
  * 	set to false on exit if reuseport failed due to no kernel support.
  * @param transparent: set IP_TRANSPARENT socket option.
  * @param tcp_mss: maximum segment size of tcp socket. default if zero.
+ * @param tfo_queue: TCP Fast Open queue length, 0 is off.
  * @param freebind: set IP_FREEBIND socket option.
  * @param use_systemd: if true, fetch sockets from systemd.
  * @param dnscrypt_port: dnscrypt service port number
@@ -1063,7 +1072,8 @@ static int
 ports_create_if(const char* ifname, int do_auto, int do_udp, int do_tcp, 
 	struct addrinfo *hints, const char* port, struct listen_port** list,
 	size_t rcv, size_t snd, int ssl_port, int* reuseport, int transparent,
-	int tcp_mss, int freebind, int use_systemd, int dnscrypt_port)
+	int tcp_mss, int tfo_queue, int freebind, int use_systemd,
+	int dnscrypt_port)
 {
 	int s, noip6=0;
 #ifdef USE_DNSCRYPT
@@ -1080,7 +1090,7 @@ ports_create_if(const char* ifname, int do_auto, int do_udp, int do_tcp,
 	if(do_auto) {
 		if((s = make_sock_port(SOCK_DGRAM, ifname, port, hints, 1, 
 			&noip6, rcv, snd, reuseport, transparent,
-			tcp_mss, freebind, use_systemd)) == -1) {
+			tcp_mss, tfo_queue, freebind, use_systemd)) == -1) {
 			if(noip6) {
 				log_warn("IPv6 protocol not available");
 				return 1;
@@ -1109,7 +1119,7 @@ ports_create_if(const char* ifname, int do_auto, int do_udp, int do_tcp,
 		/* regular udp socket */
 		if((s = make_sock_port(SOCK_DGRAM, ifname, port, hints, 1, 
 			&noip6, rcv, snd, reuseport, transparent,
-			tcp_mss, freebind, use_systemd)) == -1) {
+			tcp_mss, tfo_queue, freebind, use_systemd)) == -1) {
 			if(noip6) {
 				log_warn("IPv6 protocol not available");
 				return 1;
@@ -1132,7 +1142,7 @@ ports_create_if(const char* ifname, int do_auto, int do_udp, int do_tcp,
 			(!strchr(ifname, '@') && atoi(port) == ssl_port));
 		if((s = make_sock_port(SOCK_STREAM, ifname, port, hints, 1, 
 			&noip6, 0, 0, reuseport, transparent, tcp_mss,
-			freebind, use_systemd)) == -1) {
+			tfo_queue, freebind, use_systemd)) == -1) {
 			if(noip6) {
 				/*log_warn("IPv6 protocol not available");*/
 				return 1;
@@ -1175,8 +1185,9 @@ listen_cp_insert(struct comm_point* c, struct listen_dnsport* front)
 
 struct listen_dnsport* 
 listen_create(struct comm_base* base, struct listen_port* ports,
-	size_t bufsize, int tcp_accept_count, void* sslctx,
-	struct dt_env* dtenv, comm_point_callback_type* cb, void *cb_arg)
+	size_t bufsize, int tcp_accept_count, int tcp_idle_timeout,
+	void* sslctx, struct dt_env* dtenv, comm_point_callback_type* cb,
+	void *cb_arg)
 {
 	struct listen_dnsport* front = (struct listen_dnsport*)
 		malloc(sizeof(struct listen_dnsport));
@@ -1216,6 +1227,10 @@ listen_create(struct comm_base* base, struct listen_port* ports,
 			listen_delete(front);
 			return NULL;
 		}
+		if(cp->type == comm_tcp_accept)
+			cp->tcp_timeout_msec = tcp_idle_timeout;
+		else if(cp->type == comm_udp)
+			comm_point_udp_stats_enable(cp);
 		cp->dtenv = dtenv;
 		cp->do_not_close = 1;
 #ifdef USE_DNSCRYPT
@@ -1250,6 +1265,26 @@ listen_create(struct comm_base* base, struct listen_port* ports,
 	return front;
 }
 
+int
+listen_add_xdp(struct listen_dnsport* front, struct comm_base* base,
+	struct xdp_sock* xsk, struct dt_env* dtenv,
+	comm_point_callback_type* cb, void* cb_arg)
+{
+	struct comm_point* cp = comm_point_create_xdp(base, xsk,
+		front->udp_buff, cb, cb_arg);
+	if(!cp) {
+		log_err("can't create xdp commpoint");
+		return 0;
+	}
+	cp->dtenv = dtenv;
+	if(!listen_cp_insert(cp, front)) {
+		log_err("malloc failed");
+		comm_point_delete(cp);
+		return 0;
+	}
+	return 1;
+}
+
 void
 listen_list_delete(struct listen_list* list)
 {
@@ -1317,7 +1352,8 @@ listening_ports_open(struct config_file* cfg, int* reuseport)
 				cfg->so_rcvbuf, cfg->so_sndbuf,
 				cfg->ssl_port, reuseport,
 				cfg->ip_transparent,
-				cfg->tcp_mss, cfg->ip_freebind, cfg->use_systemd,
+				cfg->tcp_mss, cfg->tcp_fastopen_queue,
+				cfg->ip_freebind, cfg->use_systemd,
 				cfg->dnscrypt_port)) {
 				listening_ports_free(list);
 				return NULL;
@@ -1331,7 +1367,8 @@ listening_ports_open(struct config_file* cfg, int* reuseport)
 				cfg->so_rcvbuf, cfg->so_sndbuf,
 				cfg->ssl_port, reuseport,
 				cfg->ip_transparent,
-				cfg->tcp_mss, cfg->ip_freebind, cfg->use_systemd,
+				cfg->tcp_mss, cfg->tcp_fastopen_queue,
+				cfg->ip_freebind, cfg->use_systemd,
 				cfg->dnscrypt_port)) {
 				listening_ports_free(list);
 				return NULL;
@@ -1347,7 +1384,8 @@ listening_ports_open(struct config_file* cfg, int* reuseport)
 				cfg->so_rcvbuf, cfg->so_sndbuf,
 				cfg->ssl_port, reuseport,
 				cfg->ip_transparent,
-				cfg->tcp_mss, cfg->ip_freebind, cfg->use_systemd,
+				cfg->tcp_mss, cfg->tcp_fastopen_queue,
+				cfg->ip_freebind, cfg->use_systemd,
 				cfg->dnscrypt_port)) {
 				listening_ports_free(list);
 				return NULL;
@@ -1361,7 +1399,8 @@ listening_ports_open(struct config_file* cfg, int* reuseport)
 				cfg->so_rcvbuf, cfg->so_sndbuf,
 				cfg->ssl_port, reuseport,
 				cfg->ip_transparent,
-				cfg->tcp_mss, cfg->ip_freebind, cfg->use_systemd,
+				cfg->tcp_mss, cfg->tcp_fastopen_queue,
+				cfg->ip_freebind, cfg->use_systemd,
 				cfg->dnscrypt_port)) {
 				listening_ports_free(list);
 				return NULL;
@@ -1420,6 +1459,27 @@ void listen_stop_accept(struct listen_dnsport* listen)
 	}
 }
 
+void listen_clear_tcp_fastopen(struct listen_dnsport* listen)
+{
+	struct listen_list* p;
+	for(p=listen->cps; p; p=p->next) {
+		if(p->com->type == comm_tcp_accept)
+			p->com->tcp_fastopen_count = 0;
+	}
+}
+
+void listen_clear_udp_stats(struct listen_dnsport* listen)
+{
+	struct listen_list* p;
+	for(p=listen->cps; p; p=p->next) {
+		if(p->com->type == comm_udp && p->com->udp_stats) {
+			p->com->udp_drops = 0;
+			p->com->udp_rxq_max = 0;
+			p->com->udp_rxq_util = 0;
+		}
+	}
+}
+
 void listen_start_accept(struct listen_dnsport* listen)
 {
 	/* do not start the ones that have no tcp_free list, it is no
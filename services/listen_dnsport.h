@@ -137,6 +137,8 @@ void listening_ports_free(struct listen_port* list);
  * @param bufsize: size of datagram buffer.
  * @param tcp_accept_count: max number of simultaneous TCP connections 
  * 	from clients.
+ * @param tcp_idle_timeout: msec to wait for the next query on idle TCP
+ *	connections, when few of them are in use.
  * @param sslctx: nonNULL if ssl context.
  * @param dtenv: nonNULL if dnstap enabled.
  * @param cb: callback function when a request arrives. It is passed
@@ -146,8 +148,23 @@ void listening_ports_free(struct listen_port* list);
  */
 struct listen_dnsport* listen_create(struct comm_base* base,
 	struct listen_port* ports, size_t bufsize, int tcp_accept_count,
-	void* sslctx, struct dt_env *dtenv, comm_point_callback_type* cb,
-	void* cb_arg);
+	int tcp_idle_timeout, void* sslctx, struct dt_env *dtenv,
+	comm_point_callback_type* cb, void* cb_arg);
+
+/**
+ * Add a commpoint for an AF_XDP socket to the listening structure, it
+ * shares the UDP buffer.  The socket is not closed by listen_delete.
+ * @param front: the listening structure.
+ * @param base: the comm_base that provides event functionality.
+ * @param xsk: the AF_XDP socket.
+ * @param dtenv: nonNULL if dnstap enabled.
+ * @param cb: callback function when a request arrives.
+ * @param cb_arg: user data argument for callback function.
+ * @return: false on failure, logged.
+ */
+int listen_add_xdp(struct listen_dnsport* front, struct comm_base* base,
+	struct xdp_sock* xsk, struct dt_env* dtenv,
+	comm_point_callback_type* cb, void* cb_arg);
 
 /**
  * delete the listening structure
@@ -181,6 +198,19 @@ void listen_stop_accept(struct listen_dnsport* listen);
  */
 void listen_start_accept(struct listen_dnsport* listen);
 
+/**
+ * Zero the TCP Fast Open counts of the accept handlers, for statistics.
+ * @param listen: listening structure.
+ */
+void listen_clear_tcp_fastopen(struct listen_dnsport* listen);
+
+/**
+ * Zero the kernel drop and receive queue counts of the UDP comm points,
+ * for statistics.
+ * @param listen: listening structure.
+ */
+void listen_clear_udp_stats(struct listen_dnsport* listen);
+
 /**
  * Create and bind nonblocking UDP socket
  * @param family: for socket call.
@@ -216,12 +246,15 @@ int create_udp_sock(int family, int socktype, struct sockaddr* addr,
  * 	listening UDP port.  Set to false on return if it failed to do so.
  * @param transparent: set IP_TRANSPARENT socket option.
  * @param mss: maximum segment size of the socket. if zero, leaves the default. 
+ * @param tfo_queue: TCP Fast Open queue length for the connections that
+ *	carry data in the SYN, 0 turns it off.
  * @param freebind: set IP_FREEBIND socket option.
  * @param use_systemd: if true, fetch sockets from systemd.
  * @return: the socket. -1 on error.
  */
 int create_tcp_accept_sock(struct addrinfo *addr, int v6only, int* noproto,
-	int* reuseport, int transparent, int mss, int freebind, int use_systemd);
+	int* reuseport, int transparent, int mss, int tfo_queue, int freebind,
+	int use_systemd);
 
 /**
  * Create and bind local listening socket
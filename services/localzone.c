@@ -86,6 +86,7 @@ local_zones_delete(struct local_zones* zones)
 	if(!zones)
 		return;
 	lock_rw_destroy(&zones->lock);
+	name_index_delete(zones->index);
 	/* walk through zones and delete them all */
 	traverse_postorder(&zones->ztree, lzdel, NULL);
 	free(zones);
@@ -170,6 +171,42 @@ local_zone_create(uint8_t* nm, size_t len, int labs,
 	return z;
 }
 
+/** drop the index of the tree, before the tree is changed, caller holds
+ * the wrlock */
+static void
+lz_drop_index(struct local_zones* zones)
+{
+	name_index_delete(zones->index);
+	zones->index = NULL;
+}
+
+/** make the index of the tree, caller holds the wrlock */
+static void
+lz_make_index(struct local_zones* zones)
+{
+	struct local_zone* node;
+	lz_drop_index(zones);
+	/* if it fails, the lookups use the tree */
+	if(!(zones->index = name_index_create()))
+		return;
+	RBTREE_FOR(node, struct local_zone*, &zones->ztree) {
+		if(!name_index_add(zones->index, node, node->name,
+			node->dclass)) {
+			lz_drop_index(zones);
+			return;
+		}
+	}
+}
+
+void
+local_zones_make_index(struct local_zones* zones)
+{
+	lock_rw_wrlock(&zones->lock);
+	if(!zones->index)
+		lz_make_index(zones);
+	lock_rw_unlock(&zones->lock);
+}
+
 /** enter a new zone with allocated dname returns with WRlock */
 static struct local_zone*
 lz_enter_zone_dname(struct local_zones* zones, uint8_t* nm, size_t len, 
@@ -185,6 +222,7 @@ lz_enter_zone_dname(struct local_zones* zones, uint8_t* nm, size_t len,
 	/* add to rbtree */
 	lock_rw_wrlock(&zones->lock);
 	lock_rw_wrlock(&z->lock);
+	lz_drop_index(zones);
 	if(!rbtree_insert(&zones->ztree, &z->node)) {
 		struct local_zone* oldz;
 		log_warn("duplicate local-zone");
@@ -886,6 +924,7 @@ init_parents(struct local_zones* zones)
 			addr_tree_init_parents(node->override_tree);
 		lock_rw_unlock(&node->lock);
         }
+	lz_make_index(zones);
 	lock_rw_unlock(&zones->lock);
 }
 
@@ -1063,19 +1102,26 @@ local_zones_tags_lookup(struct local_zones* zones,
 	struct local_zone *result;
 	struct local_zone key;
 	int m;
-	key.node.key = &key;
-	key.dclass = dclass;
-	key.name = name;
-	key.namelen = len;
-	key.namelabs = labs;
-	rbtree_find_less_equal(&zones->ztree, &key, &res);
-	result = (struct local_zone*)res;
-	/* exact or smaller element (or no element) */
-	if(!result || result->dclass != dclass)
-		return NULL;
-	/* count number of labels matched */
-	(void)dname_lab_cmp(result->name, result->namelabs, key.name,
-		key.namelabs, &m);
+	if(zones->index) {
+		result = (struct local_zone*)name_index_lookup(zones->index,
+			name, dclass, &m);
+		if(!result || result->dclass != dclass)
+			return NULL;
+	} else {
+		key.node.key = &key;
+		key.dclass = dclass;
+		key.name = name;
+		key.namelen = len;
+		key.namelabs = labs;
+		rbtree_find_less_equal(&zones->ztree, &key, &res);
+		result = (struct local_zone*)res;
+		/* exact or smaller element (or no element) */
+		if(!result || result->dclass != dclass)
+			return NULL;
+		/* count number of labels matched */
+		(void)dname_lab_cmp(result->name, result->namelabs, key.name,
+			key.namelabs, &m);
+	}
 	while(result) { /* go up until qname is zone or subdomain of zone */
 		if(result->namelabs <= m)
 			if(ignoretags || !result->taglist ||
@@ -1716,6 +1762,7 @@ struct local_zone* local_zones_add_zone(struct local_zones* zones,
 	z->parent = local_zones_find(zones, name, len, labs, dclass);
 
 	/* insert into the tree */
+	lz_drop_index(zones);
 	if(!rbtree_insert(&zones->ztree, &z->node)) {
 		/* duplicate entry! */
 		lock_rw_unlock(&z->lock);
@@ -1738,6 +1785,7 @@ void local_zones_del_zone(struct local_zones* zones, struct local_zone* z)
 	set_kiddo_parents(z, z, z->parent);
 
 	/* remove from tree */
+	lz_drop_index(zones);
 	(void)rbtree_delete(&zones->ztree, z);
 
 	/* delete the zone */
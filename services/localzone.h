@@ -99,6 +99,12 @@ struct local_zones {
 	lock_rw_type lock;
 	/** rbtree of struct local_zone */
 	rbtree_type ztree;
+	/**
+	 * Sorted array index of the ztree, for the lookups, made when the
+	 * parent pointers are set up.  NULL if the tree is changed, then
+	 * the tree itself is used, until local_zones_make_index.
+	 */
+	struct name_index* index;
 };
 
 /**
@@ -227,6 +233,14 @@ int local_data_cmp(const void* d1, const void* d2);
  */
 void local_zone_delete(struct local_zone* z);
 
+/**
+ * Make the sorted array index of the zones, if it was dropped because
+ * zones have been added or removed, the lookups use the tree itself
+ * until then.
+ * @param zones: the zones, wrlock is taken.
+ */
+void local_zones_make_index(struct local_zones* zones);
+
 /**
  * Lookup zone that contains the given name, class and taglist.
  * User must lock the tree or result zone.
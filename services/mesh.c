@@ -60,6 +60,7 @@
 #include "services/localzone.h"
 #include "util/data/dname.h"
 #include "respip/respip.h"
+#include "services/view.h"
 
 /** subtract timers and the values do not overflow or become negative */
 static void
@@ -1355,6 +1356,10 @@ void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 	enum module_ext_state s;
 	verbose(VERB_ALGO, "mesh_run: start");
 	while(mstate) {
+		/* cache inserts are charged to the view of the client */
+		mesh->env->cache_quota_id = (mstate->s.client_info &&
+			mstate->s.client_info->view)?
+			mstate->s.client_info->view->cache_id:0;
 		/* run the module */
 		fptr_ok(fptr_whitelist_mod_operate(
 			mesh->mods.mod[mstate->s.curmod]->operate));
@@ -1379,6 +1384,7 @@ void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 			(void)rbtree_delete(&mesh->run, mstate);
 		} else mstate = NULL;
 	}
+	mesh->env->cache_quota_id = 0;
 	if(verbosity >= VERB_ALGO) {
 		mesh_stats(mesh, "mesh_run: end");
 		mesh_log_list(mesh);
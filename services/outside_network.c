@@ -198,6 +198,24 @@ pick_outgoing_tcp(struct waiting_tcp* w, int s)
 	return 1;
 }
 
+#if defined(USE_MSG_FASTOPEN) && defined(TCP_FASTOPEN_CONNECT)
+/** set TCP Fast Open with connect() on the socket, then the first write
+ * sends the data in the SYN, also for TLS.  Returns false if the kernel
+ * does not support it. */
+static int
+outnet_tcp_fastopen_connect(int s)
+{
+	int on = 1;
+	if(setsockopt(s, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, (void*)&on,
+		(socklen_t)sizeof(on)) < 0) {
+		verbose(VERB_ALGO, "outgoing tcp: setsockopt(.. "
+			"TCP_FASTOPEN_CONNECT ..) failed: %s", strerror(errno));
+		return 0;
+	}
+	return 1;
+}
+#endif /* USE_MSG_FASTOPEN && TCP_FASTOPEN_CONNECT */
+
 /** use next free buffer to service a tcp query */
 static int
 outnet_tcp_take_into_use(struct waiting_tcp* w, uint8_t* pkt, size_t pkt_len)
@@ -255,16 +273,25 @@ outnet_tcp_take_into_use(struct waiting_tcp* w, uint8_t* pkt, size_t pkt_len)
 	endpoints.sae_srcaddrlen = 0;
 	endpoints.sae_dstaddr = (struct sockaddr *)&w->addr;
 	endpoints.sae_dstaddrlen = w->addrlen;
-	if (connectx(s, &endpoints, SAE_ASSOCID_ANY,  
+	if ((w->outnet->tcp_fastopen?connectx(s, &endpoints, SAE_ASSOCID_ANY,  
 	             CONNECT_DATA_IDEMPOTENT | CONNECT_RESUME_ON_READ_WRITE,
-	             NULL, 0, NULL, NULL) == -1) {
+	             NULL, 0, NULL, NULL):connect(s,
+		     (struct sockaddr*)&w->addr, w->addrlen)) == -1) {
 #else /* USE_OSX_MSG_FASTOPEN*/
 #ifdef USE_MSG_FASTOPEN
-	pend->c->tcp_do_fastopen = 1;
-	/* Only do TFO for TCP in which case no connect() is required here.
-	   Don't combine client TFO with SSL, since OpenSSL can't 
+	pend->c->tcp_do_fastopen = 0;
+	/* With TCP_FASTOPEN_CONNECT the connect() is done here and the
+	   first write, also of SSL, goes in the SYN.  Otherwise only do TFO
+	   for TCP in which case no connect() is required here, the sendmsg()
+	   does it.  Don't combine that with SSL, since OpenSSL can't 
 	   currently support doing a handshake on fd that already isn't connected*/
-	if (w->outnet->sslctx && w->ssl_upstream) {
+	if (w->outnet->tcp_fastopen &&
+#ifdef TCP_FASTOPEN_CONNECT
+		!outnet_tcp_fastopen_connect(s) &&
+#endif
+		!(w->outnet->sslctx && w->ssl_upstream))
+		pend->c->tcp_do_fastopen = 1;
+	if (!pend->c->tcp_do_fastopen) {
 		if(connect(s, (struct sockaddr*)&w->addr, w->addrlen) == -1) {
 #else /* USE_MSG_FASTOPEN*/
 	if(connect(s, (struct sockaddr*)&w->addr, w->addrlen) == -1) {
@@ -382,6 +409,10 @@ outnet_tcp_cb(struct comm_point* c, void* arg, int error,
 				&pend->query->addr, pend->query->addrlen);
 			error = NETEVENT_CLOSED;
 		}
+#if defined(USE_MSG_FASTOPEN) || defined(USE_OSX_MSG_FASTOPEN)
+		else if(outnet->tcp_fastopen && fd_tcp_fastopen_used(c->fd))
+			outnet->num_tcp_fastopen++;
+#endif
 	}
 	fptr_ok(fptr_whitelist_pending_tcp(pend->query->cb));
 	(void)(*pend->query->cb)(c, pend->query->cb_arg, error, reply_info);
@@ -639,6 +670,7 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	int do_ip6, size_t num_tcp, struct infra_cache* infra,
 	struct ub_randstate* rnd, int use_caps_for_id, int* availports, 
 	int numavailports, size_t unwanted_threshold, int tcp_mss,
+	int tcp_fastopen, uint8_t* cookie_secret,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
 	void* sslctx, int delayclose, struct dt_env* dtenv)
 {
@@ -653,6 +685,7 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	outnet->base = base;
 	outnet->num_tcp = num_tcp;
 	outnet->num_tcp_outgoing = 0;
+	outnet->num_tcp_fastopen = 0;
 	outnet->infra = infra;
 	outnet->rnd = rnd;
 	outnet->sslctx = sslctx;
@@ -669,6 +702,8 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	outnet->use_caps_for_id = use_caps_for_id;
 	outnet->do_udp = do_udp;
 	outnet->tcp_mss = tcp_mss;
+	outnet->tcp_fastopen = tcp_fastopen;
+	outnet->cookie_secret = cookie_secret;
 #ifndef S_SPLINT_S
 	if(delayclose) {
 		outnet->delayclose = 1;
@@ -705,6 +740,7 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	if(	!(outnet->udp_buff = sldns_buffer_new(bufsize)) ||
 		!(outnet->pending = rbtree_create(pending_cmp)) ||
 		!(outnet->serviced = rbtree_create(serviced_cmp)) ||
+		!(outnet->infra_local = infra_local_create()) ||
 		!create_pending_tcp(outnet, bufsize)) {
 		log_err("malloc failed");
 		outside_network_delete(outnet);
@@ -890,6 +926,7 @@ outside_network_delete(struct outside_network* outnet)
 			p = np;
 		}
 	}
+	infra_local_delete(outnet->infra_local);
 	free(outnet);
 }
 
@@ -1342,6 +1379,8 @@ serviced_create(struct outside_network* outnet, sldns_buffer* buff, int dnssec,
 	sq->pending = NULL;
 	sq->status = serviced_initial;
 	sq->retry = 0;
+	sq->udp_size = 0;
+	sq->cookie_len = 0;
 	sq->to_be_deleted = 0;
 #ifdef UNBOUND_DEBUG
 	ins = 
@@ -1446,6 +1485,20 @@ serviced_perturb_qname(struct ub_randstate* rnd, uint8_t* qbuf, size_t len)
 	}
 }
 
+/** the EDNS size that avoids fragmentation for the server address */
+static uint16_t
+serviced_frag_size(struct serviced_query* sq)
+{
+	if(addr_is_ip6(&sq->addr, sq->addrlen)) {
+		if(EDNS_FRAG_SIZE_IP6 < EDNS_ADVERTISED_SIZE)
+			return EDNS_FRAG_SIZE_IP6;
+	} else {
+		if(EDNS_FRAG_SIZE_IP4 < EDNS_ADVERTISED_SIZE)
+			return EDNS_FRAG_SIZE_IP4;
+	}
+	return EDNS_ADVERTISED_SIZE;
+}
+
 /** put serviced query into a buffer */
 static void
 serviced_encode(struct serviced_query* sq, sldns_buffer* buff, int with_edns)
@@ -1462,20 +1515,35 @@ serviced_encode(struct serviced_query* sq, sldns_buffer* buff, int with_edns)
 	if(with_edns) {
 		/* add edns section */
 		struct edns_data edns;
+		struct edns_option cookie;
+		uint8_t cookie_data[EDNS_COOKIE_CLIENT_SIZE+
+			EDNS_COOKIE_SERVER_MAX];
 		edns.edns_present = 1;
 		edns.ext_rcode = 0;
 		edns.edns_version = EDNS_ADVERTISED_VERSION;
 		edns.opt_list = sq->opt_list;
+		if(sq->outnet->cookie_secret) {
+			/* our client cookie, and the server cookie if the
+			 * server gave us one */
+			edns_cookie_client_write(cookie_data,
+				sq->outnet->cookie_secret, &sq->addr,
+				sq->addrlen);
+			memmove(cookie_data+EDNS_COOKIE_CLIENT_SIZE,
+				sq->cookie, sq->cookie_len);
+			cookie.opt_code = LDNS_EDNS_COOKIE;
+			cookie.opt_len = EDNS_COOKIE_CLIENT_SIZE +
+				(size_t)sq->cookie_len;
+			cookie.opt_data = cookie_data;
+			cookie.next = edns.opt_list;
+			edns.opt_list = &cookie;
+		}
 		if(sq->status == serviced_query_UDP_EDNS_FRAG) {
-			if(addr_is_ip6(&sq->addr, sq->addrlen)) {
-				if(EDNS_FRAG_SIZE_IP6 < EDNS_ADVERTISED_SIZE)
-					edns.udp_size = EDNS_FRAG_SIZE_IP6;
-				else	edns.udp_size = EDNS_ADVERTISED_SIZE;
-			} else {
-				if(EDNS_FRAG_SIZE_IP4 < EDNS_ADVERTISED_SIZE)
-					edns.udp_size = EDNS_FRAG_SIZE_IP4;
-				else	edns.udp_size = EDNS_ADVERTISED_SIZE;
-			}
+			edns.udp_size = serviced_frag_size(sq);
+		} else if(sq->udp_size != 0 && sq->udp_size <
+			EDNS_ADVERTISED_SIZE && (sq->status ==
+			serviced_query_UDP_EDNS)) {
+			/* the size that works for the path to the server */
+			edns.udp_size = sq->udp_size;
 		} else {
 			edns.udp_size = EDNS_ADVERTISED_SIZE;
 		}
@@ -1488,6 +1556,74 @@ serviced_encode(struct serviced_query* sq, sldns_buffer* buff, int with_edns)
 	}
 }
 
+/** get the server cookie for the query from the infra cache */
+static void
+serviced_cookie_get(struct serviced_query* sq)
+{
+	if(!sq->outnet->cookie_secret)
+		return;
+	sq->cookie_len = (uint8_t)infra_cookie(sq->outnet->infra, &sq->addr,
+		sq->addrlen, sq->zone, sq->zonelen, *sq->outnet->now_secs,
+		sq->cookie);
+}
+
+/**
+ * Check the cookie in the reply, the client cookie has to be ours, and
+ * store a new server cookie.
+ * @param sq: the query that was sent with a cookie.
+ * @param pkt: the reply.
+ * @param udp: if the reply is over UDP, then it has to have a cookie if
+ *	we know a server cookie of the server, RFC 7873 section 5.3.
+ * @return false if the client cookie is not ours, or missing, the reply
+ *	may be spoofed.
+ */
+static int
+serviced_cookie_check(struct serviced_query* sq, sldns_buffer* pkt, int udp)
+{
+	uint8_t client[EDNS_COOKIE_CLIENT_SIZE];
+	uint8_t* cookie;
+	size_t len;
+	if(!sq->outnet->cookie_secret)
+		return 1;
+	if(!(cookie = edns_cookie_find(pkt, &len))) {
+		/* the server has given us a cookie before, it supports
+		 * cookies, over TCP the reply can not be spoofed off path */
+		if(udp && sq->cookie_len > 0) {
+			log_addr(VERB_QUERY, "reply without cookie from",
+				&sq->addr, sq->addrlen);
+			return 0;
+		}
+		return 1;
+	}
+	edns_cookie_client_write(client, sq->outnet->cookie_secret,
+		&sq->addr, sq->addrlen);
+	if(len < EDNS_COOKIE_CLIENT_SIZE || memcmp(cookie, client,
+		EDNS_COOKIE_CLIENT_SIZE) != 0) {
+		log_addr(VERB_QUERY, "reply with the wrong client cookie from",
+			&sq->addr, sq->addrlen);
+		return 0;
+	}
+	cookie += EDNS_COOKIE_CLIENT_SIZE;
+	len -= EDNS_COOKIE_CLIENT_SIZE;
+	if(len >= 8 && len <= EDNS_COOKIE_SERVER_MAX &&
+		(len != (size_t)sq->cookie_len ||
+		memcmp(cookie, sq->cookie, len) != 0)) {
+		if(!infra_cookie_update(sq->outnet->infra, &sq->addr,
+			sq->addrlen, sq->zone, sq->zonelen, cookie, len,
+			*sq->outnet->now_secs))
+			log_err("out of memory caching server cookie");
+	}
+	return 1;
+}
+
+/** drop the per thread snapshot of the host, it is updated in infra */
+static void
+serviced_infra_changed(struct serviced_query* sq)
+{
+	infra_local_invalidate(sq->outnet->infra_local, &sq->addr,
+		sq->addrlen, sq->zone, sq->zonelen);
+}
+
 /**
  * Perform serviced query UDP sending operation.
  * Sends UDP with EDNS, unless infra host marked non EDNS.
@@ -1505,6 +1641,7 @@ serviced_udp_send(struct serviced_query* sq, sldns_buffer* buff)
 	if(!infra_host(sq->outnet->infra, &sq->addr, sq->addrlen, sq->zone,
 		sq->zonelen, now, &vs, &edns_lame_known, &rtt))
 		return 0;
+	serviced_infra_changed(sq);
 	sq->last_rtt = rtt;
 	verbose(VERB_ALGO, "EDNS lookup known=%d vs=%d", edns_lame_known, vs);
 	if(sq->status == serviced_initial) {
@@ -1518,10 +1655,14 @@ serviced_udp_send(struct serviced_query* sq, sldns_buffer* buff)
 			sq->status = serviced_query_PROBE_EDNS;
 		} else if(vs != -1) {
 			sq->status = serviced_query_UDP_EDNS;
+			sq->udp_size = infra_udp_size(sq->outnet->infra,
+				&sq->addr, sq->addrlen, sq->zone, sq->zonelen,
+				now);
 		} else { 	
 			sq->status = serviced_query_UDP; 
 		}
 	}
+	serviced_cookie_get(sq);
 	serviced_encode(sq, buff, (sq->status == serviced_query_UDP_EDNS) ||
 		(sq->status == serviced_query_UDP_EDNS_FRAG));
 	sq->last_sent_time = *sq->outnet->now_tv;
@@ -1587,7 +1728,12 @@ serviced_callbacks(struct serviced_query* sq, int error, struct comm_point* c,
 	uint8_t *backup_p = NULL;
 	size_t backlen = 0;
 #ifdef UNBOUND_DEBUG
-	rbnode_type* rem =
+	rbnode_type* rem;
+#endif
+	/* the reply or timeout updated the host in the infra cache */
+	serviced_infra_changed(sq);
+#ifdef UNBOUND_DEBUG
+	rem =
 #else
 	(void)
 #endif
@@ -1678,6 +1824,9 @@ serviced_tcp_callback(struct comm_point* c, void* arg, int error,
 	if(error != NETEVENT_NOERROR)
 		log_addr(VERB_QUERY, "tcp error for address", 
 			&sq->addr, sq->addrlen);
+	if(error==NETEVENT_NOERROR && sq->status == serviced_query_TCP_EDNS &&
+		!serviced_cookie_check(sq, c->buffer, 0))
+		error = NETEVENT_CLOSED;
 	if(error==NETEVENT_NOERROR)
 		infra_update_tcp_works(sq->outnet->infra, &sq->addr,
 			sq->addrlen, sq->zone, sq->zonelen);
@@ -1734,6 +1883,8 @@ serviced_tcp_callback(struct comm_point* c, void* arg, int error,
 		}
 	    }
 	}
+	/* the host is updated in the infra cache */
+	serviced_infra_changed(sq);
 	/* insert address into reply info */
 	if(!rep) {
 		/* create one if there isn't (on errors) */
@@ -1773,9 +1924,11 @@ serviced_tcp_send(struct serviced_query* sq, sldns_buffer* buff)
 		sq->zonelen, *sq->outnet->now_secs, &vs, &edns_lame_known,
 		&rtt))
 		return 0;
+	serviced_infra_changed(sq);
 	if(vs != -1)
 		sq->status = serviced_query_TCP_EDNS;
 	else 	sq->status = serviced_query_TCP;
+	serviced_cookie_get(sq);
 	serviced_encode(sq, buff, sq->status == serviced_query_TCP_EDNS);
 	sq->last_sent_time = *sq->outnet->now_tv;
 	sq->pending = pending_tcp_query(sq, buff, TCP_AUTH_QUERY_TIMEOUT,
@@ -1839,8 +1992,10 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 			 * by EDNS. */
 			sq->status = serviced_query_UDP_EDNS;
 		}
-		if(sq->status == serviced_query_UDP_EDNS && sq->last_rtt < 5000) {
-			/* fallback to 1480/1280 */
+		if(sq->status == serviced_query_UDP_EDNS && sq->last_rtt < 5000
+			&& sq->udp_size == 0) {
+			/* fallback to 1480/1280, not if that size is
+			 * already used for this server */
 			sq->status = serviced_query_UDP_EDNS_FRAG;
 			log_name_addr(VERB_ALGO, "try edns1xx0", sq->qbuf+10,
 				&sq->addr, sq->addrlen);
@@ -1858,6 +2013,7 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 			sq->zone, sq->zonelen, sq->qtype, -1, sq->last_rtt,
 			(time_t)now.tv_sec)))
 			log_err("out of memory in UDP exponential backoff");
+		serviced_infra_changed(sq);
 		if(sq->retry < OUTBOUND_UDP_RETRY) {
 			log_name_addr(VERB_ALGO, "retry query", sq->qbuf+10,
 				&sq->addr, sq->addrlen);
@@ -1877,6 +2033,12 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 		/* udp returns error (due to no ID or interface available) */
 		serviced_callbacks(sq, error, c, rep);
 		return 0;
+	} else if((sq->status == serviced_query_UDP_EDNS ||
+		sq->status == serviced_query_UDP_EDNS_FRAG) &&
+		!serviced_cookie_check(sq, c->buffer, 1)) {
+		/* the reply does not have our cookie, it may be spoofed,
+		 * discard it and ask again over TCP */
+		fallback_tcp = 1;
 	}
 #ifdef USE_DNSTAP
 	if(error == NETEVENT_NOERROR && outnet->dtenv &&
@@ -1947,6 +2109,23 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 		}
 		sq->status = serviced_query_UDP;
 	    }
+	    if(sq->status == serviced_query_UDP_EDNS_FRAG) {
+		/* the smaller size works after the large one timed out,
+		 * use it for the next queries to this server */
+		log_addr(VERB_ALGO, "serviced query: EDNS fragmentation size "
+			"works for", &sq->addr, sq->addrlen);
+		if(!infra_udp_size_update(outnet->infra, &sq->addr,
+			sq->addrlen, sq->zone, sq->zonelen,
+			serviced_frag_size(sq), (time_t)now.tv_sec))
+			log_err("Out of memory caching edns udp size");
+	    } else if(sq->status == serviced_query_UDP_EDNS &&
+		sq->udp_size != 0 &&
+		LDNS_TC_WIRE(sldns_buffer_begin(c->buffer))) {
+		/* truncated with the smaller size, too many of those and
+		 * the full size is tried again */
+		infra_udp_size_tc(outnet->infra, &sq->addr, sq->addrlen,
+			sq->zone, sq->zonelen, (time_t)now.tv_sec);
+	    }
 	    if(now.tv_sec > sq->last_sent_time.tv_sec ||
 		(now.tv_sec == sq->last_sent_time.tv_sec &&
 		now.tv_usec > sq->last_sent_time.tv_usec)) {
@@ -1964,6 +2143,8 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 			log_err("out of memory noting rtt.");
 		}
 	    }
+	    /* the host is updated in the infra cache */
+	    serviced_infra_changed(sq);
 	} /* end of if_!fallback_tcp */
 	/* perform TC flag check and TCP fallback after updating our
 	 * cache entries for EDNS status and RTT times */
@@ -1995,13 +2176,16 @@ outnet_serviced_query(struct outside_network* outnet,
 {
 	struct serviced_query* sq;
 	struct service_callback* cb;
-	if(!inplace_cb_query_call(env, qinfo, flags, addr, addrlen, zone, zonelen,
-		qstate, qstate->region))
+	struct edns_option* opts = NULL;
+	if(qstate) {
+		if(!inplace_cb_query_call(env, qinfo, flags, addr, addrlen,
+			zone, zonelen, qstate, qstate->region))
 			return NULL;
+		opts = qstate->edns_opts_back_out;
+	}
 	serviced_gen_query(buff, qinfo->qname, qinfo->qname_len, qinfo->qtype,
 		qinfo->qclass, flags);
-	sq = lookup_serviced(outnet, buff, dnssec, addr, addrlen,
-		qstate->edns_opts_back_out);
+	sq = lookup_serviced(outnet, buff, dnssec, addr, addrlen, opts);
 	/* duplicate entries are included in the callback list, because
 	 * there is a counterpart registration by our caller that needs to
 	 * be doubly-removed (with callbacks perhaps). */
@@ -2011,7 +2195,7 @@ outnet_serviced_query(struct outside_network* outnet,
 		/* make new serviced query entry */
 		sq = serviced_create(outnet, buff, dnssec, want_dnssec, nocaps,
 			tcp_upstream, ssl_upstream, addr, addrlen, zone,
-			zonelen, (int)qinfo->qtype, qstate->edns_opts_back_out);
+			zonelen, (int)qinfo->qtype, opts);
 		if(!sq) {
 			free(cb);
 			return NULL;
@@ -45,6 +45,7 @@
 
 #include "util/rbtree.h"
 #include "util/netevent.h"
+#include "util/edns.h"
 #include "dnstap/dnstap_config.h"
 struct pending;
 struct pending_timeout;
@@ -53,6 +54,7 @@ struct pending_tcp;
 struct waiting_tcp;
 struct waiting_udp;
 struct infra_cache;
+struct infra_local;
 struct port_comm;
 struct port_if;
 struct sldns_buffer;
@@ -128,6 +130,8 @@ struct outside_network {
 	rbtree_type* serviced;
 	/** host cache, pointer but not owned by outnet. */
 	struct infra_cache* infra;
+	/** per thread snapshots of the host cache, owned by outnet */
+	struct infra_local* infra_local;
 	/** where to get random numbers */
 	struct ub_randstate* rnd;
 	/** ssl context to create ssl wrapped TCP with DNS connections */
@@ -138,6 +142,10 @@ struct outside_network {
 #endif
 	/** maximum segment size of tcp socket */
 	int tcp_mss;
+	/** use TCP Fast Open for outgoing tcp connections */
+	int tcp_fastopen;
+	/** secret for the DNS client cookies, NULL if no cookies are sent */
+	uint8_t* cookie_secret;
 
 	/**
 	 * Array of tcp pending used for outgoing TCP connections.
@@ -150,6 +158,9 @@ struct outside_network {
 	size_t num_tcp;
 	/** number of tcp communication points in use. */
 	size_t num_tcp_outgoing;
+	/** number of outgoing tcp connections that sent the query in the
+	 * SYN with TCP Fast Open, and the server accepted it */
+	size_t num_tcp_fastopen;
 	/** list of tcp comm points that are free for use */
 	struct pending_tcp* tcp_free;
 	/** list of tcp queries waiting for a buffer */
@@ -375,6 +386,13 @@ struct serviced_query {
 	int last_rtt;
 	/** do we know edns probe status already, for UDP_EDNS queries */
 	int edns_lame_known;
+	/** EDNS UDP size that works for the server, from the infra cache,
+	 * 0 if the advertised size is used */
+	uint16_t udp_size;
+	/** the DNS server cookie of the server, from the infra cache */
+	uint8_t cookie[EDNS_COOKIE_SERVER_MAX];
+	/** length of the server cookie, 0 if none */
+	uint8_t cookie_len;
 	/** edns options to use for sending upstream packet */
 	struct edns_option* opt_list;
 	/** outside network this is part of */
@@ -405,6 +423,10 @@ struct serviced_query {
  * @param unwanted_action: the action to take.
  * @param unwanted_param: user parameter to action.
  * @param tcp_mss: maximum segment size of tcp socket.
+ * @param tcp_fastopen: use TCP Fast Open for outgoing tcp connections.
+ * @param cookie_secret: EDNS_COOKIE_SECRET_SIZE secret for the DNS client
+ *	cookies in queries, NULL to send no cookies.  Not copied, it has to
+ *	exist as long as the outside network.
  * @param do_udp: if udp is done.
  * @param sslctx: context to create outgoing connections with (if enabled).
  * @param delayclose: if not 0, udp sockets are delayed before timeout closure.
@@ -417,6 +439,7 @@ struct outside_network* outside_network_create(struct comm_base* base,
 	int do_ip4, int do_ip6, size_t num_tcp, struct infra_cache* infra, 
 	struct ub_randstate* rnd, int use_caps_for_id, int* availports, 
 	int numavailports, size_t unwanted_threshold, int tcp_mss,
+	int tcp_fastopen, uint8_t* cookie_secret,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
 	void* sslctx, int delayclose, struct dt_env *dtenv);
 
@@ -491,7 +514,8 @@ void pending_delete(struct outside_network* outnet, struct pending* p);
 	authoritative.
  * @param zonelen: length of zone.
  * @param qstate: module qstate. Mainly for inspecting the available
- *	edns_opts_lists.
+ *	edns_opts_lists. NULL for queries that are not made by a module,
+ *	like the health probes of the forwarders.
  * @param callback: callback function.
  * @param callback_arg: user argument to callback function.
  * @param buff: scratch buffer to create query contents in. Empty on exit.
@@ -43,6 +43,7 @@
 #include "services/view.h"
 #include "services/localzone.h"
 #include "util/config_file.h"
+#include "util/storage/slabhash.h"
 
 int 
 view_cmp(const void* v1, const void* v2)
@@ -76,6 +77,7 @@ view_delete(struct view* v)
 	if(!v)
 		return;
 	lock_rw_destroy(&v->lock);
+	lock_basic_destroy(&v->stats_lock);
 	local_zones_delete(v->local_zones);
 	respip_set_delete(v->respip_set);
 	free(v->name);
@@ -112,7 +114,11 @@ view_create(char* name)
 		return NULL;
 	}
 	lock_rw_init(&v->lock);
-	lock_protect(&v->lock, &v->name, sizeof(*v)-sizeof(rbnode_type));
+	lock_protect(&v->lock, &v->name, (size_t)((char*)&v->stats_lock -
+		(char*)&v->name));
+	lock_basic_init(&v->stats_lock);
+	lock_protect(&v->stats_lock, &v->num_queries,
+		sizeof(v->num_queries)+sizeof(v->num_queries_missed_cache));
 	return v;
 }
 
@@ -146,6 +152,7 @@ views_apply_cfg(struct views* vs, struct config_file* cfg)
 	struct config_view* cv;
 	struct view* v;
 	struct config_file lz_cfg;
+	size_t cache_id = 0;
 	/* Check existence of name in first view (last in config). Rest of
 	 * views are already checked when parsing config. */
 	if(cfg->views && !cfg->views->name) {
@@ -157,6 +164,12 @@ views_apply_cfg(struct views* vs, struct config_file* cfg)
 		if(!(v = views_enter_view_name(vs, cv->name)))
 			return 0;
 		v->isfirst = cv->isfirst;
+		v->cache_quota = cv->cache_quota;
+		if(v->cache_quota && cache_id < 0xffff)
+			v->cache_id = (uint16_t)++cache_id;
+		else if(v->cache_quota)
+			log_warn("view %s: too many views with a cache quota",
+				cv->name);
 		if(cv->local_zones || cv->local_data) {
 			if(!(v->local_zones = local_zones_create())){
 				lock_rw_unlock(&v->lock);
@@ -205,6 +218,54 @@ views_find_view(struct views* vs, const char* name, int write)
 	return v;
 }
 
+int
+views_cache_setup(struct views* vs, struct slabhash* msg_cache,
+	struct slabhash* rrset_cache)
+{
+	struct view* v;
+	size_t num = 0, *max = NULL;
+	int r;
+	if(vs) {
+		lock_rw_rdlock(&vs->lock);
+		RBTREE_FOR(v, struct view*, &vs->vtree) {
+			if(v->cache_id >= num)
+				num = (size_t)v->cache_id + 1;
+		}
+		if(num > 1) {
+			if(!(max = (size_t*)calloc(num, sizeof(size_t)))) {
+				lock_rw_unlock(&vs->lock);
+				return 0;
+			}
+			RBTREE_FOR(v, struct view*, &vs->vtree) {
+				if(v->cache_id != 0)
+					max[v->cache_id] = v->cache_quota;
+			}
+		}
+		lock_rw_unlock(&vs->lock);
+	}
+	r = slabhash_set_quota(msg_cache, num, max);
+	if(!slabhash_set_quota(rrset_cache, num, max))
+		r = 0;
+	free(max);
+	return r;
+}
+
+void
+view_count_query(struct view* v)
+{
+	lock_basic_lock(&v->stats_lock);
+	v->num_queries++;
+	lock_basic_unlock(&v->stats_lock);
+}
+
+void
+view_count_cachemiss(struct view* v)
+{
+	lock_basic_lock(&v->stats_lock);
+	v->num_queries_missed_cache++;
+	lock_basic_unlock(&v->stats_lock);
+}
+
 void views_print(struct views* v)
 {
 	/* TODO implement print */
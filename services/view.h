@@ -48,6 +48,7 @@ struct regional;
 struct config_file;
 struct config_view;
 struct respip_set;
+struct slabhash;
 
 
 /**
@@ -77,10 +78,23 @@ struct view {
 	/** Fallback to global local_zones when there is no match in the view
 	 * specific tree. 1 for yes, 0 for no */	
 	int isfirst;
+	/** cache id of the view, cache inserts for clients of the view are
+	 * charged to it, from 1. 0 if the view has no cache quota. */
+	uint16_t cache_id;
+	/** cache memory quota of the view, for the message cache and for
+	 * the rrset cache each, 0 for no quota. */
+	size_t cache_quota;
 	/** lock on the data in the structure
 	 * For the node and name you need to also hold the views_tree lock to
 	 * change them. */
 	lock_rw_type lock;
+	/** lock on the cache statistics, they are not covered by the
+	 * view lock */
+	lock_basic_type stats_lock;
+	/** number of queries from clients of the view */
+	size_t num_queries;
+	/** number of those queries that were not answered from the cache */
+	size_t num_queries_missed_cache;
 };
 
 
@@ -126,6 +140,30 @@ void view_delete(struct view* v);
  */
 void views_print(struct views* v);
 
+/**
+ * Set up the cache quotas of the views in the caches, the caches have
+ * to be empty. Entries are charged to the cache id of the view.
+ * @param vs: views, or NULL to remove the quotas.
+ * @param msg_cache: the message cache.
+ * @param rrset_cache: the rrset cache table.
+ * @return false on malloc failure.
+ */
+int views_cache_setup(struct views* vs, struct slabhash* msg_cache,
+	struct slabhash* rrset_cache);
+
+/**
+ * Count a query from a client of the view, for the view statistics.
+ * @param v: the view.
+ */
+void view_count_query(struct view* v);
+
+/**
+ * Count a query from a client of the view that is not answered from the
+ * cache, for the view statistics.
+ * @param v: the view.
+ */
+void view_count_cachemiss(struct view* v);
+
 /* Find a view by name.
  * @param vs: views
  * @param name: name of the view we are looking for
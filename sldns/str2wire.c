@@ -762,10 +762,262 @@ sldns_str2wire_rr_buf_internal(const char* str, uint8_t* rr, size_t* len,
 	return LDNS_WIREPARSE_ERR_OK;
 }
 
+/** blanks that separate the tokens on a line for the fast path */
+#define RRFAST_BLANK(c) ((c) == ' ' || (c) == '\t')
+
+/**
+ * Get the next blank separated token for the fast path.  Fails at the
+ * end of the line and on characters that only the full parser handles:
+ * escapes, quotes, parentheses, comments and control characters.
+ */
+static int
+rrfast_token(const char** p, const char** tok, size_t* toklen)
+{
+	const char* s = *p;
+	while(RRFAST_BLANK(*s))
+		s++;
+	*tok = s;
+	while(*s && !RRFAST_BLANK(*s)) {
+		if(*s == '\\' || *s == '"' || *s == '\'' || *s == '(' ||
+			*s == ')' || *s == ';' || (unsigned char)*s < 0x20)
+			return 0;
+		s++;
+	}
+	*toklen = (size_t)(s - *tok);
+	*p = s;
+	return *toklen != 0;
+}
+
+/** true if only blanks remain on the line */
+static int
+rrfast_end(const char* p)
+{
+	while(RRFAST_BLANK(*p))
+		p++;
+	return *p == 0;
+}
+
+/** case insensitive compare of a token with an uppercase name */
+static int
+rrfast_is(const char* tok, size_t toklen, const char* name)
+{
+	size_t i;
+	for(i=0; i<toklen; i++) {
+		if(!name[i] || toupper((unsigned char)tok[i]) != name[i])
+			return 0;
+	}
+	return name[i] == 0;
+}
+
+/** the rr types that the fast path handles, 0 for others */
+static uint16_t
+rrfast_type(const char* tok, size_t toklen)
+{
+	if(rrfast_is(tok, toklen, "A")) return LDNS_RR_TYPE_A;
+	if(rrfast_is(tok, toklen, "AAAA")) return LDNS_RR_TYPE_AAAA;
+	if(rrfast_is(tok, toklen, "NS")) return LDNS_RR_TYPE_NS;
+	if(rrfast_is(tok, toklen, "CNAME")) return LDNS_RR_TYPE_CNAME;
+	if(rrfast_is(tok, toklen, "PTR")) return LDNS_RR_TYPE_PTR;
+	if(rrfast_is(tok, toklen, "TXT")) return LDNS_RR_TYPE_TXT;
+	return 0;
+}
+
+/**
+ * Convert a domain name token without escapes, relative names get the
+ * origin (or the root) appended.  Fails on anything out of the ordinary,
+ * names that come near the length limits included.
+ */
+static int
+rrfast_dname(const char* s, size_t n, uint8_t* buf, size_t buflen,
+	size_t* olen, uint8_t* origin, size_t origin_len)
+{
+	uint8_t* pq = buf, *q = buf+1;
+	size_t i, lablen = 0;
+	if(n == 1 && s[0] == '@')
+		return 0;
+	if(n == 1 && s[0] == '.') {
+		if(buflen < 1)
+			return 0;
+		buf[0] = 0;
+		*olen = 1;
+		return 1;
+	}
+	if(n + 1 + (origin?origin_len:1) > buflen ||
+		n + 1 + (origin?origin_len:1) > LDNS_MAX_DOMAINLEN)
+		return 0;
+	for(i=0; i<n; i++) {
+		if(s[i] == '.') {
+			if(lablen == 0 || lablen > LDNS_MAX_LABELLEN)
+				return 0;
+			*pq = (uint8_t)lablen;
+			pq = q++;
+			lablen = 0;
+		} else {
+			*q++ = (uint8_t)s[i];
+			lablen++;
+		}
+	}
+	if(lablen == 0) {
+		/* absolute name, pq is the root label */
+		*pq = 0;
+	} else {
+		if(lablen > LDNS_MAX_LABELLEN)
+			return 0;
+		*pq = (uint8_t)lablen;
+		if(origin) {
+			memmove(q, origin, origin_len);
+			q += origin_len;
+		} else	*q++ = 0;
+	}
+	*olen = (size_t)(q - buf);
+	return 1;
+}
+
+/** convert TXT rdata, quoted strings without escapes and plain words */
+static int
+rrfast_txt(const char* p, uint8_t* rd, size_t avail, size_t* rdlen)
+{
+	size_t pos = 0, sl;
+	const char* s;
+	int quoted;
+	while(1) {
+		while(*p == ' ')
+			p++;
+		if(*p == 0)
+			break;
+		quoted = (*p == '"');
+		if(quoted)
+			p++;
+		s = p;
+		while(*p && (quoted?*p != '"':*p != ' ')) {
+			if(*p == '\\' || *p == '\'' || *p == '(' ||
+				*p == ')' || *p == ';' ||
+				(unsigned char)*p < 0x20 ||
+				(!quoted && *p == '"'))
+				return 0;
+			p++;
+		}
+		sl = (size_t)(p - s);
+		if(quoted) {
+			if(*p != '"')
+				return 0;
+			p++;
+			if(*p != 0 && *p != ' ')
+				return 0;
+		}
+		if(sl > 255 || pos + 1 + sl > avail)
+			return 0;
+		rd[pos] = (uint8_t)sl;
+		memmove(rd+pos+1, s, sl);
+		pos += 1 + sl;
+	}
+	if(pos == 0)
+		return 0;
+	*rdlen = pos;
+	return 1;
+}
+
+int sldns_str2wire_rr_fast_buf(const char* str, uint8_t* rr, size_t* len,
+	size_t* dname_len, uint32_t default_ttl, uint8_t* origin,
+	size_t origin_len)
+{
+	const char* p = str, *tok;
+	size_t toklen, dlen, rdlen = 0, avail, i;
+	uint32_t ttl;
+	uint16_t tp, cl;
+	uint8_t* rd;
+	char addr[64];
+
+	/* a blank start reuses the previous owner, leave that out */
+	if(RRFAST_BLANK(*p))
+		return 0;
+	if(!rrfast_token(&p, &tok, &toklen) || !rrfast_dname(tok, toklen,
+		rr, *len, &dlen, origin, origin_len))
+		return 0;
+
+	/* [ttl] [class] type */
+	if(!rrfast_token(&p, &tok, &toklen))
+		return 0;
+	if(isdigit((unsigned char)tok[0])) {
+		/* plain seconds only, wraps like sldns_str2period */
+		ttl = 0;
+		for(i=0; i<toklen; i++) {
+			if(!isdigit((unsigned char)tok[i]))
+				return 0;
+			ttl = ttl*10 + (uint32_t)(tok[i]-'0');
+		}
+		if(!rrfast_token(&p, &tok, &toklen))
+			return 0;
+	} else	ttl = default_ttl?default_ttl:LDNS_DEFAULT_TTL;
+	if(rrfast_is(tok, toklen, "IN"))
+		cl = LDNS_RR_CLASS_IN;
+	else if(rrfast_is(tok, toklen, "CH"))
+		cl = LDNS_RR_CLASS_CH;
+	else if(rrfast_is(tok, toklen, "HS"))
+		cl = LDNS_RR_CLASS_HS;
+	else	cl = 0;
+	if(cl != 0) {
+		if(!rrfast_token(&p, &tok, &toklen))
+			return 0;
+	} else	cl = LDNS_RR_CLASS_IN; /* left out, the token is the type */
+	if((tp = rrfast_type(tok, toklen)) == 0)
+		return 0;
+	if(dlen + 10 > *len)
+		return 0;
+	rd = rr + dlen + 10;
+	avail = *len - dlen - 10;
+
+	/* rdata */
+	switch(tp) {
+	case LDNS_RR_TYPE_A:
+	case LDNS_RR_TYPE_AAAA:
+		if(!rrfast_token(&p, &tok, &toklen) || toklen >= sizeof(addr)
+			|| !rrfast_end(p))
+			return 0;
+		memmove(addr, tok, toklen);
+		addr[toklen] = 0;
+		rdlen = (tp == LDNS_RR_TYPE_A)?4:LDNS_IP6ADDRLEN;
+		if(rdlen > avail)
+			return 0;
+#ifdef AF_INET6
+		if(inet_pton((tp == LDNS_RR_TYPE_A)?AF_INET:AF_INET6,
+			addr, rd) != 1)
+			return 0;
+#else
+		if(tp != LDNS_RR_TYPE_A || inet_pton(AF_INET, addr, rd) != 1)
+			return 0;
+#endif
+		break;
+	case LDNS_RR_TYPE_TXT:
+		/* the full parser treats tabs before quotes differently */
+		if(strchr(p, '\t') || !rrfast_txt(p, rd, avail, &rdlen))
+			return 0;
+		break;
+	default:
+		if(!rrfast_token(&p, &tok, &toklen) || !rrfast_end(p) ||
+			!rrfast_dname(tok, toklen, rd, avail, &rdlen, origin,
+			origin_len))
+			return 0;
+		break;
+	}
+
+	sldns_write_uint16(rr+dlen, tp);
+	sldns_write_uint16(rr+dlen+2, cl);
+	sldns_write_uint32(rr+dlen+4, ttl);
+	sldns_write_uint16(rr+dlen+8, (uint16_t)rdlen);
+	*len = dlen + 10 + rdlen;
+	if(dname_len)
+		*dname_len = dlen;
+	return 1;
+}
+
 int sldns_str2wire_rr_buf(const char* str, uint8_t* rr, size_t* len,
 	size_t* dname_len, uint32_t default_ttl, uint8_t* origin,
 	size_t origin_len, uint8_t* prev, size_t prev_len)
 {
+	if(sldns_str2wire_rr_fast_buf(str, rr, len, dname_len, default_ttl,
+		origin, origin_len))
+		return LDNS_WIREPARSE_ERR_OK;
 	return sldns_str2wire_rr_buf_internal(str, rr, len, dname_len,
 		default_ttl, origin, origin_len, prev, prev_len, 0);
 }
@@ -87,6 +87,28 @@ int sldns_str2wire_rr_buf(const char* str, uint8_t* rr, size_t* len,
 	size_t* dname_len, uint32_t default_ttl, uint8_t* origin,
 	size_t origin_len, uint8_t* prev, size_t prev_len);
 
+/**
+ * Fast path of sldns_str2wire_rr_buf for bulk data.  It converts the
+ * simple lines that make up most local-data and zone files: a plain owner
+ * name, an optional TTL in seconds, an optional class and A, AAAA, NS,
+ * CNAME, PTR or TXT rdata without escapes.  Other lines, and lines with
+ * errors, are left for the full parser, sldns_str2wire_rr_buf tries this
+ * first, so the output is the same as with the full parser.
+ * @param str: the RR data in text presentation format.
+ * @param rr: the buffer where the result is stored into, its contents are
+ * 	undefined if the line is not converted.
+ * @param len: on input the length of the buffer, on output the amount of
+ * 	the buffer used for the rr.  Not changed if the line is not converted.
+ * @param dname_len: if non-NULL, filled with the dname length as result.
+ * @param default_ttl: TTL used if no TTL available.
+ * @param origin: used for origin dname (if not NULL)
+ * @param origin_len: length of origin.
+ * @return 1 if converted, 0 if the full parser has to be used.
+ */
+int sldns_str2wire_rr_fast_buf(const char* str, uint8_t* rr, size_t* len,
+	size_t* dname_len, uint32_t default_ttl, uint8_t* origin,
+	size_t origin_len);
+
 /**
  * Same as sldns_str2wire_rr_buf, but there is no rdata, it returns an RR
  * with zero rdata and no ttl.  It has name, type, class.
@@ -130,6 +130,10 @@ usage(void)
 	printf("  list_local_data		list local-data RRs in use\n");
 	printf("  insecure_add zone 		add domain-insecure zone\n");
 	printf("  insecure_remove zone		remove domain-insecure zone\n");
+	printf("  list_cache_pins		list names pinned in the cache\n");
+	printf("  cache_pin name type		pin name and type (or ANY) in cache\n");
+	printf("  cache_pin_suffix name		pin name and names below in cache\n");
+	printf("  cache_unpin name		remove the pins of the name\n");
 	printf("  forward_add [+i] zone addr..	add forward-zone with servers\n");
 	printf("  forward_remove [+i] zone	remove forward zone\n");
 	printf("  stub_add [+ip] zone addr..	add stub-zone with servers\n");
@@ -193,6 +197,11 @@ static void pr_stats(const char* nm, struct stats_info* s)
 	PR_UL_NM("num.queries", s->svr.num_queries);
 	PR_UL_NM("num.queries_ip_ratelimited", 
 		s->svr.num_queries_ip_ratelimited);
+	PR_UL_NM("num.queries_cookie_valid", s->svr.num_queries_cookie_valid);
+	PR_UL_NM("num.queries_cookie_client",
+		s->svr.num_queries_cookie_client);
+	PR_UL_NM("num.queries_cookie_invalid",
+		s->svr.num_queries_cookie_invalid);
 	PR_UL_NM("num.cachehits",
 		s->svr.num_queries - s->svr.num_queries_missed_cache);
 	PR_UL_NM("num.cachemiss", s->svr.num_queries_missed_cache);
@@ -214,6 +223,9 @@ static void pr_stats(const char* nm, struct stats_info* s)
 	PR_TIMEVAL("recursion.time.avg", avg);
 	printf("%s.recursion.time.median"SQ"%g\n", nm, s->mesh_time_median);
 	PR_UL_NM("tcpusage", s->svr.tcp_accept_usage);
+	PR_UL_NM("udp.drops", s->svr.udp_drops);
+	PR_UL_NM("udp.rxq.max", s->svr.udp_rxq_max);
+	PR_UL_NM("udp.rxq.util", s->svr.udp_rxq_util);
 }
 
 /** print uptime */
@@ -292,6 +304,11 @@ static void print_extended(struct stats_info* s)
 	/* transport */
 	PR_UL("num.query.tcp", s->svr.qtcp);
 	PR_UL("num.query.tcpout", s->svr.qtcp_outgoing);
+	PR_UL("num.tcp.fastopen", s->svr.tcp_fastopen);
+	PR_UL("num.tcpout.fastopen", s->svr.tcp_fastopen_outgoing);
+	PR_UL("num.cachepeer.sent", s->svr.cachepeer_sent);
+	PR_UL("num.cachepeer.dropped", s->svr.cachepeer_dropped);
+	PR_UL("num.cachepeer.received", s->svr.cachepeer_received);
 	PR_UL("num.query.ipv6", s->svr.qipv6);
 
 	/* flags */
@@ -329,6 +346,7 @@ static void print_extended(struct stats_info* s)
 	PR_UL("rrset.cache.count", s->svr.rrset_cache_count);
 	PR_UL("infra.cache.count", s->svr.infra_cache_count);
 	PR_UL("key.cache.count", s->svr.key_cache_count);
+	PR_UL("neg.cache.contended", s->svr.neg_cache_contended);
 }
 
 /** print statistics out of memory structures */
@@ -203,6 +203,11 @@ void worker_probe_timer_cb(void* ATTR_UNUSED(arg))
 	log_assert(0);
 }
 
+void worker_cache_pin_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void worker_start_accept(void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
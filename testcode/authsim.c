@@ -0,0 +1,1314 @@
+/*
+ * testcode/authsim.c - serves a synthetic DNS hierarchy for benchmarks.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This program serves a synthetic DNS hierarchy from memory, so that
+ * full recursion can be benchmarked without the internet.  The root,
+ * the TLDs t0 .. tN and the second level zones d0.tJ .. dM.tJ are
+ * generated from the query names, there is no zone data in memory.
+ * Every server listens on its own loopback address, 127.x.y.z, and
+ * the resolver is pointed at it with the root hints that -H prints.
+ * Per role (root, tld, sld) a latency and a loss percentage can be set,
+ * and a part of the second level servers can be made TCP-only (they
+ * answer with TC over UDP) or lame (they answer with an upward referral).
+ *
+ * Names in a second level zone dK.tJ:
+ * 	dK.tJ		SOA, NS and A.
+ * 	ns1.dK.tJ	A of its nameserver, also ns2.
+ * 	nx*.dK.tJ	NXDOMAIN, the label starts with nx.
+ * 	cname*.dK.tJ	CNAME to www.d(K+1).tJ.
+ * 	other		A and AAAA, the address is a hash of the name.
+ */
+
+#include "config.h"
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+#include <sys/time.h>
+#include <ctype.h>
+#include <signal.h>
+#include <poll.h>
+#include "util/log.h"
+#include "util/net_help.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
+#include "sldns/str2wire.h"
+
+/** the roles of the servers in the hierarchy */
+enum sim_role {
+	/** root server */
+	sim_root = 0,
+	/** TLD server */
+	sim_tld,
+	/** second level zone server */
+	sim_sld,
+	/** number of roles */
+	sim_role_max
+};
+
+/** names of the roles, for the options and statistics */
+static const char* sim_role_name[sim_role_max] = {"root", "tld", "sld"};
+
+/** third octet of the address of the first second level server */
+#define SIM_SLD_NET 8
+/** servers per third octet */
+#define SIM_PER_NET 250
+/** max number of TCP connections */
+#define SIM_MAX_TCP 1024
+/** size of the packet buffers */
+#define SIM_BUFSIZE 65536
+
+/** configuration of the hierarchy */
+struct sim_cfg {
+	/** first two octets of the server addresses */
+	int net[2];
+	/** port for all the servers */
+	int port;
+	/** number of root servers */
+	int nroot;
+	/** number of TLDs, t0 .. tN */
+	int ntld;
+	/** number of second level zones per TLD, d0 .. dM */
+	long nsld;
+	/** number of second level server addresses */
+	int npool;
+	/** TTL of the records */
+	uint32_t ttl;
+	/** latency per role, in msec */
+	int delay[sim_role_max];
+	/** loss per role, in percent */
+	int loss[sim_role_max];
+	/** percentage of TCP-only second level servers */
+	int tcponly;
+	/** percentage of lame second level servers */
+	int lame;
+	/** seed for the loss and latency jitter */
+	unsigned int seed;
+};
+
+/** a server, one address with an UDP and a TCP socket */
+struct sim_server {
+	/** role */
+	enum sim_role role;
+	/** TLD number for TLD servers, pool index for second level */
+	int idx;
+	/** the address */
+	struct in_addr addr;
+	/** udp socket */
+	int udp;
+	/** tcp listen socket */
+	int tcp;
+	/** if it only answers over TCP */
+	int tcponly;
+	/** if it is lame for its zones */
+	int lame;
+};
+
+/** a TCP connection */
+struct sim_tcp {
+	/** the socket, -1 if not in use */
+	int fd;
+	/** generation, so delayed replies do not go to a reused slot */
+	unsigned int gen;
+	/** the server */
+	struct sim_server* srv;
+	/** bytes read into the buffer */
+	size_t len;
+	/** read buffer, length prefix and message */
+	uint8_t buf[2+65535];
+};
+
+/** a reply waiting for its latency to pass */
+struct sim_delayed {
+	/** when to send, usec */
+	uint64_t when;
+	/** udp socket, or -1 for TCP */
+	int udp;
+	/** TCP connection slot and its generation */
+	int slot;
+	/** generation of the TCP slot */
+	unsigned int gen;
+	/** destination for UDP */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** length of the packet */
+	size_t len;
+	/** the packet */
+	uint8_t* pkt;
+};
+
+/** statistics per role */
+struct sim_stats {
+	/** queries received */
+	size_t queries;
+	/** answers sent */
+	size_t answers;
+	/** queries dropped for the loss */
+	size_t dropped;
+	/** TC answers from TCP-only servers */
+	size_t truncated;
+	/** lame answers */
+	size_t lame;
+	/** queries over TCP */
+	size_t tcp;
+};
+
+/** the simulator */
+struct sim {
+	/** config */
+	struct sim_cfg cfg;
+	/** servers */
+	struct sim_server* servers;
+	/** number of servers */
+	int nservers;
+	/** TCP connections */
+	struct sim_tcp* conns;
+	/** heap of delayed replies, on when */
+	struct sim_delayed** heap;
+	/** number in the heap */
+	size_t heap_num;
+	/** size of the heap array */
+	size_t heap_max;
+	/** stats per role */
+	struct sim_stats stats[sim_role_max];
+};
+
+/** set to exit the service loop */
+static volatile int sim_exit = 0;
+
+/** usage information for authsim */
+static void usage(char* argv[])
+{
+	printf("usage: %s [options]\n", argv[0]);
+	printf("	serves a synthetic DNS hierarchy on loopback addresses.\n");
+	printf("	-a net	: first two octets of the addresses, default 127.53\n");
+	printf("	-p port	: port for all servers, default 53. Resolvers\n");
+	printf("		  follow the referrals to port 53.\n");
+	printf("	-r num	: number of root servers, default 2.\n");
+	printf("	-t num	: number of TLDs t0..tN, default 10, max %d.\n",
+		SIM_PER_NET);
+	printf("	-n num	: second level zones dK per TLD, default 100000.\n");
+	printf("	-s num	: second level server addresses, default 64.\n");
+	printf("	-T ttl	: TTL of the records, default 3600.\n");
+	printf("	-l role:ms  : latency of root, tld or sld servers.\n");
+	printf("	-d role:pct : loss percentage of root, tld or sld servers.\n");
+	printf("	-c pct	: percentage of sld servers that are TCP-only.\n");
+	printf("	-L pct	: percentage of sld servers that are lame.\n");
+	printf("	-S seed	: random seed for the loss, default 1.\n");
+	printf("	-H	: print the root hints and exit.\n");
+	printf("	-h	: this help message\n");
+	printf("Use with unbound.conf server: root-hints: <file from -H>\n");
+	printf("	do-not-query-localhost: no\n");
+	printf("The 127.x.y.z addresses work on Linux, other systems need\n");
+	printf("them configured on the loopback interface.\n");
+	exit(1);
+}
+
+/** the address of a server */
+static struct in_addr
+sim_addr(struct sim_cfg* cfg, int third, int fourth)
+{
+	struct in_addr a;
+	a.s_addr = htonl(((uint32_t)cfg->net[0]<<24) |
+		((uint32_t)cfg->net[1]<<16) | ((uint32_t)third<<8) |
+		(uint32_t)fourth);
+	return a;
+}
+
+/** address of root server i */
+static struct in_addr
+root_addr(struct sim_cfg* cfg, int i)
+{
+	return sim_addr(cfg, 0, i+1);
+}
+
+/** address of the ns (0 or 1) of TLD j */
+static struct in_addr
+tld_addr(struct sim_cfg* cfg, int j, int ns)
+{
+	return sim_addr(cfg, 1+ns, j+1);
+}
+
+/** address of second level server i in the pool */
+static struct in_addr
+pool_addr(struct sim_cfg* cfg, int i)
+{
+	return sim_addr(cfg, SIM_SLD_NET + i/SIM_PER_NET, i%SIM_PER_NET + 1);
+}
+
+/** hash of some bytes, FNV-1a */
+static uint32_t
+sim_hash(const uint8_t* d, size_t len, uint32_t h)
+{
+	size_t i;
+	for(i=0; i<len; i++) {
+		h ^= d[i];
+		h *= 16777619;
+	}
+	return h;
+}
+
+/** pool index of the ns (0 or 1) of the second level zone dK.tJ */
+static int
+sld_server(struct sim_cfg* cfg, int j, long k, int ns)
+{
+	uint32_t key[2];
+	key[0] = (uint32_t)j;
+	key[1] = (uint32_t)k;
+	return (int)((sim_hash((uint8_t*)key, sizeof(key), 2166136261u)
+		+ (uint32_t)ns) % (uint32_t)cfg->npool);
+}
+
+/** random number from the seeded state */
+static unsigned int
+sim_random(struct sim* sim)
+{
+	/* xorshift32 */
+	unsigned int x = sim->cfg.seed;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	sim->cfg.seed = x;
+	return x;
+}
+
+/** current time in usec */
+static uint64_t
+sim_now(void)
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (uint64_t)tv.tv_sec*1000000 + (uint64_t)tv.tv_usec;
+}
+
+/** packet that is being composed */
+struct sim_pkt {
+	/** buffer */
+	uint8_t* buf;
+	/** length so far */
+	size_t len;
+	/** max length */
+	size_t max;
+	/** set if it does not fit */
+	int overflow;
+	/** counts of the answer, authority and additional sections */
+	uint16_t count[3];
+};
+
+/** the sections */
+enum sim_sec { sec_an = 0, sec_ns = 1, sec_ar = 2 };
+
+/** append bytes */
+static void
+pkt_bytes(struct sim_pkt* p, const void* d, size_t len)
+{
+	if(p->overflow || p->len + len > p->max) {
+		p->overflow = 1;
+		return;
+	}
+	memmove(p->buf+p->len, d, len);
+	p->len += len;
+}
+
+/** append an uint16 */
+static void
+pkt_u16(struct sim_pkt* p, uint16_t v)
+{
+	uint8_t d[2];
+	sldns_write_uint16(d, v);
+	pkt_bytes(p, d, 2);
+}
+
+/** append an uint32 */
+static void
+pkt_u32(struct sim_pkt* p, uint32_t v)
+{
+	uint8_t d[4];
+	sldns_write_uint32(d, v);
+	pkt_bytes(p, d, 4);
+}
+
+/** make a wire name from a printf format */
+static size_t
+sim_name(uint8_t* buf, const char* format, ...) ATTR_FORMAT(printf, 2, 3);
+
+/** make a wire name from a printf format */
+static size_t
+sim_name(uint8_t* buf, const char* format, ...)
+{
+	char str[LDNS_MAX_DOMAINLEN*2];
+	size_t len = LDNS_MAX_DOMAINLEN+1;
+	va_list args;
+	va_start(args, format);
+	vsnprintf(str, sizeof(str), format, args);
+	va_end(args);
+	if(sldns_str2wire_dname_buf(str, buf, &len) != 0)
+		fatal_exit("bad name %s", str);
+	return len;
+}
+
+/** length of a wire name */
+static size_t
+sim_namelen(const uint8_t* n)
+{
+	size_t len = 1;
+	while(*n) {
+		len += (size_t)*n + 1;
+		n += *n + 1;
+	}
+	return len;
+}
+
+/** append an RR, the rdata is already in wire format */
+static void
+pkt_rr(struct sim_pkt* p, enum sim_sec sec, const uint8_t* name,
+	uint16_t type, uint32_t ttl, const void* rdata, size_t rdlen)
+{
+	pkt_bytes(p, name, sim_namelen(name));
+	pkt_u16(p, type);
+	pkt_u16(p, LDNS_RR_CLASS_IN);
+	pkt_u32(p, ttl);
+	pkt_u16(p, (uint16_t)rdlen);
+	pkt_bytes(p, rdata, rdlen);
+	p->count[sec]++;
+}
+
+/** append an A record */
+static void
+pkt_a(struct sim_pkt* p, enum sim_sec sec, const uint8_t* name,
+	uint32_t ttl, struct in_addr a)
+{
+	pkt_rr(p, sec, name, LDNS_RR_TYPE_A, ttl, &a, 4);
+}
+
+/** append a record with a name as rdata, NS or CNAME */
+static void
+pkt_nsrr(struct sim_pkt* p, enum sim_sec sec, const uint8_t* name,
+	uint16_t type, uint32_t ttl, const uint8_t* target)
+{
+	pkt_rr(p, sec, name, type, ttl, target, sim_namelen(target));
+}
+
+/** append the SOA record of a zone */
+static void
+pkt_soa(struct sim_pkt* p, enum sim_sec sec, const uint8_t* zone,
+	uint32_t ttl)
+{
+	uint8_t rd[LDNS_MAX_DOMAINLEN*2+32];
+	size_t len = 0;
+	/* mname, rname, serial, refresh, retry, expire, minimum */
+	len += sim_name(rd+len, "ns.sim.");
+	len += sim_name(rd+len, "hostmaster.sim.");
+	sldns_write_uint32(rd+len, 1);
+	sldns_write_uint32(rd+len+4, 3600);
+	sldns_write_uint32(rd+len+8, 900);
+	sldns_write_uint32(rd+len+12, 604800);
+	sldns_write_uint32(rd+len+16, ttl);
+	len += 20;
+	pkt_rr(p, sec, zone, LDNS_RR_TYPE_SOA, ttl, rd, len);
+}
+
+/** append the root NS set, with the glue if wanted */
+static void
+pkt_root_ns(struct sim_pkt* p, struct sim_cfg* cfg, enum sim_sec sec,
+	int glue)
+{
+	uint8_t root = 0, ns[LDNS_MAX_DOMAINLEN+1];
+	int i;
+	for(i=0; i<cfg->nroot; i++) {
+		(void)sim_name(ns, "r%d.rootsrv.", i);
+		pkt_nsrr(p, sec, &root, LDNS_RR_TYPE_NS, cfg->ttl, ns);
+	}
+	for(i=0; glue && i<cfg->nroot; i++) {
+		(void)sim_name(ns, "r%d.rootsrv.", i);
+		pkt_a(p, sec_ar, ns, cfg->ttl, root_addr(cfg, i));
+	}
+}
+
+/** parse a label like t123 (prefix and a number without leading zeros),
+ * returns the number or -1 */
+static long
+sim_label_num(const uint8_t* lab, char prefix, long max)
+{
+	long v = 0;
+	int i, len = (int)lab[0];
+	if(len < 2 || lab[1] != prefix || len > 11 ||
+		(lab[2] == '0' && len > 2))
+		return -1;
+	for(i=2; i<=len; i++) {
+		if(!isdigit((unsigned char)lab[i]))
+			return -1;
+		v = v*10 + (lab[i]-'0');
+	}
+	return v < max ? v : -1;
+}
+
+/** see if a label starts with the string */
+static int
+sim_label_prefix(const uint8_t* lab, const char* s)
+{
+	size_t n = strlen(s);
+	return (size_t)lab[0] >= n && memcmp(lab+1, s, n) == 0;
+}
+
+/** see if a label is the string */
+static int
+sim_label_is(const uint8_t* lab, const char* s)
+{
+	return (size_t)lab[0] == strlen(s) && memcmp(lab+1, s, lab[0]) == 0;
+}
+
+/** the answer for a query, in sections, set by the role functions */
+struct sim_answer {
+	/** rcode */
+	int rcode;
+	/** authoritative */
+	int aa;
+	/** truncated */
+	int tc;
+	/** the packet with the sections after the question */
+	struct sim_pkt* p;
+};
+
+/** answer with the zone NS set, for apex NS queries */
+static void
+zone_ns(struct sim_pkt* p, struct sim_cfg* cfg, enum sim_sec sec,
+	const uint8_t* zone, int j, long k)
+{
+	uint8_t ns[LDNS_MAX_DOMAINLEN+1];
+	int i;
+	for(i=0; i<2; i++) {
+		if(k >= 0)
+			(void)sim_name(ns, "ns%d.d%ld.t%d.", i+1, k, j);
+		else	(void)sim_name(ns, "ns%d.nic.t%d.", i+1, j);
+		pkt_nsrr(p, sec, zone, LDNS_RR_TYPE_NS, cfg->ttl, ns);
+	}
+	for(i=0; i<2; i++) {
+		if(k >= 0) {
+			(void)sim_name(ns, "ns%d.d%ld.t%d.", i+1, k, j);
+			pkt_a(p, sec_ar, ns, cfg->ttl, pool_addr(cfg,
+				sld_server(cfg, j, k, i)));
+		} else {
+			(void)sim_name(ns, "ns%d.nic.t%d.", i+1, j);
+			pkt_a(p, sec_ar, ns, cfg->ttl, tld_addr(cfg, j, i));
+		}
+	}
+}
+
+/** answer from a root server */
+static void
+answer_root(struct sim_cfg* cfg, struct sim_answer* ans, uint8_t** labs,
+	int nlabs, const uint8_t* qname, uint16_t qtype)
+{
+	uint8_t root = 0, zone[LDNS_MAX_DOMAINLEN+1];
+	long j, i;
+	ans->aa = 1;
+	if(nlabs == 0) {
+		if(qtype == LDNS_RR_TYPE_NS)
+			pkt_root_ns(ans->p, cfg, sec_an, 1);
+		else if(qtype == LDNS_RR_TYPE_SOA)
+			pkt_soa(ans->p, sec_an, &root, cfg->ttl);
+		else	pkt_soa(ans->p, sec_ns, &root, cfg->ttl);
+		return;
+	}
+	if(sim_label_is(labs[nlabs-1], "rootsrv")) {
+		/* the root zone has the names of the root servers */
+		if(nlabs == 2 && (i=sim_label_num(labs[0], 'r', cfg->nroot))
+			>= 0) {
+			if(qtype == LDNS_RR_TYPE_A)
+				pkt_a(ans->p, sec_an, qname, cfg->ttl,
+					root_addr(cfg, (int)i));
+			else	pkt_soa(ans->p, sec_ns, &root, cfg->ttl);
+			return;
+		}
+		if(nlabs == 1) {
+			pkt_soa(ans->p, sec_ns, &root, cfg->ttl);
+			return;
+		}
+	} else if((j=sim_label_num(labs[nlabs-1], 't', cfg->ntld)) >= 0) {
+		if(nlabs == 1 && qtype == LDNS_RR_TYPE_DS) {
+			/* unsigned delegation, no DS */
+			pkt_soa(ans->p, sec_ns, &root, cfg->ttl);
+			return;
+		}
+		ans->aa = 0;
+		(void)sim_name(zone, "t%d.", (int)j);
+		zone_ns(ans->p, cfg, sec_ns, zone, (int)j, -1);
+		return;
+	}
+	ans->rcode = LDNS_RCODE_NXDOMAIN;
+	pkt_soa(ans->p, sec_ns, &root, cfg->ttl);
+}
+
+/** answer from a TLD server */
+static void
+answer_tld(struct sim_cfg* cfg, struct sim_server* srv,
+	struct sim_answer* ans, uint8_t** labs, int nlabs,
+	const uint8_t* qname, uint16_t qtype)
+{
+	uint8_t zone[LDNS_MAX_DOMAINLEN+1], sub[LDNS_MAX_DOMAINLEN+1];
+	long k;
+	if(nlabs == 0 || sim_label_num(labs[nlabs-1], 't', cfg->ntld)
+		!= srv->idx) {
+		ans->rcode = LDNS_RCODE_REFUSED;
+		return;
+	}
+	ans->aa = 1;
+	(void)sim_name(zone, "t%d.", srv->idx);
+	if(nlabs == 1) {
+		if(qtype == LDNS_RR_TYPE_NS)
+			zone_ns(ans->p, cfg, sec_an, zone, srv->idx, -1);
+		else if(qtype == LDNS_RR_TYPE_SOA)
+			pkt_soa(ans->p, sec_an, zone, cfg->ttl);
+		else	pkt_soa(ans->p, sec_ns, zone, cfg->ttl);
+		return;
+	}
+	if(sim_label_is(labs[nlabs-2], "nic")) {
+		if(nlabs == 3 && (sim_label_is(labs[0], "ns1") ||
+			sim_label_is(labs[0], "ns2"))) {
+			if(qtype == LDNS_RR_TYPE_A)
+				pkt_a(ans->p, sec_an, qname, cfg->ttl,
+					tld_addr(cfg, srv->idx, labs[0][3]-'1'));
+			else	pkt_soa(ans->p, sec_ns, zone, cfg->ttl);
+			return;
+		}
+		if(nlabs == 2) {
+			/* empty nonterminal */
+			pkt_soa(ans->p, sec_ns, zone, cfg->ttl);
+			return;
+		}
+	} else if((k=sim_label_num(labs[nlabs-2], 'd', cfg->nsld)) >= 0) {
+		if(nlabs == 2 && qtype == LDNS_RR_TYPE_DS) {
+			pkt_soa(ans->p, sec_ns, zone, cfg->ttl);
+			return;
+		}
+		ans->aa = 0;
+		(void)sim_name(sub, "d%ld.t%d.", k, srv->idx);
+		zone_ns(ans->p, cfg, sec_ns, sub, srv->idx, k);
+		return;
+	}
+	ans->rcode = LDNS_RCODE_NXDOMAIN;
+	pkt_soa(ans->p, sec_ns, zone, cfg->ttl);
+}
+
+/** answer from a second level server */
+static void
+answer_sld(struct sim_cfg* cfg, struct sim_server* srv,
+	struct sim_answer* ans, uint8_t** labs, int nlabs,
+	const uint8_t* qname, uint16_t qtype)
+{
+	uint8_t zone[LDNS_MAX_DOMAINLEN+1], target[LDNS_MAX_DOMAINLEN+1];
+	struct in_addr a;
+	uint8_t a6[16];
+	uint32_t h;
+	long j, k;
+	if(nlabs < 2 || (j=sim_label_num(labs[nlabs-1], 't', cfg->ntld)) < 0
+		|| (k=sim_label_num(labs[nlabs-2], 'd', cfg->nsld)) < 0) {
+		ans->rcode = LDNS_RCODE_REFUSED;
+		return;
+	}
+	if(srv->lame) {
+		/* upward referral, without the AA flag */
+		pkt_root_ns(ans->p, cfg, sec_ns, 1);
+		return;
+	}
+	ans->aa = 1;
+	(void)sim_name(zone, "d%ld.t%d.", k, (int)j);
+	h = sim_hash(qname, sim_namelen(qname), 2166136261u);
+	a.s_addr = htonl((10u<<24) | (h&0x00ffffff));
+	memset(a6, 0, sizeof(a6));
+	a6[0] = 0xfd;
+	memmove(a6+12, &h, 4);
+	if(nlabs == 2) {
+		if(qtype == LDNS_RR_TYPE_NS)
+			zone_ns(ans->p, cfg, sec_an, zone, (int)j, k);
+		else if(qtype == LDNS_RR_TYPE_SOA)
+			pkt_soa(ans->p, sec_an, zone, cfg->ttl);
+		else if(qtype == LDNS_RR_TYPE_A)
+			pkt_a(ans->p, sec_an, qname, cfg->ttl, a);
+		else	pkt_soa(ans->p, sec_ns, zone, cfg->ttl);
+		return;
+	}
+	if(nlabs == 3 && (sim_label_is(labs[0], "ns1") ||
+		sim_label_is(labs[0], "ns2"))) {
+		if(qtype == LDNS_RR_TYPE_A)
+			pkt_a(ans->p, sec_an, qname, cfg->ttl, pool_addr(cfg,
+				sld_server(cfg, (int)j, k, labs[0][3]-'1')));
+		else	pkt_soa(ans->p, sec_ns, zone, cfg->ttl);
+		return;
+	}
+	if(sim_label_prefix(labs[nlabs-3], "nx")) {
+		ans->rcode = LDNS_RCODE_NXDOMAIN;
+		pkt_soa(ans->p, sec_ns, zone, cfg->ttl);
+		return;
+	}
+	if(sim_label_prefix(labs[nlabs-3], "cname")) {
+		(void)sim_name(target, "www.d%ld.t%d.", (k+1)%cfg->nsld,
+			(int)j);
+		pkt_nsrr(ans->p, sec_an, qname, LDNS_RR_TYPE_CNAME, cfg->ttl,
+			target);
+		return;
+	}
+	if(qtype == LDNS_RR_TYPE_A)
+		pkt_a(ans->p, sec_an, qname, cfg->ttl, a);
+	else if(qtype == LDNS_RR_TYPE_AAAA)
+		pkt_rr(ans->p, sec_an, qname, LDNS_RR_TYPE_AAAA, cfg->ttl,
+			a6, sizeof(a6));
+	else	pkt_soa(ans->p, sec_ns, zone, cfg->ttl);
+}
+
+/**
+ * Make the reply to a query.
+ * @return length of the reply, or 0 if there is no reply.
+ */
+static size_t
+sim_reply(struct sim* sim, struct sim_server* srv, int tcp, uint8_t* q,
+	size_t qlen, uint8_t* out, size_t outmax)
+{
+	uint8_t lower[LDNS_MAX_DOMAINLEN+1], *labs[128];
+	size_t pos = LDNS_HEADER_SIZE, qnamelen, i, max = 512, qend;
+	int nlabs = 0, edns = 0;
+	uint16_t qtype;
+	struct sim_pkt p;
+	struct sim_answer ans;
+
+	if(qlen < LDNS_HEADER_SIZE || LDNS_QR_WIRE(q) ||
+		LDNS_OPCODE_WIRE(q) != LDNS_PACKET_QUERY ||
+		LDNS_QDCOUNT(q) != 1)
+		return 0;
+	/* the query name, lowercased, with pointers to the labels */
+	while(pos < qlen && q[pos] != 0) {
+		if((q[pos]&0xc0) || pos + q[pos] + 1 > qlen ||
+			pos - LDNS_HEADER_SIZE + q[pos] + 1 >
+			LDNS_MAX_DOMAINLEN || nlabs >= 128)
+			return 0;
+		labs[nlabs++] = lower + (pos - LDNS_HEADER_SIZE);
+		pos += q[pos] + 1;
+	}
+	if(pos + 5 > qlen)
+		return 0;
+	qnamelen = pos + 1 - LDNS_HEADER_SIZE;
+	for(i=0; i<qnamelen; i++)
+		lower[i] = (uint8_t)tolower((unsigned char)q[
+			LDNS_HEADER_SIZE+i]);
+	/* label length bytes are below 64, not changed by tolower */
+	qtype = sldns_read_uint16(q+pos+1);
+	qend = pos + 5;
+	if(LDNS_ARCOUNT(q) >= 1 && qend + 11 <= qlen && q[qend] == 0 &&
+		sldns_read_uint16(q+qend+1) == LDNS_RR_TYPE_OPT) {
+		edns = 1;
+		max = sldns_read_uint16(q+qend+3);
+		if(max < 512) max = 512;
+	}
+	if(tcp) max = 65535;
+	if(max > outmax) max = outmax;
+	if(qend > max)
+		return 0;
+
+	/* header and question */
+	memmove(out, q, qend);
+	LDNS_QR_SET(out);
+	LDNS_AA_CLR(out);
+	LDNS_TC_CLR(out);
+	LDNS_RA_CLR(out);
+	LDNS_AD_CLR(out);
+	LDNS_Z_CLR(out);
+	LDNS_RCODE_SET(out, LDNS_RCODE_NOERROR);
+	memset(&p, 0, sizeof(p));
+	p.buf = out;
+	p.len = qend;
+	p.max = max - (edns?11:0);
+	memset(&ans, 0, sizeof(ans));
+	ans.p = &p;
+
+	if(srv->role == sim_sld && srv->tcponly && !tcp) {
+		ans.tc = 1;
+		sim->stats[srv->role].truncated++;
+	} else if(srv->role == sim_root) {
+		answer_root(&sim->cfg, &ans, labs, nlabs, lower, qtype);
+	} else if(srv->role == sim_tld) {
+		answer_tld(&sim->cfg, srv, &ans, labs, nlabs, lower, qtype);
+	} else {
+		answer_sld(&sim->cfg, srv, &ans, labs, nlabs, lower, qtype);
+		if(srv->lame)
+			sim->stats[srv->role].lame++;
+	}
+	if(p.overflow) {
+		/* only the question, with TC */
+		p.len = qend;
+		memset(p.count, 0, sizeof(p.count));
+		ans.tc = 1;
+	}
+	p.overflow = 0;
+	p.max = max;
+	if(edns) {
+		/* OPT record, udp size 4096 */
+		uint8_t root = 0;
+		pkt_rr(&p, sec_ar, &root, LDNS_RR_TYPE_OPT, 0, NULL, 0);
+		sldns_write_uint16(out+p.len-8, 4096);
+	}
+	if(ans.aa) LDNS_AA_SET(out);
+	if(ans.tc) LDNS_TC_SET(out);
+	LDNS_RCODE_SET(out, ans.rcode);
+	sldns_write_uint16(out+6, p.count[sec_an]);
+	sldns_write_uint16(out+8, p.count[sec_ns]);
+	sldns_write_uint16(out+10, p.count[sec_ar]);
+	return p.len;
+}
+
+/** swap two heap items */
+static void
+heap_swap(struct sim* sim, size_t a, size_t b)
+{
+	struct sim_delayed* t = sim->heap[a];
+	sim->heap[a] = sim->heap[b];
+	sim->heap[b] = t;
+}
+
+/** add a delayed reply to the heap */
+static void
+heap_add(struct sim* sim, struct sim_delayed* d)
+{
+	size_t i;
+	if(sim->heap_num == sim->heap_max) {
+		size_t n = sim->heap_max?sim->heap_max*2:1024;
+		struct sim_delayed** h = (struct sim_delayed**)realloc(
+			sim->heap, n*sizeof(*h));
+		if(!h) fatal_exit("out of memory");
+		sim->heap = h;
+		sim->heap_max = n;
+	}
+	i = sim->heap_num++;
+	sim->heap[i] = d;
+	while(i > 0 && sim->heap[(i-1)/2]->when > sim->heap[i]->when) {
+		heap_swap(sim, i, (i-1)/2);
+		i = (i-1)/2;
+	}
+}
+
+/** remove the first delayed reply from the heap */
+static struct sim_delayed*
+heap_pop(struct sim* sim)
+{
+	struct sim_delayed* d = sim->heap[0];
+	size_t i = 0, c;
+	sim->heap[0] = sim->heap[--sim->heap_num];
+	while((c = 2*i+1) < sim->heap_num) {
+		if(c+1 < sim->heap_num && sim->heap[c+1]->when <
+			sim->heap[c]->when)
+			c++;
+		if(sim->heap[i]->when <= sim->heap[c]->when)
+			break;
+		heap_swap(sim, i, c);
+		i = c;
+	}
+	return d;
+}
+
+/** write a message on a TCP connection */
+static void
+tcp_write(struct sim_tcp* c, uint8_t* pkt, size_t len)
+{
+	uint8_t pre[2];
+	size_t done = 0;
+	ssize_t r;
+	sldns_write_uint16(pre, (uint16_t)len);
+	/* small messages on loopback, wait for them to be written */
+	fd_set_block(c->fd);
+	if(send(c->fd, (void*)pre, 2, 0) != 2) {
+		fd_set_nonblock(c->fd);
+		return;
+	}
+	while(done < len) {
+		r = send(c->fd, (void*)(pkt+done), len-done, 0);
+		if(r <= 0)
+			break;
+		done += (size_t)r;
+	}
+	fd_set_nonblock(c->fd);
+}
+
+/** send a reply now or after the latency of the role */
+static void
+sim_send(struct sim* sim, struct sim_server* srv, int slot, uint8_t* pkt,
+	size_t len, struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	struct sim_delayed* d;
+	int delay = sim->cfg.delay[srv->role];
+	sim->stats[srv->role].answers++;
+	if(delay == 0) {
+		if(slot == -1) {
+			if(sendto(srv->udp, (void*)pkt, len, 0,
+				(struct sockaddr*)addr, addrlen) == -1)
+				verbose(VERB_ALGO, "sendto: %s",
+					strerror(errno));
+		} else	tcp_write(&sim->conns[slot], pkt, len);
+		return;
+	}
+	d = (struct sim_delayed*)malloc(sizeof(*d));
+	if(!d) fatal_exit("out of memory");
+	d->pkt = memdup(pkt, len);
+	if(!d->pkt) fatal_exit("out of memory");
+	/* latency with 10% jitter */
+	d->when = sim_now() + (uint64_t)delay*1000 +
+		(uint64_t)(sim_random(sim)%((unsigned)delay*100+1));
+	d->udp = (slot == -1)?srv->udp:-1;
+	d->slot = slot;
+	d->gen = (slot == -1)?0:sim->conns[slot].gen;
+	if(slot == -1)
+		memmove(&d->addr, addr, addrlen);
+	d->addrlen = addrlen;
+	d->len = len;
+	heap_add(sim, d);
+}
+
+/** send the delayed replies whose time has come, returns the msec to
+ * wait for the next one, or -1 */
+static int
+sim_send_delayed(struct sim* sim)
+{
+	uint64_t now = sim_now();
+	struct sim_delayed* d;
+	while(sim->heap_num > 0 && sim->heap[0]->when <= now) {
+		d = heap_pop(sim);
+		if(d->udp != -1) {
+			if(sendto(d->udp, (void*)d->pkt, d->len, 0,
+				(struct sockaddr*)&d->addr, d->addrlen) == -1)
+				verbose(VERB_ALGO, "sendto: %s",
+					strerror(errno));
+		} else if(sim->conns[d->slot].fd != -1 &&
+			sim->conns[d->slot].gen == d->gen) {
+			tcp_write(&sim->conns[d->slot], d->pkt, d->len);
+		}
+		free(d->pkt);
+		free(d);
+	}
+	if(sim->heap_num == 0)
+		return -1;
+	return (int)((sim->heap[0]->when - now + 999)/1000);
+}
+
+/** handle a query, with the loss of the role */
+static void
+sim_query(struct sim* sim, struct sim_server* srv, int slot, uint8_t* q,
+	size_t qlen, struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	static uint8_t out[SIM_BUFSIZE];
+	size_t len;
+	sim->stats[srv->role].queries++;
+	if(slot != -1)
+		sim->stats[srv->role].tcp++;
+	if(sim->cfg.loss[srv->role] && (int)(sim_random(sim)%100) <
+		sim->cfg.loss[srv->role]) {
+		sim->stats[srv->role].dropped++;
+		return;
+	}
+	len = sim_reply(sim, srv, slot != -1, q, qlen, out, sizeof(out));
+	if(len)
+		sim_send(sim, srv, slot, out, len, addr, addrlen);
+}
+
+/** read queries from an UDP socket */
+static void
+sim_read_udp(struct sim* sim, struct sim_server* srv)
+{
+	static uint8_t q[SIM_BUFSIZE];
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	ssize_t r;
+	int i;
+	for(i=0; i<100; i++) {
+		addrlen = (socklen_t)sizeof(addr);
+		r = recvfrom(srv->udp, (void*)q, sizeof(q), 0,
+			(struct sockaddr*)&addr, &addrlen);
+		if(r <= 0)
+			return;
+		sim_query(sim, srv, -1, q, (size_t)r, &addr, addrlen);
+	}
+}
+
+/** accept a TCP connection */
+static void
+sim_accept(struct sim* sim, struct sim_server* srv)
+{
+	int s, i;
+	s = accept(srv->tcp, NULL, NULL);
+	if(s == -1)
+		return;
+	for(i=0; i<SIM_MAX_TCP; i++) {
+		if(sim->conns[i].fd == -1) {
+			fd_set_nonblock(s);
+			sim->conns[i].fd = s;
+			sim->conns[i].gen++;
+			sim->conns[i].srv = srv;
+			sim->conns[i].len = 0;
+			return;
+		}
+	}
+	log_warn("too many TCP connections");
+	close(s);
+}
+
+/** close a TCP connection */
+static void
+sim_tcp_close(struct sim_tcp* c)
+{
+	close(c->fd);
+	c->fd = -1;
+	c->len = 0;
+}
+
+/** read from a TCP connection, handle the queries in it */
+static void
+sim_read_tcp(struct sim* sim, int slot)
+{
+	struct sim_tcp* c = &sim->conns[slot];
+	size_t want;
+	ssize_t r;
+	while(1) {
+		want = (c->len < 2)?2:(size_t)sldns_read_uint16(c->buf)+2;
+		r = recv(c->fd, (void*)(c->buf+c->len), want-c->len, 0);
+		if(r == 0 || (r == -1 && errno != EAGAIN && errno != EINTR
+#ifdef EWOULDBLOCK
+			&& errno != EWOULDBLOCK
+#endif
+			)) {
+			sim_tcp_close(c);
+			return;
+		}
+		if(r == -1)
+			return;
+		c->len += (size_t)r;
+		if(c->len >= 2 && c->len == (size_t)sldns_read_uint16(
+			c->buf)+2) {
+			sim_query(sim, c->srv, slot, c->buf+2, c->len-2,
+				NULL, 0);
+			c->len = 0;
+			if(c->fd == -1)
+				return;
+		}
+	}
+}
+
+/** open the sockets of a server */
+static void
+sim_open(struct sim* sim, struct sim_server* srv)
+{
+	struct sockaddr_in sa;
+	int on = 1;
+	char a[32];
+	memset(&sa, 0, sizeof(sa));
+	sa.sin_family = AF_INET;
+	sa.sin_port = htons((uint16_t)sim->cfg.port);
+	sa.sin_addr = srv->addr;
+	addr_to_str((struct sockaddr_storage*)&sa, (socklen_t)sizeof(sa),
+		a, sizeof(a));
+	if((srv->udp = socket(AF_INET, SOCK_DGRAM, 0)) == -1 ||
+		(srv->tcp = socket(AF_INET, SOCK_STREAM, 0)) == -1)
+		fatal_exit("socket: %s", strerror(errno));
+	(void)setsockopt(srv->tcp, SOL_SOCKET, SO_REUSEADDR, (void*)&on,
+		(socklen_t)sizeof(on));
+	if(bind(srv->udp, (struct sockaddr*)&sa, (socklen_t)sizeof(sa)) == -1
+		|| bind(srv->tcp, (struct sockaddr*)&sa,
+		(socklen_t)sizeof(sa)) == -1)
+		fatal_exit("bind %s port %d: %s", a, sim->cfg.port,
+			strerror(errno));
+	if(listen(srv->tcp, 64) == -1)
+		fatal_exit("listen: %s", strerror(errno));
+	fd_set_nonblock(srv->udp);
+	fd_set_nonblock(srv->tcp);
+}
+
+/** set up the servers of the hierarchy */
+static void
+sim_setup(struct sim* sim)
+{
+	struct sim_cfg* cfg = &sim->cfg;
+	int i, n = 0;
+	uint32_t h;
+	sim->nservers = cfg->nroot + 2*cfg->ntld + cfg->npool;
+	sim->servers = (struct sim_server*)calloc((size_t)sim->nservers,
+		sizeof(struct sim_server));
+	sim->conns = (struct sim_tcp*)calloc(SIM_MAX_TCP,
+		sizeof(struct sim_tcp));
+	if(!sim->servers || !sim->conns)
+		fatal_exit("out of memory");
+	for(i=0; i<SIM_MAX_TCP; i++)
+		sim->conns[i].fd = -1;
+	for(i=0; i<cfg->nroot; i++, n++) {
+		sim->servers[n].role = sim_root;
+		sim->servers[n].idx = i;
+		sim->servers[n].addr = root_addr(cfg, i);
+	}
+	for(i=0; i<2*cfg->ntld; i++, n++) {
+		sim->servers[n].role = sim_tld;
+		sim->servers[n].idx = i/2;
+		sim->servers[n].addr = tld_addr(cfg, i/2, i%2);
+	}
+	for(i=0; i<cfg->npool; i++, n++) {
+		sim->servers[n].role = sim_sld;
+		sim->servers[n].idx = i;
+		sim->servers[n].addr = pool_addr(cfg, i);
+		/* the same servers are TCP-only and lame in every run */
+		h = sim_hash((uint8_t*)&i, sizeof(i), 2166136261u);
+		sim->servers[n].tcponly = (int)(h%100) < cfg->tcponly;
+		sim->servers[n].lame = (int)((h/100)%100) < cfg->lame;
+	}
+	for(i=0; i<sim->nservers; i++)
+		sim_open(sim, &sim->servers[i]);
+}
+
+/** print the root hints */
+static void
+sim_print_hints(struct sim_cfg* cfg)
+{
+	char a[32];
+	struct in_addr r;
+	int i;
+	for(i=0; i<cfg->nroot; i++)
+		printf(".			%u	IN	NS	r%d.rootsrv.\n",
+			(unsigned)cfg->ttl, i);
+	for(i=0; i<cfg->nroot; i++) {
+		r = root_addr(cfg, i);
+		if(!inet_ntop(AF_INET, &r, a, (socklen_t)sizeof(a)))
+			a[0] = 0;
+		printf("r%d.rootsrv.		%u	IN	A	%s\n", i,
+			(unsigned)cfg->ttl, a);
+	}
+}
+
+/** print statistics */
+static void
+sim_print_stats(struct sim* sim)
+{
+	int i;
+	for(i=0; i<sim_role_max; i++) {
+		printf("%s: queries %u answers %u dropped %u tcp %u "
+			"truncated %u lame %u\n", sim_role_name[i],
+			(unsigned)sim->stats[i].queries,
+			(unsigned)sim->stats[i].answers,
+			(unsigned)sim->stats[i].dropped,
+			(unsigned)sim->stats[i].tcp,
+			(unsigned)sim->stats[i].truncated,
+			(unsigned)sim->stats[i].lame);
+	}
+}
+
+/** signal handler */
+static RETSIGTYPE
+sim_sigh(int sig)
+{
+	(void)sig;
+	sim_exit = 1;
+}
+
+/** serve queries until a signal */
+static void
+service(struct sim* sim)
+{
+	struct pollfd* fds;
+	int* slots, i, n, timeout;
+	size_t max = (size_t)sim->nservers*2 + SIM_MAX_TCP;
+	fds = (struct pollfd*)calloc(max, sizeof(*fds));
+	slots = (int*)calloc(max, sizeof(int));
+	if(!fds || !slots)
+		fatal_exit("out of memory");
+	while(!sim_exit) {
+		n = 0;
+		for(i=0; i<sim->nservers; i++) {
+			fds[n].fd = sim->servers[i].udp;
+			fds[n].events = POLLIN;
+			slots[n++] = -1;
+			fds[n].fd = sim->servers[i].tcp;
+			fds[n].events = POLLIN;
+			slots[n++] = -1;
+		}
+		for(i=0; i<SIM_MAX_TCP; i++) {
+			if(sim->conns[i].fd == -1)
+				continue;
+			fds[n].fd = sim->conns[i].fd;
+			fds[n].events = POLLIN;
+			slots[n++] = i;
+		}
+		timeout = sim_send_delayed(sim);
+		if(poll(fds, (nfds_t)n, timeout) == -1) {
+			if(errno == EINTR)
+				continue;
+			fatal_exit("poll: %s", strerror(errno));
+		}
+		for(i=0; i<n; i++) {
+			if(!(fds[i].revents & (POLLIN|POLLHUP|POLLERR)))
+				continue;
+			if(slots[i] != -1)
+				sim_read_tcp(sim, slots[i]);
+			else if(i%2 == 0)
+				sim_read_udp(sim, &sim->servers[i/2]);
+			else	sim_accept(sim, &sim->servers[i/2]);
+		}
+	}
+	free(fds);
+	free(slots);
+}
+
+/** parse a role:value option */
+static void
+parse_role_opt(const char* arg, int* vals, char* argv[])
+{
+	int i;
+	const char* v = strchr(arg, ':');
+	if(!v)
+		usage(argv);
+	for(i=0; i<sim_role_max; i++) {
+		if(strncmp(arg, sim_role_name[i], (size_t)(v-arg)) == 0 &&
+			strlen(sim_role_name[i]) == (size_t)(v-arg)) {
+			vals[i] = atoi(v+1);
+			return;
+		}
+	}
+	usage(argv);
+}
+
+/** getopt global, in case header files fail to declare it. */
+extern int optind;
+/** getopt global, in case header files fail to declare it. */
+extern char* optarg;
+
+/** main program for authsim */
+int main(int argc, char** argv)
+{
+	int c, hints = 0, i;
+	struct sim sim;
+	memset(&sim, 0, sizeof(sim));
+	sim.cfg.net[0] = 127;
+	sim.cfg.net[1] = 53;
+	sim.cfg.port = 53;
+	sim.cfg.nroot = 2;
+	sim.cfg.ntld = 10;
+	sim.cfg.nsld = 100000;
+	sim.cfg.npool = 64;
+	sim.cfg.ttl = 3600;
+	sim.cfg.seed = 1;
+
+	verbosity = 0;
+	log_init(0, 0, 0);
+	log_ident_set("authsim");
+	while( (c=getopt(argc, argv, "a:c:d:hHl:L:n:p:r:s:S:t:T:")) != -1) {
+		switch(c) {
+			case 'a':
+				if(sscanf(optarg, "%d.%d", &sim.cfg.net[0],
+					&sim.cfg.net[1]) != 2)
+					usage(argv);
+				break;
+			case 'c':
+				sim.cfg.tcponly = atoi(optarg);
+				break;
+			case 'd':
+				parse_role_opt(optarg, sim.cfg.loss, argv);
+				break;
+			case 'H':
+				hints = 1;
+				break;
+			case 'l':
+				parse_role_opt(optarg, sim.cfg.delay, argv);
+				break;
+			case 'L':
+				sim.cfg.lame = atoi(optarg);
+				break;
+			case 'n':
+				sim.cfg.nsld = atol(optarg);
+				break;
+			case 'p':
+				sim.cfg.port = atoi(optarg);
+				break;
+			case 'r':
+				sim.cfg.nroot = atoi(optarg);
+				break;
+			case 's':
+				sim.cfg.npool = atoi(optarg);
+				break;
+			case 'S':
+				sim.cfg.seed = (unsigned)atoi(optarg);
+				break;
+			case 't':
+				sim.cfg.ntld = atoi(optarg);
+				break;
+			case 'T':
+				sim.cfg.ttl = (uint32_t)atoi(optarg);
+				break;
+			case 'h':
+			case '?':
+			default:
+				usage(argv);
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if(argc != 0)
+		usage(argv);
+	if(sim.cfg.nroot < 1 || sim.cfg.nroot > SIM_PER_NET ||
+		sim.cfg.ntld < 1 || sim.cfg.ntld > SIM_PER_NET ||
+		sim.cfg.nsld < 1 || sim.cfg.npool < 1 ||
+		sim.cfg.npool > (255-SIM_SLD_NET)*SIM_PER_NET ||
+		sim.cfg.seed == 0) {
+		printf("bad numbers of servers or zones\n");
+		return 1;
+	}
+	if(hints) {
+		sim_print_hints(&sim.cfg);
+		return 0;
+	}
+
+	sim_setup(&sim);
+	printf("authsim: %d roots, %d tlds, %ld zones per tld on %d servers, "
+		"%d.%d.x.y port %d\n", sim.cfg.nroot, sim.cfg.ntld,
+		sim.cfg.nsld, sim.cfg.npool, sim.cfg.net[0], sim.cfg.net[1],
+		sim.cfg.port);
+	for(i=0; i<sim_role_max; i++)
+		printf("%s: latency %d msec, loss %d%%\n", sim_role_name[i],
+			sim.cfg.delay[i], sim.cfg.loss[i]);
+	fflush(stdout);
+	(void)signal(SIGINT, sim_sigh);
+	(void)signal(SIGTERM, sim_sigh);
+#ifdef SIGPIPE
+	(void)signal(SIGPIPE, SIG_IGN);
+#endif
+	service(&sim);
+	sim_print_stats(&sim);
+	return 0;
+}
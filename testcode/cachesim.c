@@ -0,0 +1,520 @@
+/*
+ * testcode/cachesim.c - replay replies against caches of different sizes.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This program replays a capture of DNS replies against message and
+ * RRset caches of several sizes and slab counts, and prints the hit
+ * ratio for every one of them.  It uses the slabhash, the size functions
+ * and the dns cache store and lookup routines of the daemon, so the
+ * memory accounting and the LRU eviction are the real ones, with the
+ * TTLs taken from the replies.  Every reply is first looked up, as the
+ * query for it; on a miss it is stored.
+ *
+ * The input is a pcap file with UDP replies from port 53, or a text file
+ * with a line per reply: the time in seconds and the packet in hex.
+ */
+
+#include "config.h"
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+#include <ctype.h>
+#include "util/log.h"
+#include "util/alloc.h"
+#include "util/regional.h"
+#include "util/config_file.h"
+#include "util/module.h"
+#include "util/net_help.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/storage/slabhash.h"
+#include "services/cache/dns.h"
+#include "services/cache/rrset.h"
+#include "testcode/readhex.h"
+#include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
+
+/** max number of simulated caches */
+#define SIM_MAX_CACHES 256
+/** size of the caches for the unbounded run */
+#define SIM_UNBOUNDED ((size_t)1 << (sizeof(size_t)*8 - 2))
+
+/** a simulated cache */
+struct sim_cache {
+	/** the module env with the message and rrset caches */
+	struct module_env env;
+	/** alloc for the rrsets */
+	struct alloc_cache alloc;
+	/** time now, the time of the reply */
+	time_t now;
+	/** size of the message cache */
+	size_t msg_size;
+	/** size of the rrset cache */
+	size_t rrset_size;
+	/** number of slabs */
+	size_t slabs;
+	/** lookups */
+	size_t queries;
+	/** lookups answered from the cache */
+	size_t hits;
+};
+
+/** the simulation */
+struct sim {
+	/** the caches */
+	struct sim_cache* caches[SIM_MAX_CACHES];
+	/** number of caches */
+	int num;
+	/** config with the defaults, for the cache routines */
+	struct config_file* cfg;
+	/** alloc for parsing */
+	struct alloc_cache alloc;
+	/** region for parsing */
+	struct regional* region;
+	/** scratch region for the lookups */
+	struct regional* scratch;
+	/** replies read */
+	size_t replies;
+	/** replies skipped, they do not parse or are not cached */
+	size_t skipped;
+	/** replies to skip for the warm up */
+	size_t warmup;
+	/** print progress every so many replies, or 0 */
+	size_t progress;
+};
+
+/** usage information for cachesim */
+static void usage(char* nm)
+{
+	printf("usage: %s [options] file\n", nm);
+	printf("	replays DNS replies against caches of different sizes.\n");
+	printf("	file is a pcap capture with UDP replies from port 53,\n");
+	printf("	or text with a line per reply: <time> <packet in hex>.\n");
+	printf("-m sizes	msg-cache-size values, comma separated,\n");
+	printf("		default 1m,2m,4m,8m,16m,32m,64m,128m.\n");
+	printf("-r ratio	rrset-cache-size is ratio times msg-cache-size,\n");
+	printf("		default 2.\n");
+	printf("-s slabs	slab counts, comma separated, powers of 2,\n");
+	printf("		default 4.\n");
+	printf("-w num		warm up: do not count the first num replies.\n");
+	printf("-p num		print the hit ratios every num replies.\n");
+	printf("-h		this help message\n");
+	printf("Also prints an unbounded cache, where only the TTLs limit "
+		"the hits.\n");
+	exit(1);
+}
+
+/** create a simulated cache */
+static struct sim_cache*
+sim_cache_create(struct sim* sim, size_t msg_size, size_t rrset_size,
+	size_t slabs)
+{
+	struct sim_cache* c = (struct sim_cache*)calloc(1, sizeof(*c));
+	if(!c)
+		fatal_exit("out of memory");
+	c->msg_size = msg_size;
+	c->rrset_size = rrset_size;
+	c->slabs = slabs;
+	alloc_init(&c->alloc, NULL, 0);
+	c->env.cfg = sim->cfg;
+	c->env.now = &c->now;
+	c->env.alloc = &c->alloc;
+	c->env.msg_cache = slabhash_create(slabs, HASH_DEFAULT_STARTARRAY,
+		msg_size, msgreply_sizefunc, query_info_compare,
+		query_entry_delete, reply_info_delete, NULL);
+	sim->cfg->rrset_cache_slabs = slabs;
+	sim->cfg->rrset_cache_size = rrset_size;
+	c->env.rrset_cache = rrset_cache_create(sim->cfg, &c->alloc);
+	if(!c->env.msg_cache || !c->env.rrset_cache)
+		fatal_exit("out of memory");
+	return c;
+}
+
+/** delete a simulated cache */
+static void
+sim_cache_delete(struct sim_cache* c)
+{
+	slabhash_delete(c->env.msg_cache);
+	rrset_cache_delete(c->env.rrset_cache);
+	alloc_clear(&c->alloc);
+	free(c);
+}
+
+/** add the caches for the lists of sizes and slabs */
+static void
+sim_setup(struct sim* sim, char* sizes, char* slabs, double ratio)
+{
+	char* s, *l, *next_s, *next_l;
+	size_t msg_size, nslabs;
+	for(l = slabs; l; l = next_l) {
+		if((next_l = strchr(l, ',')) != NULL)
+			*next_l++ = 0;
+		nslabs = (size_t)atoi(l);
+		if(nslabs == 0 || (nslabs & (nslabs-1)) != 0)
+			fatal_exit("slabs %s is not a power of 2", l);
+		for(s = sizes; s; s = next_s) {
+			if((next_s = strchr(s, ',')) != NULL)
+				*next_s = 0;
+			if(!cfg_parse_memsize(s, &msg_size))
+				fatal_exit("bad size %s", s);
+			if(sim->num == SIM_MAX_CACHES)
+				fatal_exit("too many caches");
+			sim->caches[sim->num++] = sim_cache_create(sim,
+				msg_size, (size_t)((double)msg_size*ratio),
+				nslabs);
+			/* put the comma back for the next slab count */
+			if(next_s)
+				*next_s++ = ',';
+		}
+	}
+	sim->caches[sim->num++] = sim_cache_create(sim, SIM_UNBOUNDED,
+		SIM_UNBOUNDED, 1);
+}
+
+/** replay one reply on the caches */
+static void
+sim_reply(struct sim* sim, sldns_buffer* pkt, time_t now)
+{
+	struct query_info qinf;
+	struct reply_info* rep = NULL;
+	struct edns_data edns;
+	uint8_t* p = sldns_buffer_begin(pkt);
+	int i, rcode;
+	sim->replies++;
+	if(sldns_buffer_limit(pkt) < LDNS_HEADER_SIZE || !LDNS_QR_WIRE(p) ||
+		LDNS_TC_WIRE(p) || LDNS_OPCODE_WIRE(p) != LDNS_PACKET_QUERY ||
+		((rcode = LDNS_RCODE_WIRE(p)) != LDNS_RCODE_NOERROR &&
+		rcode != LDNS_RCODE_NXDOMAIN) ||
+		reply_info_parse(pkt, &sim->alloc, &qinf, &rep, sim->region,
+		&edns) != 0 || !qinf.qname) {
+		sim->skipped++;
+		reply_info_parsedelete(rep, &sim->alloc);
+		regional_free_all(sim->region);
+		return;
+	}
+	for(i=0; i<sim->num; i++) {
+		struct sim_cache* c = sim->caches[i];
+		c->now = now;
+		if(sim->replies > sim->warmup)
+			c->queries++;
+		if(dns_cache_lookup(&c->env, qinf.qname, qinf.qname_len,
+			qinf.qtype, qinf.qclass, 0, sim->scratch,
+			sim->scratch)) {
+			if(sim->replies > sim->warmup)
+				c->hits++;
+		} else {
+			/* no region, the parsed reply is kept unchanged
+			 * for the other caches */
+			(void)dns_cache_store(&c->env, &qinf, rep, 0, 0, 0,
+				NULL, 0);
+		}
+		regional_free_all(sim->scratch);
+	}
+	query_info_clear(&qinf);
+	reply_info_parsedelete(rep, &sim->alloc);
+	regional_free_all(sim->region);
+}
+
+/** print a size with a unit */
+static void
+sim_print_size(char* buf, size_t len, size_t v)
+{
+	if(v == SIM_UNBOUNDED)
+		snprintf(buf, len, "unbounded");
+	else if(v >= 1024*1024 && v%(1024*1024) == 0)
+		snprintf(buf, len, "%um", (unsigned)(v/(1024*1024)));
+	else if(v >= 1024 && v%1024 == 0)
+		snprintf(buf, len, "%uk", (unsigned)(v/1024));
+	else	snprintf(buf, len, "%u", (unsigned)v);
+}
+
+/** print the hit ratios */
+static void
+sim_print(struct sim* sim)
+{
+	char m[32], r[32];
+	int i;
+	printf("# replies %u skipped %u warmup %u\n", (unsigned)sim->replies,
+		(unsigned)sim->skipped, (unsigned)sim->warmup);
+	printf("# msg-cache-size rrset-cache-size slabs queries hits "
+		"hit%% msg-mem rrset-mem\n");
+	for(i=0; i<sim->num; i++) {
+		struct sim_cache* c = sim->caches[i];
+		sim_print_size(m, sizeof(m), c->msg_size);
+		sim_print_size(r, sizeof(r), c->rrset_size);
+		printf("%s %s %u %u %u %.2f %u %u\n", m, r,
+			(unsigned)c->slabs, (unsigned)c->queries,
+			(unsigned)c->hits, c->queries?(double)c->hits*100.0/
+			(double)c->queries:0.0,
+			(unsigned)slabhash_get_mem(c->env.msg_cache),
+			(unsigned)slabhash_get_mem(&c->env.rrset_cache->table));
+	}
+	fflush(stdout);
+}
+
+/** replay the reply and print progress if wanted */
+static void
+sim_add(struct sim* sim, sldns_buffer* pkt, time_t now)
+{
+	sim_reply(sim, pkt, now);
+	if(sim->progress && sim->replies % sim->progress == 0)
+		sim_print(sim);
+}
+
+/** read a little endian or big endian uint32 from pcap */
+static uint32_t
+pcap_u32(uint8_t* p, int swap)
+{
+	if(swap)
+		return ((uint32_t)p[3]<<24) | ((uint32_t)p[2]<<16) |
+			((uint32_t)p[1]<<8) | p[0];
+	return sldns_read_uint32(p);
+}
+
+/**
+ * Find the DNS payload of a reply in a captured frame.
+ * @return payload start or NULL if it is not an UDP reply from port 53.
+ */
+static uint8_t*
+pcap_payload(uint8_t* d, size_t len, uint32_t linktype, size_t* plen)
+{
+	uint16_t ethertype;
+	size_t hl;
+	uint8_t proto;
+	/* link layer */
+	if(linktype == 1) {
+		/* ethernet, with vlan tags */
+		if(len < 14) return NULL;
+		ethertype = sldns_read_uint16(d+12);
+		d += 14; len -= 14;
+		while(ethertype == 0x8100 || ethertype == 0x88a8) {
+			if(len < 4) return NULL;
+			ethertype = sldns_read_uint16(d+2);
+			d += 4; len -= 4;
+		}
+		if(ethertype != 0x0800 && ethertype != 0x86dd)
+			return NULL;
+	} else if(linktype == 113) {
+		/* linux cooked */
+		if(len < 16) return NULL;
+		d += 16; len -= 16;
+	} else if(linktype == 0 || linktype == 108) {
+		/* null, loopback; a 4 byte family */
+		if(len < 4) return NULL;
+		d += 4; len -= 4;
+	} else if(linktype != 101 && linktype != 12 && linktype != 14) {
+		return NULL;
+	}
+	/* IP layer */
+	if(len < 1) return NULL;
+	if((d[0]>>4) == 4) {
+		hl = (size_t)(d[0]&0x0f)*4;
+		if(len < 20 || hl < 20 || len < hl)
+			return NULL;
+		/* fragments are not reassembled */
+		if((sldns_read_uint16(d+6) & 0x3fff) != 0)
+			return NULL;
+		proto = d[9];
+	} else if((d[0]>>4) == 6) {
+		hl = 40;
+		if(len < hl) return NULL;
+		proto = d[6];
+	} else return NULL;
+	if(proto != 17)
+		return NULL;
+	d += hl; len -= hl;
+	/* UDP, from port 53 */
+	if(len < 8 || sldns_read_uint16(d) != UNBOUND_DNS_PORT)
+		return NULL;
+	if(sldns_read_uint16(d+4) >= 8 && (size_t)sldns_read_uint16(d+4)
+		< len)
+		len = sldns_read_uint16(d+4);
+	*plen = len - 8;
+	return d + 8;
+}
+
+/** read replies from a pcap file */
+static void
+read_pcap(struct sim* sim, FILE* in, uint8_t* hdr, sldns_buffer* pkt)
+{
+	uint8_t rec[16], *frame, *payload;
+	uint32_t magic = sldns_read_uint32(hdr), linktype, caplen;
+	int swap = (magic == 0xd4c3b2a1 || magic == 0x4d3cb2a1);
+	size_t plen, framemax = 262144;
+	linktype = pcap_u32(hdr+20, swap) & 0x0fffffff;
+	frame = (uint8_t*)malloc(framemax);
+	if(!frame)
+		fatal_exit("out of memory");
+	while(fread(rec, sizeof(rec), 1, in) == 1) {
+		caplen = pcap_u32(rec+8, swap);
+		if(caplen > framemax)
+			fatal_exit("pcap: bad record length %u",
+				(unsigned)caplen);
+		if(fread(frame, 1, caplen, in) != caplen)
+			break;
+		payload = pcap_payload(frame, caplen, linktype, &plen);
+		if(!payload || plen > sldns_buffer_capacity(pkt))
+			continue;
+		sldns_buffer_clear(pkt);
+		sldns_buffer_write(pkt, payload, plen);
+		sldns_buffer_flip(pkt);
+		sim_add(sim, pkt, (time_t)pcap_u32(rec, swap));
+	}
+	free(frame);
+}
+
+/** read replies from a text file, a line per reply */
+static void
+read_text(struct sim* sim, FILE* in, sldns_buffer* pkt)
+{
+	char* line;
+	size_t linemax = 262144;
+	char* hex;
+	line = (char*)malloc(linemax);
+	if(!line)
+		fatal_exit("out of memory");
+	while(fgets(line, (int)linemax, in)) {
+		char* p = line;
+		while(isspace((unsigned char)*p))
+			p++;
+		if(*p == 0 || *p == ';' || *p == '#')
+			continue;
+		hex = p;
+		while(*hex && !isspace((unsigned char)*hex))
+			hex++;
+		hex_to_buf(pkt, hex);
+		sim_add(sim, pkt, (time_t)atol(p));
+	}
+	free(line);
+}
+
+/** getopt global, in case header files fail to declare it. */
+extern int optind;
+/** getopt global, in case header files fail to declare it. */
+extern char* optarg;
+
+/** main program for cachesim */
+int main(int argc, char* argv[])
+{
+	int c, i;
+	char* nm = argv[0];
+	char* sizes = "1m,2m,4m,8m,16m,32m,64m,128m", *slabs = "4";
+	double ratio = 2.0;
+	struct sim sim;
+	uint8_t hdr[24];
+	sldns_buffer* pkt;
+	FILE* in;
+
+	memset(&sim, 0, sizeof(sim));
+	log_init(0, 0, 0);
+	log_ident_set("cachesim");
+	checklock_start();
+	while( (c=getopt(argc, argv, "hm:p:r:s:w:")) != -1) {
+		switch(c) {
+			case 'm':
+				sizes = optarg;
+				break;
+			case 'p':
+				sim.progress = (size_t)atol(optarg);
+				break;
+			case 'r':
+				ratio = atof(optarg);
+				if(ratio <= 0)
+					usage(nm);
+				break;
+			case 's':
+				slabs = optarg;
+				break;
+			case 'w':
+				sim.warmup = (size_t)atol(optarg);
+				break;
+			case 'h':
+			case '?':
+			default:
+				usage(nm);
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if(argc != 1)
+		usage(nm);
+
+	if(!(sim.cfg = config_create()))
+		fatal_exit("out of memory");
+	sizes = strdup(sizes);
+	slabs = strdup(slabs);
+	sim.region = regional_create();
+	sim.scratch = regional_create();
+	pkt = sldns_buffer_new(65553);
+	if(!sizes || !slabs || !sim.region || !sim.scratch || !pkt)
+		fatal_exit("out of memory");
+	alloc_init(&sim.alloc, NULL, 0);
+	sim_setup(&sim, sizes, slabs, ratio);
+
+	if(strcmp(argv[0], "-") == 0)
+		in = stdin;
+	else if(!(in = fopen(argv[0], "r")))
+		fatal_exit("could not open %s: %s", argv[0], strerror(errno));
+	if(fread(hdr, sizeof(hdr), 1, in) == 1 && (
+		sldns_read_uint32(hdr) == 0xa1b2c3d4 ||
+		sldns_read_uint32(hdr) == 0xd4c3b2a1 ||
+		sldns_read_uint32(hdr) == 0xa1b23c4d ||
+		sldns_read_uint32(hdr) == 0x4d3cb2a1)) {
+		read_pcap(&sim, in, hdr, pkt);
+	} else {
+		if(in == stdin)
+			fatal_exit("text input from stdin is not supported, "
+				"only pcap");
+		rewind(in);
+		read_text(&sim, in, pkt);
+	}
+	if(in != stdin)
+		fclose(in);
+	sim_print(&sim);
+
+	for(i=0; i<sim.num; i++)
+		sim_cache_delete(sim.caches[i]);
+	alloc_clear(&sim.alloc);
+	regional_destroy(sim.region);
+	regional_destroy(sim.scratch);
+	sldns_buffer_free(pkt);
+	config_delete(sim.cfg);
+	free(sizes);
+	free(slabs);
+	checklock_stop();
+	return 0;
+}
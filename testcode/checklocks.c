@@ -393,10 +393,11 @@ checklock_destroy(enum check_lock_type type, struct checked_lock** lock,
 	free(e);
 }
 
-/** finish acquiring lock, shared between _(rd|wr||)lock() routines */
+/** finish acquiring lock, shared between _(rd|wr||)lock() routines,
+ * the lock order is not written for a trylock, it does not wait */
 static void 
 finish_acquire_lock(struct thr_check* thr, struct checked_lock* lock,
-        const char* func, const char* file, int line)
+        const char* func, const char* file, int line, int order)
 {
 	thr->waiting = NULL;
 	lock->wait_count --;
@@ -405,7 +406,8 @@ finish_acquire_lock(struct thr_check* thr, struct checked_lock* lock,
 	lock->holder_func = func;
 	lock->holder_file = file;
 	lock->holder_line = line;
-	ordercheck_locklock(thr, lock);
+	if(order)
+		ordercheck_locklock(thr, lock);
 	
 	/* insert in thread lock list, as first */
 	lock->prev_held_lock[thr->num] = NULL;
@@ -486,7 +488,7 @@ checklock_lockit(enum check_lock_type type, struct checked_lock* lock,
 	 */
 	if(getwr || exclusive)
 		prot_check(lock, func, file, line);
-	finish_acquire_lock(thr, lock, func, file, line);
+	finish_acquire_lock(thr, lock, func, file, line, 1);
 	LOCKRET(pthread_mutex_unlock(&lock->lock));
 }
 
@@ -578,6 +580,43 @@ checklock_lock(enum check_lock_type type, struct checked_lock* lock,
 	}
 }
 
+/** check if OK, try to lock */
+int
+checklock_trylock(enum check_lock_type type, struct checked_lock* lock,
+        const char* func, const char* file, int line)
+{
+	int err;
+	struct thr_check *thr;
+	if(key_deleted)
+		return 1;
+	log_assert(type == check_lock_mutex);
+	thr = (struct thr_check*)pthread_getspecific(thr_debug_key);
+	checktype(type, lock, func, file, line);
+	if(!thr) lock_error(lock, func, file, line, "no thread info");
+
+	acquire_locklock(lock, func, file, line);
+	if(lock->hold_count > 0 && lock->holder == thr) 
+		lock_error(lock, func, file, line, "thread already owns lock");
+	if((err=pthread_mutex_trylock(&lock->u.mutex))) {
+		/* busy, the lock is not taken and not recorded */
+		if(err != EBUSY) log_err("trylock: %s", strerror(err));
+		lock->contention_count++;
+		LOCKRET(pthread_mutex_unlock(&lock->lock));
+		return 0;
+	}
+	/* got the lock */
+	lock->history_count++;
+	if(lock->hold_count > 0)
+		lock_error(lock, func, file, line, "got nonexclusive lock");
+	prot_check(lock, func, file, line);
+	/* the wait count and waiting are undone by finish_acquire_lock */
+	lock->wait_count ++;
+	thr->waiting = lock;
+	finish_acquire_lock(thr, lock, func, file, line, 0);
+	LOCKRET(pthread_mutex_unlock(&lock->lock));
+	return 1;
+}
+
 /** check if OK, unlock */
 void 
 checklock_unlock(enum check_lock_type type, struct checked_lock* lock,
@@ -72,7 +72,7 @@
 #include <pthread.h>
 
 /** How many threads to allocate for */
-#define THRDEBUG_MAX_THREADS 32 /* threads */
+#define THRDEBUG_MAX_THREADS 64 /* threads */
 /** do we check locking order */
 extern int check_locking_order;
 
@@ -269,6 +269,19 @@ void checklock_wrlock(enum check_lock_type type, struct checked_lock* lock,
 void checklock_lock(enum check_lock_type type, struct checked_lock* lock,
 	const char* func, const char* file, int line);
 
+/**
+ * Tries to lock, without waiting.  The lock is only recorded as held
+ * if it is taken.  No lock order is recorded, it cannot deadlock.
+ * @param type: what type of lock this is. Had better be mutex.
+ * @param lock: the lock.
+ * @param func: caller function name.
+ * @param file: caller file name.
+ * @param line: caller line number.
+ * @return true if the lock is taken, false if it is busy.
+ */
+int checklock_trylock(enum check_lock_type type, struct checked_lock* lock,
+	const char* func, const char* file, int line);
+
 /**
  * Unlocks.
  * @param type: what type of lock this is.
@@ -320,6 +333,7 @@ typedef struct checked_lock_mutex lock_basic_type;
 #define lock_basic_destroy(lock) checklock_destroy(check_lock_mutex, &((lock)->c_m), __func__, __FILE__, __LINE__)
 #define lock_basic_lock(lock) checklock_lock(check_lock_mutex, (lock)->c_m, __func__, __FILE__, __LINE__)
 #define lock_basic_unlock(lock) checklock_unlock(check_lock_mutex, (lock)->c_m, __func__, __FILE__, __LINE__)
+#define lock_basic_trylock(lock) checklock_trylock(check_lock_mutex, (lock)->c_m, __func__, __FILE__, __LINE__)
 
 /** debugging spinlock */
 typedef struct checked_lock_spl lock_quick_type;
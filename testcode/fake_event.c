@@ -56,6 +56,9 @@
 #include "services/listen_dnsport.h"
 #include "services/outside_network.h"
 #include "services/cache/infra.h"
+#include "daemon/worker.h"
+#include "validator/val_anchor.h"
+#include "validator/autotrust.h"
 #include "testcode/replay.h"
 #include "testcode/testpkts.h"
 #include "util/log.h"
@@ -64,11 +67,24 @@
 #include "sldns/wire2str.h"
 #include "sldns/str2wire.h"
 #include <signal.h>
+#include <sys/time.h>
+#ifdef HAVE_LINUX_PERF_EVENT_H
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
 struct worker;
 struct daemon_remote;
 
 /** Global variable: the scenario. Saved here for when event_init is done. */
 static struct replay_scenario* saved_scenario = NULL;
+/** Global variable: cost of the runs, if measured, and the counter fd */
+static struct fake_event_cost* saved_cost = NULL;
+/** fd of the instruction counter, or -1 */
+static int cost_fd = -1;
+#ifdef UNBOUND_ALLOC_STATS
+/** total of allocated bytes, from util/alloc.c */
+extern size_t unbound_mem_alloc;
+#endif
 
 /** add timers and the values do not overflow or become negative */
 static void
@@ -109,6 +125,55 @@ fake_event_cleanup(void)
 	saved_scenario = NULL;
 }
 
+/** open the counter for user space instructions retired, or -1 */
+static int
+cost_counter_open(void)
+{
+#if defined(HAVE_LINUX_PERF_EVENT_H) && defined(__NR_perf_event_open)
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+	return -1;
+#endif
+}
+
+/** read the instruction counter */
+static uint64_t
+cost_counter_read(void)
+{
+	uint64_t v = 0;
+	if(cost_fd == -1 || read(cost_fd, &v, sizeof(v)) != (ssize_t)sizeof(v))
+		return 0;
+	return v;
+}
+
+void
+fake_event_cost_start(struct fake_event_cost* cost)
+{
+	memset(cost, 0, sizeof(*cost));
+	saved_cost = cost;
+	cost_fd = cost_counter_open();
+	cost->have_instructions = (cost_fd != -1);
+#ifdef UNBOUND_ALLOC_STATS
+	cost->have_alloc = 1;
+#endif
+}
+
+void
+fake_event_cost_stop(void)
+{
+	if(cost_fd != -1)
+		close(cost_fd);
+	cost_fd = -1;
+	saved_cost = NULL;
+}
+
 /** helper function that logs a sldns_pkt packet to logfile */
 static void
 log_pkt(const char* desc, uint8_t* pkt, size_t len)
@@ -497,6 +562,25 @@ time_passes(struct replay_runtime* runtime, struct replay_moment* mom)
 	}
 }
 
+/** wait for the writes that are queued for the autotrust writer thread */
+static void
+autotrust_writer_wait(struct replay_runtime* runtime)
+{
+	struct worker* worker = (struct worker*)runtime->cb_arg;
+	struct autr_writer* w;
+	int done = 0;
+	if(!worker || !worker->env.anchors || !worker->env.anchors->autr ||
+		!(w = worker->env.anchors->autr->writer))
+		return;
+	while(!done) {
+		lock_basic_lock(&w->lock);
+		done = (w->num_write + w->num_fail == w->num_queued);
+		lock_basic_unlock(&w->lock);
+		if(!done)
+			usleep(1000);
+	}
+}
+
 /** check autotrust file contents */
 static void
 autotrust_check(struct replay_runtime* runtime, struct replay_moment* mom)
@@ -508,6 +592,7 @@ autotrust_check(struct replay_runtime* runtime, struct replay_moment* mom)
 	struct config_strlist* p;
 	line[sizeof(line)-1] = 0;
 	log_assert(mom->autotrust_id);
+	autotrust_writer_wait(runtime);
 	fake_temp_file("_auto_", mom->autotrust_id, name, sizeof(name));
 	in = fopen(name, "r");
 	if(!in) fatal_exit("could not open %s: %s", name, strerror(errno));
@@ -562,6 +647,8 @@ do_infra_rtt(struct replay_runtime* runtime)
 	rto = infra_rtt_update(runtime->infra, &now->addr, now->addrlen,
 		dp, dplen, LDNS_RR_TYPE_A, atoi(now->string),
 		-1, runtime->now_secs);
+	infra_local_invalidate(runtime->infra_local, &now->addr,
+		now->addrlen, dp, dplen);
 	log_addr(0, "INFRA_RTT for", &now->addr, now->addrlen);
 	log_info("INFRA_RTT(%s roundtrip %d): rto of %d", now->variable,
 		atoi(now->string), rto);
@@ -584,6 +671,8 @@ expon_timeout_backoff(struct replay_runtime* runtime)
 	last_rtt = rtt;
 	rto = infra_rtt_update(runtime->infra, &p->addr, p->addrlen, p->zone,
 		p->zonelen, p->qtype, -1, last_rtt, runtime->now_secs);
+	infra_local_invalidate(runtime->infra_local, &p->addr, p->addrlen,
+		p->zone, p->zonelen);
 	log_info("infra_rtt_update returned rto %d", rto);
 }
 
@@ -684,6 +773,15 @@ run_scenario(struct replay_runtime* runtime)
 	struct fake_pending* pending = NULL;
 	int max_rounds = 5000;
 	int rounds = 0;
+	struct timeval start, end;
+	uint64_t instr = 0, usec;
+#ifdef UNBOUND_ALLOC_STATS
+	size_t alloc = unbound_mem_alloc;
+#endif
+	if(saved_cost) {
+		instr = cost_counter_read();
+		gettimeofday(&start, NULL);
+	}
 	runtime->now = runtime->scenario->mom_first;
 	log_info("testbound: entering fake runloop");
 	do {
@@ -727,6 +825,20 @@ run_scenario(struct replay_runtime* runtime)
 	}
 	log_info("testbound: exiting fake runloop.");
 	runtime->exit_cleanly = 1;
+	if(saved_cost) {
+		gettimeofday(&end, NULL);
+		saved_cost->runs++;
+		saved_cost->instructions += cost_counter_read() - instr;
+		usec = (uint64_t)(end.tv_sec - start.tv_sec)*1000000
+			+ (uint64_t)end.tv_usec - (uint64_t)start.tv_usec;
+		saved_cost->usec += usec;
+		if(saved_cost->runs == 1 || usec < saved_cost->usec_min)
+			saved_cost->usec_min = usec;
+#ifdef UNBOUND_ALLOC_STATS
+		/* the counter only goes up, frees are counted separately */
+		saved_cost->alloc += (uint64_t)(unbound_mem_alloc - alloc);
+#endif
+	}
 }
 
 /*********** Dummy routines ***********/
@@ -734,7 +846,7 @@ run_scenario(struct replay_runtime* runtime)
 struct listen_dnsport* 
 listen_create(struct comm_base* base, struct listen_port* ATTR_UNUSED(ports),
 	size_t bufsize, int ATTR_UNUSED(tcp_accept_count),
-	void* ATTR_UNUSED(sslctx), struct dt_env* ATTR_UNUSED(dtenv),
+	int ATTR_UNUSED(tcp_idle_timeout), void* ATTR_UNUSED(sslctx), struct dt_env* ATTR_UNUSED(dtenv),
 	comm_point_callback_type* cb, void* cb_arg)
 {
 	struct replay_runtime* runtime = (struct replay_runtime*)base;
@@ -762,6 +874,16 @@ listen_delete(struct listen_dnsport* listen)
 	free(listen);
 }
 
+int
+listen_add_xdp(struct listen_dnsport* ATTR_UNUSED(front),
+	struct comm_base* ATTR_UNUSED(base), struct xdp_sock* ATTR_UNUSED(xsk),
+	struct dt_env* ATTR_UNUSED(dtenv),
+	comm_point_callback_type* ATTR_UNUSED(cb), void* ATTR_UNUSED(cb_arg))
+{
+	/* no AF_XDP sockets in testbound */
+	return 0;
+}
+
 struct comm_base* 
 comm_base_create(int ATTR_UNUSED(sigs))
 {
@@ -891,6 +1013,12 @@ comm_point_drop_reply(struct comm_reply* repinfo)
 	}
 }
 
+int
+comm_point_tcp_set_idle(struct comm_point* ATTR_UNUSED(c), int msec)
+{
+	return msec;
+}
+
 struct outside_network* 
 outside_network_create(struct comm_base* base, size_t bufsize, 
 	size_t ATTR_UNUSED(num_ports), char** ATTR_UNUSED(ifs), 
@@ -900,7 +1028,8 @@ outside_network_create(struct comm_base* base, size_t bufsize,
 	struct ub_randstate* ATTR_UNUSED(rnd), 
 	int ATTR_UNUSED(use_caps_for_id), int* ATTR_UNUSED(availports),
 	int ATTR_UNUSED(numavailports), size_t ATTR_UNUSED(unwanted_threshold),
-	int ATTR_UNUSED(outgoing_tcp_mss),
+	int ATTR_UNUSED(outgoing_tcp_mss), int ATTR_UNUSED(tcp_fastopen),
+	uint8_t* ATTR_UNUSED(cookie_secret),
 	void (*unwanted_action)(void*), void* ATTR_UNUSED(unwanted_param),
 	int ATTR_UNUSED(do_udp), void* ATTR_UNUSED(sslctx),
 	int ATTR_UNUSED(delayclose), struct dt_env* ATTR_UNUSED(dtenv))
@@ -914,10 +1043,14 @@ outside_network_create(struct comm_base* base, size_t bufsize,
 	runtime->infra = infra;
 	outnet->base = base;
 	outnet->udp_buff = sldns_buffer_new(bufsize);
-	if(!outnet->udp_buff) {
+	outnet->infra_local = infra_local_create();
+	if(!outnet->udp_buff || !outnet->infra_local) {
+		sldns_buffer_free(outnet->udp_buff);
+		free(outnet->infra_local);
 		free(outnet);
 		return NULL;
 	}
+	runtime->infra_local = outnet->infra_local;
 	return outnet;
 }
 
@@ -927,6 +1060,7 @@ outside_network_delete(struct outside_network* outnet)
 	if(!outnet)
 		return;
 	sldns_buffer_free(outnet->udp_buff);
+	infra_local_delete(outnet->infra_local);
 	free(outnet);
 }
 
@@ -1071,8 +1205,8 @@ struct serviced_query* outnet_serviced_query(struct outside_network* outnet,
 	sldns_buffer_flip(pend->buffer);
 	if(1) {
 		struct edns_data edns;
-		if(!inplace_cb_query_call(env, qinfo, flags, addr, addrlen,
-			zone, zonelen, qstate, qstate->region)) {
+		if(qstate && !inplace_cb_query_call(env, qinfo, flags, addr,
+			addrlen, zone, zonelen, qstate, qstate->region)) {
 			free(pend);
 			return NULL;
 		}
@@ -1082,7 +1216,7 @@ struct serviced_query* outnet_serviced_query(struct outside_network* outnet,
 		edns.edns_version = EDNS_ADVERTISED_VERSION;
 		edns.udp_size = EDNS_ADVERTISED_SIZE;
 		edns.bits = 0;
-		edns.opt_list = qstate->edns_opts_back_out;
+		edns.opt_list = qstate?qstate->edns_opts_back_out:NULL;
 		if(dnssec)
 			edns.bits = EDNS_DO;
 		attach_edns_record(pend->buffer, &edns);
@@ -1180,6 +1314,45 @@ struct comm_point* comm_point_create_raw(struct comm_base* ATTR_UNUSED(base),
 	return calloc(1, 1);
 }
 
+struct comm_point* comm_point_create_tcp(struct comm_base* ATTR_UNUSED(base),
+	int ATTR_UNUSED(fd), int ATTR_UNUSED(num),
+	size_t ATTR_UNUSED(bufsize),
+	comm_point_callback_type* ATTR_UNUSED(callback),
+	void* ATTR_UNUSED(callback_arg))
+{
+	/* no cache peer connections possible */
+	return NULL;
+}
+
+struct comm_point* comm_point_create_tcp_out(
+	struct comm_base* ATTR_UNUSED(base), size_t ATTR_UNUSED(bufsize),
+	comm_point_callback_type* ATTR_UNUSED(callback),
+	void* ATTR_UNUSED(callback_arg))
+{
+	/* no cache peer connections possible */
+	return NULL;
+}
+
+void comm_point_close(struct comm_point* ATTR_UNUSED(c))
+{
+	/* no cache peer connections possible */
+}
+
+int create_tcp_accept_sock(struct addrinfo* ATTR_UNUSED(addr),
+	int ATTR_UNUSED(v6only), int* noproto, int* ATTR_UNUSED(reuseport),
+	int ATTR_UNUSED(transparent), int ATTR_UNUSED(mss),
+	int ATTR_UNUSED(tfo_queue), int ATTR_UNUSED(freebind),
+	int ATTR_UNUSED(use_systemd))
+{
+	/* no cache peer ports in testbound */
+	*noproto = 0;
+	return -1;
+}
+
+void comm_point_udp_stats_sample(struct comm_point* ATTR_UNUSED(c))
+{
+}
+
 void comm_point_start_listening(struct comm_point* ATTR_UNUSED(c), 
 	int ATTR_UNUSED(newfd), int ATTR_UNUSED(sec))
 {
@@ -1261,6 +1434,12 @@ void comm_point_udp_ancil_callback(int ATTR_UNUSED(fd),
 	log_assert(0);
 }
 
+void comm_point_xdp_callback(int ATTR_UNUSED(fd), 
+	short ATTR_UNUSED(event), void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void comm_point_tcp_accept_callback(int ATTR_UNUSED(fd), 
 	short ATTR_UNUSED(event), void* ATTR_UNUSED(arg))
 {
@@ -1412,6 +1591,14 @@ void listen_stop_accept(struct listen_dnsport* ATTR_UNUSED(listen))
 {
 }
 
+void listen_clear_tcp_fastopen(struct listen_dnsport* ATTR_UNUSED(listen))
+{
+}
+
+void listen_clear_udp_stats(struct listen_dnsport* ATTR_UNUSED(listen))
+{
+}
+
 void daemon_remote_start_accept(struct daemon_remote* ATTR_UNUSED(rc))
 {
 }
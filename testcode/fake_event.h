@@ -48,6 +48,28 @@
 #define TESTCODE_FAKE_EVENT_H
 struct replay_scenario;
 
+/**
+ * Cost of the runs of a scenario, measured around the fake runloop,
+ * for the testbound performance mode.
+ */
+struct fake_event_cost {
+	/** number of measured runs */
+	int runs;
+	/** instructions retired in user space, summed, if counted */
+	uint64_t instructions;
+	/** wall time in usec, summed */
+	uint64_t usec;
+	/** wall time in usec of the fastest run, less noisy than the sum */
+	uint64_t usec_min;
+	/** total bytes allocated, summed, if counted (with alloc-checks).
+	 * Frees are not subtracted, it is not the change in memory use. */
+	uint64_t alloc;
+	/** if instructions are counted */
+	int have_instructions;
+	/** if allocations are counted */
+	int have_alloc;
+};
+
 /**
  * Initialise fake event services.
  *
@@ -63,6 +85,19 @@ void fake_event_init(struct replay_scenario* scen);
  */
 void fake_event_cleanup(void);
 
+/**
+ * Measure the cost of the scenario runs from now on, until
+ * fake_event_cost_stop.  Opens the instruction counter (with
+ * perf_event_open) if it is available, otherwise wall time is used.
+ * @param cost: the runs are added to this, it is zeroed first.
+ */
+void fake_event_cost_start(struct fake_event_cost* cost);
+
+/**
+ * Stop measuring the cost of scenario runs.
+ */
+void fake_event_cost_stop(void);
+
 /**
  * Get filename to store temporary config stuff. The pid is added. in /tmp.
  * @param adj: adjective, like "_cfg_", "_auto_"
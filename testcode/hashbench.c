@@ -0,0 +1,467 @@
+/*
+ * testcode/hashbench.c - lookup cost of the cache hashtables.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This program measures the cost of a lookup in the message, RRset, infra
+ * and key caches.  It fills every cache with the routines of the daemon,
+ * and then looks up every entry, with slabhash_lookup, that calls the
+ * compare function of the table through a function pointer, and with the
+ * lookup function of that cache, that has the compare function inlined.
+ */
+
+#include "config.h"
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+#include <sys/time.h>
+#include "util/log.h"
+#include "util/alloc.h"
+#include "util/regional.h"
+#include "util/config_file.h"
+#include "util/net_help.h"
+#include "util/data/msgreply.h"
+#include "util/data/packed_rrset.h"
+#include "util/storage/slabhash.h"
+#include "services/cache/rrset.h"
+#include "services/cache/infra.h"
+#include "validator/val_kcache.h"
+#include "validator/val_kentry.h"
+#include "sldns/rrdef.h"
+#include "sldns/str2wire.h"
+#include "sldns/sbuffer.h"
+
+/** the lookup function that is measured */
+typedef struct lruhash_entry* (*bench_lookup_type)(struct slabhash*,
+	hashvalue_type, void*, int);
+
+/** the kinds of cache */
+enum bench_kind {
+	/** message cache, key is struct query_info */
+	bench_msg,
+	/** rrset cache, key is struct ub_packed_rrset_key */
+	bench_rrset,
+	/** infra host cache, key is struct infra_key */
+	bench_infra,
+	/** key cache, key is struct key_entry_key */
+	bench_key
+};
+
+/** the keys to look up, copies of the keys in the table */
+struct bench_keys {
+	/** the kind of cache */
+	enum bench_kind kind;
+	/** the copied keys */
+	void** key;
+	/** the copied names of the keys */
+	uint8_t** name;
+	/** the hash values of the keys */
+	hashvalue_type* hash;
+	/** number of keys */
+	size_t num;
+	/** allocated number of keys */
+	size_t max;
+};
+
+/** usage information for hashbench */
+static void usage(char* argv[])
+{
+	printf("usage: %s [options]\n", argv[0]);
+	printf("	measures the lookup cost in the message, RRset, infra "
+		"and key caches,\n");
+	printf("	with the generic slabhash lookup and with the lookup "
+		"of the cache.\n");
+	printf("-n num		number of entries in every cache, default "
+		"10000.\n");
+	printf("-l num		number of lookups per run, default 1000000.\n");
+	printf("-r num		number of runs, the fastest is printed, "
+		"default 5.\n");
+	printf("-s slabs	number of slabs, power of 2, default 4.\n");
+	printf("-h		this help message\n");
+	exit(1);
+}
+
+/** make the owner name for entry i */
+static uint8_t*
+bench_name(size_t i, size_t* len)
+{
+	char buf[64];
+	uint8_t* nm;
+	snprintf(buf, sizeof(buf), "host%u.zone%u.example.com.",
+		(unsigned)i, (unsigned)(i%100));
+	if(!(nm = sldns_str2wire_dname(buf, len)))
+		fatal_exit("out of memory");
+	return nm;
+}
+
+/** copy a key of the table, in the traverse of the table */
+static void
+bench_copy_key(struct lruhash_entry* e, void* arg)
+{
+	struct bench_keys* k = (struct bench_keys*)arg;
+	void* key = NULL;
+	uint8_t* nm = NULL;
+	if(k->num == k->max)
+		return;
+	switch(k->kind) {
+	case bench_msg: {
+		struct query_info* q = (struct query_info*)memdup(e->key,
+			sizeof(*q));
+		if(q && (nm = memdup(q->qname, q->qname_len)))
+			q->qname = nm;
+		key = q;
+		break;
+	}
+	case bench_rrset: {
+		struct ub_packed_rrset_key* r = (struct ub_packed_rrset_key*)
+			memdup(e->key, sizeof(*r));
+		if(r && (nm = memdup(r->rk.dname, r->rk.dname_len))) {
+			r->rk.dname = nm;
+			r->entry.key = r;
+		}
+		key = r;
+		break;
+	}
+	case bench_infra: {
+		struct infra_key* i = (struct infra_key*)memdup(e->key,
+			sizeof(*i));
+		if(i && (nm = memdup(i->zonename, i->namelen))) {
+			i->zonename = nm;
+			i->entry.key = i;
+		}
+		key = i;
+		break;
+	}
+	case bench_key: {
+		struct key_entry_key* kk = (struct key_entry_key*)memdup(
+			e->key, sizeof(*kk));
+		if(kk && (nm = memdup(kk->name, kk->namelen))) {
+			kk->name = nm;
+			kk->entry.key = kk;
+		}
+		key = kk;
+		break;
+	}
+	}
+	if(!key || !nm)
+		fatal_exit("out of memory");
+	k->key[k->num] = key;
+	k->name[k->num] = nm;
+	k->hash[k->num] = e->hash;
+	k->num++;
+}
+
+/** collect copies of the keys in the table */
+static void
+bench_keys_collect(struct bench_keys* k, enum bench_kind kind,
+	struct slabhash* table, size_t max)
+{
+	memset(k, 0, sizeof(*k));
+	k->kind = kind;
+	k->max = max;
+	k->key = (void**)calloc(max, sizeof(void*));
+	k->name = (uint8_t**)calloc(max, sizeof(uint8_t*));
+	k->hash = (hashvalue_type*)calloc(max, sizeof(hashvalue_type));
+	if(!k->key || !k->name || !k->hash)
+		fatal_exit("out of memory");
+	slabhash_traverse(table, 0, &bench_copy_key, k);
+	if(k->num == 0)
+		fatal_exit("the table is empty");
+}
+
+/** free the copied keys */
+static void
+bench_keys_free(struct bench_keys* k)
+{
+	size_t i;
+	for(i=0; i<k->num; i++) {
+		free(k->key[i]);
+		free(k->name[i]);
+	}
+	free(k->key);
+	free(k->name);
+	free(k->hash);
+}
+
+/** time the lookups, returns nanoseconds per lookup */
+static double
+bench_run(struct slabhash* table, struct bench_keys* k, size_t lookups,
+	bench_lookup_type lookup)
+{
+	struct timeval start, end;
+	struct lruhash_entry* e;
+	size_t i, j = 0, found = 0;
+	double usec;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<lookups; i++) {
+		/* step through the keys with a prime stride, so that
+		 * successive lookups are in different bins */
+		j = (j + 7919) % k->num;
+		if((e = (*lookup)(table, k->hash[j], k->key[j], 0))) {
+			found++;
+			lock_rw_unlock(&e->lock);
+		}
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	if(found != lookups)
+		fatal_exit("lookup failed, %u of %u found", (unsigned)found,
+			(unsigned)lookups);
+	usec = (double)(end.tv_sec - start.tv_sec)*1000000.0 +
+		(double)(end.tv_usec - start.tv_usec);
+	return usec*1000.0/(double)lookups;
+}
+
+/** measure and print the lookup cost of a table */
+static void
+bench_table(const char* nm, enum bench_kind kind, struct slabhash* table,
+	bench_lookup_type lookup, size_t num, size_t lookups, int runs)
+{
+	struct bench_keys k;
+	double generic = 0, inlined = 0, t;
+	int r;
+	bench_keys_collect(&k, kind, table, num);
+	for(r=0; r<runs; r++) {
+		/* alternate the runs, so both see the same conditions */
+		t = bench_run(table, &k, lookups, &slabhash_lookup);
+		if(r == 0 || t < generic)
+			generic = t;
+		t = bench_run(table, &k, lookups, lookup);
+		if(r == 0 || t < inlined)
+			inlined = t;
+	}
+	printf("%-8s %8u %12.1f %12.1f %+8.1f%%\n", nm, (unsigned)k.num,
+		generic, inlined, (generic>0)?(inlined-generic)*100.0/generic:0);
+	bench_keys_free(&k);
+}
+
+/** fill the message cache */
+static struct slabhash*
+fill_msg(struct config_file* cfg, size_t num)
+{
+	struct slabhash* table = slabhash_create(cfg->msg_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size,
+		msgreply_sizefunc, query_info_compare, query_entry_delete,
+		reply_info_delete, NULL);
+	struct query_info q;
+	struct reply_info* rep;
+	struct msgreply_entry* e;
+	hashvalue_type h;
+	size_t i;
+	if(!table)
+		fatal_exit("out of memory");
+	for(i=0; i<num; i++) {
+		memset(&q, 0, sizeof(q));
+		q.qname = bench_name(i, &q.qname_len);
+		q.qtype = LDNS_RR_TYPE_A;
+		q.qclass = LDNS_RR_CLASS_IN;
+		h = query_info_hash(&q, BIT_RD);
+		rep = construct_reply_info_base(NULL, BIT_QR|BIT_RD, 1, 3600,
+			3240, 0, 0, 0, 0, sec_status_unchecked);
+		if(!rep || !(e = query_info_entrysetup(&q, rep, h)))
+			fatal_exit("out of memory");
+		slabhash_insert(table, h, &e->entry, rep, NULL);
+	}
+	return table;
+}
+
+/** fill the rrset cache */
+static struct rrset_cache*
+fill_rrset(struct config_file* cfg, struct alloc_cache* alloc, size_t num)
+{
+	struct rrset_cache* r = rrset_cache_create(cfg, alloc);
+	struct rrset_ref ref;
+	struct ub_packed_rrset_key* k;
+	struct packed_rrset_data* d;
+	size_t i;
+	if(!r)
+		fatal_exit("out of memory");
+	for(i=0; i<num; i++) {
+		k = alloc_special_obtain(alloc);
+		d = (struct packed_rrset_data*)calloc(1, sizeof(*d) +
+			sizeof(size_t) + sizeof(uint8_t*) + sizeof(time_t) + 6);
+		if(!k || !d)
+			fatal_exit("out of memory");
+		k->entry.data = d;
+		k->rk.dname = bench_name(i, &k->rk.dname_len);
+		k->rk.type = htons(LDNS_RR_TYPE_A);
+		k->rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+		k->entry.hash = rrset_key_hash(&k->rk);
+		d->ttl = 3600;
+		d->count = 1;
+		d->trust = rrset_trust_ans_noAA;
+		packed_rrset_ptr_fixup(d);
+		d->rr_len[0] = 6;
+		d->rr_ttl[0] = 3600;
+		sldns_write_uint16(d->rr_data[0], 4);
+		sldns_write_uint32(d->rr_data[0]+2, 0x0a000000 + (uint32_t)i);
+		ref.key = k;
+		ref.id = k->id;
+		(void)rrset_cache_update(r, &ref, alloc, 0);
+	}
+	return r;
+}
+
+/** fill the infra cache */
+static struct infra_cache*
+fill_infra(struct config_file* cfg, size_t num)
+{
+	struct infra_cache* infra = infra_create(cfg);
+	struct sockaddr_in sa;
+	uint8_t* zone;
+	size_t zonelen, i;
+	int edns_vs, to;
+	uint8_t edns_lame_known;
+	if(!infra)
+		fatal_exit("out of memory");
+	zone = bench_name(0, &zonelen);
+	memset(&sa, 0, sizeof(sa));
+	sa.sin_family = AF_INET;
+	sa.sin_port = htons(UNBOUND_DNS_PORT);
+	for(i=0; i<num; i++) {
+		sa.sin_addr.s_addr = htonl(0x0a000000 + (uint32_t)i);
+		if(!infra_host(infra, (struct sockaddr_storage*)&sa,
+			(socklen_t)sizeof(sa), zone, zonelen, 0, &edns_vs,
+			&edns_lame_known, &to))
+			fatal_exit("out of memory");
+	}
+	free(zone);
+	return infra;
+}
+
+/** fill the key cache */
+static struct key_cache*
+fill_key(struct config_file* cfg, struct regional* region, size_t num)
+{
+	struct key_cache* kcache = key_cache_create(cfg);
+	struct key_entry_key* k;
+	uint8_t* nm;
+	size_t len, i;
+	if(!kcache)
+		fatal_exit("out of memory");
+	for(i=0; i<num; i++) {
+		nm = bench_name(i, &len);
+		k = key_entry_create_null(region, nm, len, LDNS_RR_CLASS_IN,
+			3600, 0);
+		if(!k)
+			fatal_exit("out of memory");
+		key_cache_insert(kcache, k, NULL);
+		free(nm);
+		regional_free_all(region);
+	}
+	return kcache;
+}
+
+/** main program for hashbench */
+int main(int argc, char* argv[])
+{
+	int c, runs = 5;
+	size_t num = 10000, lookups = 1000000, slabs = 4;
+	struct config_file* cfg;
+	struct alloc_cache alloc;
+	struct regional* region;
+	struct slabhash* msg;
+	struct rrset_cache* rrset;
+	struct infra_cache* infra;
+	struct key_cache* kcache;
+
+	log_init(0, 0, 0);
+	log_ident_set("hashbench");
+	checklock_start();
+	while( (c=getopt(argc, argv, "hl:n:r:s:")) != -1) {
+		switch(c) {
+			case 'l':
+				lookups = (size_t)atol(optarg);
+				break;
+			case 'n':
+				num = (size_t)atol(optarg);
+				break;
+			case 'r':
+				runs = atoi(optarg);
+				break;
+			case 's':
+				slabs = (size_t)atol(optarg);
+				break;
+			case 'h':
+			case '?':
+			default:
+				usage(argv);
+		}
+	}
+	if(num == 0 || lookups == 0 || runs <= 0 || slabs == 0 ||
+		(slabs & (slabs-1)) != 0)
+		usage(argv);
+
+	if(!(cfg = config_create()) || !(region = regional_create()))
+		fatal_exit("out of memory");
+	/* the caches are large enough for all entries */
+	cfg->msg_cache_slabs = slabs;
+	cfg->msg_cache_size = num*1024;
+	cfg->rrset_cache_slabs = slabs;
+	cfg->rrset_cache_size = num*1024;
+	cfg->infra_cache_slabs = slabs;
+	cfg->infra_cache_numhosts = num*2;
+	cfg->key_cache_slabs = slabs;
+	cfg->key_cache_size = num*1024;
+	alloc_init(&alloc, NULL, 0);
+
+	msg = fill_msg(cfg, num);
+	rrset = fill_rrset(cfg, &alloc, num);
+	infra = fill_infra(cfg, num);
+	kcache = fill_key(cfg, region, num);
+
+	printf("%-8s %8s %12s %12s %9s\n", "cache", "entries", "generic ns",
+		"inlined ns", "change");
+	bench_table("message", bench_msg, msg, &msgreply_lookup, num,
+		lookups, runs);
+	bench_table("rrset", bench_rrset, &rrset->table, &ub_rrset_lookup,
+		num, lookups, runs);
+	bench_table("infra", bench_infra, infra->hosts, &infra_hash_lookup,
+		num, lookups, runs);
+	bench_table("key", bench_key, kcache->slab, &key_entry_lookup, num,
+		lookups, runs);
+
+	slabhash_delete(msg);
+	rrset_cache_delete(rrset);
+	infra_delete(infra);
+	key_cache_delete(kcache);
+	alloc_clear(&alloc);
+	regional_destroy(region);
+	config_delete(cfg);
+	checklock_stop();
+	return 0;
+}
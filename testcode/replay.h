@@ -49,6 +49,9 @@
  * AUTOTRUST_FILE id
  * ; contents of that file
  * AUTOTRUST_END
+ * ; the autotrust files are written by the writer thread, CHECK_AUTOTRUST
+ * ; waits for the writes.
+ * AUTOTRUST_ASYNC
  * CONFIG_END
  * ; comment line.
  * SCENARIO_BEGIN name_of_scenario
@@ -138,6 +141,7 @@ struct fake_pending;
 struct fake_timer;
 struct replay_var;
 struct infra_cache;
+struct infra_local;
 struct sldns_buffer;
 
 /**
@@ -286,6 +290,8 @@ struct replay_runtime {
 
 	/** ref the infra cache (was passed to outside_network_create) */
 	struct infra_cache* infra;
+	/** the per thread infra snapshots of the fake outside network */
+	struct infra_local* infra_local;
 
 	/** the current time in seconds */
 	time_t now_secs;
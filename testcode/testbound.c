@@ -52,6 +52,8 @@
 
 /** signal that this is a testbound compile */
 #define unbound_testbound 1
+/** if the writer thread writes the autotrust files, AUTOTRUST_ASYNC */
+static int testbound_autr_async = 0;
 /** 
  * include the main program from the unbound daemon.
  * rename main to daemon_main to call it
@@ -62,6 +64,8 @@
 
 /** maximum line length for lines in the replay file. */
 #define MAX_LINE_LEN 1024
+/** default tolerance in percent of the performance baseline compare */
+#define PERF_TOLERANCE 10
 /** config files (removed at exit) */
 static struct config_strlist* cfgfiles = NULL;
 
@@ -80,6 +84,13 @@ testbound_usage(void)
 	printf("-c 	detect CLIENT_SUBNET support (exit code 0 or 1)\n");
 	printf("-s 	testbound self-test - unit test of testbound parts.\n");
 	printf("-o str  unbound commandline options separated by spaces.\n");
+	printf("-n num	performance mode, after the normal run, run the\n");
+	printf("	scenario num times more and report the cost per run.\n");
+	printf("-b file	compare the cost and the allocated bytes with the\n");
+	printf("	baseline in the file.\n");
+	printf("-w	write the cost into the baseline file, do not compare.\n");
+	printf("-t pct	tolerance for the baseline compare, default %d%%.\n",
+		PERF_TOLERANCE);
 	printf("Version %s\n", PACKAGE_VERSION);
 	printf("BSD licensed, see LICENSE file in source package.\n");
 	printf("Report bugs to %s.\n", PACKAGE_BUGREPORT);
@@ -208,6 +219,10 @@ setup_config(FILE* in, int* lineno, int* pass_argc, char* pass_argv[])
 			add_opts(parse+11, pass_argc, pass_argv);
 			continue;
 		}
+		if(strncmp(parse, "AUTOTRUST_ASYNC", 15) == 0) {
+			testbound_autr_async = 1;
+			continue;
+		}
 		if(strncmp(parse, "AUTOTRUST_FILE", 14) == 0) {
 			spool_auto_file(in, lineno, cfg, parse+14);
 			continue;
@@ -256,6 +271,131 @@ void remove_configfile(void)
 	cfgfiles = NULL;
 }
 
+/** the name of the scenario in the baseline, the file name */
+static const char*
+perf_name(const char* fname)
+{
+	const char* s = strrchr(fname, '/');
+	return s?s+1:fname;
+}
+
+/**
+ * Run the scenario count times more, with the log output silenced, and
+ * measure the cost of the runs.
+ * @return 0 on success.
+ */
+static int
+perf_runs(struct replay_scenario* scen, int count, int pass_argc,
+	char* pass_argv[], int init_optind, char* init_optarg,
+	struct fake_event_cost* cost)
+{
+	int i, res = 0, saved_fd, nullfd;
+	fprintf(stderr, "testbound: performance mode, %d runs\n", count);
+	fflush(stderr);
+	saved_fd = dup(STDERR_FILENO);
+	if((nullfd = open("/dev/null", O_WRONLY)) != -1) {
+		(void)dup2(nullfd, STDERR_FILENO);
+		close(nullfd);
+	}
+	fake_event_cost_start(cost);
+	for(i=0; i<count && res == 0; i++) {
+		fake_event_init(scen);
+		optind = init_optind;
+		optarg = init_optarg;
+		res = daemon_main(pass_argc, pass_argv);
+	}
+	fake_event_cost_stop();
+	fflush(stderr);
+	if(saved_fd != -1) {
+		(void)dup2(saved_fd, STDERR_FILENO);
+		close(saved_fd);
+	}
+	return res;
+}
+
+/**
+ * Compare the cost with the baseline file, or write the cost into it.
+ * The file has a line per scenario: name, metric (instructions or
+ * usec), cost per run and total allocated bytes per run (or -), that
+ * does not subtract frees.  Without the instruction counter the wall
+ * time of the fastest run is used.  Both compare with the tolerance.
+ * @return false on a regression over the tolerance, or failure.
+ */
+static int
+perf_baseline(const char* basefile, const char* name,
+	struct fake_event_cost* cost, int write, int tolerance)
+{
+	char line[MAX_LINE_LEN], bname[MAX_LINE_LEN], bmetric[32], balloc[32];
+	const char* metric = cost->have_instructions?"instructions":"usec";
+	unsigned long long val = cost->have_instructions?
+		cost->instructions/(uint64_t)cost->runs:cost->usec_min;
+	unsigned long long alloc = cost->alloc/(uint64_t)cost->runs, bval,
+		bytes;
+	struct config_strlist_head keep;
+	struct config_strlist* p;
+	FILE* f;
+	int found = 0, ok = 1;
+
+	memset(&keep, 0, sizeof(keep));
+	if((f = fopen(basefile, "r")) != NULL) {
+		while(fgets(line, sizeof(line), f)) {
+			if(sscanf(line, "%s %31s %llu %31s", bname, bmetric,
+				&bval, balloc) != 4 || strcmp(bname, name) != 0) {
+				if(write && !cfg_strlist_append(&keep,
+					strdup(line)))
+					fatal_exit("out of memory");
+				continue;
+			}
+			found = 1;
+			if(write)
+				continue;
+			if(strcmp(bmetric, metric) != 0) {
+				printf("%s: baseline has %s, measured %s, not "
+					"compared\n", name, bmetric, metric);
+				continue;
+			}
+			if(val > bval + bval*(unsigned)tolerance/100) {
+				printf("%s: REGRESSION %s %llu, baseline %llu "
+					"(+%d%%)\n", name, metric, val, bval,
+					(int)((val-bval)*100/(bval?bval:1)));
+				ok = 0;
+			} else	printf("%s: %s %llu, baseline %llu, ok\n",
+					name, metric, val, bval);
+			if(!cost->have_alloc || strcmp(balloc, "-") == 0)
+				continue;
+			bytes = (unsigned long long)atoll(balloc);
+			if(alloc > bytes + bytes*(unsigned)tolerance/100) {
+				printf("%s: REGRESSION alloc %llu bytes, "
+					"baseline %llu (+%d%%)\n", name, alloc,
+					bytes, (int)((alloc-bytes)*100/
+					(bytes?bytes:1)));
+				ok = 0;
+			} else	printf("%s: alloc %llu bytes, baseline %llu, "
+					"ok\n", name, alloc, bytes);
+		}
+		fclose(f);
+	}
+	if(!write) {
+		if(!found)
+			printf("%s: not in baseline %s\n", name, basefile);
+		return ok;
+	}
+	if(!(f = fopen(basefile, "w"))) {
+		log_err("could not open %s: %s", basefile, strerror(errno));
+		config_delstrlist(keep.first);
+		return 0;
+	}
+	for(p = keep.first; p; p = p->next)
+		fputs(p->str, f);
+	if(cost->have_alloc)
+		fprintf(f, "%s %s %llu %llu\n", name, metric, val, alloc);
+	else	fprintf(f, "%s %s %llu -\n", name, metric, val);
+	fclose(f);
+	config_delstrlist(keep.first);
+	printf("%s: baseline %s %llu written\n", name, metric, val);
+	return 1;
+}
+
 /**
  * Main fake event test program. Setup, teardown and report errors.
  * @param argc: arg count.
@@ -269,6 +409,9 @@ main(int argc, char* argv[])
 	int pass_argc = 0;
 	char* pass_argv[MAXARG];
 	char* playback_file = NULL;
+	char* baseline_file = NULL;
+	int perf_count = 0, perf_write = 0, perf_tolerance = PERF_TOLERANCE;
+	struct fake_event_cost cost;
 	int init_optind = optind;
 	char* init_optarg = optarg;
 	struct replay_scenario* scen = NULL;
@@ -281,7 +424,7 @@ main(int argc, char* argv[])
 	pass_argc = 1;
 	pass_argv[0] = "unbound";
 	add_opts("-d", &pass_argc, pass_argv);
-	while( (c=getopt(argc, argv, "12egho:p:s")) != -1) {
+	while( (c=getopt(argc, argv, "12b:eghn:o:p:st:w")) != -1) {
 		switch(c) {
 		case 's':
 			free(pass_argv[1]);
@@ -343,6 +486,18 @@ main(int argc, char* argv[])
 		case 'o':
 			add_opts(optarg, &pass_argc, pass_argv);
 			break;
+		case 'n':
+			perf_count = atoi(optarg);
+			break;
+		case 'b':
+			baseline_file = optarg;
+			break;
+		case 'w':
+			perf_write = 1;
+			break;
+		case 't':
+			perf_tolerance = atoi(optarg);
+			break;
 		case '?':
 		case 'h':
 		default:
@@ -374,6 +529,28 @@ main(int argc, char* argv[])
 
 	/* run the normal daemon */
 	res = daemon_main(pass_argc, pass_argv);
+	if(res == 0 && perf_count > 0) {
+		res = perf_runs(scen, perf_count, pass_argc, pass_argv,
+			init_optind, init_optarg, &cost);
+		if(res == 0 && cost.runs > 0) {
+			printf("%s: %d runs, per run: %llu usec (min %llu)",
+				perf_name(playback_file), cost.runs,
+				(unsigned long long)cost.usec/cost.runs,
+				(unsigned long long)cost.usec_min);
+			if(cost.have_instructions)
+				printf(", %llu instructions",
+					(unsigned long long)cost.instructions/
+					cost.runs);
+			if(cost.have_alloc)
+				printf(", %llu bytes allocated",
+					(unsigned long long)cost.alloc/cost.runs);
+			printf("\n");
+			if(baseline_file && !perf_baseline(baseline_file,
+				perf_name(playback_file), &cost, perf_write,
+				perf_tolerance))
+				res = 1;
+		}
+	}
 
 	fake_event_cleanup();
 	for(c=1; c<pass_argc; c++)
@@ -43,6 +43,7 @@
 #include "util/data/dname.h"
 #include "testcode/unitmain.h"
 #include "validator/val_anchor.h"
+#include "validator/autotrust.h"
 #include "sldns/sbuffer.h"
 #include "sldns/rrdef.h"
 
@@ -122,6 +123,39 @@ test_anchors(sldns_buffer* buff, struct val_anchors* a)
 	unit_assert(anchors_lookup(a, (uint8_t*)"\002oo\000", 4, c) == NULL);
 }
 
+/** test the autotrust writer thread, it writes the latest contents */
+static void
+test_autr_writer(void)
+{
+	struct val_anchors* a;
+	char fname[256], data[64], buf[64];
+	FILE* in;
+	size_t n;
+	int i;
+	snprintf(fname, sizeof(fname), "/tmp/unbound.autr.%d.key",
+		(int)getpid());
+	unit_assert(a = anchors_create());
+	if(!autr_writer_start(a, 1)) {
+		/* no threads, nothing to test */
+		anchors_delete(a);
+		return;
+	}
+	for(i=0; i<100; i++) {
+		char* d;
+		snprintf(data, sizeof(data), "; contents %d\n", i);
+		unit_assert(d = strdup(data));
+		autr_writer_queue(a->autr->writer, fname, d, strlen(d));
+	}
+	/* the writes are done before the writer stops */
+	anchors_delete(a);
+	unit_assert(in = fopen(fname, "r"));
+	n = fread(buf, 1, sizeof(buf)-1, in);
+	buf[n] = 0;
+	fclose(in);
+	unit_assert(strcmp(buf, data) == 0);
+	unlink(fname);
+}
+
 void anchors_test(void)
 {
 	sldns_buffer* buff = sldns_buffer_new(65800);
@@ -134,4 +168,5 @@ void anchors_test(void)
 	test_anchors(buff, a);
 	anchors_delete(a);
 	sldns_buffer_free(buff);
+	test_autr_writer();
 }
@@ -39,9 +39,15 @@
  */
 
 #include "config.h"
+#include <ctype.h>
+#include <sys/time.h>
 #include "util/log.h"
 #include "testcode/unitmain.h"
 #include "util/data/dname.h"
+#include "util/storage/siphash.h"
+#include "util/storage/lookup3.h"
+#include "util/storage/slabhash.h"
+#include "util/net_help.h"
 #include "sldns/sbuffer.h"
 #include "sldns/str2wire.h"
 
@@ -830,6 +836,231 @@ dname_setup_bufs(sldns_buffer* loopbuf, sldns_buffer* boundbuf)
 	sldns_buffer_flip(boundbuf);
 }
 
+/** test the incremental keyed hash against the one in one go */
+static void
+dname_test_siphash_pieces(void)
+{
+	uint8_t data[200], low[200];
+	size_t len, i, j, piece;
+	struct siphash_state st;
+	unit_show_func("util/storage/siphash.c", "siphash_update");
+	for(i=0; i<2000; i++) {
+		len = (size_t)random()%sizeof(data);
+		for(j=0; j<len; j++) {
+			data[j] = (uint8_t)random();
+			low[j] = (data[j] >= 'A' && data[j] <= 'Z')?
+				data[j]+0x20:data[j];
+		}
+		/* in random pieces */
+		siphash_init(&st, (uint32_t)i);
+		for(j=0; j<len; j+=piece) {
+			piece = (size_t)random()%12;
+			if(piece > len-j)
+				piece = len-j;
+			siphash_update(&st, data+j, piece);
+		}
+		unit_assert(siphash_final(&st) ==
+			siphash_hash(data, len, (uint32_t)i));
+		/* lowercased, in random pieces */
+		siphash_init(&st, (uint32_t)i);
+		for(j=0; j<len; j+=piece) {
+			piece = (size_t)random()%12;
+			if(piece > len-j)
+				piece = len-j;
+			siphash_update_lower(&st, data+j, piece);
+		}
+		unit_assert(siphash_final(&st) ==
+			siphash_hash(low, len, (uint32_t)i));
+		unit_assert(siphash_hash_lower(data, len, (uint32_t)i) ==
+			siphash_hash(low, len, (uint32_t)i));
+	}
+	/* the initval and the seed change the result */
+	unit_assert(siphash_hash(data, 10, 1) != siphash_hash(data, 10, 2));
+}
+
+/** test siphash24 with the vectors of the reference implementation */
+static void
+dname_test_siphash24(void)
+{
+	uint8_t key[SIPHASH24_KEYSIZE], data[64];
+	size_t i;
+	unit_show_func("util/storage/siphash.c", "siphash24");
+	for(i=0; i<sizeof(key); i++)
+		key[i] = (uint8_t)i;
+	for(i=0; i<sizeof(data); i++)
+		data[i] = (uint8_t)i;
+	unit_assert(siphash24(key, data, 0) ==
+		(uint64_t)0x726fdb47dd0e0e31ULL);
+	unit_assert(siphash24(key, data, 1) ==
+		(uint64_t)0x74f839c593dc67fdULL);
+	unit_assert(siphash24(key, data, 8) ==
+		(uint64_t)0x93f5f5799a932462ULL);
+	unit_assert(siphash24(key, data, 15) ==
+		(uint64_t)0xa129ca6149be45e5ULL);
+	unit_assert(siphash24(key, data, 63) ==
+		(uint64_t)0x958a324ceb064572ULL);
+}
+
+/** test dname_query_hash and dname_pkt_hash */
+static void
+dname_test_hash(sldns_buffer* buff)
+{
+	uint8_t seed[SIPHASH_SEEDSIZE];
+	hashvalue_type h1;
+	size_t i;
+	unit_show_func("util/data/dname.c", "dname_query_hash");
+	h1 = dname_query_hash((uint8_t*)"\003www\007example\003com\000", 0xab);
+	unit_assert(h1 == dname_query_hash(
+		(uint8_t*)"\003WwW\007exAMPle\003COM\000", 0xab));
+	unit_assert(h1 != dname_query_hash(
+		(uint8_t*)"\002ww\010wexample\003com\000", 0xab));
+	unit_assert(h1 != dname_query_hash(
+		(uint8_t*)"\003www\007example\003com\000", 0xac));
+	unit_assert(dname_query_hash((uint8_t*)"\000", 0xab) !=
+		dname_query_hash((uint8_t*)"\003com\000", 0xab));
+
+	unit_show_func("util/data/dname.c", "dname_pkt_hash");
+	/* www.EXample.com with a pointer to example.com at offset 12 */
+	sldns_buffer_clear(buff);
+	sldns_buffer_write(buff, "\000\000\000\000\000\000\000\000"
+		"\000\000\000\000", 12);
+	sldns_buffer_write(buff, "\007EXample\003com\000", 13);
+	sldns_buffer_write(buff, "\003www\300\014", 6);
+	sldns_buffer_flip(buff);
+	unit_assert(h1 == dname_pkt_hash(buff, sldns_buffer_at(buff, 25),
+		0xab));
+	unit_assert(dname_query_hash((uint8_t*)"\007example\003com\000",
+		0xab) == dname_pkt_hash(buff, sldns_buffer_at(buff, 12), 0xab));
+
+	/* another seed gives another hash */
+	for(i=0; i<sizeof(seed); i++)
+		seed[i] = (uint8_t)random();
+	siphash_set_seed(seed);
+	unit_assert(h1 != dname_query_hash(
+		(uint8_t*)"\003www\007example\003com\000", 0xab));
+	unit_assert(dname_query_hash((uint8_t*)"\003www\007example\003com"
+		"\000", 0xab) == dname_pkt_hash(buff,
+		sldns_buffer_at(buff, 25), 0xab));
+}
+
+/** the previous name hash, label by label with lookup3, to compare */
+static hashvalue_type
+dname_lookup3_hash(uint8_t* dname, hashvalue_type h)
+{
+	uint8_t labuf[LDNS_MAX_LABELLEN+1];
+	uint8_t lablen;
+	int i;
+	lablen = *dname++;
+	while(lablen) {
+		labuf[0] = lablen;
+		i=0;
+		while(lablen--) {
+			labuf[++i] = (uint8_t)tolower((unsigned char)*dname);
+			dname++;
+		}
+		h = hashlittle(labuf, labuf[0] + 1, h);
+		lablen = *dname++;
+	}
+	return h;
+}
+
+/** number of names for the hash benchmark */
+#define HASHBENCH_NUM 100000
+
+/** fill the slabhash with the names, check the bin chain length, and
+ * with -b print the bin chain stats */
+static void
+dname_hash_chains(uint8_t** names, int num, const char* desc, int sip)
+{
+	struct slabhash* table = slabhash_create(4, 1024, 1024*1024*1024,
+		test_slabhash_sizefunc, test_slabhash_compfunc,
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	size_t bins, used, maxlen;
+	int i;
+	unit_assert(table);
+	for(i=0; i<num; i++) {
+		struct slabhash_testkey* k = (struct slabhash_testkey*)calloc(
+			1, sizeof(*k));
+		struct slabhash_testdata* d = (struct slabhash_testdata*)
+			calloc(1, sizeof(*d));
+		unit_assert(k && d);
+		k->id = i;
+		k->entry.key = k;
+		k->entry.data = d;
+		k->entry.hash = sip?dname_query_hash(names[i], 0xab):
+			dname_lookup3_hash(names[i], 0xab);
+		lock_rw_init(&k->entry.lock);
+		slabhash_insert(table, k->entry.hash, &k->entry, d, NULL);
+	}
+	slabhash_chain_stats(table, &bins, &used, &maxlen);
+	if(unit_bench)
+		printf("%s: %d names in %u bins, %u bins used, longest "
+			"chain %u\n", desc, num, (unsigned)bins,
+			(unsigned)used, (unsigned)maxlen);
+	unit_assert(maxlen < 16);
+	slabhash_delete(table);
+}
+
+/** time the name hashes, and compare the spread with that of lookup3 */
+static void
+dname_hash_time(uint8_t** names)
+{
+	struct timeval start, end;
+	hashvalue_type sum = 0;
+	double t_lookup3, t_sip;
+	int i, r;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(r=0; r<10; r++)
+		for(i=0; i<HASHBENCH_NUM; i++)
+			sum += dname_lookup3_hash(names[i], 0xab);
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	t_lookup3 = ((double)end.tv_sec - (double)start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(r=0; r<10; r++)
+		for(i=0; i<HASHBENCH_NUM; i++)
+			sum += dname_query_hash(names[i], 0xab);
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	t_sip = ((double)end.tv_sec - (double)start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	printf("name hash: %d names, lookup3 by label %g msec, "
+		"siphash %g msec (%u)\n", HASHBENCH_NUM*10, t_lookup3, t_sip,
+		(unsigned)(sum&1));
+	dname_hash_chains(names, HASHBENCH_NUM, "lookup3 bins", 0);
+}
+
+/** check the spread of the name hash over the bins, and with -b time the
+ * name hashes */
+static void
+dname_test_hash_spread(void)
+{
+	uint8_t** names = (uint8_t**)calloc(HASHBENCH_NUM, sizeof(uint8_t*));
+	char str[64];
+	uint8_t wire[LDNS_MAX_DOMAINLEN+1];
+	size_t len;
+	int i;
+	unit_show_func("util/data/dname.c", "dname_query_hash spread");
+	unit_assert(names);
+	for(i=0; i<HASHBENCH_NUM; i++) {
+		snprintf(str, sizeof(str), "Host%d.Zone%d.example.com.", i,
+			i%97);
+		len = sizeof(wire);
+		unit_assert(sldns_str2wire_dname_buf(str, wire, &len) == 0);
+		names[i] = memdup(wire, len);
+		unit_assert(names[i]);
+	}
+	dname_hash_chains(names, HASHBENCH_NUM, "siphash bins", 1);
+	if(unit_bench)
+		dname_hash_time(names);
+	for(i=0; i<HASHBENCH_NUM; i++)
+		free(names[i]);
+	free(names);
+}
+
 void dname_test(void)
 {
 	sldns_buffer* loopbuf = sldns_buffer_new(14);
@@ -855,6 +1086,10 @@ void dname_test(void)
 	dname_test_canoncmp();
 	dname_test_topdomain();
 	dname_test_valid();
+	dname_test_siphash_pieces();
+	dname_test_siphash24();
+	dname_test_hash(buff);
+	dname_test_hash_spread();
 	sldns_buffer_free(buff);
 	sldns_buffer_free(loopbuf);
 	sldns_buffer_free(boundbuf);
@@ -44,6 +44,7 @@
 #include "sldns/sbuffer.h"
 #include "sldns/str2wire.h"
 #include "sldns/wire2str.h"
+#include <sys/time.h>
 
 /** verbose this unit test */
 static int vbmp = 0; 
@@ -210,9 +211,218 @@ rr_tests(void)
 	rr_test_file("testdata/test_ldnsrr.5", "testdata/test_ldnsrr.c5");
 }
 
+/** append a random domain name to the line */
+static void
+rr_fast_rnd_name(char* line, size_t max)
+{
+	const char* ch = "abcdefghijklmnopqrstuvwxyzABCDEFGH0123456789-_*";
+	size_t labs = (size_t)random()%5, i, l, n;
+	size_t pos = strlen(line);
+	if(random()%16 == 0) {
+		/* odd names, mostly for the full parser */
+		const char* odd[] = {".", "@", "a..b.", ".a.", "a\\.b.",
+			"\\065.com.", "x"};
+		snprintf(line+pos, max-pos, "%s",
+			odd[(size_t)random()%(sizeof(odd)/sizeof(*odd))]);
+		return;
+	}
+	for(i=0; i<=labs; i++) {
+		n = (random()%32 == 0)?64:1+(size_t)random()%10;
+		for(l=0; l<n && pos+2<max; l++)
+			line[pos++] = ch[(size_t)random()%strlen(ch)];
+		if(i<labs || random()%4 != 0)
+			line[pos++] = '.';
+	}
+	line[pos] = 0;
+}
+
+/** append a random blank separator to the line */
+static void
+rr_fast_rnd_blank(char* line, size_t max)
+{
+	const char* b[] = {" ", " ", " ", "\t", "  ", " \t "};
+	size_t pos = strlen(line);
+	snprintf(line+pos, max-pos, "%s",
+		b[(size_t)random()%(sizeof(b)/sizeof(*b))]);
+}
+
+/** make a random RR line, aimed at the fast path and its edges */
+static void
+rr_fast_rnd_line(char* line, size_t max)
+{
+	const char* cls[] = {"IN", "in", "CH", "HS", "CLASS1", "ANY"};
+	const char* tps[] = {"A", "a", "AAAA", "NS", "CNAME", "PTR", "ptr",
+		"TXT", "txt", "MX", "TYPE1"};
+	const char* a[] = {"192.0.2.1", "10.1.2.3", "1.2.3", "300.1.1.1",
+		"01.2.3.4", "255.255.255.255", "::1"};
+	const char* aaaa[] = {"2001:db8::1", "::", "::ffff:1.2.3.4",
+		"2001:db8::g", "1.2.3.4", "fe80::1:2:3:4"};
+	const char* txt[] = {"\"hello world\"", "word", "\"\"",
+		"\"a\" \"b c\"", "\"semi;colon\"", "\"esc\\\"aped\"",
+		"\"open", "a\"b", "\"x\"y", "\"tab\there\"", "two words"};
+	const char* tp;
+	size_t pos;
+	line[0] = 0;
+	if(random()%32 == 0)
+		rr_fast_rnd_blank(line, max);
+	rr_fast_rnd_name(line, max);
+	rr_fast_rnd_blank(line, max);
+	pos = strlen(line);
+	switch(random()%5) {
+	case 0: snprintf(line+pos, max-pos, "%u ",
+		(unsigned)random()%86400); break;
+	case 1: snprintf(line+pos, max-pos, "%s ", (random()%2)?
+		"4294967297":"1h"); break;
+	default: break;
+	}
+	pos = strlen(line);
+	if(random()%2)
+		snprintf(line+pos, max-pos, "%s ",
+			cls[(random()%4==0)?(size_t)random()%6:0]);
+	tp = tps[(size_t)random()%(sizeof(tps)/sizeof(*tps))];
+	pos = strlen(line);
+	snprintf(line+pos, max-pos, "%s", tp);
+	rr_fast_rnd_blank(line, max);
+	pos = strlen(line);
+	if(strcasecmp(tp, "A") == 0 || strcmp(tp, "MX") == 0 ||
+		strcmp(tp, "TYPE1") == 0) {
+		snprintf(line+pos, max-pos, "%s%s", (strcmp(tp, "MX")==0)?
+			"10 ":"", a[(size_t)random()%(sizeof(a)/sizeof(*a))]);
+	} else if(strcmp(tp, "AAAA") == 0) {
+		snprintf(line+pos, max-pos, "%s",
+			aaaa[(size_t)random()%(sizeof(aaaa)/sizeof(*aaaa))]);
+	} else if(strcasecmp(tp, "TXT") == 0) {
+		int i, n = 1+random()%3;
+		for(i=0; i<n; i++) {
+			pos = strlen(line);
+			if(random()%16 == 0) {
+				/* too long for one string */
+				memset(line+pos, 'x', 300);
+				line[pos+300] = 0;
+			} else snprintf(line+pos, max-pos, "%s ", txt[(size_t)
+				random()%(sizeof(txt)/sizeof(*txt))]);
+		}
+	} else {
+		rr_fast_rnd_name(line, max);
+	}
+	if(random()%4 == 0)
+		rr_fast_rnd_blank(line, max);
+	if(random()%32 == 0) {
+		pos = strlen(line);
+		snprintf(line+pos, max-pos, " ; comment");
+	}
+}
+
+/** see that the fast path gives the same as the full parser */
+static void
+rr_fast_test(void)
+{
+	char line[1024], line2[1024];
+	uint8_t rr1[LDNS_RR_BUF_SIZE], rr2[LDNS_RR_BUF_SIZE];
+	uint8_t owner[LDNS_MAX_DOMAINLEN+1];
+	uint8_t org[] = {7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0};
+	char ownerstr[1024];
+	size_t len1, len2, dlen1, dlen2, olen, i, n = 200000, fast = 0;
+	uint32_t dttl;
+	uint8_t* origin;
+	char* sp;
+	unit_show_func("sldns/str2wire.c", "sldns_str2wire_rr_fast_buf");
+	srandom(42);
+	for(i=0; i<n; i++) {
+		rr_fast_rnd_line(line, sizeof(line));
+		origin = (random()%2)?org:NULL;
+		dttl = (random()%2)?0:7200;
+		len1 = sizeof(rr1);
+		if(!sldns_str2wire_rr_fast_buf(line, rr1, &len1, &dlen1,
+			dttl, origin, sizeof(org)))
+			continue;
+		fast++;
+		/* the full parser, with the owner as previous owner name
+		 * because a blank start skips the fast path */
+		sp = line + strcspn(line, " \t");
+		memmove(ownerstr, line, (size_t)(sp-line));
+		ownerstr[sp-line] = 0;
+		olen = sizeof(owner);
+		unit_assert(sldns_str2wire_dname_buf_origin(ownerstr, owner,
+			&olen, origin, sizeof(org)) == 0);
+		snprintf(line2, sizeof(line2), "%s", sp);
+		len2 = sizeof(rr2);
+		if(sldns_str2wire_rr_buf(line2, rr2, &len2, &dlen2,
+			dttl, origin, sizeof(org), owner, olen)
+			!= 0 || len1 != len2 || dlen1 != dlen2 ||
+			memcmp(rr1, rr2, len1) != 0) {
+			printf("fast path differs for line: %s\n", line);
+			unit_assert(0);
+		}
+	}
+	/* the generated lines are mostly simple */
+	unit_assert(fast > n/4);
+}
+
+/** records per second for bulk local-data style lines, the full parser
+ * is measured with a blank start and the owner as previous owner name */
+static void
+rr_fast_bench(void)
+{
+	const size_t n = 100000;
+	char* lines = malloc(n*128);
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	uint8_t owner[] = {4, 'h', 'o', 's', 't', 7, 'e', 'x', 'a', 'm', 'p',
+		'l', 'e', 0};
+	size_t i, len, dlen;
+	struct timeval start, end;
+	double dt_fast, dt_full;
+	char* l;
+	unit_assert(lines);
+	for(i=0; i<n; i++) {
+		l = lines + i*128;
+		l[0] = ' '; /* a blank start for the full parser run */
+		switch(i%4) {
+		case 0: snprintf(l+1, 127, "host%u.example. 3600 IN A "
+			"10.%u.%u.%u", (unsigned)i, (unsigned)(i>>16)&0xff,
+			(unsigned)(i>>8)&0xff, (unsigned)i&0xff); break;
+		case 1: snprintf(l+1, 127, "host%u.example. 3600 IN AAAA "
+			"2001:db8::%x", (unsigned)i, (unsigned)i&0xffff); break;
+		case 2: snprintf(l+1, 127, "www%u.example. IN CNAME "
+			"host%u.example.", (unsigned)i, (unsigned)i); break;
+		default: snprintf(l+1, 127, "host%u.example. TXT \"v=spf1 "
+			"ip4:192.0.2.0/24 -all\"", (unsigned)i); break;
+		}
+	}
+	gettimeofday(&start, NULL);
+	for(i=0; i<n; i++) {
+		len = sizeof(rr);
+		unit_assert(sldns_str2wire_rr_buf(lines+i*128+1, rr, &len,
+			&dlen, 0, NULL, 0, NULL, 0) == 0);
+	}
+	gettimeofday(&end, NULL);
+	dt_fast = (end.tv_sec-start.tv_sec) +
+		(end.tv_usec-start.tv_usec)/1000000.;
+	gettimeofday(&start, NULL);
+	for(i=0; i<n; i++) {
+		len = sizeof(rr);
+		/* skip the owner, the full parser takes the previous one */
+		l = lines+i*128+1;
+		l += strcspn(l, " ");
+		unit_assert(sldns_str2wire_rr_buf(l, rr, &len,
+			&dlen, 0, NULL, 0, owner, sizeof(owner)) == 0);
+	}
+	gettimeofday(&end, NULL);
+	dt_full = (end.tv_sec-start.tv_sec) +
+		(end.tv_usec-start.tv_usec)/1000000.;
+	if(dt_fast <= 0.) dt_fast = 0.000001;
+	if(dt_full <= 0.) dt_full = 0.000001;
+	printf("str2wire rr: fast path %.0f rr/s, full parser %.0f rr/s\n",
+		(double)n/dt_fast, (double)n/dt_full);
+	free(lines);
+}
+
 void
 ldns_test(void)
 {
 	unit_show_feature("sldns");
 	rr_tests();
+	rr_fast_test();
+	if(unit_bench)
+		rr_fast_bench();
 }
@@ -227,6 +227,174 @@ test_short_table(struct lruhash* table)
 	lruhash_remove(table, myhash(14), k2);
 }
 
+/** see if the key with the id is in the table */
+static int
+test_has_id(struct lruhash* table, int id)
+{
+	testkey_type* k = newkey(id);
+	struct lruhash_entry* e = lruhash_lookup(table, myhash(id), k, 0);
+	if(e)
+		lock_rw_unlock(&e->lock);
+	delkey(k);
+	return e != NULL;
+}
+
+/** test that pinned entries are not reclaimed */
+static void
+test_pinned(struct lruhash* table)
+{
+	int i, pin_below = 3;
+	size_t sz = test_slabhash_sizefunc(NULL, NULL);
+	lruhash_setpinfunc(table, test_slabhash_pinfunc, &pin_below, 0);
+	/* many more entries than fit in the table */
+	for(i=0; i<1000; i++) {
+		testkey_type* k = newkey(i);
+		testdata_type* d = newdata(i);
+		k->entry.data = d;
+		lruhash_insert(table, myhash(i), &k->entry, d, NULL);
+	}
+	unit_assert(table->num_pinned == 3);
+	unit_assert(table->space_pinned == 3*sz);
+	unit_assert(table->space_used <= table->space_max);
+	for(i=0; i<3; i++)
+		unit_assert(test_has_id(table, i));
+	unit_assert(!test_has_id(table, 3));
+	unit_assert(test_has_id(table, 999));
+	/* update of a pinned entry keeps it pinned */
+	{
+		testkey_type* k = newkey(1);
+		testdata_type* d = newdata(1001);
+		k->entry.data = d;
+		lruhash_insert(table, myhash(1), &k->entry, d, NULL);
+	}
+	unit_assert(table->num_pinned == 3);
+	unit_assert(table->space_pinned == 3*sz);
+
+	/* unpin, and the entries are reclaimed like the others */
+	pin_below = 0;
+	lruhash_repin(table);
+	unit_assert(table->num_pinned == 0 && table->space_pinned == 0);
+	unit_assert(table->pin_start == NULL);
+	for(i=1000; i<2000; i++) {
+		testkey_type* k = newkey(i);
+		testdata_type* d = newdata(i);
+		k->entry.data = d;
+		lruhash_insert(table, myhash(i), &k->entry, d, NULL);
+	}
+	for(i=0; i<3; i++)
+		unit_assert(!test_has_id(table, i));
+
+	/* pin entries that are in the table already */
+	pin_below = 1990;
+	lruhash_repin(table);
+	unit_assert(table->num_pinned > 0);
+	unit_assert(table->space_pinned == table->num_pinned*sz);
+	/* remove a pinned entry */
+	unit_assert(test_has_id(table, 1989));
+	{
+		size_t n = table->num_pinned;
+		testkey_type* k = newkey(1989);
+		lruhash_remove(table, myhash(1989), k);
+		delkey(k);
+		unit_assert(table->num_pinned == n-1);
+	}
+	unit_assert(!test_has_id(table, 1989));
+
+	/* the pinned space is limited, entries that do not fit are not
+	 * pinned, also not on insert */
+	lruhash_setpinfunc(table, test_slabhash_pinfunc, &pin_below, 2*sz);
+	pin_below = 0;
+	lruhash_repin(table);
+	pin_below = 1990;
+	lruhash_repin(table);
+	unit_assert(table->num_pinned == 2);
+	unit_assert(table->space_pinned == 2*sz);
+	for(i=0; i<3; i++) {
+		testkey_type* k = newkey(i);
+		testdata_type* d = newdata(i);
+		k->entry.data = d;
+		lruhash_insert(table, myhash(i), &k->entry, d, NULL);
+	}
+	unit_assert(table->num_pinned == 2);
+	unit_assert(table->space_pinned == 2*sz);
+	lruhash_setpinfunc(table, NULL, NULL, 0);
+	lruhash_clear(table);
+	unit_assert(table->num_pinned == 0 && table->space_pinned == 0);
+}
+
+/** insert entries with ids from start to end, charged to a quota */
+static void
+test_insert_quota(struct lruhash* table, int start, int end, uint16_t id)
+{
+	int i;
+	for(i=start; i<end; i++) {
+		testkey_type* k = newkey(i);
+		testdata_type* d = newdata(i);
+		k->entry.data = d;
+		lruhash_insert_quota(table, myhash(i), &k->entry, d, NULL, id);
+	}
+}
+
+/** count the entries in an lru list */
+static size_t
+test_list_len(struct lruhash_entry* p)
+{
+	size_t c = 0;
+	for(; p; p = p->lru_next) {
+		if(p->lru_next)
+			unit_assert(p->lru_next->lru_prev == p);
+		c++;
+	}
+	return c;
+}
+
+/** test that quotas limit the entries charged to them */
+static void
+test_quota(struct lruhash* table)
+{
+	size_t sz = test_slabhash_sizefunc(NULL, NULL);
+	size_t max[3], n = 0;
+	int i;
+	max[0] = 0;
+	max[1] = 10*sz;
+	max[2] = 0; /* only counted */
+	unit_assert(lruhash_set_quota(table, 3, max));
+	/* the quota is reclaimed while the table has space */
+	test_insert_quota(table, 0, 100, 1);
+	unit_assert(table->quota[1].space_used == 10*sz);
+	unit_assert(test_list_len(table->quota[1].lru_start) == 10);
+	unit_assert(test_has_id(table, 99) && test_has_id(table, 90));
+	unit_assert(!test_has_id(table, 89));
+	unit_assert(lruhash_get_quota_mem(table, 1) == 10*sz);
+
+	/* the others are reclaimed from the table lru list, the entries
+	 * within quota stay */
+	test_insert_quota(table, 1000, 1100, 2);
+	test_insert_quota(table, 2000, 3000, 0);
+	unit_assert(table->space_used <= table->space_max);
+	unit_assert(test_has_id(table, 99) && test_has_id(table, 90));
+	unit_assert(table->quota[1].space_used == 10*sz);
+	for(i=1000; i<1100; i++)
+		if(test_has_id(table, i))
+			n++;
+	unit_assert(table->quota[2].space_used == n*sz);
+	unit_assert(test_list_len(table->lru_start) + 10 == table->num);
+
+	/* an update moves the entry to the quota that inserts it */
+	test_insert_quota(table, 99, 100, 0);
+	unit_assert(table->quota[1].space_used == 9*sz);
+	unit_assert(test_list_len(table->quota[1].lru_start) == 9);
+	unit_assert(test_list_len(table->lru_start) + 9 == table->num);
+
+	/* removal of the quotas puts the entries in the table lru list */
+	unit_assert(lruhash_set_quota(table, 0, NULL));
+	unit_assert(table->quota == NULL && table->quota_num == 0);
+	unit_assert(test_list_len(table->lru_start) == table->num);
+	unit_assert(test_has_id(table, 90));
+	unit_assert(lruhash_get_quota_mem(table, 1) == 0);
+	lruhash_clear(table);
+}
+
 /** number of hash test max */
 #define HASHTESTMAX 25
 
@@ -496,4 +664,14 @@ void lruhash_test(void)
 		test_slabhash_delkey, test_slabhash_deldata, NULL);
 	test_threaded_table(table);
 	lruhash_delete(table);
+	table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	test_pinned(table);
+	lruhash_delete(table);
+	table = lruhash_create(2, 8192, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	test_quota(table);
+	lruhash_delete(table);
 }
@@ -68,6 +68,8 @@
 
 /** number of tests done */
 int testcount = 0;
+/** if the benchmarks run too */
+int unit_bench = 0;
 
 #include "util/alloc.h"
 /** test alloc code */
@@ -465,6 +467,7 @@ infra_test(void)
 	struct infra_key* k;
 	struct infra_data* d;
 	int init = 376;
+	int i;
 
 	unit_show_feature("infra cache");
 	unit_assert(ipstrtoaddr("127.0.0.1", 53, &one, &onelen));
@@ -522,11 +525,421 @@ infra_test(void)
 			now, &vs, &edns_lame, &to) );
 	unit_assert( vs == 0 && to == init && edns_lame == 1 );
 
+	/* the EDNS udp size, forgotten after truncated replies */
+	unit_assert( infra_udp_size(slab, &one, onelen, zone, zonelen,
+		now) == 0 );
+	infra_udp_size_tc(slab, &one, onelen, zone, zonelen, now);
+	unit_assert( infra_udp_size_update(slab, &one, onelen, zone, zonelen,
+		1232, now) );
+	unit_assert( infra_udp_size(slab, &one, onelen, zone, zonelen,
+		now) == 1232 );
+	for(i=0; i<INFRA_UDP_SIZE_TC_MAX-1; i++)
+		infra_udp_size_tc(slab, &one, onelen, zone, zonelen, now);
+	unit_assert( infra_udp_size(slab, &one, onelen, zone, zonelen,
+		now) == 1232 );
+	infra_udp_size_tc(slab, &one, onelen, zone, zonelen, now);
+	unit_assert( infra_udp_size(slab, &one, onelen, zone, zonelen,
+		now) == 0 );
+	unit_assert( infra_udp_size_update(slab, &one, onelen, zone, zonelen,
+		1232, now) );
+	unit_assert( infra_udp_size(slab, &one, onelen, zone, zonelen,
+		now + cfg->host_ttl + 10) == 0 );
+
 	infra_delete(slab);
 	config_delete(cfg);
 }
 
+/** test batched infra lookups and the per thread snapshots */
+static void
+infra_batch_test(void)
+{
+	struct sockaddr_storage addr[INFRA_BATCH_MAX];
+	socklen_t addrlen[INFRA_BATCH_MAX];
+	struct infra_lame_rtt info[INFRA_BATCH_MAX];
+	uint8_t* zone = (uint8_t*)"\007example\003com\000";
+	size_t zonelen = 13, i, num = INFRA_BATCH_MAX;
+	struct infra_cache* infra;
+	struct infra_local* local;
+	struct config_file* cfg = config_create();
+	time_t now = 100;
+	uint8_t edns_lame;
+	int vs, to, lame, dnsseclame, reclame, rtt, r;
+	char ip[32];
+
+	unit_show_feature("infra batch lookup");
+	unit_assert(cfg);
+	cfg->infra_cache_slabs = 4;
+	infra = infra_create(cfg);
+	local = infra_local_create();
+	unit_assert(infra && local);
+	for(i=0; i<num; i++) {
+		snprintf(ip, sizeof(ip), "192.0.2.%d", (int)i+1);
+		unit_assert(ipstrtoaddr(ip, 53, &addr[i], &addrlen[i]));
+		info[i].addr = &addr[i];
+		info[i].addrlen = addrlen[i];
+		/* every third host is unknown, some are lame or timed out */
+		if(i%3 == 0)
+			continue;
+		unit_assert(infra_host(infra, &addr[i], addrlen[i], zone,
+			zonelen, now, &vs, &edns_lame, &to));
+		unit_assert(infra_rtt_update(infra, &addr[i], addrlen[i],
+			zone, zonelen, LDNS_RR_TYPE_A, (int)(i*10+50), to,
+			now));
+		if(i%3 == 2 && i%2 == 0)
+			unit_assert(infra_set_lame(infra, &addr[i], addrlen[i],
+				zone, zonelen, now, 0, 0, LDNS_RR_TYPE_A));
+		if(i%5 == 4)
+			unit_assert(infra_rtt_update(infra, &addr[i],
+				addrlen[i], zone, zonelen, LDNS_RR_TYPE_A, -1,
+				to, now));
+	}
+
+	/* without and with the snapshots, the same as one at a time */
+	for(r=0; r<3; r++) {
+		infra_get_lame_rtt_batch(infra, r?local:NULL, info, num,
+			zone, zonelen, LDNS_RR_TYPE_A, now);
+		for(i=0; i<num; i++) {
+			int f = infra_get_lame_rtt(infra, &addr[i], addrlen[i],
+				zone, zonelen, LDNS_RR_TYPE_A, &lame,
+				&dnsseclame, &reclame, &rtt, now);
+			unit_assert(info[i].found == f);
+			unit_assert(f == (i%3 != 0));
+			if(!f)
+				continue;
+			unit_assert(info[i].lame == lame &&
+				info[i].dnsseclame == dnsseclame &&
+				info[i].reclame == reclame &&
+				info[i].rtt == rtt);
+		}
+	}
+	unit_assert(local->misses + local->hits == 2*num);
+
+	/* an update by this thread is seen at once, after invalidate */
+	infra_local_delete(local);
+	local = infra_local_create();
+	unit_assert(local);
+	infra_get_lame_rtt_batch(infra, local, info+1, 1, zone, zonelen,
+		LDNS_RR_TYPE_A, now);
+	unit_assert(info[1].found && !info[1].lame && local->misses == 1);
+	unit_assert(infra_set_lame(infra, &addr[1], addrlen[1], zone,
+		zonelen, now, 0, 0, LDNS_RR_TYPE_A));
+	infra_get_lame_rtt_batch(infra, local, info+1, 1, zone, zonelen,
+		LDNS_RR_TYPE_A, now);
+	unit_assert(info[1].found && !info[1].lame && local->hits == 1);
+	infra_local_invalidate(local, &addr[1], addrlen[1], zone, zonelen);
+	infra_get_lame_rtt_batch(infra, local, info+1, 1, zone, zonelen,
+		LDNS_RR_TYPE_A, now);
+	unit_assert(info[1].found && info[1].lame);
+
+	/* other updates are seen when the snapshot times out */
+	infra_get_lame_rtt_batch(infra, local, info, 1, zone, zonelen,
+		LDNS_RR_TYPE_A, now);
+	unit_assert(!info[0].found);
+	unit_assert(infra_host(infra, &addr[0], addrlen[0], zone, zonelen,
+		now, &vs, &edns_lame, &to));
+	infra_get_lame_rtt_batch(infra, local, info, 1, zone, zonelen,
+		LDNS_RR_TYPE_A, now);
+	unit_assert(!info[0].found);
+	infra_get_lame_rtt_batch(infra, local, info, 1, zone, zonelen,
+		LDNS_RR_TYPE_A, now+INFRA_LOCAL_TTL);
+	unit_assert(info[0].found && info[0].rtt == to);
+
+	infra_local_delete(local);
+	infra_delete(infra);
+	config_delete(cfg);
+}
+
+#include "iterator/iterator.h"
+#include "iterator/iter_utils.h"
+#include "iterator/iter_delegpt.h"
+#include "iterator/iter_donotq.h"
+#include "util/random.h"
+#include "util/module.h"
+#include "util/regional.h"
+
+/** test the health of forwarders: the error score, ejection, readmission
+ * and the latency weighted selection */
+static void
+infra_health_test(void)
+{
+	struct sockaddr_storage addr[3];
+	socklen_t addrlen[3];
+	uint8_t* zone = (uint8_t*)"\007example\003com\000";
+	size_t zonelen = 13;
+	uint8_t* fzone = (uint8_t*)"\003net\000";
+	struct config_file* cfg = config_create();
+	struct infra_cache* infra;
+	struct module_env env;
+	struct iter_env ie;
+	struct regional* region;
+	struct delegpt* dp;
+	struct delegpt_addr* a;
+	time_t now = 100;
+	int i, srtt, err, ejected, dlame = 0, rdlame = 0, count[3];
+	char ip[32];
+
+	unit_show_feature("forwarder health");
+	unit_assert(cfg);
+	infra = infra_create(cfg);
+	unit_assert(infra);
+	for(i=0; i<3; i++) {
+		snprintf(ip, sizeof(ip), "192.0.2.%d", i+1);
+		unit_assert(ipstrtoaddr(ip, 53, &addr[i], &addrlen[i]));
+	}
+
+	/* failures raise the error score, until the host is ejected */
+	unit_assert(!infra_get_health(infra, &addr[0], addrlen[0], zone,
+		zonelen, now, &srtt, &err, &ejected));
+	unit_assert(infra_rtt_update(infra, &addr[0], addrlen[0], zone,
+		zonelen, LDNS_RR_TYPE_A, 80, 376, now));
+	unit_assert(infra_get_health(infra, &addr[0], addrlen[0], zone,
+		zonelen, now, &srtt, &err, &ejected));
+	unit_assert(srtt == 10 && err == 0 && ejected == 0);
+	unit_assert(infra_server_error(infra, &addr[0], addrlen[0], zone,
+		zonelen, now));
+	unit_assert(infra_get_health(infra, &addr[0], addrlen[0], zone,
+		zonelen, now, &srtt, &err, &ejected));
+	unit_assert(err == 250 && ejected == 0);
+	unit_assert(infra_rtt_update(infra, &addr[0], addrlen[0], zone,
+		zonelen, LDNS_RR_TYPE_A, -1, 376, now));
+	unit_assert(infra_server_error(infra, &addr[0], addrlen[0], zone,
+		zonelen, now));
+	unit_assert(infra_get_health(infra, &addr[0], addrlen[0], zone,
+		zonelen, now, &srtt, &err, &ejected));
+	unit_assert(err > INFRA_EJECT_SCORE && ejected == INFRA_EJECT_TIME);
+
+	/* the ejection times out, or a good probe readmits the host */
+	unit_assert(infra_get_health(infra, &addr[0], addrlen[0], zone,
+		zonelen, now+INFRA_EJECT_TIME, &srtt, &err, &ejected));
+	unit_assert(ejected == 0);
+	unit_assert(infra_readmit(infra, &addr[0], addrlen[0], zone,
+		zonelen, now));
+	unit_assert(!infra_readmit(infra, &addr[0], addrlen[0], zone,
+		zonelen, now));
+	unit_assert(infra_get_health(infra, &addr[0], addrlen[0], zone,
+		zonelen, now, &srtt, &err, &ejected));
+	unit_assert(err == INFRA_READMIT_SCORE && ejected == 0);
+
+	/* replies make the error score decay */
+	for(i=0; i<20; i++)
+		unit_assert(infra_rtt_update(infra, &addr[0], addrlen[0],
+			zone, zonelen, LDNS_RR_TYPE_A, 80, 376, now));
+	unit_assert(infra_get_health(infra, &addr[0], addrlen[0], zone,
+		zonelen, now, &srtt, &err, &ejected));
+	unit_assert(err < 10 && ejected == 0);
+
+	/* a fast, a slow and an ejected forwarder */
+	for(i=0; i<50; i++) {
+		unit_assert(infra_rtt_update(infra, &addr[0], addrlen[0],
+			fzone, 5, LDNS_RR_TYPE_A, 10, 376, now));
+		unit_assert(infra_rtt_update(infra, &addr[1], addrlen[1],
+			fzone, 5, LDNS_RR_TYPE_A, 100, 376, now));
+		unit_assert(infra_rtt_update(infra, &addr[2], addrlen[2],
+			fzone, 5, LDNS_RR_TYPE_A, 10, 376, now));
+	}
+	for(i=0; i<3; i++)
+		unit_assert(infra_server_error(infra, &addr[2], addrlen[2],
+			fzone, 5, now));
+	memset(&ie, 0, sizeof(ie));
+	ie.supports_ipv4 = 1;
+	ie.supports_ipv6 = 1;
+	ie.fwd_health = 1;
+	unit_assert((ie.donotq = donotq_create()));
+	unit_assert(donotq_apply_cfg(ie.donotq, cfg));
+	memset(&env, 0, sizeof(env));
+	env.cfg = cfg;
+	env.infra_cache = infra;
+	env.now = &now;
+	unit_assert((env.rnd = ub_initstate(1, NULL)));
+	unit_assert((region = regional_create()));
+	unit_assert((dp = delegpt_create(region)));
+	unit_assert(delegpt_set_name(dp, region, fzone));
+	for(i=0; i<3; i++)
+		unit_assert(delegpt_add_addr(dp, region, &addr[i],
+			addrlen[i], 0, 0));
+	delegpt_add_unused_targets(dp);
+	memset(count, 0, sizeof(count));
+	for(i=0; i<1000; i++) {
+		a = iter_fwd_server_selection(&ie, &env, dp, fzone, 5,
+			LDNS_RR_TYPE_A, &dlame, &rdlame, 0, NULL);
+		unit_assert(a);
+		a->attempts = 0;
+		if(sockaddr_cmp(&a->addr, a->addrlen, &addr[0],
+			addrlen[0]) == 0)
+			count[0]++;
+		else if(sockaddr_cmp(&a->addr, a->addrlen, &addr[1],
+			addrlen[1]) == 0)
+			count[1]++;
+		else	count[2]++;
+	}
+	unit_assert(count[2] == 0);
+	unit_assert(count[1] > 0 && count[0] > 4*count[1]);
+	unit_assert(!dlame && !rdlame);
+
+	/* with all of them ejected, one is still selected */
+	for(i=0; i<3; i++) {
+		unit_assert(infra_server_error(infra, &addr[0], addrlen[0],
+			fzone, 5, now));
+		unit_assert(infra_server_error(infra, &addr[1], addrlen[1],
+			fzone, 5, now));
+	}
+	unit_assert(iter_fwd_server_selection(&ie, &env, dp, fzone, 5,
+		LDNS_RR_TYPE_A, &dlame, &rdlame, 0, NULL));
+
+	regional_destroy(region);
+	ub_randfree(env.rnd);
+	donotq_delete(ie.donotq);
+	infra_delete(infra);
+	config_delete(cfg);
+}
+
 #include "util/random.h"
+#include "util/locks.h"
+#include <sys/time.h>
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+/** number of threads for the random contention test, the thread numbers
+ * have to fit in THRDEBUG_MAX_THREADS for the lock checks */
+#define RND_THREADS 32
+/** number of random numbers per thread in the contention benchmark */
+#define RND_PERTHREAD 200000
+/** number of random numbers per thread in the test, without -b */
+#define RND_PERTHREAD_TEST 1000
+
+/** per thread data for the random contention test */
+struct rnd_thr {
+	/** thread num, first entry. */
+	int num;
+	/** the thread */
+	ub_thread_type thr;
+	/** random state of the thread, or NULL to use the shared one */
+	struct ub_randstate* rnd;
+	/** lock for the shared random state */
+	lock_basic_type* lock;
+	/** the shared random state */
+	struct ub_randstate* shared;
+	/** number of random numbers to draw */
+	int count;
+	/** sum of the values, so the calls are not optimized away */
+	long int sum;
+};
+
+/** thread that draws random numbers for the contention test */
+static void*
+rnd_thr_main(void* arg)
+{
+	struct rnd_thr* t = (struct rnd_thr*)arg;
+	int i;
+	for(i=0; i<t->count; i++) {
+		if(t->rnd) {
+			t->sum += ub_random_max(t->rnd, 1000);
+		} else {
+			lock_basic_lock(t->lock);
+			t->sum += ub_random_max(t->shared, 1000);
+			lock_basic_unlock(t->lock);
+		}
+	}
+	return NULL;
+}
+
+/** run the contention test threads, that draw count numbers each,
+ * returns msec spent */
+static double
+rnd_thr_run(struct rnd_thr* t, int per_thread, int count)
+{
+	struct ub_randstate* shared = NULL;
+	lock_basic_type lock;
+	struct timeval start, end;
+	int i;
+	lock_basic_init(&lock);
+	if(!per_thread)
+		unit_assert( (shared = ub_initstate(1, NULL)) );
+	for(i=0; i<RND_THREADS; i++) {
+		memset(&t[i], 0, sizeof(t[i]));
+		t[i].num = i+1;
+		t[i].lock = &lock;
+		t[i].shared = shared;
+		t[i].count = count;
+		if(per_thread)
+			unit_assert( (t[i].rnd = ub_initstate(1, NULL)) );
+	}
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<RND_THREADS; i++)
+		ub_thread_create(&t[i].thr, rnd_thr_main, &t[i]);
+	for(i=0; i<RND_THREADS; i++)
+		ub_thread_join(t[i].thr);
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<RND_THREADS; i++) {
+		unit_assert(t[i].sum > 0);
+		ub_randfree(t[i].rnd);
+	}
+	ub_randfree(shared);
+	lock_basic_destroy(&lock);
+	return ((double)end.tv_sec - (double)start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+}
+
+/** test random numbers from many threads at once, with a random state
+ * per thread, and with -b time it against one random state shared under
+ * a lock */
+static void
+rnd_thread_test(void)
+{
+	struct rnd_thr t[RND_THREADS];
+	double own, shared;
+	unit_show_feature("ub_random threads");
+	if(!unit_bench) {
+		(void)rnd_thr_run(t, 1, RND_PERTHREAD_TEST);
+		return;
+	}
+	own = rnd_thr_run(t, 1, RND_PERTHREAD);
+	shared = rnd_thr_run(t, 0, RND_PERTHREAD);
+	printf("ub_random %d threads x %d: per thread state %g msec, "
+		"locked shared state %g msec\n", RND_THREADS, RND_PERTHREAD,
+		own, shared);
+}
+
+/** test that the random state does not repeat its output in a forked
+ * child process */
+static void
+rnd_fork_test(void)
+{
+#if defined(HAVE_FORK) && defined(HAVE_SSL)
+	struct ub_randstate* r;
+	long int parent[16], child[16];
+	int fd[2], i, same = 0, status;
+	pid_t pid;
+	unit_show_feature("ub_random fork");
+	unit_assert( (r = ub_initstate(1, NULL)) );
+	(void)ub_random(r);
+	unit_assert(pipe(fd) == 0);
+	pid = fork();
+	unit_assert(pid != -1);
+	if(pid == 0) {
+		for(i=0; i<16; i++)
+			child[i] = ub_random(r);
+		if(write(fd[1], child, sizeof(child)) != (ssize_t)sizeof(child))
+			_exit(1);
+		_exit(0);
+	}
+	close(fd[1]);
+	for(i=0; i<16; i++)
+		parent[i] = ub_random(r);
+	unit_assert(read(fd[0], child, sizeof(child)) == (ssize_t)sizeof(child));
+	close(fd[0]);
+	unit_assert(waitpid(pid, &status, 0) == pid);
+	unit_assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+	for(i=0; i<16; i++)
+		if(parent[i] == child[i])
+			same++;
+	unit_assert(same < 16);
+	ub_randfree(r);
+#endif /* HAVE_FORK && HAVE_SSL */
+}
+
 /** test randomness */
 static void
 rnd_test(void)
@@ -556,6 +969,8 @@ rnd_test(void)
 		unit_assert(a[i] >= 0 && a[i] < 10);
 	}
 	ub_randfree(r);
+	rnd_fork_test();
+	rnd_thread_test();
 }
 
 #include "respip/respip.h"
@@ -819,6 +1234,1006 @@ static void respip_test(void)
 	respip_conf_actions_test();
 }
 
+#include "util/storage/dnstree.h"
+#include "util/data/dname.h"
+#include "sldns/str2wire.h"
+/** make random name for the name index test, from a small alphabet,
+ * so that there are many names in common, in mixed case */
+static size_t
+nidx_random_name(uint8_t* nm)
+{
+	const char* chars = "aBcAb\000-z";
+	int labs = random()%4, i, j;
+	size_t pos = 0;
+	for(i=0; i<labs; i++) {
+		int len = 1 + random()%3;
+		nm[pos++] = (uint8_t)len;
+		for(j=0; j<len; j++)
+			nm[pos++] = (uint8_t)chars[random()%9];
+	}
+	nm[pos++] = 0;
+	return pos;
+}
+
+/** delete name tree node for the name index test */
+static void
+nidx_del(rbnode_type* n, void* ATTR_UNUSED(arg))
+{
+	struct name_tree_node* node = (struct name_tree_node*)n;
+	free(node->name);
+	free(node);
+}
+
+/** create name tree with num names for the name index test */
+static void
+nidx_fill(rbtree_type* tree, int num, int bench)
+{
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	char buf[64];
+	size_t len;
+	int i;
+	name_tree_init(tree);
+	for(i=0; i<num; i++) {
+		struct name_tree_node* n = (struct name_tree_node*)calloc(1,
+			sizeof(*n));
+		unit_assert(n);
+		if(bench) {
+			snprintf(buf, sizeof(buf), "z%d.t%d.example.", i,
+				i%100);
+			len = sizeof(nm);
+			unit_assert(sldns_str2wire_dname_buf(buf, nm, &len)==0);
+		} else	len = nidx_random_name(nm);
+		n->name = memdup(nm, len);
+		unit_assert(n->name);
+		if(!name_tree_insert(tree, n, n->name, len,
+			dname_count_labels(n->name), bench?LDNS_RR_CLASS_IN:
+			(uint16_t)(1+random()%3))) {
+			free(n->name);
+			free(n);
+		}
+	}
+	name_tree_init_parents(tree);
+}
+
+/** test the name index against the name tree lookups */
+static void
+name_index_test(void)
+{
+	rbtree_type tree;
+	struct name_index* idx;
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	int i, j, m, m2;
+	unit_show_feature("name index");
+	for(i=0; i<100; i++) {
+		nidx_fill(&tree, random()%200, 0);
+		unit_assert( (idx = name_tree_index_create(&tree)) );
+		unit_assert(idx->count == tree.count);
+		for(j=0; j<200; j++) {
+			uint16_t c = (uint16_t)(1+random()%3);
+			size_t len = nidx_random_name(nm);
+			int labs = dname_count_labels(nm);
+			rbnode_type* res = NULL;
+			struct name_tree_node* n;
+			unit_assert(name_tree_lookup(&tree, nm, len, labs, c) ==
+				name_tree_lookup_index(idx, nm, c));
+			/* the less equal element and the labels in common */
+			n = (struct name_tree_node*)name_index_lookup(idx, nm,
+				c, &m);
+			if(n) {
+				struct name_tree_node key;
+				key.node.key = &key;
+				key.name = nm;
+				key.len = len;
+				key.labs = labs;
+				key.dclass = c;
+				(void)rbtree_find_less_equal(&tree, &key, &res);
+				unit_assert(res == &n->node);
+				if(n->dclass == c) {
+					(void)dname_lab_cmp(n->name, n->labs,
+						nm, labs, &m2);
+					unit_assert(m == m2);
+				}
+			}
+		}
+		name_index_delete(idx);
+		traverse_postorder(&tree, nidx_del, NULL);
+	}
+}
+
+/** time name index lookups against the name tree, for a tree size */
+static void
+name_index_bench(int num)
+{
+	rbtree_type tree;
+	struct name_index* idx;
+	uint8_t** q;
+	struct timeval start, end;
+	double t_tree, t_idx;
+	size_t found = 0, len;
+	int i, nq = 200000;
+	char buf[64];
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	nidx_fill(&tree, num, 1);
+	unit_assert( (idx = name_tree_index_create(&tree)) );
+	q = (uint8_t**)calloc((size_t)nq, sizeof(*q));
+	unit_assert(q);
+	for(i=0; i<nq; i++) {
+		/* below the names in the tree, and not in the tree */
+		snprintf(buf, sizeof(buf), "www.z%d.t%d.%s.", (int)(random()%
+			(num*2)), i%100, (i%4==0)?"example.net":"example");
+		len = sizeof(nm);
+		unit_assert(sldns_str2wire_dname_buf(buf, nm, &len) == 0);
+		q[i] = memdup(nm, len);
+		unit_assert(q[i]);
+	}
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<nq; i++) {
+		int labs = dname_count_size_labels(q[i], &len);
+		if(name_tree_lookup(&tree, q[i], len, labs, LDNS_RR_CLASS_IN))
+			found++;
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	t_tree = ((double)end.tv_sec - (double)start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<nq; i++) {
+		if(name_tree_lookup_index(idx, q[i], LDNS_RR_CLASS_IN))
+			found--;
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	t_idx = ((double)end.tv_sec - (double)start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	unit_assert(found == 0);
+	printf("name index: %d lookups in %d names, tree %g msec, "
+		"index %g msec\n", nq, num, t_tree, t_idx);
+	for(i=0; i<nq; i++)
+		free(q[i]);
+	free(q);
+	name_index_delete(idx);
+	traverse_postorder(&tree, nidx_del, NULL);
+}
+
+#include "util/module.h"
+#include "util/regional.h"
+/** test that the edns-tcp-keepalive timeout is echoed in replies */
+static void
+edns_keepalive_test(void)
+{
+	struct module_env env;
+	struct edns_data edns;
+	struct regional* region = regional_create();
+	uint8_t tm[2] = {0x04, 0xb0}; /* 120 seconds */
+	unit_show_func("util/data/msgreply.c", "inplace_cb_reply_call");
+	unit_assert(region);
+	memset(&env, 0, sizeof(env));
+
+	/* other options of the query are not copied, the timeout is */
+	memset(&edns, 0, sizeof(edns));
+	edns.edns_present = 1;
+	unit_assert(edns_opt_list_append(&edns.opt_list, LDNS_EDNS_NSID, 0,
+		NULL, region));
+	unit_assert(edns_opt_list_append(&edns.opt_list, LDNS_EDNS_KEEPALIVE,
+		sizeof(tm), tm, region));
+	unit_assert(inplace_cb_reply_call(&env, NULL, NULL, NULL, 0, &edns,
+		region));
+	unit_assert(edns.opt_list && !edns.opt_list->next);
+	unit_assert(edns.opt_list->opt_code == LDNS_EDNS_KEEPALIVE);
+	unit_assert(edns.opt_list->opt_len == sizeof(tm));
+	unit_assert(memcmp(edns.opt_list->opt_data, tm, sizeof(tm)) == 0);
+
+	/* the empty option of a query that was not answered is not echoed */
+	memset(&edns, 0, sizeof(edns));
+	edns.edns_present = 1;
+	unit_assert(edns_opt_list_append(&edns.opt_list, LDNS_EDNS_KEEPALIVE,
+		0, NULL, region));
+	unit_assert(inplace_cb_reply_call(&env, NULL, NULL, NULL, 0, &edns,
+		region));
+	unit_assert(edns.opt_list == NULL);
+	regional_destroy(region);
+}
+
+#include "util/edns.h"
+#include "sldns/sbuffer.h"
+/** test the DNS cookies */
+static void
+edns_cookie_test(void)
+{
+	uint8_t secret[EDNS_COOKIE_SECRET_SIZE], client[EDNS_COOKIE_CLIENT_SIZE];
+	uint8_t buf[EDNS_COOKIE_SIZE], c1[EDNS_COOKIE_CLIENT_SIZE],
+		c2[EDNS_COOKIE_CLIENT_SIZE], long_cookie[41], *found;
+	struct sockaddr_storage a1, a2;
+	socklen_t l1, l2;
+	struct edns_option opt;
+	sldns_buffer* pkt = sldns_buffer_new(512);
+	uint32_t now = 1000000;
+	size_t i, len;
+	int reuse;
+	unit_show_func("util/edns.c", "edns_cookie_server_check");
+	unit_assert(pkt);
+	for(i=0; i<sizeof(secret); i++)
+		secret[i] = (uint8_t)i;
+	memset(client, 0x42, sizeof(client));
+	unit_assert(ipstrtoaddr("192.0.2.1", 53, &a1, &l1));
+	unit_assert(ipstrtoaddr("2001:db8::1", 53, &a2, &l2));
+	memset(&opt, 0, sizeof(opt));
+	opt.opt_code = LDNS_EDNS_COOKIE;
+	opt.opt_data = buf;
+
+	unit_assert(edns_cookie_server_check(NULL, secret, &a1, l1, now,
+		&reuse) == cookie_none);
+	memmove(buf, client, sizeof(client));
+	opt.opt_len = EDNS_COOKIE_CLIENT_SIZE;
+	unit_assert(edns_cookie_server_check(&opt, secret, &a1, l1, now,
+		&reuse) == cookie_client && !reuse);
+	opt.opt_len = 10;
+	unit_assert(edns_cookie_server_check(&opt, secret, &a1, l1, now,
+		&reuse) == cookie_malformed);
+	opt.opt_len = 41;
+	opt.opt_data = long_cookie;
+	unit_assert(edns_cookie_server_check(&opt, secret, &a1, l1, now,
+		&reuse) == cookie_malformed);
+	opt.opt_data = buf;
+
+	/* our server cookie is valid for the client that got it */
+	edns_cookie_server_write(buf, client, secret, &a1, l1, now);
+	unit_assert(memcmp(buf, client, sizeof(client)) == 0);
+	opt.opt_len = EDNS_COOKIE_SIZE;
+	unit_assert(edns_cookie_server_check(&opt, secret, &a1, l1, now,
+		&reuse) == cookie_valid && reuse);
+	unit_assert(edns_cookie_server_check(&opt, secret, &a1, l1,
+		now+EDNS_COOKIE_REUSE+1, &reuse) == cookie_valid && !reuse);
+	unit_assert(edns_cookie_server_check(&opt, secret, &a1, l1,
+		now-EDNS_COOKIE_SKEW, &reuse) == cookie_valid);
+	unit_assert(edns_cookie_server_check(&opt, secret, &a1, l1,
+		now-EDNS_COOKIE_SKEW-1, &reuse) == cookie_invalid);
+	unit_assert(edns_cookie_server_check(&opt, secret, &a1, l1,
+		now+EDNS_COOKIE_LIFETIME+1, &reuse) == cookie_invalid);
+	unit_assert(edns_cookie_server_check(&opt, secret, &a2, l2, now,
+		&reuse) == cookie_invalid);
+	buf[0] ^= 1;
+	unit_assert(edns_cookie_server_check(&opt, secret, &a1, l1, now,
+		&reuse) == cookie_invalid);
+	buf[0] ^= 1;
+	secret[0] ^= 1;
+	unit_assert(edns_cookie_server_check(&opt, secret, &a1, l1, now,
+		&reuse) == cookie_invalid);
+	secret[0] ^= 1;
+	opt.opt_len = 16;
+	unit_assert(edns_cookie_server_check(&opt, secret, &a1, l1, now,
+		&reuse) == cookie_invalid);
+
+	unit_show_func("util/edns.c", "edns_cookie_client_write");
+	edns_cookie_client_write(c1, secret, &a1, l1);
+	edns_cookie_client_write(c2, secret, &a1, l1);
+	unit_assert(memcmp(c1, c2, sizeof(c1)) == 0);
+	edns_cookie_client_write(c2, secret, &a2, l2);
+	unit_assert(memcmp(c1, c2, sizeof(c1)) != 0);
+
+	unit_show_func("util/edns.c", "edns_cookie_find");
+	/* reply for . A with an OPT record with NSID and the cookie */
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write(pkt, "\000\001\201\200\000\001\000\000"
+		"\000\000\000\001", 12);
+	sldns_buffer_write(pkt, "\000\000\001\000\001", 5);
+	sldns_buffer_write(pkt, "\000\000\051\020\000\000\000\000\000", 9);
+	sldns_buffer_write_u16(pkt, 4+4+EDNS_COOKIE_SIZE);
+	sldns_buffer_write_u16(pkt, LDNS_EDNS_NSID);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, LDNS_EDNS_COOKIE);
+	sldns_buffer_write_u16(pkt, EDNS_COOKIE_SIZE);
+	sldns_buffer_write(pkt, buf, EDNS_COOKIE_SIZE);
+	sldns_buffer_flip(pkt);
+	sldns_buffer_set_position(pkt, 3);
+	found = edns_cookie_find(pkt, &len);
+	unit_assert(found && len == EDNS_COOKIE_SIZE);
+	unit_assert(memcmp(found, buf, len) == 0);
+	unit_assert(sldns_buffer_position(pkt) == 3);
+	/* truncated packet */
+	sldns_buffer_set_limit(pkt, sldns_buffer_limit(pkt)-1);
+	unit_assert(edns_cookie_find(pkt, &len) == NULL);
+	/* no additional record */
+	sldns_buffer_write_u16_at(pkt, 10, 0);
+	unit_assert(edns_cookie_find(pkt, &len) == NULL);
+	sldns_buffer_free(pkt);
+}
+
+#include "services/cache/peer.h"
+#include "util/data/msgreply.h"
+/** make an rrset for the cache peer test, in the region */
+static struct ub_packed_rrset_key*
+peer_test_rrset(struct regional* region, uint8_t* nm, size_t nmlen,
+	uint16_t type, size_t count, size_t rrsig_count)
+{
+	struct ub_packed_rrset_key* k;
+	struct packed_rrset_data* d;
+	size_t i, total = count + rrsig_count;
+	k = (struct ub_packed_rrset_key*)regional_alloc_zero(region,
+		sizeof(*k));
+	d = (struct packed_rrset_data*)regional_alloc_zero(region,
+		sizeof(*d) + total*(sizeof(size_t)+sizeof(uint8_t*)+
+		sizeof(time_t)+6));
+	unit_assert(k && d);
+	k->entry.key = k;
+	k->entry.data = d;
+	k->rk.dname = nm;
+	k->rk.dname_len = nmlen;
+	k->rk.type = htons(type);
+	k->rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	k->rk.flags = PACKED_RRSET_NSEC_AT_APEX;
+	d->ttl = 3600;
+	d->count = count;
+	d->rrsig_count = rrsig_count;
+	d->trust = rrset_trust_ans_AA;
+	d->security = sec_status_secure;
+	d->rr_len = (size_t*)((uint8_t*)d + sizeof(*d));
+	for(i=0; i<total; i++)
+		d->rr_len[i] = 6;
+	packed_rrset_ptr_fixup(d);
+	for(i=0; i<total; i++) {
+		d->rr_ttl[i] = 3600 - (time_t)i;
+		sldns_write_uint16(d->rr_data[i], 4);
+		sldns_write_uint32(d->rr_data[i]+2, 0xc0000200 + (uint32_t)i);
+	}
+	return k;
+}
+
+/** test the encoding of the cache peer records */
+static void
+cache_peer_test(void)
+{
+	struct regional* region = regional_create();
+	struct regional* region2 = regional_create();
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	uint8_t nm[] = "\003www\007example\003com";
+	struct query_info qinfo, q2;
+	struct reply_info* rep, *r2;
+	struct packed_rrset_data* d, *d2;
+	uint16_t flags = 0;
+	size_t i, len;
+	unit_show_func("services/cache/peer.c", "cache_peer_encode");
+	unit_assert(region && region2 && buf);
+	memset(&qinfo, 0, sizeof(qinfo));
+	qinfo.qname = nm;
+	qinfo.qname_len = sizeof(nm);
+	qinfo.qtype = LDNS_RR_TYPE_A;
+	qinfo.qclass = LDNS_RR_CLASS_IN;
+	rep = construct_reply_info_base(region, BIT_QR|BIT_RD, 1, 3600, 3240,
+		1, 1, 0, 2, sec_status_secure);
+	unit_assert(rep);
+	rep->rrsets[0] = peer_test_rrset(region, nm, sizeof(nm),
+		LDNS_RR_TYPE_A, 2, 1);
+	rep->rrsets[1] = peer_test_rrset(region, nm+4, sizeof(nm)-4,
+		LDNS_RR_TYPE_NS, 1, 0);
+	((struct packed_rrset_data*)rep->rrsets[0]->entry.data)->trust =
+		rrset_trust_ultimate;
+
+	sldns_buffer_clear(buf);
+	unit_assert(cache_peer_encode(buf, &qinfo, rep, BIT_CD));
+	sldns_buffer_flip(buf);
+	len = sldns_buffer_limit(buf);
+	unit_show_func("services/cache/peer.c", "cache_peer_decode");
+	unit_assert(cache_peer_decode(buf, region2, &q2, &r2, &flags));
+	unit_assert(sldns_buffer_remaining(buf) == 0);
+	unit_assert(flags == BIT_CD);
+	unit_assert(q2.qtype == qinfo.qtype && q2.qclass == qinfo.qclass);
+	unit_assert(q2.qname_len == qinfo.qname_len &&
+		memcmp(q2.qname, qinfo.qname, qinfo.qname_len) == 0);
+	unit_assert(r2->flags == rep->flags && r2->ttl == rep->ttl &&
+		r2->prefetch_ttl == rep->prefetch_ttl &&
+		r2->security == sec_status_unchecked);
+	unit_assert(r2->an_numrrsets == 1 && r2->ns_numrrsets == 1 &&
+		r2->ar_numrrsets == 0 && r2->rrset_count == 2);
+	for(i=0; i<2; i++) {
+		size_t j;
+		unit_assert(r2->rrsets[i]->rk.type == rep->rrsets[i]->rk.type);
+		unit_assert(r2->rrsets[i]->rk.flags ==
+			rep->rrsets[i]->rk.flags);
+		unit_assert(query_dname_compare(r2->rrsets[i]->rk.dname,
+			rep->rrsets[i]->rk.dname) == 0);
+		unit_assert(r2->rrsets[i]->entry.hash ==
+			rrset_key_hash(&rep->rrsets[i]->rk));
+		d = (struct packed_rrset_data*)rep->rrsets[i]->entry.data;
+		d2 = (struct packed_rrset_data*)r2->rrsets[i]->entry.data;
+		/* the trust and security of the peer are not taken */
+		unit_assert(d2->trust == (d->trust > rrset_trust_ans_AA ?
+			rrset_trust_ans_AA : d->trust) &&
+			d2->security == sec_status_unchecked &&
+			d2->ttl == d->ttl);
+		unit_assert(d2->count == d->count &&
+			d2->rrsig_count == d->rrsig_count);
+		for(j=0; j<d->count+d->rrsig_count; j++) {
+			unit_assert(d2->rr_ttl[j] == d->rr_ttl[j]);
+			unit_assert(d2->rr_len[j] == d->rr_len[j]);
+			unit_assert(memcmp(d2->rr_data[j], d->rr_data[j],
+				d->rr_len[j]) == 0);
+		}
+	}
+
+	/* the TTLs are at most cache-max-ttl */
+	{
+		time_t old_max = MAX_TTL;
+		MAX_TTL = 100;
+		sldns_buffer_set_position(buf, 0);
+		unit_assert(cache_peer_decode(buf, region2, &q2, &r2, &flags));
+		MAX_TTL = old_max;
+		unit_assert(r2->ttl == 100 && r2->prefetch_ttl == 100);
+		for(i=0; i<2; i++) {
+			size_t j;
+			d2 = (struct packed_rrset_data*)r2->rrsets[i]->
+				entry.data;
+			unit_assert(d2->ttl == 100);
+			for(j=0; j<d2->count+d2->rrsig_count; j++)
+				unit_assert(d2->rr_ttl[j] <= 100);
+		}
+	}
+
+	/* truncated records are not decoded */
+	for(i=0; i<len; i++) {
+		sldns_buffer_set_position(buf, 0);
+		sldns_buffer_set_limit(buf, i);
+		unit_assert(!cache_peer_decode(buf, region2, &q2, &r2,
+			&flags));
+	}
+	/* an rdata length that does not match the record length */
+	sldns_buffer_set_limit(buf, len);
+	sldns_buffer_set_position(buf, 0);
+	sldns_buffer_write_u16_at(buf, len-6, 5);
+	unit_assert(!cache_peer_decode(buf, region2, &q2, &r2, &flags));
+	/* a record that does not fit is not encoded */
+	sldns_buffer_clear(buf);
+	sldns_buffer_set_limit(buf, len-1);
+	unit_assert(!cache_peer_encode(buf, &qinfo, rep, 0));
+
+	sldns_buffer_free(buf);
+	regional_destroy(region);
+	regional_destroy(region2);
+}
+
+#ifdef USE_CACHEDB
+#include "cachedb/cachedb.h"
+#include "services/cache/dns.h"
+#include "iterator/iter_utils.h"
+#include "util/data/msgencode.h"
+#include "util/data/msgparse.h"
+#include "validator/val_secalgo.h"
+/** check a decoded cachedb message, its TTLs are dt lower, and the
+ * security and trust are not taken from the backend */
+static void
+cachedb_test_cmp(struct query_info* qinfo, struct reply_info* rep,
+	struct dns_msg* msg, time_t dt)
+{
+	struct reply_info* r2;
+	struct packed_rrset_data* d, *d2;
+	size_t i, j;
+	unit_assert(msg && msg->rep);
+	r2 = msg->rep;
+	unit_assert(msg->qinfo.qtype == qinfo->qtype &&
+		msg->qinfo.qclass == qinfo->qclass);
+	unit_assert(msg->qinfo.qname_len == qinfo->qname_len &&
+		memcmp(msg->qinfo.qname, qinfo->qname, qinfo->qname_len) == 0);
+	unit_assert(r2->flags == rep->flags && r2->ttl == rep->ttl - dt &&
+		r2->prefetch_ttl == PREFETCH_TTL_CALC(r2->ttl) &&
+		r2->security == sec_status_unchecked);
+	unit_assert(r2->an_numrrsets == rep->an_numrrsets &&
+		r2->ns_numrrsets == rep->ns_numrrsets &&
+		r2->ar_numrrsets == rep->ar_numrrsets &&
+		r2->rrset_count == rep->rrset_count);
+	for(i=0; i<rep->rrset_count; i++) {
+		unit_assert(r2->rrsets[i]->rk.type == rep->rrsets[i]->rk.type);
+		unit_assert(r2->rrsets[i]->rk.rrset_class ==
+			rep->rrsets[i]->rk.rrset_class);
+		unit_assert(r2->rrsets[i]->rk.flags ==
+			rep->rrsets[i]->rk.flags);
+		unit_assert(query_dname_compare(r2->rrsets[i]->rk.dname,
+			rep->rrsets[i]->rk.dname) == 0);
+		unit_assert(r2->rrsets[i]->entry.hash ==
+			rrset_key_hash(&rep->rrsets[i]->rk));
+		d = (struct packed_rrset_data*)rep->rrsets[i]->entry.data;
+		d2 = (struct packed_rrset_data*)r2->rrsets[i]->entry.data;
+		unit_assert(d2->trust == (d->trust > rrset_trust_ans_AA ?
+			rrset_trust_ans_AA : d->trust) &&
+			d2->security == sec_status_unchecked &&
+			d2->ttl == d->ttl - dt);
+		unit_assert(d2->count == d->count &&
+			d2->rrsig_count == d->rrsig_count);
+		for(j=0; j<d->count+d->rrsig_count; j++) {
+			unit_assert(d2->rr_ttl[j] == d->rr_ttl[j] - dt);
+			unit_assert(d2->rr_len[j] == d->rr_len[j]);
+			unit_assert(memcmp(d2->rr_data[j], d->rr_data[j],
+				d->rr_len[j]) == 0);
+		}
+	}
+}
+
+/** msec since start */
+static double
+cachedb_test_msec(struct timeval* start)
+{
+	struct timeval end;
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return ((double)end.tv_sec - (double)start->tv_sec)*1000. +
+		((double)end.tv_usec - (double)start->tv_usec)/1000.;
+}
+
+/** the number of entries for the cachedb benchmark */
+#define CACHEDB_BENCH_NUM 100000
+
+/** time the encode and decode of an entry, and compare with the DNS
+ * wireformat that the values had before, and the key hash with the
+ * SHA256 hex string of before */
+static void
+cachedb_bench(struct cachedb_env* cenv, struct query_info* qinfo,
+	struct reply_info* rep, sldns_buffer* buf, struct regional* region)
+{
+	struct edns_data edns;
+	struct msg_parse* prs;
+	struct timeval start;
+	uint8_t key[CACHEDB_KEY_SIZE], hash[32];
+	char hex[65];
+	const char* hexdigits = "0123456789ABCDEF";
+	double compact, wire, keyt, sha;
+	size_t i, j, csize, wsize;
+	int c;
+
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<CACHEDB_BENCH_NUM; i++) {
+		regional_free_all(region);
+		unit_assert(cachedb_msg_encode(cenv, buf, qinfo, rep, 1000,
+			region));
+		unit_assert(cachedb_msg_decode(buf, 1000, region, region));
+	}
+	compact = cachedb_test_msec(&start);
+	csize = sldns_buffer_limit(buf);
+
+	memset(&edns, 0, sizeof(edns));
+	edns.edns_present = 1;
+	edns.bits = EDNS_DO;
+	edns.edns_version = EDNS_ADVERTISED_VERSION;
+	edns.udp_size = EDNS_ADVERTISED_SIZE;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<CACHEDB_BENCH_NUM; i++) {
+		regional_free_all(region);
+		unit_assert(reply_info_answer_encode(qinfo, rep, 0, 0, buf,
+			0, 1, region, 65535, &edns, 1, 0));
+		prs = (struct msg_parse*)regional_alloc_zero(region,
+			sizeof(*prs));
+		unit_assert(prs);
+		unit_assert(parse_packet(buf, prs, region) ==
+			LDNS_RCODE_NOERROR);
+		unit_assert(dns_alloc_msg(buf, prs, region));
+	}
+	wire = cachedb_test_msec(&start);
+	wsize = sldns_buffer_limit(buf) + 16;
+
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<CACHEDB_BENCH_NUM; i++)
+		cachedb_calc_key(cenv, qinfo, key);
+	keyt = cachedb_test_msec(&start);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<CACHEDB_BENCH_NUM; i++) {
+		uint8_t clear[LDNS_MAX_DOMAINLEN+4+8];
+		memmove(clear, qinfo->qname, qinfo->qname_len);
+		sldns_write_uint16(clear+qinfo->qname_len, qinfo->qtype);
+		sldns_write_uint16(clear+qinfo->qname_len+2, qinfo->qclass);
+		memmove(clear+qinfo->qname_len+4, "default", 7);
+		secalgo_hash_sha256(clear, qinfo->qname_len+11, hash);
+		for(j=0; j<sizeof(hash); j++) {
+			hex[j*2] = hexdigits[(hash[j]&0xf0)>>4];
+			hex[j*2+1] = hexdigits[hash[j]&0x0f];
+		}
+		hex[64] = 0;
+	}
+	sha = cachedb_test_msec(&start);
+	c = hex[0];
+	unit_assert(c != 0);
+
+	printf("cachedb %d entries: compact %d bytes encode+decode %g "
+		"usec/entry, wireformat %d bytes %g usec/entry\n",
+		CACHEDB_BENCH_NUM, (int)csize,
+		compact*1000./CACHEDB_BENCH_NUM, (int)wsize,
+		wire*1000./CACHEDB_BENCH_NUM);
+	printf("cachedb key: siphash %d bytes %g usec/key, "
+		"sha256 hex 64 bytes %g usec/key\n", CACHEDB_KEY_SIZE,
+		keyt*1000./CACHEDB_BENCH_NUM, sha*1000./CACHEDB_BENCH_NUM);
+}
+
+/** time the encode and decode of a large entry with compression */
+static void
+cachedb_bench_compress(struct cachedb_env* cenv, const char* method,
+	struct query_info* qinfo, struct reply_info* rep, sldns_buffer* buf,
+	struct regional* region)
+{
+	struct timeval start;
+	size_t i;
+	double t;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<CACHEDB_BENCH_NUM/10; i++) {
+		regional_free_all(region);
+		unit_assert(cachedb_msg_encode(cenv, buf, qinfo, rep, 1000,
+			region));
+		unit_assert(cachedb_msg_decode(buf, 1000, region, region));
+	}
+	t = cachedb_test_msec(&start);
+	printf("cachedb %s: %d bytes, body of %d bytes, encode+decode %g "
+		"usec/entry\n", method, (int)sldns_buffer_limit(buf),
+		(int)sldns_buffer_read_u32_at(buf, 10),
+		t*1000./(CACHEDB_BENCH_NUM/10));
+}
+
+/** test the compact key and value format of cachedb */
+static void
+cachedb_test(void)
+{
+	struct regional* region = regional_create();
+	struct regional* region2 = regional_create();
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	uint8_t nm[] = "\003www\007example\003com";
+	uint8_t upper[] = "\003WWW\007Example\003com";
+	uint8_t key[CACHEDB_KEY_SIZE], key2[CACHEDB_KEY_SIZE];
+	struct cachedb_env cenv;
+	struct query_info qinfo, q2;
+	struct reply_info* rep, *big;
+	size_t i, len;
+	unit_show_func("cachedb/cachedb.c", "cachedb_calc_key");
+	unit_assert(region && region2 && buf);
+	memset(&cenv, 0, sizeof(cenv));
+	cachedb_set_secret(&cenv, "default");
+	memset(&qinfo, 0, sizeof(qinfo));
+	qinfo.qname = nm;
+	qinfo.qname_len = sizeof(nm);
+	qinfo.qtype = LDNS_RR_TYPE_A;
+	qinfo.qclass = LDNS_RR_CLASS_IN;
+	cachedb_calc_key(&cenv, &qinfo, key);
+	unit_assert(key[0] == CACHEDB_FORMAT_VERSION);
+	/* the key is case insensitive */
+	q2 = qinfo;
+	q2.qname = upper;
+	cachedb_calc_key(&cenv, &q2, key2);
+	unit_assert(memcmp(key, key2, sizeof(key)) == 0);
+	q2.qtype = LDNS_RR_TYPE_AAAA;
+	cachedb_calc_key(&cenv, &q2, key2);
+	unit_assert(memcmp(key, key2, sizeof(key)) != 0);
+	cachedb_set_secret(&cenv, "other");
+	cachedb_calc_key(&cenv, &qinfo, key2);
+	unit_assert(memcmp(key, key2, sizeof(key)) != 0);
+
+	unit_show_func("cachedb/cachedb.c", "cachedb_msg_encode");
+	rep = construct_reply_info_base(region, BIT_QR|BIT_RD, 1, 3000,
+		PREFETCH_TTL_CALC(3000), 1, 2, 0, 3, sec_status_secure);
+	unit_assert(rep);
+	rep->rrsets[0] = peer_test_rrset(region, nm, sizeof(nm),
+		LDNS_RR_TYPE_A, 2, 1);
+	rep->rrsets[1] = peer_test_rrset(region, nm+4, sizeof(nm)-4,
+		LDNS_RR_TYPE_NS, 1, 0);
+	rep->rrsets[2] = peer_test_rrset(region, nm+4, sizeof(nm)-4,
+		LDNS_RR_TYPE_TXT, 1, 0);
+	rep->rrsets[2]->rk.rrset_class = htons(LDNS_RR_CLASS_CH);
+	rep->rrsets[2]->rk.flags = 0;
+	((struct packed_rrset_data*)rep->rrsets[0]->entry.data)->trust =
+		rrset_trust_validated;
+	((struct packed_rrset_data*)rep->rrsets[1]->entry.data)->trust =
+		rrset_trust_glue;
+	unit_assert(cachedb_msg_encode(&cenv, buf, &qinfo, rep, 1000,
+		region2));
+	len = sldns_buffer_limit(buf);
+	unit_assert(sldns_buffer_read_u8_at(buf, 0) == CACHEDB_FORMAT_VERSION);
+	unit_assert(sldns_buffer_read_u8_at(buf, 1) == CACHEDB_COMPRESS_NONE);
+	unit_assert(sldns_buffer_read_u32_at(buf, 6) == 4000);
+
+	unit_show_func("cachedb/cachedb.c", "cachedb_msg_decode");
+	cachedb_test_cmp(&qinfo, rep, cachedb_msg_decode(buf, 1000, region2,
+		region2), 0);
+	/* later on, the TTLs are lower */
+	sldns_buffer_set_position(buf, 0);
+	cachedb_test_cmp(&qinfo, rep, cachedb_msg_decode(buf, 1100, region2,
+		region2), 100);
+	/* expired */
+	sldns_buffer_set_position(buf, 0);
+	unit_assert(!cachedb_msg_decode(buf, 4000, region2, region2));
+	/* truncated values are not decoded */
+	for(i=0; i<len; i++) {
+		sldns_buffer_set_position(buf, 0);
+		sldns_buffer_set_limit(buf, i);
+		unit_assert(!cachedb_msg_decode(buf, 1000, region2, region2));
+	}
+	/* another format version */
+	sldns_buffer_set_limit(buf, len);
+	sldns_buffer_set_position(buf, 0);
+	sldns_buffer_write_u8_at(buf, 0, CACHEDB_FORMAT_VERSION+1);
+	unit_assert(!cachedb_msg_decode(buf, 1000, region2, region2));
+	/* a value that does not fit is not encoded */
+	sldns_buffer_set_capacity(buf, len-1);
+	unit_assert(!cachedb_msg_encode(&cenv, buf, &qinfo, rep, 1000,
+		region2));
+	sldns_buffer_set_capacity(buf, 65535);
+
+	/* a large answer is compressed */
+	big = construct_reply_info_base(region, BIT_QR|BIT_RD, 1, 3600,
+		PREFETCH_TTL_CALC(3600), 1, 0, 0, 1, sec_status_insecure);
+	unit_assert(big);
+	big->rrsets[0] = peer_test_rrset(region, nm, sizeof(nm),
+		LDNS_RR_TYPE_A, 200, 0);
+	cenv.compress_min = 512;
+#ifdef HAVE_LZ4
+	cenv.compress = CACHEDB_COMPRESS_LZ4;
+	unit_assert(cachedb_msg_encode(&cenv, buf, &qinfo, rep, 1000,
+		region2));
+	unit_assert(sldns_buffer_read_u8_at(buf, 1) == CACHEDB_COMPRESS_NONE);
+	unit_assert(cachedb_msg_encode(&cenv, buf, &qinfo, big, 1000,
+		region2));
+	unit_assert(sldns_buffer_read_u8_at(buf, 1) == CACHEDB_COMPRESS_LZ4);
+	cachedb_test_cmp(&qinfo, big, cachedb_msg_decode(buf, 1000, region2,
+		region2), 0);
+	if(unit_bench)
+		cachedb_bench_compress(&cenv, "lz4", &qinfo, big, buf,
+			region2);
+#endif
+#ifdef HAVE_ZSTD
+	cenv.compress = CACHEDB_COMPRESS_ZSTD;
+	unit_assert(cachedb_msg_encode(&cenv, buf, &qinfo, big, 1000,
+		region2));
+	unit_assert(sldns_buffer_read_u8_at(buf, 1) == CACHEDB_COMPRESS_ZSTD);
+	len = sldns_buffer_limit(buf);
+	cachedb_test_cmp(&qinfo, big, cachedb_msg_decode(buf, 1000, region2,
+		region2), 0);
+	/* a corrupted compressed body is not decoded */
+	sldns_buffer_set_position(buf, 0);
+	sldns_buffer_set_limit(buf, len-1);
+	unit_assert(!cachedb_msg_decode(buf, 1000, region2, region2));
+	if(unit_bench)
+		cachedb_bench_compress(&cenv, "zstd", &qinfo, big, buf,
+			region2);
+#endif
+	/* without compression support, a compressed value is not decoded */
+	cenv.compress = CACHEDB_COMPRESS_NONE;
+	if(unit_bench)
+		cachedb_bench_compress(&cenv, "uncompressed", &qinfo, big,
+			buf, region2);
+	unit_assert(cachedb_msg_encode(&cenv, buf, &qinfo, big, 1000,
+		region2));
+	sldns_buffer_write_u8_at(buf, 1, 3);
+	unit_assert(!cachedb_msg_decode(buf, 1000, region2, region2));
+
+	/* time an answer with a couple of addresses */
+	if(unit_bench) {
+		big->rrsets[0] = peer_test_rrset(region, nm, sizeof(nm),
+			LDNS_RR_TYPE_A, 4, 0);
+		cachedb_bench(&cenv, &qinfo, big, buf, region2);
+	}
+
+	sldns_buffer_free(buf);
+	regional_destroy(region);
+	regional_destroy(region2);
+}
+#endif /* USE_CACHEDB */
+
+#include "util/xdp.h"
+/** ones complement sum for the checksum checks */
+static uint32_t
+xdp_test_sum(uint8_t* p, size_t len)
+{
+	uint32_t sum = 0;
+	size_t i;
+	for(i=0; i+1<len; i+=2)
+		sum += (uint32_t)((p[i]<<8) | p[i+1]);
+	if(len&1)
+		sum += (uint32_t)p[len-1]<<8;
+	return sum;
+}
+
+/** fold the sum, returns 0 if the checksum is correct */
+static uint16_t
+xdp_test_fold(uint32_t sum)
+{
+	while(sum>>16)
+		sum = (sum&0xffff) + (sum>>16);
+	return (uint16_t)~sum;
+}
+
+/** make a query frame, with the ethernet, IP and UDP headers */
+static size_t
+xdp_test_query(uint8_t* f, int ip6, uint8_t* dns, size_t len)
+{
+	size_t hl = (ip6?62:42);
+	memset(f, 0, hl);
+	memset(f, 0xaa, 6); /* destination, the server */
+	memset(f+6, 0xbb, 6); /* source, the client */
+	if(ip6) {
+		f[12] = 0x86; f[13] = 0xdd;
+		f[14] = 0x60;
+		f[18] = (uint8_t)((len+8)>>8); f[19] = (uint8_t)(len+8);
+		f[20] = IPPROTO_UDP; f[21] = 64;
+		f[22] = 0x20; f[23] = 0x01; f[37] = 2; /* 2001::2 */
+		f[38] = 0x20; f[39] = 0x01; f[53] = 1; /* 2001::1 */
+	} else {
+		f[12] = 0x08; f[13] = 0x00;
+		f[14] = 0x45;
+		f[16] = (uint8_t)((len+28)>>8); f[17] = (uint8_t)(len+28);
+		f[22] = 64; f[23] = IPPROTO_UDP;
+		f[26] = 10; f[27] = 0; f[28] = 0; f[29] = 2; /* 10.0.0.2 */
+		f[30] = 10; f[31] = 0; f[32] = 0; f[33] = 1; /* 10.0.0.1 */
+	}
+	f[hl-8] = 0x30; f[hl-7] = 0x39; /* port 12345 */
+	f[hl-6] = 0; f[hl-5] = 53;
+	f[hl-4] = (uint8_t)((len+8)>>8); f[hl-3] = (uint8_t)(len+8);
+	memmove(f+hl, dns, len);
+	return hl+len;
+}
+
+/** test the parse and build of the AF_XDP frames */
+static void
+xdp_test(void)
+{
+	uint8_t dns[] = { 0x12, 0x34, 0x01, 0x00, 0, 1, 0, 0, 0, 0, 0, 0,
+		3, 'w', 'w', 'w', 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e',
+		3, 'c', 'o', 'm', 0, 0, 1, 0, 1 };
+	uint8_t f[XDP_FRAME_SIZE];
+	struct xdp_pkt pkt;
+	size_t len, hl, udplen, i;
+	uint32_t sum;
+	int ip6;
+	unit_show_func("util/xdp.c", "xdp_parse_pkt");
+	for(ip6=0; ip6<2; ip6++) {
+		len = xdp_test_query(f, ip6, dns, sizeof(dns));
+		hl = xdp_hdr_len(ip6?AF_INET6:AF_INET);
+		unit_assert(!xdp_parse_pkt(f, len, 5353, &pkt));
+		for(i=0; i<len; i++)
+			unit_assert(!xdp_parse_pkt(f, i, 53, &pkt));
+		unit_assert(xdp_parse_pkt(f, len, 53, &pkt));
+		unit_assert(pkt.len == sizeof(dns) && pkt.payload == f+hl);
+		unit_assert(pkt.client.ss_family == (ip6?AF_INET6:AF_INET));
+		if(ip6) {
+			struct sockaddr_in6* sa = (struct sockaddr_in6*)
+				&pkt.client;
+			unit_assert(ntohs(sa->sin6_port) == 12345);
+			unit_assert(((uint8_t*)&sa->sin6_addr)[15] == 2);
+			unit_assert(pkt.local[0] == 0x20 && pkt.local[15] == 1);
+		} else {
+			struct sockaddr_in* sa = (struct sockaddr_in*)
+				&pkt.client;
+			unit_assert(ntohs(sa->sin_port) == 12345);
+			unit_assert(ntohl(sa->sin_addr.s_addr) == 0x0a000002);
+			unit_assert(pkt.local[0] == 10 && pkt.local[3] == 1);
+		}
+
+		/* the reply, in place, with the addresses reversed */
+		unit_show_func("util/xdp.c", "xdp_build_reply");
+		f[hl+2] |= 0x80; /* QR */
+		len = xdp_build_reply(f, sizeof(f), 1500, &pkt, 53,
+			sizeof(dns));
+		unit_assert(len == hl + sizeof(dns));
+		unit_assert(f[0] == 0xbb && f[5] == 0xbb && f[6] == 0xaa);
+		unit_assert(f[hl-8] == 0 && f[hl-7] == 53);
+		unit_assert(f[hl-6] == 0x30 && f[hl-5] == 0x39);
+		udplen = sizeof(dns)+8;
+		if(ip6) {
+			unit_assert(f[22] == 0x20 && f[37] == 1);
+			unit_assert(f[39] == 0x01 && f[53] == 2);
+			sum = xdp_test_sum(f+22, 32);
+		} else {
+			unit_assert(f[29] == 1 && f[33] == 2);
+			unit_assert(xdp_test_fold(xdp_test_sum(f+14, 20)) == 0);
+			sum = xdp_test_sum(f+26, 8);
+		}
+		sum += IPPROTO_UDP + (uint32_t)udplen;
+		sum += xdp_test_sum(f+hl-8, udplen);
+		unit_assert(xdp_test_fold(sum) == 0);
+		unit_assert(memcmp(f+hl+3, dns+3, sizeof(dns)-3) == 0);
+
+		/* a reply larger than the MTU is truncated to the
+		 * question, with the TC flag */
+		memset(f+hl+sizeof(dns), 0, 1000);
+		f[hl+7] = 5; /* ancount */
+		len = xdp_build_reply(f, sizeof(f), 576, &pkt, 53,
+			sizeof(dns)+1000);
+		unit_assert(len == hl + sizeof(dns));
+		unit_assert((f[hl+2]&0x02) && f[hl+5] == 1 && f[hl+7] == 0);
+		/* the reply does not fit in the frame room */
+		unit_assert(xdp_build_reply(f, hl+4, 1500, &pkt, 53,
+			sizeof(dns)) == 0);
+	}
+}
+
+#include "services/cache/intern.h"
+#include "services/cache/rrset.h"
+/** test the interned owner names of the rrset cache */
+static void
+name_intern_test(void)
+{
+	struct regional* region = regional_create();
+	struct config_file* cfg = config_create();
+	struct alloc_cache super_a, alloc;
+	struct name_intern* t;
+	struct rrset_cache* r;
+	struct rrset_ref ref;
+	struct ub_packed_rrset_key* a, *aaaa;
+	uint8_t nm[] = "\003www\007example\003com";
+	uint8_t nm2[] = "\003www\007example\003com";
+	uint8_t up[] = "\003WWW\007example\003com";
+	uint8_t* p1, *p2, *p3;
+	size_t count, refs, saved;
+
+	unit_show_func("services/cache/intern.c", "name_intern_get");
+	unit_assert(region && cfg);
+	t = name_intern_create(4);
+	unit_assert(t);
+	p1 = name_intern_get(t, nm, sizeof(nm));
+	p2 = name_intern_get(t, nm2, sizeof(nm2));
+	p3 = name_intern_get(t, up, sizeof(up));
+	unit_assert(p1 && p2 && p3);
+	unit_assert(p1 == p2 && p1 != nm && p1 != p3);
+	unit_assert(memcmp(p1, nm, sizeof(nm)) == 0);
+	unit_assert(memcmp(p3, up, sizeof(up)) == 0);
+	name_intern_get_stats(t, &count, &refs, &saved);
+	unit_assert(count == 2 && refs == 3 && saved == sizeof(nm));
+	unit_assert(name_intern_get_mem(t) > 2*sizeof(nm));
+	unit_show_func("services/cache/intern.c", "name_intern_release");
+	name_intern_release(p2);
+	name_intern_release(p3);
+	name_intern_get_stats(t, &count, &refs, &saved);
+	unit_assert(count == 1 && refs == 1 && saved == 0);
+	/* the table grows its buckets, the names stay put */
+	for(count=0; count<1000; count++) {
+		sldns_write_uint16(nm2+1, (uint16_t)count);
+		unit_assert(name_intern_get(t, nm2, sizeof(nm2)));
+	}
+	unit_assert(name_intern_get(t, nm, sizeof(nm)) == p1);
+	name_intern_get_stats(t, &count, &refs, &saved);
+	unit_assert(count == 1001 && refs == 1002 && saved == sizeof(nm));
+	name_intern_delete(t);
+
+	unit_show_func("services/cache/rrset.c", "rrset_cache_update");
+	alloc_init(&super_a, NULL, 0);
+	alloc_init(&alloc, &super_a, 1);
+	r = rrset_cache_create(cfg, &alloc);
+	unit_assert(r);
+	a = peer_test_rrset(region, nm, sizeof(nm), LDNS_RR_TYPE_A, 1, 0);
+	aaaa = peer_test_rrset(region, nm, sizeof(nm), LDNS_RR_TYPE_AAAA,
+		1, 0);
+	a->entry.hash = rrset_key_hash(&a->rk);
+	aaaa->entry.hash = rrset_key_hash(&aaaa->rk);
+	ref.key = packed_rrset_copy_alloc(a, &alloc, 0);
+	unit_assert(ref.key);
+	ref.id = ref.key->id;
+	unit_assert(rrset_cache_update(r, &ref, &alloc, 0) == 0);
+	p1 = ref.key->rk.dname;
+	ref.key = packed_rrset_copy_alloc(aaaa, &alloc, 0);
+	unit_assert(ref.key);
+	ref.id = ref.key->id;
+	unit_assert(rrset_cache_update(r, &ref, &alloc, 0) == 0);
+	unit_assert(ref.key->rk.dname == p1);
+	name_intern_get_stats(r->names, &count, &refs, &saved);
+	unit_assert(count == 1 && refs == 2 && saved == sizeof(nm));
+	/* an update of a cached rrset keeps the one reference */
+	ref.key = packed_rrset_copy_alloc(a, &alloc, 0);
+	unit_assert(ref.key);
+	ref.id = ref.key->id;
+	unit_assert(rrset_cache_update(r, &ref, &alloc, 0) != 0);
+	unit_assert(ref.key->rk.dname == p1);
+	name_intern_get_stats(r->names, &count, &refs, &saved);
+	unit_assert(count == 1 && refs == 2 && saved == sizeof(nm));
+	rrset_cache_remove(r, nm, sizeof(nm), LDNS_RR_TYPE_A,
+		LDNS_RR_CLASS_IN, PACKED_RRSET_NSEC_AT_APEX);
+	name_intern_get_stats(r->names, &count, &refs, &saved);
+	unit_assert(count == 1 && refs == 1 && saved == 0);
+	rrset_cache_delete(r);
+
+	alloc_clear(&alloc);
+	alloc_clear(&super_a);
+	config_delete(cfg);
+	regional_destroy(region);
+}
+
 void unit_show_func(const char* file, const char* func)
 {
 	printf("test %s:%s\n", file, func);
@@ -842,9 +2257,12 @@ int
 main(int argc, char* argv[])
 {
 	log_init(NULL, 0, NULL);
-	if(argc != 1) {
-		printf("usage: %s\n", argv[0]);
+	if(argc == 2 && strcmp(argv[1], "-b") == 0) {
+		unit_bench = 1;
+	} else if(argc != 1) {
+		printf("usage: %s [-b]\n", argv[0]);
 		printf("\tperforms unit tests.\n");
+		printf("\t-b also runs the benchmarks, and prints the times.\n");
 		return 1;
 	}
 	printf("Start of %s unit test.\n", PACKAGE_STRING);
@@ -871,6 +2289,12 @@ main(int argc, char* argv[])
 	config_memsize_test();
 	config_tag_test();
 	dname_test();
+	name_index_test();
+	if(unit_bench) {
+		name_index_bench(10);
+		name_index_bench(1000);
+		name_index_bench(1000000);
+	}
 	rtt_test();
 	anchors_test();
 	alloc_test();
@@ -878,8 +2302,18 @@ main(int argc, char* argv[])
 	lruhash_test();
 	slabhash_test();
 	infra_test();
+	infra_batch_test();
+	infra_health_test();
 	ldns_test();
 	msgparse_test();
+	edns_keepalive_test();
+	edns_cookie_test();
+	cache_peer_test();
+	xdp_test();
+	name_intern_test();
+#ifdef USE_CACHEDB
+	cachedb_test();
+#endif
 #ifdef CLIENT_SUBNET
 	ecs_test();
 #endif /* CLIENT_SUBNET */
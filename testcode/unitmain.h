@@ -44,6 +44,8 @@
 
 /** number of tests done */
 extern int testcount;
+/** if the benchmarks run too, with unittest -b */
+extern int unit_bench;
 /** test bool x, exits on failure, increases testcount. */
 #ifdef DEBUG_UNBOUND
 #define unit_assert(x) do {testcount++; log_assert(x);} while(0)
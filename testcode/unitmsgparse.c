@@ -495,6 +495,174 @@ testfromdrillfile(sldns_buffer* pkt, struct alloc_cache* alloc,
 	fclose(in);
 }
 
+/** make a random query packet, that passes the worker header checks */
+static void
+make_rnd_query(sldns_buffer* pkt)
+{
+	size_t i, n, len = 0;
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, (uint16_t)random()); /* id */
+	sldns_buffer_write_u16(pkt, (uint16_t)(random()&0x0110)); /* RD, CD */
+	sldns_buffer_write_u16(pkt, 1); /* qdcount */
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, (uint16_t)(random()%2)); /* arcount */
+	/* qname of random labels, mixed case */
+	n = (size_t)random()%6;
+	for(i=0; i<n; i++) {
+		size_t j, lablen = 1 + (size_t)random()%20;
+		if(len + lablen + 1 > LDNS_MAX_DOMAINLEN - 1)
+			break;
+		sldns_buffer_write_u8(pkt, (uint8_t)lablen);
+		for(j=0; j<lablen; j++)
+			sldns_buffer_write_u8(pkt, (uint8_t)("aBcDeFgH-0"
+				[random()%10]));
+		len += lablen + 1;
+	}
+	sldns_buffer_write_u8(pkt, 0);
+	sldns_buffer_write_u16(pkt, (uint16_t)(random()%2?
+		LDNS_RR_TYPE_A:LDNS_RR_TYPE_AAAA));
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	if(LDNS_ARCOUNT(sldns_buffer_begin(pkt))) {
+		size_t rdlenpos;
+		sldns_buffer_write_u8(pkt, 0);
+		sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_OPT);
+		sldns_buffer_write_u16(pkt, 4096);
+		sldns_buffer_write_u32(pkt, (uint32_t)(random()%2?0x8000:0));
+		rdlenpos = sldns_buffer_position(pkt);
+		sldns_buffer_write_u16(pkt, 0);
+		n = (size_t)random()%12; /* beyond the fixed store */
+		for(i=0; i<n; i++) {
+			size_t j, optlen = (size_t)random()%64;
+			sldns_buffer_write_u16(pkt, (uint16_t)(random()%16));
+			sldns_buffer_write_u16(pkt, (uint16_t)optlen);
+			for(j=0; j<optlen; j++)
+				sldns_buffer_write_u8(pkt, (uint8_t)random());
+		}
+		sldns_buffer_write_u16_at(pkt, rdlenpos, (uint16_t)(
+			sldns_buffer_position(pkt) - rdlenpos - 2));
+	}
+	sldns_buffer_flip(pkt);
+	/* damage it a little, but keep the header counts */
+	if(random()%2 && sldns_buffer_limit(pkt) > LDNS_HEADER_SIZE) {
+		size_t pos = LDNS_HEADER_SIZE + (size_t)random()%
+			(sldns_buffer_limit(pkt)-LDNS_HEADER_SIZE);
+		if(random()%2)
+			sldns_buffer_write_u8_at(pkt, pos, (uint8_t)random());
+		else	sldns_buffer_set_limit(pkt, pos);
+	}
+}
+
+/** compare edns results */
+static void
+edns_compare(struct edns_data* a, struct edns_data* b)
+{
+	struct edns_option* x = a->opt_list, *y = b->opt_list;
+	unit_assert(a->edns_present == b->edns_present);
+	unit_assert(a->ext_rcode == b->ext_rcode);
+	unit_assert(a->edns_version == b->edns_version);
+	unit_assert(a->bits == b->bits);
+	unit_assert(a->udp_size == b->udp_size);
+	while(x && y) {
+		unit_assert(x->opt_code == y->opt_code);
+		unit_assert(x->opt_len == y->opt_len);
+		unit_assert(x->opt_len == 0 ||
+			memcmp(x->opt_data, y->opt_data, x->opt_len) == 0);
+		x = x->next;
+		y = y->next;
+	}
+	unit_assert(x == NULL && y == NULL);
+}
+
+/** check the single pass query parse against the separate routines */
+static void
+query_parse_fuzz_test(sldns_buffer* pkt)
+{
+	struct regional* region = regional_create();
+	struct edns_opt_store store;
+	struct query_info q1, q2;
+	struct edns_data e1, e2;
+	hashvalue_type qh;
+	int i, r1, r2, rc1 = 0, rc2 = 0;
+	srandom(4848);
+	for(i=0; i<20000; i++) {
+		make_rnd_query(pkt);
+		r1 = query_info_parse(&q1, pkt);
+		if(r1)
+			rc1 = parse_edns_from_pkt(pkt, &e1, region);
+		sldns_buffer_rewind(pkt);
+		r2 = query_info_parse_edns(&q2, pkt, &e2, &rc2, &store,
+			region, &qh);
+		unit_assert(r1 == r2);
+		if(!r1) {
+			regional_free_all(region);
+			continue;
+		}
+		unit_assert(q1.qname == q2.qname);
+		unit_assert(q1.qname_len == q2.qname_len);
+		unit_assert(q1.qtype == q2.qtype);
+		unit_assert(q1.qclass == q2.qclass);
+		unit_assert(query_info_hash(&q1, 0) ==
+			query_info_hash_qname(&q2, 0, qh));
+		unit_assert(query_info_hash(&q1, BIT_CD) ==
+			query_info_hash_qname(&q2, BIT_CD, qh));
+		unit_assert(rc1 == rc2);
+		if(rc1 == 0)
+			edns_compare(&e1, &e2);
+		regional_free_all(region);
+	}
+	regional_destroy(region);
+}
+
+/** performance test query parse, separate routines and single pass */
+static void
+perf_queryparse(sldns_buffer* pkt)
+{
+	struct regional* region = regional_create();
+	struct edns_opt_store store;
+	struct query_info qinfo;
+	struct edns_data edns;
+	hashvalue_type h, qh;
+	size_t i, max = 100000;
+	struct timeval start, end;
+	double dt1, dt2;
+	int rc;
+	/* www.example.com. AAAA with EDNS, DO bit and a cookie option */
+	hex_to_buf(pkt, "c5400100000100000000000103777777076578616d706c6503636f6d0000"
+		"1c0001 0000291000000080000000 000c 000a00080102030405060708");
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<max; i++) {
+		sldns_buffer_rewind(pkt);
+		unit_assert(query_info_parse(&qinfo, pkt));
+		rc = parse_edns_from_pkt(pkt, &edns, region);
+		unit_assert(rc == 0);
+		h = query_info_hash(&qinfo, 0);
+		regional_free_all(region);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt1 = (double)(end.tv_sec - start.tv_sec)*1000. + 
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<max; i++) {
+		sldns_buffer_rewind(pkt);
+		unit_assert(query_info_parse_edns(&qinfo, pkt, &edns, &rc,
+			&store, region, &qh));
+		unit_assert(rc == 0);
+		unit_assert(query_info_hash_qname(&qinfo, 0, qh) == h);
+		regional_free_all(region);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt2 = (double)(end.tv_sec - start.tv_sec)*1000. + 
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	printf("query parse: did %u separate in %g msec, single pass in "
+		"%g msec\n", (unsigned)max, dt1, dt2);
+	regional_destroy(region);
+}
+
 void msgparse_test(void)
 {
 	time_t origttl = MAX_NEG_TTL;
@@ -533,6 +701,10 @@ void msgparse_test(void)
 	check_nosameness = 0;
 	check_rrsigs = 0;
 
+	query_parse_fuzz_test(pkt);
+	if(unit_bench)
+		perf_queryparse(pkt);
+
 	/* cleanup */
 	alloc_clear(&alloc);
 	alloc_clear(&super_a);
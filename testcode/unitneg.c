@@ -51,23 +51,23 @@
 static int negverbose = 0;
 
 /** debug printout of neg cache */
-static void print_neg_cache(struct val_neg_cache* neg)
+static void print_neg_cache(struct val_neg_shard* sh)
 {
 	char buf[1024];
 	struct val_neg_zone* z;
 	struct val_neg_data* d;
 	printf("neg_cache print\n");
-	printf("memuse %d of %d\n", (int)neg->use, (int)neg->max);
-	printf("maxiter %d\n", (int)neg->nsec3_max_iter);
-	printf("%d zones\n", (int)neg->tree.count);
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
+	printf("memuse %d of %d\n", (int)sh->use, (int)sh->neg->max);
+	printf("maxiter %d\n", (int)sh->neg->nsec3_max_iter);
+	printf("%d zones\n", (int)sh->tree.count);
+	RBTREE_FOR(z, struct val_neg_zone*, &sh->tree) {
 		dname_str(z->name, buf);
 		printf("%24s", buf);
 		printf(" len=%2.2d labs=%d inuse=%d count=%d tree.count=%d\n",
 			(int)z->len, z->labs, (int)z->in_use, z->count,
 			(int)z->tree.count);
 	}
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
+	RBTREE_FOR(z, struct val_neg_zone*, &sh->tree) {
 		printf("\n");
 		dname_print(stdout, NULL, z->name);
 		printf(" zone details\n");
@@ -190,7 +190,7 @@ static void get_random_data(char** fromp, char** top, char* zname)
 }
 
 /** add a random item */
-static void add_item(struct val_neg_cache* neg)
+static void add_item(struct val_neg_shard* sh)
 {
 	struct val_neg_zone* z;
 	struct packed_rrset_data rd;
@@ -201,13 +201,13 @@ static void add_item(struct val_neg_cache* neg)
 	char* zname = get_random_zone();
 	char* from, *to;
 
-	lock_basic_lock(&neg->lock);
+	lock_basic_lock(&sh->lock);
 	if(negverbose)
 		log_nametypeclass(0, "add to zone", (uint8_t*)zname, 0, 0);
-	z = neg_find_zone(neg, (uint8_t*)zname, strlen(zname)+1, 
+	z = neg_find_zone(sh, (uint8_t*)zname, strlen(zname)+1, 
 		LDNS_RR_CLASS_IN);
 	if(!z) {
-		z = neg_create_zone(neg,  (uint8_t*)zname, strlen(zname)+1,
+		z = neg_create_zone(sh,  (uint8_t*)zname, strlen(zname)+1,
 		                LDNS_RR_CLASS_IN);
 	}
 	unit_assert(z);
@@ -233,32 +233,32 @@ static void add_item(struct val_neg_cache* neg)
 	rd.rr_data = &rr_data;
 	rr_data = (uint8_t*)to;
 
-	neg_insert_data(neg, z, &nsec);
-	lock_basic_unlock(&neg->lock);
+	neg_insert_data(sh, z, &nsec);
+	lock_basic_unlock(&sh->lock);
 }
 
 /** remove a random item */
-static void remove_item(struct val_neg_cache* neg)
+static void remove_item(struct val_neg_shard* sh)
 {
 	int n, i;
 	struct val_neg_data* d;
 	rbnode_type* walk;
 	struct val_neg_zone* z;
 	
-	lock_basic_lock(&neg->lock);
-	if(neg->tree.count == 0) {
-		lock_basic_unlock(&neg->lock);
+	lock_basic_lock(&sh->lock);
+	if(sh->tree.count == 0) {
+		lock_basic_unlock(&sh->lock);
 		return; /* nothing to delete */
 	}
 
 	/* pick a random zone */
-	walk = rbtree_first(&neg->tree); /* first highest parent, big count */
+	walk = rbtree_first(&sh->tree); /* first highest parent, big count */
 	z = (struct val_neg_zone*)walk;
 	n = random() % (int)(z->count);
 	if(negverbose)
 		printf("neg stress delete zone %d\n", n);
 	i=0;
-	walk = rbtree_first(&neg->tree);
+	walk = rbtree_first(&sh->tree);
 	z = (struct val_neg_zone*)walk;
 	while(i!=n+1 && walk && walk != RBTREE_NULL && !z->in_use) {
 		walk = rbtree_next(walk);
@@ -267,11 +267,11 @@ static void remove_item(struct val_neg_cache* neg)
 			i++;
 	}
 	if(!walk || walk == RBTREE_NULL) {
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&sh->lock);
 		return;
 	}
 	if(!z->in_use) {
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&sh->lock);
 		return;
 	}
 	if(negverbose)
@@ -293,35 +293,35 @@ static void remove_item(struct val_neg_cache* neg)
 			i++;
 	}
 	if(!walk || walk == RBTREE_NULL) {
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&sh->lock);
 		return;
 	}
 	if(d->in_use) {
 		if(negverbose)
 			log_nametypeclass(0, "neg delete item:", d->name, 0, 0);
-		neg_delete_data(neg, d);
+		neg_delete_data(sh, d);
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_basic_unlock(&sh->lock);
 }
 
 /** sum up the zone trees */
-static size_t sumtrees_all(struct val_neg_cache* neg)
+static size_t sumtrees_all(struct val_neg_shard* sh)
 {
 	size_t res = 0;
 	struct val_neg_zone* z;
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
+	RBTREE_FOR(z, struct val_neg_zone*, &sh->tree) {
 		res += z->tree.count;
 	}
 	return res;
 }
 
 /** sum up the zone trees, in_use only */
-static size_t sumtrees_inuse(struct val_neg_cache* neg)
+static size_t sumtrees_inuse(struct val_neg_shard* sh)
 {
 	size_t res = 0;
 	struct val_neg_zone* z;
 	struct val_neg_data* d;
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
+	RBTREE_FOR(z, struct val_neg_zone*, &sh->tree) {
 		/* get count of highest parent for num in use */
 		d = (struct val_neg_data*)rbtree_first(&z->tree);
 		if(d && (rbnode_type*)d!=RBTREE_NULL)
@@ -331,32 +331,32 @@ static size_t sumtrees_inuse(struct val_neg_cache* neg)
 }
 
 /** check if lru is still valid */
-static void check_lru(struct val_neg_cache* neg)
+static void check_lru(struct val_neg_shard* sh)
 {
 	struct val_neg_data* p, *np;
 	size_t num = 0;
 	size_t inuse;
-	p = neg->first;
+	p = sh->first;
 	while(p) {
 		if(!p->prev) {
-			unit_assert(neg->first == p);
+			unit_assert(sh->first == p);
 		}
 		np = p->next;
 		if(np) {
 			unit_assert(np->prev == p);
 		} else {
-			unit_assert(neg->last == p);
+			unit_assert(sh->last == p);
 		}
 		num++;
 		p = np;
 	}
-	inuse = sumtrees_inuse(neg);
+	inuse = sumtrees_inuse(sh);
 	if(negverbose)
 		printf("num lru %d, inuse %d, all %d\n",
-			(int)num, (int)sumtrees_inuse(neg), 
-			(int)sumtrees_all(neg));
+			(int)num, (int)sumtrees_inuse(sh), 
+			(int)sumtrees_all(sh));
 	unit_assert( num == inuse);
-	unit_assert( inuse <= sumtrees_all(neg));
+	unit_assert( inuse <= sumtrees_all(sh));
 }
 
 /** sum up number of items inuse in subtree */
@@ -375,12 +375,12 @@ static int sum_subtree_inuse(struct val_neg_zone* zone,
 }
 
 /** sum up number of items inuse in subtree */
-static int sum_zone_subtree_inuse(struct val_neg_cache* neg,
+static int sum_zone_subtree_inuse(struct val_neg_shard* sh,
 	struct val_neg_zone* zone)
 {
 	struct val_neg_zone* z;
 	int num = 0;
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
+	RBTREE_FOR(z, struct val_neg_zone*, &sh->tree) {
 		if(dname_subdomain_c(z->name, zone->name)) {
 			if(z->in_use)
 				num++;
@@ -423,7 +423,7 @@ static void checkzonetree(struct val_neg_zone* zone)
 }
 
 /** check if negative cache is still valid */
-static void check_zone_invariants(struct val_neg_cache* neg, 
+static void check_zone_invariants(struct val_neg_shard* sh, 
 	struct val_neg_zone* zone)
 {
 	unit_assert(zone->nsec3_hash == 0);
@@ -440,7 +440,7 @@ static void check_zone_invariants(struct val_neg_cache* neg,
 				zone->in_use, zone->count, 
 				(int)zone->tree.count);
 			if(negverbose)
-				print_neg_cache(neg);
+				print_neg_cache(sh);
 		}
 		unit_assert(zone->in_use);
 	}
@@ -460,84 +460,117 @@ static void check_zone_invariants(struct val_neg_cache* neg,
 		unit_assert(dname_is_root(zone->name));
 	}
 	/* tree property: */
-	unit_assert(zone->count == sum_zone_subtree_inuse(neg, zone));
+	unit_assert(zone->count == sum_zone_subtree_inuse(sh, zone));
 
 	/* check structure of zone data tree */
 	checkzonetree(zone);
 }
 
 /** check if negative cache is still valid */
-static void check_neg_invariants(struct val_neg_cache* neg)
+static void check_neg_invariants(struct val_neg_shard* sh)
 {
 	struct val_neg_zone* z;
 	/* check structure of LRU list */
-	lock_basic_lock(&neg->lock);
-	check_lru(neg);
-	unit_assert(neg->max == 1024*1024);
-	unit_assert(neg->nsec3_max_iter == 1500);
-	unit_assert(neg->tree.cmp == &val_neg_zone_compare);
+	lock_basic_lock(&sh->lock);
+	check_lru(sh);
+	unit_assert(sh->neg->max == 1024*1024);
+	unit_assert(sh->neg->nsec3_max_iter == 1500);
+	unit_assert(sh->tree.cmp == &val_neg_zone_compare);
 
-	if(neg->tree.count == 0) {
+	if(sh->tree.count == 0) {
 		/* empty */
-		unit_assert(neg->tree.count == 0);
-		unit_assert(neg->first == NULL);
-		unit_assert(neg->last == NULL);
-		unit_assert(neg->use == 0);
-		lock_basic_unlock(&neg->lock);
+		unit_assert(sh->tree.count == 0);
+		unit_assert(sh->first == NULL);
+		unit_assert(sh->last == NULL);
+		unit_assert(sh->use == 0);
+		lock_basic_unlock(&sh->lock);
 		return;
 	}
 
-	unit_assert(neg->first != NULL);
-	unit_assert(neg->last != NULL);
+	unit_assert(sh->first != NULL);
+	unit_assert(sh->last != NULL);
 
-	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
-		check_zone_invariants(neg, z);
+	RBTREE_FOR(z, struct val_neg_zone*, &sh->tree) {
+		check_zone_invariants(sh, z);
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_basic_unlock(&sh->lock);
 }
 
 /** perform stress test on insert and delete in neg cache */
-static void stress_test(struct val_neg_cache* neg)
+static void stress_test(struct val_neg_shard* sh)
 {
 	int i;
 	if(negverbose)
 		printf("negcache test\n");
 	for(i=0; i<100; i++) {
 		if(random() % 10 < 8)
-			add_item(neg);
-		else	remove_item(neg);
-		check_neg_invariants(neg);
+			add_item(sh);
+		else	remove_item(sh);
+		check_neg_invariants(sh);
 	}
 	/* empty it */
 	if(negverbose)
 		printf("neg stress empty\n");
-	while(neg->first) {
-		remove_item(neg);
-		check_neg_invariants(neg);
+	while(sh->first) {
+		remove_item(sh);
+		check_neg_invariants(sh);
 	}
 	if(negverbose)
 		printf("neg stress emptied\n");
-	unit_assert(neg->first == NULL);
+	unit_assert(sh->first == NULL);
 	/* insert again */
 	for(i=0; i<100; i++) {
 		if(random() % 10 < 8)
-			add_item(neg);
-		else	remove_item(neg);
-		check_neg_invariants(neg);
+			add_item(sh);
+		else	remove_item(sh);
+		check_neg_invariants(sh);
 	}
 }
 
+/** test that the zones are in the shard of their top label */
+static void neg_shard_test(struct val_neg_cache* neg)
+{
+	struct val_neg_shard* sh = neg_shard_get(neg, (uint8_t*)"\003com");
+	uint8_t root = 0;
+	char nm[16];
+	int i, j, num = 0;
+	int used[NEG_CACHE_SHARDS];
+	unit_assert(neg_shard_get(neg, (uint8_t*)"\007example\003com") == sh);
+	unit_assert(neg_shard_get(neg, (uint8_t*)"\003www\007EXAMPLE\003cOm")
+		== sh);
+	sh = neg_shard_get(neg, &root);
+	unit_assert(sh >= neg->shards && sh < neg->shards+NEG_CACHE_SHARDS);
+	/* the top labels are spread over the shards */
+	memset(used, 0, sizeof(used));
+	for(i=0; i<200; i++) {
+		snprintf(nm+1, sizeof(nm)-1, "t%d", i);
+		nm[0] = (char)strlen(nm+1);
+		j = (int)(neg_shard_get(neg, (uint8_t*)nm) - neg->shards);
+		if(!used[j]++)
+			num++;
+	}
+	unit_assert(num > NEG_CACHE_SHARDS/2);
+}
+
 void neg_test(void)
 {
 	struct val_neg_cache* neg;
+	struct val_neg_shard* sh;
+	int i;
 	srandom(48);
 	unit_show_feature("negative cache");
 
 	/* create with defaults */
 	neg = val_neg_create(NULL, 1500);
 	unit_assert(neg);
-	
-	stress_test(neg);
+	neg_shard_test(neg);
+
+	/* the random zones are all below example.com */
+	sh = neg_shard_get(neg, (uint8_t*)"\007example\003com");
+	stress_test(sh);
+	for(i=0; i<NEG_CACHE_SHARDS; i++)
+		if(&neg->shards[i] != sh)
+			unit_assert(neg->shards[i].tree.count == 0);
 
 	neg_cache_delete(neg);
 }
@@ -78,6 +78,13 @@ static testdata_type* newdata(int val) {
 	return d;
 }
 
+/** compare function for the specialized lookup */
+static inline int test_cmp(void* k1, void* k2) {
+	return test_slabhash_compfunc(k1, k2);}
+
+/** lookup with the compare function inlined */
+static SLABHASH_LOOKUP_FUNC(test_lookup, test_slabhash_compfunc, test_cmp)
+
 /** test hashtable using short sequence */
 static void
 test_short_table(struct slabhash* table) 
@@ -143,6 +150,9 @@ testlookup(struct slabhash* table, testdata_type* ref[])
 		ref[num]? ref[num]->data : -1);
 	unit_assert( data == ref[num] );
 	if(en) { lock_rw_unlock(&en->lock); }
+	/* the specialized lookup finds the same entry */
+	unit_assert( test_lookup(table, myhash(num), key, 0) == en );
+	if(en) { lock_rw_unlock(&en->lock); }
 	delkey(key);
 }
 
@@ -222,7 +232,9 @@ testlookup_unlim(struct slabhash* table, testdata_type** ref)
 {
 	int num = random() % (HASHTESTMAX*10);
 	testkey_type* key = newkey(num);
-	struct lruhash_entry* en = slabhash_lookup(table, myhash(num), key, 0);
+	struct lruhash_entry* en = (num&1)?
+		test_lookup(table, myhash(num), key, 0):
+		slabhash_lookup(table, myhash(num), key, 0);
 	testdata_type* data = en? (testdata_type*)en->data : NULL;
 	if(en) {
 		unit_assert(en->key);
@@ -103,6 +103,14 @@ config_create(void)
 	cfg->tcp_upstream = 0;
 	cfg->tcp_mss = 0;
 	cfg->outgoing_tcp_mss = 0;
+	cfg->tcp_fastopen_queue = 5;
+	cfg->tcp_upstream_fastopen = 1;
+	cfg->tcp_idle_timeout = 30000;
+	cfg->do_tcp_keepalive = 0;
+	cfg->tcp_keepalive_timeout = 120000;
+	cfg->do_answer_cookie = 0;
+	cfg->cookie_secret = NULL;
+	cfg->upstream_cookie = 0;
 	cfg->ssl_service_key = NULL;
 	cfg->ssl_service_pem = NULL;
 	cfg->ssl_port = 853;
@@ -137,6 +145,15 @@ config_create(void)
 	cfg->jostle_time = 200;
 	cfg->rrset_cache_size = 4 * 1024 * 1024;
 	cfg->rrset_cache_slabs = 4;
+	cfg->cache_pins = NULL;
+	cfg->cache_pin_suffixes = NULL;
+	cfg->cache_pin_max_size = 1024 * 1024;
+	cfg->cache_peers = NULL;
+	cfg->cache_peer_port = UNBOUND_CACHE_PEER_PORT;
+	cfg->cache_peer_ifs = NULL;
+	cfg->cache_peer_rate = 1000;
+	cfg->xdp_ifs = NULL;
+	cfg->xdp_native = 0;
 	cfg->host_ttl = 900;
 	cfg->bogus_ttl = 60;
 	cfg->min_ttl = 0;
@@ -176,6 +193,8 @@ config_create(void)
 	cfg->out_ifs = NULL;
 	cfg->stubs = NULL;
 	cfg->forwards = NULL;
+	cfg->fwd_health_check = 0;
+	cfg->fwd_probe_interval = 5;
 #ifdef CLIENT_SUBNET
 	cfg->client_subnet = NULL;
 	cfg->client_subnet_opcode = 8;
@@ -254,6 +273,9 @@ config_create(void)
 #endif
 	if(!(cfg->val_nsec3_key_iterations = 
 		strdup("1024 150 2048 500 4096 2500"))) goto error_exit;
+	if(!(cfg->cachedb_secret = strdup("default"))) goto error_exit;
+	if(!(cfg->cachedb_compress = strdup("none"))) goto error_exit;
+	cfg->cachedb_compress_min = 512;
 #if defined(DNSTAP_SOCKET_PATH)
 	if(!(cfg->dnstap_socket_path = strdup(DNSTAP_SOCKET_PATH)))
 		goto error_exit;
@@ -397,6 +419,11 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	{ IS_YES_OR_NO; cfg->log_time_ascii = (strcmp(val, "yes") == 0);
 	  log_set_time_asc(cfg->log_time_ascii); }
 	else S_SIZET_NONZERO("max-udp-size:", max_udp_size)
+	else S_STR("cachedb-secret:", cachedb_secret)
+	else S_STR("cachedb-compress:", cachedb_compress)
+	else S_SIZET_OR_ZERO("cachedb-compress-min:", cachedb_compress_min)
+	else S_YNO("forward-health-check:", fwd_health_check)
+	else S_NUMBER_NONZERO("forward-probe-interval:", fwd_probe_interval)
 	else S_YNO("use-syslog:", use_syslog)
 	else S_STR("log-identity:", log_identity)
 	else S_YNO("extended-statistics:", stat_extended)
@@ -410,6 +437,14 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("tcp-upstream:", tcp_upstream)
 	else S_NUMBER_NONZERO("tcp-mss:", tcp_mss)
 	else S_NUMBER_NONZERO("outgoing-tcp-mss:", outgoing_tcp_mss)
+	else S_NUMBER_OR_ZERO("tcp-fastopen-queue:", tcp_fastopen_queue)
+	else S_YNO("tcp-upstream-fastopen:", tcp_upstream_fastopen)
+	else S_NUMBER_OR_ZERO("tcp-idle-timeout:", tcp_idle_timeout)
+	else S_YNO("edns-tcp-keepalive:", do_tcp_keepalive)
+	else S_NUMBER_OR_ZERO("edns-tcp-keepalive-timeout:", tcp_keepalive_timeout)
+	else S_YNO("answer-cookie:", do_answer_cookie)
+	else S_STR("cookie-secret:", cookie_secret)
+	else S_YNO("upstream-cookie:", upstream_cookie)
 	else S_YNO("ssl-upstream:", ssl_upstream)
 	else S_STR("ssl-service-key:", ssl_service_key)
 	else S_STR("ssl-service-pem:", ssl_service_pem)
@@ -434,6 +469,14 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("ip-freebind:", ip_freebind)
 	else S_MEMSIZE("rrset-cache-size:", rrset_cache_size)
 	else S_POW2("rrset-cache-slabs:", rrset_cache_slabs)
+	else S_STRLIST("cache-pin-suffix:", cache_pin_suffixes)
+	else S_MEMSIZE("cache-pin-max-size:", cache_pin_max_size)
+	else S_STRLIST("cache-peer:", cache_peers)
+	else S_NUMBER_NONZERO("cache-peer-port:", cache_peer_port)
+	else S_STRLIST("cache-peer-interface:", cache_peer_ifs)
+	else S_SIZET_OR_ZERO("cache-peer-rate:", cache_peer_rate)
+	else S_STRLIST("xdp-interface:", xdp_ifs)
+	else S_YNO("xdp-native:", xdp_native)
 	else S_YNO("prefetch:", prefetch)
 	else S_YNO("prefetch-key:", prefetch_key)
 	else if(strcmp(opt, "cache-max-ttl:") == 0)
@@ -565,7 +608,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 		 * stub-ssl-upstream, forward-zone,
 		 * name, forward-addr, forward-host,
 		 * ratelimit-for-domain, ratelimit-below-domain,
-		 * local-zone-tag, access-control-view */
+		 * local-zone-tag, access-control-view, cache-pin */
 		return 0;
 	}
 	return 1;
@@ -753,6 +796,15 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "ip-freebind", ip_freebind)
 	else O_MEM(opt, "rrset-cache-size", rrset_cache_size)
 	else O_DEC(opt, "rrset-cache-slabs", rrset_cache_slabs)
+	else O_LS2(opt, "cache-pin", cache_pins)
+	else O_LST(opt, "cache-pin-suffix", cache_pin_suffixes)
+	else O_MEM(opt, "cache-pin-max-size", cache_pin_max_size)
+	else O_LST(opt, "cache-peer", cache_peers)
+	else O_DEC(opt, "cache-peer-port", cache_peer_port)
+	else O_LST(opt, "cache-peer-interface", cache_peer_ifs)
+	else O_DEC(opt, "cache-peer-rate", cache_peer_rate)
+	else O_LST(opt, "xdp-interface", xdp_ifs)
+	else O_YNO(opt, "xdp-native", xdp_native)
 	else O_YNO(opt, "prefetch-key", prefetch_key)
 	else O_YNO(opt, "prefetch", prefetch)
 	else O_DEC(opt, "cache-max-ttl", max_ttl)
@@ -770,6 +822,14 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "tcp-upstream", tcp_upstream)
 	else O_DEC(opt, "tcp-mss", tcp_mss)
 	else O_DEC(opt, "outgoing-tcp-mss", outgoing_tcp_mss)
+	else O_DEC(opt, "tcp-fastopen-queue", tcp_fastopen_queue)
+	else O_YNO(opt, "tcp-upstream-fastopen", tcp_upstream_fastopen)
+	else O_DEC(opt, "tcp-idle-timeout", tcp_idle_timeout)
+	else O_YNO(opt, "edns-tcp-keepalive", do_tcp_keepalive)
+	else O_DEC(opt, "edns-tcp-keepalive-timeout", tcp_keepalive_timeout)
+	else O_YNO(opt, "answer-cookie", do_answer_cookie)
+	else O_STR(opt, "cookie-secret", cookie_secret)
+	else O_YNO(opt, "upstream-cookie", upstream_cookie)
 	else O_YNO(opt, "ssl-upstream", ssl_upstream)
 	else O_STR(opt, "ssl-service-key", ssl_service_key)
 	else O_STR(opt, "ssl-service-pem", ssl_service_pem)
@@ -846,6 +906,11 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "unblock-lan-zones", unblock_lan_zones)
 	else O_YNO(opt, "insecure-lan-zones", insecure_lan_zones)
 	else O_DEC(opt, "max-udp-size", max_udp_size)
+	else O_STR(opt, "cachedb-secret", cachedb_secret)
+	else O_STR(opt, "cachedb-compress", cachedb_compress)
+	else O_DEC(opt, "cachedb-compress-min", cachedb_compress_min)
+	else O_YNO(opt, "forward-health-check", fwd_health_check)
+	else O_DEC(opt, "forward-probe-interval", fwd_probe_interval)
 	else O_STR(opt, "python-script", python_script)
 	else O_YNO(opt, "disable-dnssec-lame-check", disable_dnssec_lame_check)
 	else O_DEC(opt, "ip-ratelimit", ip_ratelimit)
@@ -1131,6 +1196,7 @@ config_delete(struct config_file* cfg)
 	free(cfg->identity);
 	free(cfg->version);
 	free(cfg->module_conf);
+	free(cfg->cookie_secret);
 	free(cfg->outgoing_avail_ports);
 	config_delstrlist(cfg->caps_whitelist);
 	config_delstrlist(cfg->private_address);
@@ -1143,6 +1209,11 @@ config_delete(struct config_file* cfg)
 	free(cfg->dlv_anchor_file);
 	config_delstrlist(cfg->dlv_anchor_list);
 	config_deldblstrlist(cfg->acls);
+	config_deldblstrlist(cfg->cache_pins);
+	config_delstrlist(cfg->cache_pin_suffixes);
+	config_delstrlist(cfg->cache_peers);
+	config_delstrlist(cfg->cache_peer_ifs);
+	config_delstrlist(cfg->xdp_ifs);
 	free(cfg->val_nsec3_key_iterations);
 	config_deldblstrlist(cfg->local_zones);
 	config_delstrlist(cfg->local_zones_nodefault);
@@ -1160,6 +1231,8 @@ config_delete(struct config_file* cfg)
 	free(cfg->control_key_file);
 	free(cfg->control_cert_file);
 	free(cfg->dns64_prefix);
+	free(cfg->cachedb_secret);
+	free(cfg->cachedb_compress);
 	free(cfg->dnstap_socket_path);
 	free(cfg->dnstap_identity);
 	free(cfg->dnstap_version);
@@ -88,6 +88,23 @@ struct config_file {
 	int tcp_mss;
 	/** maximum segment size of tcp socket for outgoing queries */
 	int outgoing_tcp_mss;
+	/** TCP Fast Open queue length for tcp listening sockets, 0 is off */
+	int tcp_fastopen_queue;
+	/** use TCP Fast Open for outgoing tcp connections */
+	int tcp_upstream_fastopen;
+	/** msec to wait for the next query on an idle incoming tcp
+	 * connection, shortened when the tcp handlers fill up */
+	int tcp_idle_timeout;
+	/** answer the edns-tcp-keepalive option on tcp */
+	int do_tcp_keepalive;
+	/** msec idle timeout signalled to and used for keepalive clients */
+	int tcp_keepalive_timeout;
+	/** answer DNS cookies of clients */
+	int do_answer_cookie;
+	/** the secret for the cookies in hex, NULL for a random secret */
+	char* cookie_secret;
+	/** send DNS cookies to upstream servers */
+	int upstream_cookie;
 
 	/** private key file for dnstcp-ssl service (enabled if not NULL) */
 	char* ssl_service_key;
@@ -123,6 +140,26 @@ struct config_file {
 	size_t rrset_cache_size;
 	/** slabs in the rrset cache */
 	size_t rrset_cache_slabs;
+	/** names and types pinned in the cache, the type can be ANY */
+	struct config_str2list* cache_pins;
+	/** names that are pinned in the cache, with all names below them */
+	struct config_strlist* cache_pin_suffixes;
+	/** the memory pinned entries may use in the msg and in the rrset
+	 * cache, each */
+	size_t cache_pin_max_size;
+	/** the peers that the cache inserts are sent to, ip[@port] */
+	struct config_strlist* cache_peers;
+	/** port number of the cache peers */
+	int cache_peer_port;
+	/** interfaces that the cache inserts of the peers are received on */
+	struct config_strlist* cache_peer_ifs;
+	/** max number of cache inserts sent per second, 0 for no limit */
+	size_t cache_peer_rate;
+	/** interfaces, with @queue, that get an AF_XDP socket for the UDP
+	 * queries on the port */
+	struct config_strlist* xdp_ifs;
+	/** attach the XDP program in native driver mode, not generic */
+	int xdp_native;
 	/** host cache ttl in seconds */
 	int host_ttl;
 	/** number of slabs in the infra host cache */
@@ -168,6 +205,10 @@ struct config_file {
 	struct config_stub* stubs;
 	/** the forward zone definitions, linked list */
 	struct config_stub* forwards;
+	/** if forwarders are health checked, and selected on latency */
+	int fwd_health_check;
+	/** seconds between the health probes to the forwarders */
+	int fwd_probe_interval;
 	/** the views definitions, linked list */
 	struct config_view* views;
 	/** list of donotquery addresses, linked list */
@@ -385,6 +426,13 @@ struct config_file {
 	/* Synthetize all AAAA record despite the presence of an authoritative one */
 	int dns64_synthall;
 
+	/** secret for the keys of the cachedb module */
+	char* cachedb_secret;
+	/** compression of the cachedb values: "none", "lz4" or "zstd" */
+	char* cachedb_compress;
+	/** cachedb values smaller than this are not compressed */
+	size_t cachedb_compress_min;
+
 	/** true to enable dnstap support */
 	int dnstap;
 	/** dnstap socket path */
@@ -502,6 +550,8 @@ struct config_view {
 	/** Fallback to global local_zones when there is no match in the view
 	 * view specific tree. 1 for yes, 0 for no */	
 	int isfirst;
+	/** cache memory quota for the view, 0 for no quota */
+	size_t cache_quota;
 	/** predefined actions for particular IP address responses */
 	struct config_str2list* respip_actions;
 	/** data complementing the 'redirect' response IP actions */
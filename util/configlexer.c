@@ -378,8 +378,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 220
-#define YY_END_OF_BUFFER 221
+#define YY_NUM_RULES 243
+#define YY_END_OF_BUFFER 244
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -387,244 +387,270 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[2150] =
+static yyconst flex_int16_t yy_accept[2389] =
     {   0,
-        1,    1,  202,  202,  206,  206,  210,  210,  214,  214,
-        1,    1,  221,  218,    1,  200,  200,  219,    2,  219,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      202,  203,  203,  204,  219,  206,  207,  207,  208,  219,
-      213,  210,  211,  211,  212,  219,  214,  215,  215,  216,
-      219,  217,  201,    2,  205,  219,  217,  218,    0,    1,
-        2,    2,    2,    2,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      202,    0,  206,    0,  213,    0,  210,  214,    0,  217,
-        0,    2,    2,  217,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  217,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-
-      217,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,   77,  218,  218,  218,
-      218,  218,  218,    8,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  218,   88,  217,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  217,
-      218,  218,  218,  218,  218,   37,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  167,  218,
-       14,   15,  218,   18,   17,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  153,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  218,  218,    3,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  217,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  209,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  218,   40,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,   41,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  142,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,   20,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  101,  218,  209,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  194,  218,  218,  218,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  117,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      100,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,   75,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,   25,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,   38,  218,  218,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,   39,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  118,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-       28,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  182,  218,  218,  218,
-
-      218,  218,  218,  218,  218,  218,  218,   32,  218,   33,
-      218,  218,  218,   78,  218,   79,  218,  218,   76,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,    7,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  160,  218,  218,  218,  218,  103,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,   29,  218,  218,  218,
-
-      218,  218,  218,  218,  134,  218,  133,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,   16,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,   42,  218,  218,
-      218,  218,  218,  218,  141,  218,  218,  218,  218,   81,
-       80,  218,  218,  218,  218,  218,  218,  218,  218,  128,
-      218,  218,  218,  218,  218,  218,  218,  218,   89,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,   60,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,   64,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,   36,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  131,
-      132,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,    6,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      192,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-       26,  218,  218,  218,  218,  218,  218,  218,  218,  124,
-
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      146,  218,  125,  218,  218,  158,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-       27,  218,  218,  218,  218,   84,  218,   85,  218,   83,
-      218,  218,  218,  218,  218,  218,  218,  218,   98,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      181,  218,  218,  126,  218,  218,  218,  218,  218,  129,
-      218,  218,  157,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,   74,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  218,  218,   34,  218,  218,   22,  218,
-      218,  218,  218,   19,  218,  108,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-       49,   51,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  196,  218,  218,  168,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-       86,  218,  218,  218,  218,  218,  218,  218,   97,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  102,  218,  218,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  218,  218,  218,  152,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      116,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  112,  218,  119,  218,  218,  218,
-      218,  218,   92,  218,  218,   70,  218,  218,  144,  218,
-      218,  218,  218,  218,  159,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  173,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  115,
-      218,  218,  218,  218,  218,   52,   53,  218,  218,  218,
-      218,  218,   35,   59,  120,  218,  135,  218,  161,  130,
-
-      218,  218,  218,   45,  218,  122,  218,  218,  218,  218,
-      218,    9,  218,  218,  218,   73,  218,  218,  218,  218,
-      186,  218,  143,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  104,  195,
-      218,  218,  172,  218,  218,  218,  218,  218,  218,  218,
-      218,  154,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  121,  218,  218,  218,   44,   46,  218,  218,
-
-      218,  218,  218,  218,  218,   72,  218,  218,  218,  218,
-      184,  218,  191,  218,  218,  218,  218,  218,  148,   23,
-       24,  218,  218,  218,  218,  218,  218,  218,  218,   69,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  150,  147,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,   43,  218,  218,  218,
-      218,  218,  218,  218,  218,   99,   13,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,   12,  218,  218,   21,  218,  218,  218,  190,  218,
-      193,   47,  218,  156,  218,  149,  218,  218,  218,  218,
-
-      218,  218,  218,  218,  218,  218,  218,  218,  111,  110,
-      218,  218,  218,  218,  218,  151,  145,  218,  218,  197,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-       54,  218,  218,  218,  185,  218,  218,  218,  155,  218,
-      218,  218,  218,  218,  218,  218,  218,   48,  218,  218,
-      218,   82,  218,  105,  107,  136,  218,  218,  218,  109,
-      218,  218,  162,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  169,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-
-      137,  218,  218,  183,  218,  218,  218,   30,  218,  218,
-      218,  218,    4,  218,  218,   93,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  165,  218,  218,  218,  218,
-      218,  198,  218,  218,  218,  218,  218,  171,  218,  218,
-      140,  218,  218,  218,  218,  218,  218,  218,  218,   57,
-      218,   31,  189,  166,  218,  218,   11,  218,  218,  218,
-      218,  218,  218,  138,   61,  218,  218,  218,  114,  218,
-      218,  218,  218,   94,  218,  218,  218,  218,  218,  218,
-      218,  170,   90,  218,   87,  218,  218,  218,   63,   67,
-       62,  218,   55,  218,  218,   10,  218,  218,  218,  187,
-
-      218,  218,  113,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,   68,   66,  218,
-       56,  218,  218,  218,  127,  218,  218,  139,  218,  218,
-      218,  218,  106,   50,  218,  199,  218,  218,  218,  218,
-      218,  218,   91,   65,   95,   96,   58,  218,  188,  218,
-      218,  218,  164,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,   71,  218,  163,  180,  218,  218,  218,  218,
-      218,  218,    5,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-
-      218,  218,  218,  218,  123,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  176,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  174,  218,  177,
-      178,  218,  218,  218,  218,  218,  175,  179,    0
+        1,    1,  225,  225,  229,  229,  233,  233,  237,  237,
+        1,    1,  244,    1,  241,  241,    2,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  242,  223,  242,
+      223,  225,  226,  227,  242,  226,  242,  230,  230,  231,
+      229,  234,  234,  235,  236,  242,  233,  237,  238,  239,
+      242,  238,    2,  224,  240,  240,  228,  242,    1,    2,
+      241,  241,  241,  241,  241,  241,    0,  241,  241,  241,
+      241,    2,    2,    2,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  225,    0,  225,  229,    0,
+      229,  236,    0,  236,  233,  237,    0,  237,    2,    2,
+      240,    0,  240,  240,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,    2,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,    2,
+      240,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      240,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,   94,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,    8,  241,
+      105,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  240,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  240,   14,   15,   18,
+      241,   17,  241,  241,  241,  190,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+        3,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,   45,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  171,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  240,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  232,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  160,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,   20,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,   48,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,   49,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  119,  241,  241,  232,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  217,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  118,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,   33,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,   46,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  135,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,   92,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,   47,  241,  241,  241,  241,  241,  241,  205,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,   36,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,   95,   96,  241,   93,  241,
+      241,  241,  241,   40,  241,   41,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,   57,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  136,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,    7,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  183,  241,  241,  241,  121,   50,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,   37,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,   97,   98,  241,  241,  159,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,   60,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      146,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  151,  241,  152,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,   16,
+      241,  241,  241,  241,  241,  241,  106,  241,  241,  241,
+      241,  241,  241,  241,   65,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,   77,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  215,  241,  241,  241,   44,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+       34,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,   81,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  149,  150,  241,
+
+      241,  241,    6,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,   35,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  176,  241,
+      241,  143,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  204,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  142,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,   30,
+       42,  241,  126,  241,  241,  241,  241,   19,  241,  144,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  164,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  175,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  102,  100,
+      241,  101,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  116,  241,  241,  241,  241,  147,  241,  241,  241,
+      241,  241,  241,  241,  241,   91,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  191,
+      241,  241,  241,  219,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,   27,  241,  134,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,   68,
+       66,  241,  241,  241,  241,  241,  241,  241,   28,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      120,  241,  241,  241,  241,  241,  241,  103,  241,  241,
+      241,  241,  241,  241,  241,  115,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  170,  241,  241,  130,  241,  241,  137,  241,  241,
+
+       64,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      196,  241,  241,  241,  241,  177,  241,  241,  241,  241,
+      241,  209,  241,  241,  241,  241,  241,  241,  161,   43,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,   69,
+       70,  241,  133,  241,  110,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  138,  241,  178,  241,  241,  241,  241,  241,  241,
+       87,  241,  241,  162,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,   53,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+
+       76,  241,  184,  153,  148,  140,  241,  241,  241,  241,
+      241,    9,  241,  241,   90,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  172,  241,  241,  241,  241,
+      241,  241,  195,  241,  241,  218,  241,  122,  241,  241,
+      241,  207,  241,  241,  241,  214,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  166,  241,  241,  241,  241,   31,   32,  241,  241,
+      241,  241,  241,  241,  139,  241,  241,   61,   63,  241,
+      241,  241,  241,  241,  241,  241,  241,   86,   29,  241,
+      241,  241,  241,   54,   52,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,   89,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  213,  241,   55,
+      241,  174,  216,  241,  241,  241,   13,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  167,  241,  241,  241,
+      241,  241,  241,  241,   24,  241,  241,  241,  179,  241,
+      241,   58,  241,  241,  241,  168,  165,  241,  241,  241,
+      241,  241,  241,   51,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  117,  241,  241,  241,  241,
+
+      241,   12,   21,  241,  107,  129,  128,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  220,  241,  241,  241,   56,  208,  241,  241,  241,
+      241,  241,  241,   71,  241,  241,  241,  241,  241,   99,
+      241,  241,  123,  125,  241,  241,  241,  241,  241,  241,
+      241,  163,  169,  241,  154,  241,  241,  241,  173,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  127,
+      241,  241,  192,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  206,  241,  241,  241,  241,  241,
+
+      155,  241,  185,  241,  241,  111,  241,  241,   22,  241,
+      241,  241,  241,   59,  241,  241,  241,    4,  241,  241,
+      241,   25,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,   38,  241,  241,  241,
+      241,  241,  241,  241,  194,  241,  241,  241,  241,  221,
+      241,  241,  241,  241,  212,   39,   74,  241,  241,  241,
+      241,  188,  241,  241,  156,  241,   78,  241,  241,  241,
+      241,  241,  241,  241,  241,  158,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  189,  241,   11,  241,  241,
+      241,  132,  241,  241,  108,  193,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  210,  241,   72,  241,  241,  241,
+      241,  241,  180,   62,  241,  112,  241,  241,  241,  241,
+      104,  181,  241,   79,   84,  241,  241,  241,   80,  241,
+       10,  241,  241,  131,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,   73,  241,  241,  241,  157,   23,
+      241,  241,  241,  241,  241,  241,  241,   85,   83,  241,
+      241,  145,  241,  109,  241,  241,  241,  241,  241,  241,
+      222,  241,  211,  241,  241,  124,   67,  241,  241,  113,
+      114,  241,  182,   82,   75,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  187,  241,  241,  241,  241,  241,
+
+      241,  241,  241,  241,  241,  241,  241,   88,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  203,  186,    5,
+      241,  241,  241,  241,  241,  241,  241,  241,   26,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  141,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  199,  241,  241,  241,  241,  241,
+      241,  241,  241,  197,  241,  241,  241,  241,  241,  200,
+      201,  241,  241,  241,  198,  241,  202,    0
     } ;
 
 static yyconst YY_CHAR yy_ec[256] =
@@ -661,1440 +687,1490 @@ static yyconst YY_CHAR yy_ec[256] =
 
 static yyconst YY_CHAR yy_meta[41] =
     {   0,
-        1,    2,    3,    4,    5,    1,    6,    1,    1,    1,
-        1,    1,    7,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_uint16_t yy_base[2164] =
+static yyconst flex_uint16_t yy_base[2389] =
     {   0,
-        0,    0,   38,   41,   44,   46,   59,   65,   71,   77,
-       90,  112, 2240, 2121,   81, 4228, 4228, 4228,   96,   52,
-       72,  107,  111,   70,   91,  109,  124,   98,  127,  114,
-      133,  136,   64,  144,  146,  150,  156,  177,  167,  182,
-     2077, 4228, 4228, 4228,  182, 2049, 4228, 4228, 4228,  173,
-     1931, 1589, 4228, 4228, 4228,  206, 1411, 4228, 4228, 4228,
-      194, 1269, 4228,  210, 4228,  214,  174,  948,  218,  147,
-        0,  225,    0,    0,  189,  143,   97,  219,  212,  145,
-      179,  214,  221,  223,  227,  234,  229,  170,  231,  232,
-      233,  237,  244,  238,  253,   63,  236,  257,  258,  254,
-
-      260,  263,  264,  266,  268,  270,  269,  276,  277,  280,
-      286,  284,  287,  285,  290,  292,  293,  296,  300,  308,
-      299,  315,  301,  306,  297,  321,  320,  317,  324,  326,
-      872,  337,  760,  340,  686,  344,  352,  248,  348,  158,
-      355,  359,    0,  351,  353,  361,  341,  357,  360,  362,
-      363,  364,  366,  373,  371,  369,  378,  382,  383,  388,
-      381,  386,  390,  393,  394,  396,  399,  405,  406,  407,
-      409,  410,  411,  408,  419,  430,  422,  432,  433,  434,
-      436,  445,  437,  446,  447,  444,  448,  449,  450,  452,
-      453,  454,  456,  459,  463,  460,  465,  466,  468,  467,
-
-      479,  474,  483,  480,  482,  481,  496,  486,  487,  494,
-      497,  504,  501,  502,  506,  507,  508,  517,  509,  519,
-      512,  510,  521,  522,  523,  528,  529,  533,  537,  543,
-      530,  541,  544,  534,  546,  549,  547,  554,  562,  555,
-      564,  559,  565,  572,  557,  567,  568,  571,  573,  575,
-      576,  579,  580,  581,  586,  587,  596,  588,  593,  592,
-      597,  600,  595,  602,  613,  618,  619,  607,  611,  620,
-      623,  631,  628,  634,  625,  636,  637,  638,  639,  648,
-      643,  650,  646,  655,  656,  653,  652,  665,  670,  657,
-      669,  672,  676,  675,  677,  679,  697,  683,  678,  707,
-
-      681,  684,  695,  685,  694,  704,  708,  714,  715,  717,
-      718,  725,  720,  723,  724,  732,  721,  729,  731,  744,
-      737,  739,  743,  747,  645,  748,  749,  751,  750,  754,
-      756,  762,  766,  771,  778,  758,  775,  773,  782,  783,
-      784,  786,  788,  789,  798,  793,  794,  795,  796,  799,
-      802,  804,  806,  812,  809,  818, 4228,  820,  810,  816,
-      813,  823,  825, 4228,  826,  827,  828,  835,  832,  833,
-      834,  845,  855,  836,  856,  840,  852,  851,  858,  859,
-      860,  861,  862,  864,  884,  867,  869,  865,  877,  886,
-      876,  893,  870,  897,  891,  868,  899,  901,  902,  904,
-
-      907,  908,  911,  912, 4228,  913,  921,  919,  905,  922,
-      925,  929,  936,  932,  940,  937,  938,  939,  942,  943,
-      945,  950,  957,  952,  959,  963,  973,  969,  971,  978,
-      953,  955,  975,  976,  977,  985,  982,  980,  983,  987,
-      995,  991,  990,  997,  992, 1001,  993, 1003, 1012,  999,
-     1020, 1006, 1016, 1018, 1021, 1023, 1024, 1025, 1027, 1030,
-     1029, 1031, 1041, 1036, 1034, 1046, 1047, 1033, 1048, 1056,
-     1053, 1060, 1061, 1063, 1071, 1059, 1066, 1073, 1055, 1069,
-     1077, 1075, 1076, 1089, 1084, 1057, 1090, 1086, 1091, 1094,
-     1096, 1097, 1098, 1099, 1100, 1102, 1101, 1104, 1106, 1113,
-
-     1108, 1110, 1124, 1111, 1120, 1128, 1122, 1126, 1130, 1132,
-     1135, 1134, 1137, 1144, 1136, 1146, 1147, 1148, 1150, 1152,
-     1155, 1160, 1151, 1165, 1161, 4228, 1163, 1173, 1168, 1171,
-     1169, 1176, 1183, 1178, 1179, 1180, 1184, 1187, 4228, 1185,
-     4228, 4228, 1190, 4228, 4228, 1189, 1195, 1208, 1202, 1210,
-     1219, 1220, 1218, 1193, 1215, 1191, 1225, 1230, 1234, 1235,
-     1231, 1242, 1240, 1244, 1248, 1249, 1250, 1237, 1252, 1254,
-     1255, 1257, 1259, 1261, 1260, 1264, 1265, 1267, 1277, 1285,
-     1286, 1268, 1281, 1283, 1284, 1288, 1289, 1290, 1293, 1296,
-     1217, 1299, 1304, 1300, 4228, 1301, 1302, 1305, 1309, 1303,
-
-     1315, 1313, 1318, 1320, 1321, 4228, 1323, 1330, 1322, 1326,
-     1333, 1335, 1334, 1337, 1336, 1338, 1340, 1341, 1339, 1347,
-     1349, 1346, 1351, 1353, 1361, 1368, 1370, 1365, 1366, 1367,
-     1371, 1372, 1377, 1380, 1381, 1382, 1383, 1392, 1388, 1390,
-     1391, 1395, 1397, 1398, 1399, 1401, 1403, 1404, 1405, 1427,
-     1406, 1410, 1413, 1415, 1416, 1419, 1437, 1421, 1445, 1433,
-     1446, 1441, 1449, 1452, 1451, 1453, 1455, 1423, 1466, 1459,
-     1467, 1470, 1461, 1463, 1472, 1475, 1479, 1477, 1483, 1481,
-     1484, 1485, 1493, 1490, 4228, 1505, 1497, 1488, 1498, 1508,
-     1501, 1509, 1422, 1510, 1513, 1512, 1514, 1515, 1516, 1517,
-
-     1518, 1523, 1525, 1530, 4228, 1526, 1522, 1527, 1535, 1537,
-     1539, 1543, 1546, 1551, 1553, 1549, 4228, 1554, 1564, 1556,
-     1565, 1559, 1561, 1567, 1572, 1569, 1571, 1575, 1578, 1576,
-     1579, 1580, 1586, 4228, 1587, 1588, 1591, 1595, 1590, 1600,
-     1602, 1601, 1603, 1606, 1607, 1614, 1610, 1611, 4228, 1609,
-     1621, 1612, 1613, 1634, 1635, 1617, 1631, 1638, 1630, 1633,
-     1639, 1644, 1641, 1643, 1642, 1645, 4228, 1646,  130, 1648,
-     1653, 1654, 1656, 1663, 1655, 1664, 1667, 1669, 1671, 1673,
-     1675, 1658, 1679, 1676, 1680, 1682, 1684, 1687, 1688, 1689,
-     1692, 4228, 1695, 1701, 1693, 1702, 1704, 1703, 1710, 1712,
-
-     1713, 1715, 1714, 4228, 1723, 1724, 1718, 1725, 1726, 1729,
-     1730, 1731, 1734, 1735, 1736, 1741, 1742, 1738, 1739, 1746,
-     4228, 1766, 1748, 1761, 1750, 1763, 1752, 1773, 1765, 1771,
-     1774, 1775, 1777, 1779, 1786, 1781, 1778, 1789, 1791, 1792,
-     1793, 1795, 1799, 1800, 1802, 1801, 1809, 1810, 1806, 1813,
-     1812, 1822, 1751, 1807, 4228, 1820, 1814, 1825, 1827, 1839,
-     1831, 1835, 1834, 1840, 1837, 1841, 1847, 1842, 1846, 1849,
-     1858, 1850, 1862, 4228, 1863, 1859, 1867, 1869, 1852, 1874,
-     1870, 1876, 1878, 1879, 1880, 1881, 1882, 1883, 1888, 1890,
-     1891, 1892, 4228, 1900, 1901, 1902, 1909, 1904, 1893, 1908,
-
-     1911, 1914, 1915, 1916, 1923, 1918, 1920, 1921, 1922, 1924,
-     1925, 1927, 1928, 1930, 1941, 1944, 1929, 1945, 4228, 1937,
-     1955, 1951, 1957, 1958, 1959, 1961, 1962, 1967, 1969, 1971,
-     1968, 1970, 1973, 1976, 1978, 1980, 1982, 4228, 1984, 1985,
-     1986, 1992, 1987, 1991, 1993, 1990, 1995, 2007, 2010, 2011,
-     2012, 1996, 2013, 2016, 2017, 2018, 2025, 2026, 2030, 2032,
-     4228, 2035, 2036, 2037, 2024, 2039, 2027, 2043, 2051, 2053,
-     2048, 2054, 2055, 2056, 2063, 2058, 2059, 2060, 2067, 2064,
-     2069, 2070, 2071, 2065, 2072, 2076, 2080, 2082, 2086, 2095,
-     2087, 2096, 2097, 2099, 2101, 2103, 4228, 2104, 2102, 2107,
-
-     2111, 2113, 2112, 2115, 2119, 2126, 2128, 4228, 2123, 4228,
-     2125, 2134, 2137, 4228, 2143, 4228, 2145, 2136, 4228, 2146,
-     2147, 2138, 2129, 2150, 2151, 2140, 2158, 2159, 2160, 2161,
-     2165, 2166, 2167, 2169, 2168, 4228, 2175, 2172, 2170, 2178,
-     2176, 2182, 2183, 2185, 2186, 2189, 2193, 2192, 2204, 2196,
-     2205, 4228, 2200, 2207, 2201, 2211, 4228, 2208, 2212, 2218,
-     2210, 2215, 2221, 2222, 2223, 2233, 2231, 2235, 2229, 2237,
-     2227, 2241, 2253, 2245, 2248, 2249, 2250, 2260, 2256, 2263,
-     2255, 2259, 2272, 2262, 2258, 2265, 2269, 2273, 2274, 2279,
-     2277, 2281, 2280, 2282, 2283, 2284, 4228, 2293, 2286, 2294,
-
-     2295, 2296, 2304, 2298, 4228, 2307, 4228, 2301, 2309, 2312,
-     2315, 2317, 2319, 2321, 2320, 2323, 2331, 2325, 2338, 2345,
-     2328, 2333, 2335, 2341, 2347, 2339, 4228, 2349, 2350, 2356,
-     2354, 2352, 2359, 2365, 2360, 2358, 2379, 4228, 2377, 2367,
-     2381, 2382, 2389, 2384, 4228, 2386, 2394, 2391, 2392, 4228,
-     4228, 2393, 2397, 2396, 2398, 2399, 2408, 2403, 2407, 4228,
-     2411, 2400, 2413, 2421, 2422, 2423, 2415, 2414, 4228, 2429,
-     2431, 2432, 2433, 2435, 2436, 2434, 2438, 2445, 2442, 2441,
-     2443, 2451, 2452, 2457, 4228, 2460, 2461, 2463, 2464, 2466,
-     2467, 2469, 2471, 2472, 2473, 2474, 2475, 2478, 2479, 2480,
-
-     2481, 2485, 2498, 2493, 2494, 2495, 2503, 2497, 2505, 2499,
-     2507, 2508, 2516, 2518, 4228, 2525, 2509, 2528, 2511, 2523,
-     2530, 2531, 2539, 2534, 2524, 2535, 2543, 2538, 4228, 2551,
-     2540, 2541, 2557, 2542, 2559, 2549, 2552, 2563, 2566, 4228,
-     4228, 2561, 2567, 2572, 2575, 2573, 2576, 2577, 2578, 2581,
-     2582, 4228, 2584, 2592, 2591, 2587, 2599, 2601, 2597, 2600,
-     2604, 2602, 2606, 2608, 2609, 2610, 2614, 2615, 2617, 2619,
-     4228, 2618, 2621, 2624, 2626, 2627, 2629, 2635, 2631, 2645,
-     2641, 2646, 2648, 2655, 2651, 2658, 2659, 2654, 2661, 2669,
-     4228, 2664, 2666, 2665, 2656, 2678, 2667, 2685, 2671, 4228,
-
-     2684, 2674, 2691, 2693, 2682, 2694, 2695, 2698, 2699, 2697,
-     4228, 2704, 4228, 2707, 2696, 4228, 2700, 2711, 2714, 2715,
-     2716, 2718, 2719, 2720, 2722, 2725, 2726, 2727, 2734, 2731,
-     4228, 2735, 2733, 2737, 2741, 4228, 2743, 4228, 2738, 4228,
-     2748, 2752, 2755, 2753, 2756, 2758, 2762, 2759, 4228, 2764,
-     2765, 2768, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2783,
-     4228, 2779, 2780, 4228, 2790, 2782, 2791, 2792, 2798, 4228,
-     2801, 2804, 4228, 2807, 2812, 2796, 2808, 2814, 2815, 2818,
-     2817, 2819, 2830, 2826, 2825, 2828, 4228, 2827, 2829, 2833,
-     2840, 2834, 2837, 2848, 2845, 2851, 2844, 2854, 2858, 2852,
-
-     2860, 2847, 2866, 2863, 2867, 4228, 2869, 2870, 4228, 2871,
-     2873, 2876, 2880, 4228, 2877, 4228, 2881, 2882, 2878, 2886,
-     2889, 2890, 2892, 2885, 2898, 2900, 2901, 2912, 2907, 2908,
-     4228, 4228, 2910, 2916, 2913, 2918, 2919, 2921, 2923, 2930,
-     2927, 2926, 2929, 4228, 2935, 2936, 4228, 2937, 2938, 2940,
-     2942, 2944, 2946, 2945, 2948, 2950, 2951, 2953, 2952, 2955,
-     4228, 2960, 2959, 2965, 2967, 2969, 2968, 2970, 4228, 2972,
-     2976, 2981, 2983, 2971, 2988, 2992, 2995, 2998, 2999, 3000,
-     3002, 3006, 3005, 3008, 3010, 3011, 3017, 3019, 3021, 3023,
-     3012, 3024, 4228, 3027, 3029, 3025, 3034, 3031, 3035, 3036,
-
-     3045, 3048, 3038, 3040, 3050, 3052, 4228, 3042, 3053, 3056,
-     2973, 3059, 3054, 3064, 3060, 3065, 3066, 3067, 3070, 3075,
-     4228, 3074, 3078, 3081, 3082, 3084, 3085, 3088, 3087, 3089,
-     3091, 3094, 3103, 3107, 4228, 3096, 4228, 3101, 3112, 3115,
-     3117, 3099, 4228, 3114, 3122, 4228, 3104, 3123, 4228, 3124,
-     3125, 3128, 3132, 3134, 4228, 3137, 3138, 3145, 3141, 3142,
-     3146, 3149, 3150, 3151, 3152, 4228, 3154, 3157, 3163, 3166,
-     3155, 3159, 3167, 3165, 3168, 3172, 3180, 3176, 3173, 4228,
-     3178, 3184, 3192, 3185, 3195, 4228, 4228, 3187, 3198, 3200,
-     3183, 3204, 4228, 4228, 4228, 3207, 4228, 3190, 4228, 4228,
-
-     3210, 3211, 3213, 4228, 3218, 4228, 3202, 3219, 3214, 3221,
-     3222, 4228, 3223, 3224, 3226, 4228, 3228, 3235, 3231, 3232,
-     4228, 3234, 4228, 3238, 3241, 3245, 3244, 3248, 3251, 3252,
-     3254, 3256, 3259, 3260, 3261, 3263, 3266, 3268, 3269, 3270,
-     3267, 3274, 3276, 3271, 3282, 3277, 3283, 3284, 3288, 3286,
-     3291, 3292, 3293, 3294, 3300, 3304, 3311, 3312, 4228, 4228,
-     3301, 3306, 4228, 3308, 3315, 3316, 3320, 3318, 3321, 3324,
-     3322, 4228, 3326, 3330, 3329, 3336, 3331, 3332, 3334, 3335,
-     3337, 3345, 3349, 3359, 3354, 3355, 3357, 3358, 3360, 3361,
-     3362, 3364, 4228, 3365, 3368, 3371, 4228, 4228, 3369, 3375,
-
-     3383, 3377, 3373, 3385, 3393, 4228, 3379, 3395, 3387, 3396,
-     4228, 3401, 4228, 3403, 3398, 3405, 3406, 3408, 4228, 4228,
-     4228, 3412, 3410, 3414, 3415, 3416, 3418, 3419, 3420, 4228,
-     3422, 3425, 3426, 3429, 3434, 3436, 3439, 3440, 3447, 3443,
-     3442, 3450, 3452, 4228, 4228, 3453, 3460, 3456, 3464, 3463,
-     3465, 3462, 3468, 3469, 3473, 3472, 4228, 3476, 3475, 3474,
-     3481, 3482, 3486, 3487, 3489, 4228, 4228, 3485, 3490, 3493,
-     3497, 3499, 3500, 3501, 3503, 3505, 3507, 3514, 3520, 3513,
-     3517, 4228, 3506, 3523, 4228, 3525, 3526, 3527, 4228, 3530,
-     4228, 4228, 3533, 4228, 3528, 4228, 3534, 3537, 3544, 3546,
-
-     3551, 3553, 3556, 3539, 3545, 3541, 3561, 3558, 4228, 4228,
-     3569, 3547, 3565, 3572, 3573, 4228, 4228, 3574, 3564, 4228,
-     3575, 3576, 3578, 3580, 3581, 3582, 3585, 3586, 3587, 3588,
-     3589, 3591, 3602, 3597, 3599, 3606, 3608, 3609, 3610, 3611,
-     4228, 3615, 3616, 3617, 4228, 3621, 3622, 3623, 4228, 3624,
-     3629, 3633, 3636, 3625, 3644, 3639, 3641, 4228, 3647, 3648,
-     3649, 4228, 3651, 4228, 4228, 4228, 3653, 3654, 3656, 4228,
-     3659, 3662, 4228, 3668, 3660, 3670, 3672, 3679, 3675, 3682,
-     3671, 3678, 3684, 3691, 3674, 3687, 4228, 3688, 3689, 3694,
-     3695, 3696, 3697, 3698, 3701, 3703, 3705, 3709, 3713, 3715,
-
-     4228, 3717, 3719, 4228, 3722, 3723, 3724, 4228, 3726, 3727,
-     3728, 3730, 4228, 3731, 3736, 4228, 3733, 3738, 3741, 3742,
-     3744, 3743, 3746, 3754, 3752, 4228, 3748, 3758, 3765, 3759,
-     3766, 4228, 3767, 3768, 3775, 3771, 3774, 4228, 3777, 3779,
-     4228, 3781, 3785, 3782, 3786, 3793, 3795, 3800, 3797, 4228,
-     3804, 4228, 4228, 4228, 3783, 3806, 4228, 3809, 3801, 3810,
-     3811, 3813, 3814, 4228, 4228, 3816, 3818, 3821, 4228, 3822,
-     3823, 3827, 3825, 4228, 3828, 3829, 3833, 3831, 3835, 3834,
-     3839, 4228, 4228, 3838, 4228, 3841, 3846, 3850, 4228, 4228,
-     4228, 3857, 4228, 3862, 3861, 4228, 3864, 3848, 3867, 4228,
-
-     3869, 3870, 4228, 3871, 3873, 3874, 3877, 3879, 3883, 3887,
-     3872, 3880, 3884, 3891, 3893, 3890, 3900, 4228, 4228, 3902,
-     4228, 3904, 3907, 3911, 4228, 3908, 3913, 4228, 3914, 3915,
-     3918, 3920, 4228, 4228, 3921, 4228, 3928, 3923, 3925, 3927,
-     3929, 3932, 4228, 4228, 4228, 4228, 4228, 3931, 4228, 3935,
-     3936, 3938, 4228, 3940, 3941, 3942, 3944, 3943, 3945, 3949,
-     3953, 3958, 3960, 3966, 3968, 3950, 3971, 3963, 3972, 3980,
-     3975, 3978, 4228, 3979, 4228, 4228, 3981, 3990, 3991, 3982,
-     3986, 3983, 4228, 3992, 3993, 3995, 3997, 3998, 4004, 4011,
-     4001, 4013, 4018, 4019, 4021, 4003, 4031, 4028, 4029, 4015,
-
-     4030, 4038, 4033, 4035, 4228, 4037, 4039, 4040, 4041, 4043,
-     4045, 4046, 4055, 4060, 4057, 4063, 4047, 4068, 4064, 4069,
-     4053, 4073, 4074, 4228, 4075, 4077, 4079, 4081, 4083, 4085,
-     4086, 4087, 4090, 4092, 4095, 4097, 4101, 4228, 4102, 4228,
-     4228, 4106, 4091, 4103, 4113, 4115, 4228, 4228, 4228, 4136,
-     4143, 4150, 4157, 4164,  101, 4171, 4178, 4185, 4192, 4199,
-     4206, 4213, 4220
+        1,   41,   81,  121,  161,  201,  241,  281,  321,  361,
+      401,  441, 4234,  482,  485,  511,  544,  511,  585,  607,
+      613,  464,  638,  459,  462,  664,  690,  731,  772,  813,
+      469,  498,  616,  493,  835,  519,  513,  871, 4234, 4234,
+     4234,  912, 4234, 4234,    1, 4234,    1, 4234, 4234, 4234,
+      953, 4234, 4234, 4234,  994,    1,  533, 1035, 4234, 4234,
+        1, 4234,    1, 4234, 1076,  508, 4234,    1,    1,    1,
+      676,  504,  555, 1117,  572,  511, 1158,  560,  556,  594,
+      610, 1199, 1240, 1281,  624, 1305,  614,  606,  624,  663,
+      648,  648,  657, 1308,  656,  660,  680,  657,  664,  663,
+
+     1305,  838,  705,  703,  713,  719,  711, 1310,  759,  737,
+      755,  749,  761,  757,  781,  784,  792,  786,  802,  793,
+      839,  830,  838,  834,  828,  846,  831,  832,  852,  883,
+      897,  891,  924,  927, 1340, 1381, 1422, 1463, 1504, 1545,
+     1586, 1627, 1668, 1709,  996, 1750, 1791, 1832, 1873, 1914,
+     1955, 1996,  943, 2037, 2060,  982, 1319,  984,  982, 1015,
+     1319, 1031, 1006, 1059, 1060, 1050, 1052, 2096, 2122, 1093,
+     1064, 1088, 1102, 1096, 1101, 1153, 1183, 1206, 1255, 1292,
+     1311, 1314, 1298, 1325, 1327, 1352, 1304, 1334, 1324, 1356,
+     1417, 1444, 1434, 1434, 1482, 1479, 1492, 2130, 1514, 1563,
+
+     1575, 1566, 1621, 1622, 1608, 1597, 1601, 1652, 1674, 1693,
+     1695, 1695, 1682, 1738, 2071, 1735, 1747, 1786, 1814, 1816,
+     1801, 1849, 1895, 1937, 1924, 1922, 1952, 2066, 1954, 2159,
+     1973, 2009, 2023, 2012, 2024, 2029, 2057, 2066, 2052, 2074,
+     2070, 2070, 2061, 2051, 2070, 2078, 2131, 2114, 2107, 2114,
+     2110, 2113, 2131, 2129, 2116, 2122, 2115, 2119, 2137, 2136,
+     2121, 2125, 2136, 2167, 2182, 2194, 2184, 2196, 2197, 2183,
+     2188, 2179, 2191, 2183, 2181, 2196, 2198, 2210, 2203, 2202,
+     2214, 2192, 2202, 2197, 2199, 2211, 2201, 2198, 2203, 2205,
+     2215, 2218, 2220, 2211, 2213, 2232, 2213, 2227, 2235, 2226,
+
+     2238, 2221, 2222, 2226, 2227, 2238, 2235, 2225, 2225, 2236,
+     2246, 2239, 2234, 2241, 2252, 2258, 2251, 2240, 2247, 2250,
+     2237, 2263, 2246, 2248, 2253, 2266, 2258, 2257, 2249, 2281,
+     2264, 2257, 2273, 2285, 2265, 2267, 2274, 2274, 2290, 2271,
+     2281, 2286, 2268, 2285, 2285, 2282, 2288, 2287, 2300, 2274,
+     2287, 2292, 2283, 2280, 2282, 2281, 2308, 2300, 2303, 2286,
+     2292, 2302, 2293, 2305, 2296, 2291, 2293, 2311, 2322, 2316,
+     2299, 2316, 2305, 2303, 2311, 2324, 2334, 2307, 2316, 2327,
+     2313, 2314, 2334, 2311, 2336, 2334, 2337, 2321, 2348, 2331,
+     2340, 2344, 2325, 2346, 2343, 2347, 2346, 2333, 2349, 2338,
+
+     2349, 2349, 2361, 2352, 2336, 2354, 2351, 2349, 4234, 2361,
+     2342, 2356, 2356, 2352, 2346, 2353, 2360, 2363, 4234, 2373,
+     4234, 2368, 2363, 2361, 2376, 2367, 2371, 2362, 2366, 2371,
+     2386, 2374, 2385, 2391, 2392, 2393, 2399, 2395, 2382, 2402,
+     2403, 2382, 2384, 2394, 2386, 2410, 2402, 2394, 2404, 2399,
+     2396, 2407, 2392, 2418, 2399, 2409, 2397, 2411, 2403, 2413,
+     2418, 2418, 2402, 2402, 2429, 2412, 2433, 2434, 2411, 2426,
+     2438, 2421, 2416, 2426, 2432, 2423, 2420, 2425, 2421, 2441,
+     2418, 2426, 2427, 2427, 2445, 2429, 2447, 2449, 2447, 2433,
+     2434, 2442, 2436, 2462, 2448, 2455, 2457, 2447, 2453, 2450,
+
+     2470, 2466, 2472, 2451, 2449, 2456, 2469, 2460, 2467, 2460,
+     2465, 2459, 2473, 2471, 2466, 2485, 2459, 2478, 2477, 2479,
+     2465, 2477, 2492, 2469, 2484, 2484, 2496, 2487, 2487, 2488,
+     2478, 2482, 2491, 2494, 2493, 2481, 2486, 2507, 2499, 2498,
+     2510, 2511, 2501, 2506, 2499, 2502, 2504, 2507, 2496, 2508,
+     2511, 2512, 2509, 2505, 2500, 2501, 2517, 4234, 4234, 4234,
+     2506, 4234, 2509, 2516, 2521, 4234, 2507, 2510, 2504, 2537,
+     2514, 2514, 2523, 2532, 2529, 2524, 2530, 2540, 2527, 2539,
+     2542, 2527, 2535, 2543, 2547, 2543, 2552, 2549, 2552, 2539,
+     2554, 2551, 2532, 2555, 2555, 2557, 2558, 2541, 2539, 2561,
+
+     4234, 2556, 2557, 2549, 2564, 2550, 2558, 2557, 2564, 2572,
+     2576, 2556, 2555, 2558, 2558, 2575, 2560, 2568, 2589, 2564,
+     2586, 2581, 2567, 2582, 2570, 2582, 2597, 2587, 2592, 2585,
+     2601, 2578, 4234, 2579, 2580, 2588, 2597, 2590, 2610, 2601,
+     2597, 2602, 2615, 2602, 2605, 2618, 2610, 2608, 2599, 2612,
+     2623, 2617, 2618, 2619, 2601, 2619, 2607, 2607, 2613, 2628,
+     2616, 2614, 2621, 2629, 2636, 2628, 2621, 2635, 2634, 2633,
+     2635, 2650, 2626, 4234, 2627, 2648, 2645, 2631, 2656, 2630,
+     2649, 2640, 2660, 2654, 2638, 2637, 2659, 2650, 2655, 2662,
+     2641, 2649, 2650, 2660, 2651, 2662, 2654, 2665, 2677, 2665,
+
+     2658, 2669, 2649, 2676, 2663, 2675, 2665, 2661, 2662, 2680,
+     2663, 2691, 2671, 2671, 2679, 2670, 2681, 2697, 4234, 2687,
+     2690, 2675, 2682, 2702, 2698, 2694, 2695, 2685, 2686, 2683,
+     2687, 2699, 2700, 2701, 2694, 2689, 2691, 2690, 2717, 2707,
+     2710, 2702, 4234, 2716, 2707, 2699, 2712, 2703, 2714, 2718,
+     2711, 2708, 4234, 2730, 2707, 2721, 2708, 2723, 2726, 2725,
+     2717, 2718, 2709, 2714, 2732, 2731, 2717, 2745, 2725, 2737,
+     2745, 2752, 2735, 2755, 2736, 2737, 2733, 2749, 2750, 2738,
+     2742, 2752, 2765, 2766, 2760, 2763, 2768, 2756, 2760, 2755,
+     2757, 2765, 2757, 2771, 2754, 2760, 2756, 2768, 2764, 2760,
+
+     2761, 2773, 2774, 2790, 4234, 2780, 2778, 2787, 2795, 2774,
+     2797, 2791, 2780, 2791, 4234, 2789, 2779, 2780, 2781, 2805,
+     2793, 2791, 2790, 2787, 2781, 4234, 2785, 2790,    1, 2804,
+     2801, 2792, 2809, 2799, 2807, 2797, 2815, 2812, 2813, 4234,
+     2813, 2800, 2807, 2823, 2816, 2805, 2810, 2808, 2808, 2834,
+     2822, 2817, 2825, 2821, 2835, 2824, 2819, 2825, 2826, 2847,
+     2834, 2823, 2839, 2833, 4234, 2853, 2833, 2835, 2835, 2831,
+     2843, 2835, 2829, 2841, 2851, 2837, 2859, 2860, 2839, 2862,
+     2843, 2858, 4234, 2861, 2860, 2867, 2852, 2869, 2861, 2865,
+     2855, 2852, 2868, 2854, 2866, 2882, 2862, 2873, 2861, 2886,
+
+     2887, 2888, 2878, 2870, 2881, 2872, 2874, 2884, 2871, 2888,
+     2890, 2887, 2887, 2882, 4234, 2893, 2896, 2880, 2890, 2880,
+     2892, 2908, 2885, 2899, 2891, 2901, 2896, 2889, 2890, 2905,
+     2896, 2894, 2909, 2905, 4234, 2916, 2901, 2911, 2897, 2912,
+     2909, 2903, 2905, 2904, 2905, 2917, 2914, 2923, 2928, 2921,
+     2926, 2927, 2932, 2940, 2930, 2932, 2928, 2940, 2928, 4234,
+     2936, 2926, 2942, 2927, 2942, 2929, 2939, 2957, 2958, 2934,
+     2949, 2961, 2947, 2958, 2953, 2953, 2942, 2935, 2957, 2952,
+     2960, 2971, 2947, 2965, 2954, 2964, 2955, 2957, 2963, 2966,
+     2956, 4234, 2977, 2972, 2955, 2985, 2981, 2979, 4234, 2977,
+
+     2979, 2970, 2967, 2970, 2980, 2991, 2987, 2971, 2992, 4234,
+     2989, 3001, 3002, 2996, 2993, 2977, 2981, 2991, 3009, 2986,
+     2985, 3012, 2987, 3009, 3010, 4234, 4234, 2994, 4234, 3017,
+     3013, 3008, 3013, 4234, 2997, 4234, 3001, 2992, 3013, 3010,
+     3019, 3018, 3008, 3004, 3011, 3022, 3032, 3014, 4234, 3008,
+     3015, 3018, 3012, 3016, 3018, 3036, 3013, 3034, 3022, 3027,
+     3027, 3044, 3040, 3030, 3032, 3042, 3035, 3055, 3024, 3032,
+     3058, 3034, 3048, 3037, 3051, 3037, 3046, 3058, 3041, 3047,
+     3047, 3059, 3046, 4234, 3047, 3061, 3062, 3053, 3054, 3051,
+     3064, 3071, 3064, 3059, 3070, 3082, 3083, 3058, 3060, 3061,
+
+     3064, 3065, 3066, 3067, 3072, 3074, 3068, 3089, 3088, 3093,
+     3088, 3090, 3082, 3084, 3088, 3104, 3100, 3095, 3081, 3091,
+     3084, 3082, 3104, 3102, 4234, 3108, 3107, 3084, 3105, 3108,
+     3107, 3119, 3111, 3106, 3104, 3098, 3116, 3105, 3103, 3121,
+     3099, 3123, 3106, 4234, 3127, 3113, 3122, 4234, 4234, 3125,
+     3130, 3123, 3139, 3116, 3142, 3119, 3133, 3119, 4234, 3141,
+     3129, 3122, 3150, 3126, 3127, 3134, 3137, 3136, 3133, 3143,
+     3152, 3149, 3161, 3150, 3163, 4234, 4234, 3139, 3156, 4234,
+     3166, 3148, 3142, 3145, 3145, 3152, 3154, 3155, 3161, 3163,
+     3162, 3156, 3155, 3166, 4234, 3175, 3156, 3158, 3159, 3175,
+
+     3172, 3178, 3165, 3166, 3185, 3194, 3195, 3185, 3186, 3174,
+     4234, 3194, 3179, 3201, 3180, 3188, 3179, 3194, 3191, 3182,
+     3186, 3195, 3211, 3201, 3206, 3214, 3197, 3190, 3206, 3210,
+     3195, 3195, 3195, 3198, 3218, 3224, 3196, 3215, 3216, 3208,
+     3203, 3210, 3210, 3211, 4234, 3211, 4234, 3203, 3230, 3231,
+     3229, 3224, 3240, 3236, 3218, 3217, 3225, 3225, 3224, 4234,
+     3216, 3224, 3242, 3232, 3229, 3229, 4234, 3224, 3228, 3244,
+     3241, 3246, 3248, 3248, 4234, 3251, 3261, 3257, 3236, 3238,
+     3250, 3255, 3249, 3247, 3248, 3259, 3256, 3248, 3245, 3248,
+     3267, 3271, 3259, 3268, 4234, 3275, 3266, 3264, 3274, 3260,
+
+     3253, 3279, 3262, 3267, 3279, 4234, 3269, 3271, 3292, 4234,
+     3293, 3268, 3281, 3269, 3270, 3298, 3295, 3298, 3283, 3296,
+     3288, 3299, 3298, 3296, 3287, 3287, 3287, 3295, 3299, 3312,
+     3313, 3319, 3320, 3322, 3312, 3325, 3326, 3322, 3321, 3297,
+     3307, 3321, 3313, 3313, 3328, 3306, 3325, 3320, 3321, 3327,
+     3316, 3318, 3343, 3339, 3327, 3334, 3338, 3322, 3323, 3350,
+     4234, 3334, 3320, 3335, 3329, 3328, 3351, 3325, 3351, 3344,
+     3339, 3348, 3337, 3341, 3338, 3338, 3340, 3362, 3363, 3358,
+     3365, 3345, 3372, 3349, 4234, 3364, 3375, 3367, 3377, 3369,
+     3348, 3375, 3354, 3354, 3376, 3358, 3380, 4234, 4234, 3371,
+
+     3355, 3366, 4234, 3363, 3379, 3391, 3379, 3393, 3389, 3384,
+     3381, 3397, 3372, 3372, 3400, 3383, 3371, 3375, 3386, 3395,
+     3406, 3396, 3401, 4234, 3385, 3410, 3401, 3401, 3388, 3399,
+     3391, 3396, 3412, 3392, 3409, 3406, 3417, 3405, 4234, 3406,
+     3416, 4234, 3408, 3406, 3402, 3429, 3419, 3423, 3417, 3425,
+     3427, 3429, 3419, 3412, 3427, 4234, 3414, 3420, 3427, 3436,
+     3417, 3427, 3428, 3429, 3416, 3436, 4234, 3432, 3446, 3444,
+     3449, 3440, 3438, 3430, 3434, 3440, 3434, 3450, 3451, 4234,
+     4234, 3451, 4234, 3452, 3442, 3445, 3455, 4234, 3446, 4234,
+     3461, 3459, 3460, 3446, 3447, 3450, 3449, 3476, 3465, 3473,
+
+     3474, 3473, 3455, 3470, 3471, 4234, 3473, 3470, 3475, 3482,
+     3488, 3474, 3475, 3470, 3461, 3486, 3486, 4234, 3484, 3488,
+     3465, 3478, 3494, 3485, 3494, 3487, 3481, 3490, 4234, 4234,
+     3505, 4234, 3501, 3499, 3501, 3488, 3490, 3511, 3489, 3499,
+     3509, 4234, 3489, 3505, 3504, 3494, 4234, 3504, 3509, 3510,
+     3522, 3499, 3498, 3514, 3507, 4234, 3502, 3508, 3515, 3525,
+     3510, 3513, 3528, 3509, 3524, 3531, 3522, 3528, 3534, 3519,
+     3531, 3531, 3521, 3533, 3521, 3525, 3536, 3519, 3544, 4234,
+     3519, 3525, 3542, 4234, 3542, 3549, 3555, 3545, 3528, 3537,
+     3549, 3555, 3536, 3530, 3556, 3549, 3552, 3540, 3562, 3563,
+
+     3554, 3563, 3562, 3554, 3554, 3556, 3557, 3570, 3573, 3574,
+     3559, 3576, 3582, 4234, 3569, 4234, 3566, 3574, 3578, 3577,
+     3562, 3579, 3560, 3573, 3578, 3579, 3568, 3569, 3590, 3577,
+     3574, 3595, 3576, 3597, 3592, 3578, 3594, 3581, 3592, 4234,
+     4234, 3582, 3604, 3603, 3596, 3607, 3595, 3590, 4234, 3594,
+     3606, 3606, 3598, 3619, 3594, 3601, 3617, 3598, 3613, 3600,
+     4234, 3594, 3609, 3603, 3604, 3630, 3616, 4234, 3605, 3615,
+     3605, 3605, 3611, 3610, 3617, 4234, 3634, 3616, 3636, 3637,
+     3638, 3639, 3621, 3639, 3635, 3639, 3644, 3625, 3626, 3647,
+     3632, 4234, 3628, 3648, 4234, 3641, 3657, 4234, 3632, 3652,
+
+     4234, 3651, 3652, 3659, 3658, 3646, 3642, 3650, 3649, 3663,
+     4234, 3666, 3672, 3662, 3669, 4234, 3657, 3671, 3677, 3654,
+     3658, 4234, 3675, 3670, 3674, 3663, 3679, 3678, 4234, 4234,
+     3654, 3680, 3679, 3667, 3683, 3691, 3681, 3679, 3686, 4234,
+     4234, 3675, 4234, 3670, 4234, 3676, 3688, 3695, 3681, 3695,
+     3685, 3680, 3700, 3701, 3689, 3690, 3698, 3684, 3686, 3694,
+     3708, 4234, 3689, 4234, 3691, 3711, 3712, 3703, 3689, 3705,
+     4234, 3712, 3704, 4234, 3712, 3698, 3703, 3721, 3722, 3717,
+     3703, 3715, 3720, 4234, 3727, 3728, 3723, 3724, 3721, 3711,
+     3712, 3730, 3720, 3729, 3742, 3723, 3734, 3719, 3735, 3723,
+
+     4234, 3724, 4234, 4234, 4234, 4234, 3749, 3722, 3740, 3745,
+     3731, 4234, 3729, 3750, 4234, 3738, 3750, 3728, 3739, 3728,
+     3742, 3747, 3737, 3757, 3741, 4234, 3740, 3741, 3753, 3741,
+     3744, 3747, 4234, 3755, 3749, 4234, 3767, 4234, 3765, 3771,
+     3758, 4234, 3773, 3754, 3775, 4234, 3776, 3771, 3775, 3758,
+     3780, 3760, 3763, 3788, 3768, 3765, 3780, 3785, 3778, 3770,
+     3790, 4234, 3785, 3778, 3791, 3771, 4234, 4234, 3789, 3790,
+     3775, 3798, 3778, 3790, 4234, 3806, 3795, 4234, 4234, 3776,
+     3804, 3782, 3801, 3802, 3809, 3810, 3807, 4234, 4234, 3792,
+     3804, 3798, 3794, 4234, 4234, 3796, 3817, 3795, 3809, 3801,
+
+     3812, 3801, 3803, 3807, 3817, 3810, 3808, 3809, 3829, 3820,
+     3810, 3816, 3814, 3830, 3835, 3836, 4234, 3832, 3838, 3839,
+     3840, 3835, 3826, 3827, 3838, 3832, 3840, 3838, 3838, 3833,
+     3844, 3856, 3847, 3847, 3859, 3841, 3840, 4234, 3855, 4234,
+     3858, 4234, 4234, 3860, 3841, 3846, 4234, 3853, 3843, 3845,
+     3846, 3867, 3848, 3861, 3864, 3876, 4234, 3851, 3873, 3853,
+     3873, 3876, 3877, 3872, 4234, 3863, 3876, 3867, 4234, 3880,
+     3877, 4234, 3878, 3885, 3886, 4234, 4234, 3871, 3888, 3870,
+     3875, 3896, 3892, 4234, 3887, 3890, 3889, 3890, 3891, 3888,
+     3897, 3881, 3887, 3892, 3893, 4234, 3899, 3896, 3896, 3893,
+
+     3902, 4234, 4234, 3904, 4234, 4234, 4234, 3915, 3906, 3897,
+     3913, 3905, 3895, 3916, 3896, 3903, 3900, 3902, 3916, 3897,
+     3920, 4234, 3919, 3912, 3917, 4234, 4234, 3928, 3910, 3926,
+     3910, 3922, 3912, 4234, 3934, 3940, 3912, 3930, 3938, 4234,
+     3929, 3928, 4234, 4234, 3942, 3926, 3918, 3935, 3942, 3947,
+     3953, 4234, 4234, 3944, 4234, 3944, 3956, 3942, 4234, 3958,
+     3934, 3953, 3953, 3940, 3933, 3940, 3960, 3961, 3947, 3959,
+     3960, 3948, 3963, 3959, 3970, 3955, 3962, 3967, 3972, 4234,
+     3959, 3956, 4234, 3951, 3978, 3984, 3958, 3975, 3963, 3983,
+     3978, 3990, 3984, 3972, 4234, 3988, 3989, 3990, 3964, 3972,
+
+     4234, 3991, 4234, 3994, 3985, 4234, 3974, 3998, 4234, 3993,
+     4000, 3986, 3996, 4234, 3982, 3998, 3985, 4234, 3986, 3990,
+     3987, 4234, 4009, 3996, 3999, 3989, 4007, 4005, 4010, 4006,
+     4000, 3998, 4019, 4014, 4021, 4001, 4234, 3999, 4003, 4025,
+     4013, 4007, 4028, 4029, 4234, 4012, 4026, 4013, 4039, 4234,
+     4016, 4032, 4027, 4038, 4234, 4234, 4234, 4033, 4040, 4037,
+     4040, 4234, 4030, 4038, 4234, 4030, 4234, 4046, 4047, 4027,
+     4049, 4041, 4030, 4029, 4043, 4234, 4054, 4055, 4054, 4057,
+     4058, 4053, 4045, 4055, 4062, 4234, 4061, 4234, 4064, 4050,
+     4060, 4234, 4067, 4047, 4234, 4234, 4047, 4064, 4052, 4055,
+
+     4055, 4054, 4067, 4062, 4234, 4078, 4234, 4058, 4059, 4075,
+     4082, 4083, 4234, 4234, 4071, 4234, 4069, 4067, 4089, 4075,
+     4234, 4234, 4077, 4234, 4234, 4091, 4092, 4088, 4234, 4089,
+     4234, 4095, 4077, 4234, 4097, 4092, 4079, 4074, 4085, 4080,
+     4097, 4104, 4099, 4106, 4234, 4097, 4106, 4109, 4234, 4234,
+     4110, 4098, 4102, 4113, 4114, 4109, 4116, 4234, 4234, 4117,
+     4118, 4234, 4117, 4234, 4101, 4104, 4127, 4108, 4118, 4105,
+     4234, 4122, 4234, 4111, 4128, 4234, 4234, 4124, 4126, 4234,
+     4234, 4115, 4234, 4234, 4234, 4111, 4107, 4118, 4121, 4116,
+     4118, 4121, 4127, 4125, 4234, 4141, 4121, 4121, 4134, 4150,
+
+     4131, 4141, 4142, 4123, 4134, 4151, 4152, 4234, 4153, 4133,
+     4139, 4142, 4137, 4138, 4164, 4165, 4146, 4234, 4234, 4234,
+     4162, 4148, 4158, 4159, 4146, 4153, 4154, 4149, 4234, 4150,
+     4151, 4177, 4171, 4168, 4169, 4170, 4177, 4158, 4165, 4172,
+     4161, 4162, 4188, 4234, 4182, 4179, 4180, 4167, 4168, 4175,
+     4182, 4171, 4172, 4191, 4192, 4189, 4190, 4177, 4198, 4191,
+     4192, 4181, 4182, 4201, 4234, 4198, 4199, 4186, 4207, 4200,
+     4189, 4190, 4209, 4234, 4206, 4213, 4214, 4207, 4196, 4234,
+     4234, 4211, 4218, 4199, 4234, 4220, 4234, 4234
     } ;
 
-static yyconst flex_int16_t yy_def[2164] =
+static yyconst flex_int16_t yy_def[2389] =
     {   0,
-     2149,    1, 2150, 2150, 2151, 2151, 2152, 2152, 2153, 2153,
-     2154, 2154, 2149, 2155, 2149, 2149, 2149, 2149, 2156, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2157, 2149, 2149, 2149, 2157, 2158, 2149, 2149, 2149, 2158,
-     2159, 2149, 2149, 2149, 2149, 2159, 2160, 2149, 2149, 2149,
-     2160, 2161, 2149, 2162, 2149, 2161, 2161, 2155, 2155, 2149,
-     2163, 2156, 2163, 2156, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2157, 2157, 2158, 2158, 2159, 2159, 2149, 2160, 2160, 2161,
-     2161, 2162, 2162, 2161, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2161, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2161, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2149, 2161, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2161,
-     2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155,
-     2149, 2149, 2155, 2149, 2149, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2161, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2161, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2149,
-     2155, 2155, 2155, 2149, 2155, 2149, 2155, 2155, 2149, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2149, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2149, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155,
-     2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2149,
-     2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149,
-     2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149,
-
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2149, 2155, 2149, 2155, 2155, 2149, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2149, 2155, 2155, 2155, 2155, 2149, 2155, 2149, 2155, 2149,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2149, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2149,
-     2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2149, 2155,
-     2155, 2155, 2155, 2149, 2155, 2149, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2149, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2149, 2155, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2149, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2149, 2155, 2155, 2149, 2155, 2155, 2149, 2155,
-     2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149,
-     2155, 2155, 2155, 2155, 2155, 2149, 2149, 2155, 2155, 2155,
-     2155, 2155, 2149, 2149, 2149, 2155, 2149, 2155, 2149, 2149,
-
-     2155, 2155, 2155, 2149, 2155, 2149, 2155, 2155, 2155, 2155,
-     2155, 2149, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155,
-     2149, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2149,
-     2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2149, 2155, 2155, 2155, 2149, 2149, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155,
-     2149, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2149, 2149,
-     2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2149, 2149, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2149, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2149, 2155, 2155, 2149, 2155, 2155, 2155, 2149, 2155,
-     2149, 2149, 2155, 2149, 2155, 2149, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2149,
-     2155, 2155, 2155, 2155, 2155, 2149, 2149, 2155, 2155, 2149,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2149, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2149, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155,
-     2155, 2149, 2155, 2149, 2149, 2149, 2155, 2155, 2155, 2149,
-     2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2149, 2155, 2155, 2149, 2155, 2155, 2155, 2149, 2155, 2155,
-     2155, 2155, 2149, 2155, 2155, 2149, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155,
-     2155, 2149, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2155,
-     2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149,
-     2155, 2149, 2149, 2149, 2155, 2155, 2149, 2155, 2155, 2155,
-     2155, 2155, 2155, 2149, 2149, 2155, 2155, 2155, 2149, 2155,
-     2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2149, 2149, 2155, 2149, 2155, 2155, 2155, 2149, 2149,
-     2149, 2155, 2149, 2155, 2155, 2149, 2155, 2155, 2155, 2149,
-
-     2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2149, 2155,
-     2149, 2155, 2155, 2155, 2149, 2155, 2155, 2149, 2155, 2155,
-     2155, 2155, 2149, 2149, 2155, 2149, 2155, 2155, 2155, 2155,
-     2155, 2155, 2149, 2149, 2149, 2149, 2149, 2155, 2149, 2155,
-     2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2149, 2155, 2149, 2149, 2155, 2155, 2155, 2155,
-     2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-
-     2155, 2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2149, 2155, 2155, 2155, 2155, 2155, 2155,
-     2155, 2155, 2155, 2155, 2155, 2155, 2155, 2149, 2155, 2149,
-     2149, 2155, 2155, 2155, 2155, 2155, 2149, 2149,    0, 2149,
-     2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149,
-     2149, 2149, 2149
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74, 2388, 2388, 2388,   74, 2388,   74, 2388,   74,
+       74,   74, 2388,   74,   74,   74, 2388, 2388, 2388, 2388,
+       74,   74,   74,   74,   74,   74,   74, 2388, 2388, 2388,
+     2388, 2388, 2388, 2388,  137, 2388,  140, 2388, 2388, 2388,
+     2388, 2388, 2388, 2388, 2388,  143, 2388, 2388, 2388, 2388,
+      147, 2388,  149, 2388, 2388,  151, 2388,  152,   14,   84,
+       74,   74,   74, 2388,   74,   74, 2388,   74,   74,   74,
+       74, 2388, 2388, 2388,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388, 2388, 2388, 2388, 2388, 2388,
+     2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388,
+     2388, 2388,  151, 2388,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74, 2388,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74, 2388,
+      151,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+      151,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74, 2388,   74,
+       74,   74,   74,   74,   74,   74,   74,   74, 2388,   74,
+     2388,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,  151,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,  151, 2388, 2388, 2388,
+       74, 2388,   74,   74,   74, 2388,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+     2388,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74, 2388,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74, 2388,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,  151,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74, 2388,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74, 2388,   74,   74,   74,   74,   74,   74,   74,
+       74,   74, 2388,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74, 2388,   74,   74,  151,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74, 2388,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74, 2388,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74, 2388,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74, 2388,   74,   74,   74,   74,   74,   74, 2388,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74,   74, 2388,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74, 2388, 2388,   74, 2388,   74,
+       74,   74,   74, 2388,   74, 2388,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74, 2388,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74, 2388,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74, 2388,   74,   74,   74, 2388, 2388,   74,
+       74,   74,   74,   74,   74,   74,   74,   74, 2388,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74, 2388, 2388,   74,   74, 2388,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+     2388,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74, 2388,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74, 2388,
+       74,   74,   74,   74,   74,   74, 2388,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74, 2388,   74,   74,   74, 2388,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+     2388,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74, 2388, 2388,   74,
+
+       74,   74, 2388,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74, 2388,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74, 2388,   74,
+       74, 2388,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74, 2388,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74, 2388,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74, 2388,
+     2388,   74, 2388,   74,   74,   74,   74, 2388,   74, 2388,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74, 2388,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74, 2388,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74, 2388, 2388,
+       74, 2388,   74,   74,   74,   74,   74,   74,   74,   74,
+       74, 2388,   74,   74,   74,   74, 2388,   74,   74,   74,
+       74,   74,   74,   74,   74, 2388,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74, 2388,
+       74,   74,   74, 2388,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74, 2388,   74, 2388,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74, 2388,
+     2388,   74,   74,   74,   74,   74,   74,   74, 2388,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+     2388,   74,   74,   74,   74,   74,   74, 2388,   74,   74,
+       74,   74,   74,   74,   74, 2388,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74, 2388,   74,   74, 2388,   74,   74, 2388,   74,   74,
+
+     2388,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+     2388,   74,   74,   74,   74, 2388,   74,   74,   74,   74,
+       74, 2388,   74,   74,   74,   74,   74,   74, 2388, 2388,
+       74,   74,   74,   74,   74,   74,   74,   74,   74, 2388,
+     2388,   74, 2388,   74, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74, 2388,   74, 2388,   74,   74,   74,   74,   74,   74,
+     2388,   74,   74, 2388,   74,   74,   74,   74,   74,   74,
+       74,   74,   74, 2388,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+     2388,   74, 2388, 2388, 2388, 2388,   74,   74,   74,   74,
+       74, 2388,   74,   74, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74, 2388,   74,   74,   74,   74,
+       74,   74, 2388,   74,   74, 2388,   74, 2388,   74,   74,
+       74, 2388,   74,   74,   74, 2388,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74, 2388,   74,   74,   74,   74, 2388, 2388,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74, 2388, 2388,   74,
+       74,   74,   74,   74,   74,   74,   74, 2388, 2388,   74,
+       74,   74,   74, 2388, 2388,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74, 2388,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74, 2388,   74, 2388,
+       74, 2388, 2388,   74,   74,   74, 2388,   74,   74,   74,
+       74,   74,   74,   74,   74,   74, 2388,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74, 2388,   74,
+       74, 2388,   74,   74,   74, 2388, 2388,   74,   74,   74,
+       74,   74,   74, 2388,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74, 2388,   74,   74,   74,   74,
+
+       74, 2388, 2388,   74, 2388, 2388, 2388,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74, 2388,   74,   74,   74, 2388, 2388,   74,   74,   74,
+       74,   74,   74, 2388,   74,   74,   74,   74,   74, 2388,
+       74,   74, 2388, 2388,   74,   74,   74,   74,   74,   74,
+       74, 2388, 2388,   74, 2388,   74,   74,   74, 2388,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74, 2388,
+       74,   74, 2388,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+
+     2388,   74, 2388,   74,   74, 2388,   74,   74, 2388,   74,
+       74,   74,   74, 2388,   74,   74,   74, 2388,   74,   74,
+       74, 2388,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74, 2388,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74, 2388,
+       74,   74,   74,   74, 2388, 2388, 2388,   74,   74,   74,
+       74, 2388,   74,   74, 2388,   74, 2388,   74,   74,   74,
+       74,   74,   74,   74,   74, 2388,   74,   74,   74,   74,
+       74,   74,   74,   74,   74, 2388,   74, 2388,   74,   74,
+       74, 2388,   74,   74, 2388, 2388,   74,   74,   74,   74,
+
+       74,   74,   74,   74, 2388,   74, 2388,   74,   74,   74,
+       74,   74, 2388, 2388,   74, 2388,   74,   74,   74,   74,
+     2388, 2388,   74, 2388, 2388,   74,   74,   74, 2388,   74,
+     2388,   74,   74, 2388,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74, 2388, 2388,
+       74,   74,   74,   74,   74,   74,   74, 2388, 2388,   74,
+       74, 2388,   74, 2388,   74,   74,   74,   74,   74,   74,
+     2388,   74, 2388,   74,   74, 2388, 2388,   74,   74, 2388,
+     2388,   74, 2388, 2388, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+
+       74,   74,   74,   74,   74,   74,   74, 2388,   74,   74,
+       74,   74,   74,   74,   74,   74,   74, 2388, 2388, 2388,
+       74,   74,   74,   74,   74,   74,   74,   74, 2388,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74, 2388,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74, 2388,   74,   74,   74,   74,   74,
+       74,   74,   74, 2388,   74,   74,   74,   74,   74, 2388,
+     2388,   74,   74,   74, 2388,   74, 2388,    0
     } ;
 
-static yyconst flex_uint16_t yy_nxt[4269] =
+static yyconst flex_uint16_t yy_nxt[4275] =
     {   0,
-       14,   15,   16,   17,   18,   19,   18,   14,   14,   14,
-       14,   14,   18,   20,   21,   14,   22,   23,   24,   25,
-       14,   26,   27,   28,   29,   30,   31,   32,   33,   34,
-       35,   36,   37,   38,   39,   40,   14,   14,   14,   14,
-       42,   43,   44,   42,   43,   44,   47,   48,   47,   48,
-       49,   45,   49,   68,   45,   68,   68,   50,   68,   50,
-       52,   53,   54,   55,   68,   18,   52,   53,   54,   55,
-      173,   18,   56,   58,   59,   60,   69,   69,   56,   58,
-       59,   60,   70,   69,   61,   69,   71,   87,   75,   76,
-       61,   15,   16,   17,   63,   64,   65,   73,  107,   73,
-
-       73,   68,   73,   66,   69,   89,   77,   88,   73,   74,
-       69,   69,   67,   15,   16,   17,   63,   64,   65,   90,
-       69,   78,   69,   91,   69,   66,   97,   69,   79,   82,
-      147,   92,   80,   83,   67,   81,   84,   69,   85,   86,
-       69,   93,   99,  141,   94,   98,   69,  100,   70,   69,
-      104,   95,   71,   96,  105,  101,   69,   69,   69,   69,
-      146,  102,  108,   69,  114,  103,  109,  151,  115,   69,
-      106,  141,  110,  113,  118,  111,  133,  119,  116,  133,
-       69,  117,  112,   69,  120,  131,  131,  141,  121,  122,
-       69,  123,   69,  124,  126,   69,  128,  138,  138,  127,
-
-      129,  144,   69,  162,  130,  145,  152,  135,  125,  135,
-      135,   73,  135,   73,   73,  140,   73,  140,  140,   68,
-      140,   68,   68,  143,   68,   69,   73,   69,   73,   73,
-       68,   73,   69,  153,   69,  148,   69,   73,   74,  154,
-       69,  159,   69,  150,   69,   69,   69,   69,  149,   69,
-       69,   69,  155,  156,  166,  163,  161,   69,  157,  158,
-      160,  139,  167,  164,  165,  168,   69,   69,  174,  169,
-       69,   69,  170,   69,  177,  175,   69,   69,  178,   69,
-      181,   69,   69,   69,  182,  171,  172,  180,  184,   69,
-       69,  179,  183,   69,  188,  176,  185,   69,   69,   69,
-
-       69,  193,  186,   69,  190,   69,   69,  187,  191,   69,
-       69,  189,   69,   69,   69,  202,  195,  192,  194,   69,
-      197,   69,  196,  199,  203,  198,  201,  200,   69,  204,
-       69,  208,  206,   69,   69,  207,  209,   69,  211,   69,
-      131,  131,  212,  133,  214,  135,  133,  135,  135,  205,
-      135,  138,  138,  137,   69,  213,  140,  210,  140,  140,
-       73,  140,   73,   73,  141,   73,   69,  215,  217,  218,
-       69,  216,  143,   69,   69,   69,   69,   69,  219,   69,
-      225,  222,   69,  228,   69,  229,   69,  226,  224,  227,
-      221,   69,  220,  230,   69,   69,   69,  223,  231,   69,
-
-      233,   69,  238,   69,  240,  234,   69,   69,  241,   69,
-      235,  243,   69,  239,  244,  232,  236,  237,   69,   69,
-       69,   69,   69,   69,   69,  252,  245,  250,  251,  242,
-      253,  247,   69,  246,  248,   69,  259,  258,  249,  260,
-      262,  256,  254,   69,  255,   69,   69,   69,  257,   69,
-       69,  261,  265,  267,  268,  266,  263,   69,   69,   69,
-       69,   69,   69,   69,  269,   69,   69,   69,  271,   69,
-      264,  273,   69,   69,  270,  275,   69,  277,   69,   69,
-       69,   69,  276,  272,  281,  282,  284,   69,  274,  279,
-      287,  278,   69,   69,   69,   69,   69,  289,  280,   69,
-
-       69,  290,  283,  291,  295,  285,  286,   69,  294,   69,
-       69,  297,  293,  288,   69,   69,  298,   69,  292,  141,
-       69,   69,   69,   69,  304,   69,  306,  305,  296,  303,
-       69,  301,   69,  299,   69,   69,   69,  308,  300,  302,
-      307,   69,   69,   69,  311,  313,   69,   69,  314,  310,
-       69,  315,  309,  316,   69,  318,   69,   69,  319,   69,
-       69,  317,   69,  320,  323,  322,  312,   69,   69,  325,
-       69,  327,   69,  328,  321,   69,  324,   69,   69,  330,
-       69,   69,  326,  329,   69,   69,   69,  335,   69,   69,
-      331,  336,   69,   69,   69,  340,  338,  334,  332,   69,
-
-       69,   69,  333,  343,  344,   69,   69,  337,   69,   69,
-       69,  339,  342,   69,  346,   69,  351,  341,  345,  350,
-       69,  353,  347,  348,   69,  349,   69,  354,  355,  356,
-      357,   69,   69,   69,  352,  358,   69,  359,   69,  361,
-      360,   69,  362,  364,   69,  363,  365,   69,  366,   69,
-       69,   69,   69,  367,  368,  372,   69,  374,   69,   69,
-      431,   69,  369,   69,  375,   69,   69,  371,   69,   69,
-       69,  370,  378,  376,  379,  386,  373,  385,   69,  377,
-      380,  381,   69,   69,  382,   69,  383,  384,   69,   69,
-       69,   69,   69,  392,  141,  387,   69,   69,   69,  136,
-
-      403,  410,  391,  388,  390,  389,  394,   69,   69,  393,
-       69,  402,  395,  396,  404,  406,  407,   69,  409,  405,
-       69,   69,  397,  408,  398,  399,  400,   69,   69,  401,
-       69,   69,  417,   69,   69,  415,   69,   69,   69,  421,
-      411,  412,   69,  414,   69,   69,  416,  413,  419,  424,
-       69,  420,   69,  418,  425,  426,   69,   69,  423,  422,
-       69,   69,   69,   69,   69,  432,  433,   69,  428,   69,
-      427,   69,  429,  134,  430,   69,  437,  436,  440,   69,
-      441,  434,  435,  442,   69,  444,   69,  438,   69,  439,
-      447,   69,  445,  443,  446,   69,   69,   69,  450,   69,
-
-      448,   69,   69,  453,  451,  454,   69,   69,   69,   69,
-      455,   69,   69,  457,  452,   69,  449,   69,  458,   69,
-      462,  461,   69,   69,  459,   69,   69,  460,  456,   69,
-      463,   69,  465,   69,  466,  469,   69,  468,   69,   69,
-       69,   69,  476,  464,  467,   69,   69,   69,   69,   69,
-      471,  478,  482,   69,  477,  475,  470,  472,   69,  473,
-      474,  479,  481,  483,   69,   69,  480,  485,   69,   69,
-      486,   69,   69,   69,   69,   69,  489,   69,   69,  491,
-       69,   69,   69,   69,  503,  132,  487,  484,  490,   69,
-       69,  492,  488,  511,  502,  504,  493,   69,  494,   69,
-
-      500,  501,  505,  495,   69,  496,   69,  507,  508,  506,
-       69,  509,   69,  497,   69,   69,  498,   69,   69,  510,
-       69,   69,  515,  499,   69,   69,  141,  512,  521,  516,
-      520,  519,   69,  513,   69,   69,  523,  514,   69,  518,
-      517,  526,   69,  527,  522,   69,  525,  529,  524,   69,
-       69,   69,   69,   69,  531,   69,   69,  528,   69,  534,
-      533,   69,  530,   69,  538,   69,   69,  532,   69,  539,
-       69,  541,   69,  548,  535,  542,   69,  536,  540,  537,
-      543,  544,   69,  545,   69,  546,   69,  547,   69,   69,
-       69,   69,  552,   69,  551,   69,   69,  550,   69,  553,
-
-       69,  555,  557,   69,   69,   69,   69,  549,   69,  558,
-       69,  554,   69,  560,   69,  564,   69,  559,  561,   69,
-      556,  566,  562,  563,  565,   69,  568,  569,  570,   69,
-      567,   69,  571,   69,   69,  572,   69,   69,   69,  574,
-       69,  575,   69,   69,   69,  578,   69,   69,  582,   69,
-      584,  577,  579,  576,   69,  583,  581,  573,  580,   69,
-       69,   69,  585,  589,  587,  586,   69,  591,   69,   69,
-       69,  590,   69,   69,   69,  588,   69,  592,  594,   69,
-      598,  593,   69,  595,   69,  596,   69,  599,   69,   69,
-       69,  600,  597,  601,  604,  608,  605,   69,  607,   69,
-
-      603,  606,   69,   69,   69,  609,  611,   69,  602,   69,
-       69,   69,   69,   69,   69,   69,  616,   69,  610,   69,
-      622,   69,  617,   69,   69,  612,   69,  613,  626,  614,
-      618,  615,  619,   69,  621,   69,  620,   69,  625,   69,
-      623,   69,  624,   69,  627,   69,  628,   69,   69,   69,
-       69,  629,  632,  633,  634,  635,  631,   69,  630,   69,
-       69,   69,  636,   69,   69,  141,  638,  637,   69,  639,
-      642,  643,  641,   69,   69,  640,   69,  644,   69,  646,
-      650,   69,   69,  648,   69,  645,   69,  647,  652,   69,
-      655,   69,   69,   69,  653,  649,   69,   69,   69,  656,
-
-       69,  651,   69,   69,   69,  660,   69,  654,   69,  661,
-      657,  667,  662,  665,  668,   69,  670,  659,  658,  663,
-      666,   69,  664,   69,  671,  669,  672,  681,   69,  683,
-       69,   69,   69,   69,  673,  674,  680,  675,   69,  718,
-      676,  684,  685,   69,   69,  677,  682,   69,   69,  687,
-       69,  678,  679,   69,  686,   69,  689,   69,  690,  688,
-      691,   69,   69,   69,  693,   69,  692,   69,   69,  695,
-       69,  699,   69,   69,   69,  694,  698,   69,   69,  705,
-       69,   69,  141,  704,  709,  696,  697,  700,  701,  703,
-       69,  702,  707,  708,   69,  706,   69,   69,   69,   69,
-
-      710,   69,   69,   69,  711,  712,   69,  714,  717,   69,
-      715,  720,   69,   69,   69,   69,   69,   69,   69,  713,
-      719,  724,   69,  722,  723,  716,   69,  725,   69,  727,
-      726,   69,  721,   69,   69,   69,   69,  731,  733,   69,
-      729,  728,  734,   69,  736,  732,   69,   69,   69,   69,
-       69,   69,   69,   69,   69,  742,  735,  730,  741,   69,
-       69,  745,   69,  749,   69,  748,   69,  737,  738,  739,
-      740,  743,  746,  744,   69,  752,  747,  753,   69,   69,
-       69,   69,  754,   69,   69,   69,  750,  761,  751,  758,
-       69,  760,  756,   69,   69,   69,   69,  762,  755,  765,
-
-      757,   69,  767,   69,   69,   69,  759,  769,  141,  764,
-       69,   69,   69,  763,   69,  771,   69,   69,   69,   69,
-      783,  766,  768,   69,  139,  770,   69,  784,   69,   69,
-      774,  772,   69,  787,   69,   69,   69,  775,  773,  776,
-       69,  785,  802,  777,  830,  778,   69,  788,  790,  779,
-       69,  780,  791,  786,   69,  789,  781,  792,   69,   69,
-      793,  782,   69,  794,   69,   69,   69,  796,   69,  795,
-      798,  804,   69,  803,   69,  805,   69,  797,  799,   69,
-       69,  812,  801,   69,  806,   69,  811,  800,   69,  807,
-       69,  808,   69,  815,   69,  816,   69,   69,   69,  813,
-
-      814,   69,  809,   69,  817,  821,   69,  822,  818,  810,
-       69,   69,  823,  824,   69,  827,  819,  820,   69,  828,
-      825,   69,   69,   69,  826,   69,   69,   69,   69,   69,
-       69,   69,  831,  835,  833,   69,   69,  841,   69,   69,
-       69,  829,  832,   69,  837,  839,  834,  840,   69,  836,
-       69,  838,   69,  842,  843,  846,   69,  847,  844,   69,
-      851,  848,   69,  845,   69,  850,   69,   69,  849,   69,
-      856,  854,   69,  857,   69,  852,  855,   69,   69,  862,
-       69,  858,   69,  853,   69,   69,  859,  864,   69,   69,
-      137,   69,   69,   69,  860,  861,  866,  868,  869,   69,
-
-       69,   69,  863,   69,   69,  867,  871,  874,   69,  865,
-      873,  870,  875,   69,   69,   69,   69,  872,  877,   69,
-       69,  882,   69,   69,   69,   69,   69,   69,  883,  884,
-       69,  876,  878,  881,   69,  879,  887,  886,  888,  880,
-      885,  889,  890,   69,   69,  891,   69,   69,   69,  892,
-      893,   69,   69,  897,   69,   69,   69,   69,   69,   69,
-      895,   69,  894,  906,  896,  899,   69,   69,   69,   69,
-      907,   69,  898,  908,  900,  903,   69,   69,  902,  909,
-       69,  904,   69,  901,   69,  910,   69,  905,   69,   69,
-      915,  913,   69,   69,  919,   69,  911,   69,  912,  916,
-
-       69,   69,   69,  914,  917,   69,   69,  922,   69,  927,
-      924,  920,  918,  929,   69,   69,   69,   69,  921,  928,
-      931,  925,  923,   69,  926,   69,   69,   69,   69,  930,
-      934,   69,  933,  936,  932,  938,   69,   69,   69,   69,
-      940,  939,   69,   69,   69,  935,  937,   69,   69,   69,
-      944,   69,   69,  941,   69,   69,  945,  943,  942,   69,
-      949,   69,  990,   69,   69,   69,  946,  948,  953,  947,
-      950,  951,  952,  954,   69,  955,   69,  959,   69,   69,
-      960,  958,  956,  957,   69,  961,   69,   69,   69,  965,
-       69,   69,   69,  968,   69,  969,  970,  962,  963,   69,
-
-      964,  967,   69,  966,   69,   69,   69,  974,   69,  972,
-      973,  971,   69,   69,   69,   69,  980,  981,  977,   69,
-       69,  976,   69,   69,  982,   69,   69,   69,  975,  978,
-      983,  991,  979,   69,  984,   69,  989,  992,   69,  985,
-       69,  986,  993,  987,   69,  988,  996,   69,   69,  995,
-       69,  997,   69,   69,   69,   69,  994,  999,  998,   69,
-       69, 1001,   69,   69, 1002,   69, 1000, 1007, 1003, 1004,
-     1008,   69,   69, 1005, 1010,   69,   69, 1012, 1009, 1011,
-       69, 1014,   69,   69, 1006, 1015, 1016,   69, 1017,   69,
-     1019,   69,   69,   69,   69,   69,   69, 1024, 1021, 1013,
-
-     1023,   69, 1022,   69,   69,   69,   69, 1029, 1030, 1026,
-     1018, 1027, 1020,   69,   69,   69, 1032,   69, 1028, 1025,
-     1031,   69,   69, 1036,   69, 1034, 1033,   69,   69,   69,
-     1040,   69, 1035,   69,   69,   69,   69,   69,   69, 1047,
-       69,   69,   69,   69,  136, 1041, 1044, 1037, 1038, 1045,
-       69, 1042, 1039, 1043,   69, 1046, 1052,   69,   69, 1051,
-     1048, 1050, 1056, 1054,   69, 1053, 1049, 1057,   69, 1055,
-       69,   69,   69, 1058,   69,   69, 1066, 1064, 1059, 1063,
-       69,   69,   69,   69,   69, 1060,   69, 1061, 1067,   69,
-     1062,   69, 1068,   69, 1065,   69, 1072,   69,   69,   69,
-
-       69, 1075, 1069,   69,   69,   69,   69, 1071,   69,   69,
-     1088, 1073, 1070, 1083, 1079, 1074, 1076, 1078, 1077, 1080,
-       69, 1081, 1082,   69,   69,   69,   69, 1084, 1085,   69,
-       69,   69, 1093, 1094, 1087, 1090, 1092,   69,   69,   69,
-       69, 1089, 1086,   69, 1095,   69, 1096, 1097,   69,   69,
-       69, 1091,   69, 1098, 1102, 1100,   69, 1101, 1104, 1099,
-     1106,   69,  134, 1105,   69, 1107,   69,   69,   69,   69,
-     1112,   69,   69,   69, 1116, 1103,   69,   69,   69, 1115,
-       69, 1108,   69,   69,   69,   69, 1109, 1110, 1111,   69,
-      132, 1114, 1121,   69, 1124,   69, 1117, 1113, 1125,   69,
-
-       69, 1118, 1119, 1120, 1123, 1128, 1122, 1127,   69,   69,
-       69, 1126,   69, 1129,   69,   69,   69,   69, 1133, 1138,
-       69, 1131, 1134, 1130,   69,   69,   69, 1132,   69, 1139,
-     1140, 1137,   69, 1144,   69, 1135,   69, 1136,   69,   69,
-     1145,   69,   69, 1147, 1149, 1141, 1142,   69, 1148,   69,
-       69,   69, 1143,   69, 1146, 1150,   69, 1151,   69,   69,
-       69, 1154, 1153,   69,   69, 1152, 1155, 1156, 1159, 1158,
-     1160,   69,   69,   69,   69, 1163, 1161, 1157,   69,   69,
-       69,   69,   69,   69, 1166,   69, 1168, 1169,   69,   69,
-     1165,   69, 1172, 1162, 1173,   69,   69, 1171,   69,   69,
-
-     1164, 1167,   69, 1170, 1177,   69,   69, 1176, 1179,   69,
-     1180, 1181, 1183,   69,   69, 1174, 1175,   69,   69, 1185,
-       69,   69, 1178,   69,   69,   69, 1189, 1184,   69, 1182,
-     1187,   69, 1190, 1186,   69,   69,   69, 1193, 1199, 2149,
-       69, 1191,   69, 1192,   69, 1188,   69, 1194,   69, 1196,
-       69, 1201, 1197, 1200,   69, 1202, 1195, 1204,   69, 1206,
-     1205,   69,   69,   69, 1198, 1203,   69, 1210,   69,   69,
-     1212,   69,   69,   69, 1211,   69,   69, 1214,   69, 1207,
-     1216, 1208,   69, 1209, 1215,   69,   69,   69, 1224, 1217,
-       69, 1213,   69,   69,   69,   69,   69,   69, 1218,   69,
-
-     1220, 1221, 1219, 1223, 1222, 1229,   69,   69,   69,   69,
-     1227,   69, 1231, 1225,   69, 1226, 1233,   69, 1228, 1230,
-       69, 1240,   69, 1232, 1241,   69, 1234, 1236,   69, 1235,
-       69, 1242,   69,   69,   69, 1237,   69, 1244,   69, 1239,
-     1238,   69, 1246, 2149,   69, 1251,   69, 1250,   69, 1243,
-     1245,   69,   69, 1248,   69, 1247, 1249, 1252,   69, 1254,
-       69, 1253,   69,   69, 1258,   69, 1255,   69, 1256,   69,
-     1261,   69,   69,   69, 1263, 2149, 1257, 1264,   69, 1265,
-       69, 1260, 1267, 1262, 1272, 1268, 1270, 1259, 1274, 1269,
-       69, 1271,   69, 1266,   69,   69, 1276,   69, 1273,   69,
-
-     1275, 1279,   69, 1277,   69,   69,   69,   69, 1281,   69,
-       69,   69,   69,   69, 1282, 1288,   69, 1280, 1284, 1278,
-       69,   69, 1285, 1291,   69, 1283,   69,   69,   69, 1286,
-     1293, 1287, 1289, 1292,   69,   69,   69, 1297, 1290, 1294,
-     1295, 1296,   69, 1300,   69,   69,   69,   69,   69,   69,
-     1298,   69, 1307, 1302,   69,   69,   69, 1299,   69, 1301,
-     1303, 1304, 1310, 1311,   69,   69, 1305, 1308, 1312, 1313,
-       69, 1306, 1309,   69,   69, 1316,   69,   69, 1314,   69,
-       69, 1318,   69, 1315,   69,   69,   69,   69,   69, 1317,
-     1322,   69,   69,   69,   69, 1323, 1326, 1331,   69, 1324,
-
-     1319, 1327, 1321, 1325, 1320, 1332,   69,   69,   69, 1330,
-       69,   69,   69, 1329, 1328, 1336,   69, 1338,   69, 1340,
-       69,   69,   69, 1342,   69, 1341, 1334, 1333, 1335,   69,
-     1337,   69, 1344, 1339, 1343, 1346,   69,   69,   69, 1348,
-     1345,   69, 1349,   69,   69, 1350, 1351,   69,   69, 1347,
-     1358,   69,   69,   69,   69,   69,   69, 1356, 1360, 1352,
-     1353, 1354,   69, 1361,   69,   69, 1355, 1362, 1357, 1364,
-       69, 1359,   69, 1366,   69, 1363,   69, 1369, 1370,   69,
-       69, 1365, 1367, 1371, 1373,   69,   69, 1368,   69,   69,
-       69,   69, 1378, 1375,   69,   69, 2149,   69, 1376, 1382,
-
-       69, 1372, 1381, 1374,   69,   69, 1385, 1384, 1386, 1387,
-       69, 1380,   69,   69,   69,   69, 1377,   69, 1388,   69,
-     1379,   69,   69,   69, 1383, 1393, 1389,   69,   69, 1396,
-       69,   69,   69, 1392,   69, 1390, 1398,   69, 1391,   69,
-       69, 1394,   69, 1403,   69, 1397, 1404, 1406,   69, 1401,
-     1400, 1405, 1399, 1395,   69, 1407, 1402, 1409,   69,   69,
-     1408,   69, 1413, 1414,   69, 1415, 1417,   69,   69,   69,
-     1416,   69,   69, 1411,   69, 1410, 1420,   69,   69,   69,
-       69, 1412,   69, 1422,   69, 1425, 1419,   69, 1430, 1421,
-     1423,   69, 1427, 1418, 1424,   69, 1428,   69,   69, 2149,
-
-     1429, 1434, 1426, 1431,   69, 1432,   69,   69,   69,   69,
-       69,   69,   69,   69, 1435, 1433, 1436,   69, 1437, 1438,
-       69, 1441, 1439, 1440,   69, 1442, 1444,   69,   69,   69,
-     1447,   69,   69,   69, 1446,   69, 1443, 1445,   69,   69,
-       69, 1454, 1449, 1452,   69, 1453,   69,   69,   69, 1456,
-       69,   69, 1448, 1450,   69, 1461,   69, 1451, 1455, 1459,
-     1457,   69, 1465, 1460, 1458,   69,   69, 1462,   69,   69,
-     1467,   69,   69, 1468, 1469,   69, 1463,   69,   69, 1464,
-     1470,   69, 1473, 1466, 1471,   69,   69,   69,   69,   69,
-       69,   69,   69,   69, 1474,   69,   69, 1486, 1472, 1476,
-
-     1477, 1478, 1481,   69,   69,   69, 1480, 1475, 1485,   69,
-     1488,   69, 1483, 1484,   69, 1482, 1479,   69, 1489, 1491,
-       69,   69, 1487, 1490, 1493,   69, 1495,   69,   69, 1496,
-       69,   69,   69, 1497, 1492, 1494, 1498, 1501,   69,   69,
-       69,   69,   69,   69, 1502, 1507,   69,   69, 1499, 1504,
-       69, 1503, 1500,   69, 1508, 1511, 1506,   69,   69, 1505,
-       69,   69, 1509, 1512,   69,   69, 1513,   69, 1515, 1514,
-     1510,   69, 1516,   69, 1517, 1519,   69, 1518, 1521,   69,
-       69, 1520,   69,   69,   69, 1522,   69, 1524, 1525,   69,
-       69,   69, 1523,   69,   69,   69, 1530, 1526,   69,   69,
-
-     1531, 1535,   69,   69, 1537,   69, 1527, 1528, 1534, 1529,
-     1532,   69, 1536,   69,   69, 1539, 1533, 1538, 1540, 1542,
-       69,   69, 1546,   69, 1543,   69,   69, 1541, 1544,   69,
-     1549,   69,   69, 1550,   69, 1548,   69, 1553, 1555,   69,
-       69, 1545,   69,   69, 1547, 1554, 1551, 1556,   69,   69,
-       69,   69, 1557,   69, 1552,   69, 1560,   69,   69,   69,
-     1566,   69, 1563,   69,   69,   69,   69, 1567,   69, 1558,
-     1562, 1569,   69,   69, 1565, 1559, 1561, 1564,   69, 1568,
-       69,   69,   69,   69,   69,   69,   69, 1571, 1580,   69,
-     1620, 1570, 1572, 1577,   69, 1573,   69, 1581, 1583, 1575,
-
-     1579,   69, 1574, 1576, 1578,   69, 1585, 1586,   69, 1582,
-     1587,   69,   69,   69, 1584,   69, 1590, 1593,   69,   69,
-     1594,   69, 1595,   69,   69,   69, 1589, 1588, 1591, 1597,
-       69, 1592,   69, 1599,   69, 1600,   69,   69,   69, 1601,
-       69, 1604,   69, 1596,   69, 1603, 1606,   69,   69,   69,
-     1598,   69, 1609,   69, 1608,   69, 1602, 1605,   69, 1610,
-     1612,   69, 1607,   69, 1616,   69,   69,   69, 1614,   69,
-     1613, 1621,   69,   69, 1611, 1617, 1623,   69,   69,   69,
-       69, 1627, 1615,   69, 1619, 1625, 1622,   69,   69, 1618,
-     1629,   69, 1628, 1624,   69,   69, 1631,   69,   69, 1630,
-
-       69,   69,   69, 1635,   69, 1626, 1636,   69, 1633,   69,
-     1641, 1638,   69, 1639,   69, 1637,   69,   69, 1634, 1632,
-       69, 1640, 1646, 1644, 1642,   69, 1645,   69,   69, 1643,
-       69, 1647, 1649, 1653, 1650,   69,   69,   69,   69, 1648,
-     1655,   69, 1651, 1656, 1652,   69, 1659,   69, 1654, 1660,
-       69,   69, 1662, 1663,   69,   69, 1661, 1658,   69,   69,
-     1665, 1657,   69,   69,   69,   69, 1669,   69,   69, 1664,
-       69, 1670,   69, 1671, 1666, 1672,   69, 1667,   69,   69,
-       69,   69, 1677, 1668, 1673,   69,   69, 1680, 1674,   69,
-     1679,   69, 1675,   69, 1676, 1681,   69,   69,   69, 1685,
-
-       69, 1678, 1684,   69, 1682,   69, 1686, 1683,   69, 1699,
-     1687,   69, 1689,   69, 1688,   69, 1690,   69, 1692, 1693,
-       69, 1694, 1691,   69,   69, 1697,   69,   69, 1695, 1696,
-     1698,   69,   69, 1700,   69,   69,   69,   69, 1706,   69,
-     1703,   69, 1708, 1701,   69,   69, 1711,   69,   69, 1705,
-     1707,   69, 1712, 1713,   69, 1704, 1702,   69,   69, 1715,
-     1710,   69, 1709, 1714,   69,   69, 1719,   69, 1720,   69,
-     1718, 1721,   69,   69,   69, 1716,   69, 1724, 1717,   69,
-       69,   69,   69,   69,   69, 1722, 1730,   69, 1728,   69,
-       69, 1725, 1723, 1726, 1727,   69,   69,   69, 1731,   69,
-
-     1729,   69, 1737, 1734,   69,   69,   69,   69, 1738, 1741,
-     1732, 1736, 1742,   69,   69, 1733, 1744,   69, 1743,   69,
-     1735,   69, 1739, 1745,   69,   69, 1746, 1740,   69,   69,
-     1748,   69, 1747,   69,   69,   69, 1756,   69, 1757,   69,
-     1753, 1749,   69,   69,   69,   69, 1750,   69,   69,   69,
-       69, 1751, 1758, 1752, 1754, 1755, 1760, 1766,   69, 1761,
-     1759, 1767,   69, 1762, 1764, 1763, 1768,   69,   69, 1765,
-       69,   69,   69,   69,   69,   69, 1772,   69,   69, 1776,
-     1775,   69,   69, 1770,   69, 1769,   69, 1777,   69, 1771,
-       69, 1781,   69, 1773, 1774, 1782,   69, 1785,   69, 1789,
-
-       69, 1778, 1780, 1779, 1784, 1783,   69, 1787,   69,   69,
-     1786,   69, 1788, 1791,   69, 1792,   69, 1794,   69,   69,
-     1796,   69, 1790,   69, 1795,   69, 1797,   69,   69,   69,
-     1793,   69,   69,   69, 1801,   69, 1802, 1800,   69,   69,
-     1799, 1804,   69, 1806, 1807, 1798, 1809,   69, 1810,   69,
-     1805, 1803,   69,   69, 1813,   69,   69, 1808, 1812, 1811,
-       69, 1814, 1816,   69, 1817,   69,   69, 1819, 2149,   69,
-     1815, 1822, 1820,   69, 1821,   69,   69,   69,   69, 1818,
-     1823,   69,   69, 1824, 1825,   69,   69,   69,   69,   69,
-     1827, 1828, 1830, 1831,   69,   69, 1826, 1829,   69,   69,
-
-       69, 1836,   69,   69, 1834, 1832,   69, 1833, 1835, 1841,
-       69, 1837,   69,   69,   69, 1845,   69, 1838,   69,   69,
-       69, 1848, 1843, 1839, 1847, 1840,   69,   69, 1852, 1844,
-       69, 1842, 1849,   69, 1850, 1851,   69, 1846,   69,   69,
-       69,   69, 1854,   69, 1857, 1858,   69,   69, 1869, 1853,
-       69, 1861,   69, 1855,   69, 1856, 1862,   69,   69,   69,
-       69, 1859, 1863, 1864,   69, 1865,   69, 1860, 1866,   69,
-     1867,   69, 1868, 1870,   69, 1871, 1872,   69,   69, 1876,
-     1879, 1873,   69, 1874, 1875,   69,   69,   69,   69,   69,
-     1877,   69, 1878,   69,   69,   69, 1883, 1887,   69,   69,
-
-       69,   69,   69, 1891,   69, 1892, 1881, 1882, 1889, 1886,
-       69, 1884,   69, 1880, 1885,   69, 1893, 1895, 1888,   69,
-     1890,   69,   69,   69,   69, 2149, 1894, 1901,   69,   69,
-       69, 1898, 1902, 1904,   69,   69,   69,   69,   69, 1896,
-     1905, 1908,   69, 1899, 1900, 1906,   69, 1897, 1903,   69,
-     1909, 1912,   69, 1911,   69, 1907, 1913,   69, 1910, 1916,
-       69,   69,   69, 1915,   69, 1914,   69,   69, 1921,   69,
-     1917, 1920,   69,   69, 1918,   69, 1924, 1923, 1922, 1925,
-     1926,   69, 1927,   69,   69,   69, 1930,   69,   69, 1919,
-     1929,   69,   69, 1931, 1932,   69, 1934,   69, 1936, 1938,
-
-       69,   69,   69, 1928,   69, 1933, 1941,   69,   69,   69,
-       69,   69, 1937, 1943,   69, 1935,   69, 1940,   69, 1944,
-     1939, 1942,   69, 1948, 1947, 1950,   69, 1945,   69, 1952,
-       69, 1953,   69, 1946, 1954,   69,   69,   69, 1957,   69,
-       69,   69, 1956,   69,   69, 1961,   69, 1951, 1949,   69,
-     1964,   69, 1955, 1965,   69,   69,   69,   69, 1969,   69,
-     1958,   69, 1960, 1962, 1959,   69, 1971,   69, 1963, 1967,
-     1970,   69,   69, 1972, 1966, 1975, 1968, 1974,   69,   69,
-       69,   69, 1979, 2149,   69, 1977, 1982,   69,   69, 1983,
-       69, 1973,   69, 1985,   69,   69,   69, 1976,   69,   69,
-
-     1978, 1980, 1981, 1986, 1988, 1989,   69, 1990,   69, 1987,
-       69, 1984, 1991,   69,   69, 1992, 1993,   69, 1994,   69,
-     1995, 1996,   69,   69,   69, 2000,   69,   69, 1997,   69,
-     2003,   69, 2001, 1999,   69,   69,   69, 2002,   69, 2004,
-       69,   69,   69, 1998,   69, 2007,   69,   69,   69, 2009,
-     2008,   69,   69, 2018,   69, 2005, 2006, 2016, 2019,   69,
-     2012,   69, 2010,   69, 2011, 2013, 2014, 2020, 2015, 2021,
-       69, 2017, 2022, 2023,   69,   69, 2025,   69, 2024, 2026,
-       69, 2028,   69,   69,   69,   69,   69,   69, 2032, 2033,
-       69, 2034,   69,   69, 2027, 2031,   69,   69, 2029, 2036,
-
-       69, 2035, 2030,   69,   69, 2149,   69, 2149, 2038, 2040,
-     2037, 2041, 2043,   69, 2044,   69, 2045,   69, 2039, 2046,
-       69,   69, 2042, 2047,   69, 2049,   69,   69,   69, 2051,
-     2048,   69, 2053,   69,   69, 2055,   69, 2054,   69, 2050,
-       69,   69,   69, 2057,   69,   69, 2052, 2061,   69,   69,
-     2056,   69, 2062,   69,   69,   69,   69,   69,   69, 2058,
-     2059, 2060,   69,   69, 2065, 2064,   69, 2066, 2077, 2063,
-     2073,   69, 2069,   69, 2067, 2068,   69, 2071, 2075,   69,
-     2076,   69, 2074, 2070,   69,   69, 2072, 2081,   69, 2078,
-     2083,   69,   69,   69,   69,   69,   69, 2086, 2087,   69,
-
-     2080, 2079, 2082,   69,   69,   69,   69, 2084,   69, 2088,
-       69,   69, 2089, 2085,   69, 2090,   69,   69, 2149, 2091,
-     2149, 2093, 2096, 2094,   69, 2092,   69, 2099,   69, 2097,
-     2095,   69,   69, 2098,   69, 2103, 2100, 2101, 2104, 2102,
-     2105,   69,   69,   69,   69, 2109,   69, 2107,   69, 2106,
-       69,   69,   69,   69,   69, 2112,   69, 2116,   69,   69,
-       69, 2111, 2108, 2117, 2149, 2110,   69, 2115,   69, 2119,
-       69, 2113, 2114,   69, 2120, 2121,   69,   69, 2118, 2123,
-     2124,   69,   69, 2122, 2125, 2127,   69,   69,   69, 2126,
-       69, 2128,   69, 2130,   69, 2131,   69, 2134,   69,   69,
-
-       69, 2137, 2138,   69,   69,   69, 2129, 2140,   69, 2141,
-       69, 2132, 2139, 2133,   69,   69,   69, 2135, 2136,   69,
-     2143, 2142, 2149, 2145, 2144, 2147,   69, 2148,   69, 2149,
-     2149, 2149, 2149, 2149, 2149, 2146,   41,   41,   41,   41,
-       41,   41,   41,   46,   46,   46,   46,   46,   46,   46,
-       51,   51,   51,   51,   51,   51,   51,   57,   57,   57,
-       57,   57,   57,   57,   62,   62,   62,   62,   62,   62,
-       62,   72,   72, 2149,   72,   72,   72,   72,  131,  131,
-     2149, 2149, 2149,  131,  131,  133,  133, 2149, 2149,  133,
-     2149,  133,  135, 2149, 2149, 2149, 2149, 2149,  135,  138,
-
-      138, 2149, 2149, 2149,  138,  138,  140, 2149, 2149, 2149,
-     2149, 2149,  140,  142,  142, 2149,  142,  142,  142,  142,
-       73,   73, 2149,   73,   73,   73,   73,   13, 2149, 2149,
-     2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149,
-     2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149,
-     2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149,
-     2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149
+        0,   27,   14,   41,   39,   40,   17,   40,   27,   27,
+       27,   27,   27,   40,   38,   19,   27,   23,   15,   28,
+       29,   27,   30,   18,   31,   22,   32,   26,   33,   34,
+       35,   25,   16,   20,   21,   24,   36,   27,   37,   27,
+       27,   27,   14,   41,   39,   40,   17,   40,   27,   27,
+       27,   27,   27,   40,   38,   19,   27,   23,   15,   28,
+       29,   27,   30,   18,   31,   22,   32,   26,   33,   34,
+       35,   25,   16,   20,   21,   24,   36,   27,   37,   27,
+       27,   42,   42,   46,   43,   44,   42,   42,   42,   42,
+       42,   42,   42,   42,   45,   42,   42,   42,   42,   42,
+
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   46,   43,   44,   42,   42,   42,   42,
+       42,   42,   42,   42,   45,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   51,   51,   48,   49,   51,   51,   50,   51,   51,
+       51,   51,   51,   51,   47,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+
+       51,   51,   51,   48,   49,   51,   51,   50,   51,   51,
+       51,   51,   51,   51,   47,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   55,   57,   52,   53,   54,   55,   40,   55,   55,
+       55,   55,   55,   55,   56,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   57,   52,   53,   54,   55,   40,   55,   55,
+       55,   55,   55,   55,   56,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   58,   58,   62,   59,   60,   58,   58,   58,   58,
+       58,   58,   58,   58,   61,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   62,   59,   60,   58,   58,   58,   58,
+       58,   58,   58,   58,   61,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+
+       58,   65,   14,   41,   39,   64,   63,   67,   65,   65,
+       65,   65,   65,   65,   68,   65,   65,   65,   65,   65,
+       65,   65,   65,   66,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   14,   41,   39,   64,   63,   67,   65,   65,
+       65,   65,   65,   65,   68,   65,   65,   65,   65,   65,
+       65,   65,   65,   66,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   13,  101,   69,   13,   74,  108,   70,  107,  109,
+       74,  106,   74,   74,   74,   74,   74,  120,   77,   74,
+
+       74,   74,   74,   75,   74,   74,   74,   73,   74,   74,
+       76,   74,   72,   71,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   79,  121,  125,   87,   81,
+      134,   88,   13,  132,  145,  153,  157,  133,   86,   78,
+       85,  131,   80,   13,   82,   84,  162,   84,   84,   82,
+       84,   82,   82,   82,   82,   82,   84,   83,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   13,   74,  159,  158,  163,  164,
+       74,  160,   74,   74,   74,   74,   74,  161,   77,   74,
+
+       74,   90,   89,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   91,   74,   74,   74,   74,   74,   74,   92,
+       74,   74,   74,   74,   74,   93,  165,  100,   95,   99,
+      122,  169,  174,  175,  123,   97,  167,   13,   74,   96,
+       94,  176,  166,   74,   98,   74,   74,   74,   74,   74,
+      124,   77,  102,   74,   74,   74,   74,   74,   74,  104,
+       74,   74,   74,  105,   74,   74,  103,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,  110,  177,
+      178,  179,  184,  155,  181,  185,  112,  186,  180,   13,
+       74,  187,  113,  188,  189,   74,  111,   74,   74,   74,
+
+       74,   74,  156,   77,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       13,   74,  194,  195,  196,  197,   74,  198,   74,   74,
+       74,   74,   74,  199,   77,   74,   74,   74,  114,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,  115,   74,
+       74,   13,   74,  202,  203,  204,  205,   74,  206,   74,
+       74,   74,   74,   74,  207,   77,  117,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+      116,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   13,   74,  208,  209,  210,  211,   74,  212,
+       74,   74,   74,   74,   74,  213,   77,  118,   74,   74,
+       74,   74,   74,   74,   74,  119,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,  127,  192,  214,  216,  129,  217,  215,
+      218,  219,  222,  130,  220,  223,  126,  193,  221,  224,
+       13,  135,  135,  128,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,   13,  136,  136,  225,  226,  227,  136,  136,  136,
+      136,  136,  136,  136,  136,  137,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,   13,  141,  141,  228,  229,  141,  141,  231,
+      141,  141,  141,  141,  141,  141,  140,  141,  141,  141,
+      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+      141,  141,  141,   13,  142,   13,  237,  145,  241,  142,
+
+      242,  142,  142,  142,  142,  142,  142,  143,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,   13,  146,  146,  243,  246,  247,
+      146,  146,  146,  146,  146,  146,  146,  146,  147,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,   13,  151,  248,  249,  250,
+      251,  151,  258,  151,  151,  151,  151,  151,  151,  152,
+      151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+
+      151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,   13,   74,  257,  259,
+      260,  256,   74,  261,   74,   74,   74,   74,   74,  262,
+       77,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   13,  135,  135,
+      263,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,   13,   82,
+
+       84,  264,   84,   84,   82,   84,   82,   82,   82,   82,
+       82,   84,   83,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   13,
+      168,  168,  265,  168,  168,  168,  168,  168,  168,  168,
+      168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+      168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+      168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+       13,   84,   84,  266,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,  170,  183,  190,  172,  200,  245,  267,  268,  269,
+      240,  270,  271,  244,  272,  239,  275,  173,  171,   13,
+       74,  276,  182,  191,  277,   74,  201,   74,   74,   74,
+       74,   74,  238,   77,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       13,  136,  136,  273,  274,  278,  136,  136,  136,  136,
+      136,  136,  136,  136,  137,  136,  136,  136,  136,  136,
+
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,   13,  138,  138,  279,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,   13,  136,  136,  280,  281,  282,  136,  136,
+      136,  136,  136,  136,  136,  136,  137,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+
+      136,  136,  136,   13,  141,  141,  283,  284,  141,  141,
+      285,  141,  141,  141,  141,  141,  141,  140,  141,  141,
+      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+      141,  141,  141,  141,   13,  139,  139,  288,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,   13,  141,  141,  289,  290,
+      141,  141,  291,  141,  141,  141,  141,  141,  141,  140,
+
+      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+      141,  141,  141,  141,  141,  141,   13,  142,  292,  293,
+      294,  295,  142,  296,  142,  142,  142,  142,  142,  142,
+      143,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,   13,  144,  144,
+      297,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+
+      144,  144,  144,  144,  144,  144,  144,  144,   13,  142,
+      298,  299,  300,  301,  142,  302,  142,  142,  142,  142,
+      142,  142,  143,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,   13,
+      146,  146,  303,  306,  307,  146,  146,  146,  146,  146,
+      146,  146,  146,  147,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+       13,  148,  148,  308,  148,  148,  148,  148,  148,  148,
+
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,   13,  146,  146,  309,  310,  311,  146,  146,  146,
+      146,  146,  146,  146,  146,  147,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,   13,  149,   84,  312,   84,   84,  149,   84,
+      149,  149,  149,  149,  149,  149,  150,  149,  149,  149,
+      149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+
+      149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+      149,  149,  149,   13,  230,  230,  313,  230,  230,  230,
+      230,  230,  230,  230,  230,  230,  230,  230,  230,  230,
+      230,  230,  230,  230,  230,  230,  230,  230,  230,  230,
+      230,  230,  230,  230,  230,  230,  230,  230,  230,  230,
+      230,  230,  230,  230,   13,  151,  314,  315,  316,  317,
+      151,  320,  151,  151,  151,  151,  151,  151,  152,  151,
+      151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,   13,  154,  154,  321,  154,
+
+      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,   13,  151,  322,  323,
+      324,  325,  151,  326,  151,  151,  151,  151,  151,  151,
+      152,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,  151,  236,  304,  327,
+      328,  318,  232,  329,  330,  331,  332,  234,  333,  334,
+      305,  335,  336,  233,  235,   13,   82,   84,  319,   84,
+
+       84,   82,   84,   82,   82,   82,   82,   82,   84,   83,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,  254,  286,  337,  338,
+      339,  255,  340,  341,  342,  343,  344,  345,  346,  347,
+      348,  349,  350,  253,  351,  252,  352,  353,   13,  149,
+       84,  287,   84,   84,  149,   84,  149,  149,  149,  149,
+      149,  149,  150,  149,  149,  149,  149,  149,  149,  149,
+      149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+      149,  149,  149,  149,  149,  149,  149,  149,  149,  354,
+
+      355,  356,  357,  358,  359,  360,  361,  366,  363,  367,
+      368,  364,  362,  365,  369,  370,  374,  375,  372,  376,
+      377,  378,  371,  379,  380,  381,  382,  383,  385,  386,
+      373,  387,  388,  389,  390,  393,  392,  394,  395,  396,
+      397,  398,  399,  384,  400,  401,  402,  403,  404,  408,
+      409,  410,  391,  413,  414,  411,  405,  406,  412,  407,
+      415,  416,  417,  418,  419,  420,  423,  427,  429,  430,
+      421,  433,  432,  434,  435,  436,  426,  431,  424,  428,
+      425,  437,  438,  422,  439,  440,  441,  442,  443,  444,
+      445,  446,  447,  448,  449,  450,  451,  452,  453,  454,
+
+      455,  456,  457,  458,  459,  460,  461,  462,  463,  464,
+      465,  466,  467,  468,  469,  470,  472,  475,  479,  480,
+      481,  482,  474,  483,  476,  484,  485,  486,  487,  488,
+      490,  491,  473,  492,  493,  477,  494,  495,  496,  471,
+      489,  498,  478,  499,  500,  501,  502,  503,  504,  505,
+      506,  497,  507,  508,  509,  510,  511,  512,  513,  514,
+      515,  516,  517,  519,  520,  523,  521,  527,  528,  529,
+      530,  525,  531,  532,  533,  534,  535,  536,  537,  540,
+      518,  522,  524,  538,  526,  539,  541,  542,  543,  544,
+      546,  547,  545,  548,  549,  550,  551,  552,  553,  554,
+
+      555,  556,  557,  558,  559,  560,  561,  562,  563,  564,
+      565,  567,  570,  568,  571,  566,  569,  572,  573,  574,
+      575,  576,  577,  578,  580,  581,  582,  583,  584,  585,
+      586,  587,  588,  592,  589,  593,  594,  595,  579,  590,
+      596,  597,  598,  591,  599,  600,  602,  603,  604,  605,
+      601,  606,  607,  608,  609,  610,  611,  612,  613,  614,
+      615,  616,  617,  618,  619,  620,  621,  622,  623,  624,
+      625,  626,  627,  629,  630,  631,  628,  632,  633,  634,
+      635,  636,  637,  638,  639,  640,  641,  642,  643,  644,
+      645,  646,  647,  648,  649,  650,  651,  652,  653,  654,
+
+      655,  656,  657,  658,  660,  661,  662,  663,  664,  665,
+      666,  667,  668,  669,  670,  671,  672,  673,  675,  676,
+      677,  678,  679,  674,  680,  681,  659,  682,  683,  684,
+      685,  686,  687,  688,  689,  690,  691,  692,  693,  697,
+      699,  700,  701,  698,  702,  703,  695,  704,  705,  706,
+      707,  708,  709,  694,  710,  711,  696,  712,  713,  714,
+      715,  716,  717,  718,  719,  720,  721,  722,  723,  724,
+      725,  726,  727,  728,  729,  730,  731,  732,  734,  735,
+      736,  737,  738,  739,  740,  733,  741,  742,  743,  744,
+      745,  746,  747,  748,  749,  750,  751,  752,  753,  754,
+
+      755,  756,  757,  758,  759,  760,  763,  764,  765,  761,
+      766,  767,  768,  769,  762,  771,  772,  773,  774,  775,
+      776,  770,  777,  778,  779,  780,  781,  782,  783,  784,
+      785,  786,  787,  791,  792,  795,  793,  796,  797,  790,
+      798,  799,  800,  801,  794,  802,  803,  804,  805,  806,
+      789,  788,  807,  808,  809,  810,  811,  812,  813,  814,
+      815,  816,  817,  818,  819,  820,  821,  822,  823,  824,
+      825,  826,  827,  828,  829,  830,  831,  832,  834,  835,
+      836,  837,  838,  841,  839,  842,  843,  844,  833,  840,
+      845,  846,  847,  848,  849,  850,  851,  852,  853,  854,
+
+      855,  856,  857,  858,  859,  860,  861,  862,  863,  864,
+      865,  866,  867,  868,  869,  870,  871,  872,  873,  874,
+      875,  876,  877,  878,  879,  880,  881,  882,  883,  884,
+      885,  886,  887,  888,  889,  890,  891,  892,  893,  894,
+      895,  896,  897,  899,  900,  901,  902,  903,  905,  910,
+      907,  911,  912,  913,  904,  914,  908,  915,  898,  916,
+      917,  906,  918,  919,  920,  921,  909,  922,  923,  924,
+      925,  926,  927,  928,  933,  935,  936,  937,  938,  934,
+      939,  930,  940,  941,  942,  943,  944,  945,  946,  932,
+      947,  948,  929,  949,  950,  951,  952,  953,  954,  931,
+
+      955,  956,  957,  958,  959,  961,  963,  964,  962,  960,
+      965,  966,  967,  968,  969,  970,  971,  972,  973,  974,
+      975,  976,  977,  978,  979,  980,  981,  982,  983,  984,
+      985,  988,  989,  990,  991,  992,  993,  994,  995,  996,
+      997,  998,  987, 1000, 1001,  986,  999, 1002, 1003, 1004,
+     1005, 1006, 1007, 1008, 1009, 1011, 1012, 1013, 1014, 1010,
+     1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024,
+     1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
+     1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044,
+     1045, 1046, 1047, 1048, 1050, 1051, 1052, 1053, 1049, 1054,
+
+     1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
+     1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
+     1075, 1076, 1077, 1078, 1080, 1081, 1082, 1083, 1084, 1085,
+     1086, 1087, 1088, 1079, 1089, 1090, 1091, 1092, 1093, 1094,
+     1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104,
+     1106, 1110, 1111, 1112, 1113, 1107, 1114, 1105, 1115, 1108,
+     1116, 1109, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
+     1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
+     1135, 1136, 1137, 1139, 1140, 1141, 1138, 1142, 1143, 1144,
+     1145, 1146, 1147, 1149, 1150, 1153, 1154, 1148, 1151, 1155,
+
+     1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165,
+     1166, 1152, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174,
+     1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184,
+     1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
+     1196, 1198, 1200, 1201, 1195, 1202, 1197, 1203, 1199, 1204,
+     1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214,
+     1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
+     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+     1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
+     1246, 1248, 1249, 1250, 1245, 1247, 1251, 1252, 1253, 1254,
+
+     1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264,
+     1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274,
+     1275, 1276, 1277, 1278, 1279, 1280, 1281, 1283, 1285, 1286,
+     1284, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+     1296, 1297, 1282, 1298, 1299, 1301, 1303, 1304, 1302, 1305,
+     1307, 1308, 1309, 1310, 1306, 1311, 1312, 1313, 1300, 1314,
+     1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324,
+     1325, 1326, 1327, 1329, 1330, 1331, 1332, 1333, 1328, 1334,
+     1335, 1336, 1337, 1338, 1340, 1341, 1342, 1339, 1343, 1346,
+     1347, 1348, 1349, 1350, 1351, 1344, 1352, 1345, 1353, 1354,
+
+     1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364,
+     1365, 1366, 1367, 1368, 1370, 1371, 1369, 1372, 1373, 1374,
+     1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384,
+     1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
+     1396, 1397, 1398, 1399, 1395, 1400, 1401, 1402, 1403, 1404,
+     1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414,
+     1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+     1425, 1426, 1427, 1429, 1430, 1431, 1432, 1433, 1434, 1435,
+     1436, 1437, 1438, 1439, 1440, 1428, 1441, 1442, 1443, 1444,
+     1445, 1446, 1447, 1448, 1449, 1450, 1452, 1453, 1454, 1455,
+
+     1457, 1458, 1463, 1464, 1456, 1465, 1460, 1459, 1461, 1466,
+     1467, 1468, 1451, 1462, 1469, 1470, 1471, 1472, 1473, 1474,
+     1475, 1476, 1477, 1478, 1480, 1481, 1482, 1484, 1479, 1485,
+     1486, 1483, 1487, 1489, 1490, 1491, 1492, 1488, 1493, 1494,
+     1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
+     1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514,
+     1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524,
+     1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534,
+     1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544,
+     1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554,
+
+     1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564,
+     1565, 1566, 1567, 1568, 1569, 1571, 1572, 1573, 1574, 1575,
+     1576, 1577, 1578, 1579, 1580, 1581, 1570, 1582, 1583, 1584,
+     1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594,
+     1596, 1597, 1595, 1598, 1599, 1600, 1602, 1603, 1604, 1605,
+     1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1601,
+     1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624,
+     1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634,
+     1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644,
+     1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654,
+
+     1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664,
+     1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674,
+     1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684,
+     1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694,
+     1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
+     1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714,
+     1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724,
+     1725, 1726, 1727, 1728, 1729, 1730, 1731, 1733, 1734, 1732,
+     1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744,
+     1746, 1747, 1748, 1749, 1745, 1750, 1751, 1752, 1753, 1754,
+
+     1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764,
+     1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774,
+     1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
+     1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794,
+     1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804,
+     1805, 1806, 1807, 1808, 1810, 1811, 1812, 1813, 1814, 1815,
+     1816, 1817, 1818, 1820, 1821, 1822, 1823, 1824, 1809, 1825,
+     1819, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834,
+     1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844,
+     1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854,
+
+     1855, 1856, 1857, 1858, 1860, 1859, 1861, 1862, 1863, 1864,
+     1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874,
+     1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884,
+     1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894,
+     1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904,
+     1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914,
+     1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924,
+     1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934,
+     1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944,
+     1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954,
+
+     1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964,
+     1965, 1966, 1967, 1968, 1970, 1971, 1972, 1973, 1969, 1974,
+     1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984,
+     1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994,
+     1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004,
+     2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014,
+     2015, 2016, 2017, 2018, 2019, 2020, 2021, 2023, 2024, 2025,
+     2026, 2022, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
+     2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044,
+     2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054,
+
+     2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064,
+     2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074,
+     2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084,
+     2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094,
+     2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2104, 2105,
+     2106, 2107, 2103, 2108, 2109, 2110, 2111, 2112, 2113, 2114,
+     2115, 2116, 2117, 2119, 2120, 2121, 2123, 2124, 2118, 2125,
+     2122, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134,
+     2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144,
+     2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154,
+
+     2155, 2156, 2157, 2158, 2159, 2160, 2162, 2163, 2161, 2164,
+     2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174,
+     2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184,
+     2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194,
+     2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204,
+     2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214,
+     2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224,
+     2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234,
+     2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244,
+     2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254,
+
+     2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264,
+     2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274,
+     2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284,
+     2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294,
+     2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304,
+     2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314,
+     2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324,
+     2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334,
+     2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344,
+     2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354,
+
+     2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364,
+     2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374,
+     2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384,
+     2385, 2386, 2387, 2388, 2388, 2388, 2388, 2388, 2388, 2388,
+     2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388,
+     2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388,
+     2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388,
+     2388, 2388, 2388, 2388
     } ;
 
-static yyconst flex_int16_t yy_chk[4269] =
+static yyconst flex_int16_t yy_chk[4275] =
     {   0,
+        0,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    4,    4,    4,    5,    5,    6,    6,
-        5,    3,    6,   20,    4,   20,   20,    5,   20,    6,
-        7,    7,    7,    7,   20,    7,    8,    8,    8,    8,
-       96,    8,    7,    9,    9,    9,   96,   33,    8,   10,
-       10,   10,   15,   24,    9,   21,   15,   24,   21,   21,
-       10,   11,   11,   11,   11,   11,   11,   19,   33,   19,
-
-       19, 2155,   19,   11,   25,   25,   21,   24,   19,   19,
-       77,   28,   11,   12,   12,   12,   12,   12,   12,   25,
-       22,   22,   26,   26,   23,   12,   28,   30,   22,   23,
-       77,   26,   22,   23,   12,   22,   23,   27,   23,   23,
-       29,   27,   30,  769,   27,   29,   31,   31,   70,   32,
-       32,   27,   70,   27,   32,   31,   76,   34,   80,   35,
-       76,   31,   34,   36,   36,   31,   34,   80,   36,   37,
-       32,  140,   34,   35,   37,   34,   50,   37,   36,   50,
-       39,   36,   34,   88,   37,   45,   45,   67,   37,   37,
-       38,   38,   81,   38,   39,   40,   40,   61,   61,   39,
-
-       40,   67,   75,   88,   40,   75,   81,   56,   38,   56,
-       56,   64,   56,   64,   64,   66,   64,   66,   66,   69,
-       66,   69,   69,   64,   69,   79,   72,   82,   72,   72,
-       69,   72,   78,   82,   83,   78,   84,   72,   72,   82,
-       85,   86,   87,   79,   89,   90,   91,   86,   78,   97,
-       92,   94,   83,   83,   92,   89,   87,   93,   84,   85,
-       86,  138,   93,   90,   91,   94,   95,  100,   97,   95,
-       98,   99,   95,  101,   99,   98,  102,  103,   99,  104,
-      102,  105,  107,  106,  103,   95,   95,  101,  105,  108,
-      109,  100,  104,  110,  109,   98,  106,  112,  114,  111,
-
-      113,  113,  107,  115,  111,  116,  117,  108,  111,  118,
-      125,  110,  121,  119,  123,  120,  115,  112,  114,  124,
-      116,  120,  115,  118,  121,  117,  119,  118,  122,  122,
-      128,  125,  123,  127,  126,  124,  126,  129,  127,  130,
-      132,  132,  128,  134,  130,  136,  134,  136,  136,  122,
-      136,  139,  139,  137,  147,  129,  141,  126,  141,  141,
-      142,  141,  142,  142,  144,  142,  145,  144,  146,  147,
-      148,  145,  142,  149,  146,  150,  151,  152,  148,  153,
-      154,  151,  156,  156,  155,  157,  154,  154,  153,  155,
-      150,  157,  149,  158,  161,  158,  159,  152,  158,  162,
-
-      159,  160,  160,  163,  162,  159,  164,  165,  163,  166,
-      159,  165,  167,  161,  166,  158,  159,  159,  168,  169,
-      170,  174,  171,  172,  173,  173,  167,  171,  172,  164,
-      173,  169,  175,  168,  169,  177,  177,  176,  170,  178,
-      179,  174,  173,  176,  173,  178,  179,  180,  175,  181,
-      183,  178,  182,  184,  185,  183,  180,  186,  182,  184,
-      185,  187,  188,  189,  186,  190,  191,  192,  188,  193,
-      181,  190,  194,  196,  187,  192,  195,  194,  197,  198,
-      200,  199,  193,  189,  198,  199,  201,  202,  191,  196,
-      203,  195,  201,  204,  206,  205,  203,  205,  197,  208,
-
-      209,  206,  200,  207,  211,  202,  202,  210,  210,  207,
-      211,  212,  209,  204,  213,  214,  213,  212,  208,  215,
-      216,  217,  219,  222,  218,  221,  220,  219,  211,  217,
-      218,  215,  220,  213,  223,  224,  225,  222,  214,  216,
-      221,  226,  227,  231,  225,  227,  228,  234,  228,  224,
-      229,  229,  223,  230,  232,  232,  230,  233,  233,  235,
-      237,  231,  236,  234,  237,  236,  226,  238,  240,  239,
-      245,  241,  242,  242,  235,  239,  238,  241,  243,  244,
-      246,  247,  240,  243,  248,  244,  249,  249,  250,  251,
-      245,  250,  252,  253,  254,  254,  252,  248,  246,  255,
-
-      256,  258,  247,  257,  258,  260,  259,  251,  263,  257,
-      261,  253,  256,  262,  260,  264,  262,  255,  259,  261,
-      268,  263,  260,  260,  269,  260,  265,  264,  265,  265,
-      266,  266,  267,  270,  262,  267,  271,  268,  275,  269,
-      268,  273,  270,  272,  272,  271,  273,  274,  274,  276,
-      277,  278,  279,  275,  276,  280,  281,  282,  325,  283,
-      325,  280,  277,  282,  283,  287,  286,  279,  284,  285,
-      290,  278,  285,  284,  285,  290,  281,  289,  288,  284,
-      286,  287,  291,  289,  287,  292,  287,  288,  294,  293,
-      295,  299,  296,  295,  301,  291,  298,  302,  304,  135,
-
-      299,  305,  294,  291,  293,  292,  296,  305,  303,  295,
-      297,  298,  297,  297,  300,  301,  302,  306,  304,  300,
-      300,  307,  297,  303,  297,  297,  297,  308,  309,  297,
-      310,  311,  312,  313,  317,  310,  314,  315,  312,  316,
-      306,  307,  318,  309,  319,  316,  311,  308,  314,  319,
-      321,  315,  322,  313,  320,  320,  323,  320,  318,  317,
-      324,  326,  327,  329,  328,  326,  327,  330,  322,  331,
-      321,  336,  323,  133,  324,  332,  330,  329,  331,  333,
-      332,  327,  328,  333,  334,  335,  338,  330,  337,  330,
-      338,  335,  336,  334,  337,  339,  340,  341,  341,  342,
-
-      339,  343,  344,  344,  342,  345,  346,  347,  348,  349,
-      346,  345,  350,  348,  343,  351,  340,  352,  349,  353,
-      353,  352,  355,  359,  350,  354,  361,  351,  347,  360,
-      354,  356,  356,  358,  358,  361,  362,  360,  363,  365,
-      366,  367,  368,  355,  359,  369,  370,  371,  368,  374,
-      363,  370,  374,  376,  369,  367,  362,  365,  372,  365,
-      366,  371,  373,  375,  378,  377,  372,  376,  373,  375,
-      377,  379,  380,  381,  382,  383,  380,  384,  388,  382,
-      386,  396,  387,  393,  389,  131,  378,  375,  381,  391,
-      389,  383,  379,  396,  388,  389,  384,  385,  385,  390,
-
-      386,  387,  390,  385,  395,  385,  392,  392,  393,  391,
-      394,  394,  397,  385,  398,  399,  385,  400,  409,  395,
-      401,  402,  400,  385,  403,  404,  406,  397,  407,  401,
-      406,  404,  408,  398,  407,  410,  409,  399,  411,  403,
-      402,  412,  412,  413,  408,  414,  411,  415,  410,  413,
-      416,  417,  418,  415,  417,  419,  420,  414,  421,  420,
-      419,   68,  416,  422,  423,  424,  431,  418,  432,  423,
-      423,  425,  425,  432,  421,  426,  426,  421,  424,  422,
-      427,  428,  428,  429,  429,  430,  427,  431,  433,  434,
-      435,  430,  436,  438,  435,  437,  439,  434,  436,  437,
-
-      440,  439,  441,  443,  442,  445,  447,  433,  441,  442,
-      444,  438,  450,  444,  446,  446,  448,  443,  444,  452,
-      440,  448,  444,  445,  447,  449,  450,  451,  452,  453,
-      449,  454,  453,  451,  455,  454,  456,  457,  458,  455,
-      459,  456,  461,  460,  462,  459,  468,  465,  463,  464,
-      465,  458,  460,  457,  463,  464,  462,  454,  461,  466,
-      467,  469,  466,  470,  468,  467,  471,  472,  479,  470,
-      486,  471,  476,  472,  473,  469,  474,  473,  475,  477,
-      478,  474,  480,  475,  475,  476,  478,  479,  482,  483,
-      481,  480,  477,  481,  483,  486,  484,  485,  485,  488,
-
-      482,  484,  484,  487,  489,  487,  489,  490,  481,  491,
-      492,  493,  494,  495,  497,  496,  494,  498,  488,  499,
-      500,  501,  495,  502,  504,  490,  500,  491,  504,  492,
-      496,  493,  497,  505,  499,  507,  498,  503,  503,  508,
-      501,  506,  502,  509,  505,  510,  506,  512,  511,  515,
-      513,  507,  510,  511,  512,  513,  509,  514,  508,  516,
-      517,  518,  514,  519,  523,  520,  516,  515,  521,  517,
-      520,  521,  519,  522,  525,  518,  527,  522,  524,  524,
-      528,  529,  531,  525,  530,  523,  528,  524,  530,  532,
-      533,  534,  535,  536,  531,  527,  533,  537,  540,  534,
-
-      538,  529,  546,  543,  556,  538,  554,  532,  547,  538,
-      535,  546,  538,  540,  547,  549,  549,  537,  536,  538,
-      543,  548,  538,  550,  550,  548,  551,  554,  555,  556,
-      591,  553,  551,  552,  552,  552,  553,  552,  557,  591,
-      552,  557,  558,  558,  561,  552,  555,  559,  560,  560,
-      568,  552,  552,  563,  559,  562,  562,  564,  563,  561,
-      564,  565,  566,  567,  566,  569,  565,  570,  571,  568,
-      572,  572,  573,  575,  574,  567,  571,  576,  577,  578,
-      578,  582,   62,  577,  582,  569,  570,  573,  574,  576,
-      579,  575,  580,  581,  583,  579,  584,  585,  580,  581,
-
-      583,  586,  587,  588,  584,  585,  589,  587,  590,  590,
-      588,  593,  592,  594,  596,  597,  600,  593,  598,  586,
-      592,  598,  599,  596,  597,  589,  602,  599,  601,  601,
-      600,  603,  594,  604,  605,  609,  607,  605,  607,  610,
-      603,  602,  608,  608,  610,  605,  611,  613,  612,  615,
-      614,  616,  619,  617,  618,  616,  609,  604,  615,  622,
-      620,  619,  621,  623,  623,  622,  624,  611,  612,  613,
-      614,  617,  620,  618,  625,  626,  621,  627,  628,  629,
-      630,  626,  628,  627,  631,  632,  624,  634,  625,  631,
-      633,  633,  630,  634,  635,  636,  637,  635,  629,  638,
-
-      630,  639,  640,  640,  641,  638,  632,  642,  642,  637,
-      643,  644,  645,  636,  646,  644,  647,  648,  649,  651,
-      651,  639,  641,  652,   57,  643,  653,  652,  654,  655,
-      647,  645,  656,  655,  658,  693,  668,  648,  646,  649,
-      650,  653,  668,  650,  693,  650,  660,  656,  658,  650,
-      657,  650,  659,  654,  662,  657,  650,  659,  659,  661,
-      660,  650,  663,  661,  665,  664,  666,  663,  667,  662,
-      664,  670,  670,  669,  673,  671,  674,  663,  665,  669,
-      671,  674,  667,  672,  672,  675,  673,  666,  676,  672,
-      678,  672,  677,  677,  680,  678,  679,  681,  682,  675,
-
-      676,  688,  672,  684,  679,  683,  683,  684,  680,  672,
-      687,  689,  686,  687,  691,  690,  681,  682,  686,  691,
-      688,  690,  692,  694,  689,  696,  695,  697,  698,  699,
-      700,  701,  694,  698,  696,  707,  702,  704,  703,  706,
-      708,  692,  695,  704,  700,  702,  697,  703,  709,  699,
-      710,  701,  711,  706,  707,  710,  712,  711,  708,  713,
-      715,  712,  716,  709,  714,  714,  715,  718,  713,  720,
-      720,  719,  722,  720,  723,  716,  719,  719,  721,  725,
-      724,  721,  726,  718,  727,  725,  722,  727,  728,  730,
-       52,  729,  731,  732,  723,  724,  729,  731,  732,  733,
-
-      735,  736,  726,  739,  737,  730,  735,  738,  738,  728,
-      737,  733,  739,  740,  742,  741,  743,  736,  741,  744,
-      745,  746,  750,  747,  748,  752,  753,  746,  747,  748,
-      756,  740,  742,  745,  751,  743,  752,  751,  753,  744,
-      750,  754,  755,  759,  757,  756,  760,  754,  755,  757,
-      758,  758,  761,  762,  763,  765,  764,  762,  766,  768,
-      760,  770,  759,  773,  761,  764,  771,  772,  775,  773,
-      774,  782,  763,  775,  765,  770,  774,  776,  768,  776,
-      777,  771,  778,  766,  779,  777,  780,  772,  781,  784,
-      782,  780,  783,  785,  786,  786,  778,  787,  779,  783,
-
-      788,  789,  790,  781,  784,  791,  795,  789,  793,  793,
-      791,  787,  785,  795,  794,  796,  798,  797,  788,  794,
-      797,  791,  790,  799,  791,  800,  801,  803,  802,  796,
-      800,  807,  799,  802,  798,  805,  805,  806,  808,  809,
-      807,  806,  810,  811,  812,  801,  803,  813,  814,  815,
-      811,  818,  819,  808,  816,  817,  812,  810,  809,  820,
-      816,  823,  853,  825,  853,  827,  813,  815,  820,  814,
-      817,  818,  819,  822,  824,  823,  826,  827,  829,  822,
-      828,  826,  824,  825,  830,  828,  828,  831,  832,  832,
-      833,  837,  834,  835,  836,  836,  837,  829,  830,  835,
-
-      831,  834,  838,  833,  839,  840,  841,  841,  842,  839,
-      840,  838,  843,  844,  846,  845,  847,  848,  844,  849,
-      854,  843,  847,  848,  849,  851,  850,  857,  842,  845,
-      850,  854,  846,  856,  851,  852,  852,  856,  858,  851,
-      859,  851,  857,  851,  861,  851,  860,  863,  862,  859,
-      865,  860,  860,  864,  866,  868,  858,  862,  861,  869,
-      867,  864,  870,  872,  865,  879,  863,  870,  866,  867,
-      871,  871,  876,  868,  873,  873,  875,  876,  872,  875,
-      877,  878,  878,  881,  869,  879,  880,  880,  881,  882,
-      883,  883,  884,  885,  886,  887,  888,  888,  885,  877,
-
-      887,  889,  886,  890,  891,  892,  899,  894,  895,  890,
-      882,  891,  884,  894,  895,  896,  897,  898,  892,  889,
-      896,  900,  897,  901,  901,  899,  898,  902,  903,  904,
-      905,  906,  900,  907,  908,  909,  905,  910,  911,  911,
-      912,  913,  917,  914,   51,  906,  908,  902,  903,  909,
-      920,  906,  904,  907,  915,  910,  916,  916,  918,  915,
-      912,  914,  921,  918,  922,  917,  913,  921,  921,  920,
-      923,  924,  925,  922,  926,  927,  929,  927,  923,  926,
-      928,  931,  929,  932,  930,  924,  933,  925,  930,  934,
-      925,  935,  931,  936,  928,  937,  935,  939,  940,  941,
-
-      943,  939,  932,  946,  944,  942,  945,  934,  947,  952,
-      952,  936,  933,  947,  943,  937,  940,  942,  941,  944,
-      948,  945,  946,  949,  950,  951,  953,  948,  949,  954,
-      955,  956,  957,  958,  951,  954,  956,  965,  957,  958,
-      967,  953,  950,  959,  959,  960,  960,  962,  962,  963,
-      964,  955,  966,  963,  967,  965,  968,  966,  969,  964,
-      970,  971,   46,  969,  969,  970,  970,  972,  973,  974,
-      975,  976,  977,  978,  979,  968,  975,  980,  984,  978,
-      979,  971,  981,  982,  983,  985,  972,  973,  974,  986,
-       41,  977,  984,  987,  987,  988,  980,  976,  988,  989,
-
-      991,  981,  982,  983,  986,  991,  985,  990,  990,  992,
-      993,  989,  994,  992,  995,  999,  996,  998,  996, 1000,
-     1000,  994,  996,  993, 1001, 1003, 1002,  995, 1004, 1001,
-     1002,  999, 1005, 1006,   14,  996, 1009,  998, 1011, 1006,
-     1007, 1007, 1023, 1011, 1013, 1003, 1004, 1012, 1012, 1018,
-     1013, 1022, 1005, 1026, 1009, 1015, 1015, 1017, 1017, 1020,
-     1021, 1021, 1020, 1024, 1025, 1018, 1022, 1023, 1026, 1025,
-     1027, 1027, 1028, 1029, 1030, 1030, 1028, 1024, 1031, 1032,
-     1033, 1035, 1034, 1039, 1033, 1038, 1035, 1037, 1037, 1041,
-     1032, 1040, 1040, 1029, 1041, 1042, 1043, 1039, 1044, 1045,
-
-     1031, 1034, 1046, 1038, 1045, 1048, 1047, 1044, 1047, 1050,
-     1048, 1049, 1051, 1053, 1055, 1042, 1043, 1049, 1051, 1054,
-     1054, 1058, 1046, 1061, 1056, 1059, 1059, 1053, 1062, 1050,
-     1056, 1060, 1060, 1055, 1063, 1064, 1065, 1063, 1067,   13,
-     1071, 1061, 1069, 1062, 1067, 1058, 1066, 1064, 1068, 1066,
-     1070, 1069, 1066, 1068, 1072, 1070, 1065, 1072, 1074, 1074,
-     1073, 1075, 1076, 1077, 1066, 1071, 1073, 1078, 1081, 1079,
-     1080, 1085, 1082, 1078, 1079, 1084, 1080, 1082, 1086, 1075,
-     1084, 1076, 1087, 1077, 1083, 1083, 1088, 1089, 1092, 1085,
-     1091, 1081, 1090, 1093, 1092, 1094, 1095, 1096, 1086, 1099,
-
-     1088, 1089, 1087, 1091, 1090, 1098, 1098, 1100, 1101, 1102,
-     1095, 1104, 1100, 1093, 1108, 1094, 1102, 1103, 1096, 1099,
-     1106, 1109, 1109, 1101, 1110, 1110, 1103, 1104, 1111, 1103,
-     1112, 1111, 1113, 1115, 1114, 1106, 1116, 1113, 1118, 1108,
-     1106, 1121, 1115,    0, 1117, 1119, 1122, 1118, 1123, 1112,
-     1114, 1119, 1126, 1117, 1124, 1116, 1117, 1120, 1120, 1122,
-     1125, 1121, 1128, 1129, 1126, 1132, 1123, 1131, 1124, 1130,
-     1130, 1136, 1133, 1135, 1132,    0, 1125, 1133, 1134, 1134,
-     1140, 1129, 1135, 1131, 1139, 1135, 1137, 1128, 1141, 1136,
-     1139, 1137, 1137, 1134, 1141, 1142, 1143, 1144, 1140, 1146,
-
-     1142, 1147, 1143, 1144, 1148, 1149, 1152, 1147, 1149, 1154,
-     1153, 1155, 1156, 1162, 1149, 1157, 1158, 1148, 1153, 1146,
-     1159, 1157, 1154, 1161, 1161, 1152, 1163, 1168, 1167, 1155,
-     1163, 1156, 1158, 1162, 1164, 1165, 1166, 1167, 1159, 1164,
-     1165, 1166, 1170, 1171, 1171, 1172, 1173, 1176, 1174, 1175,
-     1168, 1177, 1178, 1173, 1180, 1179, 1181, 1170, 1178, 1172,
-     1174, 1175, 1181, 1182, 1182, 1183, 1176, 1179, 1183, 1184,
-     1184, 1177, 1180, 1186, 1187, 1188, 1188, 1189, 1186, 1190,
-     1191, 1190, 1192, 1187, 1193, 1194, 1195, 1196, 1197, 1189,
-     1194, 1198, 1199, 1200, 1201, 1195, 1198, 1202, 1202, 1196,
-
-     1191, 1199, 1193, 1197, 1192, 1203, 1204, 1205, 1206, 1201,
-     1208, 1203, 1210, 1200, 1199, 1207, 1207, 1209, 1209, 1211,
-     1211, 1212, 1217, 1213, 1219, 1212, 1205, 1204, 1206, 1213,
-     1208, 1214, 1216, 1210, 1214, 1218, 1220, 1225, 1216, 1220,
-     1217, 1218, 1221, 1221, 1222, 1222, 1223, 1224, 1226, 1219,
-     1227, 1228, 1223, 1231, 1232, 1234, 1227, 1225, 1230, 1224,
-     1224, 1224, 1236, 1230, 1230, 1237, 1224, 1231, 1226, 1233,
-     1233, 1228, 1235, 1235, 1242, 1232, 1238, 1238, 1239, 1239,
-     1243, 1234, 1236, 1242, 1244, 1244, 1246, 1237, 1245, 1247,
-     1248, 1249, 1249, 1246, 1250, 1251,    0, 1253, 1247, 1254,
-
-     1256, 1243, 1253, 1245, 1255, 1254, 1257, 1256, 1258, 1259,
-     1259, 1251, 1257, 1260, 1258, 1262, 1248, 1261, 1260, 1263,
-     1250, 1264, 1265, 1266, 1255, 1265, 1261, 1267, 1268, 1268,
-     1269, 1272, 1270, 1264, 1273, 1262, 1270, 1274, 1263, 1275,
-     1276, 1266, 1277, 1275, 1279, 1269, 1276, 1278, 1278, 1273,
-     1272, 1277, 1270, 1267, 1281, 1279, 1274, 1280, 1280, 1282,
-     1279, 1283, 1284, 1285, 1285, 1286, 1287, 1288, 1284, 1295,
-     1286, 1286, 1287, 1282, 1289, 1281, 1290, 1292, 1294, 1293,
-     1297, 1283, 1290, 1293, 1299, 1296, 1289, 1302, 1302, 1292,
-     1294, 1296, 1298, 1288, 1295, 1305, 1299, 1301, 1298,    0,
-
-     1301, 1306, 1297, 1303, 1303, 1304, 1304, 1306, 1307, 1315,
-     1310, 1308, 1309, 1317, 1307, 1305, 1308, 1312, 1309, 1310,
-     1314, 1315, 1312, 1314, 1318, 1317, 1319, 1319, 1320, 1321,
-     1322, 1322, 1323, 1324, 1321, 1325, 1318, 1320, 1326, 1327,
-     1328, 1329, 1324, 1327, 1330, 1328, 1333, 1329, 1332, 1332,
-     1334, 1339, 1323, 1325, 1335, 1337, 1337, 1326, 1330, 1334,
-     1332, 1341, 1343, 1335, 1333, 1342, 1344, 1339, 1343, 1345,
-     1345, 1346, 1348, 1346, 1347, 1347, 1341, 1350, 1351, 1342,
-     1348, 1352, 1352, 1344, 1350, 1353, 1354, 1355, 1356, 1357,
-     1358, 1359, 1362, 1363, 1353, 1366, 1360, 1366, 1351, 1355,
-
-     1356, 1357, 1360, 1365, 1367, 1368, 1359, 1354, 1365, 1376,
-     1368, 1369, 1362, 1363, 1371, 1360, 1358, 1372, 1369, 1372,
-     1374, 1377, 1367, 1371, 1375, 1375, 1377, 1378, 1379, 1378,
-     1381, 1380, 1382, 1379, 1374, 1376, 1380, 1383, 1385, 1384,
-     1388, 1386, 1389, 1383, 1384, 1390, 1390, 1392, 1381, 1386,
-     1393, 1385, 1382, 1391, 1391, 1394, 1389, 1397, 1395, 1388,
-     1402, 1394, 1392, 1395, 1396, 1400, 1396, 1398, 1398, 1397,
-     1393, 1399, 1399, 1401, 1400, 1401, 1404, 1400, 1403, 1403,
-     1405, 1402, 1407, 1408, 1410, 1404, 1411, 1407, 1408, 1412,
-     1415, 1419, 1405, 1413, 1417, 1418, 1415, 1410, 1424, 1420,
-
-     1417, 1421, 1421, 1422, 1423, 1423, 1411, 1412, 1420, 1413,
-     1418, 1425, 1422, 1426, 1427, 1425, 1419, 1424, 1426, 1428,
-     1429, 1430, 1433, 1433, 1428, 1428, 1435, 1427, 1429, 1434,
-     1436, 1436, 1437, 1437, 1438, 1435, 1439, 1440, 1442, 1442,
-     1441, 1430, 1443, 1440, 1434, 1441, 1438, 1443, 1445, 1446,
-     1448, 1449, 1445, 1450, 1439, 1451, 1449, 1452, 1454, 1453,
-     1455, 1455, 1452, 1456, 1457, 1459, 1458, 1456, 1460, 1446,
-     1451, 1458, 1463, 1462, 1454, 1448, 1450, 1453, 1464, 1457,
-     1465, 1467, 1466, 1468, 1474, 1470, 1511, 1460, 1471, 1471,
-     1511, 1459, 1462, 1467, 1472, 1463, 1473, 1472, 1474, 1465,
-
-     1470, 1475, 1464, 1466, 1468, 1476, 1476, 1477, 1477, 1473,
-     1478, 1478, 1479, 1480, 1475, 1481, 1481, 1483, 1483, 1482,
-     1484, 1484, 1485, 1485, 1486, 1491, 1480, 1479, 1482, 1487,
-     1487, 1482, 1488, 1489, 1489, 1490, 1490, 1492, 1496, 1491,
-     1494, 1495, 1495, 1486, 1498, 1494, 1497, 1497, 1499, 1500,
-     1488, 1503, 1500, 1504, 1499, 1508, 1492, 1496, 1501, 1501,
-     1502, 1502, 1498, 1505, 1506, 1506, 1509, 1513, 1504, 1510,
-     1503, 1512, 1512, 1515, 1501, 1508, 1514, 1514, 1516, 1517,
-     1518, 1518, 1505, 1519, 1510, 1516, 1513, 1522, 1520, 1509,
-     1520, 1523, 1519, 1515, 1524, 1525, 1523, 1526, 1527, 1522,
-
-     1529, 1528, 1530, 1527, 1531, 1517, 1528, 1532, 1525, 1536,
-     1533, 1530, 1542, 1531, 1538, 1529, 1533, 1547, 1526, 1524,
-     1534, 1532, 1540, 1538, 1534, 1539, 1539, 1544, 1540, 1536,
-     1541, 1541, 1542, 1547, 1542, 1545, 1548, 1550, 1551, 1541,
-     1550, 1552, 1544, 1551, 1545, 1553, 1554, 1554, 1548, 1556,
-     1556, 1557, 1558, 1559, 1559, 1560, 1557, 1553, 1558, 1561,
-     1561, 1552, 1562, 1563, 1564, 1565, 1565, 1567, 1571, 1560,
-     1568, 1567, 1572, 1568, 1562, 1569, 1569, 1563, 1574, 1570,
-     1573, 1575, 1574, 1564, 1570, 1576, 1579, 1577, 1571, 1578,
-     1576, 1581, 1572, 1577, 1573, 1578, 1591, 1582, 1584, 1583,
-
-     1588, 1575, 1582, 1598, 1579, 1583, 1584, 1581, 1585, 1607,
-     1585, 1589, 1589, 1590, 1588, 1607, 1590, 1592, 1592, 1596,
-     1596, 1598, 1591, 1601, 1602, 1603, 1603, 1609, 1601, 1602,
-     1605, 1605, 1608, 1608, 1610, 1611, 1613, 1614, 1615, 1615,
-     1611, 1617, 1618, 1609, 1619, 1620, 1622, 1622, 1618, 1614,
-     1617, 1624, 1624, 1625, 1625, 1613, 1610, 1627, 1626, 1627,
-     1620, 1628, 1619, 1626, 1629, 1630, 1631, 1631, 1632, 1632,
-     1630, 1633, 1633, 1634, 1635, 1628, 1636, 1636, 1629, 1637,
-     1641, 1638, 1639, 1640, 1644, 1634, 1642, 1642, 1640, 1643,
-     1646, 1637, 1635, 1638, 1639, 1645, 1647, 1648, 1643, 1650,
-
-     1641, 1649, 1649, 1646, 1651, 1652, 1653, 1654, 1650, 1653,
-     1644, 1648, 1654, 1655, 1661, 1645, 1656, 1656, 1655, 1662,
-     1647, 1664, 1651, 1657, 1657, 1658, 1658, 1652, 1665, 1666,
-     1662, 1668, 1661, 1667, 1669, 1671, 1671, 1670, 1673, 1673,
-     1668, 1664, 1675, 1674, 1677, 1678, 1665, 1679, 1680, 1676,
-     1681, 1666, 1674, 1667, 1669, 1670, 1676, 1682, 1682, 1677,
-     1675, 1683, 1683, 1678, 1680, 1679, 1684, 1685, 1686, 1681,
-     1687, 1688, 1684, 1689, 1690, 1691, 1688, 1692, 1694, 1692,
-     1691, 1695, 1699, 1686, 1696, 1685, 1703, 1694, 1700, 1687,
-     1702, 1700, 1707, 1689, 1690, 1701, 1701, 1704, 1704, 1709,
-
-     1709, 1695, 1699, 1696, 1703, 1702, 1705, 1707, 1708, 1710,
-     1705, 1715, 1708, 1712, 1712, 1714, 1714, 1716, 1716, 1717,
-     1718, 1718, 1710, 1723, 1717, 1722, 1722, 1724, 1725, 1726,
-     1715, 1727, 1728, 1729, 1726, 1731, 1727, 1725, 1732, 1733,
-     1724, 1729, 1734, 1732, 1733, 1723, 1735, 1735, 1736, 1736,
-     1731, 1728, 1737, 1738, 1739, 1741, 1740, 1734, 1738, 1737,
-     1739, 1740, 1742, 1742, 1743, 1743, 1746, 1747,    0, 1748,
-     1741, 1749, 1747, 1747, 1748, 1752, 1750, 1749, 1751, 1746,
-     1750, 1753, 1754, 1751, 1752, 1756, 1755, 1760, 1759, 1758,
-     1754, 1755, 1758, 1759, 1761, 1762, 1753, 1756, 1768, 1763,
-
-     1764, 1764, 1765, 1769, 1762, 1760, 1770, 1761, 1763, 1771,
-     1771, 1765, 1772, 1773, 1774, 1775, 1775, 1768, 1776, 1783,
-     1777, 1778, 1773, 1769, 1777, 1770, 1780, 1778, 1783, 1774,
-     1781, 1772, 1779, 1779, 1780, 1781, 1784, 1776, 1786, 1787,
-     1788, 1795, 1786, 1790, 1790, 1793, 1793, 1797, 1806, 1784,
-     1798, 1798, 1804, 1787, 1806, 1788, 1799, 1799, 1805, 1800,
-     1812, 1795, 1800, 1801, 1801, 1802, 1802, 1797, 1803, 1803,
-     1804, 1808, 1805, 1807, 1807, 1808, 1811, 1819, 1813, 1814,
-     1819, 1811, 1811, 1812, 1813, 1814, 1815, 1818, 1821, 1822,
-     1815, 1823, 1818, 1824, 1825, 1826, 1823, 1827, 1827, 1828,
-
-     1829, 1830, 1831, 1831, 1832, 1832, 1822, 1822, 1829, 1826,
-     1834, 1824, 1835, 1821, 1825, 1833, 1833, 1835, 1828, 1836,
-     1830, 1837, 1838, 1839, 1840,    0, 1834, 1842, 1842, 1843,
-     1844, 1838, 1843, 1846, 1846, 1847, 1848, 1850, 1854, 1836,
-     1847, 1851, 1851, 1839, 1840, 1848, 1852, 1837, 1844, 1853,
-     1852, 1855, 1856, 1854, 1857, 1850, 1855, 1855, 1853, 1859,
-     1859, 1860, 1861, 1857, 1863, 1856, 1867, 1868, 1868, 1869,
-     1860, 1867, 1871, 1875, 1861, 1872, 1872, 1871, 1869, 1872,
-     1874, 1874, 1875, 1876, 1881, 1877, 1878, 1885, 1879, 1863,
-     1877, 1882, 1878, 1879, 1880, 1880, 1882, 1883, 1884, 1886,
-
-     1886, 1888, 1889, 1876, 1884, 1881, 1890, 1890, 1891, 1892,
-     1893, 1894, 1885, 1892, 1895, 1883, 1896, 1889, 1897, 1893,
-     1888, 1891, 1898, 1897, 1896, 1899, 1899, 1894, 1900, 1902,
-     1902, 1903, 1903, 1895, 1905, 1905, 1906, 1907, 1909, 1909,
-     1910, 1911, 1907, 1912, 1914, 1914, 1917, 1900, 1898, 1915,
-     1918, 1918, 1906, 1919, 1919, 1920, 1922, 1921, 1923, 1923,
-     1910, 1927, 1912, 1915, 1911, 1925, 1925, 1924, 1917, 1921,
-     1924, 1928, 1930, 1927, 1920, 1930, 1922, 1929, 1929, 1931,
-     1933, 1934, 1935,    0, 1936, 1933, 1937, 1937, 1935, 1939,
-     1939, 1928, 1940, 1942, 1942, 1944, 1955, 1931, 1943, 1945,
-
-     1934, 1936, 1936, 1943, 1945, 1946, 1946, 1947, 1947, 1944,
-     1949, 1940, 1948, 1948, 1959, 1949, 1951, 1951, 1955, 1956,
-     1956, 1958, 1958, 1960, 1961, 1962, 1962, 1963, 1959, 1966,
-     1967, 1967, 1963, 1961, 1968, 1970, 1971, 1966, 1973, 1968,
-     1972, 1975, 1976, 1960, 1978, 1972, 1977, 1980, 1979, 1975,
-     1973, 1984, 1981, 1986, 1986, 1970, 1971, 1981, 1987, 1987,
-     1978, 1998, 1976, 1988, 1977, 1979, 1979, 1988, 1980, 1992,
-     1992, 1984, 1994, 1994, 1995, 1994, 1997, 1997, 1995, 1998,
-     1999, 2001, 2001, 2002, 2004, 2011, 2005, 2006, 2006, 2007,
-     2007, 2008, 2008, 2012, 1999, 2005, 2009, 2013, 2002, 2010,
-
-     2010, 2009, 2004, 2016, 2014,    0, 2015,    0, 2012, 2014,
-     2011, 2015, 2017, 2017, 2020, 2020, 2022, 2022, 2013, 2023,
-     2023, 2026, 2016, 2024, 2024, 2027, 2027, 2029, 2030, 2030,
-     2026, 2031, 2032, 2032, 2035, 2037, 2038, 2035, 2039, 2029,
-     2040, 2037, 2041, 2039, 2048, 2042, 2031, 2048, 2050, 2051,
-     2038, 2052, 2050, 2054, 2055, 2056, 2058, 2057, 2059, 2040,
-     2041, 2042, 2060, 2066, 2054, 2052, 2061, 2055, 2066, 2051,
-     2062, 2062, 2058, 2063, 2056, 2057, 2068, 2060, 2064, 2064,
-     2065, 2065, 2063, 2059, 2067, 2069, 2061, 2070, 2071, 2067,
-     2072, 2072, 2074, 2070, 2077, 2080, 2082, 2078, 2079, 2081,
-
-     2069, 2068, 2071, 2078, 2079, 2084, 2085, 2074, 2086, 2080,
-     2087, 2088, 2081, 2077, 2091, 2082, 2096, 2089,    0, 2084,
-        0, 2086, 2089, 2087, 2090, 2085, 2092, 2092, 2100, 2090,
-     2088, 2093, 2094, 2091, 2095, 2096, 2093, 2094, 2097, 2095,
-     2098, 2098, 2099, 2101, 2097, 2102, 2103, 2100, 2104, 2099,
-     2106, 2102, 2107, 2108, 2109, 2106, 2110, 2110, 2111, 2112,
-     2117, 2104, 2101, 2111,    0, 2103, 2121, 2109, 2113, 2113,
-     2115, 2107, 2108, 2114, 2114, 2115, 2116, 2119, 2112, 2117,
-     2118, 2118, 2120, 2116, 2119, 2121, 2122, 2123, 2125, 2120,
-     2126, 2122, 2127, 2125, 2128, 2126, 2129, 2129, 2130, 2131,
-
-     2132, 2132, 2133, 2133, 2143, 2134, 2123, 2135, 2135, 2136,
-     2136, 2127, 2134, 2128, 2137, 2139, 2144, 2130, 2131, 2142,
-     2139, 2137,    0, 2143, 2142, 2145, 2145, 2146, 2146,    0,
-        0,    0,    0,    0,    0, 2144, 2150, 2150, 2150, 2150,
-     2150, 2150, 2150, 2151, 2151, 2151, 2151, 2151, 2151, 2151,
-     2152, 2152, 2152, 2152, 2152, 2152, 2152, 2153, 2153, 2153,
-     2153, 2153, 2153, 2153, 2154, 2154, 2154, 2154, 2154, 2154,
-     2154, 2156, 2156,    0, 2156, 2156, 2156, 2156, 2157, 2157,
-        0,    0,    0, 2157, 2157, 2158, 2158,    0,    0, 2158,
-        0, 2158, 2159,    0,    0,    0,    0,    0, 2159, 2160,
-
-     2160,    0,    0,    0, 2160, 2160, 2161,    0,    0,    0,
-        0,    0, 2161, 2162, 2162,    0, 2162, 2162, 2162, 2162,
-     2163, 2163,    0, 2163, 2163, 2163, 2163, 2149, 2149, 2149,
-     2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149,
-     2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149,
-     2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149,
-     2149, 2149, 2149, 2149, 2149, 2149, 2149, 2149
+        1,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+        6,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+
+       10,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   14,   22,   14,   15,   15,   24,   14,   24,   25,
+       15,   24,   15,   15,   15,   15,   15,   31,   15,   15,
+
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   16,   32,   34,   18,   16,
+       37,   18,   57,   36,   57,   66,   72,   36,   18,   16,
+       18,   36,   16,   17,   17,   17,   76,   17,   17,   17,
+       17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
+       17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
+       17,   17,   17,   17,   17,   17,   17,   17,   17,   17,
+       17,   17,   17,   17,   19,   19,   73,   73,   78,   79,
+       19,   75,   19,   19,   19,   19,   19,   75,   19,   19,
+
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   20,   80,   21,   20,   21,
+       33,   85,   87,   88,   33,   20,   81,   23,   23,   20,
+       20,   89,   81,   23,   21,   23,   23,   23,   23,   23,
+       33,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   26,   90,
+       91,   92,   95,   71,   93,   96,   26,   97,   93,   27,
+       27,   98,   26,   99,  100,   27,   26,   27,   27,   27,
+
+       27,   27,   71,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       28,   28,  103,  103,  104,  105,   28,  106,   28,   28,
+       28,   28,   28,  107,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   29,   29,  109,  110,  111,  112,   29,  113,   29,
+       29,   29,   29,   29,  114,   29,   29,   29,   29,   29,
+       29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
+
+       29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
+       29,   29,   30,   30,  115,  116,  117,  118,   30,  119,
+       30,   30,   30,   30,   30,  120,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   35,  102,  121,  122,   35,  123,  121,
+      124,  125,  127,   35,  126,  128,   35,  102,  126,  129,
+       38,   38,   38,   35,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+       38,   42,   42,   42,  130,  131,  132,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   51,   51,   51,  133,  134,   51,   51,  153,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   55,   55,  145,  156,  145,  158,   55,
+
+      159,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   58,   58,   58,  160,  162,  163,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   65,   65,  164,  165,  166,
+      167,   65,  171,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   74,   74,  170,  172,
+      173,  170,   74,  174,   74,   74,   74,   74,   74,  175,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   77,   77,   77,
+      176,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   82,   82,
+
+       82,  177,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   83,
+       83,   83,  178,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       84,   84,   84,  179,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   86,   94,  101,   86,  108,  161,  180,  181,  182,
+      157,  183,  184,  161,  185,  157,  187,   86,   86,  135,
+      135,  188,   94,  101,  189,  135,  108,  135,  135,  135,
+      135,  135,  157,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      136,  136,  136,  186,  186,  190,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  137,  137,  137,  191,  137,  137,  137,  137,  137,
+      137,  137,  137,  137,  137,  137,  137,  137,  137,  137,
+      137,  137,  137,  137,  137,  137,  137,  137,  137,  137,
+      137,  137,  137,  137,  137,  137,  137,  137,  137,  137,
+      137,  137,  138,  138,  138,  192,  193,  194,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+
+      138,  138,  138,  139,  139,  139,  195,  196,  139,  139,
+      197,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  140,  140,  140,  199,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  141,  141,  141,  200,  201,
+      141,  141,  202,  141,  141,  141,  141,  141,  141,  141,
+
+      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+      141,  141,  141,  141,  141,  141,  142,  142,  203,  204,
+      205,  206,  142,  207,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  143,  143,  143,
+      208,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+      143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+      143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+
+      143,  143,  143,  143,  143,  143,  143,  143,  144,  144,
+      209,  210,  211,  212,  144,  213,  144,  144,  144,  144,
+      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+      144,  144,  144,  144,  144,  144,  144,  144,  144,  146,
+      146,  146,  214,  216,  217,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      147,  147,  147,  218,  147,  147,  147,  147,  147,  147,
+
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  148,  148,  148,  219,  220,  221,  148,  148,  148,
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,  148,  149,  149,  149,  222,  149,  149,  149,  149,
+      149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+      149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+
+      149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+      149,  149,  149,  150,  150,  150,  223,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  151,  151,  224,  225,  226,  227,
+      151,  229,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  152,  152,  152,  231,  152,
+
+      152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+      152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+      152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+      152,  152,  152,  152,  152,  152,  154,  154,  232,  233,
+      234,  235,  154,  236,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  155,  215,  237,
+      238,  228,  155,  239,  240,  241,  242,  155,  243,  244,
+      215,  245,  246,  155,  155,  168,  168,  168,  228,  168,
+
+      168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+      168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+      168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+      168,  168,  168,  168,  168,  168,  169,  198,  247,  248,
+      249,  169,  250,  251,  252,  253,  254,  255,  256,  257,
+      258,  259,  260,  169,  261,  169,  262,  263,  230,  230,
+      230,  198,  230,  230,  230,  230,  230,  230,  230,  230,
+      230,  230,  230,  230,  230,  230,  230,  230,  230,  230,
+      230,  230,  230,  230,  230,  230,  230,  230,  230,  230,
+      230,  230,  230,  230,  230,  230,  230,  230,  230,  264,
+
+      265,  266,  267,  268,  269,  270,  271,  273,  272,  273,
+      274,  272,  271,  272,  275,  276,  277,  278,  276,  279,
+      280,  281,  276,  282,  283,  284,  285,  286,  287,  288,
+      276,  289,  290,  291,  292,  293,  293,  294,  295,  296,
+      297,  298,  299,  286,  300,  301,  302,  303,  304,  305,
+      306,  307,  292,  309,  310,  308,  304,  304,  308,  304,
+      311,  312,  313,  314,  315,  316,  317,  317,  318,  319,
+      316,  321,  320,  322,  322,  323,  317,  320,  317,  317,
+      317,  324,  325,  317,  326,  327,  328,  329,  330,  331,
+      332,  333,  334,  335,  336,  337,  338,  339,  340,  341,
+
+      342,  343,  344,  345,  346,  347,  348,  349,  350,  351,
+      352,  353,  354,  355,  356,  357,  358,  359,  360,  361,
+      362,  363,  359,  364,  359,  365,  366,  367,  368,  369,
+      370,  371,  359,  372,  373,  359,  374,  375,  376,  357,
+      369,  377,  359,  378,  379,  380,  381,  382,  383,  384,
+      385,  377,  386,  387,  388,  389,  390,  391,  392,  393,
+      394,  395,  396,  397,  398,  400,  399,  402,  403,  404,
+      405,  401,  406,  407,  408,  410,  411,  412,  413,  415,
+      396,  399,  401,  414,  401,  414,  416,  417,  418,  420,
+      422,  423,  420,  424,  425,  426,  427,  428,  429,  430,
+
+      431,  432,  433,  434,  435,  436,  437,  438,  439,  440,
+      441,  442,  444,  443,  445,  441,  443,  446,  447,  448,
+      449,  450,  451,  452,  453,  454,  455,  456,  457,  458,
+      459,  460,  461,  463,  462,  464,  465,  466,  452,  462,
+      467,  468,  469,  462,  470,  471,  472,  473,  474,  475,
+      471,  476,  477,  478,  479,  480,  481,  482,  483,  484,
+      485,  486,  487,  488,  489,  490,  491,  492,  493,  494,
+      495,  496,  497,  498,  499,  500,  498,  501,  502,  503,
+      504,  505,  506,  507,  508,  509,  510,  511,  512,  513,
+      514,  515,  516,  517,  518,  519,  520,  521,  522,  523,
+
+      524,  525,  526,  527,  528,  529,  530,  531,  532,  533,
+      534,  535,  536,  537,  538,  539,  540,  541,  542,  543,
+      544,  545,  546,  542,  547,  548,  528,  549,  550,  551,
+      552,  553,  554,  555,  556,  557,  561,  563,  564,  565,
+      567,  568,  569,  565,  570,  571,  565,  572,  573,  574,
+      575,  576,  577,  565,  578,  579,  565,  580,  581,  582,
+      583,  584,  585,  586,  587,  588,  589,  590,  591,  592,
+      593,  594,  595,  596,  597,  598,  599,  600,  602,  603,
+      604,  605,  606,  607,  608,  600,  609,  610,  611,  612,
+      613,  614,  615,  616,  617,  618,  619,  620,  621,  622,
+
+      623,  624,  625,  626,  627,  628,  629,  630,  631,  628,
+      632,  634,  635,  636,  629,  637,  638,  639,  640,  641,
+      642,  636,  643,  644,  645,  646,  647,  648,  649,  650,
+      651,  652,  653,  654,  654,  655,  654,  656,  657,  654,
+      658,  659,  660,  661,  654,  662,  663,  664,  665,  666,
+      654,  654,  667,  668,  669,  670,  671,  672,  673,  675,
+      676,  677,  678,  679,  680,  681,  682,  683,  684,  685,
+      686,  687,  688,  689,  690,  691,  692,  693,  694,  695,
+      696,  697,  698,  700,  699,  701,  702,  703,  694,  699,
+      704,  705,  706,  707,  708,  709,  710,  711,  712,  713,
+
+      714,  715,  716,  717,  718,  720,  721,  722,  723,  724,
+      725,  726,  727,  728,  729,  730,  731,  732,  733,  734,
+      735,  736,  737,  738,  739,  740,  741,  742,  744,  745,
+      746,  747,  748,  749,  750,  751,  752,  754,  755,  756,
+      757,  758,  759,  760,  761,  762,  763,  764,  765,  766,
+      765,  767,  768,  769,  765,  770,  765,  771,  759,  772,
+      773,  765,  774,  775,  776,  777,  765,  778,  779,  780,
+      781,  782,  783,  784,  785,  786,  787,  788,  789,  785,
+      790,  785,  791,  792,  793,  794,  795,  796,  797,  785,
+      798,  799,  785,  800,  801,  802,  803,  804,  806,  785,
+
+      807,  808,  809,  810,  811,  812,  813,  814,  812,  811,
+      816,  817,  818,  819,  820,  821,  822,  823,  824,  825,
+      827,  828,  830,  831,  832,  833,  834,  835,  836,  837,
+      838,  839,  841,  842,  843,  844,  845,  846,  847,  848,
+      849,  850,  839,  851,  852,  839,  850,  853,  854,  855,
+      856,  857,  858,  859,  860,  861,  862,  863,  864,  860,
+      866,  867,  868,  869,  870,  871,  872,  873,  874,  875,
+      876,  877,  878,  879,  880,  881,  882,  884,  885,  886,
+      887,  888,  889,  890,  891,  892,  893,  894,  895,  896,
+      897,  898,  899,  900,  901,  902,  903,  904,  900,  905,
+
+      906,  907,  908,  909,  910,  911,  912,  913,  914,  916,
+      917,  918,  919,  920,  921,  922,  923,  924,  925,  926,
+      927,  928,  929,  930,  931,  932,  933,  934,  936,  937,
+      938,  939,  940,  930,  941,  942,  943,  944,  945,  946,
+      947,  948,  949,  950,  951,  952,  953,  954,  955,  956,
+      957,  958,  959,  961,  962,  957,  963,  957,  964,  957,
+      965,  957,  966,  967,  968,  969,  970,  971,  972,  973,
+      974,  975,  976,  977,  978,  979,  980,  981,  982,  983,
+      984,  985,  986,  987,  988,  989,  987,  990,  991,  993,
+      994,  995,  996,  997,  998, 1000, 1001,  996,  998, 1002,
+
+     1003, 1004, 1005, 1006, 1007, 1008, 1009, 1011, 1012, 1013,
+     1014,  998, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022,
+     1023, 1024, 1025, 1028, 1030, 1031, 1032, 1033, 1035, 1037,
+     1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
+     1048, 1050, 1051, 1052, 1047, 1053, 1048, 1054, 1051, 1055,
+     1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065,
+     1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075,
+     1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1085, 1086,
+     1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096,
+     1097, 1098, 1099, 1100, 1096, 1097, 1101, 1102, 1103, 1104,
+
+     1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114,
+     1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
+     1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
+     1133, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1145,
+     1146, 1147, 1133, 1150, 1151, 1152, 1153, 1154, 1152, 1155,
+     1156, 1157, 1158, 1160, 1155, 1161, 1162, 1163, 1151, 1164,
+     1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174,
+     1175, 1178, 1179, 1181, 1182, 1183, 1184, 1185, 1179, 1186,
+     1187, 1188, 1189, 1190, 1191, 1192, 1193, 1191, 1194, 1196,
+     1197, 1198, 1199, 1200, 1201, 1194, 1202, 1194, 1203, 1204,
+
+     1205, 1206, 1207, 1208, 1209, 1210, 1212, 1213, 1214, 1215,
+     1216, 1217, 1218, 1219, 1220, 1221, 1219, 1222, 1223, 1224,
+     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+     1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
+     1246, 1248, 1249, 1250, 1244, 1251, 1252, 1253, 1254, 1255,
+     1256, 1257, 1258, 1259, 1261, 1262, 1263, 1264, 1265, 1266,
+     1268, 1269, 1270, 1271, 1272, 1273, 1274, 1276, 1277, 1278,
+     1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288,
+     1289, 1290, 1291, 1292, 1293, 1281, 1294, 1296, 1297, 1298,
+     1299, 1300, 1301, 1302, 1303, 1304, 1305, 1307, 1308, 1309,
+
+     1311, 1312, 1314, 1315, 1309, 1316, 1313, 1313, 1313, 1317,
+     1318, 1319, 1305, 1313, 1320, 1321, 1322, 1323, 1324, 1325,
+     1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1329, 1334,
+     1335, 1332, 1336, 1337, 1338, 1339, 1340, 1336, 1341, 1342,
+     1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352,
+     1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1362, 1363,
+     1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+     1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383,
+     1384, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
+     1395, 1396, 1397, 1400, 1401, 1402, 1404, 1405, 1406, 1407,
+
+     1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417,
+     1418, 1419, 1420, 1421, 1422, 1423, 1425, 1426, 1427, 1428,
+     1429, 1430, 1431, 1432, 1433, 1434, 1423, 1435, 1436, 1437,
+     1438, 1440, 1441, 1443, 1444, 1445, 1446, 1447, 1448, 1449,
+     1450, 1451, 1449, 1452, 1453, 1454, 1455, 1457, 1458, 1459,
+     1460, 1461, 1462, 1463, 1464, 1465, 1466, 1468, 1469, 1455,
+     1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479,
+     1482, 1484, 1485, 1486, 1487, 1489, 1491, 1492, 1493, 1494,
+     1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
+     1505, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515,
+
+     1516, 1517, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526,
+     1527, 1528, 1531, 1533, 1534, 1535, 1536, 1537, 1538, 1539,
+     1540, 1541, 1543, 1544, 1545, 1546, 1548, 1549, 1550, 1551,
+     1552, 1553, 1554, 1555, 1557, 1558, 1559, 1560, 1561, 1562,
+     1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572,
+     1573, 1574, 1575, 1576, 1577, 1578, 1579, 1581, 1582, 1583,
+     1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594,
+     1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1601,
+     1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613,
+     1615, 1617, 1618, 1619, 1613, 1620, 1621, 1622, 1623, 1624,
+
+     1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634,
+     1635, 1636, 1637, 1638, 1639, 1642, 1643, 1644, 1645, 1646,
+     1647, 1648, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657,
+     1658, 1659, 1660, 1662, 1663, 1664, 1665, 1666, 1667, 1669,
+     1670, 1671, 1672, 1673, 1674, 1675, 1677, 1678, 1679, 1680,
+     1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690,
+     1691, 1693, 1694, 1696, 1697, 1699, 1700, 1702, 1684, 1703,
+     1694, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1712, 1713,
+     1714, 1715, 1717, 1718, 1719, 1720, 1721, 1723, 1724, 1725,
+     1726, 1727, 1728, 1731, 1732, 1733, 1734, 1735, 1736, 1737,
+
+     1738, 1739, 1742, 1744, 1746, 1744, 1747, 1748, 1749, 1750,
+     1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760,
+     1761, 1763, 1765, 1766, 1767, 1768, 1769, 1770, 1772, 1773,
+     1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1785,
+     1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795,
+     1796, 1797, 1798, 1799, 1800, 1802, 1807, 1808, 1809, 1810,
+     1811, 1813, 1814, 1816, 1817, 1818, 1819, 1820, 1821, 1822,
+     1823, 1824, 1825, 1827, 1828, 1829, 1830, 1831, 1832, 1834,
+     1835, 1837, 1839, 1840, 1841, 1843, 1844, 1845, 1847, 1848,
+     1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858,
+
+     1859, 1860, 1861, 1863, 1864, 1865, 1866, 1869, 1870, 1871,
+     1872, 1873, 1874, 1876, 1877, 1880, 1881, 1882, 1876, 1883,
+     1884, 1885, 1886, 1887, 1890, 1891, 1892, 1893, 1896, 1897,
+     1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907,
+     1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1918,
+     1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928,
+     1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1939,
+     1941, 1935, 1944, 1945, 1946, 1948, 1949, 1950, 1951, 1952,
+     1953, 1954, 1955, 1956, 1958, 1959, 1960, 1961, 1962, 1963,
+     1964, 1966, 1967, 1968, 1970, 1971, 1973, 1974, 1975, 1978,
+
+     1979, 1980, 1981, 1982, 1983, 1985, 1986, 1987, 1988, 1989,
+     1990, 1991, 1992, 1993, 1994, 1995, 1997, 1998, 1999, 2000,
+     2001, 2004, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015,
+     2016, 2017, 2018, 2018, 2019, 2020, 2021, 2023, 2024, 2025,
+     2028, 2029, 2030, 2031, 2032, 2033, 2035, 2036, 2037, 2038,
+     2039, 2041, 2036, 2042, 2045, 2046, 2047, 2048, 2049, 2050,
+     2051, 2054, 2056, 2057, 2058, 2060, 2061, 2062, 2057, 2063,
+     2060, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072,
+     2073, 2074, 2075, 2076, 2077, 2078, 2079, 2081, 2082, 2084,
+     2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094,
+
+     2096, 2097, 2098, 2099, 2100, 2102, 2104, 2105, 2102, 2107,
+     2108, 2110, 2111, 2112, 2113, 2115, 2116, 2117, 2119, 2120,
+     2121, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131,
+     2132, 2133, 2134, 2135, 2136, 2138, 2139, 2140, 2141, 2142,
+     2143, 2144, 2146, 2146, 2147, 2148, 2149, 2151, 2152, 2153,
+     2154, 2158, 2159, 2160, 2161, 2163, 2164, 2166, 2168, 2169,
+     2170, 2171, 2172, 2173, 2174, 2175, 2177, 2178, 2179, 2180,
+     2181, 2182, 2183, 2184, 2185, 2187, 2189, 2190, 2191, 2193,
+     2194, 2197, 2198, 2199, 2200, 2201, 2201, 2202, 2203, 2204,
+     2206, 2208, 2209, 2210, 2211, 2212, 2215, 2217, 2218, 2219,
+
+     2219, 2220, 2223, 2226, 2227, 2228, 2230, 2232, 2233, 2235,
+     2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2246,
+     2247, 2248, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2260,
+     2261, 2263, 2265, 2266, 2267, 2268, 2269, 2270, 2272, 2274,
+     2275, 2278, 2279, 2282, 2286, 2287, 2288, 2289, 2290, 2291,
+     2292, 2293, 2294, 2296, 2297, 2298, 2299, 2300, 2301, 2302,
+     2303, 2304, 2305, 2306, 2307, 2309, 2310, 2311, 2312, 2313,
+     2314, 2315, 2316, 2317, 2321, 2322, 2323, 2324, 2325, 2326,
+     2327, 2328, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337,
+     2338, 2339, 2340, 2341, 2342, 2343, 2345, 2346, 2347, 2348,
+
+     2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358,
+     2359, 2360, 2361, 2362, 2363, 2364, 2366, 2367, 2368, 2369,
+     2370, 2371, 2372, 2373, 2375, 2376, 2377, 2378, 2379, 2382,
+     2383, 2384, 2386, 2388, 2388, 2388, 2388, 2388, 2388, 2388,
+     2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388,
+     2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388,
+     2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388, 2388,
+     2388, 2388, 2388, 2388
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -2305,7 +2381,7 @@ static void config_end_include(void)
 #define YY_NO_INPUT 1
 #endif
 
-#line 2307 "<stdout>"
+#line 2383 "<stdout>"
 
 #define INITIAL 0
 #define quotedstring 1
@@ -2528,7 +2604,7 @@ YY_DECL
 	{
 #line 207 "./util/configlexer.lex"
 
-#line 2530 "<stdout>"
+#line 2606 "<stdout>"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2561,13 +2637,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 2150 )
+				if ( yy_current_state >= 2389 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 4228 );
+		while ( yy_base[yy_current_state] != 4234 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -2702,935 +2778,1050 @@ YY_RULE_SETUP
 case 22:
 YY_RULE_SETUP
 #line 232 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_TCP_FASTOPEN_QUEUE) }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
 #line 233 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
+{ YDVAR(1, VAR_TCP_UPSTREAM_FASTOPEN) }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
 #line 234 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
+{ YDVAR(1, VAR_TCP_IDLE_TIMEOUT) }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
 #line 235 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_PORT) }
+{ YDVAR(1, VAR_EDNS_TCP_KEEPALIVE) }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
 #line 236 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSTEMD) }
+{ YDVAR(1, VAR_EDNS_TCP_KEEPALIVE_TIMEOUT) }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
 #line 237 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_DAEMONIZE) }
+{ YDVAR(1, VAR_ANSWER_COOKIE) }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
 #line 238 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_COOKIE_SECRET) }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
 #line 239 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_UPSTREAM_COOKIE) }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
 #line 240 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
+{ YDVAR(1, VAR_SSL_UPSTREAM) }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
 #line 241 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
+{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
 #line 242 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_RCVBUF) }
+{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
 #line 243 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_SNDBUF) }
+{ YDVAR(1, VAR_SSL_PORT) }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
 #line 244 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_REUSEPORT) }
+{ YDVAR(1, VAR_USE_SYSTEMD) }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
 #line 245 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_TRANSPARENT) }
+{ YDVAR(1, VAR_DO_DAEMONIZE) }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
 #line 246 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_FREEBIND) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
 #line 247 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CHROOT) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
 #line 248 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USERNAME) }
+{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
 #line 249 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DIRECTORY) }
+{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 250 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOGFILE) }
+{ YDVAR(1, VAR_SO_RCVBUF) }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 251 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PIDFILE) }
+{ YDVAR(1, VAR_SO_SNDBUF) }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
 #line 252 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ROOT_HINTS) }
+{ YDVAR(1, VAR_SO_REUSEPORT) }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
 #line 253 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
+{ YDVAR(1, VAR_IP_TRANSPARENT) }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
 #line 254 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
+{ YDVAR(1, VAR_IP_FREEBIND) }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
 #line 255 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
+{ YDVAR(1, VAR_CHROOT) }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
 #line 256 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
+{ YDVAR(1, VAR_USERNAME) }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
 #line 257 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
+{ YDVAR(1, VAR_DIRECTORY) }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
 #line 258 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
+{ YDVAR(1, VAR_LOGFILE) }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
 #line 259 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_TTL) }
+{ YDVAR(1, VAR_PIDFILE) }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
 #line 260 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
+{ YDVAR(1, VAR_ROOT_HINTS) }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
 #line 261 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MIN_TTL) }
+{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
 #line 262 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_HOST_TTL) }
+{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
 #line 263 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_LAME_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
 #line 264 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
+{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
 #line 265 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
+{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
 #line 266 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
+{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
 #line 267 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
+{ YDVAR(2, VAR_CACHE_PIN) }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
 #line 268 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
+{ YDVAR(1, VAR_CACHE_PIN_SUFFIX) }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 269 "./util/configlexer.lex"
-{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
+{ YDVAR(1, VAR_CACHE_PIN_MAX_SIZE) }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 270 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DELAY_CLOSE) }
+{ YDVAR(1, VAR_CACHE_PEER) }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 271 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
+{ YDVAR(1, VAR_CACHE_PEER_PORT) }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 272 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
+{ YDVAR(1, VAR_CACHE_PEER_INTERFACE) }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
 #line 273 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
+{ YDVAR(1, VAR_CACHE_PEER_RATE) }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 274 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_GLUE) }
+{ YDVAR(1, VAR_XDP_INTERFACE) }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
 #line 275 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
+{ YDVAR(1, VAR_XDP_NATIVE) }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
 #line 276 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
+{ YDVAR(1, VAR_CACHE_MAX_TTL) }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
 #line 277 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
+{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
 #line 278 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
+{ YDVAR(1, VAR_CACHE_MIN_TTL) }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
 #line 279 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
+{ YDVAR(1, VAR_INFRA_HOST_TTL) }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 280 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CAPS_WHITELIST) }
+{ YDVAR(1, VAR_INFRA_LAME_TTL) }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
 #line 281 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
+{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
 #line 282 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
+{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
 #line 283 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
+{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
 #line 284 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH_KEY) }
+{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
 #line 285 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH) }
+{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
 #line 286 "./util/configlexer.lex"
-{ YDVAR(0, VAR_STUB_ZONE) }
+{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 287 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NAME) }
+{ YDVAR(1, VAR_DELAY_CLOSE) }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 288 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_ADDR) }
+{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 289 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_HOST) }
+{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 290 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_PRIME) }
+{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 291 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_FIRST) }
+{ YDVAR(1, VAR_HARDEN_GLUE) }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 292 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 293 "./util/configlexer.lex"
-{ YDVAR(0, VAR_FORWARD_ZONE) }
+{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 294 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_ADDR) }
+{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 295 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_HOST) }
+{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 296 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_FIRST) }
+{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 297 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_CAPS_WHITELIST) }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 298 "./util/configlexer.lex"
-{ YDVAR(0, VAR_VIEW) }
+{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 299 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VIEW_FIRST) }
+{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 300 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
+{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 301 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
+{ YDVAR(1, VAR_PREFETCH_KEY) }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 302 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL) }
+{ YDVAR(1, VAR_PREFETCH) }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 303 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
+{ YDVAR(0, VAR_STUB_ZONE) }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 304 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
+{ YDVAR(1, VAR_NAME) }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 305 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
+{ YDVAR(1, VAR_STUB_ADDR) }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 306 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
+{ YDVAR(1, VAR_STUB_HOST) }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
 #line 307 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_IDENTITY) }
+{ YDVAR(1, VAR_STUB_PRIME) }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
 #line 308 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_VERSION) }
+{ YDVAR(1, VAR_STUB_FIRST) }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 309 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
+{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
 #line 310 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IDENTITY) }
+{ YDVAR(0, VAR_FORWARD_ZONE) }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
 #line 311 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VERSION) }
+{ YDVAR(1, VAR_FORWARD_ADDR) }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
 #line 312 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MODULE_CONF) }
+{ YDVAR(1, VAR_FORWARD_HOST) }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
 #line 313 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR) }
+{ YDVAR(1, VAR_FORWARD_FIRST) }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
 #line 314 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
+{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
 #line 315 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
+{ YDVAR(0, VAR_VIEW) }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
 #line 316 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_VIEW_FIRST) }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
 #line 317 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
+{ YDVAR(1, VAR_VIEW_CACHE_QUOTA) }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
 #line 318 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
 #line 319 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
 #line 320 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
+{ YDVAR(2, VAR_ACCESS_CONTROL) }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
 #line 321 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
+{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
 #line 322 "./util/configlexer.lex"
-{ YDVAR(1, VAR_BOGUS_TTL) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
 #line 323 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
 #line 324 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
 #line 325 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
+{ YDVAR(1, VAR_HIDE_IDENTITY) }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
 #line 326 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED) }
+{ YDVAR(1, VAR_HIDE_VERSION) }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
 #line 327 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_DSA) }
+{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
 #line 328 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_SHA1) }
+{ YDVAR(1, VAR_IDENTITY) }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
 #line 329 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
+{ YDVAR(1, VAR_VERSION) }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
 #line 330 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
+{ YDVAR(1, VAR_MODULE_CONF) }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
 #line 331 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
+{ YDVAR(1, VAR_DLV_ANCHOR) }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
 #line 332 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
+{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
 #line 333 "./util/configlexer.lex"
-{ 
-				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
-#line 335 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ADD_HOLDDOWN) }
+#line 334 "./util/configlexer.lex"
+{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
-#line 336 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEL_HOLDDOWN) }
+#line 335 "./util/configlexer.lex"
+{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
-#line 337 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEEP_MISSING) }
+#line 336 "./util/configlexer.lex"
+{ YDVAR(1, VAR_TRUST_ANCHOR) }
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
-#line 338 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
+#line 337 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
-#line 339 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSLOG) }
+#line 338 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
-#line 340 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_IDENTITY) }
+#line 339 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
-#line 341 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TIME_ASCII) }
+#line 340 "./util/configlexer.lex"
+{ YDVAR(1, VAR_BOGUS_TTL) }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
-#line 342 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_QUERIES) }
+#line 341 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
-#line 343 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_REPLIES) }
+#line 342 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
-#line 344 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE) }
+#line 343 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
-#line 345 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA) }
+#line 344 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED) }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
-#line 346 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
+#line 345 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAKE_DSA) }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
-#line 347 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
+#line 346 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAKE_SHA1) }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
-#line 348 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
+#line 347 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
-#line 349 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
+#line 348 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
-#line 350 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
+#line 349 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
-#line 351 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
-	YY_BREAK
+#line 350 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
+	YY_BREAK
 case 141:
 YY_RULE_SETUP
-#line 352 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_ENABLE) }
+#line 351 "./util/configlexer.lex"
+{ 
+				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 353 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_KEY) }
+{ YDVAR(1, VAR_ADD_HOLDDOWN) }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
 #line 354 "./util/configlexer.lex"
-{ YDVAR(0, VAR_REMOTE_CONTROL) }
+{ YDVAR(1, VAR_DEL_HOLDDOWN) }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
 #line 355 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_ENABLE) }
+{ YDVAR(1, VAR_KEEP_MISSING) }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
 #line 356 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
 #line 357 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_PORT) }
+{ YDVAR(1, VAR_USE_SYSLOG) }
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
 #line 358 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_USE_CERT) }
+{ YDVAR(1, VAR_LOG_IDENTITY) }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
 #line 359 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+{ YDVAR(1, VAR_LOG_TIME_ASCII) }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
 #line 360 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+{ YDVAR(1, VAR_LOG_QUERIES) }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 361 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+{ YDVAR(1, VAR_LOG_REPLIES) }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 362 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+{ YDVAR(2, VAR_LOCAL_ZONE) }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
 #line 363 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+{ YDVAR(1, VAR_LOCAL_DATA) }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 364 "./util/configlexer.lex"
-{ YDVAR(0, VAR_PYTHON) }
+{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 365 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 366 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 367 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 368 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 369 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_PREFIX) }
+{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 370 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+{ YDVAR(1, VAR_SHM_ENABLE) }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 371 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEFINE_TAG) }
+{ YDVAR(1, VAR_SHM_KEY) }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 372 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
+{ YDVAR(0, VAR_REMOTE_CONTROL) }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 373 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
+{ YDVAR(1, VAR_CONTROL_ENABLE) }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 374 "./util/configlexer.lex"
-{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
+{ YDVAR(1, VAR_CONTROL_INTERFACE) }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
 #line 375 "./util/configlexer.lex"
-{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
+{ YDVAR(1, VAR_CONTROL_PORT) }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 376 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
+{ YDVAR(1, VAR_CONTROL_USE_CERT) }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
 #line 377 "./util/configlexer.lex"
-{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
+{ YDVAR(1, VAR_SERVER_KEY_FILE) }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
 #line 378 "./util/configlexer.lex"
-{ YDVAR(0, VAR_DNSTAP) }
+{ YDVAR(1, VAR_SERVER_CERT_FILE) }
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
 #line 379 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
 #line 380 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
 #line 381 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
+{ YDVAR(1, VAR_PYTHON_SCRIPT) }
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
 #line 382 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
+{ YDVAR(0, VAR_PYTHON) }
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
 #line 383 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
+{ YDVAR(1, VAR_DOMAIN_INSECURE) }
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
 #line 384 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_VERSION) }
+{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
 #line 385 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
+{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
 	YY_BREAK
 case 175:
 YY_RULE_SETUP
+#line 386 "./util/configlexer.lex"
+{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+	YY_BREAK
+case 176:
+YY_RULE_SETUP
 #line 387 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_PREFIX) }
+	YY_BREAK
+case 177:
+YY_RULE_SETUP
+#line 388 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+	YY_BREAK
+case 178:
+YY_RULE_SETUP
+#line 389 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_SECRET) }
+	YY_BREAK
+case 179:
+YY_RULE_SETUP
+#line 390 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_COMPRESS) }
+	YY_BREAK
+case 180:
+YY_RULE_SETUP
+#line 391 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_COMPRESS_MIN) }
+	YY_BREAK
+case 181:
+YY_RULE_SETUP
+#line 392 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FORWARD_HEALTH_CHECK) }
+	YY_BREAK
+case 182:
+YY_RULE_SETUP
+#line 393 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FORWARD_PROBE_INTERVAL) }
+	YY_BREAK
+case 183:
+YY_RULE_SETUP
+#line 394 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DEFINE_TAG) }
+	YY_BREAK
+case 184:
+YY_RULE_SETUP
+#line 395 "./util/configlexer.lex"
+{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
+	YY_BREAK
+case 185:
+YY_RULE_SETUP
+#line 396 "./util/configlexer.lex"
+{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
+	YY_BREAK
+case 186:
+YY_RULE_SETUP
+#line 397 "./util/configlexer.lex"
+{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
+	YY_BREAK
+case 187:
+YY_RULE_SETUP
+#line 398 "./util/configlexer.lex"
+{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
+	YY_BREAK
+case 188:
+YY_RULE_SETUP
+#line 399 "./util/configlexer.lex"
+{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
+	YY_BREAK
+case 189:
+YY_RULE_SETUP
+#line 400 "./util/configlexer.lex"
+{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
+	YY_BREAK
+case 190:
+YY_RULE_SETUP
+#line 401 "./util/configlexer.lex"
+{ YDVAR(0, VAR_DNSTAP) }
+	YY_BREAK
+case 191:
+YY_RULE_SETUP
+#line 402 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+	YY_BREAK
+case 192:
+YY_RULE_SETUP
+#line 403 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+	YY_BREAK
+case 193:
+YY_RULE_SETUP
+#line 404 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
+	YY_BREAK
+case 194:
+YY_RULE_SETUP
+#line 405 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
+	YY_BREAK
+case 195:
+YY_RULE_SETUP
+#line 406 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
+	YY_BREAK
+case 196:
+YY_RULE_SETUP
+#line 407 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_VERSION) }
+	YY_BREAK
+case 197:
+YY_RULE_SETUP
+#line 408 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
+	YY_BREAK
+case 198:
+YY_RULE_SETUP
+#line 410 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 176:
+case 199:
 YY_RULE_SETUP
-#line 389 "./util/configlexer.lex"
+#line 412 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES) }
 	YY_BREAK
-case 177:
+case 200:
 YY_RULE_SETUP
-#line 391 "./util/configlexer.lex"
+#line 414 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 178:
+case 201:
 YY_RULE_SETUP
-#line 393 "./util/configlexer.lex"
+#line 416 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES) }
 	YY_BREAK
-case 179:
+case 202:
 YY_RULE_SETUP
-#line 395 "./util/configlexer.lex"
+#line 418 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 180:
+case 203:
 YY_RULE_SETUP
-#line 397 "./util/configlexer.lex"
+#line 420 "./util/configlexer.lex"
 { YDVAR(1, VAR_DISABLE_DNSSEC_LAME_CHECK) }
 	YY_BREAK
-case 181:
+case 204:
 YY_RULE_SETUP
-#line 398 "./util/configlexer.lex"
+#line 421 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT) }
 	YY_BREAK
-case 182:
+case 205:
 YY_RULE_SETUP
-#line 399 "./util/configlexer.lex"
+#line 422 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT) }
 	YY_BREAK
-case 183:
+case 206:
 YY_RULE_SETUP
-#line 400 "./util/configlexer.lex"
+#line 423 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_SLABS) }
 	YY_BREAK
-case 184:
+case 207:
 YY_RULE_SETUP
-#line 401 "./util/configlexer.lex"
+#line 424 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SLABS) }
 	YY_BREAK
-case 185:
+case 208:
 YY_RULE_SETUP
-#line 402 "./util/configlexer.lex"
+#line 425 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_SIZE) }
 	YY_BREAK
-case 186:
+case 209:
 YY_RULE_SETUP
-#line 403 "./util/configlexer.lex"
+#line 426 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SIZE) }
 	YY_BREAK
-case 187:
+case 210:
 YY_RULE_SETUP
-#line 404 "./util/configlexer.lex"
+#line 427 "./util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_FOR_DOMAIN) }
 	YY_BREAK
-case 188:
+case 211:
 YY_RULE_SETUP
-#line 405 "./util/configlexer.lex"
+#line 428 "./util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_BELOW_DOMAIN) }
 	YY_BREAK
-case 189:
+case 212:
 YY_RULE_SETUP
-#line 406 "./util/configlexer.lex"
+#line 429 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_FACTOR) }
 	YY_BREAK
-case 190:
+case 213:
 YY_RULE_SETUP
-#line 407 "./util/configlexer.lex"
+#line 430 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_FACTOR) }
 	YY_BREAK
-case 191:
+case 214:
 YY_RULE_SETUP
-#line 408 "./util/configlexer.lex"
+#line 431 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP_TAG) }
 	YY_BREAK
-case 192:
+case 215:
 YY_RULE_SETUP
-#line 409 "./util/configlexer.lex"
+#line 432 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP) }
 	YY_BREAK
-case 193:
+case 216:
 YY_RULE_SETUP
-#line 410 "./util/configlexer.lex"
+#line 433 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP_DATA) }
 	YY_BREAK
-case 194:
+case 217:
 YY_RULE_SETUP
-#line 411 "./util/configlexer.lex"
+#line 434 "./util/configlexer.lex"
 { YDVAR(0, VAR_DNSCRYPT) }
 	YY_BREAK
-case 195:
+case 218:
 YY_RULE_SETUP
-#line 412 "./util/configlexer.lex"
+#line 435 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_ENABLE) }
 	YY_BREAK
-case 196:
+case 219:
 YY_RULE_SETUP
-#line 413 "./util/configlexer.lex"
+#line 436 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PORT) }
 	YY_BREAK
-case 197:
+case 220:
 YY_RULE_SETUP
-#line 414 "./util/configlexer.lex"
+#line 437 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PROVIDER) }
 	YY_BREAK
-case 198:
+case 221:
 YY_RULE_SETUP
-#line 415 "./util/configlexer.lex"
+#line 438 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_SECRET_KEY) }
 	YY_BREAK
-case 199:
+case 222:
 YY_RULE_SETUP
-#line 416 "./util/configlexer.lex"
+#line 439 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT) }
 	YY_BREAK
-case 200:
-/* rule 200 can match eol */
+case 223:
+/* rule 223 can match eol */
 YY_RULE_SETUP
-#line 417 "./util/configlexer.lex"
+#line 440 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++; }
 	YY_BREAK
 /* Quoted strings. Strip leading and ending quotes */
-case 201:
+case 224:
 YY_RULE_SETUP
-#line 420 "./util/configlexer.lex"
+#line 443 "./util/configlexer.lex"
 { BEGIN(quotedstring); LEXOUT(("QS ")); }
 	YY_BREAK
 case YY_STATE_EOF(quotedstring):
-#line 421 "./util/configlexer.lex"
+#line 444 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 202:
+case 225:
 YY_RULE_SETUP
-#line 426 "./util/configlexer.lex"
+#line 449 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 203:
-/* rule 203 can match eol */
+case 226:
+/* rule 226 can match eol */
 YY_RULE_SETUP
-#line 427 "./util/configlexer.lex"
+#line 450 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end \""); 
 			  cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 204:
+case 227:
 YY_RULE_SETUP
-#line 429 "./util/configlexer.lex"
+#line 452 "./util/configlexer.lex"
 {
         LEXOUT(("QE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -3643,34 +3834,34 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* Single Quoted strings. Strip leading and ending quotes */
-case 205:
+case 228:
 YY_RULE_SETUP
-#line 441 "./util/configlexer.lex"
+#line 464 "./util/configlexer.lex"
 { BEGIN(singlequotedstr); LEXOUT(("SQS ")); }
 	YY_BREAK
 case YY_STATE_EOF(singlequotedstr):
-#line 442 "./util/configlexer.lex"
+#line 465 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 206:
+case 229:
 YY_RULE_SETUP
-#line 447 "./util/configlexer.lex"
+#line 470 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 207:
-/* rule 207 can match eol */
+case 230:
+/* rule 230 can match eol */
 YY_RULE_SETUP
-#line 448 "./util/configlexer.lex"
+#line 471 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end '"); 
 			     cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 208:
+case 231:
 YY_RULE_SETUP
-#line 450 "./util/configlexer.lex"
+#line 473 "./util/configlexer.lex"
 {
         LEXOUT(("SQE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -3683,38 +3874,38 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* include: directive */
-case 209:
+case 232:
 YY_RULE_SETUP
-#line 462 "./util/configlexer.lex"
+#line 485 "./util/configlexer.lex"
 { 
 	LEXOUT(("v(%s) ", yytext)); inc_prev = YYSTATE; BEGIN(include); }
 	YY_BREAK
 case YY_STATE_EOF(include):
-#line 464 "./util/configlexer.lex"
+#line 487 "./util/configlexer.lex"
 {
         yyerror("EOF inside include directive");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 210:
+case 233:
 YY_RULE_SETUP
-#line 468 "./util/configlexer.lex"
+#line 491 "./util/configlexer.lex"
 { LEXOUT(("ISP ")); /* ignore */ }
 	YY_BREAK
-case 211:
-/* rule 211 can match eol */
+case 234:
+/* rule 234 can match eol */
 YY_RULE_SETUP
-#line 469 "./util/configlexer.lex"
+#line 492 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++;}
 	YY_BREAK
-case 212:
+case 235:
 YY_RULE_SETUP
-#line 470 "./util/configlexer.lex"
+#line 493 "./util/configlexer.lex"
 { LEXOUT(("IQS ")); BEGIN(include_quoted); }
 	YY_BREAK
-case 213:
+case 236:
 YY_RULE_SETUP
-#line 471 "./util/configlexer.lex"
+#line 494 "./util/configlexer.lex"
 {
 	LEXOUT(("Iunquotedstr(%s) ", yytext));
 	config_start_include_glob(yytext);
@@ -3722,27 +3913,27 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case YY_STATE_EOF(include_quoted):
-#line 476 "./util/configlexer.lex"
+#line 499 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 214:
+case 237:
 YY_RULE_SETUP
-#line 480 "./util/configlexer.lex"
+#line 503 "./util/configlexer.lex"
 { LEXOUT(("ISTR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 215:
-/* rule 215 can match eol */
+case 238:
+/* rule 238 can match eol */
 YY_RULE_SETUP
-#line 481 "./util/configlexer.lex"
+#line 504 "./util/configlexer.lex"
 { yyerror("newline before \" in include name"); 
 				  cfg_parser->line++; BEGIN(inc_prev); }
 	YY_BREAK
-case 216:
+case 239:
 YY_RULE_SETUP
-#line 483 "./util/configlexer.lex"
+#line 506 "./util/configlexer.lex"
 {
 	LEXOUT(("IQE "));
 	yytext[yyleng - 1] = '\0';
@@ -3752,7 +3943,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(val):
-#line 489 "./util/configlexer.lex"
+#line 512 "./util/configlexer.lex"
 {
 	LEXOUT(("LEXEOF "));
 	yy_set_bol(1); /* Set beginning of line, so "^" rules match.  */
@@ -3764,33 +3955,33 @@ case YY_STATE_EOF(val):
 	}
 }
 	YY_BREAK
-case 217:
+case 240:
 YY_RULE_SETUP
-#line 500 "./util/configlexer.lex"
+#line 523 "./util/configlexer.lex"
 { LEXOUT(("unquotedstr(%s) ", yytext)); 
 			if(--num_args == 0) { BEGIN(INITIAL); }
 			yylval.str = strdup(yytext); return STRING_ARG; }
 	YY_BREAK
-case 218:
+case 241:
 YY_RULE_SETUP
-#line 504 "./util/configlexer.lex"
+#line 527 "./util/configlexer.lex"
 {
 	ub_c_error_msg("unknown keyword '%s'", yytext);
 	}
 	YY_BREAK
-case 219:
+case 242:
 YY_RULE_SETUP
-#line 508 "./util/configlexer.lex"
+#line 531 "./util/configlexer.lex"
 {
 	ub_c_error_msg("stray '%s'", yytext);
 	}
 	YY_BREAK
-case 220:
+case 243:
 YY_RULE_SETUP
-#line 512 "./util/configlexer.lex"
+#line 535 "./util/configlexer.lex"
 ECHO;
 	YY_BREAK
-#line 3792 "<stdout>"
+#line 3983 "<stdout>"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4081,7 +4272,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 2150 )
+			if ( yy_current_state >= 2389 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -4109,11 +4300,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 2150 )
+		if ( yy_current_state >= 2389 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 2149);
+	yy_is_jam = (yy_current_state == 2388);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,8 @@
 
 
 
-/* Copy the first part of user declarations.  */
-#line 38 "./util/configparser.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 38 "util/configparser.y"
 
 #include "config.h"
 
@@ -91,507 +96,600 @@ extern struct config_parser_state* cfg_parser;
 #endif
 
 
-#line 95 "util/configparser.c" /* yacc.c:339  */
+#line 100 "util/configparser.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "configparser.h".  */
-#ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-# define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    SPACE = 258,
-    LETTER = 259,
-    NEWLINE = 260,
-    COMMENT = 261,
-    COLON = 262,
-    ANY = 263,
-    ZONESTR = 264,
-    STRING_ARG = 265,
-    VAR_SERVER = 266,
-    VAR_VERBOSITY = 267,
-    VAR_NUM_THREADS = 268,
-    VAR_PORT = 269,
-    VAR_OUTGOING_RANGE = 270,
-    VAR_INTERFACE = 271,
-    VAR_DO_IP4 = 272,
-    VAR_DO_IP6 = 273,
-    VAR_PREFER_IP6 = 274,
-    VAR_DO_UDP = 275,
-    VAR_DO_TCP = 276,
-    VAR_TCP_MSS = 277,
-    VAR_OUTGOING_TCP_MSS = 278,
-    VAR_CHROOT = 279,
-    VAR_USERNAME = 280,
-    VAR_DIRECTORY = 281,
-    VAR_LOGFILE = 282,
-    VAR_PIDFILE = 283,
-    VAR_MSG_CACHE_SIZE = 284,
-    VAR_MSG_CACHE_SLABS = 285,
-    VAR_NUM_QUERIES_PER_THREAD = 286,
-    VAR_RRSET_CACHE_SIZE = 287,
-    VAR_RRSET_CACHE_SLABS = 288,
-    VAR_OUTGOING_NUM_TCP = 289,
-    VAR_INFRA_HOST_TTL = 290,
-    VAR_INFRA_LAME_TTL = 291,
-    VAR_INFRA_CACHE_SLABS = 292,
-    VAR_INFRA_CACHE_NUMHOSTS = 293,
-    VAR_INFRA_CACHE_LAME_SIZE = 294,
-    VAR_NAME = 295,
-    VAR_STUB_ZONE = 296,
-    VAR_STUB_HOST = 297,
-    VAR_STUB_ADDR = 298,
-    VAR_TARGET_FETCH_POLICY = 299,
-    VAR_HARDEN_SHORT_BUFSIZE = 300,
-    VAR_HARDEN_LARGE_QUERIES = 301,
-    VAR_FORWARD_ZONE = 302,
-    VAR_FORWARD_HOST = 303,
-    VAR_FORWARD_ADDR = 304,
-    VAR_DO_NOT_QUERY_ADDRESS = 305,
-    VAR_HIDE_IDENTITY = 306,
-    VAR_HIDE_VERSION = 307,
-    VAR_IDENTITY = 308,
-    VAR_VERSION = 309,
-    VAR_HARDEN_GLUE = 310,
-    VAR_MODULE_CONF = 311,
-    VAR_TRUST_ANCHOR_FILE = 312,
-    VAR_TRUST_ANCHOR = 313,
-    VAR_VAL_OVERRIDE_DATE = 314,
-    VAR_BOGUS_TTL = 315,
-    VAR_VAL_CLEAN_ADDITIONAL = 316,
-    VAR_VAL_PERMISSIVE_MODE = 317,
-    VAR_INCOMING_NUM_TCP = 318,
-    VAR_MSG_BUFFER_SIZE = 319,
-    VAR_KEY_CACHE_SIZE = 320,
-    VAR_KEY_CACHE_SLABS = 321,
-    VAR_TRUSTED_KEYS_FILE = 322,
-    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 323,
-    VAR_USE_SYSLOG = 324,
-    VAR_OUTGOING_INTERFACE = 325,
-    VAR_ROOT_HINTS = 326,
-    VAR_DO_NOT_QUERY_LOCALHOST = 327,
-    VAR_CACHE_MAX_TTL = 328,
-    VAR_HARDEN_DNSSEC_STRIPPED = 329,
-    VAR_ACCESS_CONTROL = 330,
-    VAR_LOCAL_ZONE = 331,
-    VAR_LOCAL_DATA = 332,
-    VAR_INTERFACE_AUTOMATIC = 333,
-    VAR_STATISTICS_INTERVAL = 334,
-    VAR_DO_DAEMONIZE = 335,
-    VAR_USE_CAPS_FOR_ID = 336,
-    VAR_STATISTICS_CUMULATIVE = 337,
-    VAR_OUTGOING_PORT_PERMIT = 338,
-    VAR_OUTGOING_PORT_AVOID = 339,
-    VAR_DLV_ANCHOR_FILE = 340,
-    VAR_DLV_ANCHOR = 341,
-    VAR_NEG_CACHE_SIZE = 342,
-    VAR_HARDEN_REFERRAL_PATH = 343,
-    VAR_PRIVATE_ADDRESS = 344,
-    VAR_PRIVATE_DOMAIN = 345,
-    VAR_REMOTE_CONTROL = 346,
-    VAR_CONTROL_ENABLE = 347,
-    VAR_CONTROL_INTERFACE = 348,
-    VAR_CONTROL_PORT = 349,
-    VAR_SERVER_KEY_FILE = 350,
-    VAR_SERVER_CERT_FILE = 351,
-    VAR_CONTROL_KEY_FILE = 352,
-    VAR_CONTROL_CERT_FILE = 353,
-    VAR_CONTROL_USE_CERT = 354,
-    VAR_EXTENDED_STATISTICS = 355,
-    VAR_LOCAL_DATA_PTR = 356,
-    VAR_JOSTLE_TIMEOUT = 357,
-    VAR_STUB_PRIME = 358,
-    VAR_UNWANTED_REPLY_THRESHOLD = 359,
-    VAR_LOG_TIME_ASCII = 360,
-    VAR_DOMAIN_INSECURE = 361,
-    VAR_PYTHON = 362,
-    VAR_PYTHON_SCRIPT = 363,
-    VAR_VAL_SIG_SKEW_MIN = 364,
-    VAR_VAL_SIG_SKEW_MAX = 365,
-    VAR_CACHE_MIN_TTL = 366,
-    VAR_VAL_LOG_LEVEL = 367,
-    VAR_AUTO_TRUST_ANCHOR_FILE = 368,
-    VAR_KEEP_MISSING = 369,
-    VAR_ADD_HOLDDOWN = 370,
-    VAR_DEL_HOLDDOWN = 371,
-    VAR_SO_RCVBUF = 372,
-    VAR_EDNS_BUFFER_SIZE = 373,
-    VAR_PREFETCH = 374,
-    VAR_PREFETCH_KEY = 375,
-    VAR_SO_SNDBUF = 376,
-    VAR_SO_REUSEPORT = 377,
-    VAR_HARDEN_BELOW_NXDOMAIN = 378,
-    VAR_IGNORE_CD_FLAG = 379,
-    VAR_LOG_QUERIES = 380,
-    VAR_LOG_REPLIES = 381,
-    VAR_TCP_UPSTREAM = 382,
-    VAR_SSL_UPSTREAM = 383,
-    VAR_SSL_SERVICE_KEY = 384,
-    VAR_SSL_SERVICE_PEM = 385,
-    VAR_SSL_PORT = 386,
-    VAR_FORWARD_FIRST = 387,
-    VAR_STUB_SSL_UPSTREAM = 388,
-    VAR_FORWARD_SSL_UPSTREAM = 389,
-    VAR_STUB_FIRST = 390,
-    VAR_MINIMAL_RESPONSES = 391,
-    VAR_RRSET_ROUNDROBIN = 392,
-    VAR_MAX_UDP_SIZE = 393,
-    VAR_DELAY_CLOSE = 394,
-    VAR_UNBLOCK_LAN_ZONES = 395,
-    VAR_INSECURE_LAN_ZONES = 396,
-    VAR_INFRA_CACHE_MIN_RTT = 397,
-    VAR_DNS64_PREFIX = 398,
-    VAR_DNS64_SYNTHALL = 399,
-    VAR_DNSTAP = 400,
-    VAR_DNSTAP_ENABLE = 401,
-    VAR_DNSTAP_SOCKET_PATH = 402,
-    VAR_DNSTAP_SEND_IDENTITY = 403,
-    VAR_DNSTAP_SEND_VERSION = 404,
-    VAR_DNSTAP_IDENTITY = 405,
-    VAR_DNSTAP_VERSION = 406,
-    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 407,
-    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 408,
-    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 409,
-    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 410,
-    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 411,
-    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 412,
-    VAR_RESPONSE_IP_TAG = 413,
-    VAR_RESPONSE_IP = 414,
-    VAR_RESPONSE_IP_DATA = 415,
-    VAR_HARDEN_ALGO_DOWNGRADE = 416,
-    VAR_IP_TRANSPARENT = 417,
-    VAR_DISABLE_DNSSEC_LAME_CHECK = 418,
-    VAR_IP_RATELIMIT = 419,
-    VAR_IP_RATELIMIT_SLABS = 420,
-    VAR_IP_RATELIMIT_SIZE = 421,
-    VAR_RATELIMIT = 422,
-    VAR_RATELIMIT_SLABS = 423,
-    VAR_RATELIMIT_SIZE = 424,
-    VAR_RATELIMIT_FOR_DOMAIN = 425,
-    VAR_RATELIMIT_BELOW_DOMAIN = 426,
-    VAR_IP_RATELIMIT_FACTOR = 427,
-    VAR_RATELIMIT_FACTOR = 428,
-    VAR_SEND_CLIENT_SUBNET = 429,
-    VAR_CLIENT_SUBNET_OPCODE = 430,
-    VAR_MAX_CLIENT_SUBNET_IPV4 = 431,
-    VAR_MAX_CLIENT_SUBNET_IPV6 = 432,
-    VAR_CAPS_WHITELIST = 433,
-    VAR_CACHE_MAX_NEGATIVE_TTL = 434,
-    VAR_PERMIT_SMALL_HOLDDOWN = 435,
-    VAR_QNAME_MINIMISATION = 436,
-    VAR_QNAME_MINIMISATION_STRICT = 437,
-    VAR_IP_FREEBIND = 438,
-    VAR_DEFINE_TAG = 439,
-    VAR_LOCAL_ZONE_TAG = 440,
-    VAR_ACCESS_CONTROL_TAG = 441,
-    VAR_LOCAL_ZONE_OVERRIDE = 442,
-    VAR_ACCESS_CONTROL_TAG_ACTION = 443,
-    VAR_ACCESS_CONTROL_TAG_DATA = 444,
-    VAR_VIEW = 445,
-    VAR_ACCESS_CONTROL_VIEW = 446,
-    VAR_VIEW_FIRST = 447,
-    VAR_SERVE_EXPIRED = 448,
-    VAR_FAKE_DSA = 449,
-    VAR_FAKE_SHA1 = 450,
-    VAR_LOG_IDENTITY = 451,
-    VAR_HIDE_TRUSTANCHOR = 452,
-    VAR_USE_SYSTEMD = 453,
-    VAR_SHM_ENABLE = 454,
-    VAR_SHM_KEY = 455,
-    VAR_DNSCRYPT = 456,
-    VAR_DNSCRYPT_ENABLE = 457,
-    VAR_DNSCRYPT_PORT = 458,
-    VAR_DNSCRYPT_PROVIDER = 459,
-    VAR_DNSCRYPT_SECRET_KEY = 460,
-    VAR_DNSCRYPT_PROVIDER_CERT = 461
-  };
-#endif
-/* Tokens.  */
-#define SPACE 258
-#define LETTER 259
-#define NEWLINE 260
-#define COMMENT 261
-#define COLON 262
-#define ANY 263
-#define ZONESTR 264
-#define STRING_ARG 265
-#define VAR_SERVER 266
-#define VAR_VERBOSITY 267
-#define VAR_NUM_THREADS 268
-#define VAR_PORT 269
-#define VAR_OUTGOING_RANGE 270
-#define VAR_INTERFACE 271
-#define VAR_DO_IP4 272
-#define VAR_DO_IP6 273
-#define VAR_PREFER_IP6 274
-#define VAR_DO_UDP 275
-#define VAR_DO_TCP 276
-#define VAR_TCP_MSS 277
-#define VAR_OUTGOING_TCP_MSS 278
-#define VAR_CHROOT 279
-#define VAR_USERNAME 280
-#define VAR_DIRECTORY 281
-#define VAR_LOGFILE 282
-#define VAR_PIDFILE 283
-#define VAR_MSG_CACHE_SIZE 284
-#define VAR_MSG_CACHE_SLABS 285
-#define VAR_NUM_QUERIES_PER_THREAD 286
-#define VAR_RRSET_CACHE_SIZE 287
-#define VAR_RRSET_CACHE_SLABS 288
-#define VAR_OUTGOING_NUM_TCP 289
-#define VAR_INFRA_HOST_TTL 290
-#define VAR_INFRA_LAME_TTL 291
-#define VAR_INFRA_CACHE_SLABS 292
-#define VAR_INFRA_CACHE_NUMHOSTS 293
-#define VAR_INFRA_CACHE_LAME_SIZE 294
-#define VAR_NAME 295
-#define VAR_STUB_ZONE 296
-#define VAR_STUB_HOST 297
-#define VAR_STUB_ADDR 298
-#define VAR_TARGET_FETCH_POLICY 299
-#define VAR_HARDEN_SHORT_BUFSIZE 300
-#define VAR_HARDEN_LARGE_QUERIES 301
-#define VAR_FORWARD_ZONE 302
-#define VAR_FORWARD_HOST 303
-#define VAR_FORWARD_ADDR 304
-#define VAR_DO_NOT_QUERY_ADDRESS 305
-#define VAR_HIDE_IDENTITY 306
-#define VAR_HIDE_VERSION 307
-#define VAR_IDENTITY 308
-#define VAR_VERSION 309
-#define VAR_HARDEN_GLUE 310
-#define VAR_MODULE_CONF 311
-#define VAR_TRUST_ANCHOR_FILE 312
-#define VAR_TRUST_ANCHOR 313
-#define VAR_VAL_OVERRIDE_DATE 314
-#define VAR_BOGUS_TTL 315
-#define VAR_VAL_CLEAN_ADDITIONAL 316
-#define VAR_VAL_PERMISSIVE_MODE 317
-#define VAR_INCOMING_NUM_TCP 318
-#define VAR_MSG_BUFFER_SIZE 319
-#define VAR_KEY_CACHE_SIZE 320
-#define VAR_KEY_CACHE_SLABS 321
-#define VAR_TRUSTED_KEYS_FILE 322
-#define VAR_VAL_NSEC3_KEYSIZE_ITERATIONS 323
-#define VAR_USE_SYSLOG 324
-#define VAR_OUTGOING_INTERFACE 325
-#define VAR_ROOT_HINTS 326
-#define VAR_DO_NOT_QUERY_LOCALHOST 327
-#define VAR_CACHE_MAX_TTL 328
-#define VAR_HARDEN_DNSSEC_STRIPPED 329
-#define VAR_ACCESS_CONTROL 330
-#define VAR_LOCAL_ZONE 331
-#define VAR_LOCAL_DATA 332
-#define VAR_INTERFACE_AUTOMATIC 333
-#define VAR_STATISTICS_INTERVAL 334
-#define VAR_DO_DAEMONIZE 335
-#define VAR_USE_CAPS_FOR_ID 336
-#define VAR_STATISTICS_CUMULATIVE 337
-#define VAR_OUTGOING_PORT_PERMIT 338
-#define VAR_OUTGOING_PORT_AVOID 339
-#define VAR_DLV_ANCHOR_FILE 340
-#define VAR_DLV_ANCHOR 341
-#define VAR_NEG_CACHE_SIZE 342
-#define VAR_HARDEN_REFERRAL_PATH 343
-#define VAR_PRIVATE_ADDRESS 344
-#define VAR_PRIVATE_DOMAIN 345
-#define VAR_REMOTE_CONTROL 346
-#define VAR_CONTROL_ENABLE 347
-#define VAR_CONTROL_INTERFACE 348
-#define VAR_CONTROL_PORT 349
-#define VAR_SERVER_KEY_FILE 350
-#define VAR_SERVER_CERT_FILE 351
-#define VAR_CONTROL_KEY_FILE 352
-#define VAR_CONTROL_CERT_FILE 353
-#define VAR_CONTROL_USE_CERT 354
-#define VAR_EXTENDED_STATISTICS 355
-#define VAR_LOCAL_DATA_PTR 356
-#define VAR_JOSTLE_TIMEOUT 357
-#define VAR_STUB_PRIME 358
-#define VAR_UNWANTED_REPLY_THRESHOLD 359
-#define VAR_LOG_TIME_ASCII 360
-#define VAR_DOMAIN_INSECURE 361
-#define VAR_PYTHON 362
-#define VAR_PYTHON_SCRIPT 363
-#define VAR_VAL_SIG_SKEW_MIN 364
-#define VAR_VAL_SIG_SKEW_MAX 365
-#define VAR_CACHE_MIN_TTL 366
-#define VAR_VAL_LOG_LEVEL 367
-#define VAR_AUTO_TRUST_ANCHOR_FILE 368
-#define VAR_KEEP_MISSING 369
-#define VAR_ADD_HOLDDOWN 370
-#define VAR_DEL_HOLDDOWN 371
-#define VAR_SO_RCVBUF 372
-#define VAR_EDNS_BUFFER_SIZE 373
-#define VAR_PREFETCH 374
-#define VAR_PREFETCH_KEY 375
-#define VAR_SO_SNDBUF 376
-#define VAR_SO_REUSEPORT 377
-#define VAR_HARDEN_BELOW_NXDOMAIN 378
-#define VAR_IGNORE_CD_FLAG 379
-#define VAR_LOG_QUERIES 380
-#define VAR_LOG_REPLIES 381
-#define VAR_TCP_UPSTREAM 382
-#define VAR_SSL_UPSTREAM 383
-#define VAR_SSL_SERVICE_KEY 384
-#define VAR_SSL_SERVICE_PEM 385
-#define VAR_SSL_PORT 386
-#define VAR_FORWARD_FIRST 387
-#define VAR_STUB_SSL_UPSTREAM 388
-#define VAR_FORWARD_SSL_UPSTREAM 389
-#define VAR_STUB_FIRST 390
-#define VAR_MINIMAL_RESPONSES 391
-#define VAR_RRSET_ROUNDROBIN 392
-#define VAR_MAX_UDP_SIZE 393
-#define VAR_DELAY_CLOSE 394
-#define VAR_UNBLOCK_LAN_ZONES 395
-#define VAR_INSECURE_LAN_ZONES 396
-#define VAR_INFRA_CACHE_MIN_RTT 397
-#define VAR_DNS64_PREFIX 398
-#define VAR_DNS64_SYNTHALL 399
-#define VAR_DNSTAP 400
-#define VAR_DNSTAP_ENABLE 401
-#define VAR_DNSTAP_SOCKET_PATH 402
-#define VAR_DNSTAP_SEND_IDENTITY 403
-#define VAR_DNSTAP_SEND_VERSION 404
-#define VAR_DNSTAP_IDENTITY 405
-#define VAR_DNSTAP_VERSION 406
-#define VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES 407
-#define VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES 408
-#define VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES 409
-#define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 410
-#define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 411
-#define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 412
-#define VAR_RESPONSE_IP_TAG 413
-#define VAR_RESPONSE_IP 414
-#define VAR_RESPONSE_IP_DATA 415
-#define VAR_HARDEN_ALGO_DOWNGRADE 416
-#define VAR_IP_TRANSPARENT 417
-#define VAR_DISABLE_DNSSEC_LAME_CHECK 418
-#define VAR_IP_RATELIMIT 419
-#define VAR_IP_RATELIMIT_SLABS 420
-#define VAR_IP_RATELIMIT_SIZE 421
-#define VAR_RATELIMIT 422
-#define VAR_RATELIMIT_SLABS 423
-#define VAR_RATELIMIT_SIZE 424
-#define VAR_RATELIMIT_FOR_DOMAIN 425
-#define VAR_RATELIMIT_BELOW_DOMAIN 426
-#define VAR_IP_RATELIMIT_FACTOR 427
-#define VAR_RATELIMIT_FACTOR 428
-#define VAR_SEND_CLIENT_SUBNET 429
-#define VAR_CLIENT_SUBNET_OPCODE 430
-#define VAR_MAX_CLIENT_SUBNET_IPV4 431
-#define VAR_MAX_CLIENT_SUBNET_IPV6 432
-#define VAR_CAPS_WHITELIST 433
-#define VAR_CACHE_MAX_NEGATIVE_TTL 434
-#define VAR_PERMIT_SMALL_HOLDDOWN 435
-#define VAR_QNAME_MINIMISATION 436
-#define VAR_QNAME_MINIMISATION_STRICT 437
-#define VAR_IP_FREEBIND 438
-#define VAR_DEFINE_TAG 439
-#define VAR_LOCAL_ZONE_TAG 440
-#define VAR_ACCESS_CONTROL_TAG 441
-#define VAR_LOCAL_ZONE_OVERRIDE 442
-#define VAR_ACCESS_CONTROL_TAG_ACTION 443
-#define VAR_ACCESS_CONTROL_TAG_DATA 444
-#define VAR_VIEW 445
-#define VAR_ACCESS_CONTROL_VIEW 446
-#define VAR_VIEW_FIRST 447
-#define VAR_SERVE_EXPIRED 448
-#define VAR_FAKE_DSA 449
-#define VAR_FAKE_SHA1 450
-#define VAR_LOG_IDENTITY 451
-#define VAR_HIDE_TRUSTANCHOR 452
-#define VAR_USE_SYSTEMD 453
-#define VAR_SHM_ENABLE 454
-#define VAR_SHM_KEY 455
-#define VAR_DNSCRYPT 456
-#define VAR_DNSCRYPT_ENABLE 457
-#define VAR_DNSCRYPT_PORT 458
-#define VAR_DNSCRYPT_PROVIDER 459
-#define VAR_DNSCRYPT_SECRET_KEY 460
-#define VAR_DNSCRYPT_PROVIDER_CERT 461
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
-union YYSTYPE
+#include "configparser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 66 "./util/configparser.y" /* yacc.c:355  */
-
-	char*	str;
-
-#line 551 "util/configparser.c" /* yacc.c:355  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SPACE = 3,                      /* SPACE  */
+  YYSYMBOL_LETTER = 4,                     /* LETTER  */
+  YYSYMBOL_NEWLINE = 5,                    /* NEWLINE  */
+  YYSYMBOL_COMMENT = 6,                    /* COMMENT  */
+  YYSYMBOL_COLON = 7,                      /* COLON  */
+  YYSYMBOL_ANY = 8,                        /* ANY  */
+  YYSYMBOL_ZONESTR = 9,                    /* ZONESTR  */
+  YYSYMBOL_STRING_ARG = 10,                /* STRING_ARG  */
+  YYSYMBOL_VAR_SERVER = 11,                /* VAR_SERVER  */
+  YYSYMBOL_VAR_VERBOSITY = 12,             /* VAR_VERBOSITY  */
+  YYSYMBOL_VAR_NUM_THREADS = 13,           /* VAR_NUM_THREADS  */
+  YYSYMBOL_VAR_PORT = 14,                  /* VAR_PORT  */
+  YYSYMBOL_VAR_OUTGOING_RANGE = 15,        /* VAR_OUTGOING_RANGE  */
+  YYSYMBOL_VAR_INTERFACE = 16,             /* VAR_INTERFACE  */
+  YYSYMBOL_VAR_DO_IP4 = 17,                /* VAR_DO_IP4  */
+  YYSYMBOL_VAR_DO_IP6 = 18,                /* VAR_DO_IP6  */
+  YYSYMBOL_VAR_PREFER_IP6 = 19,            /* VAR_PREFER_IP6  */
+  YYSYMBOL_VAR_DO_UDP = 20,                /* VAR_DO_UDP  */
+  YYSYMBOL_VAR_DO_TCP = 21,                /* VAR_DO_TCP  */
+  YYSYMBOL_VAR_TCP_MSS = 22,               /* VAR_TCP_MSS  */
+  YYSYMBOL_VAR_OUTGOING_TCP_MSS = 23,      /* VAR_OUTGOING_TCP_MSS  */
+  YYSYMBOL_VAR_CHROOT = 24,                /* VAR_CHROOT  */
+  YYSYMBOL_VAR_USERNAME = 25,              /* VAR_USERNAME  */
+  YYSYMBOL_VAR_DIRECTORY = 26,             /* VAR_DIRECTORY  */
+  YYSYMBOL_VAR_LOGFILE = 27,               /* VAR_LOGFILE  */
+  YYSYMBOL_VAR_PIDFILE = 28,               /* VAR_PIDFILE  */
+  YYSYMBOL_VAR_MSG_CACHE_SIZE = 29,        /* VAR_MSG_CACHE_SIZE  */
+  YYSYMBOL_VAR_MSG_CACHE_SLABS = 30,       /* VAR_MSG_CACHE_SLABS  */
+  YYSYMBOL_VAR_NUM_QUERIES_PER_THREAD = 31, /* VAR_NUM_QUERIES_PER_THREAD  */
+  YYSYMBOL_VAR_RRSET_CACHE_SIZE = 32,      /* VAR_RRSET_CACHE_SIZE  */
+  YYSYMBOL_VAR_RRSET_CACHE_SLABS = 33,     /* VAR_RRSET_CACHE_SLABS  */
+  YYSYMBOL_VAR_OUTGOING_NUM_TCP = 34,      /* VAR_OUTGOING_NUM_TCP  */
+  YYSYMBOL_VAR_INFRA_HOST_TTL = 35,        /* VAR_INFRA_HOST_TTL  */
+  YYSYMBOL_VAR_INFRA_LAME_TTL = 36,        /* VAR_INFRA_LAME_TTL  */
+  YYSYMBOL_VAR_INFRA_CACHE_SLABS = 37,     /* VAR_INFRA_CACHE_SLABS  */
+  YYSYMBOL_VAR_INFRA_CACHE_NUMHOSTS = 38,  /* VAR_INFRA_CACHE_NUMHOSTS  */
+  YYSYMBOL_VAR_INFRA_CACHE_LAME_SIZE = 39, /* VAR_INFRA_CACHE_LAME_SIZE  */
+  YYSYMBOL_VAR_NAME = 40,                  /* VAR_NAME  */
+  YYSYMBOL_VAR_STUB_ZONE = 41,             /* VAR_STUB_ZONE  */
+  YYSYMBOL_VAR_STUB_HOST = 42,             /* VAR_STUB_HOST  */
+  YYSYMBOL_VAR_STUB_ADDR = 43,             /* VAR_STUB_ADDR  */
+  YYSYMBOL_VAR_TARGET_FETCH_POLICY = 44,   /* VAR_TARGET_FETCH_POLICY  */
+  YYSYMBOL_VAR_HARDEN_SHORT_BUFSIZE = 45,  /* VAR_HARDEN_SHORT_BUFSIZE  */
+  YYSYMBOL_VAR_HARDEN_LARGE_QUERIES = 46,  /* VAR_HARDEN_LARGE_QUERIES  */
+  YYSYMBOL_VAR_FORWARD_ZONE = 47,          /* VAR_FORWARD_ZONE  */
+  YYSYMBOL_VAR_FORWARD_HOST = 48,          /* VAR_FORWARD_HOST  */
+  YYSYMBOL_VAR_FORWARD_ADDR = 49,          /* VAR_FORWARD_ADDR  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_ADDRESS = 50,  /* VAR_DO_NOT_QUERY_ADDRESS  */
+  YYSYMBOL_VAR_HIDE_IDENTITY = 51,         /* VAR_HIDE_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_VERSION = 52,          /* VAR_HIDE_VERSION  */
+  YYSYMBOL_VAR_IDENTITY = 53,              /* VAR_IDENTITY  */
+  YYSYMBOL_VAR_VERSION = 54,               /* VAR_VERSION  */
+  YYSYMBOL_VAR_HARDEN_GLUE = 55,           /* VAR_HARDEN_GLUE  */
+  YYSYMBOL_VAR_MODULE_CONF = 56,           /* VAR_MODULE_CONF  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_FILE = 57,     /* VAR_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_TRUST_ANCHOR = 58,          /* VAR_TRUST_ANCHOR  */
+  YYSYMBOL_VAR_VAL_OVERRIDE_DATE = 59,     /* VAR_VAL_OVERRIDE_DATE  */
+  YYSYMBOL_VAR_BOGUS_TTL = 60,             /* VAR_BOGUS_TTL  */
+  YYSYMBOL_VAR_VAL_CLEAN_ADDITIONAL = 61,  /* VAR_VAL_CLEAN_ADDITIONAL  */
+  YYSYMBOL_VAR_VAL_PERMISSIVE_MODE = 62,   /* VAR_VAL_PERMISSIVE_MODE  */
+  YYSYMBOL_VAR_INCOMING_NUM_TCP = 63,      /* VAR_INCOMING_NUM_TCP  */
+  YYSYMBOL_VAR_MSG_BUFFER_SIZE = 64,       /* VAR_MSG_BUFFER_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SIZE = 65,        /* VAR_KEY_CACHE_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SLABS = 66,       /* VAR_KEY_CACHE_SLABS  */
+  YYSYMBOL_VAR_TRUSTED_KEYS_FILE = 67,     /* VAR_TRUSTED_KEYS_FILE  */
+  YYSYMBOL_VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 68, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
+  YYSYMBOL_VAR_USE_SYSLOG = 69,            /* VAR_USE_SYSLOG  */
+  YYSYMBOL_VAR_OUTGOING_INTERFACE = 70,    /* VAR_OUTGOING_INTERFACE  */
+  YYSYMBOL_VAR_ROOT_HINTS = 71,            /* VAR_ROOT_HINTS  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_LOCALHOST = 72, /* VAR_DO_NOT_QUERY_LOCALHOST  */
+  YYSYMBOL_VAR_CACHE_MAX_TTL = 73,         /* VAR_CACHE_MAX_TTL  */
+  YYSYMBOL_VAR_HARDEN_DNSSEC_STRIPPED = 74, /* VAR_HARDEN_DNSSEC_STRIPPED  */
+  YYSYMBOL_VAR_ACCESS_CONTROL = 75,        /* VAR_ACCESS_CONTROL  */
+  YYSYMBOL_VAR_LOCAL_ZONE = 76,            /* VAR_LOCAL_ZONE  */
+  YYSYMBOL_VAR_LOCAL_DATA = 77,            /* VAR_LOCAL_DATA  */
+  YYSYMBOL_VAR_INTERFACE_AUTOMATIC = 78,   /* VAR_INTERFACE_AUTOMATIC  */
+  YYSYMBOL_VAR_STATISTICS_INTERVAL = 79,   /* VAR_STATISTICS_INTERVAL  */
+  YYSYMBOL_VAR_DO_DAEMONIZE = 80,          /* VAR_DO_DAEMONIZE  */
+  YYSYMBOL_VAR_USE_CAPS_FOR_ID = 81,       /* VAR_USE_CAPS_FOR_ID  */
+  YYSYMBOL_VAR_STATISTICS_CUMULATIVE = 82, /* VAR_STATISTICS_CUMULATIVE  */
+  YYSYMBOL_VAR_OUTGOING_PORT_PERMIT = 83,  /* VAR_OUTGOING_PORT_PERMIT  */
+  YYSYMBOL_VAR_OUTGOING_PORT_AVOID = 84,   /* VAR_OUTGOING_PORT_AVOID  */
+  YYSYMBOL_VAR_DLV_ANCHOR_FILE = 85,       /* VAR_DLV_ANCHOR_FILE  */
+  YYSYMBOL_VAR_DLV_ANCHOR = 86,            /* VAR_DLV_ANCHOR  */
+  YYSYMBOL_VAR_NEG_CACHE_SIZE = 87,        /* VAR_NEG_CACHE_SIZE  */
+  YYSYMBOL_VAR_HARDEN_REFERRAL_PATH = 88,  /* VAR_HARDEN_REFERRAL_PATH  */
+  YYSYMBOL_VAR_PRIVATE_ADDRESS = 89,       /* VAR_PRIVATE_ADDRESS  */
+  YYSYMBOL_VAR_PRIVATE_DOMAIN = 90,        /* VAR_PRIVATE_DOMAIN  */
+  YYSYMBOL_VAR_REMOTE_CONTROL = 91,        /* VAR_REMOTE_CONTROL  */
+  YYSYMBOL_VAR_CONTROL_ENABLE = 92,        /* VAR_CONTROL_ENABLE  */
+  YYSYMBOL_VAR_CONTROL_INTERFACE = 93,     /* VAR_CONTROL_INTERFACE  */
+  YYSYMBOL_VAR_CONTROL_PORT = 94,          /* VAR_CONTROL_PORT  */
+  YYSYMBOL_VAR_SERVER_KEY_FILE = 95,       /* VAR_SERVER_KEY_FILE  */
+  YYSYMBOL_VAR_SERVER_CERT_FILE = 96,      /* VAR_SERVER_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_KEY_FILE = 97,      /* VAR_CONTROL_KEY_FILE  */
+  YYSYMBOL_VAR_CONTROL_CERT_FILE = 98,     /* VAR_CONTROL_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_USE_CERT = 99,      /* VAR_CONTROL_USE_CERT  */
+  YYSYMBOL_VAR_EXTENDED_STATISTICS = 100,  /* VAR_EXTENDED_STATISTICS  */
+  YYSYMBOL_VAR_LOCAL_DATA_PTR = 101,       /* VAR_LOCAL_DATA_PTR  */
+  YYSYMBOL_VAR_JOSTLE_TIMEOUT = 102,       /* VAR_JOSTLE_TIMEOUT  */
+  YYSYMBOL_VAR_STUB_PRIME = 103,           /* VAR_STUB_PRIME  */
+  YYSYMBOL_VAR_UNWANTED_REPLY_THRESHOLD = 104, /* VAR_UNWANTED_REPLY_THRESHOLD  */
+  YYSYMBOL_VAR_LOG_TIME_ASCII = 105,       /* VAR_LOG_TIME_ASCII  */
+  YYSYMBOL_VAR_DOMAIN_INSECURE = 106,      /* VAR_DOMAIN_INSECURE  */
+  YYSYMBOL_VAR_PYTHON = 107,               /* VAR_PYTHON  */
+  YYSYMBOL_VAR_PYTHON_SCRIPT = 108,        /* VAR_PYTHON_SCRIPT  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MIN = 109,     /* VAR_VAL_SIG_SKEW_MIN  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MAX = 110,     /* VAR_VAL_SIG_SKEW_MAX  */
+  YYSYMBOL_VAR_CACHE_MIN_TTL = 111,        /* VAR_CACHE_MIN_TTL  */
+  YYSYMBOL_VAR_VAL_LOG_LEVEL = 112,        /* VAR_VAL_LOG_LEVEL  */
+  YYSYMBOL_VAR_AUTO_TRUST_ANCHOR_FILE = 113, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_KEEP_MISSING = 114,         /* VAR_KEEP_MISSING  */
+  YYSYMBOL_VAR_ADD_HOLDDOWN = 115,         /* VAR_ADD_HOLDDOWN  */
+  YYSYMBOL_VAR_DEL_HOLDDOWN = 116,         /* VAR_DEL_HOLDDOWN  */
+  YYSYMBOL_VAR_SO_RCVBUF = 117,            /* VAR_SO_RCVBUF  */
+  YYSYMBOL_VAR_EDNS_BUFFER_SIZE = 118,     /* VAR_EDNS_BUFFER_SIZE  */
+  YYSYMBOL_VAR_PREFETCH = 119,             /* VAR_PREFETCH  */
+  YYSYMBOL_VAR_PREFETCH_KEY = 120,         /* VAR_PREFETCH_KEY  */
+  YYSYMBOL_VAR_SO_SNDBUF = 121,            /* VAR_SO_SNDBUF  */
+  YYSYMBOL_VAR_SO_REUSEPORT = 122,         /* VAR_SO_REUSEPORT  */
+  YYSYMBOL_VAR_HARDEN_BELOW_NXDOMAIN = 123, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+  YYSYMBOL_VAR_IGNORE_CD_FLAG = 124,       /* VAR_IGNORE_CD_FLAG  */
+  YYSYMBOL_VAR_LOG_QUERIES = 125,          /* VAR_LOG_QUERIES  */
+  YYSYMBOL_VAR_LOG_REPLIES = 126,          /* VAR_LOG_REPLIES  */
+  YYSYMBOL_VAR_TCP_UPSTREAM = 127,         /* VAR_TCP_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_UPSTREAM = 128,         /* VAR_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_SERVICE_KEY = 129,      /* VAR_SSL_SERVICE_KEY  */
+  YYSYMBOL_VAR_SSL_SERVICE_PEM = 130,      /* VAR_SSL_SERVICE_PEM  */
+  YYSYMBOL_VAR_SSL_PORT = 131,             /* VAR_SSL_PORT  */
+  YYSYMBOL_VAR_FORWARD_FIRST = 132,        /* VAR_FORWARD_FIRST  */
+  YYSYMBOL_VAR_STUB_SSL_UPSTREAM = 133,    /* VAR_STUB_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_FORWARD_SSL_UPSTREAM = 134, /* VAR_FORWARD_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_STUB_FIRST = 135,           /* VAR_STUB_FIRST  */
+  YYSYMBOL_VAR_MINIMAL_RESPONSES = 136,    /* VAR_MINIMAL_RESPONSES  */
+  YYSYMBOL_VAR_RRSET_ROUNDROBIN = 137,     /* VAR_RRSET_ROUNDROBIN  */
+  YYSYMBOL_VAR_MAX_UDP_SIZE = 138,         /* VAR_MAX_UDP_SIZE  */
+  YYSYMBOL_VAR_DELAY_CLOSE = 139,          /* VAR_DELAY_CLOSE  */
+  YYSYMBOL_VAR_UNBLOCK_LAN_ZONES = 140,    /* VAR_UNBLOCK_LAN_ZONES  */
+  YYSYMBOL_VAR_INSECURE_LAN_ZONES = 141,   /* VAR_INSECURE_LAN_ZONES  */
+  YYSYMBOL_VAR_INFRA_CACHE_MIN_RTT = 142,  /* VAR_INFRA_CACHE_MIN_RTT  */
+  YYSYMBOL_VAR_DNS64_PREFIX = 143,         /* VAR_DNS64_PREFIX  */
+  YYSYMBOL_VAR_DNS64_SYNTHALL = 144,       /* VAR_DNS64_SYNTHALL  */
+  YYSYMBOL_VAR_DNSTAP = 145,               /* VAR_DNSTAP  */
+  YYSYMBOL_VAR_DNSTAP_ENABLE = 146,        /* VAR_DNSTAP_ENABLE  */
+  YYSYMBOL_VAR_DNSTAP_SOCKET_PATH = 147,   /* VAR_DNSTAP_SOCKET_PATH  */
+  YYSYMBOL_VAR_DNSTAP_SEND_IDENTITY = 148, /* VAR_DNSTAP_SEND_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_SEND_VERSION = 149,  /* VAR_DNSTAP_SEND_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_IDENTITY = 150,      /* VAR_DNSTAP_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_VERSION = 151,       /* VAR_DNSTAP_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 152, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 153, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 154, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 155, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 156, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 157, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_RESPONSE_IP_TAG = 158,      /* VAR_RESPONSE_IP_TAG  */
+  YYSYMBOL_VAR_RESPONSE_IP = 159,          /* VAR_RESPONSE_IP  */
+  YYSYMBOL_VAR_RESPONSE_IP_DATA = 160,     /* VAR_RESPONSE_IP_DATA  */
+  YYSYMBOL_VAR_HARDEN_ALGO_DOWNGRADE = 161, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+  YYSYMBOL_VAR_IP_TRANSPARENT = 162,       /* VAR_IP_TRANSPARENT  */
+  YYSYMBOL_VAR_DISABLE_DNSSEC_LAME_CHECK = 163, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
+  YYSYMBOL_VAR_IP_RATELIMIT = 164,         /* VAR_IP_RATELIMIT  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SLABS = 165,   /* VAR_IP_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SIZE = 166,    /* VAR_IP_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT = 167,            /* VAR_RATELIMIT  */
+  YYSYMBOL_VAR_RATELIMIT_SLABS = 168,      /* VAR_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_RATELIMIT_SIZE = 169,       /* VAR_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT_FOR_DOMAIN = 170, /* VAR_RATELIMIT_FOR_DOMAIN  */
+  YYSYMBOL_VAR_RATELIMIT_BELOW_DOMAIN = 171, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+  YYSYMBOL_VAR_IP_RATELIMIT_FACTOR = 172,  /* VAR_IP_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_RATELIMIT_FACTOR = 173,     /* VAR_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_SEND_CLIENT_SUBNET = 174,   /* VAR_SEND_CLIENT_SUBNET  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_OPCODE = 175, /* VAR_CLIENT_SUBNET_OPCODE  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV4 = 176, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV6 = 177, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
+  YYSYMBOL_VAR_CAPS_WHITELIST = 178,       /* VAR_CAPS_WHITELIST  */
+  YYSYMBOL_VAR_CACHE_MAX_NEGATIVE_TTL = 179, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+  YYSYMBOL_VAR_PERMIT_SMALL_HOLDDOWN = 180, /* VAR_PERMIT_SMALL_HOLDDOWN  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION = 181,   /* VAR_QNAME_MINIMISATION  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION_STRICT = 182, /* VAR_QNAME_MINIMISATION_STRICT  */
+  YYSYMBOL_VAR_IP_FREEBIND = 183,          /* VAR_IP_FREEBIND  */
+  YYSYMBOL_VAR_DEFINE_TAG = 184,           /* VAR_DEFINE_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_TAG = 185,       /* VAR_LOCAL_ZONE_TAG  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG = 186,   /* VAR_ACCESS_CONTROL_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_OVERRIDE = 187,  /* VAR_LOCAL_ZONE_OVERRIDE  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_ACTION = 188, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_DATA = 189, /* VAR_ACCESS_CONTROL_TAG_DATA  */
+  YYSYMBOL_VAR_VIEW = 190,                 /* VAR_VIEW  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_VIEW = 191,  /* VAR_ACCESS_CONTROL_VIEW  */
+  YYSYMBOL_VAR_VIEW_FIRST = 192,           /* VAR_VIEW_FIRST  */
+  YYSYMBOL_VAR_SERVE_EXPIRED = 193,        /* VAR_SERVE_EXPIRED  */
+  YYSYMBOL_VAR_FAKE_DSA = 194,             /* VAR_FAKE_DSA  */
+  YYSYMBOL_VAR_FAKE_SHA1 = 195,            /* VAR_FAKE_SHA1  */
+  YYSYMBOL_VAR_LOG_IDENTITY = 196,         /* VAR_LOG_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_TRUSTANCHOR = 197,     /* VAR_HIDE_TRUSTANCHOR  */
+  YYSYMBOL_VAR_USE_SYSTEMD = 198,          /* VAR_USE_SYSTEMD  */
+  YYSYMBOL_VAR_SHM_ENABLE = 199,           /* VAR_SHM_ENABLE  */
+  YYSYMBOL_VAR_SHM_KEY = 200,              /* VAR_SHM_KEY  */
+  YYSYMBOL_VAR_DNSCRYPT = 201,             /* VAR_DNSCRYPT  */
+  YYSYMBOL_VAR_DNSCRYPT_ENABLE = 202,      /* VAR_DNSCRYPT_ENABLE  */
+  YYSYMBOL_VAR_DNSCRYPT_PORT = 203,        /* VAR_DNSCRYPT_PORT  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER = 204,    /* VAR_DNSCRYPT_PROVIDER  */
+  YYSYMBOL_VAR_DNSCRYPT_SECRET_KEY = 205,  /* VAR_DNSCRYPT_SECRET_KEY  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT = 206, /* VAR_DNSCRYPT_PROVIDER_CERT  */
+  YYSYMBOL_VAR_TCP_FASTOPEN_QUEUE = 207,   /* VAR_TCP_FASTOPEN_QUEUE  */
+  YYSYMBOL_VAR_TCP_UPSTREAM_FASTOPEN = 208, /* VAR_TCP_UPSTREAM_FASTOPEN  */
+  YYSYMBOL_VAR_TCP_IDLE_TIMEOUT = 209,     /* VAR_TCP_IDLE_TIMEOUT  */
+  YYSYMBOL_VAR_EDNS_TCP_KEEPALIVE = 210,   /* VAR_EDNS_TCP_KEEPALIVE  */
+  YYSYMBOL_VAR_EDNS_TCP_KEEPALIVE_TIMEOUT = 211, /* VAR_EDNS_TCP_KEEPALIVE_TIMEOUT  */
+  YYSYMBOL_VAR_ANSWER_COOKIE = 212,        /* VAR_ANSWER_COOKIE  */
+  YYSYMBOL_VAR_COOKIE_SECRET = 213,        /* VAR_COOKIE_SECRET  */
+  YYSYMBOL_VAR_UPSTREAM_COOKIE = 214,      /* VAR_UPSTREAM_COOKIE  */
+  YYSYMBOL_VAR_CACHE_PIN = 215,            /* VAR_CACHE_PIN  */
+  YYSYMBOL_VAR_CACHE_PIN_SUFFIX = 216,     /* VAR_CACHE_PIN_SUFFIX  */
+  YYSYMBOL_VAR_CACHE_PIN_MAX_SIZE = 217,   /* VAR_CACHE_PIN_MAX_SIZE  */
+  YYSYMBOL_VAR_VIEW_CACHE_QUOTA = 218,     /* VAR_VIEW_CACHE_QUOTA  */
+  YYSYMBOL_VAR_CACHE_PEER = 219,           /* VAR_CACHE_PEER  */
+  YYSYMBOL_VAR_CACHE_PEER_PORT = 220,      /* VAR_CACHE_PEER_PORT  */
+  YYSYMBOL_VAR_CACHE_PEER_INTERFACE = 221, /* VAR_CACHE_PEER_INTERFACE  */
+  YYSYMBOL_VAR_CACHE_PEER_RATE = 222,      /* VAR_CACHE_PEER_RATE  */
+  YYSYMBOL_VAR_XDP_INTERFACE = 223,        /* VAR_XDP_INTERFACE  */
+  YYSYMBOL_VAR_XDP_NATIVE = 224,           /* VAR_XDP_NATIVE  */
+  YYSYMBOL_VAR_CACHEDB_SECRET = 225,       /* VAR_CACHEDB_SECRET  */
+  YYSYMBOL_VAR_CACHEDB_COMPRESS = 226,     /* VAR_CACHEDB_COMPRESS  */
+  YYSYMBOL_VAR_CACHEDB_COMPRESS_MIN = 227, /* VAR_CACHEDB_COMPRESS_MIN  */
+  YYSYMBOL_VAR_FORWARD_HEALTH_CHECK = 228, /* VAR_FORWARD_HEALTH_CHECK  */
+  YYSYMBOL_VAR_FORWARD_PROBE_INTERVAL = 229, /* VAR_FORWARD_PROBE_INTERVAL  */
+  YYSYMBOL_YYACCEPT = 230,                 /* $accept  */
+  YYSYMBOL_toplevelvars = 231,             /* toplevelvars  */
+  YYSYMBOL_toplevelvar = 232,              /* toplevelvar  */
+  YYSYMBOL_serverstart = 233,              /* serverstart  */
+  YYSYMBOL_contents_server = 234,          /* contents_server  */
+  YYSYMBOL_content_server = 235,           /* content_server  */
+  YYSYMBOL_stubstart = 236,                /* stubstart  */
+  YYSYMBOL_contents_stub = 237,            /* contents_stub  */
+  YYSYMBOL_content_stub = 238,             /* content_stub  */
+  YYSYMBOL_forwardstart = 239,             /* forwardstart  */
+  YYSYMBOL_contents_forward = 240,         /* contents_forward  */
+  YYSYMBOL_content_forward = 241,          /* content_forward  */
+  YYSYMBOL_viewstart = 242,                /* viewstart  */
+  YYSYMBOL_contents_view = 243,            /* contents_view  */
+  YYSYMBOL_content_view = 244,             /* content_view  */
+  YYSYMBOL_server_num_threads = 245,       /* server_num_threads  */
+  YYSYMBOL_server_verbosity = 246,         /* server_verbosity  */
+  YYSYMBOL_server_statistics_interval = 247, /* server_statistics_interval  */
+  YYSYMBOL_server_statistics_cumulative = 248, /* server_statistics_cumulative  */
+  YYSYMBOL_server_extended_statistics = 249, /* server_extended_statistics  */
+  YYSYMBOL_server_shm_enable = 250,        /* server_shm_enable  */
+  YYSYMBOL_server_shm_key = 251,           /* server_shm_key  */
+  YYSYMBOL_server_port = 252,              /* server_port  */
+  YYSYMBOL_server_send_client_subnet = 253, /* server_send_client_subnet  */
+  YYSYMBOL_server_client_subnet_opcode = 254, /* server_client_subnet_opcode  */
+  YYSYMBOL_server_max_client_subnet_ipv4 = 255, /* server_max_client_subnet_ipv4  */
+  YYSYMBOL_server_max_client_subnet_ipv6 = 256, /* server_max_client_subnet_ipv6  */
+  YYSYMBOL_server_interface = 257,         /* server_interface  */
+  YYSYMBOL_server_outgoing_interface = 258, /* server_outgoing_interface  */
+  YYSYMBOL_server_outgoing_range = 259,    /* server_outgoing_range  */
+  YYSYMBOL_server_outgoing_port_permit = 260, /* server_outgoing_port_permit  */
+  YYSYMBOL_server_outgoing_port_avoid = 261, /* server_outgoing_port_avoid  */
+  YYSYMBOL_server_outgoing_num_tcp = 262,  /* server_outgoing_num_tcp  */
+  YYSYMBOL_server_incoming_num_tcp = 263,  /* server_incoming_num_tcp  */
+  YYSYMBOL_server_interface_automatic = 264, /* server_interface_automatic  */
+  YYSYMBOL_server_do_ip4 = 265,            /* server_do_ip4  */
+  YYSYMBOL_server_do_ip6 = 266,            /* server_do_ip6  */
+  YYSYMBOL_server_do_udp = 267,            /* server_do_udp  */
+  YYSYMBOL_server_do_tcp = 268,            /* server_do_tcp  */
+  YYSYMBOL_server_prefer_ip6 = 269,        /* server_prefer_ip6  */
+  YYSYMBOL_server_tcp_mss = 270,           /* server_tcp_mss  */
+  YYSYMBOL_server_outgoing_tcp_mss = 271,  /* server_outgoing_tcp_mss  */
+  YYSYMBOL_server_tcp_fastopen_queue = 272, /* server_tcp_fastopen_queue  */
+  YYSYMBOL_server_tcp_upstream_fastopen = 273, /* server_tcp_upstream_fastopen  */
+  YYSYMBOL_server_tcp_idle_timeout = 274,  /* server_tcp_idle_timeout  */
+  YYSYMBOL_server_edns_tcp_keepalive = 275, /* server_edns_tcp_keepalive  */
+  YYSYMBOL_server_edns_tcp_keepalive_timeout = 276, /* server_edns_tcp_keepalive_timeout  */
+  YYSYMBOL_server_answer_cookie = 277,     /* server_answer_cookie  */
+  YYSYMBOL_server_cookie_secret = 278,     /* server_cookie_secret  */
+  YYSYMBOL_server_upstream_cookie = 279,   /* server_upstream_cookie  */
+  YYSYMBOL_server_tcp_upstream = 280,      /* server_tcp_upstream  */
+  YYSYMBOL_server_ssl_upstream = 281,      /* server_ssl_upstream  */
+  YYSYMBOL_server_ssl_service_key = 282,   /* server_ssl_service_key  */
+  YYSYMBOL_server_ssl_service_pem = 283,   /* server_ssl_service_pem  */
+  YYSYMBOL_server_ssl_port = 284,          /* server_ssl_port  */
+  YYSYMBOL_server_use_systemd = 285,       /* server_use_systemd  */
+  YYSYMBOL_server_do_daemonize = 286,      /* server_do_daemonize  */
+  YYSYMBOL_server_use_syslog = 287,        /* server_use_syslog  */
+  YYSYMBOL_server_log_time_ascii = 288,    /* server_log_time_ascii  */
+  YYSYMBOL_server_log_queries = 289,       /* server_log_queries  */
+  YYSYMBOL_server_log_replies = 290,       /* server_log_replies  */
+  YYSYMBOL_server_chroot = 291,            /* server_chroot  */
+  YYSYMBOL_server_username = 292,          /* server_username  */
+  YYSYMBOL_server_directory = 293,         /* server_directory  */
+  YYSYMBOL_server_logfile = 294,           /* server_logfile  */
+  YYSYMBOL_server_pidfile = 295,           /* server_pidfile  */
+  YYSYMBOL_server_root_hints = 296,        /* server_root_hints  */
+  YYSYMBOL_server_dlv_anchor_file = 297,   /* server_dlv_anchor_file  */
+  YYSYMBOL_server_dlv_anchor = 298,        /* server_dlv_anchor  */
+  YYSYMBOL_server_auto_trust_anchor_file = 299, /* server_auto_trust_anchor_file  */
+  YYSYMBOL_server_trust_anchor_file = 300, /* server_trust_anchor_file  */
+  YYSYMBOL_server_trusted_keys_file = 301, /* server_trusted_keys_file  */
+  YYSYMBOL_server_trust_anchor = 302,      /* server_trust_anchor  */
+  YYSYMBOL_server_domain_insecure = 303,   /* server_domain_insecure  */
+  YYSYMBOL_server_hide_identity = 304,     /* server_hide_identity  */
+  YYSYMBOL_server_hide_version = 305,      /* server_hide_version  */
+  YYSYMBOL_server_hide_trustanchor = 306,  /* server_hide_trustanchor  */
+  YYSYMBOL_server_identity = 307,          /* server_identity  */
+  YYSYMBOL_server_version = 308,           /* server_version  */
+  YYSYMBOL_server_so_rcvbuf = 309,         /* server_so_rcvbuf  */
+  YYSYMBOL_server_so_sndbuf = 310,         /* server_so_sndbuf  */
+  YYSYMBOL_server_so_reuseport = 311,      /* server_so_reuseport  */
+  YYSYMBOL_server_ip_transparent = 312,    /* server_ip_transparent  */
+  YYSYMBOL_server_ip_freebind = 313,       /* server_ip_freebind  */
+  YYSYMBOL_server_edns_buffer_size = 314,  /* server_edns_buffer_size  */
+  YYSYMBOL_server_msg_buffer_size = 315,   /* server_msg_buffer_size  */
+  YYSYMBOL_server_msg_cache_size = 316,    /* server_msg_cache_size  */
+  YYSYMBOL_server_msg_cache_slabs = 317,   /* server_msg_cache_slabs  */
+  YYSYMBOL_server_num_queries_per_thread = 318, /* server_num_queries_per_thread  */
+  YYSYMBOL_server_jostle_timeout = 319,    /* server_jostle_timeout  */
+  YYSYMBOL_server_delay_close = 320,       /* server_delay_close  */
+  YYSYMBOL_server_unblock_lan_zones = 321, /* server_unblock_lan_zones  */
+  YYSYMBOL_server_insecure_lan_zones = 322, /* server_insecure_lan_zones  */
+  YYSYMBOL_server_rrset_cache_size = 323,  /* server_rrset_cache_size  */
+  YYSYMBOL_server_rrset_cache_slabs = 324, /* server_rrset_cache_slabs  */
+  YYSYMBOL_server_cache_pin = 325,         /* server_cache_pin  */
+  YYSYMBOL_server_cache_pin_suffix = 326,  /* server_cache_pin_suffix  */
+  YYSYMBOL_server_cache_pin_max_size = 327, /* server_cache_pin_max_size  */
+  YYSYMBOL_server_cache_peer = 328,        /* server_cache_peer  */
+  YYSYMBOL_server_cache_peer_port = 329,   /* server_cache_peer_port  */
+  YYSYMBOL_server_cache_peer_interface = 330, /* server_cache_peer_interface  */
+  YYSYMBOL_server_cache_peer_rate = 331,   /* server_cache_peer_rate  */
+  YYSYMBOL_server_xdp_interface = 332,     /* server_xdp_interface  */
+  YYSYMBOL_server_xdp_native = 333,        /* server_xdp_native  */
+  YYSYMBOL_server_infra_host_ttl = 334,    /* server_infra_host_ttl  */
+  YYSYMBOL_server_infra_lame_ttl = 335,    /* server_infra_lame_ttl  */
+  YYSYMBOL_server_infra_cache_numhosts = 336, /* server_infra_cache_numhosts  */
+  YYSYMBOL_server_infra_cache_lame_size = 337, /* server_infra_cache_lame_size  */
+  YYSYMBOL_server_infra_cache_slabs = 338, /* server_infra_cache_slabs  */
+  YYSYMBOL_server_infra_cache_min_rtt = 339, /* server_infra_cache_min_rtt  */
+  YYSYMBOL_server_target_fetch_policy = 340, /* server_target_fetch_policy  */
+  YYSYMBOL_server_harden_short_bufsize = 341, /* server_harden_short_bufsize  */
+  YYSYMBOL_server_harden_large_queries = 342, /* server_harden_large_queries  */
+  YYSYMBOL_server_harden_glue = 343,       /* server_harden_glue  */
+  YYSYMBOL_server_harden_dnssec_stripped = 344, /* server_harden_dnssec_stripped  */
+  YYSYMBOL_server_harden_below_nxdomain = 345, /* server_harden_below_nxdomain  */
+  YYSYMBOL_server_harden_referral_path = 346, /* server_harden_referral_path  */
+  YYSYMBOL_server_harden_algo_downgrade = 347, /* server_harden_algo_downgrade  */
+  YYSYMBOL_server_use_caps_for_id = 348,   /* server_use_caps_for_id  */
+  YYSYMBOL_server_caps_whitelist = 349,    /* server_caps_whitelist  */
+  YYSYMBOL_server_private_address = 350,   /* server_private_address  */
+  YYSYMBOL_server_private_domain = 351,    /* server_private_domain  */
+  YYSYMBOL_server_prefetch = 352,          /* server_prefetch  */
+  YYSYMBOL_server_prefetch_key = 353,      /* server_prefetch_key  */
+  YYSYMBOL_server_unwanted_reply_threshold = 354, /* server_unwanted_reply_threshold  */
+  YYSYMBOL_server_do_not_query_address = 355, /* server_do_not_query_address  */
+  YYSYMBOL_server_do_not_query_localhost = 356, /* server_do_not_query_localhost  */
+  YYSYMBOL_server_access_control = 357,    /* server_access_control  */
+  YYSYMBOL_server_module_conf = 358,       /* server_module_conf  */
+  YYSYMBOL_server_val_override_date = 359, /* server_val_override_date  */
+  YYSYMBOL_server_val_sig_skew_min = 360,  /* server_val_sig_skew_min  */
+  YYSYMBOL_server_val_sig_skew_max = 361,  /* server_val_sig_skew_max  */
+  YYSYMBOL_server_cache_max_ttl = 362,     /* server_cache_max_ttl  */
+  YYSYMBOL_server_cache_max_negative_ttl = 363, /* server_cache_max_negative_ttl  */
+  YYSYMBOL_server_cache_min_ttl = 364,     /* server_cache_min_ttl  */
+  YYSYMBOL_server_bogus_ttl = 365,         /* server_bogus_ttl  */
+  YYSYMBOL_server_val_clean_additional = 366, /* server_val_clean_additional  */
+  YYSYMBOL_server_val_permissive_mode = 367, /* server_val_permissive_mode  */
+  YYSYMBOL_server_ignore_cd_flag = 368,    /* server_ignore_cd_flag  */
+  YYSYMBOL_server_serve_expired = 369,     /* server_serve_expired  */
+  YYSYMBOL_server_fake_dsa = 370,          /* server_fake_dsa  */
+  YYSYMBOL_server_fake_sha1 = 371,         /* server_fake_sha1  */
+  YYSYMBOL_server_val_log_level = 372,     /* server_val_log_level  */
+  YYSYMBOL_server_val_nsec3_keysize_iterations = 373, /* server_val_nsec3_keysize_iterations  */
+  YYSYMBOL_server_add_holddown = 374,      /* server_add_holddown  */
+  YYSYMBOL_server_del_holddown = 375,      /* server_del_holddown  */
+  YYSYMBOL_server_keep_missing = 376,      /* server_keep_missing  */
+  YYSYMBOL_server_permit_small_holddown = 377, /* server_permit_small_holddown  */
+  YYSYMBOL_server_key_cache_size = 378,    /* server_key_cache_size  */
+  YYSYMBOL_server_key_cache_slabs = 379,   /* server_key_cache_slabs  */
+  YYSYMBOL_server_neg_cache_size = 380,    /* server_neg_cache_size  */
+  YYSYMBOL_server_local_zone = 381,        /* server_local_zone  */
+  YYSYMBOL_server_local_data = 382,        /* server_local_data  */
+  YYSYMBOL_server_local_data_ptr = 383,    /* server_local_data_ptr  */
+  YYSYMBOL_server_minimal_responses = 384, /* server_minimal_responses  */
+  YYSYMBOL_server_rrset_roundrobin = 385,  /* server_rrset_roundrobin  */
+  YYSYMBOL_server_max_udp_size = 386,      /* server_max_udp_size  */
+  YYSYMBOL_server_dns64_prefix = 387,      /* server_dns64_prefix  */
+  YYSYMBOL_server_dns64_synthall = 388,    /* server_dns64_synthall  */
+  YYSYMBOL_server_cachedb_secret = 389,    /* server_cachedb_secret  */
+  YYSYMBOL_server_cachedb_compress = 390,  /* server_cachedb_compress  */
+  YYSYMBOL_server_cachedb_compress_min = 391, /* server_cachedb_compress_min  */
+  YYSYMBOL_server_forward_health_check = 392, /* server_forward_health_check  */
+  YYSYMBOL_server_forward_probe_interval = 393, /* server_forward_probe_interval  */
+  YYSYMBOL_server_define_tag = 394,        /* server_define_tag  */
+  YYSYMBOL_server_local_zone_tag = 395,    /* server_local_zone_tag  */
+  YYSYMBOL_server_access_control_tag = 396, /* server_access_control_tag  */
+  YYSYMBOL_server_access_control_tag_action = 397, /* server_access_control_tag_action  */
+  YYSYMBOL_server_access_control_tag_data = 398, /* server_access_control_tag_data  */
+  YYSYMBOL_server_local_zone_override = 399, /* server_local_zone_override  */
+  YYSYMBOL_server_access_control_view = 400, /* server_access_control_view  */
+  YYSYMBOL_server_response_ip_tag = 401,   /* server_response_ip_tag  */
+  YYSYMBOL_server_ip_ratelimit = 402,      /* server_ip_ratelimit  */
+  YYSYMBOL_server_ratelimit = 403,         /* server_ratelimit  */
+  YYSYMBOL_server_ip_ratelimit_size = 404, /* server_ip_ratelimit_size  */
+  YYSYMBOL_server_ratelimit_size = 405,    /* server_ratelimit_size  */
+  YYSYMBOL_server_ip_ratelimit_slabs = 406, /* server_ip_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_slabs = 407,   /* server_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_for_domain = 408, /* server_ratelimit_for_domain  */
+  YYSYMBOL_server_ratelimit_below_domain = 409, /* server_ratelimit_below_domain  */
+  YYSYMBOL_server_ip_ratelimit_factor = 410, /* server_ip_ratelimit_factor  */
+  YYSYMBOL_server_ratelimit_factor = 411,  /* server_ratelimit_factor  */
+  YYSYMBOL_server_qname_minimisation = 412, /* server_qname_minimisation  */
+  YYSYMBOL_server_qname_minimisation_strict = 413, /* server_qname_minimisation_strict  */
+  YYSYMBOL_stub_name = 414,                /* stub_name  */
+  YYSYMBOL_stub_host = 415,                /* stub_host  */
+  YYSYMBOL_stub_addr = 416,                /* stub_addr  */
+  YYSYMBOL_stub_first = 417,               /* stub_first  */
+  YYSYMBOL_stub_ssl_upstream = 418,        /* stub_ssl_upstream  */
+  YYSYMBOL_stub_prime = 419,               /* stub_prime  */
+  YYSYMBOL_forward_name = 420,             /* forward_name  */
+  YYSYMBOL_forward_host = 421,             /* forward_host  */
+  YYSYMBOL_forward_addr = 422,             /* forward_addr  */
+  YYSYMBOL_forward_first = 423,            /* forward_first  */
+  YYSYMBOL_forward_ssl_upstream = 424,     /* forward_ssl_upstream  */
+  YYSYMBOL_view_name = 425,                /* view_name  */
+  YYSYMBOL_view_local_zone = 426,          /* view_local_zone  */
+  YYSYMBOL_view_response_ip = 427,         /* view_response_ip  */
+  YYSYMBOL_view_response_ip_data = 428,    /* view_response_ip_data  */
+  YYSYMBOL_view_local_data = 429,          /* view_local_data  */
+  YYSYMBOL_view_local_data_ptr = 430,      /* view_local_data_ptr  */
+  YYSYMBOL_view_first = 431,               /* view_first  */
+  YYSYMBOL_view_cache_quota = 432,         /* view_cache_quota  */
+  YYSYMBOL_rcstart = 433,                  /* rcstart  */
+  YYSYMBOL_contents_rc = 434,              /* contents_rc  */
+  YYSYMBOL_content_rc = 435,               /* content_rc  */
+  YYSYMBOL_rc_control_enable = 436,        /* rc_control_enable  */
+  YYSYMBOL_rc_control_port = 437,          /* rc_control_port  */
+  YYSYMBOL_rc_control_interface = 438,     /* rc_control_interface  */
+  YYSYMBOL_rc_control_use_cert = 439,      /* rc_control_use_cert  */
+  YYSYMBOL_rc_server_key_file = 440,       /* rc_server_key_file  */
+  YYSYMBOL_rc_server_cert_file = 441,      /* rc_server_cert_file  */
+  YYSYMBOL_rc_control_key_file = 442,      /* rc_control_key_file  */
+  YYSYMBOL_rc_control_cert_file = 443,     /* rc_control_cert_file  */
+  YYSYMBOL_dtstart = 444,                  /* dtstart  */
+  YYSYMBOL_contents_dt = 445,              /* contents_dt  */
+  YYSYMBOL_content_dt = 446,               /* content_dt  */
+  YYSYMBOL_dt_dnstap_enable = 447,         /* dt_dnstap_enable  */
+  YYSYMBOL_dt_dnstap_socket_path = 448,    /* dt_dnstap_socket_path  */
+  YYSYMBOL_dt_dnstap_send_identity = 449,  /* dt_dnstap_send_identity  */
+  YYSYMBOL_dt_dnstap_send_version = 450,   /* dt_dnstap_send_version  */
+  YYSYMBOL_dt_dnstap_identity = 451,       /* dt_dnstap_identity  */
+  YYSYMBOL_dt_dnstap_version = 452,        /* dt_dnstap_version  */
+  YYSYMBOL_dt_dnstap_log_resolver_query_messages = 453, /* dt_dnstap_log_resolver_query_messages  */
+  YYSYMBOL_dt_dnstap_log_resolver_response_messages = 454, /* dt_dnstap_log_resolver_response_messages  */
+  YYSYMBOL_dt_dnstap_log_client_query_messages = 455, /* dt_dnstap_log_client_query_messages  */
+  YYSYMBOL_dt_dnstap_log_client_response_messages = 456, /* dt_dnstap_log_client_response_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_query_messages = 457, /* dt_dnstap_log_forwarder_query_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_response_messages = 458, /* dt_dnstap_log_forwarder_response_messages  */
+  YYSYMBOL_pythonstart = 459,              /* pythonstart  */
+  YYSYMBOL_contents_py = 460,              /* contents_py  */
+  YYSYMBOL_content_py = 461,               /* content_py  */
+  YYSYMBOL_py_script = 462,                /* py_script  */
+  YYSYMBOL_server_disable_dnssec_lame_check = 463, /* server_disable_dnssec_lame_check  */
+  YYSYMBOL_server_log_identity = 464,      /* server_log_identity  */
+  YYSYMBOL_server_response_ip = 465,       /* server_response_ip  */
+  YYSYMBOL_server_response_ip_data = 466,  /* server_response_ip_data  */
+  YYSYMBOL_dnscstart = 467,                /* dnscstart  */
+  YYSYMBOL_contents_dnsc = 468,            /* contents_dnsc  */
+  YYSYMBOL_content_dnsc = 469,             /* content_dnsc  */
+  YYSYMBOL_dnsc_dnscrypt_enable = 470,     /* dnsc_dnscrypt_enable  */
+  YYSYMBOL_dnsc_dnscrypt_port = 471,       /* dnsc_dnscrypt_port  */
+  YYSYMBOL_dnsc_dnscrypt_provider = 472,   /* dnsc_dnscrypt_provider  */
+  YYSYMBOL_dnsc_dnscrypt_provider_cert = 473, /* dnsc_dnscrypt_provider_cert  */
+  YYSYMBOL_dnsc_dnscrypt_secret_key = 474  /* dnsc_dnscrypt_secret_key  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
 
-extern YYSTYPE yylval;
 
-int yyparse (void);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-#line 568 "util/configparser.c" /* yacc.c:358  */
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -599,15 +697,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -621,47 +732,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -674,8 +781,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -740,8 +861,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -750,17 +870,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -773,11 +893,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -789,12 +909,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -806,27 +926,30 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   418
+#define YYLAST   466
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  207
+#define YYNTOKENS  230
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  222
+#define YYNNTS  245
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  425
+#define YYNRULES  471
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  640
+#define YYNSTATES  710
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   484
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   461
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -875,70 +998,85 @@ static const yytype_uint8 yytranslate[] =
      175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
      185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
      195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
-     205,   206
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   148,   148,   148,   149,   149,   150,   150,   151,   151,
-     151,   153,   157,   162,   163,   164,   164,   164,   165,   165,
-     166,   166,   167,   167,   168,   168,   169,   169,   169,   170,
-     170,   170,   171,   171,   172,   172,   173,   173,   174,   174,
-     175,   175,   176,   176,   177,   177,   178,   178,   179,   179,
-     179,   180,   180,   180,   181,   181,   181,   182,   182,   183,
-     183,   184,   184,   185,   185,   186,   186,   186,   187,   187,
-     188,   188,   189,   189,   189,   190,   190,   191,   191,   192,
-     192,   193,   193,   193,   194,   194,   195,   195,   196,   196,
-     197,   197,   198,   198,   199,   199,   199,   200,   200,   201,
-     201,   201,   202,   202,   202,   203,   203,   203,   204,   204,
-     204,   204,   205,   205,   205,   206,   206,   206,   207,   207,
-     208,   208,   209,   209,   210,   210,   211,   211,   211,   212,
-     212,   213,   213,   214,   215,   215,   216,   217,   217,   218,
-     218,   219,   219,   220,   220,   221,   221,   221,   222,   222,
-     223,   223,   224,   224,   225,   225,   226,   226,   226,   227,
-     227,   227,   228,   228,   228,   229,   231,   243,   244,   245,
-     245,   245,   245,   245,   246,   248,   260,   261,   262,   262,
-     262,   262,   263,   265,   279,   280,   281,   281,   281,   281,
-     282,   282,   282,   284,   293,   302,   313,   322,   331,   340,
-     351,   360,   371,   386,   403,   420,   433,   448,   457,   466,
-     475,   484,   493,   502,   511,   520,   529,   538,   547,   556,
-     565,   574,   583,   590,   597,   606,   615,   624,   638,   647,
-     656,   665,   672,   679,   705,   713,   720,   727,   734,   741,
-     749,   757,   765,   772,   779,   788,   797,   806,   813,   820,
-     828,   836,   846,   856,   866,   879,   890,   898,   911,   920,
-     929,   938,   948,   958,   966,   979,   988,   996,  1005,  1013,
-    1026,  1035,  1042,  1052,  1062,  1072,  1082,  1092,  1102,  1112,
-    1122,  1129,  1136,  1143,  1152,  1161,  1170,  1177,  1187,  1204,
-    1211,  1229,  1242,  1255,  1264,  1273,  1282,  1291,  1301,  1311,
-    1320,  1329,  1342,  1355,  1364,  1371,  1380,  1389,  1398,  1407,
-    1415,  1428,  1436,  1464,  1471,  1486,  1496,  1506,  1513,  1520,
-    1529,  1543,  1562,  1581,  1593,  1605,  1617,  1628,  1647,  1657,
-    1666,  1674,  1682,  1695,  1708,  1721,  1734,  1743,  1752,  1762,
-    1772,  1782,  1789,  1796,  1805,  1815,  1825,  1835,  1842,  1849,
-    1858,  1868,  1878,  1907,  1917,  1925,  1934,  1949,  1958,  1963,
-    1964,  1965,  1965,  1965,  1966,  1966,  1966,  1967,  1967,  1969,
-    1979,  1988,  1995,  2005,  2012,  2019,  2026,  2033,  2038,  2039,
-    2040,  2040,  2041,  2041,  2042,  2042,  2043,  2044,  2045,  2046,
-    2047,  2048,  2050,  2058,  2065,  2073,  2081,  2088,  2095,  2104,
-    2113,  2122,  2131,  2140,  2149,  2154,  2155,  2156,  2158,  2164,
-    2174,  2181,  2190,  2198,  2204,  2205,  2207,  2207,  2207,  2208,
-    2208,  2210,  2219,  2229,  2236,  2243
+       0,   158,   158,   158,   159,   159,   160,   160,   161,   161,
+     161,   163,   167,   172,   173,   174,   174,   174,   175,   175,
+     176,   176,   177,   177,   178,   178,   179,   179,   180,   180,
+     181,   181,   182,   182,   183,   183,   184,   184,   185,   185,
+     186,   186,   186,   187,   187,   187,   188,   188,   188,   189,
+     189,   190,   190,   191,   191,   192,   192,   193,   193,   194,
+     194,   195,   195,   196,   196,   197,   197,   197,   198,   198,
+     198,   199,   199,   199,   200,   200,   201,   201,   202,   202,
+     203,   203,   204,   204,   204,   205,   205,   206,   206,   207,
+     207,   207,   208,   208,   209,   209,   210,   210,   211,   211,
+     211,   212,   212,   213,   213,   214,   214,   215,   215,   216,
+     216,   217,   217,   217,   218,   218,   219,   219,   219,   220,
+     220,   220,   221,   221,   221,   222,   222,   222,   222,   223,
+     223,   223,   224,   224,   224,   225,   225,   226,   226,   227,
+     227,   228,   228,   229,   229,   230,   231,   231,   232,   232,
+     232,   233,   233,   234,   234,   235,   236,   236,   237,   238,
+     238,   239,   239,   240,   240,   241,   241,   242,   242,   242,
+     243,   243,   244,   244,   245,   245,   246,   246,   247,   247,
+     247,   248,   248,   248,   249,   249,   249,   250,   252,   264,
+     265,   266,   266,   266,   266,   266,   267,   269,   281,   282,
+     283,   283,   283,   283,   284,   286,   300,   301,   302,   302,
+     302,   302,   303,   303,   303,   304,   306,   315,   324,   335,
+     344,   353,   362,   373,   382,   393,   408,   425,   442,   455,
+     470,   479,   488,   497,   506,   515,   524,   533,   542,   551,
+     560,   569,   578,   587,   596,   606,   615,   625,   634,   644,
+     657,   667,   676,   685,   692,   699,   708,   717,   726,   740,
+     749,   758,   767,   774,   781,   807,   815,   822,   829,   836,
+     843,   851,   859,   867,   874,   881,   890,   899,   908,   915,
+     922,   930,   938,   948,   958,   968,   981,   992,  1000,  1013,
+    1022,  1031,  1040,  1050,  1060,  1068,  1081,  1088,  1096,  1104,
+    1111,  1120,  1127,  1136,  1143,  1152,  1161,  1169,  1178,  1186,
+    1199,  1208,  1215,  1225,  1235,  1245,  1255,  1265,  1275,  1285,
+    1295,  1302,  1309,  1316,  1325,  1334,  1343,  1350,  1360,  1377,
+    1384,  1402,  1415,  1428,  1437,  1446,  1455,  1464,  1474,  1484,
+    1493,  1502,  1515,  1528,  1537,  1544,  1553,  1562,  1571,  1580,
+    1588,  1601,  1609,  1637,  1644,  1659,  1669,  1679,  1686,  1693,
+    1702,  1709,  1722,  1731,  1741,  1750,  1764,  1783,  1802,  1814,
+    1826,  1838,  1849,  1868,  1878,  1887,  1895,  1903,  1916,  1929,
+    1942,  1955,  1964,  1973,  1983,  1993,  2003,  2010,  2017,  2026,
+    2036,  2046,  2056,  2063,  2070,  2079,  2089,  2099,  2128,  2138,
+    2146,  2155,  2170,  2179,  2187,  2192,  2193,  2194,  2194,  2194,
+    2195,  2195,  2195,  2196,  2196,  2198,  2208,  2217,  2224,  2234,
+    2241,  2248,  2255,  2262,  2267,  2268,  2269,  2269,  2270,  2270,
+    2271,  2271,  2272,  2273,  2274,  2275,  2276,  2277,  2279,  2287,
+    2294,  2302,  2310,  2317,  2324,  2333,  2342,  2351,  2360,  2369,
+    2378,  2383,  2384,  2385,  2387,  2393,  2403,  2410,  2419,  2427,
+    2433,  2434,  2436,  2436,  2436,  2437,  2437,  2439,  2448,  2458,
+    2465,  2472
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "SPACE", "LETTER", "NEWLINE", "COMMENT",
-  "COLON", "ANY", "ZONESTR", "STRING_ARG", "VAR_SERVER", "VAR_VERBOSITY",
-  "VAR_NUM_THREADS", "VAR_PORT", "VAR_OUTGOING_RANGE", "VAR_INTERFACE",
-  "VAR_DO_IP4", "VAR_DO_IP6", "VAR_PREFER_IP6", "VAR_DO_UDP", "VAR_DO_TCP",
-  "VAR_TCP_MSS", "VAR_OUTGOING_TCP_MSS", "VAR_CHROOT", "VAR_USERNAME",
-  "VAR_DIRECTORY", "VAR_LOGFILE", "VAR_PIDFILE", "VAR_MSG_CACHE_SIZE",
+  "\"end of file\"", "error", "\"invalid token\"", "SPACE", "LETTER",
+  "NEWLINE", "COMMENT", "COLON", "ANY", "ZONESTR", "STRING_ARG",
+  "VAR_SERVER", "VAR_VERBOSITY", "VAR_NUM_THREADS", "VAR_PORT",
+  "VAR_OUTGOING_RANGE", "VAR_INTERFACE", "VAR_DO_IP4", "VAR_DO_IP6",
+  "VAR_PREFER_IP6", "VAR_DO_UDP", "VAR_DO_TCP", "VAR_TCP_MSS",
+  "VAR_OUTGOING_TCP_MSS", "VAR_CHROOT", "VAR_USERNAME", "VAR_DIRECTORY",
+  "VAR_LOGFILE", "VAR_PIDFILE", "VAR_MSG_CACHE_SIZE",
   "VAR_MSG_CACHE_SLABS", "VAR_NUM_QUERIES_PER_THREAD",
   "VAR_RRSET_CACHE_SIZE", "VAR_RRSET_CACHE_SLABS", "VAR_OUTGOING_NUM_TCP",
   "VAR_INFRA_HOST_TTL", "VAR_INFRA_LAME_TTL", "VAR_INFRA_CACHE_SLABS",
@@ -1005,7 +1143,16 @@ static const char *const yytname[] =
   "VAR_LOG_IDENTITY", "VAR_HIDE_TRUSTANCHOR", "VAR_USE_SYSTEMD",
   "VAR_SHM_ENABLE", "VAR_SHM_KEY", "VAR_DNSCRYPT", "VAR_DNSCRYPT_ENABLE",
   "VAR_DNSCRYPT_PORT", "VAR_DNSCRYPT_PROVIDER", "VAR_DNSCRYPT_SECRET_KEY",
-  "VAR_DNSCRYPT_PROVIDER_CERT", "$accept", "toplevelvars", "toplevelvar",
+  "VAR_DNSCRYPT_PROVIDER_CERT", "VAR_TCP_FASTOPEN_QUEUE",
+  "VAR_TCP_UPSTREAM_FASTOPEN", "VAR_TCP_IDLE_TIMEOUT",
+  "VAR_EDNS_TCP_KEEPALIVE", "VAR_EDNS_TCP_KEEPALIVE_TIMEOUT",
+  "VAR_ANSWER_COOKIE", "VAR_COOKIE_SECRET", "VAR_UPSTREAM_COOKIE",
+  "VAR_CACHE_PIN", "VAR_CACHE_PIN_SUFFIX", "VAR_CACHE_PIN_MAX_SIZE",
+  "VAR_VIEW_CACHE_QUOTA", "VAR_CACHE_PEER", "VAR_CACHE_PEER_PORT",
+  "VAR_CACHE_PEER_INTERFACE", "VAR_CACHE_PEER_RATE", "VAR_XDP_INTERFACE",
+  "VAR_XDP_NATIVE", "VAR_CACHEDB_SECRET", "VAR_CACHEDB_COMPRESS",
+  "VAR_CACHEDB_COMPRESS_MIN", "VAR_FORWARD_HEALTH_CHECK",
+  "VAR_FORWARD_PROBE_INTERVAL", "$accept", "toplevelvars", "toplevelvar",
   "serverstart", "contents_server", "content_server", "stubstart",
   "contents_stub", "content_stub", "forwardstart", "contents_forward",
   "content_forward", "viewstart", "contents_view", "content_view",
@@ -1019,11 +1166,15 @@ static const char *const yytname[] =
   "server_outgoing_num_tcp", "server_incoming_num_tcp",
   "server_interface_automatic", "server_do_ip4", "server_do_ip6",
   "server_do_udp", "server_do_tcp", "server_prefer_ip6", "server_tcp_mss",
-  "server_outgoing_tcp_mss", "server_tcp_upstream", "server_ssl_upstream",
-  "server_ssl_service_key", "server_ssl_service_pem", "server_ssl_port",
-  "server_use_systemd", "server_do_daemonize", "server_use_syslog",
-  "server_log_time_ascii", "server_log_queries", "server_log_replies",
-  "server_chroot", "server_username", "server_directory", "server_logfile",
+  "server_outgoing_tcp_mss", "server_tcp_fastopen_queue",
+  "server_tcp_upstream_fastopen", "server_tcp_idle_timeout",
+  "server_edns_tcp_keepalive", "server_edns_tcp_keepalive_timeout",
+  "server_answer_cookie", "server_cookie_secret", "server_upstream_cookie",
+  "server_tcp_upstream", "server_ssl_upstream", "server_ssl_service_key",
+  "server_ssl_service_pem", "server_ssl_port", "server_use_systemd",
+  "server_do_daemonize", "server_use_syslog", "server_log_time_ascii",
+  "server_log_queries", "server_log_replies", "server_chroot",
+  "server_username", "server_directory", "server_logfile",
   "server_pidfile", "server_root_hints", "server_dlv_anchor_file",
   "server_dlv_anchor", "server_auto_trust_anchor_file",
   "server_trust_anchor_file", "server_trusted_keys_file",
@@ -1036,7 +1187,11 @@ static const char *const yytname[] =
   "server_num_queries_per_thread", "server_jostle_timeout",
   "server_delay_close", "server_unblock_lan_zones",
   "server_insecure_lan_zones", "server_rrset_cache_size",
-  "server_rrset_cache_slabs", "server_infra_host_ttl",
+  "server_rrset_cache_slabs", "server_cache_pin",
+  "server_cache_pin_suffix", "server_cache_pin_max_size",
+  "server_cache_peer", "server_cache_peer_port",
+  "server_cache_peer_interface", "server_cache_peer_rate",
+  "server_xdp_interface", "server_xdp_native", "server_infra_host_ttl",
   "server_infra_lame_ttl", "server_infra_cache_numhosts",
   "server_infra_cache_lame_size", "server_infra_cache_slabs",
   "server_infra_cache_min_rtt", "server_target_fetch_policy",
@@ -1061,7 +1216,10 @@ static const char *const yytname[] =
   "server_key_cache_slabs", "server_neg_cache_size", "server_local_zone",
   "server_local_data", "server_local_data_ptr", "server_minimal_responses",
   "server_rrset_roundrobin", "server_max_udp_size", "server_dns64_prefix",
-  "server_dns64_synthall", "server_define_tag", "server_local_zone_tag",
+  "server_dns64_synthall", "server_cachedb_secret",
+  "server_cachedb_compress", "server_cachedb_compress_min",
+  "server_forward_health_check", "server_forward_probe_interval",
+  "server_define_tag", "server_local_zone_tag",
   "server_access_control_tag", "server_access_control_tag_action",
   "server_access_control_tag_data", "server_local_zone_override",
   "server_access_control_view", "server_response_ip_tag",
@@ -1075,8 +1233,8 @@ static const char *const yytname[] =
   "forward_name", "forward_host", "forward_addr", "forward_first",
   "forward_ssl_upstream", "view_name", "view_local_zone",
   "view_response_ip", "view_response_ip_data", "view_local_data",
-  "view_local_data_ptr", "view_first", "rcstart", "contents_rc",
-  "content_rc", "rc_control_enable", "rc_control_port",
+  "view_local_data_ptr", "view_first", "view_cache_quota", "rcstart",
+  "contents_rc", "content_rc", "rc_control_enable", "rc_control_port",
   "rc_control_interface", "rc_control_use_cert", "rc_server_key_file",
   "rc_server_cert_file", "rc_control_key_file", "rc_control_cert_file",
   "dtstart", "contents_dt", "content_dt", "dt_dnstap_enable",
@@ -1095,124 +1253,108 @@ static const char *const yytname[] =
   "dnsc_dnscrypt_port", "dnsc_dnscrypt_provider",
   "dnsc_dnscrypt_provider_cert", "dnsc_dnscrypt_secret_key", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -197
+#define YYPACT_NINF (-124)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-197)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -1
+#define YYTABLE_NINF (-1)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -197,     0,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-      98,   -39,   -35,   154,   -65,  -131,  -106,  -196,     2,    25,
-      26,    27,    28,    29,    30,    32,    33,    34,    35,    36,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    52,    53,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
-      79,    80,    82,    83,    85,    88,    90,    91,    92,    93,
-      94,    95,    96,    99,   128,   129,   130,   131,   136,   137,
-     179,   181,   182,   183,   185,   186,   187,   195,   196,   222,
-     223,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   278,   280,   289,   290,   291,   292,   293,
-     294,   295,   296,   297,   298,   299,   300,   301,   302,   305,
-     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
-     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
-     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
-     337,   338,   339,   340,   341,   342,   343,   344,   345,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,   346,   347,   348,   349,   350,   351,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,   352,   353,   354,   355,   356,  -197,
-    -197,  -197,  -197,  -197,  -197,   357,   358,   359,   360,   361,
-     362,   363,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-     364,   365,   366,   367,   368,   369,   370,   371,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,   384,  -197,  -197,   385,   386,   387,   388,   389,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,   390,   391,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,   392,   393,   394,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,   395,   396,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,   397,   398,   399,   400,   401,   402,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,   403,
-    -197,  -197,   404,   405,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-     406,   407,   408,  -197,  -197,  -197,  -197,  -197,  -197,  -197
+    -124,   178,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+     -12,   180,   184,   151,   142,   -13,   -80,  -123,    19,    20,
+      21,    25,    26,    27,    74,    75,    76,    77,    81,    85,
+      86,   110,   111,   112,   113,   135,   170,   182,   183,   196,
+     208,   211,   216,   219,   220,   221,   232,   233,   234,   235,
+     236,   237,   238,   239,   240,   241,   243,   244,   245,   246,
+     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
+     257,   258,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,   269,   270,   271,   272,   274,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+     290,   291,   292,   293,   294,   295,   296,   297,   298,   299,
+     302,   304,   307,   309,   310,   311,   312,   314,   315,   316,
+     317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
+     327,   328,   329,   330,   331,   332,   334,   335,   336,   337,
+     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
+     348,   349,   350,   351,   352,   353,   354,   355,   356,   357,
+     360,   361,   362,   363,   364,   365,   366,   367,   368,   370,
+     371,   372,   373,   374,   375,   376,   377,   378,   379,   380,
+     381,   382,   383,   384,   385,   386,   387,   388,   389,   390,
+     391,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,   392,   393,   394,   395,   396,
+     397,  -124,  -124,  -124,  -124,  -124,  -124,  -124,   398,   399,
+     400,   401,   402,  -124,  -124,  -124,  -124,  -124,  -124,   403,
+     404,   405,   406,   407,   408,   409,   410,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,   411,   412,   413,   414,
+     415,   416,   417,   418,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,   431,  -124,
+    -124,   432,   433,   434,   435,   436,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,   437,   438,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,   439,   440,   441,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,   442,   443,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,   444,
+     445,   446,   447,   448,   449,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,   450,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,   451,  -124,  -124,
+     452,   453,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,   454,
+     455,   456,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
 {
-       2,     0,     1,    12,   166,   175,   358,   404,   377,   183,
-     413,     3,    14,   168,   177,   185,   360,   379,   406,   415,
+       2,     0,     1,    12,   188,   197,   404,   450,   423,   205,
+     459,     3,    14,   190,   199,   207,   406,   425,   452,   461,
        4,     5,     6,    10,     8,     9,     7,    11,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -1228,213 +1370,234 @@ static const yytype_uint16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    13,
-      15,    16,    75,    78,    87,   162,   163,    17,   137,   138,
-     139,   140,    26,    66,    18,    79,    80,    37,    59,    74,
-      19,    20,    22,    23,    21,    24,    25,   110,   111,   112,
-     113,   114,   158,    76,    65,    91,   108,   109,    27,    28,
-      29,    30,    31,    67,    81,    82,    97,    53,    63,    54,
-      92,    47,    48,   165,    49,    50,   101,   105,   118,   126,
-     145,   102,    60,    32,    33,    34,    89,   119,   120,   121,
-      35,    36,    38,    39,    41,    42,    40,   124,    43,    44,
-      45,    51,    70,   106,    84,   125,    77,   141,    85,    86,
-     103,   104,    90,    46,    68,    71,    52,    55,    93,    94,
-      69,   142,    95,    56,    57,    58,   107,   155,   156,   164,
-      96,    64,    98,    99,   100,   143,    61,    62,    83,    72,
-      73,    88,   115,   116,   117,   122,   123,   146,   147,   149,
-     151,   152,   150,   153,   159,   127,   128,   131,   132,   129,
-     130,   133,   134,   136,   135,   144,   154,   148,   157,   160,
-     161,     0,     0,     0,     0,     0,     0,   167,   169,   170,
-     171,   173,   174,   172,     0,     0,     0,     0,     0,   176,
-     178,   179,   180,   181,   182,     0,     0,     0,     0,     0,
-       0,     0,   184,   186,   187,   190,   191,   188,   192,   189,
-       0,     0,     0,     0,     0,     0,     0,     0,   359,   361,
-     363,   362,   368,   364,   365,   366,   367,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   378,
-     380,   381,   382,   383,   384,   385,   386,   387,   388,   389,
-     390,   391,     0,   405,   407,     0,     0,     0,     0,     0,
-     414,   416,   417,   418,   420,   419,   194,   193,   200,   207,
-     205,   213,   214,   217,   215,   216,   218,   219,   231,   232,
-     233,   234,   235,   256,   257,   258,   263,   264,   210,   265,
-     266,   269,   267,   268,   271,   272,   273,   286,   244,   245,
-     247,   248,   274,   289,   240,   242,   290,   296,   297,   298,
-     211,   255,   309,   310,   241,   304,   227,   206,   236,   287,
-     293,   275,     0,     0,   313,   212,   195,   226,   279,   196,
-     208,   209,   237,   238,   311,   277,   281,   282,   197,   314,
-     259,   285,   228,   243,   291,   292,   295,   303,   239,   307,
-     305,   306,   249,   254,   283,   284,   250,   251,   276,   299,
-     229,   230,   220,   221,   222,   223,   224,   315,   316,   317,
-     260,   261,   262,   270,   318,   319,     0,     0,     0,   278,
-     252,   409,   328,   332,   330,   329,   333,   331,     0,     0,
-     336,   337,   201,   202,   203,   204,   280,   294,   308,   338,
-     339,   253,   320,     0,     0,     0,     0,     0,     0,   300,
-     301,   302,   410,   246,   225,   198,   199,   340,   341,   342,
-     345,   344,   343,   346,   347,   348,   349,   350,   351,     0,
-     355,   356,     0,     0,   357,   369,   371,   370,   373,   374,
-     375,   376,   372,   392,   393,   394,   395,   396,   397,   398,
-     399,   400,   401,   402,   403,   408,   421,   422,   423,   425,
-     424,   288,   312,   327,   411,   412,   334,   335,   321,   322,
-       0,     0,     0,   326,   352,   353,   354,   325,   323,   324
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    13,    15,    16,    92,    95,   104,   184,   185,    17,
+     159,   160,   161,   162,    43,    83,    18,    96,    97,    54,
+      76,    91,    19,    20,    22,    23,    21,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,   127,   128,   129,
+     130,   131,   180,    93,    82,   108,   125,   126,    44,    45,
+      46,    47,    48,    84,    98,    99,   114,    70,    80,    71,
+     109,    64,    65,   187,    66,    67,   118,   122,   135,   148,
+     167,   119,    77,    49,    50,    51,   106,   136,   137,   138,
+      52,    53,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    55,    56,    58,    59,    57,   146,    60,    61,    62,
+      68,    87,   123,   101,   147,    94,   163,   102,   103,   120,
+     121,   107,    63,    85,    88,    69,    72,   110,   111,    86,
+     164,   112,    73,    74,    75,   124,   177,   178,   186,   113,
+      81,   115,   116,   117,   165,    78,    79,   100,    89,    90,
+     105,   132,   133,   134,   139,   140,   141,   142,   143,   144,
+     145,   168,   169,   171,   173,   174,   172,   175,   181,   149,
+     150,   153,   154,   151,   152,   155,   156,   158,   157,   166,
+     176,   170,   179,   182,   183,     0,     0,     0,     0,     0,
+       0,   189,   191,   192,   193,   195,   196,   194,     0,     0,
+       0,     0,     0,   198,   200,   201,   202,   203,   204,     0,
+       0,     0,     0,     0,     0,     0,     0,   206,   208,   209,
+     212,   213,   210,   214,   211,   215,     0,     0,     0,     0,
+       0,     0,     0,     0,   405,   407,   409,   408,   414,   410,
+     411,   412,   413,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   424,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,   435,   436,   437,     0,   451,
+     453,     0,     0,     0,     0,     0,   460,   462,   463,   464,
+     466,   465,   217,   216,   223,   230,   228,   236,   237,   240,
+     238,   239,   241,   242,   262,   263,   264,   265,   266,   287,
+     288,   289,   294,   295,   233,   305,   306,   309,   307,   308,
+     311,   312,   313,   326,   275,   276,   278,   279,   314,   329,
+     271,   273,   330,   336,   337,   338,   234,   286,   349,   350,
+     272,   344,   258,   229,   267,   327,   333,   315,     0,     0,
+     353,   235,   218,   257,   319,   219,   231,   232,   268,   269,
+     351,   317,   321,   322,   220,   354,   290,   325,   259,   274,
+     331,   332,   335,   343,   270,   347,   345,   346,   280,   285,
+     323,   324,   281,   282,   316,   339,   260,   261,   251,   252,
+     253,   254,   255,   355,   356,   357,   291,   292,   293,   310,
+     358,   359,     0,     0,     0,   318,   283,   455,   373,   377,
+     375,   374,   378,   376,     0,     0,   381,   382,   224,   225,
+     226,   227,   320,   334,   348,   383,   384,   284,   365,     0,
+       0,     0,     0,     0,     0,   340,   341,   342,   456,   277,
+     256,   221,   222,   243,   244,   245,   246,   247,   248,   249,
+     250,     0,   297,   298,   299,   300,   301,   302,   303,   304,
+     360,   361,   362,   363,   364,   385,   386,   387,   390,   389,
+     388,   391,   392,   393,   394,   395,   396,     0,   400,   401,
+       0,     0,   402,   403,   415,   417,   416,   419,   420,   421,
+     422,   418,   438,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,   449,   454,   467,   468,   469,   471,   470,
+     328,   352,   372,   457,   458,   379,   380,   366,   367,     0,
+       0,     0,   371,   296,   397,   398,   399,   370,   368,   369
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
-static const yytype_int16 yypgoto[] =
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
 {
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,  -197,
-    -197,  -197
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,    11,    12,    20,   179,    13,    21,   337,    14,
-      22,   349,    15,    23,   362,   180,   181,   182,   183,   184,
-     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
-     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
-     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
-     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
-     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   338,   339,   340,   341,   342,   343,   350,   351,
-     352,   353,   354,   363,   364,   365,   366,   367,   368,   369,
-      16,    24,   378,   379,   380,   381,   382,   383,   384,   385,
-     386,    17,    25,   399,   400,   401,   402,   403,   404,   405,
-     406,   407,   408,   409,   410,   411,    18,    26,   413,   414,
-     327,   328,   329,   330,    19,    27,   420,   421,   422,   423,
-     424,   425
+       0,     1,    11,    12,    20,   201,    13,    21,   381,    14,
+      22,   393,    15,    23,   407,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+     267,   268,   269,   270,   271,   272,   273,   274,   275,   276,
+     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
+     287,   288,   289,   290,   291,   292,   293,   294,   295,   296,
+     297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
+     307,   308,   309,   310,   311,   312,   313,   314,   315,   316,
+     317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
+     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
+     337,   338,   339,   340,   341,   342,   343,   344,   345,   346,
+     347,   348,   349,   350,   351,   352,   353,   354,   355,   356,
+     357,   358,   359,   360,   361,   362,   363,   364,   365,   366,
+     367,   368,   369,   370,   382,   383,   384,   385,   386,   387,
+     394,   395,   396,   397,   398,   408,   409,   410,   411,   412,
+     413,   414,   415,    16,    24,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,    17,    25,   445,   446,   447,   448,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,    18,
+      26,   459,   460,   371,   372,   373,   374,    19,    27,   466,
+     467,   468,   469,   470,   471
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
-static const yytype_uint16 yytable[] =
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
 {
-       2,   331,   412,   332,   333,   344,   415,   416,   417,   418,
-     419,     3,   426,   345,   346,   387,   388,   389,   390,   391,
-     392,   393,   394,   395,   396,   397,   398,   370,   371,   372,
-     373,   374,   375,   376,   377,   427,   428,   429,   430,   431,
-     432,     4,   433,   434,   435,   436,   437,     5,   438,   439,
-     440,   441,   442,   443,   444,   445,   446,   447,   448,   449,
-     450,   451,   452,   453,   334,   454,   455,   456,   457,   458,
-     459,   460,   461,   462,   463,   464,   465,   466,   467,   468,
-     469,   470,   471,   472,   473,   474,   475,   476,   477,   478,
-     479,     6,   480,   481,   335,   482,   336,   347,   483,   348,
-     484,   485,   486,   487,   488,   489,   490,     7,     0,   491,
       28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
       38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    52,    53,    54,    55,   492,   493,
-     494,   495,    56,    57,    58,     8,   496,   497,    59,    60,
+      48,    49,    50,    51,    52,    53,    54,    55,   458,   472,
+     473,   474,    56,    57,    58,   475,   476,   477,    59,    60,
       61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
       71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
       81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,    98,    99,   498,
-       9,   499,   500,   501,   355,   502,   503,   504,   100,   101,
-     102,    10,   103,   104,   105,   505,   506,   106,   107,   108,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   461,
+     462,   463,   464,   465,   478,   479,   480,   481,   100,   101,
+     102,   482,   103,   104,   105,   483,   484,   106,   107,   108,
      109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
      119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     356,   357,   507,   508,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   509,   510,   511,   512,   513,   514,   515,
-     516,   517,   518,   519,   520,   358,   138,   139,   140,   141,
+     485,   486,   487,   488,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   433,   434,   435,   436,   437,   438,   439,
+     440,   441,   442,   443,   444,   489,   138,   139,   140,   141,
      142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
      152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
-     162,   163,   164,   165,   166,   167,   168,   169,   521,   170,
-     522,   171,   172,   173,   174,   175,   176,   177,   178,   523,
-     524,   525,   526,   527,   528,   529,   530,   531,   532,   533,
-     534,   535,   536,   359,   360,   537,   538,   539,   540,   541,
-     542,   543,   544,   545,   546,   547,   548,   549,   550,   551,
-     552,   553,   554,   555,   556,   557,   558,   559,   560,   561,
-     562,   563,   564,   565,   566,   567,   361,   568,   569,   570,
-     571,   572,   573,   574,   575,   576,   577,   578,   579,   580,
-     581,   582,   583,   584,   585,   586,   587,   588,   589,   590,
-     591,   592,   593,   594,   595,   596,   597,   598,   599,   600,
-     601,   602,   603,   604,   605,   606,   607,   608,   609,   610,
-     611,   612,   613,   614,   615,   616,   617,   618,   619,   620,
-     621,   622,   623,   624,   625,   626,   627,   628,   629,   630,
-     631,   632,   633,   634,   635,   636,   637,   638,   639
+     162,   163,   164,   165,   166,   167,   168,   169,     2,   170,
+     490,   171,   172,   173,   174,   175,   176,   177,   178,     3,
+       0,   399,   491,   492,     0,   179,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   493,   190,   191,   192,
+     193,   194,   195,   196,   197,   198,   199,   200,   494,     4,
+     375,   495,   376,   377,   388,     5,   496,   400,   401,   497,
+     498,   499,   389,   390,   416,   417,   418,   419,   420,   421,
+     422,   423,   500,   501,   502,   503,   504,   505,   506,   507,
+     508,   509,   402,   510,   511,   512,   513,   514,   515,   516,
+     517,   518,   519,   520,   521,   522,   523,   524,   525,     6,
+     526,   527,   528,   529,   530,   531,   532,   533,   534,   535,
+     536,   537,   538,   378,   539,     7,   540,   541,   542,   543,
+     544,   545,   546,   547,   548,   549,   550,   551,   552,   553,
+     554,   555,   556,   557,   558,   559,   560,   561,   562,   563,
+     403,   404,   564,   379,   565,   380,   391,   566,   392,   567,
+     568,   569,   570,     8,   571,   572,   573,   574,   575,   576,
+     577,   578,   579,   580,   581,   582,   583,   584,   585,   586,
+     587,   588,   589,   405,   590,   591,   592,   593,   594,   595,
+     596,   597,   598,   599,   600,   601,   602,   603,   604,   605,
+     606,   607,   608,   609,   610,   611,   612,   613,     9,   406,
+     614,   615,   616,   617,   618,   619,   620,   621,   622,    10,
+     623,   624,   625,   626,   627,   628,   629,   630,   631,   632,
+     633,   634,   635,   636,   637,   638,   639,   640,   641,   642,
+     643,   644,   645,   646,   647,   648,   649,   650,   651,   652,
+     653,   654,   655,   656,   657,   658,   659,   660,   661,   662,
+     663,   664,   665,   666,   667,   668,   669,   670,   671,   672,
+     673,   674,   675,   676,   677,   678,   679,   680,   681,   682,
+     683,   684,   685,   686,   687,   688,   689,   690,   691,   692,
+     693,   694,   695,   696,   697,   698,   699,   700,   701,   702,
+     703,   704,   705,   706,   707,   708,   709
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,    40,   108,    42,    43,    40,   202,   203,   204,   205,
-     206,    11,    10,    48,    49,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,   157,    92,    93,    94,
-      95,    96,    97,    98,    99,    10,    10,    10,    10,    10,
-      10,    41,    10,    10,    10,    10,    10,    47,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,   103,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    91,    10,    10,   133,    10,   135,   132,    10,   134,
-      10,    10,    10,    10,    10,    10,    10,   107,    -1,    10,
       12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
       22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    10,    10,
-      10,    10,    44,    45,    46,   145,    10,    10,    50,    51,
+      32,    33,    34,    35,    36,    37,    38,    39,   108,    10,
+      10,    10,    44,    45,    46,    10,    10,    10,    50,    51,
       52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
       62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
       72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
-      82,    83,    84,    85,    86,    87,    88,    89,    90,    10,
-     190,    10,    10,    10,    40,    10,    10,    10,   100,   101,
-     102,   201,   104,   105,   106,    10,    10,   109,   110,   111,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,   202,
+     203,   204,   205,   206,    10,    10,    10,    10,   100,   101,
+     102,    10,   104,   105,   106,    10,    10,   109,   110,   111,
      112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
      122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
-      76,    77,    10,    10,   136,   137,   138,   139,   140,   141,
-     142,   143,   144,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,   101,   158,   159,   160,   161,
+      10,    10,    10,    10,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,    10,   158,   159,   160,   161,
      162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
      172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
-     182,   183,   184,   185,   186,   187,   188,   189,    10,   191,
-      10,   193,   194,   195,   196,   197,   198,   199,   200,    10,
+     182,   183,   184,   185,   186,   187,   188,   189,     0,   191,
+      10,   193,   194,   195,   196,   197,   198,   199,   200,    11,
+      -1,    40,    10,    10,    -1,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,    10,   219,   220,   221,
+     222,   223,   224,   225,   226,   227,   228,   229,    10,    41,
+      40,    10,    42,    43,    40,    47,    10,    76,    77,    10,
+      10,    10,    48,    49,    92,    93,    94,    95,    96,    97,
+      98,    99,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,   101,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    91,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,   103,    10,   107,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+     159,   160,    10,   133,    10,   135,   132,    10,   134,    10,
+      10,    10,    10,   145,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,   192,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,   159,   160,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,   190,   218,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,   201,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,   192,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10
+      10,    10,    10,    10,    10,    10,    10
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   208,     0,    11,    41,    47,    91,   107,   145,   190,
-     201,   209,   210,   213,   216,   219,   387,   398,   413,   421,
-     211,   214,   217,   220,   388,   399,   414,   422,    12,    13,
+       0,   231,     0,    11,    41,    47,    91,   107,   145,   190,
+     201,   232,   233,   236,   239,   242,   433,   444,   459,   467,
+     234,   237,   240,   243,   434,   445,   460,   468,    12,    13,
       14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
       24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
       34,    35,    36,    37,    38,    39,    44,    45,    46,    50,
@@ -1449,32 +1612,39 @@ static const yytype_uint16 yystos[] =
      160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
      170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
      180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-     191,   193,   194,   195,   196,   197,   198,   199,   200,   212,
-     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
-     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
-     272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
-     282,   283,   284,   285,   286,   287,   288,   289,   290,   291,
-     292,   293,   294,   295,   296,   297,   298,   299,   300,   301,
-     302,   303,   304,   305,   306,   307,   308,   309,   310,   311,
-     312,   313,   314,   315,   316,   317,   318,   319,   320,   321,
-     322,   323,   324,   325,   326,   327,   328,   329,   330,   331,
-     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
-     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
-     352,   353,   354,   355,   356,   357,   358,   359,   360,   361,
-     362,   363,   364,   365,   366,   367,   368,   417,   418,   419,
-     420,    40,    42,    43,   103,   133,   135,   215,   369,   370,
-     371,   372,   373,   374,    40,    48,    49,   132,   134,   218,
-     375,   376,   377,   378,   379,    40,    76,    77,   101,   159,
-     160,   192,   221,   380,   381,   382,   383,   384,   385,   386,
-      92,    93,    94,    95,    96,    97,    98,    99,   389,   390,
-     391,   392,   393,   394,   395,   396,   397,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   400,
-     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
-     411,   412,   108,   415,   416,   202,   203,   204,   205,   206,
-     423,   424,   425,   426,   427,   428,    10,    10,    10,    10,
+     191,   193,   194,   195,   196,   197,   198,   199,   200,   207,
+     208,   209,   210,   211,   212,   213,   214,   215,   216,   217,
+     219,   220,   221,   222,   223,   224,   225,   226,   227,   228,
+     229,   235,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
+     263,   264,   265,   266,   267,   268,   269,   270,   271,   272,
+     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
+     283,   284,   285,   286,   287,   288,   289,   290,   291,   292,
+     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
+     303,   304,   305,   306,   307,   308,   309,   310,   311,   312,
+     313,   314,   315,   316,   317,   318,   319,   320,   321,   322,
+     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,   339,   340,   341,   342,
+     343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
+     353,   354,   355,   356,   357,   358,   359,   360,   361,   362,
+     363,   364,   365,   366,   367,   368,   369,   370,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,   380,   381,   382,
+     383,   384,   385,   386,   387,   388,   389,   390,   391,   392,
+     393,   394,   395,   396,   397,   398,   399,   400,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+     413,   463,   464,   465,   466,    40,    42,    43,   103,   133,
+     135,   238,   414,   415,   416,   417,   418,   419,    40,    48,
+      49,   132,   134,   241,   420,   421,   422,   423,   424,    40,
+      76,    77,   101,   159,   160,   192,   218,   244,   425,   426,
+     427,   428,   429,   430,   431,   432,    92,    93,    94,    95,
+      96,    97,    98,    99,   435,   436,   437,   438,   439,   440,
+     441,   442,   443,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,   446,   447,   448,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,   458,   108,   461,
+     462,   202,   203,   204,   205,   206,   469,   470,   471,   472,
+     473,   474,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
@@ -1498,31 +1668,31 @@ static const yytype_uint16 yystos[] =
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
 {
-       0,   207,   208,   208,   209,   209,   209,   209,   209,   209,
-     209,   209,   210,   211,   211,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   212,   212,   212,   212,
-     212,   212,   212,   212,   212,   212,   213,   214,   214,   215,
-     215,   215,   215,   215,   215,   216,   217,   217,   218,   218,
-     218,   218,   218,   219,   220,   220,   221,   221,   221,   221,
-     221,   221,   221,   222,   223,   224,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+       0,   230,   231,   231,   232,   232,   232,   232,   232,   232,
+     232,   232,   233,   234,   234,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   236,   237,
+     237,   238,   238,   238,   238,   238,   238,   239,   240,   240,
+     241,   241,   241,   241,   241,   242,   243,   243,   244,   244,
+     244,   244,   244,   244,   244,   244,   245,   246,   247,   248,
      249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
      259,   260,   261,   262,   263,   264,   265,   266,   267,   268,
      269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
@@ -1537,17 +1707,22 @@ static const yytype_uint16 yyr1[] =
      359,   360,   361,   362,   363,   364,   365,   366,   367,   368,
      369,   370,   371,   372,   373,   374,   375,   376,   377,   378,
      379,   380,   381,   382,   383,   384,   385,   386,   387,   388,
-     388,   389,   389,   389,   389,   389,   389,   389,   389,   390,
-     391,   392,   393,   394,   395,   396,   397,   398,   399,   399,
-     400,   400,   400,   400,   400,   400,   400,   400,   400,   400,
-     400,   400,   401,   402,   403,   404,   405,   406,   407,   408,
-     409,   410,   411,   412,   413,   414,   414,   415,   416,   417,
-     418,   419,   420,   421,   422,   422,   423,   423,   423,   423,
-     423,   424,   425,   426,   427,   428
+     389,   390,   391,   392,   393,   394,   395,   396,   397,   398,
+     399,   400,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,   434,   435,   435,   435,
+     435,   435,   435,   435,   435,   436,   437,   438,   439,   440,
+     441,   442,   443,   444,   445,   445,   446,   446,   446,   446,
+     446,   446,   446,   446,   446,   446,   446,   446,   447,   448,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,   458,
+     459,   460,   460,   461,   462,   463,   464,   465,   466,   467,
+     468,   468,   469,   469,   469,   469,   469,   470,   471,   472,
+     473,   474
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     1,     2,     0,     1,     1,     1,     1,     1,
@@ -1565,10 +1740,12 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     2,     0,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       0,     1,     1,     1,     1,     1,     1,     1,     2,     0,
        1,     1,     1,     1,     1,     1,     2,     0,     1,     1,
-       1,     1,     1,     1,     2,     0,     1,     1,     1,     1,
-       1,     1,     1,     2,     2,     2,     2,     2,     2,     2,
+       1,     1,     1,     1,     1,     1,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1576,58 +1753,61 @@ static const yytype_uint8 yyr2[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     3,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     3,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     3,     2,     2,     2,     2,     2,     2,     2,
-       2,     3,     3,     4,     4,     4,     3,     3,     2,     2,
-       2,     2,     2,     2,     3,     3,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     3,     3,     4,     4,
+       4,     3,     3,     2,     2,     2,     2,     2,     2,     3,
+       3,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     3,     3,     3,
+       2,     2,     2,     2,     1,     2,     0,     1,     1,     1,
+       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
+       2,     2,     2,     1,     2,     0,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     3,     3,     3,     2,     2,     2,     1,     2,
-       0,     1,     1,     1,     1,     1,     1,     1,     1,     2,
-       2,     2,     2,     2,     2,     2,     2,     1,     2,     0,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     1,     2,     0,     1,     2,     2,
-       2,     3,     3,     1,     2,     0,     1,     1,     1,     1,
-       1,     2,     2,     2,     2,     2
+       1,     2,     0,     1,     2,     2,     2,     3,     3,     1,
+       2,     0,     1,     1,     1,     1,     1,     2,     2,     2,
+       2,     2
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -1644,55 +1824,52 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1701,7 +1878,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1724,21 +1901,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1753,8 +1930,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1777,249 +1954,30 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
 
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -2028,6 +1986,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -2035,43 +1995,36 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -2079,71 +2032,75 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
-
         yyss = yyss1;
         yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -2151,30 +2108,31 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2185,18 +2143,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2224,15 +2193,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2247,7 +2214,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -2267,17 +2234,17 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 12:
-#line 158 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 12: /* serverstart: VAR_SERVER  */
+#line 168 "util/configparser.y"
+        { 
 		OUTYY(("\nP(server:)\n")); 
 	}
-#line 2276 "util/configparser.c" /* yacc.c:1646  */
+#line 2243 "util/configparser.c"
     break;
 
-  case 166:
-#line 232 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 188: /* stubstart: VAR_STUB_ZONE  */
+#line 253 "util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(stub_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2287,12 +2254,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2291 "util/configparser.c" /* yacc.c:1646  */
+#line 2258 "util/configparser.c"
     break;
 
-  case 175:
-#line 249 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 197: /* forwardstart: VAR_FORWARD_ZONE  */
+#line 270 "util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(forward_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2302,12 +2269,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2306 "util/configparser.c" /* yacc.c:1646  */
+#line 2273 "util/configparser.c"
     break;
 
-  case 183:
-#line 266 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 205: /* viewstart: VAR_VIEW  */
+#line 287 "util/configparser.y"
+        {
 		struct config_view* s;
 		OUTYY(("\nP(view:)\n")); 
 		s = (struct config_view*)calloc(1, sizeof(struct config_view));
@@ -2319,36 +2286,36 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2323 "util/configparser.c" /* yacc.c:1646  */
+#line 2290 "util/configparser.c"
     break;
 
-  case 193:
-#line 285 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 216: /* server_num_threads: VAR_NUM_THREADS STRING_ARG  */
+#line 307 "util/configparser.y"
+        { 
 		OUTYY(("P(server_num_threads:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->num_threads = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2335 "util/configparser.c" /* yacc.c:1646  */
+#line 2302 "util/configparser.c"
     break;
 
-  case 194:
-#line 294 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 217: /* server_verbosity: VAR_VERBOSITY STRING_ARG  */
+#line 316 "util/configparser.y"
+        { 
 		OUTYY(("P(server_verbosity:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->verbosity = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2347 "util/configparser.c" /* yacc.c:1646  */
+#line 2314 "util/configparser.c"
     break;
 
-  case 195:
-#line 303 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 218: /* server_statistics_interval: VAR_STATISTICS_INTERVAL STRING_ARG  */
+#line 325 "util/configparser.y"
+        { 
 		OUTYY(("P(server_statistics_interval:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
 			cfg_parser->cfg->stat_interval = 0;
@@ -2357,48 +2324,48 @@ yyreduce:
 		else cfg_parser->cfg->stat_interval = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2361 "util/configparser.c" /* yacc.c:1646  */
+#line 2328 "util/configparser.c"
     break;
 
-  case 196:
-#line 314 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 219: /* server_statistics_cumulative: VAR_STATISTICS_CUMULATIVE STRING_ARG  */
+#line 336 "util/configparser.y"
+        {
 		OUTYY(("P(server_statistics_cumulative:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stat_cumulative = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2373 "util/configparser.c" /* yacc.c:1646  */
+#line 2340 "util/configparser.c"
     break;
 
-  case 197:
-#line 323 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 220: /* server_extended_statistics: VAR_EXTENDED_STATISTICS STRING_ARG  */
+#line 345 "util/configparser.y"
+        {
 		OUTYY(("P(server_extended_statistics:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stat_extended = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2385 "util/configparser.c" /* yacc.c:1646  */
+#line 2352 "util/configparser.c"
     break;
 
-  case 198:
-#line 332 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 221: /* server_shm_enable: VAR_SHM_ENABLE STRING_ARG  */
+#line 354 "util/configparser.y"
+        {
 		OUTYY(("P(server_shm_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->shm_enable = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2397 "util/configparser.c" /* yacc.c:1646  */
+#line 2364 "util/configparser.c"
     break;
 
-  case 199:
-#line 341 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 222: /* server_shm_key: VAR_SHM_KEY STRING_ARG  */
+#line 363 "util/configparser.y"
+        { 
 		OUTYY(("P(server_shm_key:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
 			cfg_parser->cfg->shm_key = 0;
@@ -2407,24 +2374,24 @@ yyreduce:
 		else cfg_parser->cfg->shm_key = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2411 "util/configparser.c" /* yacc.c:1646  */
+#line 2378 "util/configparser.c"
     break;
 
-  case 200:
-#line 352 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 223: /* server_port: VAR_PORT STRING_ARG  */
+#line 374 "util/configparser.y"
+        {
 		OUTYY(("P(server_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
 		else cfg_parser->cfg->port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2423 "util/configparser.c" /* yacc.c:1646  */
+#line 2390 "util/configparser.c"
     break;
 
-  case 201:
-#line 361 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 224: /* server_send_client_subnet: VAR_SEND_CLIENT_SUBNET STRING_ARG  */
+#line 383 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_send_client_subnet:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->client_subnet, (yyvsp[0].str)))
@@ -2433,12 +2400,12 @@ yyreduce:
 		OUTYY(("P(Compiled without edns subnet option, ignoring)\n"));
 	#endif
 	}
-#line 2437 "util/configparser.c" /* yacc.c:1646  */
+#line 2404 "util/configparser.c"
     break;
 
-  case 202:
-#line 372 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 225: /* server_client_subnet_opcode: VAR_CLIENT_SUBNET_OPCODE STRING_ARG  */
+#line 394 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(client_subnet_opcode:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2451,12 +2418,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2455 "util/configparser.c" /* yacc.c:1646  */
+#line 2422 "util/configparser.c"
     break;
 
-  case 203:
-#line 387 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 226: /* server_max_client_subnet_ipv4: VAR_MAX_CLIENT_SUBNET_IPV4 STRING_ARG  */
+#line 409 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv4:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2471,12 +2438,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2475 "util/configparser.c" /* yacc.c:1646  */
+#line 2442 "util/configparser.c"
     break;
 
-  case 204:
-#line 404 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 227: /* server_max_client_subnet_ipv6: VAR_MAX_CLIENT_SUBNET_IPV6 STRING_ARG  */
+#line 426 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv6:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2491,12 +2458,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2495 "util/configparser.c" /* yacc.c:1646  */
+#line 2462 "util/configparser.c"
     break;
 
-  case 205:
-#line 421 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 228: /* server_interface: VAR_INTERFACE STRING_ARG  */
+#line 443 "util/configparser.y"
+        {
 		OUTYY(("P(server_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_ifs == 0)
 			cfg_parser->cfg->ifs = calloc(1, sizeof(char*));
@@ -2507,12 +2474,12 @@ yyreduce:
 		else
 			cfg_parser->cfg->ifs[cfg_parser->cfg->num_ifs++] = (yyvsp[0].str);
 	}
-#line 2511 "util/configparser.c" /* yacc.c:1646  */
+#line 2478 "util/configparser.c"
     break;
 
-  case 206:
-#line 434 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 229: /* server_outgoing_interface: VAR_OUTGOING_INTERFACE STRING_ARG  */
+#line 456 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_out_ifs == 0)
 			cfg_parser->cfg->out_ifs = calloc(1, sizeof(char*));
@@ -2525,248 +2492,352 @@ yyreduce:
 			cfg_parser->cfg->out_ifs[
 				cfg_parser->cfg->num_out_ifs++] = (yyvsp[0].str);
 	}
-#line 2529 "util/configparser.c" /* yacc.c:1646  */
+#line 2496 "util/configparser.c"
     break;
 
-  case 207:
-#line 449 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 230: /* server_outgoing_range: VAR_OUTGOING_RANGE STRING_ARG  */
+#line 471 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_range:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_num_ports = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2541 "util/configparser.c" /* yacc.c:1646  */
+#line 2508 "util/configparser.c"
     break;
 
-  case 208:
-#line 458 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 231: /* server_outgoing_port_permit: VAR_OUTGOING_PORT_PERMIT STRING_ARG  */
+#line 480 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_port_permit:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 1, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 2553 "util/configparser.c" /* yacc.c:1646  */
+#line 2520 "util/configparser.c"
     break;
 
-  case 209:
-#line 467 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 232: /* server_outgoing_port_avoid: VAR_OUTGOING_PORT_AVOID STRING_ARG  */
+#line 489 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_port_avoid:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 0, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 2565 "util/configparser.c" /* yacc.c:1646  */
+#line 2532 "util/configparser.c"
     break;
 
-  case 210:
-#line 476 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 233: /* server_outgoing_num_tcp: VAR_OUTGOING_NUM_TCP STRING_ARG  */
+#line 498 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2577 "util/configparser.c" /* yacc.c:1646  */
+#line 2544 "util/configparser.c"
     break;
 
-  case 211:
-#line 485 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 234: /* server_incoming_num_tcp: VAR_INCOMING_NUM_TCP STRING_ARG  */
+#line 507 "util/configparser.y"
+        {
 		OUTYY(("P(server_incoming_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->incoming_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2589 "util/configparser.c" /* yacc.c:1646  */
+#line 2556 "util/configparser.c"
     break;
 
-  case 212:
-#line 494 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 235: /* server_interface_automatic: VAR_INTERFACE_AUTOMATIC STRING_ARG  */
+#line 516 "util/configparser.y"
+        {
 		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2601 "util/configparser.c" /* yacc.c:1646  */
+#line 2568 "util/configparser.c"
     break;
 
-  case 213:
-#line 503 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 236: /* server_do_ip4: VAR_DO_IP4 STRING_ARG  */
+#line 525 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2613 "util/configparser.c" /* yacc.c:1646  */
+#line 2580 "util/configparser.c"
     break;
 
-  case 214:
-#line 512 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 237: /* server_do_ip6: VAR_DO_IP6 STRING_ARG  */
+#line 534 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2625 "util/configparser.c" /* yacc.c:1646  */
+#line 2592 "util/configparser.c"
     break;
 
-  case 215:
-#line 521 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 238: /* server_do_udp: VAR_DO_UDP STRING_ARG  */
+#line 543 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_udp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_udp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2637 "util/configparser.c" /* yacc.c:1646  */
+#line 2604 "util/configparser.c"
     break;
 
-  case 216:
-#line 530 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 239: /* server_do_tcp: VAR_DO_TCP STRING_ARG  */
+#line 552 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_tcp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_tcp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2649 "util/configparser.c" /* yacc.c:1646  */
+#line 2616 "util/configparser.c"
     break;
 
-  case 217:
-#line 539 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 240: /* server_prefer_ip6: VAR_PREFER_IP6 STRING_ARG  */
+#line 561 "util/configparser.y"
+        {
 		OUTYY(("P(server_prefer_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefer_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2661 "util/configparser.c" /* yacc.c:1646  */
+#line 2628 "util/configparser.c"
     break;
 
-  case 218:
-#line 548 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 241: /* server_tcp_mss: VAR_TCP_MSS STRING_ARG  */
+#line 570 "util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_mss:%s)\n", (yyvsp[0].str)));
                 if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
                         yyerror("number expected");
                 else cfg_parser->cfg->tcp_mss = atoi((yyvsp[0].str));
                 free((yyvsp[0].str));
 	}
-#line 2673 "util/configparser.c" /* yacc.c:1646  */
+#line 2640 "util/configparser.c"
     break;
 
-  case 219:
-#line 557 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 242: /* server_outgoing_tcp_mss: VAR_OUTGOING_TCP_MSS STRING_ARG  */
+#line 579 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_tcp_mss:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_tcp_mss = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2685 "util/configparser.c" /* yacc.c:1646  */
+#line 2652 "util/configparser.c"
     break;
 
-  case 220:
-#line 566 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[0].str)));
-		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
-			yyerror("expected yes or no.");
-		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[0].str), "yes")==0);
+  case 243: /* server_tcp_fastopen_queue: VAR_TCP_FASTOPEN_QUEUE STRING_ARG  */
+#line 588 "util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_fastopen_queue:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_fastopen_queue = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2697 "util/configparser.c" /* yacc.c:1646  */
+#line 2664 "util/configparser.c"
     break;
 
-  case 221:
-#line 575 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[0].str)));
+  case 244: /* server_tcp_upstream_fastopen: VAR_TCP_UPSTREAM_FASTOPEN STRING_ARG  */
+#line 597 "util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_upstream_fastopen:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[0].str), "yes")==0);
+		else cfg_parser->cfg->tcp_upstream_fastopen =
+			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2709 "util/configparser.c" /* yacc.c:1646  */
+#line 2677 "util/configparser.c"
     break;
 
-  case 222:
-#line 584 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[0].str)));
-		free(cfg_parser->cfg->ssl_service_key);
-		cfg_parser->cfg->ssl_service_key = (yyvsp[0].str);
-	}
-#line 2719 "util/configparser.c" /* yacc.c:1646  */
-    break;
-
-  case 223:
-#line 591 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[0].str)));
-		free(cfg_parser->cfg->ssl_service_pem);
-		cfg_parser->cfg->ssl_service_pem = (yyvsp[0].str);
+  case 245: /* server_tcp_idle_timeout: VAR_TCP_IDLE_TIMEOUT STRING_ARG  */
+#line 607 "util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_idle_timeout:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_idle_timeout = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
-#line 2729 "util/configparser.c" /* yacc.c:1646  */
+#line 2689 "util/configparser.c"
     break;
 
-  case 224:
-#line 598 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[0].str)));
-		if(atoi((yyvsp[0].str)) == 0)
-			yyerror("port number expected");
-		else cfg_parser->cfg->ssl_port = atoi((yyvsp[0].str));
+  case 246: /* server_edns_tcp_keepalive: VAR_EDNS_TCP_KEEPALIVE STRING_ARG  */
+#line 616 "util/configparser.y"
+        {
+		OUTYY(("P(server_edns_tcp_keepalive:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->do_tcp_keepalive =
+			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2741 "util/configparser.c" /* yacc.c:1646  */
+#line 2702 "util/configparser.c"
     break;
 
-  case 225:
-#line 607 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 247: /* server_edns_tcp_keepalive_timeout: VAR_EDNS_TCP_KEEPALIVE_TIMEOUT STRING_ARG  */
+#line 626 "util/configparser.y"
+        {
+		OUTYY(("P(server_edns_tcp_keepalive_timeout:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_keepalive_timeout = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2714 "util/configparser.c"
+    break;
+
+  case 248: /* server_answer_cookie: VAR_ANSWER_COOKIE STRING_ARG  */
+#line 635 "util/configparser.y"
+        {
+		OUTYY(("P(server_answer_cookie:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->do_answer_cookie =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2727 "util/configparser.c"
+    break;
+
+  case 249: /* server_cookie_secret: VAR_COOKIE_SECRET STRING_ARG  */
+#line 645 "util/configparser.y"
+        {
+		OUTYY(("P(server_cookie_secret:%s)\n", (yyvsp[0].str)));
+		if(strlen((yyvsp[0].str)) != 32 ||
+			strspn((yyvsp[0].str), "0123456789abcdefABCDEF") != 32) {
+			yyerror("expected 32 hex digits for cookie-secret");
+			free((yyvsp[0].str));
+		} else {
+			free(cfg_parser->cfg->cookie_secret);
+			cfg_parser->cfg->cookie_secret = (yyvsp[0].str);
+		}
+	}
+#line 2743 "util/configparser.c"
+    break;
+
+  case 250: /* server_upstream_cookie: VAR_UPSTREAM_COOKIE STRING_ARG  */
+#line 658 "util/configparser.y"
+        {
+		OUTYY(("P(server_upstream_cookie:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->upstream_cookie =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2756 "util/configparser.c"
+    break;
+
+  case 251: /* server_tcp_upstream: VAR_TCP_UPSTREAM STRING_ARG  */
+#line 668 "util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2768 "util/configparser.c"
+    break;
+
+  case 252: /* server_ssl_upstream: VAR_SSL_UPSTREAM STRING_ARG  */
+#line 677 "util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2780 "util/configparser.c"
+    break;
+
+  case 253: /* server_ssl_service_key: VAR_SSL_SERVICE_KEY STRING_ARG  */
+#line 686 "util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->ssl_service_key);
+		cfg_parser->cfg->ssl_service_key = (yyvsp[0].str);
+	}
+#line 2790 "util/configparser.c"
+    break;
+
+  case 254: /* server_ssl_service_pem: VAR_SSL_SERVICE_PEM STRING_ARG  */
+#line 693 "util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->ssl_service_pem);
+		cfg_parser->cfg->ssl_service_pem = (yyvsp[0].str);
+	}
+#line 2800 "util/configparser.c"
+    break;
+
+  case 255: /* server_ssl_port: VAR_SSL_PORT STRING_ARG  */
+#line 700 "util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
+			yyerror("port number expected");
+		else cfg_parser->cfg->ssl_port = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2812 "util/configparser.c"
+    break;
+
+  case 256: /* server_use_systemd: VAR_USE_SYSTEMD STRING_ARG  */
+#line 709 "util/configparser.y"
+        {
 		OUTYY(("P(server_use_systemd:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->use_systemd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2753 "util/configparser.c" /* yacc.c:1646  */
+#line 2824 "util/configparser.c"
     break;
 
-  case 226:
-#line 616 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 257: /* server_do_daemonize: VAR_DO_DAEMONIZE STRING_ARG  */
+#line 718 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_daemonize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_daemonize = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2765 "util/configparser.c" /* yacc.c:1646  */
+#line 2836 "util/configparser.c"
     break;
 
-  case 227:
-#line 625 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 258: /* server_use_syslog: VAR_USE_SYSLOG STRING_ARG  */
+#line 727 "util/configparser.y"
+        {
 		OUTYY(("P(server_use_syslog:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -2778,68 +2849,68 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 2782 "util/configparser.c" /* yacc.c:1646  */
+#line 2853 "util/configparser.c"
     break;
 
-  case 228:
-#line 639 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 259: /* server_log_time_ascii: VAR_LOG_TIME_ASCII STRING_ARG  */
+#line 741 "util/configparser.y"
+        {
 		OUTYY(("P(server_log_time_ascii:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->log_time_ascii = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2794 "util/configparser.c" /* yacc.c:1646  */
+#line 2865 "util/configparser.c"
     break;
 
-  case 229:
-#line 648 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 260: /* server_log_queries: VAR_LOG_QUERIES STRING_ARG  */
+#line 750 "util/configparser.y"
+        {
 		OUTYY(("P(server_log_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->log_queries = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2806 "util/configparser.c" /* yacc.c:1646  */
+#line 2877 "util/configparser.c"
     break;
 
-  case 230:
-#line 657 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 261: /* server_log_replies: VAR_LOG_REPLIES STRING_ARG  */
+#line 759 "util/configparser.y"
+  {
   	OUTYY(("P(server_log_replies:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
   		yyerror("expected yes or no.");
   	else cfg_parser->cfg->log_replies = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 2818 "util/configparser.c" /* yacc.c:1646  */
+#line 2889 "util/configparser.c"
     break;
 
-  case 231:
-#line 666 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 262: /* server_chroot: VAR_CHROOT STRING_ARG  */
+#line 768 "util/configparser.y"
+        {
 		OUTYY(("P(server_chroot:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->chrootdir);
 		cfg_parser->cfg->chrootdir = (yyvsp[0].str);
 	}
-#line 2828 "util/configparser.c" /* yacc.c:1646  */
+#line 2899 "util/configparser.c"
     break;
 
-  case 232:
-#line 673 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 263: /* server_username: VAR_USERNAME STRING_ARG  */
+#line 775 "util/configparser.y"
+        {
 		OUTYY(("P(server_username:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->username);
 		cfg_parser->cfg->username = (yyvsp[0].str);
 	}
-#line 2838 "util/configparser.c" /* yacc.c:1646  */
+#line 2909 "util/configparser.c"
     break;
 
-  case 233:
-#line 680 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 264: /* server_directory: VAR_DIRECTORY STRING_ARG  */
+#line 782 "util/configparser.y"
+        {
 		OUTYY(("P(server_directory:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->directory);
 		cfg_parser->cfg->directory = (yyvsp[0].str);
@@ -2863,193 +2934,193 @@ yyreduce:
 			}
 		}
 	}
-#line 2867 "util/configparser.c" /* yacc.c:1646  */
+#line 2938 "util/configparser.c"
     break;
 
-  case 234:
-#line 706 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 265: /* server_logfile: VAR_LOGFILE STRING_ARG  */
+#line 808 "util/configparser.y"
+        {
 		OUTYY(("P(server_logfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->logfile);
 		cfg_parser->cfg->logfile = (yyvsp[0].str);
 		cfg_parser->cfg->use_syslog = 0;
 	}
-#line 2878 "util/configparser.c" /* yacc.c:1646  */
+#line 2949 "util/configparser.c"
     break;
 
-  case 235:
-#line 714 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 266: /* server_pidfile: VAR_PIDFILE STRING_ARG  */
+#line 816 "util/configparser.y"
+        {
 		OUTYY(("P(server_pidfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->pidfile);
 		cfg_parser->cfg->pidfile = (yyvsp[0].str);
 	}
-#line 2888 "util/configparser.c" /* yacc.c:1646  */
+#line 2959 "util/configparser.c"
     break;
 
-  case 236:
-#line 721 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 267: /* server_root_hints: VAR_ROOT_HINTS STRING_ARG  */
+#line 823 "util/configparser.y"
+        {
 		OUTYY(("P(server_root_hints:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->root_hints, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2898 "util/configparser.c" /* yacc.c:1646  */
+#line 2969 "util/configparser.c"
     break;
 
-  case 237:
-#line 728 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 268: /* server_dlv_anchor_file: VAR_DLV_ANCHOR_FILE STRING_ARG  */
+#line 830 "util/configparser.y"
+        {
 		OUTYY(("P(server_dlv_anchor_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dlv_anchor_file);
 		cfg_parser->cfg->dlv_anchor_file = (yyvsp[0].str);
 	}
-#line 2908 "util/configparser.c" /* yacc.c:1646  */
+#line 2979 "util/configparser.c"
     break;
 
-  case 238:
-#line 735 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 269: /* server_dlv_anchor: VAR_DLV_ANCHOR STRING_ARG  */
+#line 837 "util/configparser.y"
+        {
 		OUTYY(("P(server_dlv_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dlv_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2918 "util/configparser.c" /* yacc.c:1646  */
+#line 2989 "util/configparser.c"
     break;
 
-  case 239:
-#line 742 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 270: /* server_auto_trust_anchor_file: VAR_AUTO_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 844 "util/configparser.y"
+        {
 		OUTYY(("P(server_auto_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			auto_trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2929 "util/configparser.c" /* yacc.c:1646  */
+#line 3000 "util/configparser.c"
     break;
 
-  case 240:
-#line 750 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 271: /* server_trust_anchor_file: VAR_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 852 "util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2940 "util/configparser.c" /* yacc.c:1646  */
+#line 3011 "util/configparser.c"
     break;
 
-  case 241:
-#line 758 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 272: /* server_trusted_keys_file: VAR_TRUSTED_KEYS_FILE STRING_ARG  */
+#line 860 "util/configparser.y"
+        {
 		OUTYY(("P(server_trusted_keys_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trusted_keys_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2951 "util/configparser.c" /* yacc.c:1646  */
+#line 3022 "util/configparser.c"
     break;
 
-  case 242:
-#line 766 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 273: /* server_trust_anchor: VAR_TRUST_ANCHOR STRING_ARG  */
+#line 868 "util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->trust_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2961 "util/configparser.c" /* yacc.c:1646  */
+#line 3032 "util/configparser.c"
     break;
 
-  case 243:
-#line 773 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 274: /* server_domain_insecure: VAR_DOMAIN_INSECURE STRING_ARG  */
+#line 875 "util/configparser.y"
+        {
 		OUTYY(("P(server_domain_insecure:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->domain_insecure, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2971 "util/configparser.c" /* yacc.c:1646  */
+#line 3042 "util/configparser.c"
     break;
 
-  case 244:
-#line 780 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 275: /* server_hide_identity: VAR_HIDE_IDENTITY STRING_ARG  */
+#line 882 "util/configparser.y"
+        {
 		OUTYY(("P(server_hide_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_identity = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2983 "util/configparser.c" /* yacc.c:1646  */
+#line 3054 "util/configparser.c"
     break;
 
-  case 245:
-#line 789 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 276: /* server_hide_version: VAR_HIDE_VERSION STRING_ARG  */
+#line 891 "util/configparser.y"
+        {
 		OUTYY(("P(server_hide_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_version = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2995 "util/configparser.c" /* yacc.c:1646  */
+#line 3066 "util/configparser.c"
     break;
 
-  case 246:
-#line 798 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 277: /* server_hide_trustanchor: VAR_HIDE_TRUSTANCHOR STRING_ARG  */
+#line 900 "util/configparser.y"
+        {
 		OUTYY(("P(server_hide_trustanchor:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_trustanchor = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3007 "util/configparser.c" /* yacc.c:1646  */
+#line 3078 "util/configparser.c"
     break;
 
-  case 247:
-#line 807 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 278: /* server_identity: VAR_IDENTITY STRING_ARG  */
+#line 909 "util/configparser.y"
+        {
 		OUTYY(("P(server_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->identity);
 		cfg_parser->cfg->identity = (yyvsp[0].str);
 	}
-#line 3017 "util/configparser.c" /* yacc.c:1646  */
+#line 3088 "util/configparser.c"
     break;
 
-  case 248:
-#line 814 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 279: /* server_version: VAR_VERSION STRING_ARG  */
+#line 916 "util/configparser.y"
+        {
 		OUTYY(("P(server_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->version);
 		cfg_parser->cfg->version = (yyvsp[0].str);
 	}
-#line 3027 "util/configparser.c" /* yacc.c:1646  */
+#line 3098 "util/configparser.c"
     break;
 
-  case 249:
-#line 821 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 280: /* server_so_rcvbuf: VAR_SO_RCVBUF STRING_ARG  */
+#line 923 "util/configparser.y"
+        {
 		OUTYY(("P(server_so_rcvbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_rcvbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 3038 "util/configparser.c" /* yacc.c:1646  */
+#line 3109 "util/configparser.c"
     break;
 
-  case 250:
-#line 829 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 281: /* server_so_sndbuf: VAR_SO_SNDBUF STRING_ARG  */
+#line 931 "util/configparser.y"
+        {
 		OUTYY(("P(server_so_sndbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_sndbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 3049 "util/configparser.c" /* yacc.c:1646  */
+#line 3120 "util/configparser.c"
     break;
 
-  case 251:
-#line 837 "./util/configparser.y" /* yacc.c:1646  */
+  case 282: /* server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG  */
+#line 939 "util/configparser.y"
     {
         OUTYY(("P(server_so_reuseport:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3058,11 +3129,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3062 "util/configparser.c" /* yacc.c:1646  */
+#line 3133 "util/configparser.c"
     break;
 
-  case 252:
-#line 847 "./util/configparser.y" /* yacc.c:1646  */
+  case 283: /* server_ip_transparent: VAR_IP_TRANSPARENT STRING_ARG  */
+#line 949 "util/configparser.y"
     {
         OUTYY(("P(server_ip_transparent:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3071,11 +3142,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3075 "util/configparser.c" /* yacc.c:1646  */
+#line 3146 "util/configparser.c"
     break;
 
-  case 253:
-#line 857 "./util/configparser.y" /* yacc.c:1646  */
+  case 284: /* server_ip_freebind: VAR_IP_FREEBIND STRING_ARG  */
+#line 959 "util/configparser.y"
     {
         OUTYY(("P(server_ip_freebind:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3084,12 +3155,12 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3088 "util/configparser.c" /* yacc.c:1646  */
+#line 3159 "util/configparser.c"
     break;
 
-  case 254:
-#line 867 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 285: /* server_edns_buffer_size: VAR_EDNS_BUFFER_SIZE STRING_ARG  */
+#line 969 "util/configparser.y"
+        {
 		OUTYY(("P(server_edns_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3100,12 +3171,12 @@ yyreduce:
 		else cfg_parser->cfg->edns_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3104 "util/configparser.c" /* yacc.c:1646  */
+#line 3175 "util/configparser.c"
     break;
 
-  case 255:
-#line 880 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 286: /* server_msg_buffer_size: VAR_MSG_BUFFER_SIZE STRING_ARG  */
+#line 982 "util/configparser.y"
+        {
 		OUTYY(("P(server_msg_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3114,23 +3185,23 @@ yyreduce:
 		else cfg_parser->cfg->msg_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3118 "util/configparser.c" /* yacc.c:1646  */
+#line 3189 "util/configparser.c"
     break;
 
-  case 256:
-#line 891 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 287: /* server_msg_cache_size: VAR_MSG_CACHE_SIZE STRING_ARG  */
+#line 993 "util/configparser.y"
+        {
 		OUTYY(("P(server_msg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->msg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3129 "util/configparser.c" /* yacc.c:1646  */
+#line 3200 "util/configparser.c"
     break;
 
-  case 257:
-#line 899 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 288: /* server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG  */
+#line 1001 "util/configparser.y"
+        {
 		OUTYY(("P(server_msg_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3141,48 +3212,48 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3145 "util/configparser.c" /* yacc.c:1646  */
+#line 3216 "util/configparser.c"
     break;
 
-  case 258:
-#line 912 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 289: /* server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG  */
+#line 1014 "util/configparser.y"
+        {
 		OUTYY(("P(server_num_queries_per_thread:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->num_queries_per_thread = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3157 "util/configparser.c" /* yacc.c:1646  */
+#line 3228 "util/configparser.c"
     break;
 
-  case 259:
-#line 921 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 290: /* server_jostle_timeout: VAR_JOSTLE_TIMEOUT STRING_ARG  */
+#line 1023 "util/configparser.y"
+        {
 		OUTYY(("P(server_jostle_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->jostle_time = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3169 "util/configparser.c" /* yacc.c:1646  */
+#line 3240 "util/configparser.c"
     break;
 
-  case 260:
-#line 930 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 291: /* server_delay_close: VAR_DELAY_CLOSE STRING_ARG  */
+#line 1032 "util/configparser.y"
+        {
 		OUTYY(("P(server_delay_close:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->delay_close = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3181 "util/configparser.c" /* yacc.c:1646  */
+#line 3252 "util/configparser.c"
     break;
 
-  case 261:
-#line 939 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 292: /* server_unblock_lan_zones: VAR_UNBLOCK_LAN_ZONES STRING_ARG  */
+#line 1041 "util/configparser.y"
+        {
 		OUTYY(("P(server_unblock_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3190,12 +3261,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3194 "util/configparser.c" /* yacc.c:1646  */
+#line 3265 "util/configparser.c"
     break;
 
-  case 262:
-#line 949 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 293: /* server_insecure_lan_zones: VAR_INSECURE_LAN_ZONES STRING_ARG  */
+#line 1051 "util/configparser.y"
+        {
 		OUTYY(("P(server_insecure_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3203,23 +3274,23 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3207 "util/configparser.c" /* yacc.c:1646  */
+#line 3278 "util/configparser.c"
     break;
 
-  case 263:
-#line 959 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 294: /* server_rrset_cache_size: VAR_RRSET_CACHE_SIZE STRING_ARG  */
+#line 1061 "util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->rrset_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3218 "util/configparser.c" /* yacc.c:1646  */
+#line 3289 "util/configparser.c"
     break;
 
-  case 264:
-#line 967 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 295: /* server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG  */
+#line 1069 "util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3230,58 +3301,156 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3234 "util/configparser.c" /* yacc.c:1646  */
+#line 3305 "util/configparser.c"
     break;
 
-  case 265:
-#line 980 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 296: /* server_cache_pin: VAR_CACHE_PIN STRING_ARG STRING_ARG  */
+#line 1082 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_pin:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
+		if(!cfg_str2list_insert(&cfg_parser->cfg->cache_pins, (yyvsp[-1].str), (yyvsp[0].str)))
+			fatal_exit("out of memory adding cache-pin");
+	}
+#line 3315 "util/configparser.c"
+    break;
+
+  case 297: /* server_cache_pin_suffix: VAR_CACHE_PIN_SUFFIX STRING_ARG  */
+#line 1089 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_pin_suffix:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->cache_pin_suffixes,
+			(yyvsp[0].str)))
+			fatal_exit("out of memory adding cache-pin-suffix");
+	}
+#line 3326 "util/configparser.c"
+    break;
+
+  case 298: /* server_cache_pin_max_size: VAR_CACHE_PIN_MAX_SIZE STRING_ARG  */
+#line 1097 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_pin_max_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->cache_pin_max_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 3337 "util/configparser.c"
+    break;
+
+  case 299: /* server_cache_peer: VAR_CACHE_PEER STRING_ARG  */
+#line 1105 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_peer:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->cache_peers, (yyvsp[0].str)))
+			fatal_exit("out of memory adding cache-peer");
+	}
+#line 3347 "util/configparser.c"
+    break;
+
+  case 300: /* server_cache_peer_port: VAR_CACHE_PEER_PORT STRING_ARG  */
+#line 1112 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_peer_port:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) <= 0 || atoi((yyvsp[0].str)) > 65535)
+			yyerror("port number expected");
+		else cfg_parser->cfg->cache_peer_port = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3359 "util/configparser.c"
+    break;
+
+  case 301: /* server_cache_peer_interface: VAR_CACHE_PEER_INTERFACE STRING_ARG  */
+#line 1121 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_peer_interface:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->cache_peer_ifs, (yyvsp[0].str)))
+			fatal_exit("out of memory adding cache-peer-interface");
+	}
+#line 3369 "util/configparser.c"
+    break;
+
+  case 302: /* server_cache_peer_rate: VAR_CACHE_PEER_RATE STRING_ARG  */
+#line 1128 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_peer_rate:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->cache_peer_rate = (size_t)atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3381 "util/configparser.c"
+    break;
+
+  case 303: /* server_xdp_interface: VAR_XDP_INTERFACE STRING_ARG  */
+#line 1137 "util/configparser.y"
+        {
+		OUTYY(("P(server_xdp_interface:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->xdp_ifs, (yyvsp[0].str)))
+			fatal_exit("out of memory adding xdp-interface");
+	}
+#line 3391 "util/configparser.c"
+    break;
+
+  case 304: /* server_xdp_native: VAR_XDP_NATIVE STRING_ARG  */
+#line 1144 "util/configparser.y"
+        {
+		OUTYY(("P(server_xdp_native:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->xdp_native = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3403 "util/configparser.c"
+    break;
+
+  case 305: /* server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG  */
+#line 1153 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_host_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->host_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3246 "util/configparser.c" /* yacc.c:1646  */
+#line 3415 "util/configparser.c"
     break;
 
-  case 266:
-#line 989 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 306: /* server_infra_lame_ttl: VAR_INFRA_LAME_TTL STRING_ARG  */
+#line 1162 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_lame_ttl:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-lame-ttl: %s (option "
 			"removed, use infra-host-ttl)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3257 "util/configparser.c" /* yacc.c:1646  */
+#line 3426 "util/configparser.c"
     break;
 
-  case 267:
-#line 997 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 307: /* server_infra_cache_numhosts: VAR_INFRA_CACHE_NUMHOSTS STRING_ARG  */
+#line 1170 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_numhosts:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->infra_cache_numhosts = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3269 "util/configparser.c" /* yacc.c:1646  */
+#line 3438 "util/configparser.c"
     break;
 
-  case 268:
-#line 1006 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 308: /* server_infra_cache_lame_size: VAR_INFRA_CACHE_LAME_SIZE STRING_ARG  */
+#line 1179 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_lame_size:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-cache-lame-size: %s "
 			"(option removed, use infra-cache-numhosts)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3280 "util/configparser.c" /* yacc.c:1646  */
+#line 3449 "util/configparser.c"
     break;
 
-  case 269:
-#line 1014 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 309: /* server_infra_cache_slabs: VAR_INFRA_CACHE_SLABS STRING_ARG  */
+#line 1187 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3292,34 +3461,34 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3296 "util/configparser.c" /* yacc.c:1646  */
+#line 3465 "util/configparser.c"
     break;
 
-  case 270:
-#line 1027 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 310: /* server_infra_cache_min_rtt: VAR_INFRA_CACHE_MIN_RTT STRING_ARG  */
+#line 1200 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_min_rtt:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->infra_cache_min_rtt = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3308 "util/configparser.c" /* yacc.c:1646  */
+#line 3477 "util/configparser.c"
     break;
 
-  case 271:
-#line 1036 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 311: /* server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG  */
+#line 1209 "util/configparser.y"
+        {
 		OUTYY(("P(server_target_fetch_policy:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->target_fetch_policy);
 		cfg_parser->cfg->target_fetch_policy = (yyvsp[0].str);
 	}
-#line 3318 "util/configparser.c" /* yacc.c:1646  */
+#line 3487 "util/configparser.c"
     break;
 
-  case 272:
-#line 1043 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 312: /* server_harden_short_bufsize: VAR_HARDEN_SHORT_BUFSIZE STRING_ARG  */
+#line 1216 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_short_bufsize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3327,12 +3496,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3331 "util/configparser.c" /* yacc.c:1646  */
+#line 3500 "util/configparser.c"
     break;
 
-  case 273:
-#line 1053 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 313: /* server_harden_large_queries: VAR_HARDEN_LARGE_QUERIES STRING_ARG  */
+#line 1226 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_large_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3340,12 +3509,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3344 "util/configparser.c" /* yacc.c:1646  */
+#line 3513 "util/configparser.c"
     break;
 
-  case 274:
-#line 1063 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 314: /* server_harden_glue: VAR_HARDEN_GLUE STRING_ARG  */
+#line 1236 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_glue:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3353,12 +3522,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3357 "util/configparser.c" /* yacc.c:1646  */
+#line 3526 "util/configparser.c"
     break;
 
-  case 275:
-#line 1073 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 315: /* server_harden_dnssec_stripped: VAR_HARDEN_DNSSEC_STRIPPED STRING_ARG  */
+#line 1246 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_dnssec_stripped:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3366,12 +3535,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3370 "util/configparser.c" /* yacc.c:1646  */
+#line 3539 "util/configparser.c"
     break;
 
-  case 276:
-#line 1083 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 316: /* server_harden_below_nxdomain: VAR_HARDEN_BELOW_NXDOMAIN STRING_ARG  */
+#line 1256 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_below_nxdomain:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3379,12 +3548,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3383 "util/configparser.c" /* yacc.c:1646  */
+#line 3552 "util/configparser.c"
     break;
 
-  case 277:
-#line 1093 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 317: /* server_harden_referral_path: VAR_HARDEN_REFERRAL_PATH STRING_ARG  */
+#line 1266 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_referral_path:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3392,12 +3561,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3396 "util/configparser.c" /* yacc.c:1646  */
+#line 3565 "util/configparser.c"
     break;
 
-  case 278:
-#line 1103 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 318: /* server_harden_algo_downgrade: VAR_HARDEN_ALGO_DOWNGRADE STRING_ARG  */
+#line 1276 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_algo_downgrade:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3405,12 +3574,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3409 "util/configparser.c" /* yacc.c:1646  */
+#line 3578 "util/configparser.c"
     break;
 
-  case 279:
-#line 1113 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 319: /* server_use_caps_for_id: VAR_USE_CAPS_FOR_ID STRING_ARG  */
+#line 1286 "util/configparser.y"
+        {
 		OUTYY(("P(server_use_caps_for_id:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3418,88 +3587,88 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3422 "util/configparser.c" /* yacc.c:1646  */
+#line 3591 "util/configparser.c"
     break;
 
-  case 280:
-#line 1123 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 320: /* server_caps_whitelist: VAR_CAPS_WHITELIST STRING_ARG  */
+#line 1296 "util/configparser.y"
+        {
 		OUTYY(("P(server_caps_whitelist:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->caps_whitelist, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3432 "util/configparser.c" /* yacc.c:1646  */
+#line 3601 "util/configparser.c"
     break;
 
-  case 281:
-#line 1130 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 321: /* server_private_address: VAR_PRIVATE_ADDRESS STRING_ARG  */
+#line 1303 "util/configparser.y"
+        {
 		OUTYY(("P(server_private_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_address, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3442 "util/configparser.c" /* yacc.c:1646  */
+#line 3611 "util/configparser.c"
     break;
 
-  case 282:
-#line 1137 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 322: /* server_private_domain: VAR_PRIVATE_DOMAIN STRING_ARG  */
+#line 1310 "util/configparser.y"
+        {
 		OUTYY(("P(server_private_domain:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_domain, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3452 "util/configparser.c" /* yacc.c:1646  */
+#line 3621 "util/configparser.c"
     break;
 
-  case 283:
-#line 1144 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 323: /* server_prefetch: VAR_PREFETCH STRING_ARG  */
+#line 1317 "util/configparser.y"
+        {
 		OUTYY(("P(server_prefetch:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefetch = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3464 "util/configparser.c" /* yacc.c:1646  */
+#line 3633 "util/configparser.c"
     break;
 
-  case 284:
-#line 1153 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 324: /* server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG  */
+#line 1326 "util/configparser.y"
+        {
 		OUTYY(("P(server_prefetch_key:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefetch_key = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3476 "util/configparser.c" /* yacc.c:1646  */
+#line 3645 "util/configparser.c"
     break;
 
-  case 285:
-#line 1162 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 325: /* server_unwanted_reply_threshold: VAR_UNWANTED_REPLY_THRESHOLD STRING_ARG  */
+#line 1335 "util/configparser.y"
+        {
 		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->unwanted_threshold = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3488 "util/configparser.c" /* yacc.c:1646  */
+#line 3657 "util/configparser.c"
     break;
 
-  case 286:
-#line 1171 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 326: /* server_do_not_query_address: VAR_DO_NOT_QUERY_ADDRESS STRING_ARG  */
+#line 1344 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_not_query_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->donotqueryaddrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3498 "util/configparser.c" /* yacc.c:1646  */
+#line 3667 "util/configparser.c"
     break;
 
-  case 287:
-#line 1178 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 327: /* server_do_not_query_localhost: VAR_DO_NOT_QUERY_LOCALHOST STRING_ARG  */
+#line 1351 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_not_query_localhost:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3507,12 +3676,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3511 "util/configparser.c" /* yacc.c:1646  */
+#line 3680 "util/configparser.c"
     break;
 
-  case 288:
-#line 1188 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 328: /* server_access_control: VAR_ACCESS_CONTROL STRING_ARG STRING_ARG  */
+#line 1361 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "deny")!=0 && strcmp((yyvsp[0].str), "refuse")!=0 &&
 			strcmp((yyvsp[0].str), "deny_non_local")!=0 &&
@@ -3527,22 +3696,22 @@ yyreduce:
 				fatal_exit("out of memory adding acl");
 		}
 	}
-#line 3531 "util/configparser.c" /* yacc.c:1646  */
+#line 3700 "util/configparser.c"
     break;
 
-  case 289:
-#line 1205 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 329: /* server_module_conf: VAR_MODULE_CONF STRING_ARG  */
+#line 1378 "util/configparser.y"
+        {
 		OUTYY(("P(server_module_conf:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->module_conf);
 		cfg_parser->cfg->module_conf = (yyvsp[0].str);
 	}
-#line 3541 "util/configparser.c" /* yacc.c:1646  */
+#line 3710 "util/configparser.c"
     break;
 
-  case 290:
-#line 1212 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 330: /* server_val_override_date: VAR_VAL_OVERRIDE_DATE STRING_ARG  */
+#line 1385 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_override_date:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_date_override = 0;
@@ -3558,12 +3727,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3562 "util/configparser.c" /* yacc.c:1646  */
+#line 3731 "util/configparser.c"
     break;
 
-  case 291:
-#line 1230 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 331: /* server_val_sig_skew_min: VAR_VAL_SIG_SKEW_MIN STRING_ARG  */
+#line 1403 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_sig_skew_min:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_min = 0;
@@ -3574,12 +3743,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3578 "util/configparser.c" /* yacc.c:1646  */
+#line 3747 "util/configparser.c"
     break;
 
-  case 292:
-#line 1243 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 332: /* server_val_sig_skew_max: VAR_VAL_SIG_SKEW_MAX STRING_ARG  */
+#line 1416 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_sig_skew_max:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_max = 0;
@@ -3590,60 +3759,60 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3594 "util/configparser.c" /* yacc.c:1646  */
+#line 3763 "util/configparser.c"
     break;
 
-  case 293:
-#line 1256 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 333: /* server_cache_max_ttl: VAR_CACHE_MAX_TTL STRING_ARG  */
+#line 1429 "util/configparser.y"
+        {
 		OUTYY(("P(server_cache_max_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->max_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3606 "util/configparser.c" /* yacc.c:1646  */
+#line 3775 "util/configparser.c"
     break;
 
-  case 294:
-#line 1265 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 334: /* server_cache_max_negative_ttl: VAR_CACHE_MAX_NEGATIVE_TTL STRING_ARG  */
+#line 1438 "util/configparser.y"
+        {
 		OUTYY(("P(server_cache_max_negative_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->max_negative_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3618 "util/configparser.c" /* yacc.c:1646  */
+#line 3787 "util/configparser.c"
     break;
 
-  case 295:
-#line 1274 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 335: /* server_cache_min_ttl: VAR_CACHE_MIN_TTL STRING_ARG  */
+#line 1447 "util/configparser.y"
+        {
 		OUTYY(("P(server_cache_min_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->min_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3630 "util/configparser.c" /* yacc.c:1646  */
+#line 3799 "util/configparser.c"
     break;
 
-  case 296:
-#line 1283 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 336: /* server_bogus_ttl: VAR_BOGUS_TTL STRING_ARG  */
+#line 1456 "util/configparser.y"
+        {
 		OUTYY(("P(server_bogus_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->bogus_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3642 "util/configparser.c" /* yacc.c:1646  */
+#line 3811 "util/configparser.c"
     break;
 
-  case 297:
-#line 1292 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 337: /* server_val_clean_additional: VAR_VAL_CLEAN_ADDITIONAL STRING_ARG  */
+#line 1465 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_clean_additional:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3651,12 +3820,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3655 "util/configparser.c" /* yacc.c:1646  */
+#line 3824 "util/configparser.c"
     break;
 
-  case 298:
-#line 1302 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 338: /* server_val_permissive_mode: VAR_VAL_PERMISSIVE_MODE STRING_ARG  */
+#line 1475 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_permissive_mode:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3664,36 +3833,36 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3668 "util/configparser.c" /* yacc.c:1646  */
+#line 3837 "util/configparser.c"
     break;
 
-  case 299:
-#line 1312 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 339: /* server_ignore_cd_flag: VAR_IGNORE_CD_FLAG STRING_ARG  */
+#line 1485 "util/configparser.y"
+        {
 		OUTYY(("P(server_ignore_cd_flag:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->ignore_cd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3680 "util/configparser.c" /* yacc.c:1646  */
+#line 3849 "util/configparser.c"
     break;
 
-  case 300:
-#line 1321 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 340: /* server_serve_expired: VAR_SERVE_EXPIRED STRING_ARG  */
+#line 1494 "util/configparser.y"
+        {
 		OUTYY(("P(server_serve_expired:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->serve_expired = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3692 "util/configparser.c" /* yacc.c:1646  */
+#line 3861 "util/configparser.c"
     break;
 
-  case 301:
-#line 1330 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 341: /* server_fake_dsa: VAR_FAKE_DSA STRING_ARG  */
+#line 1503 "util/configparser.y"
+        {
 		OUTYY(("P(server_fake_dsa:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3704,12 +3873,12 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 3708 "util/configparser.c" /* yacc.c:1646  */
+#line 3877 "util/configparser.c"
     break;
 
-  case 302:
-#line 1343 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 342: /* server_fake_sha1: VAR_FAKE_SHA1 STRING_ARG  */
+#line 1516 "util/configparser.y"
+        {
 		OUTYY(("P(server_fake_sha1:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3720,70 +3889,70 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 3724 "util/configparser.c" /* yacc.c:1646  */
+#line 3893 "util/configparser.c"
     break;
 
-  case 303:
-#line 1356 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 343: /* server_val_log_level: VAR_VAL_LOG_LEVEL STRING_ARG  */
+#line 1529 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_log_level:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->val_log_level = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3736 "util/configparser.c" /* yacc.c:1646  */
+#line 3905 "util/configparser.c"
     break;
 
-  case 304:
-#line 1365 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 344: /* server_val_nsec3_keysize_iterations: VAR_VAL_NSEC3_KEYSIZE_ITERATIONS STRING_ARG  */
+#line 1538 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->val_nsec3_key_iterations);
 		cfg_parser->cfg->val_nsec3_key_iterations = (yyvsp[0].str);
 	}
-#line 3746 "util/configparser.c" /* yacc.c:1646  */
+#line 3915 "util/configparser.c"
     break;
 
-  case 305:
-#line 1372 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 345: /* server_add_holddown: VAR_ADD_HOLDDOWN STRING_ARG  */
+#line 1545 "util/configparser.y"
+        {
 		OUTYY(("P(server_add_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->add_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3758 "util/configparser.c" /* yacc.c:1646  */
+#line 3927 "util/configparser.c"
     break;
 
-  case 306:
-#line 1381 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 346: /* server_del_holddown: VAR_DEL_HOLDDOWN STRING_ARG  */
+#line 1554 "util/configparser.y"
+        {
 		OUTYY(("P(server_del_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->del_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3770 "util/configparser.c" /* yacc.c:1646  */
+#line 3939 "util/configparser.c"
     break;
 
-  case 307:
-#line 1390 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 347: /* server_keep_missing: VAR_KEEP_MISSING STRING_ARG  */
+#line 1563 "util/configparser.y"
+        {
 		OUTYY(("P(server_keep_missing:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->keep_missing = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3782 "util/configparser.c" /* yacc.c:1646  */
+#line 3951 "util/configparser.c"
     break;
 
-  case 308:
-#line 1399 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 348: /* server_permit_small_holddown: VAR_PERMIT_SMALL_HOLDDOWN STRING_ARG  */
+#line 1572 "util/configparser.y"
+        {
 		OUTYY(("P(server_permit_small_holddown:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3791,23 +3960,23 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3795 "util/configparser.c" /* yacc.c:1646  */
+#line 3964 "util/configparser.c"
     break;
 
-  case 309:
-#line 1408 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 349: /* server_key_cache_size: VAR_KEY_CACHE_SIZE STRING_ARG  */
+#line 1581 "util/configparser.y"
+        {
 		OUTYY(("P(server_key_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->key_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3806 "util/configparser.c" /* yacc.c:1646  */
+#line 3975 "util/configparser.c"
     break;
 
-  case 310:
-#line 1416 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 350: /* server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG  */
+#line 1589 "util/configparser.y"
+        {
 		OUTYY(("P(server_key_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3818,23 +3987,23 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3822 "util/configparser.c" /* yacc.c:1646  */
+#line 3991 "util/configparser.c"
     break;
 
-  case 311:
-#line 1429 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 351: /* server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG  */
+#line 1602 "util/configparser.y"
+        {
 		OUTYY(("P(server_neg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->neg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3833 "util/configparser.c" /* yacc.c:1646  */
+#line 4002 "util/configparser.c"
     break;
 
-  case 312:
-#line 1437 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 352: /* server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 1610 "util/configparser.y"
+        {
 		OUTYY(("P(server_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
 		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
@@ -3860,22 +4029,22 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 3864 "util/configparser.c" /* yacc.c:1646  */
+#line 4033 "util/configparser.c"
     break;
 
-  case 313:
-#line 1465 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 353: /* server_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 1638 "util/configparser.y"
+        {
 		OUTYY(("P(server_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->local_data, (yyvsp[0].str)))
 			fatal_exit("out of memory adding local-data");
 	}
-#line 3874 "util/configparser.c" /* yacc.c:1646  */
+#line 4043 "util/configparser.c"
     break;
 
-  case 314:
-#line 1472 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 354: /* server_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 1645 "util/configparser.y"
+        {
 		char* ptr;
 		OUTYY(("P(server_local_data_ptr:%s)\n", (yyvsp[0].str)));
 		ptr = cfg_ptr_reverse((yyvsp[0].str));
@@ -3888,12 +4057,12 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 3892 "util/configparser.c" /* yacc.c:1646  */
+#line 4061 "util/configparser.c"
     break;
 
-  case 315:
-#line 1487 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 355: /* server_minimal_responses: VAR_MINIMAL_RESPONSES STRING_ARG  */
+#line 1660 "util/configparser.y"
+        {
 		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3901,12 +4070,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3905 "util/configparser.c" /* yacc.c:1646  */
+#line 4074 "util/configparser.c"
     break;
 
-  case 316:
-#line 1497 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 356: /* server_rrset_roundrobin: VAR_RRSET_ROUNDROBIN STRING_ARG  */
+#line 1670 "util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3914,44 +4083,107 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3918 "util/configparser.c" /* yacc.c:1646  */
+#line 4087 "util/configparser.c"
     break;
 
-  case 317:
-#line 1507 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 357: /* server_max_udp_size: VAR_MAX_UDP_SIZE STRING_ARG  */
+#line 1680 "util/configparser.y"
+        {
 		OUTYY(("P(server_max_udp_size:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->max_udp_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3928 "util/configparser.c" /* yacc.c:1646  */
+#line 4097 "util/configparser.c"
     break;
 
-  case 318:
-#line 1514 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 358: /* server_dns64_prefix: VAR_DNS64_PREFIX STRING_ARG  */
+#line 1687 "util/configparser.y"
+        {
 		OUTYY(("P(dns64_prefix:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dns64_prefix);
 		cfg_parser->cfg->dns64_prefix = (yyvsp[0].str);
 	}
-#line 3938 "util/configparser.c" /* yacc.c:1646  */
+#line 4107 "util/configparser.c"
     break;
 
-  case 319:
-#line 1521 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 359: /* server_dns64_synthall: VAR_DNS64_SYNTHALL STRING_ARG  */
+#line 1694 "util/configparser.y"
+        {
 		OUTYY(("P(server_dns64_synthall:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dns64_synthall = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3950 "util/configparser.c" /* yacc.c:1646  */
+#line 4119 "util/configparser.c"
     break;
 
-  case 320:
-#line 1530 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 360: /* server_cachedb_secret: VAR_CACHEDB_SECRET STRING_ARG  */
+#line 1703 "util/configparser.y"
+        {
+		OUTYY(("P(server_cachedb_secret:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->cachedb_secret);
+		cfg_parser->cfg->cachedb_secret = (yyvsp[0].str);
+	}
+#line 4129 "util/configparser.c"
+    break;
+
+  case 361: /* server_cachedb_compress: VAR_CACHEDB_COMPRESS STRING_ARG  */
+#line 1710 "util/configparser.y"
+        {
+		OUTYY(("P(server_cachedb_compress:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "none") != 0 && strcmp((yyvsp[0].str), "lz4") != 0 &&
+			strcmp((yyvsp[0].str), "zstd") != 0) {
+			yyerror("expected none, lz4 or zstd.");
+			free((yyvsp[0].str));
+		} else {
+			free(cfg_parser->cfg->cachedb_compress);
+			cfg_parser->cfg->cachedb_compress = (yyvsp[0].str);
+		}
+	}
+#line 4145 "util/configparser.c"
+    break;
+
+  case 362: /* server_cachedb_compress_min: VAR_CACHEDB_COMPRESS_MIN STRING_ARG  */
+#line 1723 "util/configparser.y"
+        {
+		OUTYY(("P(server_cachedb_compress_min:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->cachedb_compress_min = (size_t)atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4157 "util/configparser.c"
+    break;
+
+  case 363: /* server_forward_health_check: VAR_FORWARD_HEALTH_CHECK STRING_ARG  */
+#line 1732 "util/configparser.y"
+        {
+		OUTYY(("P(server_forward_health_check:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->fwd_health_check =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4170 "util/configparser.c"
+    break;
+
+  case 364: /* server_forward_probe_interval: VAR_FORWARD_PROBE_INTERVAL STRING_ARG  */
+#line 1742 "util/configparser.y"
+        {
+		OUTYY(("P(server_forward_probe_interval:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->fwd_probe_interval = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4182 "util/configparser.c"
+    break;
+
+  case 365: /* server_define_tag: VAR_DEFINE_TAG STRING_ARG  */
+#line 1751 "util/configparser.y"
+        {
 		char* p, *s = (yyvsp[0].str);
 		OUTYY(("P(server_define_tag:%s)\n", (yyvsp[0].str)));
 		while((p=strsep(&s, " \t\n")) != NULL) {
@@ -3963,12 +4195,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3967 "util/configparser.c" /* yacc.c:1646  */
+#line 4199 "util/configparser.c"
     break;
 
-  case 321:
-#line 1544 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 366: /* server_local_zone_tag: VAR_LOCAL_ZONE_TAG STRING_ARG STRING_ARG  */
+#line 1765 "util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -3985,12 +4217,12 @@ yyreduce:
 			}
 		}
 	}
-#line 3989 "util/configparser.c" /* yacc.c:1646  */
+#line 4221 "util/configparser.c"
     break;
 
-  case 322:
-#line 1563 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 367: /* server_access_control_tag: VAR_ACCESS_CONTROL_TAG STRING_ARG STRING_ARG  */
+#line 1784 "util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -4007,12 +4239,12 @@ yyreduce:
 			}
 		}
 	}
-#line 4011 "util/configparser.c" /* yacc.c:1646  */
+#line 4243 "util/configparser.c"
     break;
 
-  case 323:
-#line 1582 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 368: /* server_access_control_tag_action: VAR_ACCESS_CONTROL_TAG_ACTION STRING_ARG STRING_ARG STRING_ARG  */
+#line 1803 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_tag_action:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_actions,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4022,12 +4254,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4026 "util/configparser.c" /* yacc.c:1646  */
+#line 4258 "util/configparser.c"
     break;
 
-  case 324:
-#line 1594 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 369: /* server_access_control_tag_data: VAR_ACCESS_CONTROL_TAG_DATA STRING_ARG STRING_ARG STRING_ARG  */
+#line 1815 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_tag_data:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_datas,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4037,12 +4269,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4041 "util/configparser.c" /* yacc.c:1646  */
+#line 4273 "util/configparser.c"
     break;
 
-  case 325:
-#line 1606 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 370: /* server_local_zone_override: VAR_LOCAL_ZONE_OVERRIDE STRING_ARG STRING_ARG STRING_ARG  */
+#line 1827 "util/configparser.y"
+        {
 		OUTYY(("P(server_local_zone_override:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->local_zone_overrides,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4052,12 +4284,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4056 "util/configparser.c" /* yacc.c:1646  */
+#line 4288 "util/configparser.c"
     break;
 
-  case 326:
-#line 1618 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 371: /* server_access_control_view: VAR_ACCESS_CONTROL_VIEW STRING_ARG STRING_ARG  */
+#line 1839 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_view:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->acl_view,
 			(yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4066,12 +4298,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4070 "util/configparser.c" /* yacc.c:1646  */
+#line 4302 "util/configparser.c"
     break;
 
-  case 327:
-#line 1629 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 372: /* server_response_ip_tag: VAR_RESPONSE_IP_TAG STRING_ARG STRING_ARG  */
+#line 1850 "util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -4088,58 +4320,58 @@ yyreduce:
 			}
 		}
 	}
-#line 4092 "util/configparser.c" /* yacc.c:1646  */
+#line 4324 "util/configparser.c"
     break;
 
-  case 328:
-#line 1648 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 373: /* server_ip_ratelimit: VAR_IP_RATELIMIT STRING_ARG  */
+#line 1869 "util/configparser.y"
+        { 
 		OUTYY(("P(server_ip_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ip_ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4104 "util/configparser.c" /* yacc.c:1646  */
+#line 4336 "util/configparser.c"
     break;
 
-  case 329:
-#line 1658 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 374: /* server_ratelimit: VAR_RATELIMIT STRING_ARG  */
+#line 1879 "util/configparser.y"
+        { 
 		OUTYY(("P(server_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4116 "util/configparser.c" /* yacc.c:1646  */
+#line 4348 "util/configparser.c"
     break;
 
-  case 330:
-#line 1667 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 375: /* server_ip_ratelimit_size: VAR_IP_RATELIMIT_SIZE STRING_ARG  */
+#line 1888 "util/configparser.y"
+  {
   	OUTYY(("P(server_ip_ratelimit_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ip_ratelimit_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 4127 "util/configparser.c" /* yacc.c:1646  */
+#line 4359 "util/configparser.c"
     break;
 
-  case 331:
-#line 1675 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 376: /* server_ratelimit_size: VAR_RATELIMIT_SIZE STRING_ARG  */
+#line 1896 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ratelimit_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4138 "util/configparser.c" /* yacc.c:1646  */
+#line 4370 "util/configparser.c"
     break;
 
-  case 332:
-#line 1683 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 377: /* server_ip_ratelimit_slabs: VAR_IP_RATELIMIT_SLABS STRING_ARG  */
+#line 1904 "util/configparser.y"
+  {
   	OUTYY(("P(server_ip_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
   		yyerror("number expected");
@@ -4150,12 +4382,12 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 4154 "util/configparser.c" /* yacc.c:1646  */
+#line 4386 "util/configparser.c"
     break;
 
-  case 333:
-#line 1696 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 378: /* server_ratelimit_slabs: VAR_RATELIMIT_SLABS STRING_ARG  */
+#line 1917 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -4166,12 +4398,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4170 "util/configparser.c" /* yacc.c:1646  */
+#line 4402 "util/configparser.c"
     break;
 
-  case 334:
-#line 1709 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 379: /* server_ratelimit_for_domain: VAR_RATELIMIT_FOR_DOMAIN STRING_ARG STRING_ARG  */
+#line 1930 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_for_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
@@ -4182,12 +4414,12 @@ yyreduce:
 					"ratelimit-for-domain");
 		}
 	}
-#line 4186 "util/configparser.c" /* yacc.c:1646  */
+#line 4418 "util/configparser.c"
     break;
 
-  case 335:
-#line 1722 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 380: /* server_ratelimit_below_domain: VAR_RATELIMIT_BELOW_DOMAIN STRING_ARG STRING_ARG  */
+#line 1943 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_below_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
@@ -4198,36 +4430,36 @@ yyreduce:
 					"ratelimit-below-domain");
 		}
 	}
-#line 4202 "util/configparser.c" /* yacc.c:1646  */
+#line 4434 "util/configparser.c"
     break;
 
-  case 336:
-#line 1735 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 381: /* server_ip_ratelimit_factor: VAR_IP_RATELIMIT_FACTOR STRING_ARG  */
+#line 1956 "util/configparser.y"
+  { 
   	OUTYY(("P(server_ip_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
   	if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
   		yyerror("number expected");
   	else cfg_parser->cfg->ip_ratelimit_factor = atoi((yyvsp[0].str));
   	free((yyvsp[0].str));
 	}
-#line 4214 "util/configparser.c" /* yacc.c:1646  */
+#line 4446 "util/configparser.c"
     break;
 
-  case 337:
-#line 1744 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 382: /* server_ratelimit_factor: VAR_RATELIMIT_FACTOR STRING_ARG  */
+#line 1965 "util/configparser.y"
+        { 
 		OUTYY(("P(server_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ratelimit_factor = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4226 "util/configparser.c" /* yacc.c:1646  */
+#line 4458 "util/configparser.c"
     break;
 
-  case 338:
-#line 1753 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 383: /* server_qname_minimisation: VAR_QNAME_MINIMISATION STRING_ARG  */
+#line 1974 "util/configparser.y"
+        {
 		OUTYY(("P(server_qname_minimisation:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4235,12 +4467,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4239 "util/configparser.c" /* yacc.c:1646  */
+#line 4471 "util/configparser.c"
     break;
 
-  case 339:
-#line 1763 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 384: /* server_qname_minimisation_strict: VAR_QNAME_MINIMISATION_STRICT STRING_ARG  */
+#line 1984 "util/configparser.y"
+        {
 		OUTYY(("P(server_qname_minimisation_strict:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4248,12 +4480,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4252 "util/configparser.c" /* yacc.c:1646  */
+#line 4484 "util/configparser.c"
     break;
 
-  case 340:
-#line 1773 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 385: /* stub_name: VAR_NAME STRING_ARG  */
+#line 1994 "util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->stubs->name)
 			yyerror("stub name override, there must be one name "
@@ -4261,44 +4493,44 @@ yyreduce:
 		free(cfg_parser->cfg->stubs->name);
 		cfg_parser->cfg->stubs->name = (yyvsp[0].str);
 	}
-#line 4265 "util/configparser.c" /* yacc.c:1646  */
+#line 4497 "util/configparser.c"
     break;
 
-  case 341:
-#line 1783 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 386: /* stub_host: VAR_STUB_HOST STRING_ARG  */
+#line 2004 "util/configparser.y"
+        {
 		OUTYY(("P(stub-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4275 "util/configparser.c" /* yacc.c:1646  */
+#line 4507 "util/configparser.c"
     break;
 
-  case 342:
-#line 1790 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 387: /* stub_addr: VAR_STUB_ADDR STRING_ARG  */
+#line 2011 "util/configparser.y"
+        {
 		OUTYY(("P(stub-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4285 "util/configparser.c" /* yacc.c:1646  */
+#line 4517 "util/configparser.c"
     break;
 
-  case 343:
-#line 1797 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 388: /* stub_first: VAR_STUB_FIRST STRING_ARG  */
+#line 2018 "util/configparser.y"
+        {
 		OUTYY(("P(stub-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stubs->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4297 "util/configparser.c" /* yacc.c:1646  */
+#line 4529 "util/configparser.c"
     break;
 
-  case 344:
-#line 1806 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 389: /* stub_ssl_upstream: VAR_STUB_SSL_UPSTREAM STRING_ARG  */
+#line 2027 "util/configparser.y"
+        {
 		OUTYY(("P(stub-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4306,12 +4538,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4310 "util/configparser.c" /* yacc.c:1646  */
+#line 4542 "util/configparser.c"
     break;
 
-  case 345:
-#line 1816 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 390: /* stub_prime: VAR_STUB_PRIME STRING_ARG  */
+#line 2037 "util/configparser.y"
+        {
 		OUTYY(("P(stub-prime:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4319,12 +4551,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4323 "util/configparser.c" /* yacc.c:1646  */
+#line 4555 "util/configparser.c"
     break;
 
-  case 346:
-#line 1826 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 391: /* forward_name: VAR_NAME STRING_ARG  */
+#line 2047 "util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->forwards->name)
 			yyerror("forward name override, there must be one "
@@ -4332,44 +4564,44 @@ yyreduce:
 		free(cfg_parser->cfg->forwards->name);
 		cfg_parser->cfg->forwards->name = (yyvsp[0].str);
 	}
-#line 4336 "util/configparser.c" /* yacc.c:1646  */
+#line 4568 "util/configparser.c"
     break;
 
-  case 347:
-#line 1836 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 392: /* forward_host: VAR_FORWARD_HOST STRING_ARG  */
+#line 2057 "util/configparser.y"
+        {
 		OUTYY(("P(forward-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4346 "util/configparser.c" /* yacc.c:1646  */
+#line 4578 "util/configparser.c"
     break;
 
-  case 348:
-#line 1843 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 393: /* forward_addr: VAR_FORWARD_ADDR STRING_ARG  */
+#line 2064 "util/configparser.y"
+        {
 		OUTYY(("P(forward-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4356 "util/configparser.c" /* yacc.c:1646  */
+#line 4588 "util/configparser.c"
     break;
 
-  case 349:
-#line 1850 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 394: /* forward_first: VAR_FORWARD_FIRST STRING_ARG  */
+#line 2071 "util/configparser.y"
+        {
 		OUTYY(("P(forward-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->forwards->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4368 "util/configparser.c" /* yacc.c:1646  */
+#line 4600 "util/configparser.c"
     break;
 
-  case 350:
-#line 1859 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 395: /* forward_ssl_upstream: VAR_FORWARD_SSL_UPSTREAM STRING_ARG  */
+#line 2080 "util/configparser.y"
+        {
 		OUTYY(("P(forward-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4377,12 +4609,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4381 "util/configparser.c" /* yacc.c:1646  */
+#line 4613 "util/configparser.c"
     break;
 
-  case 351:
-#line 1869 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 396: /* view_name: VAR_NAME STRING_ARG  */
+#line 2090 "util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->views->name)
 			yyerror("view name override, there must be one "
@@ -4390,12 +4622,12 @@ yyreduce:
 		free(cfg_parser->cfg->views->name);
 		cfg_parser->cfg->views->name = (yyvsp[0].str);
 	}
-#line 4394 "util/configparser.c" /* yacc.c:1646  */
+#line 4626 "util/configparser.c"
     break;
 
-  case 352:
-#line 1879 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 397: /* view_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 2100 "util/configparser.y"
+        {
 		OUTYY(("P(view_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
 		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
@@ -4422,12 +4654,12 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 4426 "util/configparser.c" /* yacc.c:1646  */
+#line 4658 "util/configparser.c"
     break;
 
-  case 353:
-#line 1908 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 398: /* view_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 2129 "util/configparser.y"
+        {
 		OUTYY(("P(view_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
 		if(!cfg_str2list_insert(
@@ -4435,35 +4667,35 @@ yyreduce:
 			fatal_exit("out of memory adding per-view "
 				"response-ip action");
 	}
-#line 4439 "util/configparser.c" /* yacc.c:1646  */
+#line 4671 "util/configparser.c"
     break;
 
-  case 354:
-#line 1918 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 399: /* view_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 2139 "util/configparser.y"
+        {
 		OUTYY(("P(view_response_ip_data:%s)\n", (yyvsp[-1].str)));
 		if(!cfg_str2list_insert(
 			&cfg_parser->cfg->views->respip_data, (yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip-data");
 	}
-#line 4450 "util/configparser.c" /* yacc.c:1646  */
+#line 4682 "util/configparser.c"
     break;
 
-  case 355:
-#line 1926 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 400: /* view_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 2147 "util/configparser.y"
+        {
 		OUTYY(("P(view_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->views->local_data, (yyvsp[0].str))) {
 			fatal_exit("out of memory adding local-data");
 			free((yyvsp[0].str));
 		}
 	}
-#line 4462 "util/configparser.c" /* yacc.c:1646  */
+#line 4694 "util/configparser.c"
     break;
 
-  case 356:
-#line 1935 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 401: /* view_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 2156 "util/configparser.y"
+        {
 		char* ptr;
 		OUTYY(("P(view_local_data_ptr:%s)\n", (yyvsp[0].str)));
 		ptr = cfg_ptr_reverse((yyvsp[0].str));
@@ -4476,32 +4708,43 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 4480 "util/configparser.c" /* yacc.c:1646  */
+#line 4712 "util/configparser.c"
     break;
 
-  case 357:
-#line 1950 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 402: /* view_first: VAR_VIEW_FIRST STRING_ARG  */
+#line 2171 "util/configparser.y"
+        {
 		OUTYY(("P(view-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->views->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4492 "util/configparser.c" /* yacc.c:1646  */
+#line 4724 "util/configparser.c"
+    break;
+
+  case 403: /* view_cache_quota: VAR_VIEW_CACHE_QUOTA STRING_ARG  */
+#line 2180 "util/configparser.y"
+        {
+		OUTYY(("P(view-cache-quota:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->views->cache_quota))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 4735 "util/configparser.c"
     break;
 
-  case 358:
-#line 1959 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 404: /* rcstart: VAR_REMOTE_CONTROL  */
+#line 2188 "util/configparser.y"
+        { 
 		OUTYY(("\nP(remote-control:)\n")); 
 	}
-#line 4500 "util/configparser.c" /* yacc.c:1646  */
+#line 4743 "util/configparser.c"
     break;
 
-  case 369:
-#line 1970 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 415: /* rc_control_enable: VAR_CONTROL_ENABLE STRING_ARG  */
+#line 2199 "util/configparser.y"
+        {
 		OUTYY(("P(control_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4509,34 +4752,34 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4513 "util/configparser.c" /* yacc.c:1646  */
+#line 4756 "util/configparser.c"
     break;
 
-  case 370:
-#line 1980 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 416: /* rc_control_port: VAR_CONTROL_PORT STRING_ARG  */
+#line 2209 "util/configparser.y"
+        {
 		OUTYY(("P(control_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("control port number expected");
 		else cfg_parser->cfg->control_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4525 "util/configparser.c" /* yacc.c:1646  */
+#line 4768 "util/configparser.c"
     break;
 
-  case 371:
-#line 1989 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 417: /* rc_control_interface: VAR_CONTROL_INTERFACE STRING_ARG  */
+#line 2218 "util/configparser.y"
+        {
 		OUTYY(("P(control_interface:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->control_ifs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4535 "util/configparser.c" /* yacc.c:1646  */
+#line 4778 "util/configparser.c"
     break;
 
-  case 372:
-#line 1996 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 418: /* rc_control_use_cert: VAR_CONTROL_USE_CERT STRING_ARG  */
+#line 2225 "util/configparser.y"
+        {
 		OUTYY(("P(control_use_cert:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4544,213 +4787,213 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4548 "util/configparser.c" /* yacc.c:1646  */
+#line 4791 "util/configparser.c"
     break;
 
-  case 373:
-#line 2006 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 419: /* rc_server_key_file: VAR_SERVER_KEY_FILE STRING_ARG  */
+#line 2235 "util/configparser.y"
+        {
 		OUTYY(("P(rc_server_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_key_file);
 		cfg_parser->cfg->server_key_file = (yyvsp[0].str);
 	}
-#line 4558 "util/configparser.c" /* yacc.c:1646  */
+#line 4801 "util/configparser.c"
     break;
 
-  case 374:
-#line 2013 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 420: /* rc_server_cert_file: VAR_SERVER_CERT_FILE STRING_ARG  */
+#line 2242 "util/configparser.y"
+        {
 		OUTYY(("P(rc_server_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_cert_file);
 		cfg_parser->cfg->server_cert_file = (yyvsp[0].str);
 	}
-#line 4568 "util/configparser.c" /* yacc.c:1646  */
+#line 4811 "util/configparser.c"
     break;
 
-  case 375:
-#line 2020 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 421: /* rc_control_key_file: VAR_CONTROL_KEY_FILE STRING_ARG  */
+#line 2249 "util/configparser.y"
+        {
 		OUTYY(("P(rc_control_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_key_file);
 		cfg_parser->cfg->control_key_file = (yyvsp[0].str);
 	}
-#line 4578 "util/configparser.c" /* yacc.c:1646  */
+#line 4821 "util/configparser.c"
     break;
 
-  case 376:
-#line 2027 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 422: /* rc_control_cert_file: VAR_CONTROL_CERT_FILE STRING_ARG  */
+#line 2256 "util/configparser.y"
+        {
 		OUTYY(("P(rc_control_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_cert_file);
 		cfg_parser->cfg->control_cert_file = (yyvsp[0].str);
 	}
-#line 4588 "util/configparser.c" /* yacc.c:1646  */
+#line 4831 "util/configparser.c"
     break;
 
-  case 377:
-#line 2034 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 423: /* dtstart: VAR_DNSTAP  */
+#line 2263 "util/configparser.y"
+        {
 		OUTYY(("\nP(dnstap:)\n"));
 	}
-#line 4596 "util/configparser.c" /* yacc.c:1646  */
+#line 4839 "util/configparser.c"
     break;
 
-  case 392:
-#line 2051 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 438: /* dt_dnstap_enable: VAR_DNSTAP_ENABLE STRING_ARG  */
+#line 2280 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4607 "util/configparser.c" /* yacc.c:1646  */
+#line 4850 "util/configparser.c"
     break;
 
-  case 393:
-#line 2059 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 439: /* dt_dnstap_socket_path: VAR_DNSTAP_SOCKET_PATH STRING_ARG  */
+#line 2288 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_socket_path:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_socket_path);
 		cfg_parser->cfg->dnstap_socket_path = (yyvsp[0].str);
 	}
-#line 4617 "util/configparser.c" /* yacc.c:1646  */
+#line 4860 "util/configparser.c"
     break;
 
-  case 394:
-#line 2066 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 440: /* dt_dnstap_send_identity: VAR_DNSTAP_SEND_IDENTITY STRING_ARG  */
+#line 2295 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_send_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_send_identity = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4628 "util/configparser.c" /* yacc.c:1646  */
+#line 4871 "util/configparser.c"
     break;
 
-  case 395:
-#line 2074 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 441: /* dt_dnstap_send_version: VAR_DNSTAP_SEND_VERSION STRING_ARG  */
+#line 2303 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_send_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_send_version = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4639 "util/configparser.c" /* yacc.c:1646  */
+#line 4882 "util/configparser.c"
     break;
 
-  case 396:
-#line 2082 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 442: /* dt_dnstap_identity: VAR_DNSTAP_IDENTITY STRING_ARG  */
+#line 2311 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_identity);
 		cfg_parser->cfg->dnstap_identity = (yyvsp[0].str);
 	}
-#line 4649 "util/configparser.c" /* yacc.c:1646  */
+#line 4892 "util/configparser.c"
     break;
 
-  case 397:
-#line 2089 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 443: /* dt_dnstap_version: VAR_DNSTAP_VERSION STRING_ARG  */
+#line 2318 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_version);
 		cfg_parser->cfg->dnstap_version = (yyvsp[0].str);
 	}
-#line 4659 "util/configparser.c" /* yacc.c:1646  */
+#line 4902 "util/configparser.c"
     break;
 
-  case 398:
-#line 2096 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 444: /* dt_dnstap_log_resolver_query_messages: VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES STRING_ARG  */
+#line 2325 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_resolver_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_resolver_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4671 "util/configparser.c" /* yacc.c:1646  */
+#line 4914 "util/configparser.c"
     break;
 
-  case 399:
-#line 2105 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 445: /* dt_dnstap_log_resolver_response_messages: VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2334 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_resolver_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_resolver_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4683 "util/configparser.c" /* yacc.c:1646  */
+#line 4926 "util/configparser.c"
     break;
 
-  case 400:
-#line 2114 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 446: /* dt_dnstap_log_client_query_messages: VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES STRING_ARG  */
+#line 2343 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_client_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_client_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4695 "util/configparser.c" /* yacc.c:1646  */
+#line 4938 "util/configparser.c"
     break;
 
-  case 401:
-#line 2123 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 447: /* dt_dnstap_log_client_response_messages: VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES STRING_ARG  */
+#line 2352 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_client_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_client_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4707 "util/configparser.c" /* yacc.c:1646  */
+#line 4950 "util/configparser.c"
     break;
 
-  case 402:
-#line 2132 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 448: /* dt_dnstap_log_forwarder_query_messages: VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES STRING_ARG  */
+#line 2361 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_forwarder_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_forwarder_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4719 "util/configparser.c" /* yacc.c:1646  */
+#line 4962 "util/configparser.c"
     break;
 
-  case 403:
-#line 2141 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 449: /* dt_dnstap_log_forwarder_response_messages: VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2370 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_forwarder_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_forwarder_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4731 "util/configparser.c" /* yacc.c:1646  */
+#line 4974 "util/configparser.c"
     break;
 
-  case 404:
-#line 2150 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 450: /* pythonstart: VAR_PYTHON  */
+#line 2379 "util/configparser.y"
+        { 
 		OUTYY(("\nP(python:)\n")); 
 	}
-#line 4739 "util/configparser.c" /* yacc.c:1646  */
+#line 4982 "util/configparser.c"
     break;
 
-  case 408:
-#line 2159 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 454: /* py_script: VAR_PYTHON_SCRIPT STRING_ARG  */
+#line 2388 "util/configparser.y"
+        {
 		OUTYY(("P(python-script:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->python_script);
 		cfg_parser->cfg->python_script = (yyvsp[0].str);
 	}
-#line 4749 "util/configparser.c" /* yacc.c:1646  */
+#line 4992 "util/configparser.c"
     break;
 
-  case 409:
-#line 2165 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 455: /* server_disable_dnssec_lame_check: VAR_DISABLE_DNSSEC_LAME_CHECK STRING_ARG  */
+#line 2394 "util/configparser.y"
+        {
 		OUTYY(("P(disable_dnssec_lame_check:%s)\n", (yyvsp[0].str)));
 		if (strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4758,65 +5001,65 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4762 "util/configparser.c" /* yacc.c:1646  */
+#line 5005 "util/configparser.c"
     break;
 
-  case 410:
-#line 2175 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 456: /* server_log_identity: VAR_LOG_IDENTITY STRING_ARG  */
+#line 2404 "util/configparser.y"
+        {
 		OUTYY(("P(server_log_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->log_identity);
 		cfg_parser->cfg->log_identity = (yyvsp[0].str);
 	}
-#line 4772 "util/configparser.c" /* yacc.c:1646  */
+#line 5015 "util/configparser.c"
     break;
 
-  case 411:
-#line 2182 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 457: /* server_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 2411 "util/configparser.y"
+        {
 		OUTYY(("P(server_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->respip_actions,
 			(yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip");
 	}
-#line 4784 "util/configparser.c" /* yacc.c:1646  */
+#line 5027 "util/configparser.c"
     break;
 
-  case 412:
-#line 2191 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 458: /* server_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 2420 "util/configparser.y"
+        {
 		OUTYY(("P(server_response_ip_data:%s)\n", (yyvsp[-1].str)));
 			if(!cfg_str2list_insert(&cfg_parser->cfg->respip_data,
 				(yyvsp[-1].str), (yyvsp[0].str)))
 				fatal_exit("out of memory adding response-ip-data");
 	}
-#line 4795 "util/configparser.c" /* yacc.c:1646  */
+#line 5038 "util/configparser.c"
     break;
 
-  case 413:
-#line 2199 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 459: /* dnscstart: VAR_DNSCRYPT  */
+#line 2428 "util/configparser.y"
+        {
 		OUTYY(("\nP(dnscrypt:)\n"));
 		OUTYY(("\nP(dnscrypt:)\n"));
 	}
-#line 4804 "util/configparser.c" /* yacc.c:1646  */
+#line 5047 "util/configparser.c"
     break;
 
-  case 421:
-#line 2211 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 467: /* dnsc_dnscrypt_enable: VAR_DNSCRYPT_ENABLE STRING_ARG  */
+#line 2440 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnscrypt = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4815 "util/configparser.c" /* yacc.c:1646  */
+#line 5058 "util/configparser.c"
     break;
 
-  case 422:
-#line 2220 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 468: /* dnsc_dnscrypt_port: VAR_DNSCRYPT_PORT STRING_ARG  */
+#line 2449 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_port:%s)\n", (yyvsp[0].str)));
 
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4824,41 +5067,42 @@ yyreduce:
 		else cfg_parser->cfg->dnscrypt_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4828 "util/configparser.c" /* yacc.c:1646  */
+#line 5071 "util/configparser.c"
     break;
 
-  case 423:
-#line 2230 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 469: /* dnsc_dnscrypt_provider: VAR_DNSCRYPT_PROVIDER STRING_ARG  */
+#line 2459 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_provider:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnscrypt_provider);
 		cfg_parser->cfg->dnscrypt_provider = (yyvsp[0].str);
 	}
-#line 4838 "util/configparser.c" /* yacc.c:1646  */
+#line 5081 "util/configparser.c"
     break;
 
-  case 424:
-#line 2237 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 470: /* dnsc_dnscrypt_provider_cert: VAR_DNSCRYPT_PROVIDER_CERT STRING_ARG  */
+#line 2466 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_provider_cert:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_provider_cert, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-provider-cert");
 	}
-#line 4848 "util/configparser.c" /* yacc.c:1646  */
+#line 5091 "util/configparser.c"
     break;
 
-  case 425:
-#line 2244 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 471: /* dnsc_dnscrypt_secret_key: VAR_DNSCRYPT_SECRET_KEY STRING_ARG  */
+#line 2473 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_secret_key:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_secret_key, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-secret-key");
 	}
-#line 4858 "util/configparser.c" /* yacc.c:1646  */
+#line 5101 "util/configparser.c"
     break;
 
 
-#line 4862 "util/configparser.c" /* yacc.c:1646  */
+#line 5105 "util/configparser.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -4872,25 +5116,23 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -4901,50 +5143,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -4973,12 +5179,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -4995,13 +5200,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -5015,7 +5221,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -5027,7 +5233,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -5038,26 +5244,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -5073,20 +5283,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 2250 "./util/configparser.y" /* yacc.c:1906  */
+
+#line 2479 "util/configparser.y"
 
 
 /* parse helper routines could be here */
@@ -143,6 +143,16 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_USE_SYSTEMD VAR_SHM_ENABLE VAR_SHM_KEY
 %token VAR_DNSCRYPT VAR_DNSCRYPT_ENABLE VAR_DNSCRYPT_PORT VAR_DNSCRYPT_PROVIDER
 %token VAR_DNSCRYPT_SECRET_KEY VAR_DNSCRYPT_PROVIDER_CERT
+%token VAR_TCP_FASTOPEN_QUEUE VAR_TCP_UPSTREAM_FASTOPEN
+%token VAR_TCP_IDLE_TIMEOUT VAR_EDNS_TCP_KEEPALIVE
+%token VAR_EDNS_TCP_KEEPALIVE_TIMEOUT
+%token VAR_ANSWER_COOKIE VAR_COOKIE_SECRET VAR_UPSTREAM_COOKIE
+%token VAR_CACHE_PIN VAR_CACHE_PIN_SUFFIX VAR_CACHE_PIN_MAX_SIZE
+%token VAR_VIEW_CACHE_QUOTA
+%token VAR_CACHE_PEER VAR_CACHE_PEER_PORT VAR_CACHE_PEER_INTERFACE
+%token VAR_CACHE_PEER_RATE VAR_XDP_INTERFACE VAR_XDP_NATIVE
+%token VAR_CACHEDB_SECRET VAR_CACHEDB_COMPRESS VAR_CACHEDB_COMPRESS_MIN
+%token VAR_FORWARD_HEALTH_CHECK VAR_FORWARD_PROBE_INTERVAL
 
 %%
 toplevelvars: /* empty */ | toplevelvars toplevelvar ;
@@ -166,6 +176,14 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_do_ip6 | server_prefer_ip6 |
 	server_do_udp | server_do_tcp |
 	server_tcp_mss | server_outgoing_tcp_mss |
+	server_tcp_fastopen_queue | server_tcp_upstream_fastopen |
+	server_tcp_idle_timeout | server_edns_tcp_keepalive |
+	server_edns_tcp_keepalive_timeout | server_answer_cookie |
+	server_cookie_secret | server_upstream_cookie |
+	server_cache_pin | server_cache_pin_suffix |
+	server_cache_pin_max_size | server_cache_peer |
+	server_cache_peer_port | server_cache_peer_interface |
+	server_cache_peer_rate | server_xdp_interface | server_xdp_native |
 	server_interface | server_chroot | server_username | 
 	server_directory | server_logfile | server_pidfile |
 	server_msg_cache_size | server_msg_cache_slabs |
@@ -207,6 +225,9 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_so_reuseport | server_delay_close |
 	server_unblock_lan_zones | server_insecure_lan_zones |
 	server_dns64_prefix | server_dns64_synthall |
+	server_cachedb_secret | server_cachedb_compress |
+	server_cachedb_compress_min | server_forward_health_check |
+	server_forward_probe_interval |
 	server_infra_cache_min_rtt | server_harden_algo_downgrade |
 	server_ip_transparent | server_ip_ratelimit | server_ratelimit |
 	server_ip_ratelimit_slabs | server_ratelimit_slabs |
@@ -279,7 +300,8 @@ viewstart: VAR_VIEW
 contents_view: contents_view content_view 
 	| ;
 content_view: view_name | view_local_zone | view_local_data | view_first |
-		view_response_ip | view_response_ip_data | view_local_data_ptr
+		view_response_ip | view_response_ip_data | view_local_data_ptr |
+		view_cache_quota
 	;
 server_num_threads: VAR_NUM_THREADS STRING_ARG 
 	{ 
@@ -562,6 +584,86 @@ server_outgoing_tcp_mss: VAR_OUTGOING_TCP_MSS STRING_ARG
 		free($2);
 	}
 	;
+server_tcp_fastopen_queue: VAR_TCP_FASTOPEN_QUEUE STRING_ARG
+	{
+		OUTYY(("P(server_tcp_fastopen_queue:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_fastopen_queue = atoi($2);
+		free($2);
+	}
+	;
+server_tcp_upstream_fastopen: VAR_TCP_UPSTREAM_FASTOPEN STRING_ARG
+	{
+		OUTYY(("P(server_tcp_upstream_fastopen:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tcp_upstream_fastopen =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_tcp_idle_timeout: VAR_TCP_IDLE_TIMEOUT STRING_ARG
+	{
+		OUTYY(("P(server_tcp_idle_timeout:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_idle_timeout = atoi($2);
+		free($2);
+	}
+	;
+server_edns_tcp_keepalive: VAR_EDNS_TCP_KEEPALIVE STRING_ARG
+	{
+		OUTYY(("P(server_edns_tcp_keepalive:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->do_tcp_keepalive =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_edns_tcp_keepalive_timeout: VAR_EDNS_TCP_KEEPALIVE_TIMEOUT STRING_ARG
+	{
+		OUTYY(("P(server_edns_tcp_keepalive_timeout:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_keepalive_timeout = atoi($2);
+		free($2);
+	}
+	;
+server_answer_cookie: VAR_ANSWER_COOKIE STRING_ARG
+	{
+		OUTYY(("P(server_answer_cookie:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->do_answer_cookie =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_cookie_secret: VAR_COOKIE_SECRET STRING_ARG
+	{
+		OUTYY(("P(server_cookie_secret:%s)\n", $2));
+		if(strlen($2) != 32 ||
+			strspn($2, "0123456789abcdefABCDEF") != 32) {
+			yyerror("expected 32 hex digits for cookie-secret");
+			free($2);
+		} else {
+			free(cfg_parser->cfg->cookie_secret);
+			cfg_parser->cfg->cookie_secret = $2;
+		}
+	}
+	;
+server_upstream_cookie: VAR_UPSTREAM_COOKIE STRING_ARG
+	{
+		OUTYY(("P(server_upstream_cookie:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->upstream_cookie =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_tcp_upstream: VAR_TCP_UPSTREAM STRING_ARG
 	{
 		OUTYY(("P(server_tcp_upstream:%s)\n", $2));
@@ -976,6 +1078,77 @@ server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_cache_pin: VAR_CACHE_PIN STRING_ARG STRING_ARG
+	{
+		OUTYY(("P(server_cache_pin:%s %s)\n", $2, $3));
+		if(!cfg_str2list_insert(&cfg_parser->cfg->cache_pins, $2, $3))
+			fatal_exit("out of memory adding cache-pin");
+	}
+	;
+server_cache_pin_suffix: VAR_CACHE_PIN_SUFFIX STRING_ARG
+	{
+		OUTYY(("P(server_cache_pin_suffix:%s)\n", $2));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->cache_pin_suffixes,
+			$2))
+			fatal_exit("out of memory adding cache-pin-suffix");
+	}
+	;
+server_cache_pin_max_size: VAR_CACHE_PIN_MAX_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_cache_pin_max_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->cache_pin_max_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+server_cache_peer: VAR_CACHE_PEER STRING_ARG
+	{
+		OUTYY(("P(server_cache_peer:%s)\n", $2));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->cache_peers, $2))
+			fatal_exit("out of memory adding cache-peer");
+	}
+	;
+server_cache_peer_port: VAR_CACHE_PEER_PORT STRING_ARG
+	{
+		OUTYY(("P(server_cache_peer_port:%s)\n", $2));
+		if(atoi($2) <= 0 || atoi($2) > 65535)
+			yyerror("port number expected");
+		else cfg_parser->cfg->cache_peer_port = atoi($2);
+		free($2);
+	}
+	;
+server_cache_peer_interface: VAR_CACHE_PEER_INTERFACE STRING_ARG
+	{
+		OUTYY(("P(server_cache_peer_interface:%s)\n", $2));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->cache_peer_ifs, $2))
+			fatal_exit("out of memory adding cache-peer-interface");
+	}
+	;
+server_cache_peer_rate: VAR_CACHE_PEER_RATE STRING_ARG
+	{
+		OUTYY(("P(server_cache_peer_rate:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->cache_peer_rate = (size_t)atoi($2);
+		free($2);
+	}
+	;
+server_xdp_interface: VAR_XDP_INTERFACE STRING_ARG
+	{
+		OUTYY(("P(server_xdp_interface:%s)\n", $2));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->xdp_ifs, $2))
+			fatal_exit("out of memory adding xdp-interface");
+	}
+	;
+server_xdp_native: VAR_XDP_NATIVE STRING_ARG
+	{
+		OUTYY(("P(server_xdp_native:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->xdp_native = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG
 	{
 		OUTYY(("P(server_infra_host_ttl:%s)\n", $2));
@@ -1526,6 +1699,54 @@ server_dns64_synthall: VAR_DNS64_SYNTHALL STRING_ARG
 		free($2);
 	}
 	;
+server_cachedb_secret: VAR_CACHEDB_SECRET STRING_ARG
+	{
+		OUTYY(("P(server_cachedb_secret:%s)\n", $2));
+		free(cfg_parser->cfg->cachedb_secret);
+		cfg_parser->cfg->cachedb_secret = $2;
+	}
+	;
+server_cachedb_compress: VAR_CACHEDB_COMPRESS STRING_ARG
+	{
+		OUTYY(("P(server_cachedb_compress:%s)\n", $2));
+		if(strcmp($2, "none") != 0 && strcmp($2, "lz4") != 0 &&
+			strcmp($2, "zstd") != 0) {
+			yyerror("expected none, lz4 or zstd.");
+			free($2);
+		} else {
+			free(cfg_parser->cfg->cachedb_compress);
+			cfg_parser->cfg->cachedb_compress = $2;
+		}
+	}
+	;
+server_cachedb_compress_min: VAR_CACHEDB_COMPRESS_MIN STRING_ARG
+	{
+		OUTYY(("P(server_cachedb_compress_min:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->cachedb_compress_min = (size_t)atoi($2);
+		free($2);
+	}
+	;
+server_forward_health_check: VAR_FORWARD_HEALTH_CHECK STRING_ARG
+	{
+		OUTYY(("P(server_forward_health_check:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->fwd_health_check =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_forward_probe_interval: VAR_FORWARD_PROBE_INTERVAL STRING_ARG
+	{
+		OUTYY(("P(server_forward_probe_interval:%s)\n", $2));
+		if(atoi($2) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->fwd_probe_interval = atoi($2);
+		free($2);
+	}
+	;
 server_define_tag: VAR_DEFINE_TAG STRING_ARG
 	{
 		char* p, *s = $2;
@@ -1955,6 +2176,14 @@ view_first: VAR_VIEW_FIRST STRING_ARG
 		free($2);
 	}
 	;
+view_cache_quota: VAR_VIEW_CACHE_QUOTA STRING_ARG
+	{
+		OUTYY(("P(view-cache-quota:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->views->cache_quota))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
 rcstart: VAR_REMOTE_CONTROL
 	{ 
 		OUTYY(("\nP(remote-control:)\n")); 
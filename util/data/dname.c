@@ -44,7 +44,7 @@
 #include "util/data/dname.h"
 #include "util/data/msgparse.h"
 #include "util/log.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/siphash.h"
 #include "sldns/sbuffer.h"
 
 /* determine length of a dname in buffer, no compression pointers allowed */
@@ -273,55 +273,42 @@ dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 hashvalue_type
 dname_query_hash(uint8_t* dname, hashvalue_type h)
 {
-	uint8_t labuf[LDNS_MAX_LABELLEN+1];
-	uint8_t lablen;
-	int i;
-
-	/* preserve case of query, make hash label by label */
-	lablen = *dname++;
-	while(lablen) {
-		log_assert(lablen <= LDNS_MAX_LABELLEN);
-		labuf[0] = lablen;
-		i=0;
-		while(lablen--) {
-			labuf[++i] = (uint8_t)tolower((unsigned char)*dname);
-			dname++;
-		}
-		h = hashlittle(labuf, labuf[0] + 1, h);
-		lablen = *dname++;
+	uint8_t* p = dname;
+	/* the label lengths are not in the uppercase range, so the whole
+	 * name is hashed lowercased in one go */
+	while(*p) {
+		log_assert(*p <= LDNS_MAX_LABELLEN);
+		p += *p + 1;
 	}
-
-	return h;
+	return siphash_hash_lower(dname, (size_t)(p - dname) + 1, h);
 }
 
 hashvalue_type
 dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_type h)
 {
-	uint8_t labuf[LDNS_MAX_LABELLEN+1];
+	struct siphash_state s;
+	uint8_t* run = dname;
 	uint8_t lablen;
-	int i;
 
-	/* preserve case of query, make hash label by label */
-	lablen = *dname++;
+	/* hash the runs of labels between compression pointers, so that
+	 * the result is the same as dname_query_hash on the name */
+	siphash_init(&s, h);
+	lablen = *dname;
 	while(lablen) {
 		if(LABEL_IS_PTR(lablen)) {
+			siphash_update_lower(&s, run, (size_t)(dname - run));
 			/* follow pointer */
-			dname = sldns_buffer_at(pkt, PTR_OFFSET(lablen, *dname));
-			lablen = *dname++;
+			dname = sldns_buffer_at(pkt, PTR_OFFSET(lablen, dname[1]));
+			run = dname;
+			lablen = *dname;
 			continue;
 		}
 		log_assert(lablen <= LDNS_MAX_LABELLEN);
-		labuf[0] = lablen;
-		i=0;
-		while(lablen--) {
-			labuf[++i] = (uint8_t)tolower((unsigned char)*dname);
-			dname++;
-		}
-		h = hashlittle(labuf, labuf[0] + 1, h);
-		lablen = *dname++;
+		dname += lablen + 1;
+		lablen = *dname;
 	}
-
-	return h;
+	siphash_update_lower(&s, run, (size_t)(dname - run) + 1);
+	return siphash_final(&s);
 }
 
 void dname_pkt_copy(sldns_buffer* pkt, uint8_t* to, uint8_t* dname)
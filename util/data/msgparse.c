@@ -41,7 +41,7 @@
 #include "util/data/msgreply.h"
 #include "util/data/dname.h"
 #include "util/data/packed_rrset.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/siphash.h"
 #include "util/regional.h"
 #include "sldns/rrdef.h"
 #include "sldns/sbuffer.h"
@@ -166,11 +166,12 @@ pkt_hash_rrset(sldns_buffer* pkt, uint8_t* dname, uint16_t type,
 	/* note this MUST be identical to rrset_key_hash in packed_rrset.c */
 	/* this routine handles compressed names */
 	hashvalue_type h = 0xab;
+	uint8_t rest[8];
 	h = dname_pkt_hash(pkt, dname, h);
-	h = hashlittle(&type, sizeof(type), h);		/* host order */
-	h = hashlittle(&dclass, sizeof(dclass), h);	/* netw order */
-	h = hashlittle(&rrset_flags, sizeof(uint32_t), h);
-	return h;
+	memmove(rest, &type, sizeof(type));		/* host order */
+	memmove(rest+2, &dclass, sizeof(dclass));	/* netw order */
+	memmove(rest+4, &rrset_flags, sizeof(uint32_t));
+	return siphash_hash(rest, sizeof(rest), h);
 }
 
 /** create partial dname hash for rrset hash */
@@ -192,11 +193,11 @@ pkt_hash_rrset_rest(hashvalue_type dname_h, uint16_t type, uint16_t dclass,
 {
 	/* works together with pkt_hash_rrset_first */
 	/* note this MUST be identical to rrset_key_hash in packed_rrset.c */
-	hashvalue_type h;
-	h = hashlittle(&type, sizeof(type), dname_h);	/* host order */
-	h = hashlittle(&dclass, sizeof(dclass), h);	/* netw order */
-	h = hashlittle(&rrset_flags, sizeof(uint32_t), h);
-	return h;
+	uint8_t rest[8];
+	memmove(rest, &type, sizeof(type));		/* host order */
+	memmove(rest+2, &dclass, sizeof(dclass));	/* netw order */
+	memmove(rest+4, &rrset_flags, sizeof(uint32_t));
+	return siphash_hash(rest, sizeof(rest), dname_h);
 }
 
 /** compare rrset_parse with data */
@@ -959,6 +960,63 @@ parse_edns_options(uint8_t* rdata_ptr, size_t rdata_len,
 	return 1;
 }
 
+/** get an edns option element from the fixed store, or the region */
+static struct edns_option*
+edns_opt_store_get(struct edns_opt_store* store, struct regional* region,
+	uint16_t code, size_t len, uint8_t* data)
+{
+	struct edns_option* opt;
+	if(store->num < EDNS_OPT_STORE_NUM)
+		opt = &store->opt[store->num++];
+	else	opt = (struct edns_option*)regional_alloc(region,
+			sizeof(*opt));
+	if(!opt)
+		return NULL;
+	opt->next = NULL;
+	opt->opt_code = code;
+	opt->opt_len = len;
+	opt->opt_data = NULL;
+	if(len > 0) {
+		if(store->used + len <= EDNS_OPT_STORE_DATA) {
+			opt->opt_data = store->data + store->used;
+			memmove(opt->opt_data, data, len);
+			store->used += len;
+		} else if(!(opt->opt_data = regional_alloc_init(region, data,
+			len)))
+			return NULL;
+	}
+	return opt;
+}
+
+/** parse EDNS options from EDNS wireformat rdata into fixed storage,
+ * the list is built with a tail pointer, in one pass over the rdata */
+static int
+parse_edns_options_store(uint8_t* rdata_ptr, size_t rdata_len,
+	struct edns_data* edns, struct edns_opt_store* store,
+	struct regional* region)
+{
+	struct edns_option** prevp = &edns->opt_list;
+	store->num = 0;
+	store->used = 0;
+	while(rdata_len >= 4) {
+		uint16_t opt_code = sldns_read_uint16(rdata_ptr);
+		uint16_t opt_len = sldns_read_uint16(rdata_ptr+2);
+		rdata_ptr += 4;
+		rdata_len -= 4;
+		if(opt_len > rdata_len)
+			break; /* option code partial */
+		if(!(*prevp = edns_opt_store_get(store, region, opt_code,
+			opt_len, rdata_ptr))) {
+			log_err("out of memory");
+			return 0;
+		}
+		prevp = &(*prevp)->next;
+		rdata_ptr += opt_len;
+		rdata_len -= opt_len;
+	}
+	return 1;
+}
+
 int 
 parse_extract_edns(struct msg_parse* msg, struct edns_data* edns,
 	struct regional* region)
@@ -1031,6 +1089,13 @@ parse_extract_edns(struct msg_parse* msg, struct edns_data* edns,
 int 
 parse_edns_from_pkt(sldns_buffer* pkt, struct edns_data* edns,
 	struct regional* region)
+{
+	return parse_edns_from_query_pkt(pkt, edns, NULL, region);
+}
+
+int 
+parse_edns_from_query_pkt(sldns_buffer* pkt, struct edns_data* edns,
+	struct edns_opt_store* store, struct regional* region)
 {
 	size_t rdata_len;
 	uint8_t* rdata_ptr;
@@ -1065,7 +1130,11 @@ parse_edns_from_pkt(sldns_buffer* pkt, struct edns_data* edns,
 	if(sldns_buffer_remaining(pkt) < rdata_len)
 		return LDNS_RCODE_FORMERR;
 	rdata_ptr = sldns_buffer_current(pkt);
-	if(!parse_edns_options(rdata_ptr, rdata_len, edns, region))
+	if(store) {
+		if(!parse_edns_options_store(rdata_ptr, rdata_len, edns,
+			store, region))
+			return LDNS_RCODE_SERVFAIL;
+	} else if(!parse_edns_options(rdata_ptr, rdata_len, edns, region))
 		return LDNS_RCODE_SERVFAIL;
 
 	/* ignore rrsigs */
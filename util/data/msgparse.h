@@ -235,6 +235,28 @@ struct edns_option {
 	uint8_t* opt_data;
 };
 
+/** number of EDNS option elements in the fixed storage of a query parse */
+#define EDNS_OPT_STORE_NUM 8
+/** size of the EDNS option data area in the fixed storage of a query parse */
+#define EDNS_OPT_STORE_DATA 256
+
+/**
+ * Fixed size storage for the EDNS options of a query. It is allocated by
+ * the caller, on the stack, and the common query with a couple of small
+ * options is parsed without any allocation. Options that do not fit are
+ * allocated in the region.
+ */
+struct edns_opt_store {
+	/** option elements, linked into the edns opt_list */
+	struct edns_option opt[EDNS_OPT_STORE_NUM];
+	/** option contents */
+	uint8_t data[EDNS_OPT_STORE_DATA];
+	/** number of option elements in use */
+	size_t num;
+	/** number of bytes of the data area in use */
+	size_t used;
+};
+
 /**
  * Obtain size in the packet of an rr type, that is before dname type.
  * Do TYPE_DNAME, and type STR, yourself. Gives size for most regular types.
@@ -287,6 +309,24 @@ int parse_extract_edns(struct msg_parse* msg, struct edns_data* edns,
 int parse_edns_from_pkt(struct sldns_buffer* pkt, struct edns_data* edns,
 	struct regional* region);
 
+/**
+ * If EDNS data follows a query section, extract it and initialize edns struct.
+ * Like parse_edns_from_pkt, but the options are stored in the fixed
+ * storage when they fit.
+ * @param pkt: the packet. position at start must be right after the query
+ *	section. At end, right after EDNS data or no movement if failed.
+ * @param edns: the edns data allocated by the caller. Does not have to be
+ *	initialised.
+ * @param store: fixed storage for the edns options, allocated by the
+ *	caller, the opt_list points into it. If NULL, the region is used.
+ * @param region: region to alloc results in, for options that do not fit.
+ * @return: 0 on success, or an RCODE on error.
+ *	RCODE formerr if OPT is badly formatted and so on.
+ */
+int parse_edns_from_query_pkt(struct sldns_buffer* pkt,
+	struct edns_data* edns, struct edns_opt_store* store,
+	struct regional* region);
+
 /**
  * Calculate hash value for rrset in packet.
  * @param pkt: the packet.
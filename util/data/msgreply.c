@@ -40,14 +40,17 @@
  */
 
 #include "config.h"
+#include <ctype.h>
 #include "util/data/msgreply.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/siphash.h"
+#include "util/storage/slabhash.h"
 #include "util/log.h"
 #include "util/alloc.h"
 #include "util/netevent.h"
 #include "util/net_help.h"
 #include "util/data/dname.h"
 #include "util/regional.h"
+#include "util/edns.h"
 #include "util/data/msgparse.h"
 #include "util/data/msgencode.h"
 #include "sldns/sbuffer.h"
@@ -549,14 +552,60 @@ query_info_parse(struct query_info* m, sldns_buffer* query)
 	return 1;
 }
 
+int
+query_info_parse_edns(struct query_info* m, sldns_buffer* query,
+	struct edns_data* edns, int* edns_rcode, struct edns_opt_store* store,
+	struct regional* region, hashvalue_type* qname_hash)
+{
+	uint8_t* q = sldns_buffer_begin(query);
+	size_t len = 0;
+	uint8_t lablen;
+	/* minimum size: header + \0 + qtype + qclass */
+	if(sldns_buffer_limit(query) < LDNS_HEADER_SIZE + 5)
+		return 0;
+	if(LDNS_OPCODE_WIRE(q) != LDNS_PACKET_QUERY || 
+		LDNS_QDCOUNT(q) != 1 || sldns_buffer_position(query) != 0)
+		return 0;
+	sldns_buffer_skip(query, LDNS_HEADER_SIZE);
+	m->qname = sldns_buffer_current(query);
+	/* check the qname, as query_dname_len would do */
+	while(1) {
+		if(sldns_buffer_remaining(query) < 1)
+			return 0; /* parse error, need label len */
+		lablen = sldns_buffer_read_u8(query);
+		if(lablen&0xc0)
+			return 0; /* no compression allowed in queries */
+		len += (size_t)lablen + 1;
+		if(len > LDNS_MAX_DOMAINLEN)
+			return 0; /* too long */
+		if(lablen == 0)
+			break;
+		if(sldns_buffer_remaining(query) < lablen)
+			return 0; /* parse error, need content */
+		sldns_buffer_skip(query, (ssize_t)lablen);
+	}
+	m->qname_len = len;
+	if(sldns_buffer_remaining(query) < 4)
+		return 0; /* need qtype, qclass */
+	m->qtype = sldns_buffer_read_u16(query);
+	m->qclass = sldns_buffer_read_u16(query);
+	m->local_alias = NULL;
+	/* hash it lowercased in one go, as dname_query_hash would do */
+	*qname_hash = siphash_hash_lower(m->qname, len, 0xab);
+	/* continue at the position after the question with the EDNS */
+	*edns_rcode = parse_edns_from_query_pkt(query, edns, store, region);
+	return 1;
+}
+
 /** tiny subroutine for msgreply_compare */
 #define COMPARE_IT(x, y) \
 	if( (x) < (y) ) return -1; \
 	else if( (x) > (y) ) return +1; \
 	log_assert( (x) == (y) );
 
-int 
-query_info_compare(void* m1, void* m2)
+/** compare query info, inlined in the message cache lookup */
+static inline int
+query_info_cmp(void* m1, void* m2)
 {
 	struct query_info* msg1 = (struct query_info*)m1;
 	struct query_info* msg2 = (struct query_info*)m2;
@@ -571,6 +620,14 @@ query_info_compare(void* m1, void* m2)
 #undef COMPARE_IT
 }
 
+int 
+query_info_compare(void* m1, void* m2)
+{
+	return query_info_cmp(m1, m2);
+}
+
+SLABHASH_LOOKUP_FUNC(msgreply_lookup, query_info_compare, query_info_cmp)
+
 void 
 query_info_clear(struct query_info* m)
 {
@@ -610,13 +667,20 @@ reply_info_delete(void* d, void* ATTR_UNUSED(arg))
 hashvalue_type
 query_info_hash(struct query_info *q, uint16_t flags)
 {
-	hashvalue_type h = 0xab;
-	h = hashlittle(&q->qtype, sizeof(q->qtype), h);
+	return query_info_hash_qname(q, flags, dname_query_hash(q->qname,
+		0xab));
+}
+
+hashvalue_type
+query_info_hash_qname(struct query_info *q, uint16_t flags,
+	hashvalue_type qname_hash)
+{
+	uint16_t rest[2];
+	rest[0] = q->qtype;
+	rest[1] = q->qclass;
 	if(q->qtype == LDNS_RR_TYPE_AAAA && (flags&BIT_CD))
-		h++;
-	h = hashlittle(&q->qclass, sizeof(q->qclass), h);
-	h = dname_query_hash(q->qname, h);
-	return h;
+		qname_hash++;
+	return siphash_hash(rest, sizeof(rest), qname_hash);
 }
 
 struct msgreply_entry* 
@@ -982,6 +1046,31 @@ int edns_opt_list_remove(struct edns_option** list, uint16_t code)
 	return 1;
 }
 
+/**
+ * Copy an option of the query, that the server filled in, to the reply
+ * options.  It is put in front of the list, because the qstate's list
+ * may be shared by replies.
+ * @param in: options of the query.
+ * @param out: options of the reply.
+ * @param code: the option code.
+ * @param len: the length of the option, when it is filled in.
+ * @param region: to allocate the copy.
+ */
+static void
+edns_opt_echo(struct edns_option* in, struct edns_option** out,
+	uint16_t code, size_t len, struct regional* region)
+{
+	struct edns_option* opt = edns_opt_list_find(in, code);
+	if(!opt || opt->opt_len != len || edns_opt_list_find(*out, code))
+		return;
+	if(!(opt = regional_alloc_init(region, opt, sizeof(*opt))))
+		return;
+	if(!(opt->opt_data = regional_alloc_init(region, opt->opt_data, len)))
+		return;
+	opt->next = *out;
+	*out = opt;
+}
+
 static int inplace_cb_reply_call_generic(
     struct inplace_cb_reply* callback_list, enum inplace_cb_list_type type,
 	struct query_info* qinfo, struct module_qstate* qstate,
@@ -997,6 +1086,12 @@ static int inplace_cb_reply_call_generic(
 		(void)(*cb->cb)(qinfo, qstate, rep, rcode, edns, &opt_list_out, region,
 			cb->cb_arg);
 	}
+	/* echo the edns-tcp-keepalive timeout and the cookie that the
+	 * worker filled in */
+	edns_opt_echo(edns->opt_list, &opt_list_out, LDNS_EDNS_KEEPALIVE,
+		sizeof(uint16_t), region);
+	edns_opt_echo(edns->opt_list, &opt_list_out, LDNS_EDNS_COOKIE,
+		EDNS_COOKIE_SIZE, region);
 	edns->opt_list = opt_list_out;
 	return 1;
 }
@@ -44,12 +44,14 @@
 #include "util/storage/lruhash.h"
 #include "util/data/packed_rrset.h"
 struct sldns_buffer;
+struct slabhash;
 struct comm_reply;
 struct alloc_cache;
 struct iovec;
 struct regional;
 struct edns_data;
 struct edns_option;
+struct edns_opt_store;
 struct inplace_cb_reply;
 struct inplace_cb_query;
 struct inplace_cb_edns_back_parsed;
@@ -248,6 +250,28 @@ construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
  */
 int query_info_parse(struct query_info* m, struct sldns_buffer* query);
 
+/**
+ * Parse a wire query in a single pass over the packet: the question
+ * section, the hash of the lowercased qname, and the EDNS OPT record with
+ * its options. The result is the same as query_info_parse followed by
+ * parse_edns_from_pkt, and the qname hash is that of dname_query_hash.
+ * The header counts of the packet must have been checked as required by
+ * parse_edns_from_pkt.
+ * @param m: the prealloced queryinfo structure to put query into.
+ *    must be unused, or _clear()ed. The qname points into the buffer.
+ * @param query: the wireformat packet query. starts with ID.
+ * @param edns: the edns data is returned here, if the question is OK.
+ * @param edns_rcode: the result of the EDNS parse is returned here, if
+ *    the question is OK: 0 on success, or an RCODE on error.
+ * @param store: fixed storage, from the caller, for the edns options.
+ * @param region: region to alloc edns options that do not fit the store.
+ * @param qname_hash: the hash of the qname, for query_info_hash_qname.
+ * @return: 0 on format error in the question.
+ */
+int query_info_parse_edns(struct query_info* m, struct sldns_buffer* query,
+	struct edns_data* edns, int* edns_rcode, struct edns_opt_store* store,
+	struct regional* region, hashvalue_type* qname_hash);
+
 /**
  * Parse query reply.
  * Fills in preallocated query_info structure (with ptr into buffer).
@@ -317,6 +341,18 @@ void reply_info_parsedelete(struct reply_info* rep, struct alloc_cache* alloc);
  */
 int query_info_compare(void* m1, void* m2);
 
+/**
+ * Lookup an entry in the message cache, like slabhash_lookup, with the
+ * compare function inlined.
+ * @param table: the message cache hashtable.
+ * @param hash: hash of key.
+ * @param key: what to look for.
+ * @param wr: set to true if you desire a writelock on the entry.
+ * @return: pointer to the entry or NULL. The entry is locked.
+ */
+struct lruhash_entry* msgreply_lookup(struct slabhash* table, hashvalue_type hash,
+	void* key, int wr);
+
 /** clear out query info structure */
 void query_info_clear(struct query_info* m);
 
@@ -333,6 +369,11 @@ void reply_info_delete(void* d, void* arg);
  * uses CD flag for AAAA qtype */
 hashvalue_type query_info_hash(struct query_info *q, uint16_t flags);
 
+/** calculate hash value of query_info, from the hash of the qname that
+ * is made by dname_query_hash(qname, 0xab), uses CD flag for AAAA qtype */
+hashvalue_type query_info_hash_qname(struct query_info *q, uint16_t flags,
+	hashvalue_type qname_hash);
+
 /**
  * Setup query info entry
  * @param q: query info to copy. Emptied as if clear is called.
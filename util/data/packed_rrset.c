@@ -42,7 +42,8 @@
 #include "config.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/siphash.h"
+#include "util/storage/slabhash.h"
 #include "util/log.h"
 #include "util/alloc.h"
 #include "util/regional.h"
@@ -90,8 +91,9 @@ packed_rrset_sizeof(struct packed_rrset_data* d)
 	return s;
 }
 
-int 
-ub_rrset_compare(void* k1, void* k2)
+/** compare rrset keys, inlined in the rrset cache lookup */
+static inline int
+rrset_key_cmp(void* k1, void* k2)
 {
 	struct ub_packed_rrset_key* key1 = (struct ub_packed_rrset_key*)k1;
 	struct ub_packed_rrset_key* key2 = (struct ub_packed_rrset_key*)k2;
@@ -108,7 +110,10 @@ ub_rrset_compare(void* k1, void* k2)
 			return -1;
 		return 1;
 	}
-	if((c=query_dname_compare(key1->rk.dname, key2->rk.dname)) != 0)
+	/* the rrset cache interns owner names, cached rrsets with the
+	 * same owner name have the same name pointer */
+	if(key1->rk.dname != key2->rk.dname &&
+		(c=query_dname_compare(key1->rk.dname, key2->rk.dname)) != 0)
 		return c;
 	if(key1->rk.rrset_class != key2->rk.rrset_class) {
 		if(key1->rk.rrset_class < key2->rk.rrset_class)
@@ -123,6 +128,14 @@ ub_rrset_compare(void* k1, void* k2)
 	return 0;
 }
 
+int 
+ub_rrset_compare(void* k1, void* k2)
+{
+	return rrset_key_cmp(k1, k2);
+}
+
+SLABHASH_LOOKUP_FUNC(ub_rrset_lookup, ub_rrset_compare, rrset_key_cmp)
+
 void 
 ub_rrset_key_delete(void* key, void* userdata)
 {
@@ -166,11 +179,12 @@ rrset_key_hash(struct packed_rrset_key* key)
 	/* Note this MUST be identical to pkt_hash_rrset in msgparse.c */
 	/* this routine does not have a compressed name */
 	hashvalue_type h = 0xab;
+	uint8_t rest[8];
 	h = dname_query_hash(key->dname, h);
-	h = hashlittle(&t, sizeof(t), h);
-	h = hashlittle(&key->rrset_class, sizeof(uint16_t), h);
-	h = hashlittle(&key->flags, sizeof(uint32_t), h);
-	return h;
+	memmove(rest, &t, sizeof(t));
+	memmove(rest+2, &key->rrset_class, sizeof(uint16_t));
+	memmove(rest+4, &key->flags, sizeof(uint32_t));
+	return siphash_hash(rest, sizeof(rest), h);
 }
 
 void 
@@ -43,6 +43,7 @@
 #define UTIL_DATA_PACKED_RRSET_H
 #include "util/storage/lruhash.h"
 struct alloc_cache;
+struct slabhash;
 struct regional;
 
 /** type used to uniquely identify rrsets. Cannot be reused without
@@ -315,6 +316,18 @@ size_t ub_rrset_sizefunc(void* key, void* data);
  */
 int ub_rrset_compare(void* k1, void* k2);
 
+/**
+ * Lookup an entry in the rrset cache, like slabhash_lookup, with the
+ * compare function inlined.
+ * @param table: the rrset cache hashtable.
+ * @param hash: hash of key.
+ * @param key: what to look for.
+ * @param wr: set to true if you desire a writelock on the entry.
+ * @return: pointer to the entry or NULL. The entry is locked.
+ */
+struct lruhash_entry* ub_rrset_lookup(struct slabhash* table, hashvalue_type hash,
+	void* key, int wr);
+
 /**
  * compare two rrset data structures.
  * Compared rdata and rrsigdata, not the trust or ttl value.
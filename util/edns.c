@@ -0,0 +1,203 @@
+/*
+ * util/edns.c - EDNS options that the server handles itself.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the DNS Cookies, the server cookies are made and
+ * checked without state.
+ */
+
+#include "config.h"
+#include "util/edns.h"
+#include "util/data/msgparse.h"
+#include "util/data/dname.h"
+#include "util/net_help.h"
+#include "util/storage/siphash.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
+
+/** version of the server cookie format, RFC 9018 */
+#define EDNS_COOKIE_VERSION 1
+
+/** the bytes of the address, for hashing */
+static const uint8_t*
+cookie_addr(struct sockaddr_storage* addr, socklen_t addrlen, size_t* len)
+{
+	if(addr_is_ip6(addr, addrlen)) {
+		*len = 16;
+		return (const uint8_t*)&((struct sockaddr_in6*)addr)->sin6_addr;
+	}
+	*len = 4;
+	return (const uint8_t*)&((struct sockaddr_in*)addr)->sin_addr;
+}
+
+/** hash of the server cookie: the client cookie, version, reserved,
+ * timestamp, and the client address */
+static uint64_t
+cookie_server_hash(const uint8_t* cookie, const uint8_t* secret,
+	struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	uint8_t in[16+16];
+	size_t alen;
+	const uint8_t* a = cookie_addr(addr, addrlen, &alen);
+	memcpy(in, cookie, 16);
+	memcpy(in+16, a, alen);
+	return siphash24(secret, in, 16+alen);
+}
+
+/** write 64 bits in the byte order of the reference siphash output */
+static void
+cookie_write_u64(uint8_t* buf, uint64_t v)
+{
+	int i;
+	for(i=0; i<8; i++)
+		buf[i] = (uint8_t)(v >> (8*i));
+}
+
+enum edns_cookie_state
+edns_cookie_server_check(struct edns_option* opt, const uint8_t* secret,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint32_t now,
+	int* reuse)
+{
+	uint8_t hash[8];
+	uint32_t ts, age;
+	*reuse = 0;
+	if(!opt)
+		return cookie_none;
+	if(opt->opt_len == EDNS_COOKIE_CLIENT_SIZE)
+		return cookie_client;
+	if(opt->opt_len < EDNS_COOKIE_CLIENT_SIZE+8 ||
+		opt->opt_len > EDNS_COOKIE_CLIENT_SIZE+EDNS_COOKIE_SERVER_MAX)
+		return cookie_malformed;
+	if(opt->opt_len != EDNS_COOKIE_SIZE ||
+		opt->opt_data[8] != EDNS_COOKIE_VERSION)
+		return cookie_invalid;
+	/* the timestamp is serial number arithmetic, it may be a little
+	 * bit in the future, from another server with the same secret */
+	ts = sldns_read_uint32(opt->opt_data+12);
+	age = now - ts;
+	if(age > EDNS_COOKIE_LIFETIME && ts - now > EDNS_COOKIE_SKEW)
+		return cookie_invalid;
+	cookie_write_u64(hash, cookie_server_hash(opt->opt_data, secret,
+		addr, addrlen));
+	if(memcmp(hash, opt->opt_data+16, sizeof(hash)) != 0)
+		return cookie_invalid;
+	*reuse = (age < EDNS_COOKIE_REUSE);
+	return cookie_valid;
+}
+
+void
+edns_cookie_server_write(uint8_t* buf, const uint8_t* client,
+	const uint8_t* secret, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint32_t now)
+{
+	memmove(buf, client, EDNS_COOKIE_CLIENT_SIZE);
+	buf[8] = EDNS_COOKIE_VERSION;
+	buf[9] = 0;
+	buf[10] = 0;
+	buf[11] = 0;
+	sldns_write_uint32(buf+12, now);
+	cookie_write_u64(buf+16, cookie_server_hash(buf, secret, addr,
+		addrlen));
+}
+
+void
+edns_cookie_client_write(uint8_t* buf, const uint8_t* secret,
+	struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	uint8_t in[1+16];
+	size_t alen;
+	const uint8_t* a = cookie_addr(addr, addrlen, &alen);
+	/* a prefix, so it is never the same as the server cookie input */
+	in[0] = 'c';
+	memcpy(in+1, a, alen);
+	cookie_write_u64(buf, siphash24(secret, in, 1+alen));
+}
+
+/** skip over the rest of a resource record after the owner name */
+static int
+cookie_skip_rr_rest(sldns_buffer* pkt)
+{
+	size_t rdlen;
+	if(sldns_buffer_remaining(pkt) < 10)
+		return 0;
+	sldns_buffer_skip(pkt, 8);
+	rdlen = sldns_buffer_read_u16(pkt);
+	if(sldns_buffer_remaining(pkt) < rdlen)
+		return 0;
+	sldns_buffer_skip(pkt, (ssize_t)rdlen);
+	return 1;
+}
+
+/** skip over resource records in the packet, false if malformed */
+static int
+cookie_skip_rrs(sldns_buffer* pkt, size_t num)
+{
+	size_t i;
+	for(i=0; i<num; i++) {
+		if(!pkt_dname_len(pkt) || !cookie_skip_rr_rest(pkt))
+			return 0;
+	}
+	return 1;
+}
+
+/** find the cookie in the packet, from the current position */
+static uint8_t*
+cookie_find(sldns_buffer* pkt, size_t* len)
+{
+	size_t i, ar, rdlen, optlen;
+	uint16_t code;
+	if(sldns_buffer_limit(pkt) < LDNS_HEADER_SIZE)
+		return NULL;
+	sldns_buffer_set_position(pkt, LDNS_HEADER_SIZE);
+	for(i=0; i<LDNS_QDCOUNT(sldns_buffer_begin(pkt)); i++) {
+		if(!pkt_dname_len(pkt) || sldns_buffer_remaining(pkt) < 4)
+			return NULL;
+		sldns_buffer_skip(pkt, 4);
+	}
+	if(!cookie_skip_rrs(pkt, (size_t)LDNS_ANCOUNT(sldns_buffer_begin(
+		pkt)) + (size_t)LDNS_NSCOUNT(sldns_buffer_begin(pkt))))
+		return NULL;
+	ar = (size_t)LDNS_ARCOUNT(sldns_buffer_begin(pkt));
+	for(i=0; i<ar; i++) {
+		if(!pkt_dname_len(pkt) || sldns_buffer_remaining(pkt) < 10)
+			return NULL;
+		if(sldns_buffer_read_u16_at(pkt, sldns_buffer_position(pkt))
+			!= LDNS_RR_TYPE_OPT) {
+			if(!cookie_skip_rr_rest(pkt))
+				return NULL;
+			continue;
+		}
+		sldns_buffer_skip(pkt, 8);
+		rdlen = sldns_buffer_read_u16(pkt);
+		if(sldns_buffer_remaining(pkt) < rdlen)
+			return NULL;
+		while(rdlen >= 4) {
+			code = sldns_buffer_read_u16(pkt);
+			optlen = sldns_buffer_read_u16(pkt);
+			rdlen -= 4;
+			if(optlen > rdlen)
+				return NULL;
+			if(code == LDNS_EDNS_COOKIE) {
+				*len = optlen;
+				return sldns_buffer_current(pkt);
+			}
+			sldns_buffer_skip(pkt, (ssize_t)optlen);
+			rdlen -= optlen;
+		}
+		return NULL;
+	}
+	return NULL;
+}
+
+uint8_t*
+edns_cookie_find(sldns_buffer* pkt, size_t* len)
+{
+	size_t pos = sldns_buffer_position(pkt);
+	uint8_t* cookie = cookie_find(pkt, len);
+	sldns_buffer_set_position(pkt, pos);
+	return cookie;
+}
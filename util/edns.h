@@ -0,0 +1,97 @@
+/*
+ * util/edns.h - EDNS options that the server handles itself.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the DNS Cookies (RFC 7873).  The server cookies
+ * are made and checked without state, in the format of RFC 9018, with
+ * SipHash-2-4 over the client cookie, a timestamp and the client address.
+ * The client cookies for upstream queries are a hash of the server
+ * address.
+ */
+
+#ifndef UTIL_EDNS_H
+#define UTIL_EDNS_H
+struct edns_option;
+struct sldns_buffer;
+
+/** size of the cookie secret in bytes */
+#define EDNS_COOKIE_SECRET_SIZE 16
+/** size of a client cookie */
+#define EDNS_COOKIE_CLIENT_SIZE 8
+/** size of the client and server cookie in our replies */
+#define EDNS_COOKIE_SIZE 24
+/** max size of the server cookie */
+#define EDNS_COOKIE_SERVER_MAX 32
+/** server cookies are valid for this many seconds */
+#define EDNS_COOKIE_LIFETIME 3600
+/** server cookies younger than this are reused in the reply */
+#define EDNS_COOKIE_REUSE 1800
+/** server cookies made this many seconds in the future are accepted */
+#define EDNS_COOKIE_SKEW 300
+
+/** what the cookie of a query is */
+enum edns_cookie_state {
+	/** no cookie option */
+	cookie_none = 0,
+	/** only a client cookie */
+	cookie_client,
+	/** a recent server cookie that we made for this client */
+	cookie_valid,
+	/** a server cookie that fails the check, like a client cookie */
+	cookie_invalid,
+	/** the option has a bad length, FORMERR */
+	cookie_malformed
+};
+
+/**
+ * Check the cookie option of a query.
+ * @param opt: the cookie option, or NULL.
+ * @param secret: the EDNS_COOKIE_SECRET_SIZE server secret.
+ * @param addr: address of the client.
+ * @param addrlen: length of addr.
+ * @param now: the time now.
+ * @param reuse: set true if the cookie is valid and can be sent back as
+ *	it is, because it is recent.
+ * @return the state of the cookie.
+ */
+enum edns_cookie_state edns_cookie_server_check(struct edns_option* opt,
+	const uint8_t* secret, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint32_t now, int* reuse);
+
+/**
+ * Make the client and server cookie for the reply.
+ * @param buf: EDNS_COOKIE_SIZE bytes for the result.
+ * @param client: the EDNS_COOKIE_CLIENT_SIZE client cookie.
+ * @param secret: the server secret.
+ * @param addr: address of the client.
+ * @param addrlen: length of addr.
+ * @param now: the time now.
+ */
+void edns_cookie_server_write(uint8_t* buf, const uint8_t* client,
+	const uint8_t* secret, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint32_t now);
+
+/**
+ * Make the client cookie for queries to a server.
+ * @param buf: EDNS_COOKIE_CLIENT_SIZE bytes for the result.
+ * @param secret: the secret.
+ * @param addr: address of the server.
+ * @param addrlen: length of addr.
+ */
+void edns_cookie_client_write(uint8_t* buf, const uint8_t* secret,
+	struct sockaddr_storage* addr, socklen_t addrlen);
+
+/**
+ * Find the cookie option in a reply packet, without a parse of the
+ * message.  The buffer position is not changed.
+ * @param pkt: the packet.
+ * @param len: set to the length of the option data.
+ * @return pointer to the option data in the packet, or NULL if there is
+ *	no cookie option, or the packet is malformed.
+ */
+uint8_t* edns_cookie_find(struct sldns_buffer* pkt, size_t* len);
+
+#endif /* UTIL_EDNS_H */
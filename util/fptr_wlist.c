@@ -51,6 +51,9 @@
 #include "services/localzone.h"
 #include "services/cache/infra.h"
 #include "services/cache/rrset.h"
+#include "services/cache/pin.h"
+#include "services/cache/peer.h"
+#include "services/fwd_health.h"
 #include "services/view.h"
 #include "dns64/dns64.h"
 #include "iterator/iterator.h"
@@ -94,6 +97,8 @@ fptr_whitelist_comm_point(comm_point_callback_type *fptr)
 	else if(fptr == &outnet_udp_cb) return 1;
 	else if(fptr == &outnet_tcp_cb) return 1;
 	else if(fptr == &tube_handle_listen) return 1;
+	else if(fptr == &cache_peer_send_cb) return 1;
+	else if(fptr == &cache_peer_recv_cb) return 1;
 	return 0;
 }
 
@@ -115,6 +120,9 @@ fptr_whitelist_comm_timer(void (*fptr)(void*))
 	else if(fptr == &pending_udp_timer_delay_cb) return 1;
 	else if(fptr == &worker_stat_timer_cb) return 1;
 	else if(fptr == &worker_probe_timer_cb) return 1;
+	else if(fptr == &worker_cache_pin_timer_cb) return 1;
+	else if(fptr == &cache_peers_timer_cb) return 1;
+	else if(fptr == &fwd_health_timer_cb) return 1;
 #ifdef UB_ON_WINDOWS
 	else if(fptr == &wsvc_cron_cb) return 1;
 #endif
@@ -145,6 +153,7 @@ fptr_whitelist_event(void (*fptr)(int, short, void *))
 {
 	if(fptr == &comm_point_udp_callback) return 1;
 	else if(fptr == &comm_point_udp_ancil_callback) return 1;
+	else if(fptr == &comm_point_xdp_callback) return 1;
 	else if(fptr == &comm_point_tcp_accept_callback) return 1;
 	else if(fptr == &comm_point_tcp_handle_callback) return 1;
 	else if(fptr == &comm_timer_callback) return 1;
@@ -182,6 +191,7 @@ fptr_whitelist_serviced_query(comm_point_callback_type *fptr)
 {
 	if(fptr == &worker_handle_service_reply) return 1;
 	else if(fptr == &libworker_handle_service_reply) return 1;
+	else if(fptr == &fwd_health_probe_cb) return 1;
 	return 0;
 }
 
@@ -246,6 +256,7 @@ fptr_whitelist_hash_delkeyfunc(lruhash_delkeyfunc_type fptr)
 {
 	if(fptr == &query_entry_delete) return 1;
 	else if(fptr == &ub_rrset_key_delete) return 1;
+	else if(fptr == &rrset_cache_key_delete) return 1;
 	else if(fptr == &infra_delkeyfunc) return 1;
 	else if(fptr == &key_entry_delkeyfunc) return 1;
 	else if(fptr == &rate_delkeyfunc) return 1;
@@ -277,6 +288,16 @@ fptr_whitelist_hash_markdelfunc(lruhash_markdelfunc_type fptr)
 	return 0;
 }
 
+int 
+fptr_whitelist_hash_pinfunc(lruhash_pinfunc_type fptr)
+{
+	if(fptr == NULL) return 1;
+	else if(fptr == &cache_pins_rrset_pinfunc) return 1;
+	else if(fptr == &cache_pins_msg_pinfunc) return 1;
+	else if(fptr == &test_slabhash_pinfunc) return 1;
+	return 0;
+}
+
 /** whitelist env->send_query callbacks */
 int 
 fptr_whitelist_modenv_send_query(struct outbound_entry* (*fptr)(
@@ -203,6 +203,14 @@ int fptr_whitelist_hash_deldatafunc(lruhash_deldatafunc_type fptr);
  */
 int fptr_whitelist_hash_markdelfunc(lruhash_markdelfunc_type fptr);
 
+/**
+ * Check function pointer whitelist for lruhash pin callback values.
+ *
+ * @param fptr: function pointer to check.
+ * @return false if not in whitelist.
+ */
+int fptr_whitelist_hash_pinfunc(lruhash_pinfunc_type fptr);
+
 /**
  * Check function pointer whitelist for module_env send_query callback values.
  *
@@ -197,6 +197,12 @@ void lock_basic_unlock(lock_basic_type* lock)
 	(void)InterlockedExchange(lock, 0);
 }
 
+int lock_basic_trylock(lock_basic_type* lock)
+{
+	/* if the old value was 0, we inserted 1 and locked it */
+	return InterlockedExchange(lock, 1) == 0;
+}
+
 void ub_thread_key_create(ub_thread_key_type* key, void* f)
 {
 	*key = TlsAlloc();
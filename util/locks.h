@@ -101,6 +101,8 @@ typedef pthread_mutex_t lock_basic_type;
 #define lock_basic_destroy(lock) LOCKRET(pthread_mutex_destroy(lock))
 #define lock_basic_lock(lock) LOCKRET(pthread_mutex_lock(lock))
 #define lock_basic_unlock(lock) LOCKRET(pthread_mutex_unlock(lock))
+/** try to lock, true if it is locked now, false if it was busy */
+#define lock_basic_trylock(lock) (pthread_mutex_trylock(lock) == 0)
 
 #ifndef HAVE_PTHREAD_RWLOCK_T
 /** in case rwlocks are not supported, use a mutex. */
@@ -197,6 +199,7 @@ typedef mutex_t lock_basic_type;
 #define lock_basic_destroy(lock) LOCKRET(mutex_destroy(lock))
 #define lock_basic_lock(lock) LOCKRET(mutex_lock(lock))
 #define lock_basic_unlock(lock) LOCKRET(mutex_unlock(lock))
+#define lock_basic_trylock(lock) (mutex_trylock(lock) == 0)
 
 /** No spinlocks in solaris threads API. Use a mutex. */
 typedef mutex_t lock_quick_type;
@@ -235,6 +238,7 @@ void lock_basic_init(lock_basic_type* lock);
 void lock_basic_destroy(lock_basic_type* lock);
 void lock_basic_lock(lock_basic_type* lock);
 void lock_basic_unlock(lock_basic_type* lock);
+int lock_basic_trylock(lock_basic_type* lock);
 
 /** on windows no spinlock, use mutex too. */
 typedef LONG lock_quick_type;
@@ -271,6 +275,7 @@ typedef int lock_basic_type;
 #define lock_basic_destroy(lock) /* nop */
 #define lock_basic_lock(lock) /* nop */
 #define lock_basic_unlock(lock) /* nop */
+#define lock_basic_trylock(lock) 1
 
 /** define locks to do nothing */
 typedef int lock_quick_type;
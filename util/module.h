@@ -160,6 +160,7 @@ struct sldns_buffer;
 struct alloc_cache;
 struct rrset_cache;
 struct key_cache;
+struct infra_local;
 struct config_file;
 struct slabhash;
 struct query_info;
@@ -174,6 +175,7 @@ struct val_anchors;
 struct val_neg_cache;
 struct iter_forwards;
 struct iter_hints;
+struct cache_peers;
 struct respip_set;
 struct respip_client_info;
 struct respip_addr_info;
@@ -330,6 +332,8 @@ struct module_env {
 	struct rrset_cache* rrset_cache;
 	/** shared infrastructure cache (edns, lameness) */
 	struct infra_cache* infra_cache;
+	/** per thread snapshots of the infra cache, for server selection */
+	struct infra_local* infra_local;
 	/** shared key cache */
 	struct key_cache* key_cache;
 
@@ -483,6 +487,13 @@ struct module_env {
 
 	/* Make every mesh state unique, do not aggregate mesh states. */
 	int unique_mesh;
+	/** the cache quota that is charged for cache inserts, the cache id
+	 * of the view of the client of the query that runs, 0 for none.
+	 * Set by the mesh before the module is run. */
+	uint16_t cache_quota_id;
+	/** the cache peers that the cache inserts are sent to, per-thread,
+	 * created by the worker, NULL if not used */
+	struct cache_peers* cache_peers;
 };
 
 /**
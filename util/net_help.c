@@ -121,6 +121,22 @@ fd_set_block(int s)
 	return 1;
 }
 
+int
+fd_tcp_fastopen_used(int s)
+{
+#if defined(IPPROTO_TCP) && defined(TCP_INFO) && defined(TCPI_OPT_SYN_DATA)
+	struct tcp_info info;
+	socklen_t len = (socklen_t)sizeof(info);
+	memset(&info, 0, sizeof(info));
+	if(getsockopt(s, IPPROTO_TCP, TCP_INFO, (void*)&info, &len) == 0 &&
+		(info.tcpi_options & TCPI_OPT_SYN_DATA))
+		return 1;
+#else
+	(void)s;
+#endif
+	return 0;
+}
+
 int 
 is_pow2(size_t num)
 {
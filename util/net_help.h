@@ -120,6 +120,15 @@ int fd_set_nonblock(int s);
  */
 int fd_set_block(int s); 
 
+/**
+ * See if the data in the SYN of a TCP connection was accepted, with
+ * TCP Fast Open.  For the client the data was acked, for the server
+ * the connection carried data in the SYN.
+ * @param s: file descriptor of the connected socket.
+ * @return true if TCP Fast Open was used, false if not or if unknown.
+ */
+int fd_tcp_fastopen_used(int s);
+
 /**
  * See if number is a power of 2.
  * @param num: the value.
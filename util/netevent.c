@@ -44,6 +44,7 @@
 #include "util/log.h"
 #include "util/net_help.h"
 #include "util/fptr_wlist.h"
+#include "util/xdp.h"
 #include "sldns/pkthdr.h"
 #include "sldns/sbuffer.h"
 #include "dnstap/dnstap.h"
@@ -81,10 +82,11 @@
 #  endif
 #endif
 
-/** The TCP reading or writing query timeout in milliseconds */
-#define TCP_QUERY_TIMEOUT 120000
-/** The TCP timeout in msec for fast queries, above half are used */
-#define TCP_QUERY_TIMEOUT_FAST 200
+/** The default TCP idle timeout in milliseconds */
+#define TCP_QUERY_TIMEOUT 30000
+/** The minimum TCP timeout in msec, when the tcp handlers are nearly
+ * all in use */
+#define TCP_QUERY_TIMEOUT_MINIMUM 200
 
 #ifndef NONBLOCKING_IS_BROKEN
 /** number of UDP reads to perform per read indication from select */
@@ -93,6 +95,20 @@
 #define NUM_UDP_PER_SELECT 1
 #endif
 
+#ifdef SO_MEMINFO
+/* the SO_MEMINFO array indexes, from linux/sock_diag.h */
+#ifndef SK_MEMINFO_RMEM_ALLOC
+/** index of the bytes in the receive queue */
+#define SK_MEMINFO_RMEM_ALLOC 0
+/** index of the receive buffer size */
+#define SK_MEMINFO_RCVBUF 1
+/** index of the kernel drop counter */
+#define SK_MEMINFO_DROPS 8
+/** number of values in the SO_MEMINFO array */
+#define SK_MEMINFO_VARS 9
+#endif
+#endif /* SO_MEMINFO */
+
 /**
  * The internal event structure for keeping ub_event info for the event.
  * Possibly other structures (list, tree) this is part of.
@@ -565,6 +581,132 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 #endif /* AF_INET6 && IPV6_PKTINFO && HAVE_SENDMSG */
 }
 
+int
+udp_sock_rxq(int fd, size_t* rxq, size_t* rcvbuf, size_t* drops)
+{
+#ifdef SO_MEMINFO
+	uint32_t mem[SK_MEMINFO_VARS];
+	socklen_t len = (socklen_t)sizeof(mem);
+	memset(mem, 0, sizeof(mem));
+	if(getsockopt(fd, SOL_SOCKET, SO_MEMINFO, (void*)mem, &len) < 0)
+		return 0;
+	if(len < (socklen_t)((SK_MEMINFO_DROPS+1)*sizeof(uint32_t)))
+		return 0;
+	*rxq = (size_t)mem[SK_MEMINFO_RMEM_ALLOC];
+	*rcvbuf = (size_t)mem[SK_MEMINFO_RCVBUF];
+	*drops = (size_t)mem[SK_MEMINFO_DROPS];
+	return 1;
+#else
+	(void)fd;
+	(void)rxq;
+	(void)rcvbuf;
+	(void)drops;
+	return 0;
+#endif /* SO_MEMINFO */
+}
+
+void
+comm_point_udp_stats_enable(struct comm_point* c)
+{
+	size_t rxq, rcvbuf, drops;
+#ifdef SO_RXQ_OVFL
+	int on = 1;
+	if(setsockopt(c->fd, SOL_SOCKET, SO_RXQ_OVFL, (void*)&on,
+		(socklen_t)sizeof(on)) < 0) {
+		verbose(VERB_ALGO, "setsockopt(.. SO_RXQ_OVFL ..) failed: %s",
+			strerror(errno));
+	}
+#endif /* SO_RXQ_OVFL */
+	/* the socket can be kept open over a reload, start counting
+	 * from the drops it has now */
+	if(udp_sock_rxq(c->fd, &rxq, &rcvbuf, &drops))
+		c->udp_ovfl = (uint32_t)drops;
+	c->udp_stats = 1;
+}
+
+/** add the drops of the kernel counter to the statistics, the counter
+ * is the total for the socket, and wraps around.  The ancillary data has
+ * the value from when the datagram was queued, and that can be older than
+ * the value that was read with SO_MEMINFO, so it only counts upwards. */
+static void
+udp_ovfl_count(struct comm_point* c, uint32_t ovfl)
+{
+	if((int32_t)(ovfl - c->udp_ovfl) <= 0)
+		return;
+	c->udp_drops += (size_t)(uint32_t)(ovfl - c->udp_ovfl);
+	c->udp_ovfl = ovfl;
+}
+
+void
+comm_point_udp_stats_sample(struct comm_point* c)
+{
+	size_t rxq, rcvbuf, drops;
+	c->udp_rxq_time = c->ev->base->eb->secs;
+	if(!udp_sock_rxq(c->fd, &rxq, &rcvbuf, &drops))
+		return;
+	if(rxq > c->udp_rxq_max)
+		c->udp_rxq_max = rxq;
+	if(rcvbuf != 0 && rxq*100/rcvbuf > c->udp_rxq_util)
+		c->udp_rxq_util = rxq*100/rcvbuf;
+	/* the SO_RXQ_OVFL data only comes with the next datagram that is
+	 * queued, the kernel counter has the drops after the last one */
+	udp_ovfl_count(c, (uint32_t)drops);
+}
+
+/** sample the receive queue of a listening UDP socket, at most once
+ * a second, before the datagrams are read from it */
+static void
+udp_rxq_sample(struct comm_point* c)
+{
+	if(!c->udp_stats || c->udp_rxq_time == c->ev->base->eb->secs)
+		return;
+	comm_point_udp_stats_sample(c);
+}
+
+#if defined(HAVE_RECVMSG) && defined(SO_RXQ_OVFL)
+/** receive a datagram with recvmsg, and count the kernel drops from the
+ * SO_RXQ_OVFL ancillary data. The data is only there if the counter
+ * is nonzero. */
+static ssize_t
+udp_recv_ovfl(struct comm_point* c, int fd, struct comm_reply* rep)
+{
+	struct msghdr msg;
+	struct iovec iov[1];
+	ssize_t rcv;
+	char ancil[64];
+#ifndef S_SPLINT_S
+	struct cmsghdr* cmsg;
+#endif /* S_SPLINT_S */
+	msg.msg_name = &rep->addr;
+	msg.msg_namelen = (socklen_t)sizeof(rep->addr);
+	iov[0].iov_base = sldns_buffer_begin(c->buffer);
+	iov[0].iov_len = sldns_buffer_remaining(c->buffer);
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = ancil;
+#ifndef S_SPLINT_S
+	msg.msg_controllen = sizeof(ancil);
+#endif /* S_SPLINT_S */
+	msg.msg_flags = 0;
+	rcv = recvmsg(fd, &msg, 0);
+	if(rcv == -1)
+		return rcv;
+	rep->addrlen = msg.msg_namelen;
+#ifndef S_SPLINT_S
+	for(cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL;
+		cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		if(cmsg->cmsg_level == SOL_SOCKET &&
+			cmsg->cmsg_type == SO_RXQ_OVFL) {
+			uint32_t ovfl;
+			memmove(&ovfl, CMSG_DATA(cmsg), sizeof(ovfl));
+			udp_ovfl_count(c, ovfl);
+		}
+	}
+#endif /* S_SPLINT_S */
+	return rcv;
+}
+#endif /* HAVE_RECVMSG && SO_RXQ_OVFL */
+
 void 
 comm_point_udp_ancil_callback(int fd, short event, void* arg)
 {
@@ -586,6 +728,7 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 		return;
 	log_assert(rep.c && rep.c->buffer && rep.c->fd == fd);
 	ub_comm_base_now(rep.c->ev->base);
+	udp_rxq_sample(rep.c);
 	for(i=0; i<NUM_UDP_PER_SELECT; i++) {
 		sldns_buffer_clear(rep.c->buffer);
 		rep.addrlen = (socklen_t)sizeof(rep.addr);
@@ -637,6 +780,13 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 					sizeof(struct in_addr));
 				break;
 #endif /* IP_PKTINFO or IP_RECVDSTADDR */
+#ifdef SO_RXQ_OVFL
+			} else if( cmsg->cmsg_level == SOL_SOCKET &&
+				cmsg->cmsg_type == SO_RXQ_OVFL) {
+				uint32_t ovfl;
+				memmove(&ovfl, CMSG_DATA(cmsg), sizeof(ovfl));
+				udp_ovfl_count(rep.c, ovfl);
+#endif /* SO_RXQ_OVFL */
 			}
 		}
 		if(verbosity >= VERB_ALGO)
@@ -675,11 +825,17 @@ comm_point_udp_callback(int fd, short event, void* arg)
 		return;
 	log_assert(rep.c && rep.c->buffer && rep.c->fd == fd);
 	ub_comm_base_now(rep.c->ev->base);
+	udp_rxq_sample(rep.c);
 	for(i=0; i<NUM_UDP_PER_SELECT; i++) {
 		sldns_buffer_clear(rep.c->buffer);
 		rep.addrlen = (socklen_t)sizeof(rep.addr);
 		log_assert(fd != -1);
 		log_assert(sldns_buffer_remaining(rep.c->buffer) > 0);
+#if defined(HAVE_RECVMSG) && defined(SO_RXQ_OVFL)
+		if(rep.c->udp_stats)
+			rcv = udp_recv_ovfl(rep.c, fd, &rep);
+		else
+#endif
 		rcv = recvfrom(fd, (void*)sldns_buffer_begin(rep.c->buffer), 
 			sldns_buffer_remaining(rep.c->buffer), 0, 
 			(struct sockaddr*)&rep.addr, &rep.addrlen);
@@ -717,6 +873,107 @@ comm_point_udp_callback(int fd, short event, void* arg)
 	}
 }
 
+#ifdef USE_XDP
+/** store the addresses of an AF_XDP query in the reply info */
+static void
+xdp_pkt_to_reply(struct xdp_pkt* pkt, struct comm_reply* rep)
+{
+	memmove(&rep->addr, &pkt->client, pkt->clientlen);
+	rep->addrlen = pkt->clientlen;
+	rep->srctype = 0;
+	memmove(rep->xdp_eth, pkt->eth, sizeof(rep->xdp_eth));
+	memmove(rep->xdp_local, pkt->local, sizeof(rep->xdp_local));
+}
+
+/** send a reply with the AF_XDP socket, later than the callback */
+static void
+comm_point_send_xdp(struct comm_reply* rep, sldns_buffer* buffer)
+{
+	struct xdp_pkt pkt;
+	memset(&pkt, 0, sizeof(pkt));
+	memmove(&pkt.client, &rep->addr, rep->addrlen);
+	pkt.clientlen = rep->addrlen;
+	memmove(pkt.eth, rep->xdp_eth, sizeof(pkt.eth));
+	memmove(pkt.local, rep->xdp_local, sizeof(pkt.local));
+	if(!xdp_sock_send(rep->c->xdp, &pkt, buffer))
+		verbose(VERB_ALGO, "xdp: no frame for the reply, dropped");
+}
+#endif /* USE_XDP */
+
+void 
+comm_point_xdp_callback(int fd, short event, void* arg)
+{
+#ifdef USE_XDP
+	struct comm_reply rep;
+	struct xdp_pkt pkt;
+	struct xdp_sock* xsk;
+	int i;
+
+	rep.c = (struct comm_point*)arg;
+	log_assert(rep.c->type == comm_udp && rep.c->xdp);
+
+	if(!(event&UB_EV_READ))
+		return;
+	log_assert(rep.c && rep.c->buffer && rep.c->fd == fd);
+	xsk = rep.c->xdp;
+	ub_comm_base_now(rep.c->ev->base);
+	for(i=0; i<NUM_UDP_PER_SELECT; i++) {
+		if(!xdp_sock_recv(xsk, &pkt))
+			break;
+		if(pkt.len > sldns_buffer_capacity(rep.c->buffer)) {
+			xdp_sock_release(xsk, &pkt);
+			continue;
+		}
+		sldns_buffer_clear(rep.c->buffer);
+		sldns_buffer_write(rep.c->buffer, pkt.payload, pkt.len);
+		sldns_buffer_flip(rep.c->buffer);
+		xdp_pkt_to_reply(&pkt, &rep);
+		fptr_ok(fptr_whitelist_comm_point(rep.c->callback));
+		if((*rep.c->callback)(rep.c, rep.c->cb_arg, NETEVENT_NOERROR, &rep)) {
+			/* send back immediate reply, built in the frame of
+			 * the query */
+			xdp_sock_reply(xsk, &pkt, rep.c->buffer);
+		} else {
+			xdp_sock_release(xsk, &pkt);
+		}
+		if(rep.c->fd != fd) /* commpoint closed */
+			break;
+	}
+	/* transmit the replies of the batch together */
+	xdp_sock_kick(xsk);
+#else
+	(void)fd;
+	(void)event;
+	(void)arg;
+	fatal_exit("xdp: no support for AF_XDP");
+#endif /* USE_XDP */
+}
+
+/**
+ * The idle timeout for a tcp handler, shortened as the tcp handlers of
+ * the listening commpoint fill up, so that other connections can get
+ * attention.  Over half in use it is a quarter, over 65% a twentieth,
+ * for the 30 second default that is 7.5 and 1.5 seconds, and over 80%
+ * it is the minimum.
+ * @param msec: idle timeout when few handlers are in use.
+ * @param cur: number of handlers in use.
+ * @param max: total number of handlers.
+ * @return timeout in msec.
+ */
+static int
+tcp_idle_timeout(int msec, int cur, int max)
+{
+	if(cur*5 > max*4)
+		msec = TCP_QUERY_TIMEOUT_MINIMUM;
+	else if(cur*20 > max*13)
+		msec /= 20;
+	else if(cur*2 > max)
+		msec /= 4;
+	if(msec < TCP_QUERY_TIMEOUT_MINIMUM)
+		msec = TCP_QUERY_TIMEOUT_MINIMUM;
+	return msec;
+}
+
 /** Use a new tcp handler for new query fd, set to read query */
 static void
 setup_tcp_handler(struct comm_point* c, int fd, int cur, int max) 
@@ -730,12 +987,8 @@ setup_tcp_handler(struct comm_point* c, int fd, int cur, int max)
 #endif
 	c->tcp_is_reading = 1;
 	c->tcp_byte_count = 0;
-	c->tcp_timeout_msec = TCP_QUERY_TIMEOUT;
-	/* if more than half the tcp handlers are in use, use a shorter
-	 * timeout for this TCP connection, we need to make space for
-	 * other connections to be able to get attention */
-	if(cur > max/2)
-		c->tcp_timeout_msec = TCP_QUERY_TIMEOUT_FAST;
+	c->tcp_idle_msec = c->tcp_parent->tcp_timeout_msec;
+	c->tcp_timeout_msec = tcp_idle_timeout(c->tcp_idle_msec, cur, max);
 	comm_point_start_listening(c, fd, c->tcp_timeout_msec);
 }
 
@@ -886,6 +1139,10 @@ comm_point_tcp_accept_callback(int fd, short event, void* arg)
 		&c_hdl->repinfo.addrlen);
 	if(new_fd == -1)
 		return;
+#ifdef USE_TCP_FASTOPEN
+	if(fd_tcp_fastopen_used(new_fd))
+		c->tcp_fastopen_count++;
+#endif
 	if(c->ssl) {
 		c_hdl->ssl = incoming_ssl_fd(c->ssl, new_fd);
 		if(!c_hdl->ssl) {
@@ -944,7 +1201,14 @@ tcp_callback_writer(struct comm_point* c)
 	c->tcp_byte_count = 0;
 	/* switch from listening(write) to listening(read) */
 	comm_point_stop_listening(c);
-	comm_point_start_listening(c, -1, -1);
+	if(c->tcp_parent) {
+		/* wait for the next query with the timeout for the
+		 * current number of connections */
+		c->tcp_timeout_msec = tcp_idle_timeout(c->tcp_idle_msec,
+			c->tcp_parent->cur_tcp_count,
+			c->tcp_parent->max_tcp_count);
+		comm_point_start_listening(c, -1, c->tcp_timeout_msec);
+	} else	comm_point_start_listening(c, -1, -1);
 }
 
 /** do the callback when reading is done */
@@ -1406,6 +1670,22 @@ comm_point_tcp_handle_write(int fd, struct comm_point* c)
 #endif
 			if(errno == EINTR || errno == EAGAIN)
 				return 1;
+#ifdef EOPNOTSUPP
+			if(errno == EOPNOTSUPP) {
+				/* no TFO in this kernel, connect and write the
+				 * message when the connection is made */
+				if(connect(fd, (struct sockaddr*)&c->repinfo.addr,
+					c->repinfo.addrlen) == 0 ||
+					errno == EINPROGRESS)
+					return 1;
+				if(verbosity >= 2)
+					log_err_addr("tcp connect",
+						strerror(errno),
+						&c->repinfo.addr,
+						c->repinfo.addrlen);
+				return 0;
+			}
+#endif
 			/* Not handling EISCONN here as shouldn't ever hit that case.*/
 			if(errno != 0 && verbosity < 2)
 				return 0; /* silence lots of chatter in the logs */
@@ -1660,6 +1940,46 @@ comm_point_create_udp(struct comm_base *base, int fd, sldns_buffer* buffer,
 	return c;
 }
 
+struct comm_point* 
+comm_point_create_xdp(struct comm_base *base, struct xdp_sock* xsk,
+	sldns_buffer* buffer, comm_point_callback_type* callback,
+	void* callback_arg)
+{
+#ifdef USE_XDP
+	struct comm_point* c = comm_point_create_udp(base, -1, buffer,
+		callback, callback_arg);
+	if(!c)
+		return NULL;
+	/* the event is on the fd of the AF_XDP socket, that is readable
+	 * when the receive ring has frames */
+	ub_event_free(c->ev->ev);
+	c->fd = xsk->fd;
+	c->xdp = xsk;
+	c->do_not_close = 1;
+	c->ev->ev = ub_event_new(base->eb->base, c->fd,
+		UB_EV_READ | UB_EV_PERSIST, comm_point_xdp_callback, c);
+	if(c->ev->ev == NULL) {
+		log_err("could not baseset xdp event");
+		comm_point_delete(c);
+		return NULL;
+	}
+	if(ub_event_add(c->ev->ev, c->timeout) != 0) {
+		log_err("could not add xdp event");
+		comm_point_delete(c);
+		return NULL;
+	}
+	return c;
+#else
+	(void)base;
+	(void)xsk;
+	(void)buffer;
+	(void)callback;
+	(void)callback_arg;
+	log_err("xdp: no support for AF_XDP");
+	return NULL;
+#endif /* USE_XDP */
+}
+
 struct comm_point* 
 comm_point_create_udp_ancil(struct comm_base *base, int fd, 
 	sldns_buffer* buffer, 
@@ -1818,6 +2138,8 @@ comm_point_create_tcp(struct comm_base *base, int fd, int num, size_t bufsize,
 	c->tcp_parent = NULL;
 	c->max_tcp_count = num;
 	c->cur_tcp_count = 0;
+	c->tcp_fastopen_count = 0;
+	c->tcp_timeout_msec = TCP_QUERY_TIMEOUT;
 	c->tcp_handlers = (struct comm_point**)calloc((size_t)num,
 		sizeof(struct comm_point*));
 	if(!c->tcp_handlers) {
@@ -2122,6 +2444,11 @@ comm_point_send_reply(struct comm_reply *repinfo)
 	buffer = repinfo->c->buffer;
 #endif
 	if(repinfo->c->type == comm_udp) {
+#ifdef USE_XDP
+		if(repinfo->c->xdp)
+			comm_point_send_xdp(repinfo, buffer);
+		else
+#endif
 		if(repinfo->srctype)
 			comm_point_send_udp_msg_if(repinfo->c, 
 			buffer, (struct sockaddr*)&repinfo->addr, 
@@ -2147,6 +2474,18 @@ comm_point_send_reply(struct comm_reply *repinfo)
 	}
 }
 
+int
+comm_point_tcp_set_idle(struct comm_point* c, int msec)
+{
+	log_assert(c->type == comm_tcp);
+	if(!c->tcp_parent)
+		return c->tcp_timeout_msec;
+	c->tcp_idle_msec = msec;
+	c->tcp_timeout_msec = tcp_idle_timeout(msec,
+		c->tcp_parent->cur_tcp_count, c->tcp_parent->max_tcp_count);
+	return c->tcp_timeout_msec;
+}
+
 void 
 comm_point_drop_reply(struct comm_reply* repinfo)
 {
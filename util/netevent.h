@@ -66,6 +66,7 @@ struct sldns_buffer;
 struct comm_point;
 struct comm_reply;
 struct ub_event_base;
+struct xdp_sock;
 
 /* internal event notification data storage structure. */
 struct internal_event;
@@ -136,6 +137,12 @@ struct comm_reply {
 	} 	
 		/** variable with return source data */
 		pktinfo;
+#ifdef USE_XDP
+	/** for AF_XDP, the destination and source MAC of the query */
+	uint8_t xdp_eth[12];
+	/** for AF_XDP, the local address the query was sent to */
+	uint8_t xdp_local[16];
+#endif
     /** max udp size for udp packets */
     size_t max_udp_size;
 };
@@ -172,11 +179,33 @@ struct comm_point {
 	/** sockaddr from peer, for TCP handlers */
 	struct comm_reply repinfo;
 
+	/* -------- UDP -------- */
+	/** if the datagrams that the kernel drops on the socket are counted,
+	 * and the receive queue is sampled, for the statistics of a
+	 * listening UDP socket */
+	int udp_stats;
+	/** the last value of the drop counter of the socket, from
+	 * SO_RXQ_OVFL */
+	uint32_t udp_ovfl;
+	/** number of datagrams that the kernel dropped on the socket,
+	 * since the statistics were reset */
+	size_t udp_drops;
+	/** time of the last receive queue sample, in seconds */
+	time_t udp_rxq_time;
+	/** the largest sampled receive queue, in bytes, since the reset */
+	size_t udp_rxq_max;
+	/** the largest sampled receive queue, in percent of the receive
+	 * buffer, since the reset */
+	size_t udp_rxq_util;
+
 	/* -------- TCP Accept -------- */
 	/** the number of TCP handlers for this tcp-accept socket */
 	int max_tcp_count;
 	/** current number of tcp handler in-use for this accept socket */
 	int cur_tcp_count;
+	/** number of accepted connections that carried data in the SYN,
+	 * with TCP Fast Open, for this accept socket */
+	size_t tcp_fastopen_count;
 	/** malloced array of tcp handlers for a tcp-accept, 
 	    of size max_tcp_count. */
 	struct comm_point** tcp_handlers;
@@ -236,9 +265,14 @@ struct comm_point {
 	    So that when that is done the callback is called. */
 	int tcp_do_toggle_rw;
 
-	/** timeout in msec for TCP wait times for this connection */
+	/** timeout in msec for TCP wait times for this connection.
+	 * For the tcp accept commpoint, the idle timeout for its handlers */
 	int tcp_timeout_msec;
 
+	/** idle timeout in msec for this tcp handler, before it is
+	 * shortened for the number of connections in use */
+	int tcp_idle_msec;
+
 	/** if set, checks for pending error from nonblocking connect() call.*/
 	int tcp_check_nb_connect;
 
@@ -257,6 +291,12 @@ struct comm_point {
 	 * outside network for udp ports */
 	int inuse;
 
+#ifdef USE_XDP
+	/** the AF_XDP socket, for an UDP commpoint on the XDP fast path,
+	 * or NULL */
+	struct xdp_sock* xdp;
+#endif
+
 	/** callback when done.
 	    tcp_accept does not get called back, is NULL then.
 	    If a timeout happens, callback with timeout=1 is called.
@@ -417,6 +457,47 @@ struct comm_point* comm_point_create_udp_ancil(struct comm_base* base,
 	int fd, struct sldns_buffer* buffer, 
 	comm_point_callback_type* callback, void* callback_arg);
 
+/**
+ * Turn on the kernel drop counter and the receive queue samples for a
+ * listening UDP comm point. The drops are read from the SO_RXQ_OVFL
+ * ancillary data, where the system supports it.
+ * @param c: the UDP comm point.
+ */
+void comm_point_udp_stats_enable(struct comm_point* c);
+
+/**
+ * Sample the receive queue of a listening UDP comm point, and update the
+ * drop count from the kernel counter of the socket.
+ * @param c: the UDP comm point, with the statistics turned on.
+ */
+void comm_point_udp_stats_sample(struct comm_point* c);
+
+/**
+ * Get the receive queue of a UDP socket from the kernel, with SO_MEMINFO.
+ * @param fd: the socket.
+ * @param rxq: returns the bytes in the receive queue.
+ * @param rcvbuf: returns the size of the receive buffer, in bytes.
+ * @param drops: returns the datagrams dropped on the socket by the kernel.
+ * @return false if not supported by the system, or on failure.
+ */
+int udp_sock_rxq(int fd, size_t* rxq, size_t* rcvbuf, size_t* drops);
+
+/**
+ * Create an UDP comm point for an AF_XDP socket. Calls malloc.
+ * The queries are received from the receive ring of the socket, and the
+ * replies are built in the frames and put on the transmit ring, also
+ * for replies sent later with comm_point_send_reply.
+ * @param base: in which base to alloc the commpoint.
+ * @param xsk: the AF_XDP socket, not closed on delete.
+ * @param buffer: shared buffer by UDP sockets from this thread.
+ * @param callback: callback function pointer.
+ * @param callback_arg: will be passed to your callback function.
+ * @return: returns the allocated communication point. NULL on error.
+ */
+struct comm_point* comm_point_create_xdp(struct comm_base* base,
+	struct xdp_sock* xsk, struct sldns_buffer* buffer,
+	comm_point_callback_type* callback, void* callback_arg);
+
 /**
  * Create a TCP listener comm point. Calls malloc.
  * Setups the structure with the parameters you provide.
@@ -494,6 +575,16 @@ void comm_point_delete(struct comm_point* c);
  */
 void comm_point_send_reply(struct comm_reply* repinfo);
 
+/**
+ * Set the idle timeout of an incoming tcp connection, for instance for
+ * the edns-tcp-keepalive option. It is shortened when many tcp handlers
+ * are in use, like the default idle timeout.
+ * @param c: the tcp handler commpoint.
+ * @param msec: the idle timeout in msec.
+ * @return the timeout in msec that is used for the connection.
+ */
+int comm_point_tcp_set_idle(struct comm_point* c, int msec);
+
 /**
  * Drop reply. Cleans up.
  * @param repinfo: The reply info copied from a commpoint callback call.
@@ -645,6 +736,16 @@ void comm_point_udp_callback(int fd, short event, void* arg);
  */
 void comm_point_udp_ancil_callback(int fd, short event, void* arg);
 
+/**
+ * This routine is published for checks and tests, and is only used internally.
+ * handle libevent callback for AF_XDP comm point.
+ * @param fd: file descriptor.
+ * @param event: event bits from libevent: 
+ *	EV_READ, EV_WRITE, EV_SIGNAL, EV_TIMEOUT.
+ * @param arg: the comm_point structure.
+ */
+void comm_point_xdp_callback(int fd, short event, void* arg);
+
 /**
  * This routine is published for checks and tests, and is only used internally.
  * handle libevent callback for tcp accept comm point
@@ -61,6 +61,12 @@
 #include "util/random.h"
 #include "util/log.h"
 #include <time.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#if defined(HAVE_PTHREAD) && !defined(THREADS_DISABLED)
+#include <pthread.h>
+#endif
 
 #ifdef HAVE_NSS
 /* nspr4 */
@@ -79,37 +85,185 @@
 #define MAX_VALUE 0x7fffffff
 
 #if defined(HAVE_SSL)
+#define KEYSTREAM_ONLY
+#include "compat/chacha_private.h"
+
+/** size of the chacha key */
+#define RND_KEYSZ 32
+/** size of the chacha iv */
+#define RND_IVSZ 8
+/** size of the keystream buffer, made in bulk */
+#define RND_BUFSZ (16*64)
+/** number of bytes handed out before reseeding from system entropy */
+#define RND_RESEED 1600000
+
+/**
+ * Random state.  Every thread has its own random state, a chacha20
+ * keystream generator, so that no lock is needed to get random numbers.
+ * It is seeded from system entropy, and rekeyed from its own keystream
+ * after every buffer for backtracking resistance.
+ */
+struct ub_randstate {
+	/** chacha context for the keystream */
+	chacha_ctx chacha;
+	/** keystream blocks */
+	uint8_t buf[RND_BUFSZ];
+	/** valid bytes at end of buf */
+	size_t have;
+	/** bytes until reseed from system entropy */
+	size_t count;
+#if defined(HAVE_PTHREAD) && !defined(THREADS_DISABLED)
+	/** fork generation that this state was seeded in */
+	unsigned int forkgen;
+#elif defined(HAVE_FORK)
+	/** process that this state was seeded in */
+	pid_t pid;
+#endif
+};
+
+#if defined(HAVE_PTHREAD) && !defined(THREADS_DISABLED)
+/** fork generation, incremented in the child after a fork, so the random
+ * states notice that they are copies and reseed */
+static volatile unsigned int rnd_forkgen = 0;
+/** once control for the registration of the fork handler */
+static pthread_once_t rnd_forkonce = PTHREAD_ONCE_INIT;
+
+/** fork handler for the child */
+static void
+rnd_atfork_child(void)
+{
+	rnd_forkgen++;
+}
+
+/** register the fork handler */
+static void
+rnd_atfork_setup(void)
+{
+	(void)pthread_atfork(NULL, NULL, &rnd_atfork_child);
+}
+#endif
+
+/** get entropy from the system for the random state */
+static void
+rnd_entropy(uint8_t* buf, size_t len)
+{
+#if defined(HAVE_GETENTROPY) || !defined(HAVE_ARC4RANDOM)
+	if(getentropy(buf, len) != -1)
+		return;
+	log_err("random state: getentropy failed: %s", strerror(errno));
+#endif
+	arc4random_buf(buf, len);
+}
+
+/** set the key and iv from the data */
+static void
+rnd_keysetup(struct ub_randstate* s, uint8_t* dat)
+{
+	chacha_keysetup(&s->chacha, dat, RND_KEYSZ * 8, 0);
+	chacha_ivsetup(&s->chacha, dat + RND_KEYSZ);
+}
+
+/** make a new keystream buffer, and rekey from the keystream */
+static void
+rnd_rekey(struct ub_randstate* s, uint8_t* dat, size_t datlen)
+{
+	size_t i;
+	/* fill buf with the keystream */
+	chacha_encrypt_bytes(&s->chacha, s->buf, s->buf, sizeof(s->buf));
+	/* mix in the optional entropy */
+	for(i = 0; dat && i < datlen && i < RND_KEYSZ + RND_IVSZ; i++)
+		s->buf[i] ^= dat[i];
+	/* immediately reinit for backtracking resistance */
+	rnd_keysetup(s, s->buf);
+	memset(s->buf, 0, RND_KEYSZ + RND_IVSZ);
+	s->have = sizeof(s->buf) - RND_KEYSZ - RND_IVSZ;
+}
+
+/** seed, or reseed, the state from system entropy */
+static void
+rnd_stir(struct ub_randstate* s, int init)
+{
+	uint8_t rnd[RND_KEYSZ + RND_IVSZ];
+	rnd_entropy(rnd, sizeof(rnd));
+	if(init)
+		rnd_keysetup(s, rnd);
+	rnd_rekey(s, rnd, sizeof(rnd));
+	explicit_bzero(rnd, sizeof(rnd));
+	s->count = RND_RESEED;
+#if defined(HAVE_PTHREAD) && !defined(THREADS_DISABLED)
+	s->forkgen = rnd_forkgen;
+#elif defined(HAVE_FORK)
+	s->pid = getpid();
+#endif
+}
+
+/** get random 32 bit value from the state */
+static uint32_t
+rnd_u32(struct ub_randstate* s)
+{
+	uint32_t v;
+	uint8_t* keystream;
+#if defined(HAVE_PTHREAD) && !defined(THREADS_DISABLED)
+	if(s->forkgen != rnd_forkgen)
+		s->count = 0;
+#elif defined(HAVE_FORK)
+	if(s->pid != getpid())
+		s->count = 0;
+#endif
+	if(s->count <= sizeof(v))
+		rnd_stir(s, 0);
+	s->count -= sizeof(v);
+	if(s->have < sizeof(v))
+		rnd_rekey(s, NULL, 0);
+	keystream = s->buf + sizeof(s->buf) - s->have;
+	memcpy(&v, keystream, sizeof(v));
+	memset(keystream, 0, sizeof(v));
+	s->have -= sizeof(v);
+	return v;
+}
+
 void
 ub_systemseed(unsigned int ATTR_UNUSED(seed))
 {
-	/* arc4random_uniform does not need seeds, it gets kernel entropy */
+	/* the random states get kernel entropy when they are made */
 }
 
 struct ub_randstate* 
 ub_initstate(unsigned int ATTR_UNUSED(seed),
 	struct ub_randstate* ATTR_UNUSED(from))
 {
-	struct ub_randstate* s = (struct ub_randstate*)malloc(1);
+	struct ub_randstate* s = (struct ub_randstate*)calloc(1, sizeof(*s));
 	if(!s) {
 		log_err("malloc failure in random init");
 		return NULL;
 	}
+#if defined(HAVE_PTHREAD) && !defined(THREADS_DISABLED)
+	(void)pthread_once(&rnd_forkonce, &rnd_atfork_setup);
+#endif
+	rnd_stir(s, 1);
 	return s;
 }
 
 long int 
-ub_random(struct ub_randstate* ATTR_UNUSED(s))
+ub_random(struct ub_randstate* s)
 {
 	/* This relies on MAX_VALUE being 0x7fffffff. */
-	return (long)arc4random() & MAX_VALUE;
+	return (long)rnd_u32(s) & MAX_VALUE;
 }
 
 long int
-ub_random_max(struct ub_randstate* state, long int x)
+ub_random_max(struct ub_randstate* s, long int x)
 {
-	(void)state;
-	/* on OpenBSD, this does not need _seed(), or _stir() calls */
-	return (long)arc4random_uniform((uint32_t)x);
+	/* as arc4random_uniform, skip values below 2**32 % x, so that
+	 * there is no modulo bias */
+	uint32_t r, upper = (uint32_t)x, min;
+	if(upper < 2)
+		return 0;
+	min = -upper % upper;
+	do {
+		r = rnd_u32(s);
+	} while(r < min);
+	return (long)(r % upper);
 }
 
 #elif defined(HAVE_NSS)
@@ -228,6 +382,10 @@ ub_random_max(struct ub_randstate* state, long int x)
 void 
 ub_randfree(struct ub_randstate* s)
 {
+#if defined(HAVE_SSL)
+	if(s)
+		explicit_bzero(s, sizeof(*s));
+#endif
 	free(s);
 	/* user app must do RAND_cleanup(); */
 }
@@ -40,9 +40,14 @@
  * manipulate those structures that help building DNS lookup trees.
  */
 #include "config.h"
+#include <ctype.h>
 #include "util/storage/dnstree.h"
 #include "util/data/dname.h"
 #include "util/net_help.h"
+#include "sldns/rrdef.h"
+
+/** the largest size of a name index key, class and name */
+#define NAME_INDEX_KEYMAX (2+LDNS_MAX_DOMAINLEN)
 
 int name_tree_compare(const void* k1, const void* k2)
 {
@@ -293,3 +298,206 @@ name_tree_next_root(rbtree_type* tree, uint16_t* dclass)
 		return name_tree_next_root(tree, dclass);
 	}
 }
+
+struct name_index*
+name_index_create(void)
+{
+	return (struct name_index*)calloc(1, sizeof(struct name_index));
+}
+
+void
+name_index_delete(struct name_index* idx)
+{
+	if(!idx)
+		return;
+	free(idx->array);
+	free(idx->keys);
+	free(idx);
+}
+
+/**
+ * Make the key for the index, the class and the labels from the root
+ * down, with the label lengths, lowercased.  The memcmp order of the keys
+ * is the order of name_tree_compare.
+ * @param name: the name, uncompressed wireformat.
+ * @param dclass: the class.
+ * @param key: destination, NAME_INDEX_KEYMAX in size.
+ * @return length of the key.
+ */
+static size_t
+name_index_key(uint8_t* name, uint16_t dclass, uint8_t* key)
+{
+	uint8_t* labstart[LDNS_MAX_DOMAINLEN/2+1];
+	int n = 0;
+	size_t pos = 2, i;
+	key[0] = (uint8_t)(dclass>>8);
+	key[1] = (uint8_t)(dclass&0xff);
+	while(*name && n < (int)(sizeof(labstart)/sizeof(uint8_t*))) {
+		labstart[n++] = name;
+		name += *name + 1;
+	}
+	while(n--) {
+		uint8_t* lab = labstart[n];
+		key[pos++] = lab[0];
+		for(i=1; i<=(size_t)lab[0]; i++)
+			key[pos++] = (uint8_t)tolower((unsigned char)lab[i]);
+	}
+	return pos;
+}
+
+int
+name_index_add(struct name_index* idx, void* node, uint8_t* name,
+	uint16_t dclass)
+{
+	struct name_index_entry* e;
+	if(idx->count == idx->capacity) {
+		size_t c = idx->capacity?idx->capacity*2:16;
+		struct name_index_entry* a = (struct name_index_entry*)
+			realloc(idx->array, c*sizeof(*a));
+		if(!a)
+			return 0;
+		idx->array = a;
+		idx->capacity = c;
+	}
+	if(idx->keys_used + NAME_INDEX_KEYMAX > idx->keys_capacity) {
+		size_t c = idx->keys_capacity?idx->keys_capacity*2:1024;
+		uint8_t* k;
+		if(c > (size_t)0xffffffff)
+			return 0; /* the keypos is 32 bit */
+		k = (uint8_t*)realloc(idx->keys, c);
+		if(!k)
+			return 0;
+		idx->keys = k;
+		idx->keys_capacity = c;
+	}
+	e = &idx->array[idx->count++];
+	e->node = node;
+	e->keypos = (uint32_t)idx->keys_used;
+	e->keylen = (uint16_t)name_index_key(name, dclass,
+		idx->keys+idx->keys_used);
+	idx->keys_used += e->keylen;
+	return 1;
+}
+
+/**
+ * Compare keys, and skip the prefix that is known to be equal.
+ * @param k1: key
+ * @param len1: length of k1.
+ * @param k2: key
+ * @param len2: length of k2.
+ * @param lcp: length of the prefix known to be in common, returns the
+ *	length of the common prefix.
+ * @return -1, 0, +1 as memcmp.
+ */
+static int
+name_index_cmp(uint8_t* k1, size_t len1, uint8_t* k2, size_t len2,
+	size_t* lcp)
+{
+	size_t i = *lcp, m = (len1<len2?len1:len2);
+	while(i < m && k1[i] == k2[i])
+		i++;
+	*lcp = i;
+	if(i < m)
+		return (k1[i] < k2[i])?-1:1;
+	if(len1 == len2)
+		return 0;
+	return (len1 < len2)?-1:1;
+}
+
+/** count the labels that are wholly inside the prefix of the key,
+ * the root label included */
+static int
+name_index_labs(uint8_t* key, size_t keylen, size_t lcp)
+{
+	size_t pos = 2;
+	int labs = 1;
+	if(lcp < 2)
+		return 0; /* not the same class */
+	while(pos < keylen && pos + 1 + key[pos] <= lcp) {
+		pos += 1 + key[pos];
+		labs++;
+	}
+	return labs;
+}
+
+void*
+name_index_lookup(struct name_index* idx, uint8_t* name, uint16_t dclass,
+	int* mlabs)
+{
+	uint8_t key[NAME_INDEX_KEYMAX];
+	size_t keylen = name_index_key(name, dclass, key);
+	/* the entries from lo to hi are still to be searched, all entries
+	 * before lo are smaller, and from hi on are larger, and they have
+	 * llo and lhi bytes in common with the key */
+	size_t lo = 0, hi = idx->count, llo = 0, lhi = 0, l;
+	struct name_index_entry* found = NULL;
+	size_t foundl = 0;
+	while(lo < hi) {
+		size_t mid = lo + (hi-lo)/2;
+		struct name_index_entry* e = &idx->array[mid];
+		int c;
+		l = (llo<lhi?llo:lhi);
+		c = name_index_cmp(key, keylen, idx->keys+e->keypos,
+			e->keylen, &l);
+		if(c == 0) {
+			*mlabs = name_index_labs(key, keylen, keylen);
+			return e->node;
+		} else if(c < 0) {
+			hi = mid;
+			lhi = l;
+		} else {
+			lo = mid+1;
+			llo = l;
+			found = e;
+			foundl = l;
+		}
+	}
+	if(!found) {
+		*mlabs = 0;
+		return NULL;
+	}
+	*mlabs = name_index_labs(key, keylen, foundl);
+	return found->node;
+}
+
+size_t
+name_index_get_mem(struct name_index* idx)
+{
+	if(!idx)
+		return 0;
+	return sizeof(*idx) + idx->capacity*sizeof(struct name_index_entry)
+		+ idx->keys_capacity;
+}
+
+struct name_index*
+name_tree_index_create(rbtree_type* tree)
+{
+	struct name_tree_node* node;
+	struct name_index* idx = name_index_create();
+	if(!idx)
+		return NULL;
+	RBTREE_FOR(node, struct name_tree_node*, tree) {
+		if(!name_index_add(idx, node, node->name, node->dclass)) {
+			name_index_delete(idx);
+			return NULL;
+		}
+	}
+	return idx;
+}
+
+struct name_tree_node*
+name_tree_lookup_index(struct name_index* idx, uint8_t* name,
+	uint16_t dclass)
+{
+	int m;
+	struct name_tree_node* result = (struct name_tree_node*)
+		name_index_lookup(idx, name, dclass, &m);
+	if(!result || result->dclass != dclass)
+		return NULL;
+	while(result) { /* go up until qname is subdomain of stub */
+		if(result->labs <= m)
+			break;
+		result = result->parent;
+	}
+	return result;
+}
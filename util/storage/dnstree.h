@@ -194,6 +194,104 @@ struct addr_tree_node* addr_tree_lookup(rbtree_type* tree,
 struct addr_tree_node* addr_tree_find(rbtree_type* tree, 
 	struct sockaddr_storage* addr, socklen_t addrlen, int net);
 
+/**
+ * Sorted array index of the names in a tree, for trees that are read
+ * much more than they are changed.  It is built after the tree is set up,
+ * and has the same order as the tree, so the element less or equal to a
+ * name is the same as with rbtree_find_less_equal.  The keys are in one
+ * block of memory, with the class and then the labels from the root down,
+ * lowercased, so that they compare with memcmp, and the binary search
+ * can skip the prefix that it already knows is in common.
+ */
+struct name_index {
+	/** sorted array of entries */
+	struct name_index_entry* array;
+	/** number of entries in the array */
+	size_t count;
+	/** allocated size of the array */
+	size_t capacity;
+	/** the keys of the entries */
+	uint8_t* keys;
+	/** bytes used in keys */
+	size_t keys_used;
+	/** allocated size of keys */
+	size_t keys_capacity;
+};
+
+/**
+ * Entry in the name index.
+ */
+struct name_index_entry {
+	/** the element in the tree with this name */
+	void* node;
+	/** the position of the key in the keys block */
+	uint32_t keypos;
+	/** the length of the key */
+	uint16_t keylen;
+};
+
+/**
+ * Create empty name index.
+ * @return new index or NULL on malloc failure.
+ */
+struct name_index* name_index_create(void);
+
+/**
+ * Delete name index.
+ * @param idx: the index, the tree elements are not touched.
+ */
+void name_index_delete(struct name_index* idx);
+
+/**
+ * Add an element to the name index.  The elements must be added in the
+ * order of the tree, class and then dname_lab_cmp order.
+ * @param idx: the index.
+ * @param node: the element to add.
+ * @param name: the name of the element, uncompressed wireformat.
+ * @param dclass: the class of the element.
+ * @return false on malloc failure.
+ */
+int name_index_add(struct name_index* idx, void* node, uint8_t* name,
+	uint16_t dclass);
+
+/**
+ * Find the element that is equal to, or the closest smaller than, the name.
+ * @param idx: the index.
+ * @param name: the name to look for, uncompressed wireformat.
+ * @param dclass: the class to look for.
+ * @param mlabs: returns the number of labels in common with the element
+ *	that is returned, including the root label, or 0 if the class is
+ *	not the same.
+ * @return the element or NULL if there is no smaller element.
+ */
+void* name_index_lookup(struct name_index* idx, uint8_t* name,
+	uint16_t dclass, int* mlabs);
+
+/**
+ * Get memory used by the name index.
+ * @param idx: the index, or NULL.
+ * @return bytes in use.
+ */
+size_t name_index_get_mem(struct name_index* idx);
+
+/**
+ * Create a name index for a name tree, after name_tree_init_parents.
+ * @param tree: the name tree.
+ * @return the index or NULL on malloc failure.
+ */
+struct name_index* name_tree_index_create(rbtree_type* tree);
+
+/**
+ * Lookup closest encloser in name tree, with the index of the tree.
+ * Same result as name_tree_lookup.
+ * @param idx: the name index of the name tree.
+ * @param name: wireformat name
+ * @param dclass: class of name
+ * @return closest enclosing node (could be equal) or NULL if not found.
+ */
+struct name_tree_node* name_tree_lookup_index(struct name_index* idx,
+	uint8_t* name, uint16_t dclass);
+
 /** compare name tree nodes */
 int name_tree_compare(const void* k1, const void* k2);
 
@@ -78,9 +78,15 @@ lruhash_create(size_t start_size, size_t maxmem,
 	table->size_mask = (int)(start_size-1);
 	table->lru_start = NULL;
 	table->lru_end = NULL;
+	table->pin_start = NULL;
 	table->num = 0;
 	table->space_used = 0;
 	table->space_max = maxmem;
+	table->num_pinned = 0;
+	table->space_pinned = 0;
+	table->space_pin_max = 0;
+	table->quota = NULL;
+	table->quota_num = 0;
 	table->array = calloc(table->size, sizeof(struct lruhash_bin));
 	if(!table->array) {
 		lock_quick_destroy(&table->lock);
@@ -160,6 +166,7 @@ lruhash_delete(struct lruhash* table)
 	for(i=0; i<table->size; i++)
 		bin_delete(table, &table->array[i]);
 	free(table->array);
+	free(table->quota);
 	free(table);
 }
 
@@ -178,26 +185,80 @@ bin_overflow_remove(struct lruhash_bin* bin, struct lruhash_entry* entry)
 	}
 }
 
+/** the quota with its own lru list for the quota id, or NULL if the
+ * entries of the quota id are in the table lru list. */
+static struct lruhash_quota*
+quota_list(struct lruhash* table, uint16_t quota_id)
+{
+	if(quota_id == 0 || quota_id >= table->quota_num ||
+		table->quota[quota_id].space_max == 0)
+		return NULL;
+	return &table->quota[quota_id];
+}
+
+/** charge space to a quota id, caller holds hashlock */
+static void
+quota_add(struct lruhash* table, uint16_t quota_id, size_t size)
+{
+	if(quota_id != 0 && quota_id < table->quota_num)
+		table->quota[quota_id].space_used += size;
+}
+
+/** release space from a quota id, caller holds hashlock */
+static void
+quota_sub(struct lruhash* table, uint16_t quota_id, size_t size)
+{
+	if(quota_id != 0 && quota_id < table->quota_num)
+		table->quota[quota_id].space_used -= size;
+}
+
+/**
+ * Select the entry to reclaim, the end of an lru list. Quotas that are
+ * over their maximum are reclaimed first, then the table lru list, and
+ * if that is empty, the quota that uses the most space.
+ * The most recently used entry of a list is not reclaimed, and pinned
+ * entries are not in the lists.
+ * @param table: hash table, caller holds hashlock.
+ * @return entry or NULL if there is nothing (more) to reclaim.
+ */
+static struct lruhash_entry*
+reclaim_select(struct lruhash* table)
+{
+	struct lruhash_quota* q, *most = NULL;
+	size_t i;
+	for(i=1; i<table->quota_num; i++) {
+		q = &table->quota[i];
+		if(q->space_max == 0 || !q->lru_end || !q->lru_end->lru_prev)
+			continue;
+		if(q->space_used > q->space_max)
+			return q->lru_end;
+		if(!most || q->space_used > most->space_used)
+			most = q;
+	}
+	if(table->space_used <= table->space_max)
+		return NULL;
+	if(table->lru_end && table->lru_end->lru_prev)
+		return table->lru_end;
+	return most?most->lru_end:NULL;
+}
+
 void 
 reclaim_space(struct lruhash* table, struct lruhash_entry** list)
 {
 	struct lruhash_entry* d;
 	struct lruhash_bin* bin;
+	size_t size;
 	log_assert(table);
 	/* does not delete MRU entry, so table will not be empty. */
-	while(table->num > 1 && table->space_used > table->space_max) {
+	while(table->num > 1 && (d = reclaim_select(table)) != NULL) {
 		/* notice that since we hold the hashtable lock, nobody
 		   can change the lru chain. So it cannot be deleted underneath
 		   us. We still need the hashbin and entry write lock to make 
 		   sure we flush all users away from the entry. 
 		   which is unlikely, since it is LRU, if someone got a rdlock
 		   it would be moved to front, but to be sure. */
-		d = table->lru_end;
-		/* specialised, delete from end of double linked list,
-		   and we know num>1, so there is a previous lru entry. */
-		log_assert(d && d->lru_prev);
-		table->lru_end = d->lru_prev;
-		d->lru_prev->lru_next = NULL;
+		/* delete from end of double linked list. */
+		lru_remove(table, d);
 		/* schedule entry for deletion */
 		bin = &table->array[d->hash & table->size_mask];
 		table->num --;
@@ -206,7 +267,9 @@ reclaim_space(struct lruhash* table, struct lruhash_entry** list)
 		d->overflow_next = *list;
 		*list = d;
 		lock_rw_wrlock(&d->lock);
-		table->space_used -= table->sizefunc(d->key, d->data);
+		size = table->sizefunc(d->key, d->data);
+		table->space_used -= size;
+		quota_sub(table, d->quota_id, size);
 		if(table->markdelfunc)
 			(*table->markdelfunc)(d->key);
 		lock_rw_unlock(&d->lock);
@@ -265,30 +328,90 @@ table_grow(struct lruhash* table)
 void 
 lru_front(struct lruhash* table, struct lruhash_entry* entry)
 {
+	struct lruhash_quota* q = quota_list(table, entry->quota_id);
+	struct lruhash_entry** start = q?&q->lru_start:&table->lru_start;
 	entry->lru_prev = NULL;
-	entry->lru_next = table->lru_start;
-	if(!table->lru_start)
-		table->lru_end = entry;
-	else	table->lru_start->lru_prev = entry;
-	table->lru_start = entry;
+	entry->lru_next = *start;
+	if(!*start) {
+		if(q) q->lru_end = entry;
+		else table->lru_end = entry;
+	} else	(*start)->lru_prev = entry;
+	*start = entry;
 }
 
 void 
 lru_remove(struct lruhash* table, struct lruhash_entry* entry)
 {
+	struct lruhash_quota* q = quota_list(table, entry->quota_id);
 	if(entry->lru_prev)
 		entry->lru_prev->lru_next = entry->lru_next;
+	else if(q) q->lru_start = entry->lru_next;
 	else	table->lru_start = entry->lru_next;
 	if(entry->lru_next)
 		entry->lru_next->lru_prev = entry->lru_prev;
+	else if(q) q->lru_end = entry->lru_prev;
 	else	table->lru_end = entry->lru_prev;
 }
 
+/** put entry at the front of the pin list */
+static void
+pin_front(struct lruhash* table, struct lruhash_entry* entry)
+{
+	entry->lru_prev = NULL;
+	entry->lru_next = table->pin_start;
+	if(table->pin_start)
+		table->pin_start->lru_prev = entry;
+	table->pin_start = entry;
+}
+
+/** remove entry from the pin list */
+static void
+pin_remove(struct lruhash* table, struct lruhash_entry* entry)
+{
+	if(entry->lru_prev)
+		entry->lru_prev->lru_next = entry->lru_next;
+	else	table->pin_start = entry->lru_next;
+	if(entry->lru_next)
+		entry->lru_next->lru_prev = entry->lru_prev;
+}
+
+/** set the pin state of an entry in the table, caller holds hashlock */
+static void
+entry_set_pin(struct lruhash* table, struct lruhash_entry* entry,
+	int pin, size_t size)
+{
+	if(pin) {
+		lru_remove(table, entry);
+		pin_front(table, entry);
+		entry->pinned = 1;
+		table->num_pinned++;
+		table->space_pinned += size;
+	} else {
+		pin_remove(table, entry);
+		lru_front(table, entry);
+		entry->pinned = 0;
+		table->num_pinned--;
+		table->space_pinned -= size;
+	}
+}
+
+/** see if an entry of the size can be pinned, caller holds hashlock */
+static int
+pin_fits(struct lruhash* table, size_t size)
+{
+	return table->space_pin_max == 0 ||
+		table->space_pinned + size <= table->space_pin_max;
+}
+
 void 
 lru_touch(struct lruhash* table, struct lruhash_entry* entry)
 {
+	struct lruhash_quota* q;
 	log_assert(table && entry);
-	if(entry == table->lru_start)
+	if(entry->pinned)
+		return; /* nothing to do */
+	q = quota_list(table, entry->quota_id);
+	if(entry == (q?q->lru_start:table->lru_start))
 		return; /* nothing to do */
 	/* remove from current lru position */
 	lru_remove(table, entry);
@@ -299,10 +422,20 @@ lru_touch(struct lruhash* table, struct lruhash_entry* entry)
 void 
 lruhash_insert(struct lruhash* table, hashvalue_type hash,
         struct lruhash_entry* entry, void* data, void* cb_arg)
+{
+	lruhash_insert_quota(table, hash, entry, data, cb_arg, 0);
+}
+
+void 
+lruhash_insert_quota(struct lruhash* table, hashvalue_type hash,
+        struct lruhash_entry* entry, void* data, void* cb_arg,
+	uint16_t quota_id)
 {
 	struct lruhash_bin* bin;
 	struct lruhash_entry* found, *reclaimlist=NULL;
-	size_t need_size;
+	struct lruhash_quota* q;
+	size_t need_size, old_size;
+	int pin = 0;
 	fptr_ok(fptr_whitelist_hash_sizefunc(table->sizefunc));
 	fptr_ok(fptr_whitelist_hash_delkeyfunc(table->delkeyfunc));
 	fptr_ok(fptr_whitelist_hash_deldatafunc(table->deldatafunc));
@@ -310,9 +443,15 @@ lruhash_insert(struct lruhash* table, hashvalue_type hash,
 	fptr_ok(fptr_whitelist_hash_markdelfunc(table->markdelfunc));
 	need_size = table->sizefunc(entry->key, data);
 	if(cb_arg == NULL) cb_arg = table->cb_arg;
+	if(table->pinfunc) {
+		fptr_ok(fptr_whitelist_hash_pinfunc(table->pinfunc));
+		pin = (*table->pinfunc)(entry->key, table->pin_arg);
+	}
 
 	/* find bin */
 	lock_quick_lock(&table->lock);
+	if(quota_id >= table->quota_num)
+		quota_id = 0;
 	bin = &table->array[hash & table->size_mask];
 	lock_quick_lock(&bin->lock);
 
@@ -321,22 +460,53 @@ lruhash_insert(struct lruhash* table, hashvalue_type hash,
 		/* if not: add to bin */
 		entry->overflow_next = bin->overflow_list;
 		bin->overflow_list = entry;
-		lru_front(table, entry);
+		entry->quota_id = quota_id;
+		quota_add(table, quota_id, need_size);
+		if(pin && pin_fits(table, need_size)) {
+			entry->pinned = 1;
+			pin_front(table, entry);
+			table->num_pinned++;
+			table->space_pinned += need_size;
+		} else {
+			entry->pinned = 0;
+			lru_front(table, entry);
+		}
 		table->num++;
 		table->space_used += need_size;
 	} else {
 		/* if so: update data - needs a writelock */
-		table->space_used += need_size -
-			(*table->sizefunc)(found->key, found->data);
+		old_size = (*table->sizefunc)(found->key, found->data);
+		table->space_used += need_size - old_size;
 		(*table->delkeyfunc)(entry->key, cb_arg);
-		lru_touch(table, found);
+		quota_sub(table, found->quota_id, old_size);
+		if(found->quota_id != quota_id) {
+			/* charged to the quota that inserts the new data */
+			if(!found->pinned)
+				lru_remove(table, found);
+			found->quota_id = quota_id;
+			if(!found->pinned)
+				lru_front(table, found);
+		}
+		quota_add(table, quota_id, need_size);
+		if(found->pinned) {
+			table->space_pinned += need_size - old_size;
+			if(!pin || (table->space_pin_max &&
+				table->space_pinned > table->space_pin_max))
+				entry_set_pin(table, found, 0, need_size);
+		} else {
+			lru_touch(table, found);
+			if(pin && pin_fits(table, need_size))
+				entry_set_pin(table, found, 1, need_size);
+		}
 		lock_rw_wrlock(&found->lock);
 		(*table->deldatafunc)(found->data, cb_arg);
 		found->data = data;
 		lock_rw_unlock(&found->lock);
 	}
 	lock_quick_unlock(&bin->lock);
-	if(table->space_used > table->space_max)
+	q = quota_list(table, quota_id);
+	if(table->space_used > table->space_max ||
+		(q && q->space_used > q->space_max))
 		reclaim_space(table, &reclaimlist);
 	if(table->num >= table->size)
 		table_grow(table);
@@ -374,11 +544,22 @@ lruhash_lookup(struct lruhash* table, hashvalue_type hash, void* key, int wr)
 	return entry;
 }
 
+void
+lruhash_lookup_batch(struct lruhash* table, hashvalue_type* hash,
+	void** key, size_t num, int wr, struct lruhash_entry** result)
+{
+	size_t i;
+	/* the entry locks are not taken while the table lock is held */
+	for(i=0; i<num; i++)
+		result[i] = lruhash_lookup(table, hash[i], key[i], wr);
+}
+
 void 
 lruhash_remove(struct lruhash* table, hashvalue_type hash, void* key)
 {
 	struct lruhash_entry* entry;
 	struct lruhash_bin* bin;
+	size_t size;
 	void *d;
 	fptr_ok(fptr_whitelist_hash_sizefunc(table->sizefunc));
 	fptr_ok(fptr_whitelist_hash_delkeyfunc(table->delkeyfunc));
@@ -391,14 +572,20 @@ lruhash_remove(struct lruhash* table, hashvalue_type hash, void* key)
 	lock_quick_lock(&bin->lock);
 	if((entry=bin_find_entry(table, bin, hash, key))) {
 		bin_overflow_remove(bin, entry);
-		lru_remove(table, entry);
+		size = (*table->sizefunc)(entry->key, entry->data);
+		if(entry->pinned) {
+			pin_remove(table, entry);
+			table->num_pinned--;
+			table->space_pinned -= size;
+		} else	lru_remove(table, entry);
 	} else {
 		lock_quick_unlock(&table->lock);
 		lock_quick_unlock(&bin->lock);
 		return;
 	}
 	table->num--;
-	table->space_used -= (*table->sizefunc)(entry->key, entry->data);
+	table->space_used -= size;
+	quota_sub(table, entry->quota_id, size);
 	lock_quick_unlock(&table->lock);
 	lock_rw_wrlock(&entry->lock);
 	if(table->markdelfunc)
@@ -450,11 +637,67 @@ lruhash_clear(struct lruhash* table)
 	}
 	table->lru_start = NULL;
 	table->lru_end = NULL;
+	table->pin_start = NULL;
 	table->num = 0;
 	table->space_used = 0;
+	table->num_pinned = 0;
+	table->space_pinned = 0;
+	for(i=1; i<table->quota_num; i++) {
+		table->quota[i].lru_start = NULL;
+		table->quota[i].lru_end = NULL;
+		table->quota[i].space_used = 0;
+	}
 	lock_quick_unlock(&table->lock);
 }
 
+/** set the pin state of the entries in a bin to pin, if the pin function
+ * agrees, caller holds hashlock and binlock */
+static void
+repin_bin(struct lruhash* table, struct lruhash_bin* bin, int pin)
+{
+	struct lruhash_entry* p;
+	size_t size;
+	for(p = bin->overflow_list; p; p = p->overflow_next) {
+		if(p->pinned == pin)
+			continue;
+		/* the key of an entry does not change while it is in the
+		 * table, the pin function only looks at the key. */
+		if((table->pinfunc && (*table->pinfunc)(p->key,
+			table->pin_arg)) != pin)
+			continue;
+		size = (*table->sizefunc)(p->key, p->data);
+		if(pin && !pin_fits(table, size))
+			continue;
+		entry_set_pin(table, p, pin, size);
+	}
+}
+
+void
+lruhash_repin(struct lruhash* table)
+{
+	size_t i;
+	int pin;
+	fptr_ok(fptr_whitelist_hash_sizefunc(table->sizefunc));
+	fptr_ok(fptr_whitelist_hash_pinfunc(table->pinfunc));
+	/* unpin first, that makes space for the entries that are pinned.
+	 * The table lock is held for one bin at a time. If the table grows
+	 * in between, the entries of the bins that are done move to bins
+	 * at the end, and are checked again. */
+	for(pin=0; pin<2; pin++) {
+		for(i=0; ; i++) {
+			lock_quick_lock(&table->lock);
+			if(i >= table->size) {
+				lock_quick_unlock(&table->lock);
+				break;
+			}
+			lock_quick_lock(&table->array[i].lock);
+			repin_bin(table, &table->array[i], pin);
+			lock_quick_unlock(&table->array[i].lock);
+			lock_quick_unlock(&table->lock);
+		}
+	}
+}
+
 void 
 lruhash_status(struct lruhash* table, const char* id, int extended)
 {
@@ -489,6 +732,27 @@ lruhash_status(struct lruhash* table, const char* id, int extended)
 	lock_quick_unlock(&table->lock);
 }
 
+void
+lruhash_chain_stats(struct lruhash* table, size_t* used, size_t* maxlen)
+{
+	size_t i;
+	lock_quick_lock(&table->lock);
+	for(i=0; i<table->size; i++) {
+		size_t here = 0;
+		struct lruhash_entry *en;
+		lock_quick_lock(&table->array[i].lock);
+		for(en = table->array[i].overflow_list; en;
+			en = en->overflow_next)
+			here++;
+		lock_quick_unlock(&table->array[i].lock);
+		if(here)
+			(*used)++;
+		if(here > *maxlen)
+			*maxlen = here;
+	}
+	lock_quick_unlock(&table->lock);
+}
+
 size_t
 lruhash_get_mem(struct lruhash* table)
 {
@@ -512,6 +776,27 @@ lruhash_get_mem(struct lruhash* table)
 	return s;
 }
 
+size_t
+lruhash_get_pinned_mem(struct lruhash* table)
+{
+	size_t s;
+	lock_quick_lock(&table->lock);
+	s = table->space_pinned;
+	lock_quick_unlock(&table->lock);
+	return s;
+}
+
+size_t
+lruhash_get_quota_mem(struct lruhash* table, uint16_t quota_id)
+{
+	size_t s = 0;
+	lock_quick_lock(&table->lock);
+	if(quota_id != 0 && quota_id < table->quota_num)
+		s = table->quota[quota_id].space_used;
+	lock_quick_unlock(&table->lock);
+	return s;
+}
+
 void 
 lruhash_setmarkdel(struct lruhash* table, lruhash_markdelfunc_type md)
 {
@@ -520,6 +805,60 @@ lruhash_setmarkdel(struct lruhash* table, lruhash_markdelfunc_type md)
 	lock_quick_unlock(&table->lock);
 }
 
+void
+lruhash_setpinfunc(struct lruhash* table, lruhash_pinfunc_type pf,
+	void* arg, size_t max)
+{
+	lock_quick_lock(&table->lock);
+	table->pinfunc = pf;
+	table->pin_arg = arg;
+	table->space_pin_max = max;
+	lock_quick_unlock(&table->lock);
+}
+
+int
+lruhash_set_quota(struct lruhash* table, size_t num, size_t* max)
+{
+	struct lruhash_quota* q = NULL, *o;
+	struct lruhash_entry* p;
+	size_t i;
+	if(num > 1) {
+		q = (struct lruhash_quota*)calloc(num, sizeof(*q));
+		if(q) {
+			for(i=1; i<num; i++)
+				q[i].space_max = max[i];
+		}
+	}
+	lock_quick_lock(&table->lock);
+	/* move the lru lists of the old quotas to the end of the table
+	 * lru list, and uncharge all entries */
+	for(i=1; i<table->quota_num; i++) {
+		o = &table->quota[i];
+		if(!o->lru_start)
+			continue;
+		o->lru_start->lru_prev = table->lru_end;
+		if(table->lru_end)
+			table->lru_end->lru_next = o->lru_start;
+		else	table->lru_start = o->lru_start;
+		table->lru_end = o->lru_end;
+	}
+	for(p = table->lru_start; p; p = p->lru_next)
+		p->quota_id = 0;
+	for(p = table->pin_start; p; p = p->lru_next)
+		p->quota_id = 0;
+	if(table->quota) {
+		lock_unprotect(&table->lock, table->quota);
+	}
+	free(table->quota);
+	table->quota = q;
+	table->quota_num = q?num:0;
+	if(q) {
+		lock_protect(&table->lock, q, num*sizeof(*q));
+	}
+	lock_quick_unlock(&table->lock);
+	return (num <= 1 || q != NULL);
+}
+
 void 
 lruhash_traverse(struct lruhash* h, int wr, 
 	void (*func)(struct lruhash_entry*, void*), void* arg)
@@ -552,24 +891,31 @@ lruhash_traverse(struct lruhash* h, int wr,
 void
 lru_demote(struct lruhash* table, struct lruhash_entry* entry)
 {
+	struct lruhash_quota* q;
+	struct lruhash_entry** start, **end;
 	log_assert(table && entry);
-	if (entry == table->lru_end)
+	if (entry->pinned)
+		return; /* nothing to do */
+	q = quota_list(table, entry->quota_id);
+	start = q?&q->lru_start:&table->lru_start;
+	end = q?&q->lru_end:&table->lru_end;
+	if (entry == *end)
 		return; /* nothing to do */
 	/* remove from current lru position */
 	lru_remove(table, entry);
 	/* add at end */
 	entry->lru_next = NULL;
-	entry->lru_prev = table->lru_end;
+	entry->lru_prev = *end;
 
-	if (table->lru_end == NULL)
+	if (*end == NULL)
 	{
-		table->lru_start = entry;
+		*start = entry;
 	}
 	else
 	{
-		table->lru_end->lru_next = entry;
+		(*end)->lru_next = entry;
 	}
-	table->lru_end = entry;
+	*end = entry;
 }
 
 struct lruhash_entry*
@@ -602,6 +948,8 @@ lruhash_insert_or_retrieve(struct lruhash* table, hashvalue_type hash,
 		/* if not: add to bin */
 		entry->overflow_next = bin->overflow_list;
 		bin->overflow_list = entry;
+		entry->pinned = 0;
+		entry->quota_id = 0;
 		lru_front(table, entry);
 		table->num++;
 		table->space_used += need_size;
@@ -141,6 +141,26 @@ typedef void (*lruhash_deldatafunc_type)(void*, void*);
  * called: func(key) */
 typedef void (*lruhash_markdelfunc_type)(void*);
 
+/** check if a key is pinned, so it is exempt from reclaim, return true
+ * if so. This function is called: func(key, pinarg) */
+typedef int (*lruhash_pinfunc_type)(void*, void*);
+
+/**
+ * Memory quota for the entries inserted on behalf of one user of the
+ * table, with an lru list of its own if the quota is set.
+ */
+struct lruhash_quota {
+	/** lru list start for entries of this quota, if space_max is set */
+	struct lruhash_entry* lru_start;
+	/** lru list end item (least recently used) */
+	struct lruhash_entry* lru_end;
+	/** the amount of space used by entries charged to this quota */
+	size_t space_used;
+	/** the amount of space the quota is allowed to use, or 0 if the
+	 * entries are not limited and kept in the table lru list. */
+	size_t space_max;
+};
+
 /**
  * Hash table that keeps LRU list of entries.
  */
@@ -157,6 +177,10 @@ struct lruhash {
 	lruhash_deldatafunc_type deldatafunc;
 	/** how to mark a key pending deletion */
 	lruhash_markdelfunc_type markdelfunc;
+	/** how to check if a key is pinned, or NULL if nothing is pinned */
+	lruhash_pinfunc_type pinfunc;
+	/** user argument for the pin function */
+	void* pin_arg;
 	/** user argument for user functions */
 	void* cb_arg;
 
@@ -171,6 +195,9 @@ struct lruhash {
 	struct lruhash_entry* lru_start;
 	/** lru list end item (least recently used) */
 	struct lruhash_entry* lru_end;
+	/** list of pinned entries, that are not in the lru list and are
+	 * never reclaimed. Linked with the lru_next, lru_prev pointers. */
+	struct lruhash_entry* pin_start;
 
 	/** the number of entries in the hash table. */
 	size_t num;
@@ -178,6 +205,18 @@ struct lruhash {
 	size_t space_used;
 	/** the amount of space the hash table is maximally allowed to use. */
 	size_t space_max;
+	/** the number of pinned entries. */
+	size_t num_pinned;
+	/** the amount of space used by pinned entries, part of space_used. */
+	size_t space_pinned;
+	/** the amount of space pinned entries may use, or 0 if not limited.
+	 * Entries that do not fit are kept in the lru list. */
+	size_t space_pin_max;
+	/** the quotas, indexed by quota id, entry 0 is unused; quota id 0
+	 * is the table itself. NULL if there are no quotas. */
+	struct lruhash_quota* quota;
+	/** the number of elements in the quota array. */
+	size_t quota_num;
 };
 
 /**
@@ -214,6 +253,13 @@ struct lruhash_entry {
 	struct lruhash_entry* lru_next;
 	/** prev entry in lru chain. covered by hashlock. */
 	struct lruhash_entry* lru_prev;
+	/** if the entry is pinned; it is in the pin list and not in the lru
+	 * list, and it is exempt from reclaim. covered by hashlock. */
+	uint8_t pinned;
+	/** the quota the entry is charged to, 0 for none. If the quota has
+	 * a maximum, the entry is in the lru list of the quota and not in
+	 * the lru list of the table. covered by hashlock. */
+	uint16_t quota_id;
 	/** hash value of the key. It may not change, until entry deleted. */
 	hashvalue_type hash;
 	/** key */
@@ -272,6 +318,31 @@ void lruhash_clear(struct lruhash* table);
 void lruhash_insert(struct lruhash* table, hashvalue_type hash, 
 	struct lruhash_entry* entry, void* data, void* cb_override);
 
+/**
+ * Insert a new element into the hashtable, like lruhash_insert, and
+ * charge it to a quota. Entries of a quota that is over its maximum are
+ * reclaimed first, but never the entry that is inserted.
+ * @param table: hash table.
+ * @param hash: hash value. User calculates the hash.
+ * @param entry: identifies the entry.
+ * @param data: the data.
+ * @param cb_override: if not null overrides the cb_arg for the deletefunc.
+ * @param quota_id: the quota to charge, 0 for none. Ids that are not
+ *	set up with lruhash_set_quota are not charged.
+ */
+void lruhash_insert_quota(struct lruhash* table, hashvalue_type hash, 
+	struct lruhash_entry* entry, void* data, void* cb_override,
+	uint16_t quota_id);
+
+/**
+ * Check the pin function again for every entry in the table, after
+ * the set of pinned keys has changed. Entries that are no longer pinned
+ * are put at the front of the LRU.
+ * @param table: hash table. It is locked for one bin at a time, so other
+ *	threads can use the table while it is walked.
+ */
+void lruhash_repin(struct lruhash* table);
+
 /**
  * Lookup an entry in the hashtable.
  * At the end of the function you hold a (read/write)lock on the entry.
@@ -288,6 +359,22 @@ void lruhash_insert(struct lruhash* table, hashvalue_type hash,
 struct lruhash_entry* lruhash_lookup(struct lruhash* table,
 	hashvalue_type hash, void* key, int wr);
 
+/**
+ * Lookup several entries in the hashtable, with lruhash_lookup for each,
+ * so the table lock is released before the entry lock is taken.
+ * At the end of the function you hold a (read/write)lock on every entry
+ * that is found, unlock them quickly.  A key must not be in the array
+ * twice if wr is set.
+ * @param table: hash table.
+ * @param hash: array with the hash of every key.
+ * @param key: array with the keys.
+ * @param num: number of keys.
+ * @param wr: set to true if you desire a writelock on the entries.
+ * @param result: array of num, set to the locked entry or NULL.
+ */
+void lruhash_lookup_batch(struct lruhash* table, hashvalue_type* hash,
+	void** key, size_t num, int wr, struct lruhash_entry** result);
+
 /**
  * Touch entry, so it becomes the most recently used in the LRU list.
  * Caller must hold hash table lock. The entry must be inserted already.
@@ -301,6 +388,31 @@ void lru_touch(struct lruhash* table, struct lruhash_entry* entry);
  */
 void lruhash_setmarkdel(struct lruhash* table, lruhash_markdelfunc_type md);
 
+/**
+ * Set the pin function, that is called on insert to see if the entry is
+ * pinned. Pinned entries are not in the LRU list and are not reclaimed.
+ * There may be no threading or use by other threads.
+ * @param table: hash table.
+ * @param pf: pin function ptr, or NULL.
+ * @param arg: user argument for the pin function.
+ * @param max: the space pinned entries may use, 0 for no limit.
+ */
+void lruhash_setpinfunc(struct lruhash* table, lruhash_pinfunc_type pf,
+	void* arg, size_t max);
+
+/**
+ * Set the quotas. Entries that are in the table are no longer charged to
+ * a quota, and entries on the lru list of a quota are moved to the end
+ * of the table lru list.
+ * @param table: hash table. Will be locked before use. And unlocked after.
+ * @param num: number of quota ids, including the unused id 0. If 0 or 1,
+ *	the quotas are removed.
+ * @param max: array of num with the maximum space for every quota id,
+ *	0 if the quota is only counted and not limited.
+ * @return false on malloc failure, the quotas are removed.
+ */
+int lruhash_set_quota(struct lruhash* table, size_t num, size_t* max);
+
 /************************* getdns functions ************************/
 /*** these are used by getdns only and not by unbound. ***/
 
@@ -426,6 +538,16 @@ void lru_remove(struct lruhash* table, struct lruhash_entry* entry);
  */
 void lruhash_status(struct lruhash* table, const char* id, int extended);
 
+/**
+ * Get statistics on the length of the overflow chains in the bins, to
+ * see how well the hash function spreads the entries.
+ * @param table: hash table. Will be locked before use. And unlocked after.
+ * @param used: number of bins that are not empty is added to this.
+ * @param maxlen: set to the longest chain, if that is longer.
+ */
+void lruhash_chain_stats(struct lruhash* table, size_t* used,
+	size_t* maxlen);
+
 /**
  * Get memory in use now by the lruhash table.
  * @param table: hash table. Will be locked before use. And unlocked after.
@@ -433,6 +555,21 @@ void lruhash_status(struct lruhash* table, const char* id, int extended);
  */
 size_t lruhash_get_mem(struct lruhash* table);
 
+/**
+ * Get memory in use by the pinned entries of the lruhash table.
+ * @param table: hash table. Will be locked before use. And unlocked after.
+ * @return size in bytes.
+ */
+size_t lruhash_get_pinned_mem(struct lruhash* table);
+
+/**
+ * Get memory in use by the entries charged to a quota.
+ * @param table: hash table. Will be locked before use. And unlocked after.
+ * @param quota_id: the quota id.
+ * @return size in bytes, 0 if the quota does not exist.
+ */
+size_t lruhash_get_quota_mem(struct lruhash* table, uint16_t quota_id);
+
 /**
  * Traverse a lruhash. Call back for every element in the table.
  * @param h: hash table.  Locked before use.
@@ -0,0 +1,237 @@
+/*
+ * util/storage/siphash.c - keyed hash function for the caches.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains SipHash-1-3, with a random per process seed, for
+ * the hash tables, and SipHash-2-4 with a given key.  SipHash is by
+ * Jean-Philippe Aumasson and Daniel J. Bernstein.
+ */
+
+#include "config.h"
+#include "util/storage/siphash.h"
+
+/** the seed, it is set to random values at startup */
+static uint64_t sip_k0 = (uint64_t)0x736f6d6570736575ULL;
+/** the second half of the seed */
+static uint64_t sip_k1 = (uint64_t)0x646f72616e646f6dULL;
+
+/** rotate left */
+#define ROTL(x, b) (uint64_t)(((x) << (b)) | ((x) >> (64 - (b))))
+
+/** one SipRound */
+#define SIPROUND(v0, v1, v2, v3) do { \
+	v0 += v1; v1 = ROTL(v1, 13); v1 ^= v0; v0 = ROTL(v0, 32); \
+	v2 += v3; v3 = ROTL(v3, 16); v3 ^= v2; \
+	v0 += v3; v3 = ROTL(v3, 21); v3 ^= v0; \
+	v2 += v1; v1 = ROTL(v1, 17); v1 ^= v2; v2 = ROTL(v2, 32); \
+	} while(0)
+
+/** read 8 bytes as little endian */
+static uint64_t
+sip_load(const uint8_t* p)
+{
+	return ((uint64_t)p[0]) | ((uint64_t)p[1] << 8) |
+		((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+		((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) |
+		((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
+
+/** lowercase the ASCII uppercase bytes in the word, 8 at a time */
+static uint64_t
+sip_lower(uint64_t x)
+{
+	const uint64_t ones = (uint64_t)0x0101010101010101ULL;
+	const uint64_t high = (uint64_t)0x8080808080808080ULL;
+	uint64_t t = x & ~high;
+	/* high bit set in bytes >= 'A', and in bytes > 'Z' */
+	uint64_t ge_a = t + (0x80 - 'A')*ones;
+	uint64_t gt_z = t + (0x80 - 'Z' - 1)*ones;
+	/* not for bytes that had the high bit set to start with */
+	uint64_t upper = ge_a & ~gt_z & ~x & high;
+	return x | (upper >> 2);
+}
+
+/** hash one word of message into the state */
+static void
+sip_compress(struct siphash_state* s, uint64_t m)
+{
+	uint64_t v0 = s->v0, v1 = s->v1, v2 = s->v2, v3 = s->v3;
+	v3 ^= m;
+	SIPROUND(v0, v1, v2, v3);
+	v0 ^= m;
+	s->v0 = v0; s->v1 = v1; s->v2 = v2; s->v3 = v3;
+}
+
+void
+siphash_set_seed(const uint8_t* seed)
+{
+	sip_k0 = sip_load(seed);
+	sip_k1 = sip_load(seed+8);
+}
+
+void
+siphash_init(struct siphash_state* s, uint32_t initval)
+{
+	uint64_t k0 = sip_k0 ^ (uint64_t)initval;
+	s->v0 = (uint64_t)0x736f6d6570736575ULL ^ k0;
+	s->v1 = (uint64_t)0x646f72616e646f6dULL ^ sip_k1;
+	s->v2 = (uint64_t)0x6c7967656e657261ULL ^ k0;
+	s->v3 = (uint64_t)0x7465646279746573ULL ^ sip_k1;
+	s->len = 0;
+}
+
+/** copy bytes into the tail, lowercased or not */
+static void
+sip_tailcopy(uint8_t* dst, const uint8_t* src, size_t n, int lower)
+{
+	size_t i;
+	if(!lower) {
+		memcpy(dst, src, n);
+		return;
+	}
+	for(i=0; i<n; i++)
+		dst[i] = (src[i] >= 'A' && src[i] <= 'Z')?src[i]+0x20:src[i];
+}
+
+/** hash data, lowercased or not */
+static void
+sip_update(struct siphash_state* s, const uint8_t* p, size_t len, int lower)
+{
+	size_t have = s->len & 7;
+	s->len += len;
+	if(have) {
+		/* fill up the tail first */
+		size_t n = 8 - have;
+		if(n > len) {
+			sip_tailcopy(s->tail+have, p, len, lower);
+			return;
+		}
+		sip_tailcopy(s->tail+have, p, n, lower);
+		p += n;
+		len -= n;
+		sip_compress(s, sip_load(s->tail));
+	}
+	if(lower) {
+		for(; len >= 8; p += 8, len -= 8)
+			sip_compress(s, sip_lower(sip_load(p)));
+	} else {
+		for(; len >= 8; p += 8, len -= 8)
+			sip_compress(s, sip_load(p));
+	}
+	if(len)
+		sip_tailcopy(s->tail, p, len, lower);
+}
+
+void
+siphash_update(struct siphash_state* s, const void* k, size_t len)
+{
+	sip_update(s, (const uint8_t*)k, len, 0);
+}
+
+void
+siphash_update_lower(struct siphash_state* s, const uint8_t* k, size_t len)
+{
+	sip_update(s, k, len, 1);
+}
+
+uint32_t
+siphash_final(struct siphash_state* s)
+{
+	size_t have = s->len & 7;
+	uint64_t b;
+	/* the tail is lowercase already if needed */
+	memset(s->tail+have, 0, 8-have);
+	b = sip_load(s->tail) | ((uint64_t)s->len << 56);
+	sip_compress(s, b);
+	s->v2 ^= 0xff;
+	SIPROUND(s->v0, s->v1, s->v2, s->v3);
+	SIPROUND(s->v0, s->v1, s->v2, s->v3);
+	SIPROUND(s->v0, s->v1, s->v2, s->v3);
+	b = s->v0 ^ s->v1 ^ s->v2 ^ s->v3;
+	return (uint32_t)(b ^ (b >> 32));
+}
+
+uint32_t
+siphash_hash(const void* k, size_t length, uint32_t initval)
+{
+	struct siphash_state s;
+	siphash_init(&s, initval);
+	siphash_update(&s, k, length);
+	return siphash_final(&s);
+}
+
+uint32_t
+siphash_hash_lower(const uint8_t* k, size_t length, uint32_t initval)
+{
+	struct siphash_state s;
+	siphash_init(&s, initval);
+	siphash_update_lower(&s, k, length);
+	return siphash_final(&s);
+}
+
+uint64_t
+siphash24(const uint8_t* key, const void* k, size_t length)
+{
+	const uint8_t* p = (const uint8_t*)k;
+	uint64_t k0 = sip_load(key), k1 = sip_load(key+8), m;
+	uint64_t v0 = (uint64_t)0x736f6d6570736575ULL ^ k0;
+	uint64_t v1 = (uint64_t)0x646f72616e646f6dULL ^ k1;
+	uint64_t v2 = (uint64_t)0x6c7967656e657261ULL ^ k0;
+	uint64_t v3 = (uint64_t)0x7465646279746573ULL ^ k1;
+	uint8_t tail[8];
+	size_t left = length;
+	for(; left >= 8; p += 8, left -= 8) {
+		m = sip_load(p);
+		v3 ^= m;
+		SIPROUND(v0, v1, v2, v3);
+		SIPROUND(v0, v1, v2, v3);
+		v0 ^= m;
+	}
+	memset(tail, 0, sizeof(tail));
+	memcpy(tail, p, left);
+	m = sip_load(tail) | ((uint64_t)length << 56);
+	v3 ^= m;
+	SIPROUND(v0, v1, v2, v3);
+	SIPROUND(v0, v1, v2, v3);
+	v0 ^= m;
+	v2 ^= 0xff;
+	SIPROUND(v0, v1, v2, v3);
+	SIPROUND(v0, v1, v2, v3);
+	SIPROUND(v0, v1, v2, v3);
+	SIPROUND(v0, v1, v2, v3);
+	return v0 ^ v1 ^ v2 ^ v3;
+}
@@ -0,0 +1,140 @@
+/*
+ * util/storage/siphash.h - keyed hash function for the caches.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the keyed hash function that the caches use for
+ * names and query keys.  It is SipHash-1-3, keyed with a random per
+ * process seed, so that the bins of the hash tables can not be attacked
+ * with crafted collisions.  Names can be hashed case insensitive, that
+ * lowercases 8 bytes at a time.
+ *
+ * There is also the standard SipHash-2-4 with a key of the caller, for
+ * keyed message authentication, such as the DNS server cookies.
+ */
+
+#ifndef UTIL_STORAGE_SIPHASH_H
+#define UTIL_STORAGE_SIPHASH_H
+
+/** size of the hash seed in bytes */
+#define SIPHASH_SEEDSIZE 16
+/** size of the siphash24 key in bytes */
+#define SIPHASH24_KEYSIZE 16
+
+/**
+ * Incremental hash state, so that data in pieces, such as a compressed
+ * name in a packet, hashes the same as the same data in one piece.
+ */
+struct siphash_state {
+	/** the internal state words */
+	uint64_t v0, v1, v2, v3;
+	/** bytes not yet hashed, less than 8 */
+	uint8_t tail[8];
+	/** total length of the data */
+	size_t len;
+};
+
+/**
+ * Set the per process seed, set this before threads start, and before
+ * hashing stuff (because it changes subsequent results).
+ * @param seed: SIPHASH_SEEDSIZE random bytes.
+ */
+void siphash_set_seed(const uint8_t* seed);
+
+/**
+ * Start hashing data.
+ * @param s: state to initialise.
+ * @param initval: the previous hash, or an arbitrary value.
+ */
+void siphash_init(struct siphash_state* s, uint32_t initval);
+
+/**
+ * Hash more data.
+ * @param s: the state.
+ * @param k: the data.
+ * @param len: length of the data.
+ */
+void siphash_update(struct siphash_state* s, const void* k, size_t len);
+
+/**
+ * Hash more data, ASCII uppercase is hashed as lowercase.  This works
+ * on a wireformat name, with the label lengths, because they are never
+ * in the uppercase range.
+ * @param s: the state.
+ * @param k: the data.
+ * @param len: length of the data.
+ */
+void siphash_update_lower(struct siphash_state* s, const uint8_t* k,
+	size_t len);
+
+/**
+ * Finish the hash.
+ * @param s: the state.
+ * @return: hash value.
+ */
+uint32_t siphash_final(struct siphash_state* s);
+
+/**
+ * Hash key data, in one go.
+ * @param k: the key.
+ * @param length: the length of the key.
+ * @param initval: the previous hash, or an arbitrary value.
+ * @return: hash value.
+ */
+uint32_t siphash_hash(const void* k, size_t length, uint32_t initval);
+
+/**
+ * Hash key data, in one go, case insensitive.
+ * @param k: the key, a wireformat name.
+ * @param length: the length of the key.
+ * @param initval: the previous hash, or an arbitrary value.
+ * @return: hash value.
+ */
+uint32_t siphash_hash_lower(const uint8_t* k, size_t length,
+	uint32_t initval);
+
+/**
+ * The standard SipHash-2-4, with the 64 bit output, and a given key.
+ * It does not use the per process seed.
+ * @param key: SIPHASH24_KEYSIZE bytes of key.
+ * @param k: the data.
+ * @param length: length of the data.
+ * @return: the hash value, put it in wireformat little endian for the
+ *	byte string of the reference implementation.
+ */
+uint64_t siphash24(const uint8_t* key, const void* k, size_t length);
+
+#endif /* UTIL_STORAGE_SIPHASH_H */
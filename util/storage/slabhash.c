@@ -119,12 +119,36 @@ void slabhash_insert(struct slabhash* sl, hashvalue_type hash,
 	lruhash_insert(sl->array[slab_idx(sl, hash)], hash, entry, data, arg);
 }
 
+void slabhash_insert_quota(struct slabhash* sl, hashvalue_type hash, 
+	struct lruhash_entry* entry, void* data, void* arg, uint16_t quota_id)
+{
+	lruhash_insert_quota(sl->array[slab_idx(sl, hash)], hash, entry, data,
+		arg, quota_id);
+}
+
+void slabhash_repin(struct slabhash* sl)
+{
+	size_t i;
+	for(i=0; i<sl->size; i++)
+		lruhash_repin(sl->array[i]);
+}
+
 struct lruhash_entry* slabhash_lookup(struct slabhash* sl, 
 	hashvalue_type hash, void* key, int wr)
 {
 	return lruhash_lookup(sl->array[slab_idx(sl, hash)], hash, key, wr);
 }
 
+void slabhash_lookup_batch(struct slabhash* sl, hashvalue_type* hash,
+	void** key, size_t num, int wr, struct lruhash_entry** result)
+{
+	size_t i;
+	log_assert(num <= SLABHASH_BATCH_MAX);
+	for(i=0; i<num; i++)
+		result[i] = lruhash_lookup(sl->array[slab_idx(sl, hash[i])],
+			hash[i], key[i], wr);
+}
+
 void slabhash_remove(struct slabhash* sl, hashvalue_type hash, void* key)
 {
 	lruhash_remove(sl->array[slab_idx(sl, hash)], hash, key);
@@ -163,6 +187,39 @@ size_t slabhash_get_mem(struct slabhash* sl)
 	return total;
 }
 
+size_t slabhash_get_pinned_mem(struct slabhash* sl)
+{	
+	size_t i, total = 0;
+	for(i=0; i<sl->size; i++) {
+		total += lruhash_get_pinned_mem(sl->array[i]);
+	}
+	return total;
+}
+
+size_t slabhash_get_quota_mem(struct slabhash* sl, uint16_t quota_id)
+{	
+	size_t i, total = 0;
+	for(i=0; i<sl->size; i++) {
+		total += lruhash_get_quota_mem(sl->array[i], quota_id);
+	}
+	return total;
+}
+
+void slabhash_chain_stats(struct slabhash* sl, size_t* bins, size_t* used,
+	size_t* maxlen)
+{
+	size_t i;
+	*bins = 0;
+	*used = 0;
+	*maxlen = 0;
+	for(i=0; i<sl->size; i++) {
+		lock_quick_lock(&sl->array[i]->lock);
+		*bins += sl->array[i]->size;
+		lock_quick_unlock(&sl->array[i]->lock);
+		lruhash_chain_stats(sl->array[i], used, maxlen);
+	}
+}
+
 struct lruhash* slabhash_gettable(struct slabhash* sl, hashvalue_type hash)
 {
 	return sl->array[slab_idx(sl, hash)];
@@ -202,6 +259,11 @@ void test_slabhash_deldata(void* data, void* ATTR_UNUSED(arg))
 	deldata((struct slabhash_testdata*)data);
 }
 
+int test_slabhash_pinfunc(void* key, void* arg)
+{
+	return ((struct slabhash_testkey*)key)->id < *(int*)arg;
+}
+
 void slabhash_setmarkdel(struct slabhash* sl, lruhash_markdelfunc_type md)
 {
 	size_t i;
@@ -210,6 +272,46 @@ void slabhash_setmarkdel(struct slabhash* sl, lruhash_markdelfunc_type md)
 	}
 }
 
+void slabhash_setpinfunc(struct slabhash* sl, lruhash_pinfunc_type pf,
+	void* arg, size_t max)
+{
+	size_t i, slabmax = 0;
+	/* every slab gets its share of the pinned space */
+	if(max != 0) {
+		slabmax = max/sl->size;
+		if(slabmax == 0)
+			slabmax = 1;
+	}
+	for(i=0; i<sl->size; i++) {
+		lruhash_setpinfunc(sl->array[i], pf, arg, slabmax);
+	}
+}
+
+int slabhash_set_quota(struct slabhash* sl, size_t num, size_t* max)
+{
+	size_t i, *slabmax = NULL;
+	int r = 1;
+	if(num > 1) {
+		/* every slab gets its share of the quota */
+		slabmax = (size_t*)calloc(num, sizeof(size_t));
+		if(!slabmax)
+			return 0;
+		for(i=1; i<num; i++) {
+			if(max[i] == 0)
+				continue;
+			slabmax[i] = max[i]/sl->size;
+			if(slabmax[i] == 0)
+				slabmax[i] = 1;
+		}
+	}
+	for(i=0; i<sl->size; i++) {
+		if(!lruhash_set_quota(sl->array[i], num, slabmax))
+			r = 0;
+	}
+	free(slabmax);
+	return r;
+}
+
 void slabhash_traverse(struct slabhash* sh, int wr,
 	void (*func)(struct lruhash_entry*, void*), void* arg)
 {
@@ -47,6 +47,8 @@
 
 /** default number of slabs */
 #define HASH_DEFAULT_SLABS 4
+/** max number of keys for a slabhash_lookup_batch */
+#define SLABHASH_BATCH_MAX 32
 
 /**
  * Hash table formed from several smaller ones. 
@@ -112,6 +114,27 @@ void slabhash_clear(struct slabhash* table);
 void slabhash_insert(struct slabhash* table, hashvalue_type hash, 
 	struct lruhash_entry* entry, void* data, void* cb_override);
 
+/**
+ * Insert a new element into the hashtable and charge it to a quota,
+ * uses lruhash_insert_quota.
+ * @param table: hash table.
+ * @param hash: hash value. User calculates the hash.
+ * @param entry: identifies the entry.
+ * @param data: the data.
+ * @param cb_override: if not NULL overrides the cb_arg for deletfunc.
+ * @param quota_id: the quota to charge, 0 for none.
+ */
+void slabhash_insert_quota(struct slabhash* table, hashvalue_type hash, 
+	struct lruhash_entry* entry, void* data, void* cb_override,
+	uint16_t quota_id);
+
+/**
+ * Check the pin state of every entry again, after the pinned keys have
+ * changed. Uses lruhash_repin for every slab.
+ * @param table: hash table.
+ */
+void slabhash_repin(struct slabhash* table);
+
 /**
  * Lookup an entry in the hashtable. Uses lruhash_lookup.
  * At the end of the function you hold a (read/write)lock on the entry.
@@ -128,6 +151,59 @@ void slabhash_insert(struct slabhash* table, hashvalue_type hash,
 struct lruhash_entry* slabhash_lookup(struct slabhash* table, 
 	hashvalue_type hash, void* key, int wr);
 
+/**
+ * Define a lookup function for a hashtable with a compare function that is
+ * known at compile time.  It works like slabhash_lookup, but it calls the
+ * compare function directly, so the compiler can inline it, and there is
+ * no function pointer to check against the whitelist.
+ * Put it in the file that defines the compare function, and declare the
+ * function in the header.  Put static in front of it for a local function.
+ * @param name: the name of the function, it has the arguments and return
+ *	value of slabhash_lookup.
+ * @param tablecmp: the compare function of the table, the table is
+ *	checked for it in debug builds.
+ * @param cmp: the (static inline) function that tablecmp calls to compare,
+ *	it is called in the lookup loop.
+ */
+#define SLABHASH_LOOKUP_FUNC(name, tablecmp, cmp) \
+struct lruhash_entry* \
+name(struct slabhash* sl, hashvalue_type hash, void* key, int wr) \
+{ \
+	struct lruhash* table = sl->array[(hash & sl->mask) >> sl->shift]; \
+	struct lruhash_entry* entry; \
+	struct lruhash_bin* bin; \
+	log_assert(table->compfunc == &tablecmp); \
+	lock_quick_lock(&table->lock); \
+	bin = &table->array[hash & table->size_mask]; \
+	lock_quick_lock(&bin->lock); \
+	for(entry = bin->overflow_list; entry; entry = entry->overflow_next) \
+		if(entry->hash == hash && cmp(entry->key, key) == 0) \
+			break; \
+	if(entry) \
+		lru_touch(table, entry); \
+	lock_quick_unlock(&table->lock); \
+	if(entry) { \
+		if(wr)	{ lock_rw_wrlock(&entry->lock); } \
+		else	{ lock_rw_rdlock(&entry->lock); } \
+	} \
+	lock_quick_unlock(&bin->lock); \
+	return entry; \
+}
+
+/**
+ * Lookup several entries in the hashtable, like slabhash_lookup for each.
+ * At the end of the function you hold a (read/write)lock on every entry
+ * that is found, unlock them quickly.
+ * @param table: hash table.
+ * @param hash: array with the hash of every key.
+ * @param key: array with the keys.
+ * @param num: number of keys, at most SLABHASH_BATCH_MAX.
+ * @param wr: set to true if you desire a writelock on the entries.
+ * @param result: array of num, set to the locked entry or NULL.
+ */
+void slabhash_lookup_batch(struct slabhash* table, hashvalue_type* hash,
+	void** key, size_t num, int wr, struct lruhash_entry** result);
+
 /**
  * Remove entry from hashtable. Does nothing if not found in hashtable.
  * Delfunc is called for the entry. Uses lruhash_remove.
@@ -159,6 +235,32 @@ size_t slabhash_get_size(struct slabhash* table);
  */
 size_t slabhash_get_mem(struct slabhash* table);
 
+/**
+ * Retrieve slab hash memory in use by pinned entries.
+ * @param table: hash table.
+ * @return memory in use by pinned entries.
+ */
+size_t slabhash_get_pinned_mem(struct slabhash* table);
+
+/**
+ * Retrieve slab hash memory in use by the entries charged to a quota.
+ * @param table: hash table.
+ * @param quota_id: the quota id.
+ * @return memory in use by the entries of the quota.
+ */
+size_t slabhash_get_quota_mem(struct slabhash* table, uint16_t quota_id);
+
+/**
+ * Get statistics on the length of the overflow chains in the bins of
+ * all the tables.
+ * @param table: hash table.
+ * @param bins: set to the total number of bins.
+ * @param used: set to the number of bins that are not empty.
+ * @param maxlen: set to the longest chain.
+ */
+void slabhash_chain_stats(struct slabhash* table, size_t* bins,
+	size_t* used, size_t* maxlen);
+
 /**
  * Get lruhash table for a given hash value
  * @param table: slabbed hash table.
@@ -174,6 +276,28 @@ struct lruhash* slabhash_gettable(struct slabhash* table, hashvalue_type hash);
  */
 void slabhash_setmarkdel(struct slabhash* table, lruhash_markdelfunc_type md);
 
+/**
+ * Set pin function, pinned entries are not reclaimed.
+ * @param table: slabbed hash table.
+ * @param pf: pin function ptr, or NULL.
+ * @param arg: user argument for the pin function.
+ * @param max: the space pinned entries may use in the whole table, every
+ *	slab gets a part of it, 0 for no limit.
+ */
+void slabhash_setpinfunc(struct slabhash* table, lruhash_pinfunc_type pf,
+	void* arg, size_t max);
+
+/**
+ * Set the quotas, every slab gets a part of the maximum.
+ * Uses lruhash_set_quota for every slab.
+ * @param table: slabbed hash table.
+ * @param num: number of quota ids, including the unused id 0.
+ * @param max: array of num with the maximum space for every quota id
+ *	for the whole table, or 0 for no maximum.
+ * @return false on malloc failure.
+ */
+int slabhash_set_quota(struct slabhash* table, size_t num, size_t* max);
+
 /**
  * Traverse a slabhash.
  * @param table: slabbed hash table.
@@ -213,6 +337,8 @@ int test_slabhash_compfunc(void*, void*);
 void test_slabhash_delkey(void*, void*);
 /** test deldata for lruhash */
 void test_slabhash_deldata(void*, void*);
+/** test pinfunc for lruhash, pins ids below the int that arg points to */
+int test_slabhash_pinfunc(void*, void*);
 /* --- end test representation --- */
 
 #endif /* UTIL_STORAGE_SLABHASH_H */
@@ -0,0 +1,878 @@
+/*
+ * util/xdp.c - AF_XDP sockets for the UDP fast path.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the AF_XDP sockets for the UDP fast path, the XDP
+ * program that redirects the DNS packets to them, and the parsing and
+ * building of the ethernet frames.
+ */
+#include "config.h"
+#include "util/xdp.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
+#ifdef USE_XDP
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <net/if.h>
+#include <linux/if_xdp.h>
+#include <linux/if_link.h>
+#include <linux/bpf.h>
+#endif
+
+/** ethertype of IPv4 */
+#define XDP_ETH_IP4 0x0800
+/** ethertype of IPv6 */
+#define XDP_ETH_IP6 0x86dd
+
+/** read a 16 bit value in network order */
+#define XDP_GET16(p) ((uint16_t)(((p)[0]<<8) | (p)[1]))
+/** write a 16 bit value in network order */
+#define XDP_PUT16(p, v) do { (p)[0] = (uint8_t)((v)>>8); \
+	(p)[1] = (uint8_t)(v); } while(0)
+
+int
+xdp_parse_pkt(uint8_t* data, size_t len, int port, struct xdp_pkt* pkt)
+{
+	uint8_t* ip, *udp;
+	size_t iplen, udplen;
+	if(len < XDP_ETH_HDR)
+		return 0;
+	memmove(pkt->eth, data, sizeof(pkt->eth));
+	ip = data + XDP_ETH_HDR;
+	len -= XDP_ETH_HDR;
+	memset(&pkt->client, 0, sizeof(pkt->client));
+	if(XDP_GET16(data+12) == XDP_ETH_IP4) {
+		struct sockaddr_in* sin = (struct sockaddr_in*)&pkt->client;
+		size_t ihl;
+		if(len < 20 || (ip[0]>>4) != 4)
+			return 0;
+		ihl = (size_t)(ip[0]&0x0f)*4;
+		iplen = XDP_GET16(ip+2);
+		/* no fragments, the IP header and UDP header present */
+		if(ip[9] != IPPROTO_UDP || ihl < 20 || (ip[6]&0x3f) != 0
+			|| ip[7] != 0 || iplen < ihl+8 || iplen > len)
+			return 0;
+		udp = ip + ihl;
+		iplen -= ihl;
+		sin->sin_family = AF_INET;
+		memmove(&sin->sin_addr, ip+12, 4);
+		memmove(&sin->sin_port, udp, 2);
+		pkt->clientlen = (socklen_t)sizeof(*sin);
+		memmove(pkt->local, ip+16, 4);
+	} else if(XDP_GET16(data+12) == XDP_ETH_IP6) {
+		struct sockaddr_in6* sin6 = (struct sockaddr_in6*)&pkt->client;
+		if(len < 40+8 || (ip[0]>>4) != 6 || ip[6] != IPPROTO_UDP)
+			return 0;
+		iplen = XDP_GET16(ip+4);
+		if(iplen < 8 || iplen > len-40)
+			return 0;
+		udp = ip + 40;
+		sin6->sin6_family = AF_INET6;
+		memmove(&sin6->sin6_addr, ip+8, 16);
+		memmove(&sin6->sin6_port, udp, 2);
+		pkt->clientlen = (socklen_t)sizeof(*sin6);
+		memmove(pkt->local, ip+24, 16);
+	} else {
+		return 0;
+	}
+	udplen = XDP_GET16(udp+4);
+	if(udplen < 8 || udplen > iplen || XDP_GET16(udp+2) != port)
+		return 0;
+	pkt->payload = udp + 8;
+	pkt->len = udplen - 8;
+	return 1;
+}
+
+size_t
+xdp_hdr_len(int family)
+{
+	if(family == AF_INET6)
+		return XDP_ETH_HDR + 40 + 8;
+	return XDP_ETH_HDR + 20 + 8;
+}
+
+/** add data to the internet checksum */
+static uint32_t
+xdp_csum_add(uint32_t sum, uint8_t* p, size_t len)
+{
+	while(len > 1) {
+		sum += XDP_GET16(p);
+		p += 2;
+		len -= 2;
+	}
+	if(len)
+		sum += (uint32_t)p[0]<<8;
+	return sum;
+}
+
+/** fold the internet checksum */
+static uint16_t
+xdp_csum_fold(uint32_t sum)
+{
+	while(sum>>16)
+		sum = (sum&0xffff) + (sum>>16);
+	return (uint16_t)~sum;
+}
+
+/**
+ * Truncate a DNS reply to the header and question, with the TC flag.
+ * @param dns: the reply.
+ * @param len: length of the reply that is present.
+ * @param max: the maximum length.
+ * @return the new length.
+ */
+static size_t
+xdp_truncate(uint8_t* dns, size_t len, size_t max)
+{
+	size_t pos = LDNS_HEADER_SIZE;
+	uint16_t qd = LDNS_QDCOUNT(dns);
+	if(qd == 1) {
+		while(pos < len && dns[pos] != 0) {
+			if((dns[pos]&0xc0))
+				break;
+			pos += (size_t)dns[pos]+1;
+		}
+		if(pos < len && dns[pos] == 0)
+			pos += 1 + 4;
+		else	pos = len+1;
+	}
+	if(qd != 1 || pos > len || pos > max) {
+		pos = LDNS_HEADER_SIZE;
+		qd = 0;
+	}
+	sldns_write_uint16(dns+LDNS_QDCOUNT_OFF, qd);
+	sldns_write_uint16(dns+LDNS_ANCOUNT_OFF, 0);
+	sldns_write_uint16(dns+LDNS_NSCOUNT_OFF, 0);
+	sldns_write_uint16(dns+LDNS_ARCOUNT_OFF, 0);
+	LDNS_TC_SET(dns);
+	return pos;
+}
+
+size_t
+xdp_build_reply(uint8_t* frame, size_t room, int mtu, struct xdp_pkt* pkt,
+	int port, size_t len)
+{
+	int family = (int)pkt->client.ss_family;
+	size_t hl = xdp_hdr_len(family);
+	size_t iphl = hl - XDP_ETH_HDR - 8;
+	size_t max, udplen;
+	uint8_t* ip = frame + XDP_ETH_HDR, *udp = frame + hl - 8;
+	uint32_t sum;
+	if(room < hl + LDNS_HEADER_SIZE || (mtu > 0 &&
+		(size_t)mtu < iphl + 8 + LDNS_HEADER_SIZE))
+		return 0;
+	max = room - hl;
+	if(mtu > 0 && (size_t)mtu - iphl - 8 < max)
+		max = (size_t)mtu - iphl - 8;
+	if(len < LDNS_HEADER_SIZE)
+		return 0;
+	if(len > max)
+		len = xdp_truncate(frame+hl, (len<room-hl?len:room-hl), max);
+	udplen = len + 8;
+
+	/* the ethernet header, source and destination swapped */
+	memmove(frame, pkt->eth+6, 6);
+	memmove(frame+6, pkt->eth, 6);
+	XDP_PUT16(frame+12, (family==AF_INET6?XDP_ETH_IP6:XDP_ETH_IP4));
+
+	XDP_PUT16(udp, port);
+	if(family == AF_INET6)
+		memmove(udp+2, &((struct sockaddr_in6*)&pkt->client)->
+			sin6_port, 2);
+	else	memmove(udp+2, &((struct sockaddr_in*)&pkt->client)->
+			sin_port, 2);
+	XDP_PUT16(udp+4, udplen);
+	XDP_PUT16(udp+6, 0);
+
+	if(family == AF_INET6) {
+		ip[0] = 0x60;
+		ip[1] = 0;
+		ip[2] = 0;
+		ip[3] = 0;
+		XDP_PUT16(ip+4, udplen);
+		ip[6] = IPPROTO_UDP;
+		ip[7] = 64;
+		memmove(ip+8, pkt->local, 16);
+		memmove(ip+24, &((struct sockaddr_in6*)&pkt->client)->
+			sin6_addr, 16);
+		sum = xdp_csum_add(0, ip+8, 32);
+	} else {
+		ip[0] = 0x45;
+		ip[1] = 0;
+		XDP_PUT16(ip+2, iphl + udplen);
+		XDP_PUT16(ip+4, 0);
+		XDP_PUT16(ip+6, 0x4000); /* don't fragment */
+		ip[8] = 64;
+		ip[9] = IPPROTO_UDP;
+		XDP_PUT16(ip+10, 0);
+		memmove(ip+12, pkt->local, 4);
+		memmove(ip+16, &((struct sockaddr_in*)&pkt->client)->
+			sin_addr, 4);
+		XDP_PUT16(ip+10, xdp_csum_fold(xdp_csum_add(0, ip, 20)));
+		sum = xdp_csum_add(0, ip+12, 8);
+	}
+	/* the pseudo header has the protocol and length, then the
+	 * UDP header and data */
+	sum += IPPROTO_UDP + (uint32_t)udplen;
+	sum = xdp_csum_add(sum, udp, udplen);
+	sum = xdp_csum_fold(sum);
+	if(sum == 0)
+		sum = 0xffff;
+	XDP_PUT16(udp+6, sum);
+	return hl + len;
+}
+
+#ifdef USE_XDP
+#ifndef AF_XDP
+#define AF_XDP 44
+#endif
+#ifndef SOL_XDP
+#define SOL_XDP 283
+#endif
+
+/** bpf instruction */
+#define XDP_INSN(c, d, s, o, i) { (c), (d), (s), (o), (i) }
+/** dst = src */
+#define XDP_MOV_REG(d, s) XDP_INSN(BPF_ALU64|BPF_MOV|BPF_X, d, s, 0, 0)
+/** dst = imm */
+#define XDP_MOV_IMM(d, i) XDP_INSN(BPF_ALU64|BPF_MOV|BPF_K, d, 0, 0, i)
+/** dst op= imm */
+#define XDP_ALU_IMM(op, d, i) XDP_INSN(BPF_ALU64|(op)|BPF_K, d, 0, 0, i)
+/** dst op= src */
+#define XDP_ALU_REG(op, d, s) XDP_INSN(BPF_ALU64|(op)|BPF_X, d, s, 0, 0)
+/** dst = *(size*)(src+off) */
+#define XDP_LDX(sz, d, s, o) XDP_INSN(BPF_LDX|BPF_MEM|(sz), d, s, o, 0)
+/** if dst op imm goto pc+off */
+#define XDP_JMP_IMM(op, d, i, o) XDP_INSN(BPF_JMP|(op)|BPF_K, d, 0, o, i)
+/** if dst op src goto pc+off */
+#define XDP_JMP_REG(op, d, s, o) XDP_INSN(BPF_JMP|(op)|BPF_X, d, s, o, 0)
+
+/** the bpf system call */
+static int
+xdp_bpf(int cmd, union bpf_attr* attr)
+{
+	return (int)syscall(__NR_bpf, cmd, attr, sizeof(*attr));
+}
+
+/**
+ * Load the XDP program that redirects the UDP packets for the port to
+ * the AF_XDP socket of the receive queue, in the map, and passes the
+ * other packets.  IPv4 fragments are passed to the network stack.
+ * @param map_fd: the XSKMAP.
+ * @param port: the UDP port.
+ * @return program fd or -1 on failure.
+ */
+static int
+xdp_prog_load(int map_fd, int port)
+{
+	/* r6=ctx, r2=data, r3=data_end, r4 for bounds checks */
+	struct bpf_insn prog[] = {
+		/* 0 */ XDP_MOV_REG(6, 1),
+		XDP_LDX(BPF_W, 2, 1, offsetof(struct xdp_md, data)),
+		XDP_LDX(BPF_W, 3, 1, offsetof(struct xdp_md, data_end)),
+		XDP_MOV_REG(4, 2),
+		XDP_ALU_IMM(BPF_ADD, 4, XDP_ETH_HDR),
+		/* 5 */ XDP_JMP_REG(BPF_JGT, 4, 3, 44),
+		XDP_LDX(BPF_B, 5, 2, 12),
+		XDP_LDX(BPF_B, 7, 2, 13),
+		XDP_ALU_IMM(BPF_LSH, 5, 8),
+		XDP_ALU_REG(BPF_OR, 5, 7),
+		/* 10 */ XDP_JMP_IMM(BPF_JEQ, 5, XDP_ETH_IP6, 19),
+		XDP_JMP_IMM(BPF_JNE, 5, XDP_ETH_IP4, 38),
+		/* IPv4: the protocol, the fragment bits, and the IHL */
+		XDP_MOV_REG(4, 2),
+		XDP_ALU_IMM(BPF_ADD, 4, XDP_ETH_HDR+20),
+		XDP_JMP_REG(BPF_JGT, 4, 3, 35),
+		/* 15 */ XDP_LDX(BPF_B, 5, 2, XDP_ETH_HDR+9),
+		XDP_JMP_IMM(BPF_JNE, 5, IPPROTO_UDP, 33),
+		XDP_LDX(BPF_B, 5, 2, XDP_ETH_HDR+6),
+		XDP_LDX(BPF_B, 7, 2, XDP_ETH_HDR+7),
+		XDP_ALU_IMM(BPF_LSH, 5, 8),
+		/* 20 */ XDP_ALU_REG(BPF_OR, 5, 7),
+		XDP_ALU_IMM(BPF_AND, 5, 0x3fff),
+		XDP_JMP_IMM(BPF_JNE, 5, 0, 27),
+		XDP_LDX(BPF_B, 5, 2, XDP_ETH_HDR),
+		XDP_ALU_IMM(BPF_AND, 5, 0x0f),
+		/* 25 */ XDP_ALU_IMM(BPF_LSH, 5, 2),
+		XDP_JMP_IMM(BPF_JLT, 5, 20, 23),
+		XDP_ALU_REG(BPF_ADD, 2, 5),
+		XDP_ALU_IMM(BPF_ADD, 2, XDP_ETH_HDR),
+		XDP_INSN(BPF_JMP|BPF_JA, 0, 0, 6, 0),
+		/* 30, IPv6: the next header */
+		XDP_MOV_REG(4, 2),
+		XDP_ALU_IMM(BPF_ADD, 4, XDP_ETH_HDR+40+8),
+		XDP_JMP_REG(BPF_JGT, 4, 3, 17),
+		XDP_LDX(BPF_B, 5, 2, XDP_ETH_HDR+6),
+		XDP_JMP_IMM(BPF_JNE, 5, IPPROTO_UDP, 15),
+		/* 35 */ XDP_ALU_IMM(BPF_ADD, 2, XDP_ETH_HDR+40),
+		/* 36, UDP: the destination port */
+		XDP_MOV_REG(4, 2),
+		XDP_ALU_IMM(BPF_ADD, 4, 8),
+		XDP_JMP_REG(BPF_JGT, 4, 3, 11),
+		XDP_LDX(BPF_B, 5, 2, 2),
+		/* 40 */ XDP_LDX(BPF_B, 7, 2, 3),
+		XDP_ALU_IMM(BPF_LSH, 5, 8),
+		XDP_ALU_REG(BPF_OR, 5, 7),
+		XDP_JMP_IMM(BPF_JNE, 5, port, 6),
+		/* redirect to the socket of the queue, or pass if none */
+		XDP_INSN(BPF_LD|BPF_DW|BPF_IMM, 1, BPF_PSEUDO_MAP_FD, 0,
+			map_fd),
+		/* 45 */ XDP_INSN(0, 0, 0, 0, 0),
+		XDP_LDX(BPF_W, 2, 6, offsetof(struct xdp_md, rx_queue_index)),
+		XDP_MOV_IMM(3, XDP_PASS),
+		XDP_INSN(BPF_JMP|BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map),
+		XDP_INSN(BPF_JMP|BPF_EXIT, 0, 0, 0, 0),
+		/* 50, pass */
+		XDP_MOV_IMM(0, XDP_PASS),
+		XDP_INSN(BPF_JMP|BPF_EXIT, 0, 0, 0, 0)
+	};
+	char logbuf[4096];
+	union bpf_attr attr;
+	int fd;
+	memset(&attr, 0, sizeof(attr));
+	attr.prog_type = BPF_PROG_TYPE_XDP;
+	attr.insns = (uint64_t)(uintptr_t)prog;
+	attr.insn_cnt = (uint32_t)(sizeof(prog)/sizeof(prog[0]));
+	attr.license = (uint64_t)(uintptr_t)"BSD";
+	fd = xdp_bpf(BPF_PROG_LOAD, &attr);
+	if(fd == -1 && errno != EPERM) {
+		/* load again for the verifier log */
+		logbuf[0] = 0;
+		attr.log_buf = (uint64_t)(uintptr_t)logbuf;
+		attr.log_size = (uint32_t)sizeof(logbuf);
+		attr.log_level = 1;
+		fd = xdp_bpf(BPF_PROG_LOAD, &attr);
+		if(fd == -1)
+			verbose(VERB_ALGO, "xdp program: %s", logbuf);
+	}
+	return fd;
+}
+
+/**
+ * Create the map and load and attach the program on the interface.
+ * @param xsk: the first socket on the interface, gets the fds.
+ * @param native: attach in native driver mode, otherwise generic.
+ * @return false on failure, logged.
+ */
+static int
+xdp_attach(struct xdp_sock* xsk, int native)
+{
+	union bpf_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.map_type = BPF_MAP_TYPE_XSKMAP;
+	attr.key_size = sizeof(uint32_t);
+	attr.value_size = sizeof(uint32_t);
+	attr.max_entries = 256;
+	xsk->map_fd = xdp_bpf(BPF_MAP_CREATE, &attr);
+	if(xsk->map_fd == -1) {
+		log_err("xdp %s: could not create map: %s", xsk->ifname,
+			strerror(errno));
+		return 0;
+	}
+	xsk->prog_fd = xdp_prog_load(xsk->map_fd, xsk->port);
+	if(xsk->prog_fd == -1) {
+		log_err("xdp %s: could not load program: %s", xsk->ifname,
+			strerror(errno));
+		return 0;
+	}
+	memset(&attr, 0, sizeof(attr));
+	attr.link_create.prog_fd = (uint32_t)xsk->prog_fd;
+	attr.link_create.target_ifindex = (uint32_t)xsk->ifindex;
+	attr.link_create.attach_type = BPF_XDP;
+	attr.link_create.flags = (native?XDP_FLAGS_DRV_MODE:
+		XDP_FLAGS_SKB_MODE);
+	xsk->link_fd = xdp_bpf(BPF_LINK_CREATE, &attr);
+	if(xsk->link_fd == -1) {
+		log_err("xdp %s: could not attach program in %s mode: %s",
+			xsk->ifname, (native?"native":"generic"),
+			strerror(errno));
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * Map a ring of the socket.
+ * @param fd: the socket.
+ * @param r: the ring.
+ * @param off: the offsets of the ring.
+ * @param pgoff: the mmap offset of the ring.
+ * @param descsize: size of a descriptor.
+ * @return false on failure.
+ */
+static int
+xdp_ring_map(int fd, struct xdp_ring* r, struct xdp_ring_offset* off,
+	off_t pgoff, size_t descsize)
+{
+	r->maplen = (size_t)off->desc + XDP_RING_SIZE*descsize;
+	r->map = mmap(NULL, r->maplen, PROT_READ|PROT_WRITE,
+		MAP_SHARED|MAP_POPULATE, fd, pgoff);
+	if(r->map == MAP_FAILED) {
+		r->map = NULL;
+		return 0;
+	}
+	r->producer = (uint32_t*)((uint8_t*)r->map + off->producer);
+	r->consumer = (uint32_t*)((uint8_t*)r->map + off->consumer);
+	r->ring = (uint8_t*)r->map + off->desc;
+	r->size = XDP_RING_SIZE;
+	r->mask = XDP_RING_SIZE-1;
+	return 1;
+}
+
+/** unmap a ring */
+static void
+xdp_ring_unmap(struct xdp_ring* r)
+{
+	if(r->map)
+		munmap(r->map, r->maplen);
+}
+
+/** set a ring size socket option */
+static int
+xdp_ring_size(int fd, int opt)
+{
+	int sz = XDP_RING_SIZE;
+	return setsockopt(fd, SOL_XDP, opt, &sz, (socklen_t)sizeof(sz)) == 0;
+}
+
+/** move frames from the free list to the fill ring, keeps a reserve
+ * for transmit */
+static void
+xdp_fill(struct xdp_sock* xsk)
+{
+	uint32_t prod = *xsk->fill.producer;
+	uint32_t cons = __atomic_load_n(xsk->fill.consumer, __ATOMIC_ACQUIRE);
+	uint32_t space = xsk->fill.size - (prod - cons);
+	uint32_t start = prod;
+	while(space > 0 && xsk->num_free > XDP_TX_RESERVE) {
+		((uint64_t*)xsk->fill.ring)[prod & xsk->fill.mask] =
+			xsk->free_frames[--xsk->num_free];
+		prod++;
+		space--;
+	}
+	if(prod != start)
+		__atomic_store_n(xsk->fill.producer, prod, __ATOMIC_RELEASE);
+}
+
+/** move the transmitted frames from the completion ring to the free
+ * list */
+static void
+xdp_complete(struct xdp_sock* xsk)
+{
+	uint32_t prod = __atomic_load_n(xsk->comp.producer, __ATOMIC_ACQUIRE);
+	uint32_t cons = *xsk->comp.consumer;
+	if(prod == cons)
+		return;
+	while(cons != prod) {
+		xsk->free_frames[xsk->num_free++] = ((uint64_t*)xsk->comp.ring)
+			[cons & xsk->comp.mask] & ~(uint64_t)(XDP_FRAME_SIZE-1);
+		cons++;
+	}
+	__atomic_store_n(xsk->comp.consumer, cons, __ATOMIC_RELEASE);
+}
+
+/** put a frame on the transmit ring, false if full */
+static int
+xdp_tx(struct xdp_sock* xsk, uint64_t addr, size_t len)
+{
+	uint32_t prod = *xsk->tx.producer;
+	uint32_t cons = __atomic_load_n(xsk->tx.consumer, __ATOMIC_ACQUIRE);
+	struct xdp_desc* d;
+	if(prod - cons >= xsk->tx.size)
+		return 0;
+	d = &((struct xdp_desc*)xsk->tx.ring)[prod & xsk->tx.mask];
+	d->addr = addr;
+	d->len = (uint32_t)len;
+	d->options = 0;
+	__atomic_store_n(xsk->tx.producer, prod+1, __ATOMIC_RELEASE);
+	xsk->tx_pending++;
+	return 1;
+}
+
+/** delete one socket */
+static void
+xdp_sock_delete(struct xdp_sock* xsk)
+{
+	if(xsk->link_fd != -1)
+		close(xsk->link_fd);
+	if(xsk->prog_fd != -1)
+		close(xsk->prog_fd);
+	if(xsk->map_fd != -1)
+		close(xsk->map_fd);
+	xdp_ring_unmap(&xsk->fill);
+	xdp_ring_unmap(&xsk->comp);
+	xdp_ring_unmap(&xsk->rx);
+	xdp_ring_unmap(&xsk->tx);
+	if(xsk->fd != -1)
+		close(xsk->fd);
+	if(xsk->umem)
+		munmap(xsk->umem, xsk->umem_len);
+	free(xsk->free_frames);
+	free(xsk);
+}
+
+/**
+ * Open an AF_XDP socket with its UMEM and rings.
+ * @param ifname: interface name, with @queue.
+ * @param cfg: the config.
+ * @return socket or NULL, logged.
+ */
+static struct xdp_sock*
+xdp_sock_open(const char* ifname, struct config_file* cfg)
+{
+	struct xdp_sock* xsk = (struct xdp_sock*)calloc(1, sizeof(*xsk));
+	struct xdp_umem_reg reg;
+	struct xdp_mmap_offsets off;
+	struct sockaddr_xdp sxdp;
+	struct ifreq ifr;
+	socklen_t optlen = (socklen_t)sizeof(off);
+	char* at;
+	int s;
+	size_t i;
+	if(!xsk) {
+		log_err("out of memory");
+		return NULL;
+	}
+	xsk->fd = xsk->prog_fd = xsk->map_fd = xsk->link_fd = -1;
+	xsk->port = cfg->port;
+	(void)strlcpy(xsk->ifname, ifname, sizeof(xsk->ifname));
+	if((at = strchr(xsk->ifname, '@')) != NULL) {
+		*at = 0;
+		xsk->queue = (uint32_t)atoi(at+1);
+	}
+	if(xsk->queue >= 256 || !(xsk->ifindex =
+		(int)if_nametoindex(xsk->ifname))) {
+		log_err("xdp-interface: %s: no such interface or queue",
+			ifname);
+		xdp_sock_delete(xsk);
+		return NULL;
+	}
+	/* the MTU limits the size of the replies */
+	memset(&ifr, 0, sizeof(ifr));
+	(void)strlcpy(ifr.ifr_name, xsk->ifname, sizeof(ifr.ifr_name));
+	xsk->mtu = 1500;
+	if((s = socket(AF_INET, SOCK_DGRAM, 0)) != -1) {
+		if(ioctl(s, SIOCGIFMTU, &ifr) == 0 && ifr.ifr_mtu > 0)
+			xsk->mtu = ifr.ifr_mtu;
+		close(s);
+	}
+
+	xsk->umem_len = (size_t)XDP_NUM_FRAMES*XDP_FRAME_SIZE;
+	xsk->umem = (uint8_t*)mmap(NULL, xsk->umem_len,
+		PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+	if(xsk->umem == MAP_FAILED) {
+		xsk->umem = NULL;
+		log_err("xdp %s: mmap: %s", ifname, strerror(errno));
+		xdp_sock_delete(xsk);
+		return NULL;
+	}
+	xsk->free_frames = (uint64_t*)calloc(XDP_NUM_FRAMES,
+		sizeof(uint64_t));
+	if(!xsk->free_frames) {
+		log_err("out of memory");
+		xdp_sock_delete(xsk);
+		return NULL;
+	}
+	for(i=0; i<XDP_NUM_FRAMES; i++)
+		xsk->free_frames[XDP_NUM_FRAMES-1-i] =
+			(uint64_t)i*XDP_FRAME_SIZE;
+	xsk->num_free = XDP_NUM_FRAMES;
+
+	xsk->fd = socket(AF_XDP, SOCK_RAW, 0);
+	if(xsk->fd == -1) {
+		log_err("xdp %s: socket(AF_XDP): %s", ifname, strerror(errno));
+		xdp_sock_delete(xsk);
+		return NULL;
+	}
+	memset(&reg, 0, sizeof(reg));
+	reg.addr = (uint64_t)(uintptr_t)xsk->umem;
+	reg.len = xsk->umem_len;
+	reg.chunk_size = XDP_FRAME_SIZE;
+	reg.headroom = 0;
+	if(setsockopt(xsk->fd, SOL_XDP, XDP_UMEM_REG, &reg,
+		(socklen_t)sizeof(reg)) != 0 ||
+		!xdp_ring_size(xsk->fd, XDP_UMEM_FILL_RING) ||
+		!xdp_ring_size(xsk->fd, XDP_UMEM_COMPLETION_RING) ||
+		!xdp_ring_size(xsk->fd, XDP_RX_RING) ||
+		!xdp_ring_size(xsk->fd, XDP_TX_RING) ||
+		getsockopt(xsk->fd, SOL_XDP, XDP_MMAP_OFFSETS, &off,
+		&optlen) != 0) {
+		log_err("xdp %s: setsockopt: %s", ifname, strerror(errno));
+		xdp_sock_delete(xsk);
+		return NULL;
+	}
+	if(!xdp_ring_map(xsk->fd, &xsk->fill, &off.fr,
+		XDP_UMEM_PGOFF_FILL_RING, sizeof(uint64_t)) ||
+		!xdp_ring_map(xsk->fd, &xsk->comp, &off.cr,
+		XDP_UMEM_PGOFF_COMPLETION_RING, sizeof(uint64_t)) ||
+		!xdp_ring_map(xsk->fd, &xsk->rx, &off.rx,
+		XDP_PGOFF_RX_RING, sizeof(struct xdp_desc)) ||
+		!xdp_ring_map(xsk->fd, &xsk->tx, &off.tx,
+		XDP_PGOFF_TX_RING, sizeof(struct xdp_desc))) {
+		log_err("xdp %s: mmap rings: %s", ifname, strerror(errno));
+		xdp_sock_delete(xsk);
+		return NULL;
+	}
+	memset(&sxdp, 0, sizeof(sxdp));
+	sxdp.sxdp_family = AF_XDP;
+	sxdp.sxdp_ifindex = (uint32_t)xsk->ifindex;
+	sxdp.sxdp_queue_id = xsk->queue;
+	/* generic mode only copies, in native mode the kernel picks
+	 * zero copy if the driver has it */
+	sxdp.sxdp_flags = (cfg->xdp_native?0:XDP_COPY);
+	if(bind(xsk->fd, (struct sockaddr*)&sxdp, (socklen_t)sizeof(sxdp))
+		!= 0) {
+		log_err("xdp %s: bind: %s", ifname, strerror(errno));
+		xdp_sock_delete(xsk);
+		return NULL;
+	}
+	xdp_fill(xsk);
+	return xsk;
+}
+
+struct xdp_sock*
+xdp_sock_open_all(struct config_file* cfg)
+{
+	struct xdp_sock* list = NULL, *last = NULL, *xsk, *p;
+	struct config_strlist* s;
+	union bpf_attr attr;
+	uint32_t key, val;
+	for(s = cfg->xdp_ifs; s; s = s->next) {
+		if(!(xsk = xdp_sock_open(s->str, cfg))) {
+			xdp_sock_delete_all(list);
+			return NULL;
+		}
+		if(last)
+			last->next = xsk;
+		else	list = xsk;
+		last = xsk;
+		/* one program and map per interface */
+		for(p = list; p; p = p->next)
+			if(p->ifindex == xsk->ifindex && p->map_fd != -1)
+				break;
+		if(!p) {
+			p = xsk;
+			if(!xdp_attach(xsk, cfg->xdp_native)) {
+				xdp_sock_delete_all(list);
+				return NULL;
+			}
+		}
+		key = xsk->queue;
+		val = (uint32_t)xsk->fd;
+		memset(&attr, 0, sizeof(attr));
+		attr.map_fd = (uint32_t)p->map_fd;
+		attr.key = (uint64_t)(uintptr_t)&key;
+		attr.value = (uint64_t)(uintptr_t)&val;
+		attr.flags = BPF_ANY;
+		if(xdp_bpf(BPF_MAP_UPDATE_ELEM, &attr) != 0) {
+			log_err("xdp %s: could not add socket to map: %s",
+				s->str, strerror(errno));
+			xdp_sock_delete_all(list);
+			return NULL;
+		}
+		verbose(VERB_OPS, "xdp %s queue %u: port %d, mtu %d, %s mode",
+			xsk->ifname, (unsigned)xsk->queue, xsk->port, xsk->mtu,
+			(cfg->xdp_native?"native":"generic"));
+	}
+	return list;
+}
+
+void
+xdp_sock_delete_all(struct xdp_sock* list)
+{
+	struct xdp_sock* p, *np;
+	/* detach the programs first, so no more packets are redirected */
+	for(p = list; p; p = p->next) {
+		if(p->link_fd != -1) {
+			close(p->link_fd);
+			p->link_fd = -1;
+		}
+	}
+	for(p = list; p; p = np) {
+		np = p->next;
+		xdp_sock_delete(p);
+	}
+}
+
+int
+xdp_sock_recv(struct xdp_sock* xsk, struct xdp_pkt* pkt)
+{
+	uint32_t prod = __atomic_load_n(xsk->rx.producer, __ATOMIC_ACQUIRE);
+	uint32_t cons = *xsk->rx.consumer;
+	struct xdp_desc* d;
+	while(cons != prod) {
+		d = &((struct xdp_desc*)xsk->rx.ring)[cons & xsk->rx.mask];
+		pkt->addr = d->addr;
+		cons++;
+		__atomic_store_n(xsk->rx.consumer, cons, __ATOMIC_RELEASE);
+		if(pkt->addr + d->len <= xsk->umem_len &&
+			xdp_parse_pkt(xsk->umem + pkt->addr, d->len,
+			xsk->port, pkt))
+			return 1;
+		xdp_sock_release(xsk, pkt);
+	}
+	return 0;
+}
+
+void
+xdp_sock_release(struct xdp_sock* xsk, struct xdp_pkt* pkt)
+{
+	xsk->free_frames[xsk->num_free++] = pkt->addr &
+		~(uint64_t)(XDP_FRAME_SIZE-1);
+}
+
+/**
+ * Copy the reply into a frame and build the headers.
+ * @param xsk: the socket.
+ * @param addr: UMEM offset of the packet start.
+ * @param pkt: the addresses.
+ * @param buf: the DNS reply.
+ * @return the frame length or 0.
+ */
+static size_t
+xdp_fill_frame(struct xdp_sock* xsk, uint64_t addr, struct xdp_pkt* pkt,
+	struct sldns_buffer* buf)
+{
+	size_t room = XDP_FRAME_SIZE - (size_t)(addr & (XDP_FRAME_SIZE-1));
+	size_t hl = xdp_hdr_len((int)pkt->client.ss_family);
+	size_t len = sldns_buffer_limit(buf);
+	if(room <= hl)
+		return 0;
+	memmove(xsk->umem + addr + hl, sldns_buffer_begin(buf),
+		(len < room-hl ? len : room-hl));
+	return xdp_build_reply(xsk->umem + addr, room, xsk->mtu, pkt,
+		xsk->port, len);
+}
+
+void
+xdp_sock_reply(struct xdp_sock* xsk, struct xdp_pkt* pkt,
+	struct sldns_buffer* buf)
+{
+	size_t len = xdp_fill_frame(xsk, pkt->addr, pkt, buf);
+	if(len == 0 || !xdp_tx(xsk, pkt->addr, len))
+		xdp_sock_release(xsk, pkt);
+}
+
+int
+xdp_sock_send(struct xdp_sock* xsk, struct xdp_pkt* pkt,
+	struct sldns_buffer* buf)
+{
+	size_t len;
+	xdp_complete(xsk);
+	if(xsk->num_free == 0)
+		return 0;
+	pkt->addr = xsk->free_frames[--xsk->num_free];
+	len = xdp_fill_frame(xsk, pkt->addr, pkt, buf);
+	if(len == 0 || !xdp_tx(xsk, pkt->addr, len)) {
+		xdp_sock_release(xsk, pkt);
+		return 0;
+	}
+	xdp_sock_kick(xsk);
+	return 1;
+}
+
+void
+xdp_sock_kick(struct xdp_sock* xsk)
+{
+	int i;
+	/* in copy mode a sendto transmits a limited batch of frames */
+	for(i=0; xsk->tx_pending && i<XDP_RING_SIZE/16; i++) {
+		if(sendto(xsk->fd, NULL, 0, MSG_DONTWAIT, NULL, 0) == -1 &&
+			errno != EAGAIN && errno != EBUSY &&
+			errno != ENOBUFS && errno != EINTR) {
+			verbose(VERB_ALGO, "xdp %s: sendto: %s", xsk->ifname,
+				strerror(errno));
+			break;
+		}
+		xdp_complete(xsk);
+		if(*xsk->tx.producer == __atomic_load_n(xsk->tx.consumer,
+			__ATOMIC_ACQUIRE))
+			xsk->tx_pending = 0;
+	}
+	xdp_complete(xsk);
+	xdp_fill(xsk);
+}
+
+#else /* !USE_XDP */
+
+struct xdp_sock*
+xdp_sock_open_all(struct config_file* ATTR_UNUSED(cfg))
+{
+	log_err("xdp-interface: AF_XDP is not available on this system");
+	return NULL;
+}
+
+void
+xdp_sock_delete_all(struct xdp_sock* ATTR_UNUSED(list))
+{
+}
+
+int
+xdp_sock_recv(struct xdp_sock* ATTR_UNUSED(xsk),
+	struct xdp_pkt* ATTR_UNUSED(pkt))
+{
+	return 0;
+}
+
+void
+xdp_sock_release(struct xdp_sock* ATTR_UNUSED(xsk),
+	struct xdp_pkt* ATTR_UNUSED(pkt))
+{
+}
+
+void
+xdp_sock_reply(struct xdp_sock* ATTR_UNUSED(xsk),
+	struct xdp_pkt* ATTR_UNUSED(pkt), struct sldns_buffer* ATTR_UNUSED(buf))
+{
+}
+
+int
+xdp_sock_send(struct xdp_sock* ATTR_UNUSED(xsk),
+	struct xdp_pkt* ATTR_UNUSED(pkt), struct sldns_buffer* ATTR_UNUSED(buf))
+{
+	return 0;
+}
+
+void
+xdp_sock_kick(struct xdp_sock* ATTR_UNUSED(xsk))
+{
+}
+#endif /* USE_XDP */
@@ -0,0 +1,246 @@
+/*
+ * util/xdp.h - AF_XDP sockets for the UDP fast path.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the AF_XDP sockets for the UDP fast path.  An XDP
+ * program on the interface redirects the UDP packets for the DNS port to
+ * the socket of the receive queue, other traffic is passed to the kernel
+ * network stack.  The packets arrive in frames of a UMEM area that is
+ * shared with the kernel, and the replies are built in place in a frame,
+ * with the ethernet, IP and UDP headers of the query reversed, and put on
+ * the transmit ring.
+ *
+ * The program is attached in generic (skb) mode by default, that works
+ * on every interface, including veth pairs, or in native driver mode.
+ */
+
+#ifndef UTIL_XDP_H
+#define UTIL_XDP_H
+struct config_file;
+struct sldns_buffer;
+
+/** size of a frame in the UMEM area */
+#define XDP_FRAME_SIZE 2048
+/** number of frames in the UMEM area of a socket */
+#define XDP_NUM_FRAMES 4096
+/** number of entries in the rings */
+#define XDP_RING_SIZE 2048
+/** number of free frames that are kept for transmit, the fill ring
+ * is not topped up from them */
+#define XDP_TX_RESERVE 256
+/** size of the ethernet header */
+#define XDP_ETH_HDR 14
+
+/**
+ * A ring that is shared with the kernel, the producer and consumer
+ * indexes and the descriptors are in the mmapped area.
+ */
+struct xdp_ring {
+	/** producer index */
+	uint32_t* producer;
+	/** consumer index */
+	uint32_t* consumer;
+	/** the descriptors, uint64_t addresses or struct xdp_desc */
+	void* ring;
+	/** the mmapped area */
+	void* map;
+	/** length of the mmapped area */
+	size_t maplen;
+	/** mask for the index, size-1 */
+	uint32_t mask;
+	/** number of entries */
+	uint32_t size;
+};
+
+/**
+ * An AF_XDP socket, bound to a queue of an interface.
+ */
+struct xdp_sock {
+	/** next in the list of sockets */
+	struct xdp_sock* next;
+	/** the AF_XDP socket */
+	int fd;
+	/** name of the interface */
+	char ifname[32];
+	/** interface index */
+	int ifindex;
+	/** queue of the interface */
+	uint32_t queue;
+	/** MTU of the interface, the IP packets are not larger */
+	int mtu;
+	/** the UDP port that is served, in host order */
+	int port;
+	/** the XDP program, map and link, set for the first socket on the
+	 * interface, the others have -1 */
+	int prog_fd, map_fd, link_fd;
+	/** the UMEM area with the frames */
+	uint8_t* umem;
+	/** length of the UMEM area */
+	size_t umem_len;
+	/** fill ring, frames given to the kernel for receive */
+	struct xdp_ring fill;
+	/** completion ring, frames that are transmitted */
+	struct xdp_ring comp;
+	/** receive ring */
+	struct xdp_ring rx;
+	/** transmit ring */
+	struct xdp_ring tx;
+	/** stack of the free frames, as UMEM offsets */
+	uint64_t* free_frames;
+	/** number of free frames */
+	size_t num_free;
+	/** number of frames on the transmit ring that are not sent */
+	uint32_t tx_pending;
+};
+
+/**
+ * A packet received on an AF_XDP socket, the addresses are kept so
+ * that the reply can be sent back.
+ */
+struct xdp_pkt {
+	/** UMEM offset of the start of the packet */
+	uint64_t addr;
+	/** the UDP payload, inside the frame */
+	uint8_t* payload;
+	/** length of the UDP payload */
+	size_t len;
+	/** destination and source MAC address of the query */
+	uint8_t eth[12];
+	/** the address of the client, with the port */
+	struct sockaddr_storage client;
+	/** length of the client address */
+	socklen_t clientlen;
+	/** the local address the query was sent to, 4 or 16 bytes */
+	uint8_t local[16];
+};
+
+/**
+ * Open the AF_XDP sockets for the xdp-interface entries in the config,
+ * and attach the XDP programs.  Needs privileges.
+ * @param cfg: config with the interfaces and the port.
+ * @return list of sockets, or NULL on failure (logged).
+ */
+struct xdp_sock* xdp_sock_open_all(struct config_file* cfg);
+
+/**
+ * Detach the XDP programs and close the sockets in the list.
+ * @param list: list of sockets, may be NULL.
+ */
+void xdp_sock_delete_all(struct xdp_sock* list);
+
+/**
+ * Take a packet from the receive ring.  Packets that are not well
+ * formed UDP over IPv4 or IPv6 are skipped.
+ * @param xsk: the socket.
+ * @param pkt: the packet is returned here.
+ * @return 0 if there are no more packets.
+ */
+int xdp_sock_recv(struct xdp_sock* xsk, struct xdp_pkt* pkt);
+
+/**
+ * Put the frame of a received packet back on the free list, when it
+ * is not used for the reply.
+ * @param xsk: the socket.
+ * @param pkt: the packet.
+ */
+void xdp_sock_release(struct xdp_sock* xsk, struct xdp_pkt* pkt);
+
+/**
+ * Build the reply in place, in the frame of the query, and put it on the
+ * transmit ring.  The frame is released if the reply cannot be made.
+ * @param xsk: the socket.
+ * @param pkt: the query packet.
+ * @param buf: the DNS reply.
+ */
+void xdp_sock_reply(struct xdp_sock* xsk, struct xdp_pkt* pkt,
+	struct sldns_buffer* buf);
+
+/**
+ * Send a reply to an earlier query, in a free frame, and start the
+ * transmit.  For replies that are not made in the receive callback.
+ * @param xsk: the socket.
+ * @param pkt: the addresses of the query, addr, payload and len unused.
+ * @param buf: the DNS reply.
+ * @return false on failure, no free frames.
+ */
+int xdp_sock_send(struct xdp_sock* xsk, struct xdp_pkt* pkt,
+	struct sldns_buffer* buf);
+
+/**
+ * Start the transmit of the frames on the transmit ring, and move the
+ * frames that are sent, and the receive frames, to the fill ring.
+ * @param xsk: the socket.
+ */
+void xdp_sock_kick(struct xdp_sock* xsk);
+
+/**
+ * Build the ethernet, IP and UDP headers of a reply in a frame, with the
+ * addresses of the query reversed.  The DNS reply must already be in the
+ * frame after the headers, as far as it fits, it is truncated to the
+ * question section with the TC flag when it does not fit.
+ * @param frame: start of the frame.
+ * @param room: space in the frame.
+ * @param mtu: MTU of the interface.
+ * @param pkt: the addresses of the query.
+ * @param port: the local port.
+ * @param len: length of the DNS reply, also the part that is not in the
+ * 	frame.
+ * @return length of the frame, or 0 on failure.
+ */
+size_t xdp_build_reply(uint8_t* frame, size_t room, int mtu,
+	struct xdp_pkt* pkt, int port, size_t len);
+
+/**
+ * Parse a received frame, the ethernet header, IPv4 or IPv6 and the UDP
+ * header, and check the destination port.
+ * @param data: the frame.
+ * @param len: length of the frame.
+ * @param port: the UDP port that is served.
+ * @param pkt: the addresses and the payload are returned here.
+ * @return false if not a UDP packet for the port.
+ */
+int xdp_parse_pkt(uint8_t* data, size_t len, int port, struct xdp_pkt* pkt);
+
+/**
+ * The offset of the DNS reply in the frame that xdp_build_reply makes.
+ * @param family: AF_INET or AF_INET6.
+ * @return header length.
+ */
+size_t xdp_hdr_len(int family);
+
+#endif /* UTIL_XDP_H */
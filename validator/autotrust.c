@@ -53,6 +53,8 @@
 #include "util/config_file.h"
 #include "util/regional.h"
 #include "util/random.h"
+#include "util/storage/dnstree.h"
+#include "util/tube.h"
 #include "util/data/msgparse.h"
 #include "services/mesh.h"
 #include "services/cache/rrset.h"
@@ -64,6 +66,7 @@
 #include "sldns/rrdef.h"
 #include <stdarg.h>
 #include <ctype.h>
+#include <sys/time.h>
 
 /** number of times a key must be seen before it can become valid */
 #define MIN_PENDINGCOUNT 2
@@ -78,13 +81,46 @@ struct autr_global_data* autr_global_create(void)
 	if(!global) 
 		return NULL;
 	rbtree_init(&global->probe, &probetree_cmp);
+	global->writer = NULL;
 	return global;
 }
 
+/** stop the writer thread, when its list is done, and delete it */
+static void
+autr_writer_stop(struct autr_writer* w)
+{
+	uint8_t q = 'q';
+	if(!w)
+		return;
+	if(!tube_write_msg(w->tube, &q, 1, 0)) {
+		/* the thread stops at the end of the tube */
+		log_err("autotrust: could not send stop to the writer thread");
+		tube_close_write(w->tube);
+	}
+	ub_thread_join(w->thr);
+	verbose(VERB_OPS, "autotrust writer: %u files written, %u coalesced, "
+		"%u failed, average %u msec, max %u msec",
+		(unsigned)w->num_write, (unsigned)w->num_coalesced,
+		(unsigned)w->num_fail, (unsigned)(w->num_write?
+		w->total_msec/w->num_write:0), (unsigned)w->max_msec);
+	while(w->first) {
+		struct autr_write_item* item = w->first;
+		w->first = item->next;
+		log_err("autotrust: not written: %s", item->fname);
+		free(item->fname);
+		free(item->data);
+		free(item);
+	}
+	tube_delete(w->tube);
+	lock_basic_destroy(&w->lock);
+	free(w);
+}
+
 void autr_global_delete(struct autr_global_data* global)
 {
 	if(!global)
 		return;
+	autr_writer_stop(global->writer);
 	/* elements deleted by parent */
 	memset(global, 0, sizeof(*global));
 	free(global);
@@ -353,6 +389,9 @@ autr_tp_create(struct val_anchors* anchors, uint8_t* own, size_t own_len,
 	tp->autr->pnode.key = tp;
 
 	lock_basic_lock(&anchors->lock);
+	/* the index is made again when the parents are set up */
+	name_index_delete(anchors->index);
+	anchors->index = NULL;
 	if(!rbtree_insert(anchors->tree, &tp->node)) {
 		lock_basic_unlock(&anchors->lock);
 		log_err("trust anchor presented twice");
@@ -1077,16 +1116,61 @@ trustanchor_state2str(autr_state_type s)
         return " UNKNOWN ";
 }
 
+/** the contents of a state file, made before it is written */
+struct autr_buf {
+	/** the text, malloced */
+	char* data;
+	/** length of the text */
+	size_t len;
+	/** allocated size of data */
+	size_t cap;
+};
+
+/** print to the buffer like fprintf, returns -1 on malloc failure */
+static int autr_printf(struct autr_buf* out, const char* format, ...)
+	ATTR_FORMAT(printf, 2, 3);
+
+static int
+autr_printf(struct autr_buf* out, const char* format, ...)
+{
+	va_list args;
+	int r;
+	while(1) {
+		va_start(args, format);
+		r = vsnprintf(out->data?out->data+out->len:NULL,
+			out->cap-out->len, format, args);
+		va_end(args);
+		if(r < 0)
+			return r;
+		if(out->len + (size_t)r < out->cap)
+			break;
+		/* grow and try again */
+		else {
+			size_t c = out->cap*2 + (size_t)r + 1;
+			char* d = (char*)realloc(out->data, c);
+			if(!d) {
+				errno = ENOMEM;
+				return -1;
+			}
+			out->data = d;
+			out->cap = c;
+		}
+	}
+	out->len += (size_t)r;
+	return r;
+}
+
 /** print ID to file */
 static int
-print_id(FILE* out, char* fname, uint8_t* nm, size_t nmlen, uint16_t dclass)
+print_id(struct autr_buf* out, char* fname, uint8_t* nm, size_t nmlen,
+	uint16_t dclass)
 {
 	char* s = sldns_wire2str_dname(nm, nmlen);
 	if(!s) {
 		log_err("malloc failure in write to %s", fname);
 		return 0;
 	}
-	if(fprintf(out, ";;id: %s %d\n", s, (int)dclass) < 0) {
+	if(autr_printf(out, ";;id: %s %d\n", s, (int)dclass) < 0) {
 		log_err("could not write to %s: %s", fname, strerror(errno));
 		free(s);
 		return 0;
@@ -1096,20 +1180,20 @@ print_id(FILE* out, char* fname, uint8_t* nm, size_t nmlen, uint16_t dclass)
 }
 
 static int
-autr_write_contents(FILE* out, char* fn, struct trust_anchor* tp)
+autr_write_contents(struct autr_buf* out, char* fn, struct trust_anchor* tp)
 {
 	char tmi[32];
 	struct autr_ta* ta;
 	char* str;
 
 	/* write pretty header */
-	if(fprintf(out, "; autotrust trust anchor file\n") < 0) {
+	if(autr_printf(out, "; autotrust trust anchor file\n") < 0) {
 		log_err("could not write to %s: %s", fn, strerror(errno));
 		return 0;
 	}
 	if(tp->autr->revoked) {
-		if(fprintf(out, ";;REVOKED\n") < 0 ||
-		   fprintf(out, "; The zone has all keys revoked, and is\n"
+		if(autr_printf(out, ";;REVOKED\n") < 0 ||
+		   autr_printf(out, "; The zone has all keys revoked, and is\n"
 			"; considered as if it has no trust anchors.\n"
 			"; the remainder of the file is the last probe.\n"
 			"; to restart the trust anchor, overwrite this file.\n"
@@ -1121,19 +1205,19 @@ autr_write_contents(FILE* out, char* fn, struct trust_anchor* tp)
 	if(!print_id(out, fn, tp->name, tp->namelen, tp->dclass)) {
 		return 0;
 	}
-	if(fprintf(out, ";;last_queried: %u ;;%s", 
+	if(autr_printf(out, ";;last_queried: %u ;;%s", 
 		(unsigned int)tp->autr->last_queried, 
 		ctime_r(&(tp->autr->last_queried), tmi)) < 0 ||
-	   fprintf(out, ";;last_success: %u ;;%s", 
+	   autr_printf(out, ";;last_success: %u ;;%s", 
 		(unsigned int)tp->autr->last_success,
 		ctime_r(&(tp->autr->last_success), tmi)) < 0 ||
-	   fprintf(out, ";;next_probe_time: %u ;;%s", 
+	   autr_printf(out, ";;next_probe_time: %u ;;%s", 
 		(unsigned int)tp->autr->next_probe_time,
 		ctime_r(&(tp->autr->next_probe_time), tmi)) < 0 ||
-	   fprintf(out, ";;query_failed: %d\n", (int)tp->autr->query_failed)<0
-	   || fprintf(out, ";;query_interval: %d\n", 
+	   autr_printf(out, ";;query_failed: %d\n", (int)tp->autr->query_failed)<0
+	   || autr_printf(out, ";;query_interval: %d\n", 
 	   (int)tp->autr->query_interval) < 0 ||
-	   fprintf(out, ";;retry_time: %d\n", (int)tp->autr->retry_time) < 0) {
+	   autr_printf(out, ";;retry_time: %d\n", (int)tp->autr->retry_time) < 0) {
 		log_err("could not write to %s: %s", fn, strerror(errno));
 		return 0;
 	}
@@ -1156,7 +1240,7 @@ autr_write_contents(FILE* out, char* fn, struct trust_anchor* tp)
 			return 0;
 		}
 		str[strlen(str)-1] = 0; /* remove newline */
-		if(fprintf(out, "%s ;;state=%d [%s] ;;count=%d "
+		if(autr_printf(out, "%s ;;state=%d [%s] ;;count=%d "
 			";;lastchange=%u ;;%s", str, (int)ta->s, 
 			trustanchor_state2str(ta->s), (int)ta->pending_count,
 			(unsigned int)ta->last_change, 
@@ -1170,32 +1254,36 @@ autr_write_contents(FILE* out, char* fn, struct trust_anchor* tp)
 	return 1;
 }
 
-void autr_write_file(struct module_env* env, struct trust_anchor* tp)
+/**
+ * Write the contents to the state file, with a temporary file that is
+ * synced to disk and renamed over the file.
+ * @param fname: the file.
+ * @param tempf: name of the temporary file.
+ * @param data: the contents.
+ * @param len: length of data.
+ * @param err: the error string is returned on failure.
+ * @param errlen: size of the err buffer.
+ * @return false on failure, the file is not changed then.
+ */
+static int
+autr_write_disk(char* fname, char* tempf, char* data, size_t len,
+	char* err, size_t errlen)
 {
 	FILE* out;
-	char* fname = tp->autr->file;
-	char tempf[2048];
-	log_assert(tp->autr);
-	if(!env) {
-		log_err("autr_write_file: Module environment is NULL.");
-		return;
-	}
-	/* unique name with pid number and thread number */
-	snprintf(tempf, sizeof(tempf), "%s.%d-%d", fname, (int)getpid(),
-		env->worker?*(int*)env->worker:0);
 	verbose(VERB_ALGO, "autotrust: write to disk: %s", tempf);
 	out = fopen(tempf, "w");
 	if(!out) {
-		fatal_exit("could not open autotrust file for writing, %s: %s",
-			tempf, strerror(errno));
-		return;
+		snprintf(err, errlen, "could not open autotrust file for "
+			"writing, %s: %s", tempf, strerror(errno));
+		return 0;
 	}
-	if(!autr_write_contents(out, tempf, tp)) {
+	if(fwrite(data, 1, len, out) != len) {
 		/* failed to write contents (completely) */
+		snprintf(err, errlen, "could not completely write: %s: %s",
+			fname, strerror(errno));
 		fclose(out);
 		unlink(tempf);
-		fatal_exit("could not completely write: %s", fname);
-		return;
+		return 0;
 	}
 	if(fflush(out) != 0)
 		log_err("could not fflush(%s): %s", fname, strerror(errno));
@@ -1206,10 +1294,10 @@ void autr_write_file(struct module_env* env, struct trust_anchor* tp)
 	FlushFileBuffers((HANDLE)_get_osfhandle(_fileno(out)));
 #endif
 	if(fclose(out) != 0) {
-		fatal_exit("could not complete write: %s: %s",
+		snprintf(err, errlen, "could not complete write: %s: %s",
 			fname, strerror(errno));
 		unlink(tempf);
-		return;
+		return 0;
 	}
 	/* success; overwrite actual file */
 	verbose(VERB_ALGO, "autotrust: replaced %s", fname);
@@ -1217,8 +1305,202 @@ void autr_write_file(struct module_env* env, struct trust_anchor* tp)
 	(void)unlink(fname); /* windows does not replace file with rename() */
 #endif
 	if(rename(tempf, fname) < 0) {
-		fatal_exit("rename(%s to %s): %s", tempf, fname, strerror(errno));
+		snprintf(err, errlen, "rename(%s to %s): %s", tempf, fname,
+			strerror(errno));
+		return 0;
+	}
+	return 1;
+}
+
+#ifndef THREADS_DISABLED
+/** do the writes in the list of the writer thread */
+static void
+autr_writer_flush(struct autr_writer* w)
+{
+	struct autr_write_item* item;
+	struct timeval start, end;
+	char tempf[2048], err[2560];
+	size_t msec;
+	int ok;
+	while(1) {
+		lock_basic_lock(&w->lock);
+		item = w->first;
+		if(item) {
+			w->first = item->next;
+			if(!w->first)
+				w->last = NULL;
+		}
+		lock_basic_unlock(&w->lock);
+		if(!item)
+			return;
+		/* unique name with pid number, the workers use the
+		 * thread number */
+		snprintf(tempf, sizeof(tempf), "%s.%d-w", item->fname,
+			(int)getpid());
+		if(gettimeofday(&start, NULL) < 0)
+			memset(&start, 0, sizeof(start));
+		ok = autr_write_disk(item->fname, tempf, item->data,
+			item->len, err, sizeof(err));
+		if(gettimeofday(&end, NULL) < 0)
+			end = start;
+		msec = (end.tv_sec > start.tv_sec ||
+			(end.tv_sec == start.tv_sec &&
+			end.tv_usec >= start.tv_usec))?
+			(size_t)((end.tv_sec - start.tv_sec)*1000 +
+			(end.tv_usec - start.tv_usec)/1000):0;
+		if(!ok)
+			log_err("autotrust: write failed, the file keeps its "
+				"previous contents: %s", err);
+		else verbose(VERB_ALGO, "autotrust: wrote %s in %u msec",
+			item->fname, (unsigned)msec);
+		lock_basic_lock(&w->lock);
+		if(ok)
+			w->num_write++;
+		else	w->num_fail++;
+		w->total_msec += msec;
+		if(msec > w->max_msec)
+			w->max_msec = msec;
+		lock_basic_unlock(&w->lock);
+		free(item->fname);
+		free(item->data);
+		free(item);
+	}
+}
+
+/** the writer thread, waits for messages on the tube */
+static void*
+autr_writer_main(void* arg)
+{
+	struct autr_writer* w = (struct autr_writer*)arg;
+	uint8_t* msg;
+	uint32_t len;
+	int quit = 0;
+	/* the signals are for the main thread */
+	ub_thread_blocksigs();
+	while(!quit) {
+		if(!tube_read_msg(w->tube, &msg, &len, 0)) {
+			log_err("autotrust writer: could not read from tube");
+			quit = 1;
+		} else {
+			quit = (len == 1 && msg[0] == 'q');
+			free(msg);
+		}
+		autr_writer_flush(w);
+	}
+	return NULL;
+}
+#endif /* !THREADS_DISABLED */
+
+int
+autr_writer_start(struct val_anchors* anchors, int thread_num)
+{
+	struct autr_writer* w;
+	if(anchors->autr->writer)
+		return 1;
+#ifdef THREADS_DISABLED
+	/* without threads the workers write the file themselves */
+	(void)w;
+	(void)thread_num;
+	return 0;
+#else
+	w = (struct autr_writer*)calloc(1, sizeof(*w));
+	if(!w) {
+		log_err("autotrust writer: out of memory");
+		return 0;
+	}
+	if(!(w->tube = tube_create())) {
+		free(w);
+		log_err("autotrust writer: could not create tube");
+		return 0;
+	}
+	w->thread_num = thread_num;
+	lock_basic_init(&w->lock);
+	lock_protect(&w->lock, &w->first, sizeof(w->first));
+	lock_protect(&w->lock, &w->last, sizeof(w->last));
+	lock_protect(&w->lock, &w->num_queued, sizeof(w->num_queued));
+	lock_protect(&w->lock, &w->num_write, sizeof(w->num_write));
+	lock_protect(&w->lock, &w->num_coalesced, sizeof(w->num_coalesced));
+	lock_protect(&w->lock, &w->num_fail, sizeof(w->num_fail));
+	lock_protect(&w->lock, &w->total_msec, sizeof(w->total_msec));
+	lock_protect(&w->lock, &w->max_msec, sizeof(w->max_msec));
+	ub_thread_create(&w->thr, autr_writer_main, w);
+	lock_basic_lock(&anchors->lock);
+	anchors->autr->writer = w;
+	lock_basic_unlock(&anchors->lock);
+	return 1;
+#endif /* THREADS_DISABLED */
+}
+
+void
+autr_writer_queue(struct autr_writer* w, char* fname, char* data,
+	size_t len)
+{
+	struct autr_write_item* item;
+	uint8_t c = 'w';
+	lock_basic_lock(&w->lock);
+	for(item = w->first; item; item = item->next) {
+		if(strcmp(item->fname, fname) == 0) {
+			/* the newer contents replace the older write */
+			free(item->data);
+			item->data = data;
+			item->len = len;
+			w->num_coalesced++;
+			lock_basic_unlock(&w->lock);
+			return;
+		}
+	}
+	lock_basic_unlock(&w->lock);
+	item = (struct autr_write_item*)calloc(1, sizeof(*item));
+	if(!item || !(item->fname = strdup(fname))) {
+		free(item);
+		free(data);
+		log_err("autotrust: out of memory, not written: %s", fname);
+		return;
+	}
+	item->data = data;
+	item->len = len;
+	lock_basic_lock(&w->lock);
+	if(w->last)
+		w->last->next = item;
+	else	w->first = item;
+	w->last = item;
+	w->num_queued++;
+	lock_basic_unlock(&w->lock);
+	if(!tube_write_msg(w->tube, &c, 1, 0))
+		log_err("autotrust: could not wake up the writer thread");
+}
+
+void autr_write_file(struct module_env* env, struct trust_anchor* tp)
+{
+	struct autr_buf out;
+	char* fname = tp->autr->file;
+	char tempf[2048], err[2560];
+	log_assert(tp->autr);
+	if(!env) {
+		log_err("autr_write_file: Module environment is NULL.");
+		return;
+	}
+	memset(&out, 0, sizeof(out));
+	if(!autr_write_contents(&out, fname, tp)) {
+		free(out.data);
+		fatal_exit("could not completely write: %s", fname);
+		return;
+	}
+	if(env->anchors && env->anchors->autr->writer) {
+		autr_writer_queue(env->anchors->autr->writer, fname,
+			out.data, out.len);
+		return;
+	}
+	/* unique name with pid number and thread number */
+	snprintf(tempf, sizeof(tempf), "%s.%d-%d", fname, (int)getpid(),
+		env->worker?*(int*)env->worker:0);
+	if(!autr_write_disk(fname, tempf, out.data, out.len, err,
+		sizeof(err))) {
+		free(out.data);
+		fatal_exit("%s", err);
+		return;
 	}
+	free(out.data);
 }
 
 /** 
@@ -42,6 +42,7 @@
 #ifndef VALIDATOR_AUTOTRUST_H
 #define VALIDATOR_AUTOTRUST_H
 #include "util/rbtree.h"
+#include "util/locks.h"
 #include "util/data/packed_rrset.h"
 struct val_anchors;
 struct trust_anchor;
@@ -49,6 +50,8 @@ struct ub_packed_rrset_key;
 struct module_env;
 struct val_env;
 struct sldns_buffer;
+struct tube;
+struct autr_writer;
 
 /** Autotrust anchor states */
 typedef enum {
@@ -127,6 +130,59 @@ struct autr_global_data {
 	/** rbtree of autotrust anchors sorted by next probe time.
 	 * When time is equal, sorted by anchor class, name. */
 	rbtree_type probe;
+	/** the writer thread for the state files, or NULL if the files
+	 * are written by the thread that updates the anchor */
+	struct autr_writer* writer;
+};
+
+/**
+ * State file write that waits for the writer thread.
+ */
+struct autr_write_item {
+	/** next in the list */
+	struct autr_write_item* next;
+	/** name of the file, malloced */
+	char* fname;
+	/** contents of the file, malloced */
+	char* data;
+	/** length of the contents */
+	size_t len;
+};
+
+/**
+ * Writer thread for the autotrust state files.  The thread that updates
+ * an anchor makes the contents of the file, and the writer thread does
+ * the write, fsync and rename, so that the worker does not wait for the
+ * disk.  A newer write for a file that is still in the list replaces the
+ * contents of the older write.
+ */
+struct autr_writer {
+	/** thread number, first entry, it is numbered after the workers
+	 * for the lock checks */
+	int thread_num;
+	/** lock on the list and the counters */
+	lock_basic_type lock;
+	/** list of writes, in the order they are to be done */
+	struct autr_write_item* first;
+	/** last in the list */
+	struct autr_write_item* last;
+	/** wakes up the writer thread, with a 'w' to write, 'q' to quit */
+	struct tube* tube;
+	/** the writer thread */
+	ub_thread_type thr;
+	/** number of writes that are queued, without the coalesced ones,
+	 * when all are done it is num_write + num_fail */
+	size_t num_queued;
+	/** number of files written */
+	size_t num_write;
+	/** number of writes that replaced an older write in the list */
+	size_t num_coalesced;
+	/** number of writes that failed */
+	size_t num_fail;
+	/** total time of the writes, in msec */
+	size_t total_msec;
+	/** longest time of a write, in msec */
+	size_t max_msec;
 };
 
 /**
@@ -136,7 +192,27 @@ struct autr_global_data {
 struct autr_global_data* autr_global_create(void);
 
 /**
- * Delete global 5011 data structure.
+ * Start the writer thread for the autotrust state files, after that the
+ * files are written by the writer thread.
+ * @param anchors: the anchors structure.
+ * @param thread_num: thread number of the writer, after the workers.
+ * @return false on failure, the files are written by the worker then.
+ */
+int autr_writer_start(struct val_anchors* anchors, int thread_num);
+
+/**
+ * Queue a state file write for the writer thread.
+ * @param writer: the writer.
+ * @param fname: name of the file.
+ * @param data: contents, malloced, the writer frees it.
+ * @param len: length of the contents.
+ */
+void autr_writer_queue(struct autr_writer* writer, char* fname, char* data,
+	size_t len);
+
+/**
+ * Delete global 5011 data structure.  Stops the writer thread, after
+ * the writes in its list are done.
  * @param global: global autotrust state to delete.
  */
 void autr_global_delete(struct autr_global_data* global);
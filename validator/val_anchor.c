@@ -49,6 +49,7 @@
 #include "util/net_help.h"
 #include "util/config_file.h"
 #include "util/as112.h"
+#include "util/storage/dnstree.h"
 #include "sldns/sbuffer.h"
 #include "sldns/rrdef.h"
 #include "sldns/str2wire.h"
@@ -144,6 +145,7 @@ anchors_delete(struct val_anchors* anchors)
 	lock_unprotect(&anchors->lock, anchors->autr);
 	lock_unprotect(&anchors->lock, anchors);
 	lock_basic_destroy(&anchors->lock);
+	name_index_delete(anchors->index);
 	if(anchors->tree)
 		traverse_postorder(anchors->tree, anchors_delfunc, NULL);
 	free(anchors->tree);
@@ -182,6 +184,18 @@ anchors_init_parents_locked(struct val_anchors* anchors)
 		lock_basic_unlock(&node->lock);
 		prev = node;
 	}
+	/* make the index, if it fails, the lookups use the tree */
+	name_index_delete(anchors->index);
+	if(!(anchors->index = name_index_create()))
+		return;
+	RBTREE_FOR(node, struct trust_anchor*, anchors->tree) {
+		if(!name_index_add(anchors->index, node, node->name,
+			node->dclass)) {
+			name_index_delete(anchors->index);
+			anchors->index = NULL;
+			return;
+		}
+	}
 }
 
 /** initialise parent pointers in the tree */
@@ -242,6 +256,9 @@ anchor_new_ta(struct val_anchors* anchors, uint8_t* name, int namelabs,
 	if(lockit) {
 		lock_basic_lock(&anchors->lock);
 	}
+	/* the index is made again when the parents are set up */
+	name_index_delete(anchors->index);
+	anchors->index = NULL;
 #ifdef UNBOUND_DEBUG
 	r =
 #else
@@ -1028,6 +1045,8 @@ anchors_assemble_rrsets(struct val_anchors* anchors)
 				"openssl"
 #endif
 				")", b);
+			name_index_delete(anchors->index);
+			anchors->index = NULL;
 			(void)rbtree_delete(anchors->tree, &ta->node);
 			lock_basic_unlock(&ta->lock);
 			if(anchors->dlv_anchor == ta)
@@ -1171,7 +1190,18 @@ anchors_lookup(struct val_anchors* anchors,
 	key.namelen = qname_len;
 	key.dclass = qclass;
 	lock_basic_lock(&anchors->lock);
-	if(rbtree_find_less_equal(anchors->tree, &key, &res)) {
+	if(anchors->index) {
+		int m;
+		result = (struct trust_anchor*)name_index_lookup(
+			anchors->index, qname, qclass, &m);
+		if(result && result->dclass != qclass)
+			result = NULL;
+		while(result) { /* go up until qname is subdomain of stub */
+			if(result->namelabs <= m)
+				break;
+			result = result->parent;
+		}
+	} else if(rbtree_find_less_equal(anchors->tree, &key, &res)) {
 		/* exact */
 		result = (struct trust_anchor*)res;
 	} else {
@@ -1205,6 +1235,7 @@ anchors_get_mem(struct val_anchors* anchors)
 	size_t s = sizeof(*anchors);
 	if(!anchors)
 		return 0;
+	s += name_index_get_mem(anchors->index);
 	RBTREE_FOR(ta, struct trust_anchor*, anchors->tree) {
 		s += sizeof(*ta) + ta->namelen;
 		/* keys and so on */
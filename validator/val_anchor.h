@@ -49,6 +49,7 @@ struct ub_packed_rrset_key;
 struct autr_point_data;
 struct autr_global_data;
 struct sldns_buffer;
+struct name_index;
 
 /**
  * Trust anchor store.
@@ -67,6 +68,12 @@ struct val_anchors {
 	 * contents of type trust_anchor.
 	 */
 	rbtree_type* tree;
+	/**
+	 * Sorted array index of the tree, for the lookups, made when the
+	 * parent pointers are set up.  NULL if the tree is changed, then
+	 * the tree itself is used.
+	 */
+	struct name_index* index;
 	/** The DLV trust anchor (if one is configured, else NULL) */
 	struct trust_anchor* dlv_anchor;
 	/** Autotrust global data, anchors sorted by next probe time */
@@ -118,7 +118,7 @@ key_cache_search(struct key_cache* kcache, uint8_t* name, size_t namelen,
 	lookfor.namelen = namelen;
 	lookfor.key_class = key_class;
 	key_entry_hash(&lookfor);
-	e = slabhash_lookup(kcache->slab, lookfor.entry.hash, &lookfor, wr);
+	e = key_entry_lookup(kcache->slab, lookfor.entry.hash, &lookfor, wr);
 	if(!e) 
 		return NULL;
 	return (struct key_entry_key*)e->key;
@@ -42,7 +42,8 @@
 #include "validator/val_kentry.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/siphash.h"
+#include "util/storage/slabhash.h"
 #include "util/regional.h"
 #include "util/net_help.h"
 #include "sldns/rrdef.h"
@@ -64,8 +65,9 @@ key_entry_sizefunc(void* key, void* data)
 	return s;
 }
 
-int 
-key_entry_compfunc(void* k1, void* k2)
+/** compare key entry keys, inlined in the key cache lookup */
+static inline int
+key_entry_cmp(void* k1, void* k2)
 {
 	struct key_entry_key* n1 = (struct key_entry_key*)k1;
 	struct key_entry_key* n2 = (struct key_entry_key*)k2;
@@ -77,6 +79,14 @@ key_entry_compfunc(void* k1, void* k2)
 	return query_dname_compare(n1->name, n2->name);
 }
 
+int 
+key_entry_compfunc(void* k1, void* k2)
+{
+	return key_entry_cmp(k1, k2);
+}
+
+SLABHASH_LOOKUP_FUNC(key_entry_lookup, key_entry_compfunc, key_entry_cmp)
+
 void 
 key_entry_delkeyfunc(void* key, void* ATTR_UNUSED(userarg))
 {
@@ -102,7 +112,7 @@ void
 key_entry_hash(struct key_entry_key* kk)
 {
 	kk->entry.hash = 0x654;
-	kk->entry.hash = hashlittle(&kk->key_class, sizeof(kk->key_class), 
+	kk->entry.hash = siphash_hash(&kk->key_class, sizeof(kk->key_class), 
 		kk->entry.hash);
 	kk->entry.hash = dname_query_hash(kk->name, kk->entry.hash);
 }
@@ -44,6 +44,7 @@
 struct packed_rrset_data;
 struct regional;
 struct ub_packed_rrset_key;
+struct slabhash;
 #include "util/storage/lruhash.h"
 
 /**
@@ -94,6 +95,18 @@ size_t key_entry_sizefunc(void* key, void* data);
 /** function for lruhash operation */
 int key_entry_compfunc(void* k1, void* k2);
 
+/**
+ * Lookup an entry in the key cache, like slabhash_lookup, with the
+ * compare function inlined.
+ * @param table: the key cache hashtable.
+ * @param hash: hash of key.
+ * @param key: what to look for.
+ * @param wr: set to true if you desire a writelock on the entry.
+ * @return: pointer to the entry or NULL. The entry is locked.
+ */
+struct lruhash_entry* key_entry_lookup(struct slabhash* table, hashvalue_type hash,
+	void* key, int wr);
+
 /** function for lruhash operation */
 void key_entry_delkeyfunc(void* key, void* userarg);
 
@@ -85,18 +85,32 @@ int val_neg_zone_compare(const void* a, const void* b)
 
 struct val_neg_cache* val_neg_create(struct config_file* cfg, size_t maxiter)
 {
+	int i;
 	struct val_neg_cache* neg = (struct val_neg_cache*)calloc(1, 
 		sizeof(*neg));
 	if(!neg) {
 		log_err("Could not create neg cache: out of memory");
 		return NULL;
 	}
+	neg->shards = (struct val_neg_shard*)calloc(NEG_CACHE_SHARDS,
+		sizeof(struct val_neg_shard));
+	if(!neg->shards) {
+		free(neg);
+		log_err("Could not create neg cache: out of memory");
+		return NULL;
+	}
 	neg->nsec3_max_iter = maxiter;
 	neg->max = 1024*1024; /* 1 M is thousands of entries */
 	if(cfg) neg->max = cfg->neg_cache_size;
-	rbtree_init(&neg->tree, &val_neg_zone_compare);
 	lock_basic_init(&neg->lock);
-	lock_protect(&neg->lock, neg, sizeof(*neg));
+	lock_protect(&neg->lock, &neg->use, sizeof(neg->use));
+	for(i=0; i<NEG_CACHE_SHARDS; i++) {
+		struct val_neg_shard* sh = &neg->shards[i];
+		sh->neg = neg;
+		rbtree_init(&sh->tree, &val_neg_zone_compare);
+		lock_basic_init(&sh->lock);
+		lock_protect(&sh->lock, sh, sizeof(*sh));
+	}
 	return neg;
 }
 
@@ -104,11 +118,62 @@ size_t val_neg_get_mem(struct val_neg_cache* neg)
 {
 	size_t result;
 	lock_basic_lock(&neg->lock);
-	result = sizeof(*neg) + neg->use;
+	result = sizeof(*neg) + sizeof(struct val_neg_shard)*NEG_CACHE_SHARDS
+		+ neg->use;
 	lock_basic_unlock(&neg->lock);
 	return result;
 }
 
+size_t val_neg_get_contended(struct val_neg_cache* neg)
+{
+	size_t result = 0;
+	int i;
+	for(i=0; i<NEG_CACHE_SHARDS; i++) {
+		lock_basic_lock(&neg->shards[i].lock);
+		result += neg->shards[i].contended;
+		lock_basic_unlock(&neg->shards[i].lock);
+	}
+	return result;
+}
+
+struct val_neg_shard* neg_shard_get(struct val_neg_cache* neg, uint8_t* nm)
+{
+	uint8_t* top = nm;
+	/* the top label, the root is the top label of the root */
+	while(*nm) {
+		top = nm;
+		nm += *nm + 1;
+	}
+	return &neg->shards[dname_query_hash(top, 0)&(NEG_CACHE_SHARDS-1)];
+}
+
+/** lock a shard, and count it if the lock is busy */
+static void neg_shard_lock(struct val_neg_shard* sh)
+{
+	if(!lock_basic_trylock(&sh->lock)) {
+		lock_basic_lock(&sh->lock);
+		sh->contended++;
+	}
+}
+
+/** count the memory use of the shard in the total of the cache */
+static void neg_shard_count_use(struct val_neg_shard* sh)
+{
+	if(sh->use == sh->use_counted)
+		return;
+	lock_basic_lock(&sh->neg->lock);
+	sh->neg->use = sh->neg->use - sh->use_counted + sh->use;
+	lock_basic_unlock(&sh->neg->lock);
+	sh->use_counted = sh->use;
+}
+
+/** unlock a shard, after its memory use is counted in the cache total */
+static void neg_shard_unlock(struct val_neg_shard* sh)
+{
+	neg_shard_count_use(sh);
+	lock_basic_unlock(&sh->lock);
+}
+
 /** clear datas on cache deletion */
 static void
 neg_clear_datas(rbnode_type* n, void* ATTR_UNUSED(arg))
@@ -132,69 +197,75 @@ neg_clear_zones(rbnode_type* n, void* ATTR_UNUSED(arg))
 
 void neg_cache_delete(struct val_neg_cache* neg)
 {
+	int i;
 	if(!neg) return;
 	lock_basic_destroy(&neg->lock);
-	/* delete all the zones in the tree */
-	traverse_postorder(&neg->tree, &neg_clear_zones, NULL);
+	for(i=0; i<NEG_CACHE_SHARDS; i++) {
+		lock_basic_destroy(&neg->shards[i].lock);
+		/* delete all the zones in the tree */
+		traverse_postorder(&neg->shards[i].tree, &neg_clear_zones,
+			NULL);
+	}
+	free(neg->shards);
 	free(neg);
 }
 
 /**
  * Put data element at the front of the LRU list.
- * @param neg: negative cache with LRU start and end.
+ * @param sh: shard of the negative cache with LRU start and end.
  * @param data: this data is fronted.
  */
-static void neg_lru_front(struct val_neg_cache* neg, 
+static void neg_lru_front(struct val_neg_shard* sh, 
 	struct val_neg_data* data)
 {
 	data->prev = NULL;
-	data->next = neg->first;
-	if(!neg->first)
-		neg->last = data;
-	else	neg->first->prev = data;
-	neg->first = data;
+	data->next = sh->first;
+	if(!sh->first)
+		sh->last = data;
+	else	sh->first->prev = data;
+	sh->first = data;
 }
 
 /**
  * Remove data element from LRU list.
- * @param neg: negative cache with LRU start and end.
+ * @param sh: shard of the negative cache with LRU start and end.
  * @param data: this data is removed from the list.
  */
-static void neg_lru_remove(struct val_neg_cache* neg, 
+static void neg_lru_remove(struct val_neg_shard* sh, 
 	struct val_neg_data* data)
 {
 	if(data->prev)
 		data->prev->next = data->next;
-	else	neg->first = data->next;
+	else	sh->first = data->next;
 	if(data->next)
 		data->next->prev = data->prev;
-	else	neg->last = data->prev;
+	else	sh->last = data->prev;
 }
 
 /**
  * Touch LRU for data element, put it at the start of the LRU list.
- * @param neg: negative cache with LRU start and end.
+ * @param sh: shard of the negative cache with LRU start and end.
  * @param data: this data is used.
  */
-static void neg_lru_touch(struct val_neg_cache* neg, 
+static void neg_lru_touch(struct val_neg_shard* sh, 
 	struct val_neg_data* data)
 {
-	if(data == neg->first)
+	if(data == sh->first)
 		return; /* nothing to do */
 	/* remove from current lru position */
-	neg_lru_remove(neg, data);
+	neg_lru_remove(sh, data);
 	/* add at front */
-	neg_lru_front(neg, data);
+	neg_lru_front(sh, data);
 }
 
 /**
  * Delete a zone element from the negative cache.
  * May delete other zone elements to keep tree coherent, or
  * only mark the element as 'not in use'.
- * @param neg: negative cache.
+ * @param sh: shard of the negative cache.
  * @param z: zone element to delete.
  */
-static void neg_delete_zone(struct val_neg_cache* neg, struct val_neg_zone* z)
+static void neg_delete_zone(struct val_neg_shard* sh, struct val_neg_zone* z)
 {
 	struct val_neg_zone* p, *np;
 	if(!z) return;
@@ -214,8 +285,8 @@ static void neg_delete_zone(struct val_neg_cache* neg, struct val_neg_zone* z)
 	p = z;
 	while(p && p->count == 0) {
 		np = p->parent;
-		(void)rbtree_delete(&neg->tree, &p->node);
-		neg->use -= p->len + sizeof(*p);
+		(void)rbtree_delete(&sh->tree, &p->node);
+		sh->use -= p->len + sizeof(*p);
 		free(p->nsec3_salt);
 		free(p->name);
 		free(p);
@@ -223,7 +294,7 @@ static void neg_delete_zone(struct val_neg_cache* neg, struct val_neg_zone* z)
 	}
 }
 	
-void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
+void neg_delete_data(struct val_neg_shard* sh, struct val_neg_data* el)
 {
 	struct val_neg_zone* z;
 	struct val_neg_data* p, *np;
@@ -234,7 +305,7 @@ void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
 	el->in_use = 0;
 
 	/* remove it from the lru list */
-	neg_lru_remove(neg, el);
+	neg_lru_remove(sh, el);
 	
 	/* go up the tree and reduce counts */
 	p = el;
@@ -249,7 +320,7 @@ void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
 	while(p && p->count == 0) {
 		np = p->parent;
 		(void)rbtree_delete(&z->tree, &p->node);
-		neg->use -= p->len + sizeof(*p);
+		sh->use -= p->len + sizeof(*p);
 		free(p->name);
 		free(p);
 		p = np;
@@ -257,26 +328,58 @@ void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
 
 	/* check if the zone is now unused */
 	if(z->tree.count == 0) {
-		neg_delete_zone(neg, z);
+		neg_delete_zone(sh, z);
 	}
 }
 
 /**
  * Create more space in negative cache
  * The oldest elements are deleted until enough space is present.
- * Empty zones are deleted.
- * @param neg: negative cache.
+ * Empty zones are deleted.  The shard deletes its own elements if it
+ * uses more than its part of the memory, and otherwise those of other
+ * shards that use more than their part, if they are not busy; with
+ * one shard in use the shard can have all of the memory.
+ * @param sh: shard of the negative cache, locked.
  * @param need: how many bytes are needed.
  */
-static void neg_make_space(struct val_neg_cache* neg, size_t need)
+static void neg_make_space(struct val_neg_shard* sh, size_t need)
 {
+	struct val_neg_cache* neg = sh->neg;
+	size_t part = neg->max / NEG_CACHE_SHARDS, other, before;
+	int i;
+	/* the memory used by the other shards */
+	lock_basic_lock(&neg->lock);
+	other = neg->use - sh->use_counted;
+	lock_basic_unlock(&neg->lock);
+	if(neg->max >= other + sh->use + need)
+		return;
+	/* delete elements of this shard if it has more than its part */
+	while(sh->last && neg->max < other + sh->use + need &&
+		sh->use + need > part) {
+		neg_delete_data(sh, sh->last);
+	}
+	/* delete elements of the other shards, one at a time is locked */
+	for(i=0; i<NEG_CACHE_SHARDS && neg->max < other + sh->use + need;
+		i++) {
+		struct val_neg_shard* o = &neg->shards[i];
+		if(o == sh || !lock_basic_trylock(&o->lock))
+			continue;
+		while(o->last && neg->max < other + sh->use + need &&
+			o->use > part) {
+			before = o->use;
+			neg_delete_data(o, o->last);
+			other -= before - o->use;
+		}
+		neg_shard_unlock(o);
+	}
 	/* delete elements until enough space or its empty */
-	while(neg->last && neg->max < neg->use + need) {
-		neg_delete_data(neg, neg->last);
+	while(sh->last && neg->max < other + sh->use + need) {
+		neg_delete_data(sh, sh->last);
 	}
+	neg_shard_count_use(sh);
 }
 
-struct val_neg_zone* neg_find_zone(struct val_neg_cache* neg, 
+struct val_neg_zone* neg_find_zone(struct val_neg_shard* sh, 
 	uint8_t* nm, size_t len, uint16_t dclass)
 {
 	struct val_neg_zone lookfor;
@@ -288,7 +391,7 @@ struct val_neg_zone* neg_find_zone(struct val_neg_cache* neg,
 	lookfor.dclass = dclass;
 
 	result = (struct val_neg_zone*)
-		rbtree_search(&neg->tree, lookfor.node.key);
+		rbtree_search(&sh->tree, lookfor.node.key);
 	return result;
 }
 
@@ -359,14 +462,14 @@ static size_t calc_zone_need(uint8_t* d, size_t len)
 
 /**
  * Find closest existing parent zone of the given name.
- * @param neg: negative cache.
+ * @param sh: shard of the negative cache.
  * @param nm: name to look for
  * @param nm_len: length of nm
  * @param labs: labelcount of nm.
  * @param qclass: class.
  * @return the zone or NULL if none found.
  */
-static struct val_neg_zone* neg_closest_zone_parent(struct val_neg_cache* neg,
+static struct val_neg_zone* neg_closest_zone_parent(struct val_neg_shard* sh,
 	uint8_t* nm, size_t nm_len, int labs, uint16_t qclass)
 {
 	struct val_neg_zone key;
@@ -377,7 +480,7 @@ static struct val_neg_zone* neg_closest_zone_parent(struct val_neg_cache* neg,
 	key.len = nm_len;
 	key.labs = labs;
 	key.dclass = qclass;
-	if(rbtree_find_less_equal(&neg->tree, &key, &res)) {
+	if(rbtree_find_less_equal(&sh->tree, &key, &res)) {
 		/* exact match */
 		result = (struct val_neg_zone*)res;
 	} else {
@@ -398,6 +501,42 @@ static struct val_neg_zone* neg_closest_zone_parent(struct val_neg_cache* neg,
 	return result;
 }
 
+/**
+ * Find the closest parent zone of the name that is in use.  It looks in
+ * the shard of the name, and then in the shard of the root for the root.
+ * @param neg: negative cache.
+ * @param nm: name to look for
+ * @param nm_len: length of nm
+ * @param labs: labelcount of nm.
+ * @param qclass: class.
+ * @param shp: returns the shard of the zone, locked, also if no zone
+ *	is found, the caller unlocks it.
+ * @return the zone or NULL if none found.
+ */
+static struct val_neg_zone* neg_closest_zone_inuse(
+	struct val_neg_cache* neg, uint8_t* nm, size_t nm_len, int labs,
+	uint16_t qclass, struct val_neg_shard** shp)
+{
+	struct val_neg_shard* sh = neg_shard_get(neg, nm), *rootsh;
+	struct val_neg_zone* zone;
+	uint8_t root = 0;
+	neg_shard_lock(sh);
+	zone = neg_closest_zone_parent(sh, nm, nm_len, labs, qclass);
+	while(zone && !zone->in_use)
+		zone = zone->parent;
+	if(!zone && (rootsh = neg_shard_get(neg, &root)) != sh) {
+		/* the zones above the top label are only the root */
+		neg_shard_unlock(sh);
+		sh = rootsh;
+		neg_shard_lock(sh);
+		zone = neg_find_zone(sh, &root, 1, qclass);
+		if(zone && !zone->in_use)
+			zone = NULL;
+	}
+	*shp = sh;
+	return zone;
+}
+
 /**
  * Find closest existing parent data for the given name.
  * @param zone: to look in.
@@ -526,7 +665,7 @@ void val_neg_zone_take_inuse(struct val_neg_zone* zone)
 	}
 }
 
-struct val_neg_zone* neg_create_zone(struct val_neg_cache* neg,
+struct val_neg_zone* neg_create_zone(struct val_neg_shard* sh,
 	uint8_t* nm, size_t nm_len, uint16_t dclass)
 {
 	struct val_neg_zone* zone;
@@ -535,7 +674,7 @@ struct val_neg_zone* neg_create_zone(struct val_neg_cache* neg,
 	int labs = dname_count_labels(nm);
 
 	/* find closest enclosing parent zone that (still) exists */
-	parent = neg_closest_zone_parent(neg, nm, nm_len, labs, dclass);
+	parent = neg_closest_zone_parent(sh, nm, nm_len, labs, dclass);
 	if(parent && query_dname_compare(parent->name, nm) == 0)
 		return parent; /* already exists, weird */
 	/* if parent exists, it is in use */
@@ -550,9 +689,9 @@ struct val_neg_zone* neg_create_zone(struct val_neg_cache* neg,
 	while(p) {
 		np = p->parent;
 		/* mem use */
-		neg->use += sizeof(struct val_neg_zone) + p->len;
+		sh->use += sizeof(struct val_neg_zone) + p->len;
 		/* insert in tree */
-		(void)rbtree_insert(&neg->tree, &p->node);
+		(void)rbtree_insert(&sh->tree, &p->node);
 		/* last one needs proper parent pointer */
 		if(np == NULL)
 			p->parent = parent;
@@ -664,12 +803,12 @@ static struct val_neg_data* neg_data_chain(
 /**
  * Remove NSEC records between start and end points.
  * By walking the tree, the tree is sorted canonically.
- * @param neg: negative cache.
+ * @param sh: shard of the negative cache.
  * @param zone: the zone
  * @param el: element to start walking at.
  * @param nsec: the nsec record with the end point
  */
-static void wipeout(struct val_neg_cache* neg, struct val_neg_zone* zone, 
+static void wipeout(struct val_neg_shard* sh, struct val_neg_zone* zone, 
 	struct val_neg_data* el, struct ub_packed_rrset_key* nsec)
 {
 	struct packed_rrset_data* d = (struct packed_rrset_data*)nsec->
@@ -739,12 +878,12 @@ static void wipeout(struct val_neg_cache* neg, struct val_neg_zone* zone,
 		 * it cannot get deleted, the zone cannot get empty.
 		 * If the next==NULL, then zone can be empty. */
 		if(cur->in_use)
-			neg_delete_data(neg, cur);
+			neg_delete_data(sh, cur);
 		walk = next;
 	}
 }
 
-void neg_insert_data(struct val_neg_cache* neg, 
+void neg_insert_data(struct val_neg_shard* sh, 
 	struct val_neg_zone* zone, struct ub_packed_rrset_key* nsec)
 {
 	struct packed_rrset_data* d;
@@ -787,7 +926,7 @@ void neg_insert_data(struct val_neg_cache* neg,
 		while(p) {
 			np = p->parent;
 			/* mem use */
-			neg->use += sizeof(struct val_neg_data) + p->len;
+			sh->use += sizeof(struct val_neg_data) + p->len;
 			/* insert in tree */
 			p->zone = zone;
 			(void)rbtree_insert(&zone->tree, &p->node);
@@ -807,10 +946,10 @@ void neg_insert_data(struct val_neg_cache* neg,
 			p->count++;
 		}
 
-		neg_lru_front(neg, el);
+		neg_lru_front(sh, el);
 	} else {
 		/* in use, bring to front, lru */
-		neg_lru_touch(neg, el);
+		neg_lru_touch(sh, el);
 	}
 
 	/* if nsec3 store last used parameters */
@@ -819,7 +958,7 @@ void neg_insert_data(struct val_neg_cache* neg,
 		uint8_t* s;
 		size_t slen, it;
 		if(nsec3_get_params(nsec, 0, &h, &it, &s, &slen) &&
-			it <= neg->nsec3_max_iter &&
+			it <= sh->neg->nsec3_max_iter &&
 			(h != zone->nsec3_hash || it != zone->nsec3_iter ||
 			slen != zone->nsec3_saltlen || 
 			memcmp(zone->nsec3_salt, s, slen) != 0)) {
@@ -844,7 +983,7 @@ void neg_insert_data(struct val_neg_cache* neg,
 	}
 
 	/* wipe out the cache items between NSEC start and end */
-	wipeout(neg, zone, el, nsec);
+	wipeout(sh, zone, el, nsec);
 }
 
 void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
@@ -852,6 +991,7 @@ void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 	size_t i, need;
 	struct ub_packed_rrset_key* soa;
 	struct val_neg_zone* zone;
+	struct val_neg_shard* sh;
 	/* see if secure nsecs inside */
 	if(!reply_has_nsec(rep))
 		return;
@@ -866,16 +1006,17 @@ void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 	/* ask for enough space to store all of it */
 	need = calc_data_need(rep) + 
 		calc_zone_need(soa->rk.dname, soa->rk.dname_len);
-	lock_basic_lock(&neg->lock);
-	neg_make_space(neg, need);
+	sh = neg_shard_get(neg, soa->rk.dname);
+	neg_shard_lock(sh);
+	neg_make_space(sh, need);
 
 	/* find or create the zone entry */
-	zone = neg_find_zone(neg, soa->rk.dname, soa->rk.dname_len,
+	zone = neg_find_zone(sh, soa->rk.dname, soa->rk.dname_len,
 		ntohs(soa->rk.rrset_class));
 	if(!zone) {
-		if(!(zone = neg_create_zone(neg, soa->rk.dname, 
+		if(!(zone = neg_create_zone(sh, soa->rk.dname, 
 			soa->rk.dname_len, ntohs(soa->rk.rrset_class)))) {
-			lock_basic_unlock(&neg->lock);
+			neg_shard_unlock(sh);
 			log_err("out of memory adding negative zone");
 			return;
 		}
@@ -889,13 +1030,13 @@ void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 		if(!dname_subdomain_c(rep->rrsets[i]->rk.dname, 
 			zone->name)) continue;
 		/* insert NSEC into this zone's tree */
-		neg_insert_data(neg, zone, rep->rrsets[i]);
+		neg_insert_data(sh, zone, rep->rrsets[i]);
 	}
 	if(zone->tree.count == 0) {
 		/* remove empty zone if inserts failed */
-		neg_delete_zone(neg, zone);
+		neg_delete_zone(sh, zone);
 	}
-	lock_basic_unlock(&neg->lock);
+	neg_shard_unlock(sh);
 }
 
 /**
@@ -933,6 +1074,7 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 	/* lookup closest zone */
 	struct val_neg_zone* zone;
 	struct val_neg_data* data;
+	struct val_neg_shard* sh;
 	int labs;
 	struct ub_packed_rrset_key* nsec;
 	struct packed_rrset_data* d;
@@ -945,12 +1087,9 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 		LDNS_RR_TYPE_DLV, qclass);
 	
 	labs = dname_count_labels(qname);
-	lock_basic_lock(&neg->lock);
-	zone = neg_closest_zone_parent(neg, qname, len, labs, qclass);
-	while(zone && !zone->in_use)
-		zone = zone->parent;
+	zone = neg_closest_zone_inuse(neg, qname, len, labs, qclass, &sh);
 	if(!zone) {
-		lock_basic_unlock(&neg->lock);
+		neg_shard_unlock(sh);
 		return 0;
 	}
 	log_nametypeclass(VERB_ALGO, "negcache zone", zone->name, 0, 
@@ -958,7 +1097,7 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 
 	/* DLV is defined to use NSEC only */
 	if(zone->nsec3_hash) {
-		lock_basic_unlock(&neg->lock);
+		neg_shard_unlock(sh);
 		return 0;
 	}
 
@@ -967,7 +1106,7 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 	while(data && !data->in_use)
 		data = data->parent;
 	if(!data) {
-		lock_basic_unlock(&neg->lock);
+		neg_shard_unlock(sh);
 		return 0;
 	}
 	log_nametypeclass(VERB_ALGO, "negcache rr", data->name, 
@@ -982,21 +1121,21 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 
 	/* check if secure and TTL ok */
 	if(!nsec) {
-		lock_basic_unlock(&neg->lock);
+		neg_shard_unlock(sh);
 		return 0;
 	}
 	d = (struct packed_rrset_data*)nsec->entry.data;
 	if(!d || now > d->ttl) {
 		lock_rw_unlock(&nsec->entry.lock);
 		/* delete data record if expired */
-		neg_delete_data(neg, data);
-		lock_basic_unlock(&neg->lock);
+		neg_delete_data(sh, data);
+		neg_shard_unlock(sh);
 		return 0;
 	}
 	if(d->security != sec_status_secure) {
 		lock_rw_unlock(&nsec->entry.lock);
-		neg_delete_data(neg, data);
-		lock_basic_unlock(&neg->lock);
+		neg_delete_data(sh, data);
+		neg_shard_unlock(sh);
 		return 0;
 	}
 	verbose(VERB_ALGO, "negcache got secure rrset");
@@ -1012,7 +1151,7 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 		!val_nsec_proves_name_error(nsec, qname)) {
 		/* the NSEC is not a denial for the DLV */
 		lock_rw_unlock(&nsec->entry.lock);
-		lock_basic_unlock(&neg->lock);
+		neg_shard_unlock(sh);
 		verbose(VERB_ALGO, "negcache not proven");
 		return 0;
 	}
@@ -1023,8 +1162,8 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 
 	lock_rw_unlock(&nsec->entry.lock);
 	/* if OK touch the LRU for neg_data element */
-	neg_lru_touch(neg, data);
-	lock_basic_unlock(&neg->lock);
+	neg_lru_touch(sh, data);
+	neg_shard_unlock(sh);
 	verbose(VERB_ALGO, "negcache DLV denial proven");
 	return 1;
 }
@@ -1064,6 +1203,7 @@ void val_neg_addreferral(struct val_neg_cache* neg, struct reply_info* rep,
 	size_t signer_len;
 	uint16_t dclass;
 	struct val_neg_zone* zone;
+	struct val_neg_shard* sh;
 	/* no SOA in this message, find RRSIG over NSEC's signer name.
 	 * note the NSEC records are maybe not validated yet */
 	signer = reply_nsec_signer(rep, &signer_len, &dclass);
@@ -1079,15 +1219,16 @@ void val_neg_addreferral(struct val_neg_cache* neg, struct reply_info* rep,
 	
 	/* ask for enough space to store all of it */
 	need = calc_data_need(rep) + calc_zone_need(signer, signer_len);
-	lock_basic_lock(&neg->lock);
-	neg_make_space(neg, need);
+	sh = neg_shard_get(neg, signer);
+	neg_shard_lock(sh);
+	neg_make_space(sh, need);
 
 	/* find or create the zone entry */
-	zone = neg_find_zone(neg, signer, signer_len, dclass);
+	zone = neg_find_zone(sh, signer, signer_len, dclass);
 	if(!zone) {
-		if(!(zone = neg_create_zone(neg, signer, signer_len, 
+		if(!(zone = neg_create_zone(sh, signer, signer_len, 
 			dclass))) {
-			lock_basic_unlock(&neg->lock);
+			neg_shard_unlock(sh);
 			log_err("out of memory adding negative zone");
 			return;
 		}
@@ -1102,13 +1243,13 @@ void val_neg_addreferral(struct val_neg_cache* neg, struct reply_info* rep,
 		if(!dname_subdomain_c(rep->rrsets[i]->rk.dname, 
 			zone->name)) continue;
 		/* insert NSEC into this zone's tree */
-		neg_insert_data(neg, zone, rep->rrsets[i]);
+		neg_insert_data(sh, zone, rep->rrsets[i]);
 	}
 	if(zone->tree.count == 0) {
 		/* remove empty zone if inserts failed */
-		neg_delete_zone(neg, zone);
+		neg_delete_zone(sh, zone);
 	}
-	lock_basic_unlock(&neg->lock);
+	neg_shard_unlock(sh);
 }
 
 /**
@@ -1408,6 +1549,7 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 	size_t zname_len;
 	int zname_labs;
 	struct val_neg_zone* zone;
+	struct val_neg_shard* sh;
 
 	/* only for DS queries */
 	if(qinfo->qtype != LDNS_RR_TYPE_DS)
@@ -1443,11 +1585,8 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 	zname_labs = dname_count_labels(zname);
 
 	/* lookup closest zone */
-	lock_basic_lock(&neg->lock);
-	zone = neg_closest_zone_parent(neg, zname, zname_len, zname_labs, 
-		qinfo->qclass);
-	while(zone && !zone->in_use)
-		zone = zone->parent;
+	zone = neg_closest_zone_inuse(neg, zname, zname_len, zname_labs, 
+		qinfo->qclass, &sh);
 	/* check that the zone is not too high up so that we do not pick data
 	 * out of a zone that is above the last-seen key (or trust-anchor). */
 	if(zone && topname) {
@@ -1455,16 +1594,16 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 			zone = NULL;
 	}
 	if(!zone) {
-		lock_basic_unlock(&neg->lock);
+		neg_shard_unlock(sh);
 		return NULL;
 	}
 
 	msg = neg_nsec3_proof_ds(zone, qinfo->qname, qinfo->qname_len, 
 		zname_labs+1, buf, rrset_cache, region, now, topname);
 	if(msg && addsoa && !add_soa(rrset_cache, now, region, msg, zone)) {
-		lock_basic_unlock(&neg->lock);
+		neg_shard_unlock(sh);
 		return NULL;
 	}
-	lock_basic_unlock(&neg->lock);
+	neg_shard_unlock(sh);
 	return msg;
 }
@@ -56,17 +56,40 @@ struct query_info;
 struct dns_msg;
 struct ub_packed_rrset_key;
 
+/** number of shards of the negative cache, a power of two */
+#define NEG_CACHE_SHARDS 16
+
 /**
  * The negative cache.  It is shared between the threads, so locked. 
  * Kept as validator-environ-state.  It refers back to the rrset cache for
  * data elements.  It can be out of date and contain conflicting data 
  * from zone content changes.  
- * It contains a tree of zones, every zone has a tree of data elements.
- * The data elements are part of one big LRU list, with one memory counter.
+ * It is split in shards by the hash of the top label of the zone name,
+ * so that the zones and their parents below the root are in one shard,
+ * every shard has its own lock, tree of zones and LRU list.  The
+ * memory limit is for all of the shards together.
  */
 struct val_neg_cache {
-	/** the big lock on the negative cache.  Because we use a rbtree 
-	 * for the data (quick lookup), we need a big lock */
+	/** lock on the memory counter, it is taken after a shard lock */
+	lock_basic_type lock;
+	/** current memory in use (bytes), by all the shards */
+	size_t use;
+	/** max memory to use (bytes) */
+	size_t max;
+	/** max nsec3 iterations allowed */
+	size_t nsec3_max_iter;
+	/** the shards */
+	struct val_neg_shard* shards;
+};
+
+/**
+ * A shard of the negative cache.  It contains a tree of zones, every zone
+ * has a tree of data elements.  The data elements are part of the LRU
+ * list of the shard.
+ */
+struct val_neg_shard {
+	/** lock on the shard.  Because we use a rbtree for the data
+	 * (quick lookup), we need a lock on the whole shard */
 	lock_basic_type lock;
 	/** The zone rbtree. contents sorted canonical, type val_neg_zone */
 	rbtree_type tree;
@@ -74,12 +97,14 @@ struct val_neg_cache {
 	struct val_neg_data* first;
 	/** last in lru (least recently used element) */
 	struct val_neg_data* last;
-	/** current memory in use (bytes) */
+	/** memory in use by this shard (bytes) */
 	size_t use;
-	/** max memory to use (bytes) */
-	size_t max;
-	/** max nsec3 iterations allowed */
-	size_t nsec3_max_iter;
+	/** the part of use that is counted in the cache total */
+	size_t use_counted;
+	/** number of times the lock was busy when it was taken */
+	size_t contended;
+	/** the negative cache this shard is part of */
+	struct val_neg_cache* neg;
 };
 
 /**
@@ -178,6 +203,13 @@ struct val_neg_cache* val_neg_create(struct config_file* cfg, size_t maxiter);
  */
 size_t val_neg_get_mem(struct val_neg_cache* neg);
 
+/**
+ * Get the number of times that a lock of the negative cache was busy.
+ * @param neg: negative cache
+ * @return lock contention count.
+ */
+size_t val_neg_get_contended(struct val_neg_cache* neg);
+
 /**
  * Destroy negative cache. There must no longer be any other threads.
  * @param neg: negative cache.
@@ -262,13 +294,22 @@ struct dns_msg* val_neg_getmsg(struct val_neg_cache* neg,
 
 /**** functions exposed for unit test ****/
 /**
- * Insert data into the data tree of a zone
+ * Get the shard for a zone name, by the top label of the name.
  * Does not do locking.
  * @param neg: negative cache
+ * @param nm: zone name.
+ * @return the shard.
+ */
+struct val_neg_shard* neg_shard_get(struct val_neg_cache* neg, uint8_t* nm);
+
+/**
+ * Insert data into the data tree of a zone
+ * Does not do locking.
+ * @param sh: shard of the negative cache, with the zone.
  * @param zone: zone to insert into
  * @param nsec: record to insert.
  */
-void neg_insert_data(struct val_neg_cache* neg,
+void neg_insert_data(struct val_neg_shard* sh,
         struct val_neg_zone* zone, struct ub_packed_rrset_key* nsec);
 
 /**
@@ -276,33 +317,33 @@ void neg_insert_data(struct val_neg_cache* neg,
  * May delete other data elements to keep tree coherent, or
  * only mark the element as 'not in use'.
  * Does not do locking.
- * @param neg: negative cache.
+ * @param sh: shard of the negative cache, with the element.
  * @param el: data element to delete.
  */
-void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el);
+void neg_delete_data(struct val_neg_shard* sh, struct val_neg_data* el);
 
 /**
  * Find the given zone, from the SOA owner name and class
  * Does not do locking.
- * @param neg: negative cache
+ * @param sh: shard of the negative cache for the name.
  * @param nm: what to look for.
  * @param len: length of nm
  * @param dclass: class to look for.
  * @return zone or NULL if not found.
  */
-struct val_neg_zone* neg_find_zone(struct val_neg_cache* neg,
+struct val_neg_zone* neg_find_zone(struct val_neg_shard* sh,
         uint8_t* nm, size_t len, uint16_t dclass);
 
 /**
  * Create a new zone.
  * Does not do locking.
- * @param neg: negative cache
+ * @param sh: shard of the negative cache for the name.
  * @param nm: what to look for.
  * @param nm_len: length of name.
  * @param dclass: class of zone, host order.
  * @return zone or NULL if out of memory.
  */
-struct val_neg_zone* neg_create_zone(struct val_neg_cache* neg,
+struct val_neg_zone* neg_create_zone(struct val_neg_shard* sh,
         uint8_t* nm, size_t nm_len, uint16_t dclass);
 
 /**